@@ -0,0 +1,8492 @@
+data
+align 4
+LABELV master_items
+address $80
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+byte 4 0
+align 4
+LABELV servertype_items
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+address $101
+byte 4 0
+align 4
+LABELV sortkey_items
+address $102
+address $103
+address $104
+address $105
+address $106
+address $107
+byte 4 0
+align 4
+LABELV gamenames
+address $108
+address $109
+address $110
+address $111
+address $112
+address $113
+address $114
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+address $115
+address $116
+address $117
+address $118
+byte 4 0
+align 4
+LABELV netnames
+address $118
+address $119
+address $120
+byte 4 0
+align 1
+LABELV quake3worldMessage
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 119
+byte 1 119
+byte 1 46
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+export ArenaServers_SourceForLAN
+code
+proc ArenaServers_SourceForLAN 4 0
+ADDRLP4 0
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $125
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $125
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $130
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $130
+address $127
+address $128
+address $127
+address $128
+address $128
+address $128
+address $128
+address $128
+address $129
+code
+LABELV $125
+LABELV $127
+CNSTI4 0
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $128
+CNSTI4 2
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $129
+CNSTI4 3
+RETI4
+LABELV $124
+endproc ArenaServers_SourceForLAN 4 0
+export Q_CleanStrWithColor
+proc Q_CleanStrWithColor 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $135
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $135
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $135
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $135
+ADDRLP4 20
+INDIRI4
+CNSTI4 56
+GTI4 $135
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $137
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+GTI4 $137
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $137
+LABELV $136
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $133
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $131
+endproc Q_CleanStrWithColor 32 0
+proc ArenaServers_MaxPing 8 4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+GEI4 $141
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $141
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $139
+endproc ArenaServers_MaxPing 8 4
+proc ArenaServers_Compare 96 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $144
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+GTI4 $144
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $176
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $176
+address $146
+address $147
+address $148
+address $162
+address $167
+address $157
+code
+LABELV $146
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $147
+ADDRLP4 28
+CNSTI4 98
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $148
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $149
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $149
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $151
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+LABELV $151
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $153
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $153
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $155
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $155
+CNSTI4 -1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $157
+ADDRLP4 44
+CNSTI4 124
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $158
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $158
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $160
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $160
+CNSTI4 -1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $162
+ADDRLP4 48
+CNSTI4 140
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $163
+CNSTI4 -1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $163
+ADDRLP4 52
+CNSTI4 140
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $165
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $165
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $167
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 172
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $168
+ADDRLP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $168
+ADDRLP4 56
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $168
+CNSTI4 -1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $168
+ADDRLP4 68
+CNSTI4 172
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $170
+ADDRLP4 76
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $170
+ADDRLP4 76
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $170
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $170
+ADDRLP4 80
+CNSTI4 136
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $172
+CNSTI4 -1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $172
+ADDRLP4 84
+CNSTI4 136
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $174
+CNSTI4 1
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $174
+ADDRLP4 88
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $144
+CNSTI4 0
+RETI4
+LABELV $143
+endproc ArenaServers_Compare 96 8
+proc ArenaServers_Go 8 8
+ADDRLP4 0
+CNSTI4 140
+ADDRGP4 g_arenaservers+1160+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4456+136
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $182
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRGP4 $186
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 UI_SpecifyPasswordMenu
+CALLV
+pop
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRGP4 $186
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $185
+LABELV $182
+LABELV $177
+endproc ArenaServers_Go 8 8
+bss
+align 1
+LABELV $188
+skip 64
+code
+proc ArenaServers_UpdatePicture 4 16
+ADDRGP4 g_arenaservers+1160+68
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRGP4 g_arenaservers+1256+4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 0
+CNSTI4 140
+ADDRGP4 g_arenaservers+1160+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4456+136
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $188
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+1256+4
+ADDRGP4 $188
+ASGNP4
+LABELV $190
+ADDRGP4 g_arenaservers+1256+68
+CNSTI4 0
+ASGNI4
+LABELV $187
+endproc ArenaServers_UpdatePicture 4 16
+export Q_strcpyColor
+proc Q_strcpyColor 56 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $207
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $205
+LABELV $207
+CNSTI4 0
+RETI4
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $211
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $211
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $211
+ADDRLP4 28
+INDIRI4
+CNSTI4 56
+GTI4 $211
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $211
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $213
+ADDRLP4 8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $208
+LABELV $213
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 4
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $215
+ADDRLP4 8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $214
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $204
+endproc Q_strcpyColor 56 0
+proc ArenaServers_UpdateMenu 132 20
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+CNSTI4 0
+LEI4 $218
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRGP4 g_arenaservers+41332
+INDIRI4
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+GTI4 $221
+ADDRGP4 g_arenaservers+1608+60
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $228
+ARGP4
+ADDRGP4 g_arenaservers+41332
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 $233
+ASGNP4
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 176
+ARGI4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 $219
+JUMPV
+LABELV $221
+ADDRLP4 36
+ADDRGP4 g_arenaservers+616+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+808+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+968+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+1032+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1096+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+904+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+1160+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+1928+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_arenaservers+2192+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LTI4 $259
+ADDRLP4 76
+INDIRI4
+CNSTI4 7
+LEI4 $258
+LABELV $259
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $256
+LABELV $258
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $219
+JUMPV
+LABELV $256
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 $264
+ASGNP4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+CNSTI4 0
+EQI4 $265
+ADDRGP4 g_arenaservers+1608+60
+INDIRP4
+ARGP4
+ADDRGP4 $270
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 $233
+ASGNP4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+616+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+808+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+968+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+1032+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1096+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+904+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+1160+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+2192+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+CNSTI4 0
+GEI4 $291
+ADDRGP4 g_arenaservers+1608+60
+INDIRP4
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRGP4 g_arenaservers+1608+60
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $292
+ADDRLP4 36
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LTI4 $303
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+LEI4 $302
+LABELV $303
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $300
+LABELV $302
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 $264
+ASGNP4
+LABELV $301
+ADDRLP4 40
+ADDRGP4 g_arenaservers+616+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+808+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+968+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1032+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+1096+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+904+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+1160+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_arenaservers+1928+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 g_arenaservers+2192+44
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $266
+ADDRGP4 g_arenaservers+1160+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1160+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1160+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $219
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $334
+ADDRGP4 g_servertype
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $334
+ADDRGP4 g_servertype
+CNSTI4 1
+ASGNI4
+ADDRGP4 ArenaServers_StartRefreshNoClearList
+CALLV
+pop
+ADDRGP4 $217
+JUMPV
+LABELV $334
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+CNSTI4 0
+GTI4 $337
+ADDRGP4 $217
+JUMPV
+LABELV $337
+ADDRLP4 4
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $342
+ADDRLP4 12
+CNSTI4 140
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4456
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $347
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $347
+ADDRGP4 $343
+JUMPV
+LABELV $347
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $349
+ADDRGP4 g_onlyhumans
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $349
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $349
+ADDRGP4 $343
+JUMPV
+LABELV $349
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+NEI4 $351
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+NEI4 $351
+ADDRGP4 $343
+JUMPV
+LABELV $351
+ADDRLP4 56
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $353
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+GTI4 $353
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $392
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $392
+address $354
+address $356
+address $359
+address $362
+address $365
+address $368
+address $371
+address $374
+address $377
+address $380
+address $383
+address $386
+address $389
+code
+LABELV $356
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $359
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $362
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $365
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $368
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $371
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $374
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $377
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $380
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $383
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $386
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 11
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $389
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $354
+ADDRGP4 $343
+JUMPV
+LABELV $353
+LABELV $354
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_hideprivate
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $393
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $393
+ADDRGP4 $343
+JUMPV
+LABELV $393
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+GEI4 $395
+ADDRLP4 28
+ADDRGP4 $397
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 72
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $398
+ADDRLP4 28
+ADDRGP4 $397
+ASGNP4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $400
+ADDRLP4 28
+ADDRGP4 $402
+ASGNP4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 400
+GEI4 $403
+ADDRLP4 28
+ADDRGP4 $405
+ASGNP4
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 28
+ADDRGP4 $406
+ASGNP4
+LABELV $404
+LABELV $401
+LABELV $399
+LABELV $396
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI1 55
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRLP4 84
+ADDRGP4 Q_strcpyColor
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 92
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CNSTI1 55
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 100
+ADDRGP4 Q_strcpyColor
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 104
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRGP4 g_onlyhumans
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $408
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 6
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 116
+ADDRGP4 Q_strcpyColor
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 120
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 124
+ADDRGP4 Q_strcpyColor
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 $410
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $343
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+LABELV $345
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $342
+ADDRGP4 g_arenaservers+1160+68
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1160+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1160+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $217
+endproc ArenaServers_UpdateMenu 132 20
+proc ArenaServers_Remove 28 12
+ADDRGP4 g_arenaservers+1160+68
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRGP4 $417
+JUMPV
+LABELV $418
+ADDRLP4 8
+CNSTI4 140
+ADDRGP4 g_arenaservers+1160+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4456
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $428
+JUMPV
+LABELV $425
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $433
+ADDRLP4 20
+CNSTI4 6
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+41352+64
+ADDP4
+ARGP4
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+CNSTI4 64
+SUBI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $433
+ADDRLP4 16
+ADDRGP4 g_arenaservers+42376
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $427
+JUMPV
+LABELV $430
+LABELV $426
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $428
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+LTI4 $425
+LABELV $427
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $443
+CNSTI4 176
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $447
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $449
+ADDRLP4 16
+CNSTI4 176
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist+176
+ADDP4
+ARGP4
+CNSTU4 176
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $449
+ADDRLP4 12
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 176
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $447
+LABELV $444
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $446
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $443
+LABELV $445
+ADDRGP4 g_arenaservers+41320
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+41332
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+ASGNI4
+LABELV $417
+endproc ArenaServers_Remove 28 12
+proc ArenaServers_Insert 104 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $457
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 8
+EQI4 $457
+ADDRGP4 $456
+JUMPV
+LABELV $457
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ADDRGP4 g_arenaservers+41344
+INDIRI4
+LTI4 $459
+ADDRLP4 4
+CNSTI4 176
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ADDP4
+CNSTI4 -176
+ADDP4
+ASGNP4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 4
+CNSTI4 176
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $460
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 31
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStrWithColor
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 98
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $476
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $477
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $481
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $479
+JUMPV
+LABELV $483
+LABELV $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $479
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $476
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $485
+ARGP4
+ADDRLP4 84
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $486
+ARGP4
+ADDRLP4 88
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $487
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LEI4 $489
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+LABELV $489
+LABELV $488
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $491
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $492
+JUMPV
+LABELV $491
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamenames
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $492
+ADDRLP4 100
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+EQI4 $496
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $494
+LABELV $496
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $495
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $456
+endproc ArenaServers_Insert 104 12
+export ArenaServers_InsertFavorites
+proc ArenaServers_InsertFavorites 1040 12
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRGP4 $498
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $499
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $504
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+CNSTI4 176
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $508
+ADDRGP4 $506
+JUMPV
+LABELV $508
+LABELV $505
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $507
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $504
+LABELV $506
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $511
+ADDRLP4 1036
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+LABELV $511
+LABELV $500
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $502
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+LTI4 $499
+LABELV $497
+endproc ArenaServers_InsertFavorites 1040 12
+export ArenaServers_LoadFavorites
+proc ArenaServers_LoadFavorites 2916 12
+ADDRLP4 2892
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 2816
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 68
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2816
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2896
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_numfavoriteservers
+ADDRLP4 2896
+INDIRI4
+ASGNI4
+ADDRLP4 2888
+ADDRLP4 2896
+INDIRI4
+ASGNI4
+LABELV $515
+ADDRGP4 $519
+ARGP4
+ADDRLP4 2888
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2900
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2900
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $520
+ADDRGP4 $516
+JUMPV
+LABELV $520
+ADDRLP4 2904
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2904
+INDIRI4
+CNSTI4 48
+LTI4 $524
+ADDRLP4 2904
+INDIRI4
+CNSTI4 57
+LEI4 $522
+LABELV $524
+ADDRGP4 $516
+JUMPV
+LABELV $522
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $529
+JUMPV
+LABELV $526
+CNSTI4 176
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2908
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2908
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRGP4 $528
+JUMPV
+LABELV $530
+LABELV $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $529
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $526
+LABELV $528
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $532
+ADDRLP4 2912
+CNSTI4 176
+ASGNI4
+ADDRLP4 2912
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 2912
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 2912
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2892
+CNSTI4 1
+ASGNI4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+CNSTI4 176
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2912
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+CNSTI4 176
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist+136
+ADDP4
+ADDRLP4 2912
+INDIRI4
+ASGNI4
+LABELV $533
+ADDRLP4 2912
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 2912
+INDIRP4
+ADDRLP4 2912
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $516
+ADDRLP4 2888
+ADDRLP4 2888
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2888
+INDIRI4
+CNSTI4 16
+LTI4 $515
+ADDRGP4 g_arenaservers+42376
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRLP4 2892
+INDIRI4
+CNSTI4 0
+NEI4 $536
+ADDRGP4 g_numfavoriteservers
+CNSTI4 0
+ASGNI4
+LABELV $536
+LABELV $514
+endproc ArenaServers_LoadFavorites 2916 12
+proc ArenaServers_StopRefresh 0 16
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 $538
+JUMPV
+LABELV $539
+ADDRGP4 g_arenaservers+41336
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 8
+NEI4 $543
+ADDRGP4 ArenaServers_InsertFavorites
+CALLV
+pop
+LABELV $543
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+CNSTI4 0
+LTI4 $545
+ADDRGP4 g_arenaservers+41332
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+41320
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $545
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 176
+ARGI4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $538
+endproc ArenaServers_StopRefresh 0 16
+proc ArenaServers_DoRefresh 1120 16
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+41348
+INDIRI4
+GEI4 $555
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 8
+EQI4 $559
+ADDRLP4 1104
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 2
+EQI4 $563
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $561
+LABELV $563
+ADDRLP4 1108
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $564
+ADDRGP4 $554
+JUMPV
+LABELV $564
+LABELV $561
+ADDRLP4 1108
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+GEI4 $566
+ADDRGP4 $554
+JUMPV
+LABELV $566
+LABELV $559
+LABELV $555
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+41340
+INDIRI4
+GEI4 $568
+ADDRGP4 $554
+JUMPV
+LABELV $568
+ADDRGP4 g_arenaservers+41340
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $574
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_LAN_GetPing
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $578
+ADDRGP4 $575
+JUMPV
+LABELV $578
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $580
+ADDRLP4 4
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280
+ADDP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $584
+ADDRGP4 $582
+JUMPV
+LABELV $584
+LABELV $581
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $580
+LABELV $582
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $587
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $589
+ADDRLP4 72
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280+64
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GEI4 $594
+ADDRGP4 $575
+JUMPV
+LABELV $594
+LABELV $589
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $596
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $597
+JUMPV
+LABELV $596
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetPingInfo
+CALLV
+pop
+LABELV $597
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $587
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $575
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+LTI4 $574
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 8
+NEI4 $599
+ADDRGP4 g_arenaservers+41320
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 1108
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+41320
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $600
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $607
+JUMPV
+LABELV $604
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 32
+LTI4 $610
+ADDRGP4 $606
+JUMPV
+LABELV $610
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $612
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $616
+ADDRGP4 $614
+JUMPV
+LABELV $616
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $612
+LABELV $614
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $619
+ADDRGP4 $606
+JUMPV
+LABELV $619
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 8
+NEI4 $621
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_arenaservers+41332
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 1112
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+41332
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+LABELV $622
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280+64
+ADDP4
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 $630
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1116
+ADDRGP4 g_arenaservers+41332
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ADDRLP4 1116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $605
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $607
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+GEI4 $632
+ADDRGP4 g_arenaservers+41332
+INDIRI4
+ADDRGP4 g_arenaservers+41320
+INDIRI4
+LTI4 $604
+LABELV $632
+LABELV $606
+ADDRLP4 1108
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 2
+EQI4 $635
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $633
+LABELV $635
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+41348
+INDIRI4
+LEI4 $634
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $633
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $640
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $640
+LABELV $634
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $554
+endproc ArenaServers_DoRefresh 1120 16
+proc ArenaServers_StartRefresh 0 12
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ADDRGP4 g_arenaservers+41344
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+41320
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_StartRefreshNoClearList
+CALLV
+pop
+LABELV $642
+endproc ArenaServers_StartRefresh 0 12
+proc ArenaServers_StartRefreshNoClearList 100 16
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $648
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2280
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $649
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $648
+ADDRGP4 g_arenaservers+41336
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+41332
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+41340
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+41348
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+EQI4 $660
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $658
+LABELV $660
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $661
+ADDRGP4 g_arenaservers+41348
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $661
+CNSTI4 2
+ARGI4
+ADDRGP4 $665
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $658
+ADDRLP4 72
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 3
+LTI4 $669
+ADDRLP4 72
+INDIRI4
+CNSTI4 7
+LEI4 $668
+LABELV $669
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $666
+LABELV $668
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $671
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $672
+JUMPV
+LABELV $671
+ADDRLP4 80
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+LABELV $672
+ADDRLP4 76
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 g_arenaservers+712+64
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LTI4 $673
+ADDRLP4 84
+INDIRI4
+CNSTI4 12
+GTI4 $673
+ADDRLP4 84
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $696
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $696
+address $677
+address $678
+address $680
+address $682
+address $684
+address $673
+address $673
+address $673
+address $686
+address $688
+address $690
+address $692
+address $694
+code
+LABELV $673
+LABELV $677
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+ADDRGP4 $674
+JUMPV
+LABELV $678
+ADDRLP4 36
+ARGP4
+ADDRGP4 $679
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $680
+ADDRLP4 36
+ARGP4
+ADDRGP4 $681
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $682
+ADDRLP4 36
+ARGP4
+ADDRGP4 $683
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $684
+ADDRLP4 36
+ARGP4
+ADDRGP4 $685
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $686
+ADDRLP4 36
+ARGP4
+ADDRGP4 $687
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $688
+ADDRLP4 36
+ARGP4
+ADDRGP4 $689
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $690
+ADDRLP4 36
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $692
+ADDRLP4 36
+ARGP4
+ADDRGP4 $693
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $674
+JUMPV
+LABELV $694
+ADDRLP4 36
+ARGP4
+ADDRGP4 $695
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $674
+ADDRGP4 g_emptyservers
+INDIRI4
+CNSTI4 0
+EQI4 $697
+ADDRLP4 36
+ARGP4
+ADDRGP4 $699
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $697
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRLP4 36
+ARGP4
+ADDRGP4 $702
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $700
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $703
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $704
+ADDRGP4 $706
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRGP4 $708
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $707
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $705
+LABELV $666
+LABELV $647
+endproc ArenaServers_StartRefreshNoClearList 100 16
+export ArenaServers_SaveChanges
+proc ArenaServers_SaveChanges 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $713
+JUMPV
+LABELV $710
+ADDRGP4 $519
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+41352
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $711
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $713
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+42376
+INDIRI4
+LTI4 $710
+ADDRGP4 $719
+JUMPV
+LABELV $716
+ADDRGP4 $519
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $717
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $719
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $716
+LABELV $709
+endproc ArenaServers_SaveChanges 12 8
+export ArenaServers_Sort
+proc ArenaServers_Sort 0 16
+ADDRGP4 g_sortkey
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $721
+ADDRGP4 $720
+JUMPV
+LABELV $721
+ADDRGP4 g_sortkey
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+41328
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+41324
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 176
+ARGI4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $720
+endproc ArenaServers_Sort 0 16
+export ArenaServers_SetType
+proc ArenaServers_SetType 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $726
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $726
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 6
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $732
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $733
+ADDRGP4 $731
+JUMPV
+LABELV $733
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $730
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $729
+LABELV $731
+LABELV $726
+ADDRGP4 g_servertype
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $735
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $735
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $755
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $755
+address $743
+address $743
+address $737
+address $743
+address $743
+address $743
+address $743
+address $743
+address $749
+code
+LABELV $737
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1752+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+41328
+ADDRGP4 g_localserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+41324
+ADDRGP4 g_numlocalservers
+ASGNP4
+ADDRGP4 g_arenaservers+41344
+CNSTI4 124
+ASGNI4
+ADDRGP4 $736
+JUMPV
+LABELV $743
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1752+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+41328
+ADDRGP4 g_globalserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+41324
+ADDRGP4 g_numglobalservers
+ASGNP4
+ADDRGP4 g_arenaservers+41344
+CNSTI4 256
+ASGNI4
+ADDRGP4 $736
+JUMPV
+LABELV $749
+ADDRLP4 16
+ADDRGP4 g_arenaservers+1752+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+41328
+ADDRGP4 g_favoriteserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+41324
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRGP4 g_arenaservers+41344
+CNSTI4 16
+ASGNI4
+LABELV $735
+LABELV $736
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $725
+endproc ArenaServers_SetType 20 16
+proc ArenaServers_Event 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $757
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $757
+ADDRGP4 $756
+JUMPV
+LABELV $757
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $759
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+GTI4 $759
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $826-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $826
+address $761
+address $775
+address $781
+address $787
+address $793
+address $808
+address $811
+address $813
+address $815
+address $816
+address $822
+address $823
+address $824
+address $825
+address $799
+address $805
+code
+LABELV $761
+ADDRGP4 g_arenaservers+616+64
+INDIRI4
+CNSTI4 1
+NEI4 $762
+ADDRGP4 g_arenaservers+616+64
+CNSTI4 2
+ASGNI4
+LABELV $762
+ADDRGP4 g_arenaservers+616+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+616+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $772
+ARGP4
+ADDRGP4 g_arenaservers+616+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $775
+ADDRGP4 $776
+ARGP4
+ADDRGP4 g_arenaservers+712+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_gametype
+ADDRGP4 g_arenaservers+712+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $781
+ADDRGP4 $782
+ARGP4
+ADDRGP4 g_arenaservers+808+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_arenaservers+808+64
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Sort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $787
+ADDRGP4 $788
+ARGP4
+ADDRGP4 g_arenaservers+904+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_fullservers
+ADDRGP4 g_arenaservers+904+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $793
+ADDRGP4 $794
+ARGP4
+ADDRGP4 g_arenaservers+968+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_emptyservers
+ADDRGP4 g_arenaservers+968+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $799
+ADDRGP4 $800
+ARGP4
+ADDRGP4 g_arenaservers+1032+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_onlyhumans
+ADDRGP4 g_arenaservers+1032+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $805
+ADDRGP4 g_hideprivate
+ADDRGP4 g_arenaservers+1096+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $808
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $760
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $811
+ADDRGP4 g_arenaservers+1160
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $813
+ADDRGP4 g_arenaservers+1160
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $815
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $816
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $817
+ADDRGP4 g_servertype
+CNSTI4 0
+ASGNI4
+LABELV $817
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $819
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $822
+ADDRGP4 UI_SpecifyServerMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $823
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $824
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $825
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $759
+LABELV $760
+LABELV $756
+endproc ArenaServers_Event 12 8
+proc ArenaServers_MenuDraw 0 4
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+CNSTI4 0
+EQI4 $829
+ADDRGP4 ArenaServers_DoRefresh
+CALLV
+pop
+LABELV $829
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $828
+endproc ArenaServers_MenuDraw 0 4
+proc ArenaServers_MenuKey 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $833
+ADDRGP4 g_arenaservers+41336
+INDIRI4
+CNSTI4 0
+EQI4 $833
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $832
+JUMPV
+LABELV $833
+ADDRFP4 0
+INDIRI4
+CNSTI4 140
+EQI4 $839
+ADDRFP4 0
+INDIRI4
+CNSTI4 171
+NEI4 $836
+LABELV $839
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 8
+NEI4 $836
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRGP4 g_arenaservers+1160
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $836
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $832
+JUMPV
+LABELV $836
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $842
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $840
+LABELV $842
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+LABELV $840
+ADDRFP4 0
+INDIRI4
+CNSTI4 184
+NEI4 $843
+ADDRGP4 g_arenaservers+1160
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+LABELV $843
+ADDRFP4 0
+INDIRI4
+CNSTI4 183
+NEI4 $846
+ADDRGP4 g_arenaservers+1160
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+LABELV $846
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $832
+endproc ArenaServers_MenuKey 16 8
+bss
+align 1
+LABELV $850
+skip 64
+code
+proc ArenaServers_MenuInit 40 16
+ADDRGP4 g_arenaservers
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 42380
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 g_arenaservers+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+524
+ADDRGP4 ArenaServers_MenuDraw
+ASGNP4
+ADDRGP4 g_arenaservers+528
+ADDRGP4 ArenaServers_MenuKey
+ASGNP4
+ADDRGP4 g_arenaservers+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+544+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 g_arenaservers+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+544+60
+ADDRGP4 $864
+ASGNP4
+ADDRGP4 g_arenaservers+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRLP4 4
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+616
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+616+4
+ADDRGP4 $872
+ASGNP4
+ADDRGP4 g_arenaservers+616+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+616+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+616+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+616+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+616+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+616+76
+ADDRGP4 master_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+712
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+712+4
+ADDRGP4 $888
+ASGNP4
+ADDRGP4 g_arenaservers+712+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+712+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+712+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+712+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+712+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+712+76
+ADDRGP4 servertype_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+808
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+808+4
+ADDRGP4 $904
+ASGNP4
+ADDRGP4 g_arenaservers+808+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+808+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+808+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+808+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+808+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+808+76
+ADDRGP4 sortkey_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+904
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+904+4
+ADDRGP4 $920
+ASGNP4
+ADDRGP4 g_arenaservers+904+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+904+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+904+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 g_arenaservers+904+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+904+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+968
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+968+4
+ADDRGP4 $934
+ASGNP4
+ADDRGP4 g_arenaservers+968+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+968+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+968+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 g_arenaservers+968+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+968+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1032
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+1032+4
+ADDRGP4 $948
+ASGNP4
+ADDRGP4 g_arenaservers+1032+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+1032+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1032+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 g_arenaservers+1032+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1032+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1096
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+1096+4
+ADDRGP4 $962
+ASGNP4
+ADDRGP4 g_arenaservers+1096+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+1096+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1096+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 g_arenaservers+1096+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1096+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1160
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+1160+44
+CNSTU4 128
+ASGNU4
+ADDRGP4 g_arenaservers+1160+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 g_arenaservers+1160+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1160+12
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers+1160+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1160+80
+CNSTI4 70
+ASGNI4
+ADDRGP4 g_arenaservers+1160+84
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+1160+76
+ADDRGP4 g_arenaservers+40296
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $991
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaservers+40296
+ADDP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4456
+ADDP4
+ASGNP4
+LABELV $992
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $991
+ADDRGP4 g_arenaservers+1256
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1256+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+1256+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+1256+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+1256+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1256+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1256+64
+ADDRGP4 $1010
+ASGNP4
+ADDRGP4 g_arenaservers+1344
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1344+4
+ADDRGP4 $1014
+ASGNP4
+ADDRGP4 g_arenaservers+1344+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+1344+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1344+12
+CNSTI4 572
+ASGNI4
+ADDRGP4 g_arenaservers+1344+16
+CNSTI4 224
+ASGNI4
+ADDRGP4 g_arenaservers+1344+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1344+80
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1432
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1432+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1432+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1432+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1432+12
+CNSTI4 572
+ASGNI4
+ADDRGP4 g_arenaservers+1432+16
+CNSTI4 224
+ASGNI4
+ADDRGP4 g_arenaservers+1432+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1432+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1432+60
+ADDRGP4 $1044
+ASGNP4
+ADDRGP4 g_arenaservers+1520
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1520+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1520+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1520+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1520+12
+CNSTI4 572
+ASGNI4
+ADDRGP4 g_arenaservers+1520+16
+CNSTI4 288
+ASGNI4
+ADDRGP4 g_arenaservers+1520+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1520+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1520+60
+ADDRGP4 $1062
+ASGNP4
+ADDRLP4 4
+CNSTI4 376
+ASGNI4
+ADDRGP4 g_arenaservers+1608
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1608+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1608+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1608+60
+ADDRGP4 $850
+ASGNP4
+ADDRGP4 g_arenaservers+1608+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1608+68
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1680
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1680+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1680+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1680+60
+ADDRGP4 $264
+ASGNP4
+ADDRGP4 g_arenaservers+1680+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1680+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 g_arenaservers+1752
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1752+4
+ADDRGP4 $1088
+ASGNP4
+ADDRGP4 g_arenaservers+1752+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1752+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1752+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 g_arenaservers+1752+12
+CNSTI4 450
+ASGNI4
+ADDRGP4 g_arenaservers+1752+16
+CNSTI4 86
+ASGNI4
+ADDRGP4 g_arenaservers+1752+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1752+80
+CNSTI4 48
+ASGNI4
+ADDRGP4 g_arenaservers+1752+60
+ADDRGP4 $1105
+ASGNP4
+ADDRGP4 g_arenaservers+1840
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1840+4
+ADDRGP4 $1109
+ASGNP4
+ADDRGP4 g_arenaservers+1840+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1840+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1840+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 g_arenaservers+1840+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1840+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1840+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1840+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1840+60
+ADDRGP4 $1126
+ASGNP4
+ADDRGP4 g_arenaservers+2016
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+2016+4
+ADDRGP4 $1130
+ASGNP4
+ADDRGP4 g_arenaservers+2016+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+2016+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+2016+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+2016+12
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+2016+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+2016+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+2016+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+2016+60
+ADDRGP4 $1147
+ASGNP4
+ADDRGP4 g_arenaservers+1928
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1928+4
+ADDRGP4 $1151
+ASGNP4
+ADDRGP4 g_arenaservers+1928+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1928+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1928+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 g_arenaservers+1928+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1928+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1928+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1928+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1928+60
+ADDRGP4 $1168
+ASGNP4
+ADDRGP4 g_arenaservers+2104
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+2104+4
+ADDRGP4 $1172
+ASGNP4
+ADDRGP4 g_arenaservers+2104+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+2104+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+2104+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 g_arenaservers+2104+12
+CNSTI4 384
+ASGNI4
+ADDRGP4 g_arenaservers+2104+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+2104+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+2104+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+2104+60
+ADDRGP4 $1189
+ASGNP4
+ADDRGP4 g_arenaservers+2192
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+2192+4
+ADDRGP4 $1193
+ASGNP4
+ADDRGP4 g_arenaservers+2192+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 g_arenaservers+2192+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+2192+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers+2192+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 g_arenaservers+2192+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+2192+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+2192+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+2192+60
+ADDRGP4 $1210
+ASGNP4
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+712
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+808
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+904
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1032
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1096
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1256
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1160
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1344
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1432
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1520
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1840
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+2016
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1928
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+2104
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+2192
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 ui_browserMaster+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_servertype
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+NEI4 $1233
+ADDRGP4 g_servertype
+CNSTI4 0
+ASGNI4
+LABELV $1233
+ADDRGP4 g_arenaservers+616+64
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 ui_browserGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_gametype
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+712+64
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRGP4 ui_browserSortKey+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_sortkey
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+808+64
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_fullservers
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+904+60
+ADDRGP4 g_fullservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_emptyservers
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+968+60
+ADDRGP4 g_emptyservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserOnlyHumans+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+1032+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_onlyhumans
+ADDRGP4 ui_browserOnlyHumans+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1096+60
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_hideprivate
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 g_servertype
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+616+64
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRGP4 $264
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $849
+endproc ArenaServers_MenuInit 40 16
+export ArenaServers_Cache
+proc ArenaServers_Cache 0 4
+ADDRGP4 $1109
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1126
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1172
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1189
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1130
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1147
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1151
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1168
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1193
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1210
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1014
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1044
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1062
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1010
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1257
+endproc ArenaServers_Cache 0 4
+export UI_ArenaServersMenu
+proc UI_ArenaServersMenu 0 4
+ADDRGP4 ArenaServers_MenuInit
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1258
+endproc UI_ArenaServersMenu 0 4
+bss
+align 4
+LABELV g_hideprivate
+skip 4
+align 4
+LABELV g_onlyhumans
+skip 4
+align 4
+LABELV g_fullservers
+skip 4
+align 4
+LABELV g_emptyservers
+skip 4
+align 4
+LABELV g_sortkey
+skip 4
+align 4
+LABELV g_gametype
+skip 4
+align 4
+LABELV g_servertype
+skip 4
+align 4
+LABELV g_numfavoriteservers
+skip 4
+align 4
+LABELV g_favoriteserverlist
+skip 2816
+align 4
+LABELV g_numlocalservers
+skip 4
+align 4
+LABELV g_localserverlist
+skip 21824
+align 4
+LABELV g_numglobalservers
+skip 4
+align 4
+LABELV g_globalserverlist
+skip 45056
+align 4
+LABELV g_arenaservers
+skip 42380
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1210
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1193
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1189
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1172
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1168
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1151
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1147
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1130
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1126
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1105
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1088
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1062
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $1044
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $1014
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1010
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $962
+byte 1 72
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $948
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $934
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $920
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $904
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $888
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $872
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $864
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $800
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $794
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $788
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $782
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $776
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $772
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $732
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $728
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $708
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $707
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $706
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $703
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $702
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $699
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $695
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $693
+byte 1 32
+byte 1 100
+byte 1 100
+byte 1 0
+align 1
+LABELV $691
+byte 1 32
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $689
+byte 1 32
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $687
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $685
+byte 1 32
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $683
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $681
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $679
+byte 1 32
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $665
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $630
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $519
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $498
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $486
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $485
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $476
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $475
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $474
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $473
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $472
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $471
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $470
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $469
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $468
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $410
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $409
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 0
+align 1
+LABELV $406
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $405
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $402
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $397
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $299
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $296
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $270
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $264
+byte 1 0
+align 1
+LABELV $233
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $228
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $199
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $186
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $120
+byte 1 73
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $119
+byte 1 73
+byte 1 80
+byte 1 52
+byte 1 0
+align 1
+LABELV $118
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $117
+byte 1 79
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $116
+byte 1 85
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $115
+byte 1 81
+byte 1 51
+byte 1 70
+byte 1 0
+align 1
+LABELV $114
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $113
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $112
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $111
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $110
+byte 1 83
+byte 1 80
+byte 1 32
+byte 1 0
+align 1
+LABELV $109
+byte 1 49
+byte 1 118
+byte 1 49
+byte 1 0
+align 1
+LABELV $108
+byte 1 68
+byte 1 77
+byte 1 32
+byte 1 0
+align 1
+LABELV $107
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $106
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $104
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $103
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $100
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $99
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $97
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $96
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $95
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $94
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $93
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $92
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $91
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $90
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $89
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $88
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $87
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $86
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 40
+byte 1 53
+byte 1 41
+byte 1 0
+align 1
+LABELV $85
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 40
+byte 1 52
+byte 1 41
+byte 1 0
+align 1
+LABELV $84
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 40
+byte 1 51
+byte 1 41
+byte 1 0
+align 1
+LABELV $83
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 40
+byte 1 50
+byte 1 41
+byte 1 0
+align 1
+LABELV $82
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $81
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $80
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 43
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
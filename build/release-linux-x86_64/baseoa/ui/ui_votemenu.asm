@@ -0,0 +1,2373 @@
+data
+align 4
+LABELV votemenu_artlist
+address $80
+address $81
+address $82
+address $83
+byte 4 0
+code
+proc VoteMenu_CheckVoteNames 8 4
+ADDRGP4 $86
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_votemenu+792
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+796
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+812
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+816
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+808
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+800
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+824
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+820
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+828
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+ASGNI4
+ADDRGP4 s_votemenu+832
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+ASGNI4
+LABELV $85
+endproc VoteMenu_CheckVoteNames 8 4
+proc VoteMenu_Event 8 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $98
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 113
+GTI4 $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $128-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $128
+address $103
+address $100
+address $106
+address $108
+address $110
+address $123
+address $122
+address $118
+address $120
+address $121
+address $119
+address $116
+address $124
+address $126
+code
+LABELV $103
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $104
+ADDRGP4 $97
+JUMPV
+LABELV $104
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $106
+CNSTI4 2
+ARGI4
+ADDRGP4 $107
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $108
+CNSTI4 2
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $110
+ADDRGP4 s_votemenu+804
+INDIRI4
+CNSTI4 0
+EQI4 $111
+CNSTI4 2
+ARGI4
+ADDRGP4 $114
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $111
+CNSTI4 2
+ARGI4
+ADDRGP4 $115
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $112
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $116
+CNSTI4 2
+ARGI4
+ADDRGP4 $117
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $118
+ADDRGP4 UI_VoteFraglimitMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $119
+ADDRGP4 UI_VoteCustomMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $120
+ADDRGP4 UI_VoteTimelimitMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $121
+ADDRGP4 UI_VoteGametypeMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $122
+ADDRGP4 UI_VoteKickMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $123
+ADDRGP4 UI_VoteMapMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $124
+CNSTI4 2
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $126
+CNSTI4 2
+ARGI4
+ADDRGP4 $127
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $100
+LABELV $101
+LABELV $97
+endproc VoteMenu_Event 8 8
+proc VoteMenu_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $131
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 votemenu_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $135
+ADDRGP4 $133
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 votemenu_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $132
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $131
+JUMPV
+LABELV $133
+ADDRGP4 VoteMenu_CheckVoteNames
+CALLV
+pop
+LABELV $130
+endproc VoteMenu_Cache 4 4
+proc UI_VoteMenu_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 $138
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 color_white
+ARGP4
+ADDRGP4 UI_DrawBannerString
+CALLV
+pop
+CNSTF4 1118699520
+ARGF4
+CNSTF4 1116995584
+ARGF4
+CNSTF4 1139343360
+ARGF4
+CNSTF4 1134952448
+ARGF4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 UI_DrawNamedPic
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $137
+endproc UI_VoteMenu_Draw 0 20
+export UI_VoteMenuMenuInternal
+proc UI_VoteMenuMenuInternal 40 0
+ADDRGP4 VoteMenu_Cache
+CALLV
+pop
+ADDRGP4 s_votemenu+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu+536
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_votemenu+524
+ADDRGP4 UI_VoteMenu_Draw
+ASGNP4
+ADDRGP4 s_votemenu+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_votemenu+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_votemenu+544+60
+ADDRGP4 $138
+ASGNP4
+ADDRGP4 s_votemenu+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_votemenu+544+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 98
+ASGNI4
+ADDRGP4 s_votemenu+908
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+908+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+908+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+796
+INDIRI4
+CNSTI4 0
+NEI4 $160
+ADDRLP4 4
+ADDRGP4 s_votemenu+908+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 102
+NEI4 $165
+ADDRGP4 s_votemenu+908+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $165
+LABELV $161
+ADDRGP4 s_votemenu+908+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+908+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+908+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_votemenu+908+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+908+60
+ADDRGP4 $180
+ASGNP4
+ADDRGP4 s_votemenu+908+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+836
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+836+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+836+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+792
+INDIRI4
+CNSTI4 0
+NEI4 $188
+ADDRLP4 4
+ADDRGP4 s_votemenu+836+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 103
+NEI4 $193
+ADDRGP4 s_votemenu+836+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $193
+LABELV $189
+ADDRGP4 s_votemenu+836+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+836+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+836+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_votemenu+836+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+836+60
+ADDRGP4 $208
+ASGNP4
+ADDRGP4 s_votemenu+836+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1412
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1412+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1412+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+792
+INDIRI4
+CNSTI4 0
+NEI4 $216
+ADDRLP4 8
+ADDRGP4 s_votemenu+1412+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 111
+NEI4 $221
+ADDRGP4 s_votemenu+1412+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $221
+LABELV $217
+ADDRGP4 s_votemenu+1412+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1412+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1412+8
+CNSTI4 111
+ASGNI4
+ADDRGP4 s_votemenu+1412+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1412+60
+ADDRGP4 $236
+ASGNP4
+ADDRGP4 s_votemenu+1412+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1124
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1124+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1124+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+812
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRLP4 12
+ADDRGP4 s_votemenu+1124+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 105
+NEI4 $249
+ADDRGP4 s_votemenu+1124+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $249
+LABELV $245
+ADDRGP4 s_votemenu+1124+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1124+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1124+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_votemenu+1124+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1124+60
+ADDRGP4 $264
+ASGNP4
+ADDRGP4 s_votemenu+1124+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1196
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1196+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1196+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+816
+INDIRI4
+CNSTI4 0
+NEI4 $272
+ADDRLP4 16
+ADDRGP4 s_votemenu+1196+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 109
+NEI4 $277
+ADDRGP4 s_votemenu+1196+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $277
+LABELV $273
+ADDRGP4 s_votemenu+1196+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1196+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1196+8
+CNSTI4 109
+ASGNI4
+ADDRGP4 s_votemenu+1196+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1196+60
+ADDRGP4 $292
+ASGNP4
+ADDRGP4 s_votemenu+1196+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1052
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1052+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1052+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+808
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRLP4 20
+ADDRGP4 s_votemenu+1052+44
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 106
+NEI4 $305
+ADDRGP4 s_votemenu+1052+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $305
+LABELV $301
+ADDRGP4 s_votemenu+1052+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1052+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1052+8
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_votemenu+1052+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1052+60
+ADDRGP4 $320
+ASGNP4
+ADDRGP4 s_votemenu+1052+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+980
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+980+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+980+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+800
+INDIRI4
+CNSTI4 0
+NEI4 $328
+ADDRLP4 24
+ADDRGP4 s_votemenu+980+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 104
+NEI4 $333
+ADDRGP4 s_votemenu+980+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $333
+LABELV $329
+ADDRGP4 s_votemenu+980+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+980+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+980+8
+CNSTI4 104
+ASGNI4
+ADDRGP4 s_votemenu+980+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+804
+INDIRI4
+CNSTI4 0
+EQI4 $346
+ADDRGP4 s_votemenu+980+60
+ADDRGP4 $351
+ASGNP4
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRGP4 s_votemenu+980+60
+ADDRGP4 $354
+ASGNP4
+LABELV $347
+ADDRGP4 s_votemenu+980+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1340
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1340+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1340+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+820
+INDIRI4
+CNSTI4 0
+NEI4 $362
+ADDRLP4 28
+ADDRGP4 s_votemenu+1340+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 107
+NEI4 $367
+ADDRGP4 s_votemenu+1340+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $367
+LABELV $363
+ADDRGP4 s_votemenu+1340+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1340+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1340+8
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_votemenu+1340+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1340+60
+ADDRGP4 $382
+ASGNP4
+ADDRGP4 s_votemenu+1340+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1268
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1268+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1268+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+824
+INDIRI4
+CNSTI4 0
+NEI4 $390
+ADDRLP4 32
+ADDRGP4 s_votemenu+1268+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 108
+NEI4 $395
+ADDRGP4 s_votemenu+1268+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $395
+LABELV $391
+ADDRGP4 s_votemenu+1268+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1268+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1268+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_votemenu+1268+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1268+60
+ADDRGP4 $410
+ASGNP4
+ADDRGP4 s_votemenu+1268+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1484
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1484+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1484+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+828
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRLP4 36
+ADDRGP4 s_votemenu+1484+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 110
+NEI4 $423
+ADDRGP4 s_votemenu+1484+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $423
+LABELV $419
+ADDRGP4 s_votemenu+1484+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1484+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1484+8
+CNSTI4 110
+ASGNI4
+ADDRGP4 s_votemenu+1484+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1484+60
+ADDRGP4 $438
+ASGNP4
+ADDRGP4 s_votemenu+1484+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1556
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1556+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1556+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 112
+NEI4 $446
+ADDRGP4 s_votemenu+1556+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $446
+ADDRGP4 s_votemenu+1556+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1556+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1556+8
+CNSTI4 112
+ASGNI4
+ADDRGP4 s_votemenu+1556+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1556+60
+ADDRGP4 $461
+ASGNP4
+ADDRGP4 s_votemenu+1556+64
+CNSTI4 17
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu+1628
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_votemenu+1628+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_votemenu+1628+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_votemenu+1700
+INDIRI4
+CNSTI4 113
+NEI4 $469
+ADDRGP4 s_votemenu+1628+68
+ADDRGP4 color_orange
+ASGNP4
+LABELV $469
+ADDRGP4 s_votemenu+1628+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+1628+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu+1628+8
+CNSTI4 113
+ASGNI4
+ADDRGP4 s_votemenu+1628+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+1628+60
+ADDRGP4 $484
+ASGNP4
+ADDRGP4 s_votemenu+1628+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_votemenu+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_votemenu+616+4
+ADDRGP4 $80
+ASGNP4
+ADDRGP4 s_votemenu+616+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_votemenu+616+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+616+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_votemenu+616+12
+CNSTI4 192
+ASGNI4
+ADDRGP4 s_votemenu+616+16
+CNSTI4 364
+ASGNI4
+ADDRGP4 s_votemenu+616+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_votemenu+616+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_votemenu+616+60
+ADDRGP4 $81
+ASGNP4
+ADDRGP4 s_votemenu+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_votemenu+704+4
+ADDRGP4 $82
+ASGNP4
+ADDRGP4 s_votemenu+704+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_votemenu+704+48
+ADDRGP4 VoteMenu_Event
+ASGNP4
+ADDRGP4 s_votemenu+704+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_votemenu+704+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu+704+16
+CNSTI4 364
+ASGNI4
+ADDRGP4 s_votemenu+704+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_votemenu+704+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_votemenu+704+60
+ADDRGP4 $83
+ASGNP4
+LABELV $140
+endproc UI_VoteMenuMenuInternal 40 0
+export UI_VoteMenuMenu
+proc UI_VoteMenuMenu 1032 12
+ADDRGP4 s_votemenu
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1704
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 s_votemenu+804
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRGP4 UI_VoteMenuMenuInternal
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+908
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+836
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1412
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1124
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1196
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1052
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+980
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1340
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1268
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1484
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1556
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 s_votemenu+1628
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $525
+endproc UI_VoteMenuMenu 1032 12
+bss
+align 4
+LABELV s_votemenu
+skip 1704
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $527
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $484
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $461
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $438
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $410
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $382
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $354
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $351
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $320
+byte 1 75
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $292
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $264
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $236
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $208
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $180
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $139
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $138
+byte 1 67
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 0
+align 1
+LABELV $127
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $125
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $117
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $109
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $86
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $83
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $82
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $81
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
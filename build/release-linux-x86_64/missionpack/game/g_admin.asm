@@ -0,0 +1,32396 @@
+data
+export g_admin_cmds
+align 4
+LABELV g_admin_cmds
+address $61
+address G_admin_adjustban
+address $62
+address $63
+address $64
+address $65
+address G_admin_admintest
+address $66
+address $67
+address $68
+address $69
+address G_admin_allready
+address $70
+address $71
+address $68
+address $72
+address G_admin_ban
+address $62
+address $73
+address $74
+address $75
+address G_admin_cancelvote
+address $76
+address $77
+address $68
+address $78
+address G_admin_disorient
+address $79
+address $80
+address $81
+address $82
+address G_admin_help
+address $83
+address $84
+address $85
+address $86
+address G_admin_kick
+address $87
+address $88
+address $89
+address $90
+address G_admin_listadmins
+address $91
+address $92
+address $93
+address $94
+address G_admin_listplayers
+address $95
+address $96
+address $68
+address $97
+address G_admin_lock
+address $98
+address $99
+address $100
+address $101
+address G_admin_map
+address $102
+address $103
+address $104
+address $105
+address G_admin_mute
+address $106
+address $107
+address $108
+address $109
+address G_admin_namelog
+address $110
+address $111
+address $112
+address $113
+address G_admin_nextmap
+address $114
+address $115
+address $68
+address $116
+address G_admin_orient
+address $79
+address $117
+address $108
+address $118
+address G_admin_passvote
+address $119
+address $120
+address $68
+address $121
+address G_admin_putteam
+address $122
+address $123
+address $124
+address $125
+address G_admin_readconfig
+address $126
+address $127
+address $68
+address $128
+address G_admin_rename
+address $129
+address $130
+address $131
+address $132
+address G_admin_restart
+address $133
+address $134
+address $68
+address $135
+address G_admin_setlevel
+address $136
+address $137
+address $138
+address $139
+address G_admin_showbans
+address $140
+address $141
+address $142
+address $143
+address G_admin_shuffle
+address $144
+address $145
+skip 4
+address $146
+address G_admin_slap
+address $147
+address $148
+address $149
+address $150
+address G_admin_spec999
+address $151
+address $152
+address $68
+address $153
+address G_admin_time
+address $154
+address $155
+address $68
+address $156
+address G_admin_unban
+address $62
+address $157
+address $158
+address $159
+address G_admin_unlock
+address $98
+address $160
+address $100
+address $161
+address G_admin_mute
+address $106
+address $162
+address $108
+address $163
+address G_admin_warn
+address $164
+address $165
+address $166
+align 4
+LABELV adminNumCmds
+byte 4 31
+align 4
+LABELV admin_level_maxname
+byte 4 0
+export G_admin_permission
+code
+proc G_admin_permission 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $168
+CNSTI4 1
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $168
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $174
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $179
+CNSTI4 1
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $181
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $186
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $188
+ADDRGP4 $182
+JUMPV
+LABELV $188
+LABELV $184
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $183
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $190
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $195
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $195
+LABELV $193
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $192
+ADDRLP4 24
+ADDRFP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+EQI4 $198
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+EQI4 $198
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $190
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $177
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $176
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $174
+LABELV $171
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $173
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+GEI4 $200
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $170
+LABELV $200
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $205
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $210
+CNSTI4 1
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $210
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $212
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $217
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $217
+LABELV $215
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $214
+ADDRLP4 24
+ADDRFP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+EQI4 $220
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+EQI4 $220
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $221
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $212
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $207
+LABELV $205
+LABELV $202
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+GEI4 $222
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $201
+LABELV $222
+CNSTI4 0
+RETI4
+LABELV $167
+endproc G_admin_permission 28 8
+lit
+align 1
+LABELV $224
+byte 1 0
+skip 31
+align 1
+LABELV $225
+byte 1 0
+skip 31
+export G_admin_name_check
+code
+proc G_admin_name_check 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $224
+INDIRB
+ASGNB 32
+ADDRLP4 40
+ADDRGP4 $225
+INDIRB
+ASGNB 32
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRGP4 $228
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $226
+CNSTI4 1
+RETI4
+ADDRGP4 $223
+JUMPV
+LABELV $226
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $229
+ADDRLP4 36
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRGP4 $230
+JUMPV
+LABELV $234
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+NEI4 $236
+ADDRGP4 $230
+JUMPV
+LABELV $236
+ADDRLP4 36
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $238
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $240
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $223
+JUMPV
+LABELV $238
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $232
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $229
+ADDRGP4 g_adminNameProtect+12
+INDIRI4
+CNSTI4 0
+NEI4 $241
+CNSTI4 1
+RETI4
+ADDRGP4 $223
+JUMPV
+LABELV $241
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $248
+ADDRGP4 $245
+JUMPV
+LABELV $248
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $250
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $252
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $223
+JUMPV
+LABELV $250
+LABELV $245
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $247
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $253
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $244
+LABELV $253
+CNSTI4 1
+RETI4
+LABELV $223
+endproc G_admin_name_check 84 16
+proc admin_higher_guid 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $259
+LABELV $256
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $261
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $255
+LABELV $261
+LABELV $257
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $262
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+GEI4 $268
+CNSTI4 0
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $268
+ADDRGP4 $270
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $272
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $273
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $266
+LABELV $263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $265
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $262
+LABELV $274
+CNSTI4 1
+RETI4
+LABELV $254
+endproc admin_higher_guid 28 8
+proc admin_higher 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $276
+CNSTI4 1
+RETI4
+ADDRGP4 $275
+JUMPV
+LABELV $276
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $278
+CNSTI4 1
+RETI4
+ADDRGP4 $275
+JUMPV
+LABELV $278
+ADDRLP4 0
+CNSTI4 516
+ASGNI4
+ADDRLP4 4
+CNSTI4 912
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 admin_higher_guid
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $275
+endproc admin_higher 12 8
+lit
+align 1
+LABELV $281
+byte 1 0
+skip 1023
+code
+proc admin_writeconfig 1072 12
+ADDRLP4 12
+ADDRGP4 $281
+INDIRB
+ASGNB 1024
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $282
+ADDRGP4 $285
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $282
+CNSTP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+GEI4 $287
+ADDRGP4 $289
+ARGP4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $287
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $294
+JUMPV
+LABELV $291
+ADDRGP4 $295
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $296
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $299
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $292
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $291
+LABELV $300
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $304
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $305
+ADDRGP4 $302
+JUMPV
+LABELV $305
+ADDRGP4 $307
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $308
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $296
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $299
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $302
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $304
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $309
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $301
+LABELV $309
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $310
+ADDRLP4 1060
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $314
+ADDRGP4 $311
+JUMPV
+LABELV $314
+ADDRGP4 $316
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $308
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $317
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $318
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $319
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 155
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $320
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $321
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $299
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $311
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $322
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $310
+LABELV $322
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $323
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRGP4 $327
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $328
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $329
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $330
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $331
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $332
+ADDRGP4 $336
+ARGP4
+ADDRLP4 1064
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $333
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $335
+ADDRLP4 1064
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $332
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $299
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $324
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $326
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $337
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $323
+LABELV $337
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $341
+JUMPV
+LABELV $338
+ADDRLP4 1068
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 1068
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $342
+ADDRGP4 $339
+JUMPV
+LABELV $342
+ADDRGP4 $344
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $308
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $317
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $345
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $319
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1129
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $320
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $346
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $299
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $339
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $341
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $347
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $338
+LABELV $347
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $280
+endproc admin_writeconfig 1072 12
+proc admin_default_levels 16 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $350
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $352
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $353
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $349
+LABELV $353
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $354
+CNSTU4 100
+ARGU4
+ADDRLP4 12
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $354
+ADDRGP4 g_admin_levels
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $359
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $361
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $363
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+8
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+12
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $369
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+12
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+16
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $373
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+16
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $375
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+20
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $377
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+20
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $379
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 admin_level_maxname
+CNSTI4 15
+ASGNI4
+LABELV $348
+endproc admin_default_levels 16 12
+export G_admin_level
+proc G_admin_level 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $381
+CNSTI4 32
+RETI4
+ADDRGP4 $380
+JUMPV
+LABELV $381
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $383
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $380
+JUMPV
+LABELV $387
+LABELV $384
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $386
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $389
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $383
+LABELV $389
+CNSTI4 0
+RETI4
+LABELV $380
+endproc G_admin_level 8 8
+proc admin_command_permission 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $391
+CNSTI4 1
+RETI4
+ADDRGP4 $390
+JUMPV
+LABELV $391
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $393
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $397
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $402
+JUMPV
+LABELV $399
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $403
+CNSTI4 1
+RETI4
+ADDRGP4 $390
+JUMPV
+LABELV $403
+LABELV $400
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $402
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $399
+LABELV $397
+LABELV $394
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $396
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $405
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $393
+LABELV $405
+CNSTI4 0
+RETI4
+LABELV $390
+endproc admin_command_permission 20 8
+proc admin_log 1528 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1172
+CNSTP4 0
+ASGNP4
+ADDRGP4 g_adminLog+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $406
+JUMPV
+LABELV $407
+ADDRGP4 g_adminLog+16
+ARGP4
+ADDRLP4 1176
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1480
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1188
+ADDRLP4 1480
+INDIRI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+GEI4 $411
+ADDRGP4 $413
+ARGP4
+ADDRGP4 g_adminLog+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $406
+JUMPV
+LABELV $411
+ADDRLP4 144
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 1488
+CNSTI4 60
+ASGNI4
+ADDRLP4 1180
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1488
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1488
+INDIRI4
+ADDRLP4 1180
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 1496
+CNSTI4 10
+ASGNI4
+ADDRLP4 1184
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1184
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $416
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $418
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1500
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRLP4 132
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $428
+ADDRLP4 136
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 136
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $420
+JUMPV
+LABELV $428
+LABELV $425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $424
+LABELV $430
+ADDRGP4 $420
+JUMPV
+LABELV $422
+LABELV $419
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $421
+ADDRLP4 140
+INDIRI4
+CNSTI4 1024
+GEI4 $431
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $418
+LABELV $431
+LABELV $420
+LABELV $416
+ADDRLP4 1500
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1500
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $432
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1192
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1192
+ARGP4
+ADDRLP4 1224
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1504
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 1
+NEI4 $434
+ADDRLP4 1172
+CNSTI4 816
+ADDRLP4 1224
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $434
+LABELV $432
+ADDRLP4 1172
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $436
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 1504
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1520
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 1180
+INDIRI4
+ARGI4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $445
+ADDRLP4 1508
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 1508
+CNSTI4 -1
+ASGNI4
+LABELV $446
+ADDRLP4 1508
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $447
+ADDRLP4 1512
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRLP4 1512
+ADDRGP4 $441
+ASGNP4
+LABELV $448
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $449
+ADDRLP4 1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 1516
+ADDRGP4 $443
+ASGNP4
+LABELV $450
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1524
+ADDRLP4 1172
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1524
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1524
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1520
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1520
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $451
+ARGP4
+ADDRLP4 1180
+INDIRI4
+ARGI4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $455
+ADDRLP4 1508
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRLP4 1508
+CNSTI4 -1
+ASGNI4
+LABELV $456
+ADDRLP4 1508
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $457
+ADDRLP4 1512
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRLP4 1512
+ADDRGP4 $441
+ASGNP4
+LABELV $458
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $459
+ADDRLP4 1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 1516
+ADDRGP4 $443
+ASGNP4
+LABELV $460
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1520
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $437
+ADDRLP4 148
+ARGP4
+ADDRLP4 1508
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 148
+ARGP4
+ADDRLP4 1508
+INDIRI4
+ARGI4
+ADDRLP4 1176
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 1176
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $406
+endproc admin_log 1528 56
+lit
+align 1
+LABELV $462
+byte 1 0
+skip 31
+align 1
+LABELV $463
+byte 1 0
+skip 31
+align 1
+LABELV $464
+byte 1 0
+skip 31
+code
+proc admin_listadmins 168 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRGP4 $462
+INDIRB
+ASGNB 32
+ADDRLP4 53
+ADDRGP4 $463
+INDIRB
+ASGNB 32
+ADDRLP4 12
+ADDRGP4 $464
+INDIRB
+ASGNB 32
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $468
+JUMPV
+LABELV $465
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $472
+ADDRLP4 132
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $470
+LABELV $472
+ADDRGP4 $466
+JUMPV
+LABELV $470
+ADDRLP4 136
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 136
+INDIRP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $473
+ADDRGP4 $466
+JUMPV
+LABELV $473
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $475
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 936
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $476
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $475
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $482
+JUMPV
+LABELV $479
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $483
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $485
+ADDRLP4 160
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $489
+ADDRLP4 160
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $489
+ADDRLP4 164
+ADDRLP4 160
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 164
+INDIRI4
+CNSTI4 48
+LTI4 $489
+ADDRLP4 164
+INDIRI4
+CNSTI4 56
+GTI4 $489
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $489
+LABELV $486
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $488
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $485
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRGP4 admin_level_maxname
+INDIRI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $481
+JUMPV
+LABELV $483
+LABELV $480
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $482
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $492
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $479
+LABELV $492
+LABELV $481
+ADDRGP4 $493
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $466
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $468
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $494
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $465
+LABELV $494
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $498
+JUMPV
+LABELV $495
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $499
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $501
+ADDRGP4 $496
+JUMPV
+LABELV $501
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $503
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $510
+ADDRLP4 140
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $508
+LABELV $510
+ADDRGP4 $504
+JUMPV
+LABELV $508
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 53
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $511
+ADDRLP4 53
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $511
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $511
+LABELV $504
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $506
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $503
+LABELV $505
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRGP4 $496
+JUMPV
+LABELV $513
+LABELV $499
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $515
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $516
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $515
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $519
+ADDRLP4 136
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $523
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $528
+JUMPV
+LABELV $525
+ADDRLP4 152
+ADDRLP4 140
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $529
+ADDRLP4 152
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $529
+ADDRLP4 156
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRLP4 156
+INDIRI4
+CNSTI4 48
+LTI4 $529
+ADDRLP4 156
+INDIRI4
+CNSTI4 56
+GTI4 $529
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $529
+LABELV $526
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $528
+ADDRLP4 140
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $525
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRGP4 admin_level_maxname
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $521
+JUMPV
+LABELV $523
+LABELV $520
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $522
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $531
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $519
+LABELV $531
+LABELV $521
+ADDRGP4 $493
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $496
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $498
+ADDRLP4 8
+INDIRI4
+CNSTI4 1024
+GEI4 $533
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $533
+ADDRLP4 128
+INDIRI4
+CNSTI4 20
+LTI4 $495
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+ADDRLP4 128
+INDIRI4
+RETI4
+LABELV $461
+endproc admin_listadmins 168 24
+export G_admin_duration
+proc G_admin_duration 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1576800000
+GTI4 $537
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $535
+LABELV $537
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $538
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRFP4 0
+INDIRI4
+CNSTI4 31536000
+LTI4 $539
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $541
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1274059200
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRFP4 0
+INDIRI4
+CNSTI4 7776000
+LTI4 $542
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $544
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1226024960
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRI4
+CNSTI4 86400
+LTI4 $545
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $547
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1202241536
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRFP4 0
+INDIRI4
+CNSTI4 3600
+LTI4 $548
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $550
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1163984896
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRI4
+CNSTI4 60
+LTI4 $551
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $553
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1114636288
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $552
+JUMPV
+LABELV $551
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $554
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $552
+LABELV $549
+LABELV $546
+LABELV $543
+LABELV $540
+LABELV $536
+LABELV $534
+endproc G_admin_duration 4 16
+export G_admin_ban_check
+proc G_admin_ban_check 80 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $556
+CNSTI4 0
+RETI4
+ADDRGP4 $555
+JUMPV
+LABELV $556
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $559
+CNSTI4 0
+RETI4
+ADDRGP4 $555
+JUMPV
+LABELV $559
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $562
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $566
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $566
+ADDRGP4 $563
+JUMPV
+LABELV $566
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $568
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $571
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $555
+JUMPV
+LABELV $568
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 44
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $574
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $555
+JUMPV
+LABELV $572
+LABELV $563
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $565
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $575
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $562
+LABELV $575
+CNSTI4 0
+RETI4
+LABELV $555
+endproc G_admin_ban_check 80 24
+export G_admin_cmd_check
+proc G_admin_cmd_check 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $577
+CNSTI4 0
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $577
+ADDRLP4 12
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $583
+ADDRLP4 12
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 57
+ARGI4
+ADDRLP4 40
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $579
+LABELV $583
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+LABELV $579
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $584
+ADDRLP4 4
+ADDRLP4 12+1
+ASGNP4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+CNSTI4 0
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $585
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $587
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRGP4 $588
+JUMPV
+LABELV $591
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 admin_command_permission
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $593
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 G_FloodLimited
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $595
+CNSTI4 1
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $595
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRGP4 $597
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+LABELV $594
+CNSTI4 1
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $588
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $590
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $598
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $587
+LABELV $598
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $599
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRGP4 $600
+JUMPV
+LABELV $603
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $608
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 G_FloodLimited
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $608
+CNSTI4 1
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $608
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+4
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRGP4 $597
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+LABELV $606
+CNSTI4 1
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 0
+INDIRI4
+ADDRGP4 adminNumCmds
+INDIRI4
+LTI4 $599
+CNSTI4 0
+RETI4
+LABELV $576
+endproc G_admin_cmd_check 60 12
+export G_admin_namelog_cleanup
+proc G_admin_namelog_cleanup 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $612
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+GEI4 $616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $612
+LABELV $616
+LABELV $611
+endproc G_admin_namelog_cleanup 8 4
+export G_admin_namelog_update
+proc G_admin_namelog_update 104 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 2124
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $618
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $622
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $622
+ADDRGP4 $619
+JUMPV
+LABELV $622
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $624
+ADDRLP4 80
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $624
+ADDRLP4 80
+INDIRI4
+CNSTI4 -1
+EQI4 $624
+ADDRGP4 $619
+JUMPV
+LABELV $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $626
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $628
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $632
+ADDRGP4 $630
+JUMPV
+LABELV $632
+LABELV $629
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $631
+ADDRLP4 96
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $634
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $628
+LABELV $634
+LABELV $630
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $635
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $635
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $638
+ADDRLP4 100
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRLP4 100
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $639
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $617
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $617
+JUMPV
+LABELV $626
+LABELV $619
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $642
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $618
+LABELV $642
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $643
+ADDRGP4 $645
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $643
+CNSTU4 244
+ARGU4
+ADDRLP4 84
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 244
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $646
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $647
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $646
+ADDRLP4 76
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 76
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $651
+ADDRLP4 88
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $652
+JUMPV
+LABELV $651
+ADDRLP4 88
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $652
+ADDRLP4 76
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $617
+endproc G_admin_namelog_update 104 12
+lit
+align 1
+LABELV $753
+byte 1 0
+skip 1023
+export G_admin_readconfig
+code
+proc G_admin_readconfig 1188 24
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 80
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_admin_cleanup
+CALLV
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $654
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $657
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 admin_default_levels
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $654
+ADDRGP4 g_admin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $659
+ADDRGP4 $661
+ARGP4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 admin_default_levels
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $659
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 88
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 admin_level_maxname
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRGP4 COM_BeginParseSession
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 12
+ARGP4
+ADDRLP4 100
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $667
+ADDRGP4 $666
+JUMPV
+LABELV $667
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $669
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+LTI4 $672
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $672
+CNSTU4 100
+ARGU4
+ADDRLP4 108
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $676
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $674
+ADDRLP4 44
+INDIRI4
+CNSTI4 1024
+LTI4 $677
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $677
+CNSTU4 136
+ARGU4
+ADDRLP4 112
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $681
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $679
+ADDRLP4 52
+INDIRI4
+CNSTI4 1024
+LTI4 $682
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $682
+CNSTU4 212
+ARGU4
+ADDRLP4 116
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $686
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $684
+ADDRLP4 60
+INDIRI4
+CNSTI4 64
+LTI4 $687
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $687
+CNSTU4 268
+ARGU4
+ADDRLP4 120
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 124
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $691
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $689
+ADDRLP4 72
+INDIRI4
+CNSTI4 1024
+LTI4 $692
+CNSTI4 0
+RETI4
+ADDRGP4 $653
+JUMPV
+LABELV $692
+CNSTU4 1184
+ARGU4
+ADDRLP4 124
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $690
+JUMPV
+LABELV $689
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $694
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $698
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $696
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $695
+JUMPV
+LABELV $696
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $699
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $695
+JUMPV
+LABELV $699
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $702
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $695
+JUMPV
+LABELV $702
+ADDRGP4 $705
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $706
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $708
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $707
+JUMPV
+LABELV $708
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $712
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $710
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $707
+JUMPV
+LABELV $710
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $698
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $713
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $707
+JUMPV
+LABELV $713
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $715
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $707
+JUMPV
+LABELV $715
+ADDRGP4 $717
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $720
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $720
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $712
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $722
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $722
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $724
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $724
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $728
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $726
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $726
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $731
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $729
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 155
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $729
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $734
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $732
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $732
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $737
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $735
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $735
+ADDRGP4 $738
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $719
+JUMPV
+LABELV $718
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $739
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $743
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $741
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $740
+JUMPV
+LABELV $741
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $746
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $744
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $740
+JUMPV
+LABELV $744
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $749
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $747
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $740
+JUMPV
+LABELV $747
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $752
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $750
+ADDRLP4 148
+ADDRGP4 $753
+INDIRB
+ASGNB 1024
+ADDRLP4 144
+ADDRLP4 148
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 144
+ARGP4
+ADDRLP4 1176
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 1172
+ADDRLP4 1176
+INDIRP4
+ASGNP4
+ADDRLP4 1172
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $757
+ADDRGP4 $756
+JUMPV
+LABELV $757
+ADDRLP4 1180
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1172
+INDIRP4
+ARGP4
+ADDRLP4 1184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+LABELV $755
+ADDRLP4 140
+INDIRI4
+CNSTI4 32
+LTI4 $754
+LABELV $756
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $740
+JUMPV
+LABELV $750
+ADDRGP4 $759
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $760
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $762
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $762
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $712
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $764
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $764
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $766
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $766
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $770
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $768
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $768
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $731
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $771
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1129
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $771
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $734
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $773
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1180
+ADDP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $773
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $777
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $775
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $775
+ADDRGP4 $778
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRGP4 $779
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+LABELV $761
+LABELV $740
+LABELV $719
+LABELV $707
+LABELV $695
+LABELV $690
+LABELV $685
+LABELV $680
+LABELV $675
+LABELV $670
+LABELV $665
+ADDRGP4 $664
+JUMPV
+LABELV $666
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRGP4 $780
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $781
+ADDRGP4 admin_default_levels
+CALLV
+pop
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $786
+JUMPV
+LABELV $783
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 admin_level_maxname
+INDIRI4
+LEI4 $787
+ADDRGP4 admin_level_maxname
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $787
+LABELV $784
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $786
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $789
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $783
+LABELV $789
+LABELV $782
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $793
+JUMPV
+LABELV $790
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $795
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 G_admin_level
+CALLI4
+ASGNI4
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1000
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+LABELV $795
+LABELV $791
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $793
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $790
+CNSTI4 1
+RETI4
+LABELV $653
+endproc G_admin_readconfig 1188 24
+export G_admin_time
+proc G_admin_time 40 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 $798
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $797
+endproc G_admin_time 40 16
+lit
+align 1
+LABELV $802
+byte 1 0
+skip 31
+align 1
+LABELV $803
+byte 1 0
+skip 31
+align 1
+LABELV $804
+byte 1 0
+skip 31
+export G_admin_setlevel
+code
+proc G_admin_setlevel 260 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $802
+INDIRB
+ASGNB 32
+ADDRLP4 116
+ADDRGP4 $803
+INDIRB
+ASGNB 32
+ADDRLP4 69
+ADDRGP4 $804
+INDIRB
+ASGNB 32
+ADDRLP4 112
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+CNSTI4 -1
+ASGNI4
+ADDRLP4 180
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $805
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $807
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $805
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 69
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 168
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 168
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 69
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $811
+JUMPV
+LABELV $808
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 48
+LTI4 $814
+ADDRLP4 188
+INDIRI4
+CNSTI4 57
+LEI4 $812
+LABELV $814
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRGP4 $810
+JUMPV
+LABELV $812
+LABELV $809
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $811
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $815
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $808
+LABELV $815
+LABELV $810
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $816
+ADDRLP4 4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $816
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $818
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+LEI4 $818
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $820
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $818
+ADDRLP4 200
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 200
+INDIRU4
+NEU4 $821
+ADDRGP4 g_admin_levels
+INDIRP4
+CVPU4 4
+ADDRLP4 200
+INDIRU4
+NEU4 $821
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_admin_readconfig
+CALLI4
+pop
+LABELV $821
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $826
+JUMPV
+LABELV $823
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $827
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRGP4 $825
+JUMPV
+LABELV $827
+LABELV $824
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $826
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $829
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $823
+LABELV $829
+LABELV $825
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $830
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $832
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $830
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $833
+ADDRLP4 160
+INDIRI4
+ADDRLP4 208
+INDIRI4
+LTI4 $833
+ADDRLP4 160
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $833
+ADDRLP4 112
+CNSTI4 816
+ADDRLP4 160
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $833
+ADDRLP4 220
+CNSTU4 0
+ASGNU4
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 220
+INDIRU4
+EQU4 $836
+ADDRLP4 224
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+CVPU4 4
+ADDRLP4 220
+INDIRU4
+EQU4 $836
+ADDRLP4 224
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRLP4 116
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $837
+JUMPV
+LABELV $836
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+LTI4 $838
+ADDRLP4 160
+INDIRI4
+CNSTI4 1088
+GEI4 $838
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins-256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $838
+ADDRLP4 116
+ARGP4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins-256
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins-256
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $846
+JUMPV
+LABELV $843
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 69
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 69
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 232
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $847
+ADDRLP4 116
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $847
+LABELV $844
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $846
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $850
+ADDRLP4 236
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 236
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $850
+ADDRLP4 108
+INDIRI4
+ADDRLP4 236
+INDIRI4
+LTI4 $843
+LABELV $850
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $854
+JUMPV
+LABELV $851
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $856
+ADDRGP4 $852
+JUMPV
+LABELV $856
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $858
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $858
+ADDRLP4 112
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $852
+JUMPV
+LABELV $858
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 69
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 69
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 244
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $860
+ADDRLP4 112
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $860
+LABELV $852
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $854
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $862
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+LTI4 $851
+LABELV $862
+ADDRLP4 244
+CNSTU4 0
+ASGNU4
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 244
+INDIRU4
+EQU4 $863
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 244
+INDIRU4
+EQU4 $863
+ADDRLP4 116
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $863
+LABELV $839
+LABELV $837
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $865
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $867
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $865
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+LEI4 $868
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $870
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 admin_listadmins
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $868
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $871
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 236
+ADDRGP4 admin_higher_guid
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $873
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $871
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $877
+JUMPV
+LABELV $874
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $878
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+LABELV $878
+LABELV $875
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $877
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $880
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $874
+LABELV $880
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $881
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+NEI4 $883
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $885
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $801
+JUMPV
+LABELV $883
+CNSTU4 136
+ARGU4
+ADDRLP4 244
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 164
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+ADDRLP4 164
+INDIRP4
+ASGNP4
+LABELV $881
+ADDRGP4 $886
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $888
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $889
+JUMPV
+LABELV $888
+ADDRLP4 244
+ADDRGP4 $443
+ASGNP4
+LABELV $889
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 256
+CNSTU4 0
+ASGNU4
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 256
+INDIRU4
+EQU4 $890
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 256
+INDIRU4
+EQU4 $890
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $890
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $892
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $895
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $892
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $893
+CNSTI4 1
+RETI4
+LABELV $801
+endproc G_admin_setlevel 260 16
+proc admin_create_ban 60 36
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTU4 212
+ARGU4
+ADDRLP4 52
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $897
+CNSTI4 0
+RETI4
+ADDRGP4 $896
+JUMPV
+LABELV $897
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 155
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 $899
+ARGP4
+ADDRLP4 8+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+ADDRLP4 8+20
+INDIRI4
+CNSTI4 100
+MODI4
+ARGI4
+ADDRLP4 8+8
+INDIRI4
+ARGI4
+ADDRLP4 8+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $905
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $906
+JUMPV
+LABELV $905
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 $443
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $906
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $907
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $908
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $909
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRGP4 $911
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $910
+JUMPV
+LABELV $909
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $910
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $915
+JUMPV
+LABELV $912
+LABELV $913
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $915
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $916
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $912
+LABELV $916
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+NEI4 $917
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $919
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $896
+JUMPV
+LABELV $917
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $896
+endproc admin_create_ban 60 36
+proc admin_create_warning 60 36
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTU4 1184
+ARGU4
+ADDRLP4 52
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $921
+CNSTI4 0
+RETI4
+ADDRGP4 $920
+JUMPV
+LABELV $921
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1129
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 $899
+ARGP4
+ADDRLP4 8+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+ADDRLP4 8+20
+INDIRI4
+CNSTI4 100
+MODI4
+ARGI4
+ADDRLP4 8+8
+INDIRI4
+ARGI4
+ADDRLP4 8+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $928
+ADDRLP4 4
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $929
+JUMPV
+LABELV $928
+ADDRLP4 4
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+ADDRGP4 $443
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $929
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $930
+ADDRLP4 4
+INDIRP4
+CNSTI4 1180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $931
+JUMPV
+LABELV $930
+ADDRLP4 4
+INDIRP4
+CNSTI4 1180
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $931
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $932
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRGP4 $934
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $933
+JUMPV
+LABELV $932
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $933
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $938
+JUMPV
+LABELV $935
+LABELV $936
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $938
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $939
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $935
+LABELV $939
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+NEI4 $940
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $942
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $920
+JUMPV
+LABELV $940
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $920
+endproc admin_create_warning 60 36
+export G_admin_parse_time
+proc G_admin_parse_time 52 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $945
+JUMPV
+LABELV $944
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+LTI4 $949
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+LEI4 $951
+LABELV $949
+CNSTI4 -1
+RETI4
+ADDRGP4 $943
+JUMPV
+LABELV $950
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $951
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $953
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+LEI4 $950
+LABELV $953
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $954
+ADDRGP4 $946
+JUMPV
+LABELV $954
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+CNSTI4 109
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $962
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $965
+LABELV $964
+ADDRLP4 40
+CNSTI4 100
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $960
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $956
+LABELV $966
+ADDRLP4 20
+INDIRI4
+CNSTI4 104
+EQI4 $961
+ADDRGP4 $956
+JUMPV
+LABELV $965
+ADDRLP4 48
+CNSTI4 115
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $957
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $956
+LABELV $967
+ADDRLP4 20
+INDIRI4
+CNSTI4 119
+EQI4 $959
+ADDRGP4 $956
+JUMPV
+LABELV $959
+ADDRLP4 0
+CNSTI4 7
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $960
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $961
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $962
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+CNSTI4 -1
+RETI4
+ADDRGP4 $943
+JUMPV
+LABELV $957
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $945
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $944
+LABELV $946
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $968
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $943
+endproc G_admin_parse_time 52 0
+export G_admin_kick
+proc G_admin_kick 1396 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 296
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1328
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRLP4 296
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $971
+ADDRLP4 1332
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+ADDRLP4 296
+INDIRI4
+GEI4 $973
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $975
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $970
+JUMPV
+LABELV $973
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1336
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1340
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 1
+EQI4 $976
+ADDRLP4 8
+ARGP4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 304
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $978
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 1344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $970
+JUMPV
+LABELV $976
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 0
+NEI4 $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $981
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $970
+JUMPV
+LABELV $979
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $982
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $984
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $970
+JUMPV
+LABELV $982
+ADDRGP4 $985
+ARGP4
+ADDRGP4 g_adminTempBan+16
+ARGP4
+ADDRLP4 1352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1352
+INDIRP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 1356
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $989
+ADDRLP4 1348
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $990
+JUMPV
+LABELV $989
+ADDRLP4 1348
+ADDRGP4 $987
+ASGNP4
+LABELV $990
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRGP4 admin_create_ban
+CALLI4
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $991
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $991
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $998
+ADDRGP4 $995
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1364
+ADDRLP4 1372
+INDIRP4
+ASGNP4
+ADDRGP4 $999
+JUMPV
+LABELV $998
+ADDRLP4 1364
+ADDRGP4 $68
+ASGNP4
+LABELV $999
+ADDRGP4 $994
+ARGP4
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1000
+ADDRLP4 1368
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1001
+JUMPV
+LABELV $1000
+ADDRLP4 1368
+ADDRGP4 $987
+ASGNP4
+LABELV $1001
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRLP4 1376
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1006
+ADDRGP4 $1003
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1388
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1380
+ADDRLP4 1388
+INDIRP4
+ASGNP4
+ADDRGP4 $1007
+JUMPV
+LABELV $1006
+ADDRLP4 1380
+ADDRGP4 $68
+ASGNP4
+LABELV $1007
+ADDRGP4 $1002
+ARGP4
+ADDRLP4 1380
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1008
+ADDRLP4 1384
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRLP4 1384
+ADDRGP4 $987
+ASGNP4
+LABELV $1009
+ADDRLP4 1384
+INDIRP4
+ARGP4
+ADDRLP4 1392
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1392
+INDIRP4
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $970
+endproc G_admin_kick 1396 24
+export G_admin_ban
+proc G_admin_ban 1284 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 -1
+ASGNI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1196
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+EQI4 $1011
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1200
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+EQI4 $1011
+ADDRLP4 1192
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1012
+JUMPV
+LABELV $1011
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1204
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $1017
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1208
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1212
+CNSTI4 0
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+ADDRLP4 1212
+INDIRI4
+NEI4 $1017
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+ADDRLP4 1212
+INDIRI4
+EQI4 $1013
+LABELV $1017
+ADDRLP4 1192
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRGP4 $1014
+JUMPV
+LABELV $1013
+ADDRLP4 1192
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $1014
+LABELV $1012
+ADDRLP4 1216
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+ADDRLP4 1192
+INDIRI4
+GEI4 $1018
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1020
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1018
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 92
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 92
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 168
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 168
+ARGP4
+ADDRLP4 1220
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 1220
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+GTI4 $1021
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1023
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1224
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $1023
+ADDRGP4 $1026
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1232
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1228
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+EQI4 $1029
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1030
+JUMPV
+LABELV $1029
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1030
+LABELV $1024
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1232
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 1232
+INDIRP4
+ASGNP4
+ADDRGP4 $1022
+JUMPV
+LABELV $1021
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1032
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1224
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $1032
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1228
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1228
+INDIRI4
+LEI4 $1032
+ADDRGP4 $1036
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1232
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1236
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 1236
+INDIRI4
+ASGNI4
+LABELV $1032
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 1232
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 1232
+INDIRP4
+ASGNP4
+LABELV $1022
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1042
+JUMPV
+LABELV $1039
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1043
+ADDRGP4 $1040
+JUMPV
+LABELV $1043
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1045
+ADDRGP4 $1040
+JUMPV
+LABELV $1045
+ADDRGP4 $1049
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $1047
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRLP4 88
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $1041
+JUMPV
+LABELV $1047
+LABELV $1040
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1042
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1050
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1039
+LABELV $1050
+LABELV $1041
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1051
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1055
+ADDRGP4 $1052
+JUMPV
+LABELV $1055
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $1057
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRLP4 88
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1057
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1059
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1232
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1063
+ADDRLP4 72
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1065
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1065
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1063
+LABELV $1060
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1062
+ADDRLP4 1236
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1236
+INDIRI4
+GEI4 $1067
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1236
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1059
+LABELV $1067
+LABELV $1052
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1054
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $1069
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1069
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1051
+LABELV $1069
+LABELV $1053
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $1070
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1072
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1070
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+LEI4 $1073
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1075
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1079
+JUMPV
+LABELV $1076
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1080
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1081
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1080
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1084
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 1236
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1088
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1090
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1092
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1090
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1096
+ADDRGP4 $1049
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1240
+ADDRLP4 1244
+INDIRP4
+ASGNP4
+ADDRGP4 $1097
+JUMPV
+LABELV $1096
+ADDRLP4 1240
+ADDRGP4 $1094
+ASGNP4
+LABELV $1097
+ADDRGP4 $1093
+ARGP4
+ADDRLP4 1240
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 1248
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 1248
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1252
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1088
+LABELV $1085
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1087
+ADDRLP4 1240
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1240
+INDIRI4
+GEI4 $1098
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1240
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1084
+LABELV $1098
+LABELV $1077
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1079
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1099
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1076
+LABELV $1099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1073
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 1236
+ADDRGP4 admin_higher_guid
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $1100
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1102
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1100
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRGP4 $1105
+ARGP4
+ADDRLP4 1240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $1103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1106
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1103
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1108
+ADDRLP4 1244
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1108
+ADDRLP4 1244
+CNSTI4 -1
+ASGNI4
+LABELV $1109
+ADDRLP4 1244
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1248
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+INDIRP4
+ARGP4
+ADDRLP4 1248
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 1248
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 admin_create_ban
+CALLI4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1113
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1111
+JUMPV
+LABELV $1110
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 1256
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $1114
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1117
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1115
+JUMPV
+LABELV $1114
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1115
+LABELV $1111
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1118
+ADDRGP4 $1120
+ARGP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1123
+ADDRLP4 1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1124
+JUMPV
+LABELV $1123
+ADDRLP4 1260
+ADDRGP4 $443
+ASGNP4
+LABELV $1124
+ADDRLP4 1260
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1125
+ADDRLP4 1264
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $1126
+JUMPV
+LABELV $1125
+ADDRLP4 1264
+ADDRGP4 $911
+ASGNP4
+LABELV $1126
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1010
+JUMPV
+LABELV $1118
+ADDRGP4 $1127
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1130
+ADDRLP4 1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1131
+JUMPV
+LABELV $1130
+ADDRLP4 1260
+ADDRGP4 $443
+ASGNP4
+LABELV $1131
+ADDRLP4 1260
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1132
+ADDRLP4 1264
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $1133
+JUMPV
+LABELV $1132
+ADDRLP4 1264
+ADDRGP4 $911
+ASGNP4
+LABELV $1133
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1134
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1137
+ADDRLP4 1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1138
+JUMPV
+LABELV $1137
+ADDRLP4 1272
+ADDRGP4 $443
+ASGNP4
+LABELV $1138
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1139
+ADDRLP4 1276
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRLP4 1276
+ADDRGP4 $911
+ASGNP4
+LABELV $1140
+ADDRLP4 1276
+INDIRP4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1010
+endproc G_admin_ban 1284 24
+export G_admin_unban
+proc G_admin_unban 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1144
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1142
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1149
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GTI4 $1149
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1145
+LABELV $1149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1150
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1145
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1151
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 32
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1151
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1154
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1151
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1155
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 36
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1155
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+LEI4 $1155
+ADDRGP4 $1160
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1155
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1163
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1166
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1167
+JUMPV
+LABELV $1166
+ADDRLP4 44
+ADDRGP4 $443
+ASGNP4
+LABELV $1167
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1168
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1168
+CNSTI4 1
+RETI4
+LABELV $1141
+endproc G_admin_unban 56 16
+lit
+align 1
+LABELV $1172
+byte 1 0
+skip 31
+export G_admin_adjustban
+code
+proc G_admin_adjustban 1156 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 1045
+ADDRGP4 $1172
+INDIRB
+ASGNB 32
+ADDRLP4 1044
+CNSTI1 0
+ASGNI1
+ADDRLP4 1092
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $1173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1175
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1173
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1077
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1077
+ARGP4
+ADDRLP4 1096
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $1180
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+GTI4 $1180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1176
+LABELV $1180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1181
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1176
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1183
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1104
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1183
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1185
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1183
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1186
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1108
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1186
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1112
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+ADDRLP4 1112
+INDIRI4
+LEI4 $1186
+ADDRGP4 $1190
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1186
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1116
+ADDRLP4 12
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 43
+EQI4 $1194
+ADDRLP4 1116
+INDIRI4
+CNSTI4 45
+NEI4 $1192
+LABELV $1194
+ADDRLP4 1044
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $1192
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1196
+ADDRLP4 1120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1197
+JUMPV
+LABELV $1196
+ADDRLP4 1120
+CNSTI4 0
+ASGNI4
+LABELV $1197
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 12
+ADDP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+GEI4 $1198
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1199
+JUMPV
+LABELV $1198
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRLP4 1128
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1128
+INDIRI4
+NEI4 $1202
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+ADDRLP4 1128
+INDIRI4
+EQI4 $1202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1204
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1202
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $1205
+ADDRLP4 1084
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1206
+JUMPV
+LABELV $1205
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $1207
+ADDRLP4 1084
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1208
+JUMPV
+LABELV $1207
+ADDRLP4 1084
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1208
+LABELV $1206
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+GTI4 $1209
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1211
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1209
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1201
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1132
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $1201
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1136
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+ADDRLP4 1136
+INDIRI4
+LEI4 $1201
+ADDRGP4 $1216
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1144
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1144
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1201
+JUMPV
+LABELV $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1128
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $1219
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1220
+JUMPV
+LABELV $1219
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1211
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1171
+JUMPV
+LABELV $1220
+LABELV $1201
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+EQI4 $1222
+ADDRLP4 1132
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1223
+JUMPV
+LABELV $1222
+ADDRLP4 1132
+CNSTI4 -1
+ASGNI4
+LABELV $1223
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1045
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+LABELV $1199
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 1128
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1128
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1224
+ADDRLP4 0
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1224
+ADDRGP4 $1226
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1234
+ADDRLP4 1132
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1235
+JUMPV
+LABELV $1234
+ADDRLP4 1132
+ADDRGP4 $443
+ASGNP4
+LABELV $1235
+ADDRLP4 1132
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+LTI4 $1236
+ADDRLP4 1136
+ADDRGP4 $1228
+ASGNP4
+ADDRGP4 $1237
+JUMPV
+LABELV $1236
+ADDRLP4 1136
+ADDRGP4 $68
+ASGNP4
+LABELV $1237
+ADDRLP4 1136
+INDIRP4
+ARGP4
+ADDRLP4 1045
+ARGP4
+ADDRLP4 1148
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1148
+INDIRI4
+LTI4 $1238
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1148
+INDIRI4
+EQI4 $1238
+ADDRLP4 1140
+ADDRGP4 $1230
+ASGNP4
+ADDRGP4 $1239
+JUMPV
+LABELV $1238
+ADDRLP4 1140
+ADDRGP4 $68
+ASGNP4
+LABELV $1239
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1240
+ADDRLP4 1144
+ADDRGP4 $1232
+ASGNP4
+ADDRGP4 $1241
+JUMPV
+LABELV $1240
+ADDRLP4 1144
+ADDRGP4 $68
+ASGNP4
+LABELV $1241
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1152
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1242
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1242
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1244
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1244
+CNSTI4 1
+RETI4
+LABELV $1171
+endproc G_admin_adjustban 1156 36
+export G_admin_putteam
+proc G_admin_putteam 1384 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1356
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $1248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1250
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1247
+JUMPV
+LABELV $1248
+ADDRLP4 296
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1360
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 1360
+INDIRI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 1
+EQI4 $1251
+ADDRLP4 40
+ARGP4
+ADDRLP4 328
+INDIRI4
+ARGI4
+ADDRLP4 332
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1253
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 1364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1247
+JUMPV
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 816
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 1364
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+NEI4 $1254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1256
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1247
+JUMPV
+LABELV $1254
+ADDRLP4 36
+CNSTI4 816
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1368
+ADDRGP4 G_TeamFromString
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $1257
+ADDRGP4 $1259
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1372
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1247
+JUMPV
+LABELV $1257
+ADDRLP4 36
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1260
+CNSTI4 0
+RETI4
+ADDRGP4 $1247
+JUMPV
+LABELV $1260
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1262
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1264
+ADDRLP4 1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1265
+JUMPV
+LABELV $1264
+ADDRLP4 1372
+ADDRGP4 $443
+ASGNP4
+LABELV $1265
+ADDRLP4 1372
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRLP4 1380
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1380
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1247
+endproc G_admin_putteam 1384 16
+export G_admin_map
+proc G_admin_map 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1269
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1266
+JUMPV
+LABELV $1267
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1270
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1266
+JUMPV
+LABELV $1270
+ADDRGP4 $1274
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1276
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1278
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1279
+JUMPV
+LABELV $1278
+ADDRLP4 80
+ADDRGP4 $443
+ASGNP4
+LABELV $1279
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1266
+endproc G_admin_map 88 12
+export G_admin_mute
+proc G_admin_mute 1372 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 296
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1281
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $1281
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1281
+ADDRLP4 1348
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1283
+ADDRGP4 $1285
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1280
+JUMPV
+LABELV $1283
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 264
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1352
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 1352
+INDIRI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 1
+EQI4 $1286
+ADDRLP4 4
+ARGP4
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRLP4 320
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 1356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1280
+JUMPV
+LABELV $1286
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+NEI4 $1289
+ADDRGP4 $1291
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1280
+JUMPV
+LABELV $1289
+ADDRLP4 260
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1292
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1296
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1280
+JUMPV
+LABELV $1294
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1297
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1298
+ARGP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1300
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1301
+JUMPV
+LABELV $1300
+ADDRLP4 1364
+ADDRGP4 $443
+ASGNP4
+LABELV $1301
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 1368
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1293
+JUMPV
+LABELV $1292
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1302
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1304
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1280
+JUMPV
+LABELV $1302
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1305
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1306
+ARGP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1308
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1309
+JUMPV
+LABELV $1308
+ADDRLP4 1364
+ADDRGP4 $443
+ASGNP4
+LABELV $1309
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 1368
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1293
+CNSTI4 1
+RETI4
+LABELV $1280
+endproc G_admin_mute 1372 16
+lit
+align 1
+LABELV $1311
+byte 1 0
+skip 31
+align 1
+LABELV $1312
+byte 1 0
+skip 31
+export G_admin_listadmins
+code
+proc G_admin_listadmins 116 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRGP4 $1311
+INDIRB
+ASGNB 32
+ADDRLP4 4
+ADDRGP4 $1312
+INDIRB
+ASGNB 32
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1316
+JUMPV
+LABELV $1313
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1317
+ADDRGP4 $1314
+JUMPV
+LABELV $1317
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1314
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1316
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1319
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1313
+LABELV $1319
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1322
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1310
+JUMPV
+LABELV $1320
+ADDRLP4 88
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+NEI4 $1323
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1328
+JUMPV
+LABELV $1325
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 48
+LTI4 $1329
+ADDRLP4 92
+INDIRI4
+CNSTI4 57
+GTI4 $1329
+ADDRGP4 $1326
+JUMPV
+LABELV $1329
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $1326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1328
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $1331
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1325
+LABELV $1331
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1332
+ADDRLP4 4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $1334
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1333
+JUMPV
+LABELV $1334
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $1333
+ADDRLP4 40
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1333
+JUMPV
+LABELV $1332
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+LABELV $1333
+LABELV $1323
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GEI4 $1340
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $1338
+LABELV $1340
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $1338
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1341
+ADDRGP4 $1343
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1310
+JUMPV
+LABELV $1341
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 96
+ADDRGP4 admin_listadmins
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1344
+ADDRGP4 $1346
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1345
+JUMPV
+LABELV $1344
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1350
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1351
+JUMPV
+LABELV $1350
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $1351
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+ADDRLP4 36
+INDIRI4
+LEI4 $1352
+ADDRLP4 104
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1353
+JUMPV
+LABELV $1352
+ADDRLP4 104
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1353
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+ADDRLP4 36
+INDIRI4
+GEI4 $1354
+ADDRGP4 $1356
+ARGP4
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+LABELV $1345
+CNSTI4 1
+RETI4
+LABELV $1310
+endproc G_admin_listadmins 116 16
+lit
+align 1
+LABELV $1358
+byte 1 0
+skip 31
+align 1
+LABELV $1359
+byte 1 0
+skip 31
+align 1
+LABELV $1360
+byte 1 0
+skip 31
+export G_admin_listplayers
+code
+proc G_admin_listplayers 196 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $1358
+INDIRB
+ASGNB 32
+ADDRLP4 124
+ADDRGP4 $1359
+INDIRB
+ASGNB 32
+ADDRLP4 12
+ADDRGP4 $1360
+INDIRB
+ASGNB 32
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRGP4 $1361
+ARGP4
+ADDRGP4 level+72
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1366
+JUMPV
+LABELV $1363
+ADDRLP4 4
+CNSTI4 2124
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 159
+ARGP4
+ADDRGP4 $147
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1092
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1368
+ADDRLP4 159
+ARGP4
+ADDRGP4 $140
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1370
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1369
+JUMPV
+LABELV $1368
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1371
+ADDRLP4 159
+ARGP4
+ADDRGP4 $1373
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1374
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1372
+JUMPV
+LABELV $1371
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1375
+ADDRLP4 159
+ARGP4
+ADDRGP4 $1377
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1378
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1376
+JUMPV
+LABELV $1375
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1379
+ADDRLP4 159
+ARGP4
+ADDRGP4 $147
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1381
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1379
+LABELV $1376
+LABELV $1372
+LABELV $1369
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1382
+ADDRLP4 159
+ARGP4
+ADDRGP4 $154
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1384
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1383
+JUMPV
+LABELV $1382
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1385
+ADDRGP4 $1364
+JUMPV
+LABELV $1385
+LABELV $1383
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1387
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 936
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1388
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1387
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 161
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1391
+ADDRLP4 161
+ARGP4
+ADDRGP4 $102
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1391
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 124
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 92
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1396
+JUMPV
+LABELV $1393
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $1397
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1399
+CNSTI4 816
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 176
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $1399
+ADDRGP4 $1395
+JUMPV
+LABELV $1399
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 180
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 124
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1395
+ADDRLP4 92
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1395
+JUMPV
+LABELV $1397
+LABELV $1394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1396
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1403
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1393
+LABELV $1403
+LABELV $1395
+ADDRLP4 44
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1407
+JUMPV
+LABELV $1404
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1408
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $1413
+JUMPV
+LABELV $1410
+ADDRLP4 188
+ADDRLP4 176
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1414
+ADDRLP4 188
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1414
+ADDRLP4 192
+ADDRLP4 188
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1414
+ADDRLP4 192
+INDIRI4
+CNSTI4 48
+LTI4 $1414
+ADDRLP4 192
+INDIRI4
+CNSTI4 56
+GTI4 $1414
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1414
+LABELV $1411
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1413
+ADDRLP4 176
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1410
+ADDRLP4 44
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRGP4 admin_level_maxname
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1406
+JUMPV
+LABELV $1408
+LABELV $1405
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1407
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $1416
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1404
+LABELV $1416
+LABELV $1406
+ADDRGP4 $1417
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRLP4 159
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 161
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1422
+ADDRLP4 180
+ADDRGP4 $1418
+ASGNP4
+ADDRGP4 $1423
+JUMPV
+LABELV $1422
+ADDRLP4 180
+ADDRGP4 $68
+ASGNP4
+LABELV $1423
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 92
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1424
+ADDRLP4 184
+ADDRGP4 $1420
+ASGNP4
+ADDRGP4 $1425
+JUMPV
+LABELV $1424
+ADDRLP4 184
+ADDRGP4 $68
+ASGNP4
+LABELV $1425
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1364
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1366
+ADDRLP4 88
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1363
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1357
+endproc G_admin_listplayers 196 48
+lit
+align 1
+LABELV $1427
+byte 1 0
+skip 31
+align 1
+LABELV $1428
+byte 1 0
+skip 63
+align 1
+LABELV $1429
+byte 1 0
+skip 63
+align 1
+LABELV $1430
+byte 1 0
+skip 31
+export G_admin_showbans
+code
+proc G_admin_showbans 368 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+CNSTI4 -1
+ASGNI4
+ADDRLP4 276
+CNSTI4 1
+ASGNI4
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+ADDRGP4 $1427
+INDIRB
+ASGNB 32
+ADDRLP4 32
+ADDRGP4 $1428
+INDIRB
+ASGNB 64
+ADDRLP4 180
+ADDRGP4 $1429
+INDIRB
+ASGNB 64
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRGP4 $1430
+INDIRB
+ASGNB 32
+CNSTP4 0
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1434
+JUMPV
+LABELV $1431
+ADDRLP4 308
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1435
+ADDRLP4 308
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1435
+ADDRGP4 $1432
+JUMPV
+LABELV $1435
+ADDRLP4 292
+ADDRLP4 292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1432
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1434
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1437
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1431
+LABELV $1437
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+GEI4 $1438
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1440
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1426
+JUMPV
+LABELV $1438
+ADDRLP4 312
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $1441
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 316
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $1443
+ADDRLP4 116
+ARGP4
+ADDRLP4 320
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+LABELV $1443
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1448
+JUMPV
+LABELV $1445
+ADDRLP4 320
+ADDRLP4 0
+INDIRI4
+ADDRLP4 116
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 48
+LTI4 $1451
+ADDRLP4 320
+INDIRI4
+CNSTI4 57
+LEI4 $1449
+LABELV $1451
+ADDRLP4 324
+ADDRLP4 0
+INDIRI4
+ADDRLP4 116
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 46
+EQI4 $1449
+ADDRLP4 324
+INDIRI4
+CNSTI4 45
+EQI4 $1449
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1447
+JUMPV
+LABELV $1449
+LABELV $1446
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1448
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $1452
+ADDRLP4 0
+INDIRI4
+ADDRLP4 116
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1445
+LABELV $1452
+LABELV $1447
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $1453
+ADDRLP4 116
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 116
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 324
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1455
+ADDRLP4 104
+ADDRLP4 116
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $1456
+JUMPV
+LABELV $1455
+ADDRLP4 116
+ARGP4
+ADDRLP4 328
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 116
+CNSTI1 0
+ASGNI1
+LABELV $1456
+LABELV $1454
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+LEI4 $1457
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1458
+JUMPV
+LABELV $1457
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+GEI4 $1459
+ADDRLP4 0
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1464
+JUMPV
+LABELV $1461
+ADDRLP4 328
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 332
+INDIRI4
+EQI4 $1467
+ADDRLP4 328
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 332
+INDIRI4
+LEI4 $1465
+LABELV $1467
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1465
+LABELV $1462
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1464
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1468
+ADDRLP4 100
+INDIRI4
+ADDRLP4 296
+INDIRI4
+NEGI4
+LTI4 $1461
+LABELV $1468
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1459
+LABELV $1458
+LABELV $1441
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+GEI4 $1469
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+LABELV $1469
+ADDRLP4 296
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LEI4 $1471
+ADDRGP4 $1473
+ARGP4
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1426
+JUMPV
+LABELV $1471
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1477
+JUMPV
+LABELV $1474
+ADDRLP4 316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1478
+ADDRLP4 316
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1478
+ADDRGP4 $1475
+JUMPV
+LABELV $1478
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1480
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 320
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1482
+ADDRGP4 $1475
+JUMPV
+LABELV $1482
+LABELV $1480
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1484
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1484
+ADDRGP4 $1475
+JUMPV
+LABELV $1484
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LEI4 $1486
+ADDRLP4 276
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $1486
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 280
+INDIRI4
+LEI4 $1488
+ADDRLP4 280
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $1488
+LABELV $1475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1477
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $1490
+ADDRLP4 100
+INDIRI4
+CNSTI4 10
+LTI4 $1474
+LABELV $1490
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1494
+JUMPV
+LABELV $1491
+ADDRLP4 316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1495
+ADDRLP4 316
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1495
+ADDRGP4 $1492
+JUMPV
+LABELV $1495
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1497
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 320
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1499
+ADDRGP4 $1492
+JUMPV
+LABELV $1499
+LABELV $1497
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1501
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1501
+ADDRGP4 $1492
+JUMPV
+LABELV $1501
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 155
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1506
+JUMPV
+LABELV $1503
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTU4 11
+LTU4 $1507
+ADDRGP4 $1505
+JUMPV
+LABELV $1507
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $1509
+ADDRGP4 $1505
+JUMPV
+LABELV $1509
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1504
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1506
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1512
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1503
+LABELV $1512
+LABELV $1505
+ADDRLP4 288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ARGI4
+ADDRLP4 244
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $1516
+JUMPV
+LABELV $1513
+ADDRLP4 336
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1517
+ADDRLP4 336
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1517
+ADDRLP4 340
+ADDRLP4 336
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1517
+ADDRLP4 340
+INDIRI4
+CNSTI4 48
+LTI4 $1517
+ADDRLP4 340
+INDIRI4
+CNSTI4 56
+GTI4 $1517
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1517
+LABELV $1514
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1516
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1513
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $1522
+JUMPV
+LABELV $1519
+ADDRLP4 348
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1523
+ADDRLP4 348
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1523
+ADDRLP4 352
+ADDRLP4 348
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1523
+ADDRLP4 352
+INDIRI4
+CNSTI4 48
+LTI4 $1523
+ADDRLP4 352
+INDIRI4
+CNSTI4 56
+GTI4 $1523
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1523
+LABELV $1520
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1522
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1519
+ADDRLP4 180
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1525
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRLP4 360
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRLP4 360
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 364
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1492
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1494
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $1526
+ADDRLP4 100
+INDIRI4
+CNSTI4 10
+LTI4 $1491
+LABELV $1526
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1529
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1527
+LABELV $1529
+ADDRGP4 $1530
+ARGP4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1533
+ADDRLP4 316
+ADDRGP4 $1531
+ASGNP4
+ADDRGP4 $1534
+JUMPV
+LABELV $1533
+ADDRLP4 316
+ADDRGP4 $701
+ASGNP4
+LABELV $1534
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1528
+JUMPV
+LABELV $1527
+ADDRGP4 $1535
+ARGP4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1537
+ADDRLP4 316
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1538
+JUMPV
+LABELV $1537
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+LABELV $1538
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1528
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $1539
+ADDRGP4 $1541
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 116
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1545
+ADDRLP4 316
+ADDRGP4 $1542
+ASGNP4
+ADDRGP4 $1546
+JUMPV
+LABELV $1545
+ADDRLP4 316
+ADDRGP4 $68
+ASGNP4
+LABELV $1546
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1547
+ADDRLP4 320
+ADDRLP4 116
+ASGNP4
+ADDRGP4 $1548
+JUMPV
+LABELV $1547
+ADDRLP4 320
+ADDRGP4 $68
+ASGNP4
+LABELV $1548
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1539
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1426
+endproc G_admin_showbans 368 32
+export G_admin_help
+proc G_admin_help 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1550
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1555
+JUMPV
+LABELV $1552
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1556
+ADDRGP4 $1559
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1556
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $1560
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1560
+LABELV $1553
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1555
+ADDRLP4 0
+INDIRI4
+ADDRGP4 adminNumCmds
+INDIRI4
+LTI4 $1552
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1565
+JUMPV
+LABELV $1562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 admin_command_permission
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1566
+ADDRGP4 $1563
+JUMPV
+LABELV $1566
+ADDRGP4 $1559
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $1568
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1568
+LABELV $1563
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1565
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $1570
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1562
+LABELV $1570
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1571
+ADDRGP4 $1573
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1574
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1549
+JUMPV
+LABELV $1550
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $1577
+ADDRLP4 32
+ADDRLP4 12+1
+ASGNP4
+ADDRGP4 $1578
+JUMPV
+LABELV $1577
+ADDRLP4 32
+ADDRLP4 12
+ASGNP4
+LABELV $1578
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1582
+JUMPV
+LABELV $1579
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1583
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1585
+ADDRGP4 $1588
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1549
+JUMPV
+LABELV $1585
+ADDRGP4 $1589
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1590
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1592
+ARGP4
+ADDRLP4 52
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 g_admin_cmds+16
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1594
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1549
+JUMPV
+LABELV $1583
+LABELV $1580
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1582
+ADDRLP4 0
+INDIRI4
+ADDRGP4 adminNumCmds
+INDIRI4
+LTI4 $1579
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1596
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1600
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 admin_command_permission
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1602
+ADDRGP4 $1588
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1549
+JUMPV
+LABELV $1602
+ADDRGP4 $1604
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1605
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1606
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1549
+JUMPV
+LABELV $1600
+LABELV $1597
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1599
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $1607
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1596
+LABELV $1607
+ADDRGP4 $1608
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1549
+endproc G_admin_help 64 12
+export G_admin_admintest
+proc G_admin_admintest 40 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1610
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1612
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1609
+JUMPV
+LABELV $1610
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1616
+JUMPV
+LABELV $1613
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1617
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1615
+JUMPV
+LABELV $1617
+LABELV $1614
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1616
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1619
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1613
+LABELV $1619
+LABELV $1615
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1620
+CNSTI4 0
+RETI4
+ADDRGP4 $1609
+JUMPV
+LABELV $1620
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1625
+JUMPV
+LABELV $1622
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1626
+ADDRGP4 $1623
+JUMPV
+LABELV $1626
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1628
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1624
+JUMPV
+LABELV $1628
+LABELV $1623
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1625
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $1630
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1622
+LABELV $1630
+LABELV $1624
+ADDRGP4 $1631
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1636
+ADDRLP4 24
+ADDRGP4 $1632
+ASGNP4
+ADDRGP4 $1637
+JUMPV
+LABELV $1636
+ADDRLP4 24
+ADDRGP4 $68
+ASGNP4
+LABELV $1637
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1638
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRGP4 $1639
+JUMPV
+LABELV $1638
+ADDRLP4 28
+ADDRGP4 $68
+ASGNP4
+LABELV $1639
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1640
+ADDRLP4 32
+ADDRGP4 $1420
+ASGNP4
+ADDRGP4 $1641
+JUMPV
+LABELV $1640
+ADDRLP4 32
+ADDRGP4 $68
+ASGNP4
+LABELV $1641
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1609
+endproc G_admin_admintest 40 24
+export G_admin_allready
+proc G_admin_allready 16 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+NEI4 $1643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1646
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1642
+JUMPV
+LABELV $1643
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1650
+JUMPV
+LABELV $1647
+ADDRLP4 0
+CNSTI4 2124
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1652
+ADDRGP4 $1648
+JUMPV
+LABELV $1652
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1654
+ADDRGP4 $1648
+JUMPV
+LABELV $1654
+ADDRLP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1648
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1650
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1647
+ADDRGP4 $1656
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1658
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1659
+JUMPV
+LABELV $1658
+ADDRLP4 8
+ADDRGP4 $443
+ASGNP4
+LABELV $1659
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1642
+endproc G_admin_allready 16 8
+export G_admin_cancelvote
+proc G_admin_cancelvote 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2404
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1661
+ADDRGP4 level+4480
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1661
+ADDRGP4 level+4480+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1661
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1667
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1660
+JUMPV
+LABELV $1661
+ADDRGP4 level+2416
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+2412
+CNSTI4 0
+ASGNI4
+ADDRGP4 CheckVote
+CALLV
+pop
+ADDRGP4 level+4496
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4488
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 level+4496+4
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4488+4
+CNSTI4 0
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 $1679
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1681
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1682
+JUMPV
+LABELV $1681
+ADDRLP4 4
+ADDRGP4 $443
+ASGNP4
+LABELV $1682
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1660
+endproc G_admin_cancelvote 12 8
+export G_admin_passvote
+proc G_admin_passvote 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2404
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1684
+ADDRGP4 level+4480
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1684
+ADDRGP4 level+4480+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1684
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1690
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1683
+JUMPV
+LABELV $1684
+ADDRGP4 level+2412
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+2416
+CNSTI4 0
+ASGNI4
+ADDRGP4 CheckVote
+CALLV
+pop
+ADDRGP4 level+4488
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4496
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 level+4488+4
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4496+4
+CNSTI4 0
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 $1702
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1704
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1705
+JUMPV
+LABELV $1704
+ADDRLP4 4
+ADDRGP4 $443
+ASGNP4
+LABELV $1705
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1683
+endproc G_admin_passvote 12 8
+export G_admin_spec999
+proc G_admin_spec999 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1710
+JUMPV
+LABELV $1707
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1712
+ADDRGP4 $1708
+JUMPV
+LABELV $1712
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1714
+ADDRGP4 $1708
+JUMPV
+LABELV $1714
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1716
+ADDRGP4 $1708
+JUMPV
+LABELV $1716
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+NEI4 $1718
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1720
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+ADDRGP4 $1721
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1723
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1724
+JUMPV
+LABELV $1723
+ADDRLP4 8
+ADDRGP4 $443
+ASGNP4
+LABELV $1724
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1718
+LABELV $1708
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1710
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1707
+CNSTI4 1
+RETI4
+LABELV $1706
+endproc G_admin_spec999 16 12
+export G_admin_rename
+proc G_admin_rename 2448 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 2340
+CNSTP4 0
+ASGNP4
+ADDRLP4 2412
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 2412
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $1726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1728
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1726
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2344
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 2416
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 2336
+ADDRLP4 2416
+INDIRP4
+ASGNP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 2336
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2344
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 2420
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 2408
+ADDRLP4 2420
+INDIRI4
+ASGNI4
+ADDRLP4 2420
+INDIRI4
+CNSTI4 1
+EQI4 $1729
+ADDRLP4 0
+ARGP4
+ADDRLP4 2408
+INDIRI4
+ARGI4
+ADDRLP4 1312
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1731
+ARGP4
+ADDRLP4 1312
+ARGP4
+ADDRLP4 2424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2424
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1729
+ADDRLP4 2340
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2340
+INDIRP4
+ARGP4
+ADDRLP4 2424
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 2424
+INDIRI4
+CNSTI4 0
+NEI4 $1732
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1734
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1732
+ADDRLP4 2340
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 1312
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2428
+ADDRGP4 G_admin_name_check
+CALLI4
+ASGNI4
+ADDRLP4 2428
+INDIRI4
+CNSTI4 0
+NEI4 $1735
+ADDRGP4 $1731
+ARGP4
+ADDRLP4 1312
+ARGP4
+ADDRLP4 2432
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2432
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1725
+JUMPV
+LABELV $1735
+ADDRLP4 2432
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1016
+ADDP4
+ASGNP4
+ADDRLP4 2432
+INDIRP4
+ADDRLP4 2432
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 2124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 2436
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2336
+ADDRLP4 2436
+INDIRP4
+ASGNP4
+ADDRLP4 2376
+ARGP4
+ADDRLP4 2336
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+ADDRGP4 $701
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $1737
+ARGP4
+ADDRLP4 2376
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1739
+ADDRLP4 2440
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1740
+JUMPV
+LABELV $1739
+ADDRLP4 2440
+ADDRGP4 $443
+ASGNP4
+LABELV $1740
+ADDRLP4 2440
+INDIRP4
+ARGP4
+ADDRLP4 2444
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 2444
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1725
+endproc G_admin_rename 2448 16
+lit
+align 1
+LABELV $1742
+byte 1 0
+skip 255
+export G_admin_restart
+code
+proc G_admin_restart 324 12
+ADDRLP4 0
+ADDRGP4 $1742
+INDIRB
+ASGNB 256
+ADDRLP4 256
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $1743
+ADDRGP4 $1745
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+LABELV $1743
+CNSTI4 2
+ARGI4
+ADDRGP4 $1746
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1747
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1749
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1750
+JUMPV
+LABELV $1749
+ADDRLP4 260
+ADDRGP4 $443
+ASGNP4
+LABELV $1750
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1741
+endproc G_admin_restart 324 12
+export G_admin_nextmap
+proc G_admin_nextmap 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1752
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1754
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1755
+JUMPV
+LABELV $1754
+ADDRLP4 0
+ADDRGP4 $443
+ASGNP4
+LABELV $1755
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1756
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1758
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1759
+JUMPV
+LABELV $1758
+ADDRLP4 8
+ADDRGP4 $443
+ASGNP4
+LABELV $1759
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1751
+endproc G_admin_nextmap 16 8
+lit
+align 1
+LABELV $1761
+byte 1 0
+skip 31
+align 1
+LABELV $1762
+byte 1 0
+skip 31
+align 1
+LABELV $1763
+byte 1 0
+skip 31
+export G_admin_namelog
+code
+proc G_admin_namelog 152 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $1761
+INDIRB
+ASGNB 32
+ADDRLP4 49
+ADDRGP4 $1762
+INDIRB
+ASGNB 32
+ADDRLP4 8
+ADDRGP4 $1763
+INDIRB
+ASGNB 32
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $1764
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 88
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 88
+ARGP4
+ADDRLP4 49
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+LABELV $1764
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1769
+JUMPV
+LABELV $1766
+ADDRLP4 88
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1770
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 $1775
+JUMPV
+LABELV $1772
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 49
+ARGP4
+ADDRLP4 132
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1776
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1774
+JUMPV
+LABELV $1776
+LABELV $1773
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1775
+ADDRLP4 136
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+GEI4 $1778
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1772
+LABELV $1778
+LABELV $1774
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $1779
+ADDRGP4 $1767
+JUMPV
+LABELV $1779
+LABELV $1770
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1781
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1782
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1781
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1785
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1092
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1785
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1789
+ADDRGP4 $1049
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRGP4 $1790
+JUMPV
+LABELV $1789
+ADDRLP4 132
+ADDRGP4 $1094
+ASGNP4
+LABELV $1790
+ADDRGP4 $1787
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1794
+JUMPV
+LABELV $1791
+ADDRGP4 $1795
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1792
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1794
+ADDRLP4 148
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 148
+INDIRI4
+GEI4 $1796
+ADDRLP4 0
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1791
+LABELV $1796
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1767
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1769
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1797
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1766
+LABELV $1797
+ADDRGP4 $1798
+ARGP4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1760
+endproc G_admin_namelog 152 16
+lit
+align 1
+LABELV $1800
+byte 1 0
+skip 1
+export G_admin_lock
+code
+proc G_admin_lock 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1800
+INDIRB
+ASGNB 2
+ADDRLP4 8
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1801
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1803
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1799
+JUMPV
+LABELV $1801
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_TeamFromString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1804
+ADDRGP4 level+9456
+INDIRI4
+CNSTI4 0
+EQI4 $1806
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1809
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1799
+JUMPV
+LABELV $1806
+ADDRGP4 level+9456
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1805
+JUMPV
+LABELV $1804
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1811
+ADDRGP4 level+9460
+INDIRI4
+CNSTI4 0
+EQI4 $1813
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1816
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1799
+JUMPV
+LABELV $1813
+ADDRGP4 level+9460
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1812
+JUMPV
+LABELV $1811
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1818
+ADDRGP4 level+9464
+INDIRI4
+CNSTI4 0
+EQI4 $1820
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1823
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1799
+JUMPV
+LABELV $1820
+ADDRGP4 level+9464
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1819
+JUMPV
+LABELV $1818
+ADDRGP4 $1825
+ARGP4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1799
+JUMPV
+LABELV $1819
+LABELV $1812
+LABELV $1805
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1826
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1828
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1829
+JUMPV
+LABELV $1828
+ADDRLP4 16
+ADDRGP4 $443
+ASGNP4
+LABELV $1829
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1799
+endproc G_admin_lock 28 12
+lit
+align 1
+LABELV $1831
+byte 1 0
+skip 1
+export G_admin_unlock
+code
+proc G_admin_unlock 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1831
+INDIRB
+ASGNB 2
+ADDRLP4 8
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1834
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1832
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_TeamFromString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1835
+ADDRGP4 level+9456
+INDIRI4
+CNSTI4 0
+NEI4 $1837
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1840
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1837
+ADDRGP4 level+9456
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1835
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1842
+ADDRGP4 level+9460
+INDIRI4
+CNSTI4 0
+NEI4 $1844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1847
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1844
+ADDRGP4 level+9460
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1843
+JUMPV
+LABELV $1842
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1849
+ADDRGP4 level+9464
+INDIRI4
+CNSTI4 0
+NEI4 $1851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1854
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1851
+ADDRGP4 level+9464
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1850
+JUMPV
+LABELV $1849
+ADDRGP4 $1856
+ARGP4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1850
+LABELV $1843
+LABELV $1836
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1857
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1859
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1860
+JUMPV
+LABELV $1859
+ADDRLP4 16
+ADDRGP4 $443
+ASGNP4
+LABELV $1860
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1830
+endproc G_admin_unlock 28 12
+export G_admin_disorient
+proc G_admin_disorient 1364 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1324
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1862
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1864
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1861
+JUMPV
+LABELV $1862
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1328
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1328
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1332
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 1332
+INDIRI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 1
+EQI4 $1865
+ADDRLP4 8
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRLP4 300
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1867
+ARGP4
+ADDRLP4 300
+ARGP4
+ADDRLP4 1336
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1336
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1861
+JUMPV
+LABELV $1865
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+NEI4 $1868
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1870
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1861
+JUMPV
+LABELV $1868
+ADDRLP4 1340
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 1
+EQI4 $1871
+ADDRLP4 1340
+INDIRI4
+CNSTI4 2
+EQI4 $1871
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+EQI4 $1871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1873
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1861
+JUMPV
+LABELV $1871
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1874
+ADDRGP4 $1876
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1861
+JUMPV
+LABELV $1874
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1877
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1878
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1884
+ADDRLP4 1348
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1885
+JUMPV
+LABELV $1884
+ADDRLP4 1348
+ADDRGP4 $1879
+ASGNP4
+LABELV $1885
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1886
+ADDRLP4 1352
+ADDRGP4 $1881
+ASGNP4
+ADDRGP4 $1887
+JUMPV
+LABELV $1886
+ADDRLP4 1352
+ADDRGP4 $68
+ASGNP4
+LABELV $1887
+ADDRLP4 1352
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1888
+ADDRLP4 1356
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1889
+JUMPV
+LABELV $1888
+ADDRLP4 1356
+ADDRGP4 $68
+ASGNP4
+LABELV $1889
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1861
+endproc G_admin_disorient 1364 16
+export G_admin_orient
+proc G_admin_orient 1340 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1320
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1893
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1890
+JUMPV
+LABELV $1891
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1324
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 1324
+INDIRI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 1
+EQI4 $1894
+ADDRLP4 4
+ARGP4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1896
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1890
+JUMPV
+LABELV $1894
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1897
+ADDRGP4 $1899
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1890
+JUMPV
+LABELV $1897
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1900
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1901
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1903
+ADDRLP4 1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1904
+JUMPV
+LABELV $1903
+ADDRLP4 1332
+ADDRGP4 $1879
+ASGNP4
+LABELV $1904
+ADDRLP4 1332
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1336
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1890
+endproc G_admin_orient 1340 16
+export G_admin_slap
+proc G_admin_slap 1380 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1336
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1906
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1908
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1905
+JUMPV
+LABELV $1906
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 268
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 300
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 300
+ARGP4
+ADDRLP4 1340
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1909
+ADDRLP4 4
+CNSTI4 25
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1344
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1344
+INDIRP4
+ASGNP4
+ADDRGP4 $1910
+JUMPV
+LABELV $1909
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 1344
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1344
+INDIRP4
+ASGNP4
+LABELV $1910
+ADDRLP4 268
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1344
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 1344
+INDIRI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 1
+EQI4 $1911
+ADDRLP4 12
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1913
+ARGP4
+ADDRLP4 312
+ARGP4
+ADDRLP4 1348
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1905
+JUMPV
+LABELV $1911
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1348
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $1914
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1916
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1905
+JUMPV
+LABELV $1914
+ADDRLP4 1352
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 1
+EQI4 $1917
+ADDRLP4 1352
+INDIRI4
+CNSTI4 2
+EQI4 $1917
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+EQI4 $1917
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1919
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1905
+JUMPV
+LABELV $1917
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $1920
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $1922
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+CNSTP4 0
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1360
+CNSTP4 0
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+CNSTI4 500
+ARGI4
+ADDRLP4 1364
+CNSTI4 0
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+ARGI4
+ADDRLP4 1364
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $1922
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+LABELV $1920
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1924
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1925
+JUMPV
+LABELV $1924
+ADDRLP4 1356
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ADDRLP4 1356
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1925
+ADDRGP4 $1926
+ARGP4
+ADDRLP4 1356
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 1356
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 304
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+ADDRGP4 $1927
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1928
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1932
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1933
+JUMPV
+LABELV $1932
+ADDRLP4 1364
+ADDRGP4 $1879
+ASGNP4
+LABELV $1933
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1934
+ADDRLP4 1368
+ADDRGP4 $1881
+ASGNP4
+ADDRGP4 $1935
+JUMPV
+LABELV $1934
+ADDRLP4 1368
+ADDRGP4 $68
+ASGNP4
+LABELV $1935
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1936
+ADDRLP4 1372
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $1937
+JUMPV
+LABELV $1936
+ADDRLP4 1372
+ADDRGP4 $68
+ASGNP4
+LABELV $1937
+ADDRLP4 1372
+INDIRP4
+ARGP4
+ADDRLP4 1376
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1905
+endproc G_admin_slap 1380 32
+export G_admin_warn_check
+proc G_admin_warn_check 32 8
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 945
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1939
+CNSTI4 0
+RETI4
+ADDRGP4 $1938
+JUMPV
+LABELV $1939
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1941
+CNSTI4 0
+RETI4
+ADDRGP4 $1938
+JUMPV
+LABELV $1941
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1946
+JUMPV
+LABELV $1943
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1947
+ADDRGP4 $1944
+JUMPV
+LABELV $1947
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1951
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1949
+LABELV $1951
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1949
+LABELV $1944
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1946
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1952
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1943
+LABELV $1952
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $1938
+endproc G_admin_warn_check 32 8
+export G_admin_warn
+proc G_admin_warn 1460 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1404
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+CNSTI4 0
+EQI4 $1954
+ADDRLP4 300
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1955
+JUMPV
+LABELV $1954
+ADDRLP4 300
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1955
+ADDRLP4 1408
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 300
+INDIRI4
+GEI4 $1956
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1958
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1956
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 336
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1412
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 g_warningExpire+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1416
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 372
+ADDRLP4 1416
+INDIRI4
+ASGNI4
+ADDRLP4 1416
+INDIRI4
+CNSTI4 1
+EQI4 $1960
+ADDRLP4 44
+ARGP4
+ADDRLP4 372
+INDIRI4
+ARGI4
+ADDRLP4 376
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1962
+ARGP4
+ADDRLP4 376
+ARGP4
+ADDRLP4 1420
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1420
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1960
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1420
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 0
+NEI4 $1963
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1916
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1963
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1966
+ADDRLP4 1424
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1967
+JUMPV
+LABELV $1966
+ADDRLP4 1424
+CNSTI4 -1
+ASGNI4
+LABELV $1967
+ADDRLP4 1424
+INDIRI4
+ARGI4
+ADDRLP4 304
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1428
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1428
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1428
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1428
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 admin_create_warning
+CALLI4
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1968
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1971
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1969
+JUMPV
+LABELV $1968
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1969
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1432
+ADDRGP4 G_admin_warn_check
+CALLI4
+ASGNI4
+ADDRLP4 1400
+ADDRLP4 1432
+INDIRI4
+ASGNI4
+ADDRGP4 $1972
+ARGP4
+ADDRLP4 1436
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 368
+ADDRLP4 1436
+INDIRI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+ARGI4
+ADDRGP4 G_GlobalSound
+CALLV
+pop
+ADDRGP4 g_maxWarnings+12
+INDIRI4
+CNSTI4 0
+EQI4 $1973
+ADDRLP4 1400
+INDIRI4
+ADDRGP4 g_maxWarnings+12
+INDIRI4
+LTI4 $1976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1440
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1979
+ARGP4
+ADDRGP4 admin_create_ban
+CALLI4
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1980
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1980
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1985
+ADDRGP4 $995
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1444
+ADDRLP4 1448
+INDIRP4
+ASGNP4
+ADDRGP4 $1986
+JUMPV
+LABELV $1985
+ADDRLP4 1444
+ADDRGP4 $1983
+ASGNP4
+LABELV $1986
+ADDRGP4 $994
+ARGP4
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRGP4 $1979
+ARGP4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1002
+ARGP4
+ADDRGP4 $1987
+ARGP4
+ADDRGP4 $1979
+ARGP4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1976
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1440
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1440
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1989
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1993
+ADDRLP4 1444
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1994
+JUMPV
+LABELV $1993
+ADDRLP4 1444
+ADDRGP4 $1879
+ASGNP4
+LABELV $1994
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1995
+ADDRLP4 1448
+ADDRGP4 $1881
+ASGNP4
+ADDRGP4 $1996
+JUMPV
+LABELV $1995
+ADDRLP4 1448
+ADDRGP4 $68
+ASGNP4
+LABELV $1996
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1997
+ADDRLP4 1452
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $1998
+JUMPV
+LABELV $1997
+ADDRLP4 1452
+ADDRGP4 $68
+ASGNP4
+LABELV $1998
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1973
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1440
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1440
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1989
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2002
+ADDRLP4 1444
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $2003
+JUMPV
+LABELV $2002
+ADDRLP4 1444
+ADDRGP4 $1879
+ASGNP4
+LABELV $2003
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2004
+ADDRLP4 1448
+ADDRGP4 $1881
+ASGNP4
+ADDRGP4 $2005
+JUMPV
+LABELV $2004
+ADDRLP4 1448
+ADDRGP4 $68
+ASGNP4
+LABELV $2005
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2006
+ADDRLP4 1452
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $2007
+JUMPV
+LABELV $2006
+ADDRLP4 1452
+ADDRGP4 $68
+ASGNP4
+LABELV $2007
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1953
+endproc G_admin_warn 1460 24
+export G_admin_shuffle
+proc G_admin_shuffle 8 8
+CNSTI4 2
+ARGI4
+ADDRGP4 $143
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $2009
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2011
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $2012
+JUMPV
+LABELV $2011
+ADDRLP4 0
+ADDRGP4 $443
+ASGNP4
+LABELV $2012
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2008
+endproc G_admin_shuffle 8 8
+export G_admin_print
+proc G_admin_print 1032 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2014
+ADDRGP4 $2017
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level+4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $2015
+JUMPV
+LABELV $2014
+ADDRGP4 $2020
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $2018
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_DecolorString
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $2019
+JUMPV
+LABELV $2018
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $2019
+LABELV $2015
+LABELV $2013
+endproc G_admin_print 1032 12
+export G_admin_buffer_begin
+proc G_admin_buffer_begin 0 0
+ADDRGP4 g_bfb
+CNSTI1 0
+ASGNI1
+LABELV $2021
+endproc G_admin_buffer_begin 0 0
+export G_admin_buffer_end
+proc G_admin_buffer_end 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 g_bfb
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+LABELV $2022
+endproc G_admin_buffer_end 0 8
+export G_admin_buffer_print
+proc G_admin_buffer_print 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 g_bfb
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 1009
+LTI4 $2024
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 g_bfb
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_bfb
+CNSTI1 0
+ASGNI1
+LABELV $2024
+ADDRGP4 g_bfb
+ARGP4
+CNSTI4 32000
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $2023
+endproc G_admin_buffer_print 8 12
+export G_admin_cleanup
+proc G_admin_cleanup 20 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2030
+JUMPV
+LABELV $2027
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2028
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2030
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $2031
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2027
+LABELV $2031
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2035
+JUMPV
+LABELV $2032
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2033
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2035
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $2036
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2032
+LABELV $2036
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2040
+JUMPV
+LABELV $2037
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2038
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2040
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $2041
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2037
+LABELV $2041
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2045
+JUMPV
+LABELV $2042
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2043
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2045
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $2046
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2042
+LABELV $2046
+LABELV $2026
+endproc G_admin_cleanup 20 4
+bss
+export g_admin_warnings
+align 4
+LABELV g_admin_warnings
+skip 4096
+export g_admin_namelog
+align 4
+LABELV g_admin_namelog
+skip 512
+export g_admin_commands
+align 4
+LABELV g_admin_commands
+skip 256
+export g_admin_bans
+align 4
+LABELV g_admin_bans
+skip 4096
+export g_admin_admins
+align 4
+LABELV g_admin_admins
+skip 4096
+export g_admin_levels
+align 4
+LABELV g_admin_levels
+skip 128
+align 1
+LABELV g_bfb
+skip 32000
+import monster_die
+import MapInfoPrint
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_blueteam
+import g_redteam
+import g_singlePlayer
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2020
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2017
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $2009
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1989
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1988
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1987
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 45
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1983
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $1979
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1972
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1971
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1962
+byte 1 94
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1958
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 124
+byte 1 105
+byte 1 112
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1928
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1927
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1926
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1919
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $1916
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 0
+align 1
+LABELV $1913
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1908
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $1901
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 34
+byte 1 0
+align 1
+LABELV $1900
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1899
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1896
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1893
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 0
+align 1
+LABELV $1881
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1879
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 69
+byte 1 0
+align 1
+LABELV $1878
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1877
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1876
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1873
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1870
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 0
+align 1
+LABELV $1867
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1864
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $1857
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1856
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 34
+byte 1 37
+byte 1 99
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1854
+byte 1 94
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1847
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1840
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1834
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 124
+byte 1 98
+byte 1 124
+byte 1 102
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1826
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1825
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 34
+byte 1 37
+byte 1 99
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1823
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1816
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1809
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1803
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 124
+byte 1 98
+byte 1 124
+byte 1 102
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1798
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1795
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 0
+align 1
+LABELV $1787
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 53
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $1756
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1752
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1747
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1746
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1745
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1737
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1734
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1731
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1728
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1721
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1720
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1702
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1690
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1679
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1667
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1656
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 89
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1646
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1632
+byte 1 40
+byte 1 0
+align 1
+LABELV $1631
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1612
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1608
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1606
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1605
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1604
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1594
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1592
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1590
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1589
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1588
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1574
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1573
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1559
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 0
+align 1
+LABELV $1542
+byte 1 32
+byte 1 0
+align 1
+LABELV $1541
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1535
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $1531
+byte 1 73
+byte 1 80
+byte 1 0
+align 1
+LABELV $1530
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1525
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 53
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 56
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 48
+byte 1 115
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 92
+byte 1 95
+byte 1 95
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1473
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1440
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1420
+byte 1 41
+byte 1 0
+align 1
+LABELV $1418
+byte 1 40
+byte 1 97
+byte 1 46
+byte 1 107
+byte 1 46
+byte 1 97
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $1417
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 49
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1384
+byte 1 94
+byte 1 53
+byte 1 0
+align 1
+LABELV $1381
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $1378
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $1377
+byte 1 70
+byte 1 0
+align 1
+LABELV $1374
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $1373
+byte 1 82
+byte 1 0
+align 1
+LABELV $1370
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $1361
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1356
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1347
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1346
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1343
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1322
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1306
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1305
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 49
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 39
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 0
+align 1
+LABELV $1304
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1298
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1297
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 49
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 0
+align 1
+LABELV $1296
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1291
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1288
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1285
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1276
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1274
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1273
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1272
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $1269
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 91
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1262
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1259
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1256
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1253
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1250
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 124
+byte 1 97
+byte 1 124
+byte 1 115
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1232
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $1230
+byte 1 44
+byte 1 32
+byte 1 0
+align 1
+LABELV $1228
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $1226
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 35
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1216
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1211
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1204
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1190
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1185
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1181
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 10
+byte 1 0
+align 1
+LABELV $1175
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1163
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 35
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1160
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1154
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1150
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 10
+byte 1 0
+align 1
+LABELV $1144
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1134
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1127
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1120
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1117
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1113
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1106
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1105
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1102
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1094
+byte 1 45
+byte 1 0
+align 1
+LABELV $1093
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 53
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1092
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $1075
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1072
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1049
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1036
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1031
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1026
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1020
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 124
+byte 1 105
+byte 1 112
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1003
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1002
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 46
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $995
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $994
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $987
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $985
+byte 1 49
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $984
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $981
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $978
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $975
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $942
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $934
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $919
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $911
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $899
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $895
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $886
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $885
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $873
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $870
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $867
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $832
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $820
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $807
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $798
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $780
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $779
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $778
+byte 1 91
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $777
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $770
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $759
+byte 1 91
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $752
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $749
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $746
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $743
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $738
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $737
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $734
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $731
+byte 1 109
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $728
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $717
+byte 1 91
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $712
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $705
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $704
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $701
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $698
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $691
+byte 1 91
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 93
+byte 1 0
+align 1
+LABELV $686
+byte 1 91
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $681
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $676
+byte 1 91
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $671
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 0
+align 1
+LABELV $661
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $657
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $645
+byte 1 71
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $597
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $582
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $581
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $574
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $571
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $561
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $558
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $554
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $553
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $550
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $547
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 0
+align 1
+LABELV $544
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $541
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $538
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 78
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $493
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $491
+byte 1 37
+byte 1 42
+byte 1 115
+byte 1 0
+align 1
+LABELV $451
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $443
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $441
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 0
+align 1
+LABELV $439
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $438
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $413
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $379
+byte 1 42
+byte 1 0
+align 1
+LABELV $377
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $375
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 112
+byte 1 80
+byte 1 119
+byte 1 114
+byte 1 107
+byte 1 109
+byte 1 102
+byte 1 75
+byte 1 110
+byte 1 99
+byte 1 78
+byte 1 63
+byte 1 77
+byte 1 86
+byte 1 100
+byte 1 66
+byte 1 98
+byte 1 101
+byte 1 68
+byte 1 83
+byte 1 53
+byte 1 49
+byte 1 0
+align 1
+LABELV $373
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $371
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 112
+byte 1 80
+byte 1 119
+byte 1 114
+byte 1 107
+byte 1 109
+byte 1 102
+byte 1 75
+byte 1 110
+byte 1 99
+byte 1 78
+byte 1 63
+byte 1 0
+align 1
+LABELV $369
+byte 1 94
+byte 1 50
+byte 1 74
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $367
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 112
+byte 1 80
+byte 1 119
+byte 1 114
+byte 1 0
+align 1
+LABELV $365
+byte 1 94
+byte 1 54
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $363
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 0
+align 1
+LABELV $361
+byte 1 94
+byte 1 53
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $359
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 0
+align 1
+LABELV $358
+byte 1 94
+byte 1 52
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $346
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $345
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $344
+byte 1 91
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $336
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $331
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $330
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $329
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $328
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $327
+byte 1 91
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $321
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $320
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $319
+byte 1 109
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $318
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $317
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $316
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $308
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $307
+byte 1 91
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $299
+byte 1 10
+byte 1 0
+align 1
+LABELV $298
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $297
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $296
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $295
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $289
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $285
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $270
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $252
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $240
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $228
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $166
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $165
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $164
+byte 1 119
+byte 1 0
+align 1
+LABELV $163
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $162
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $161
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $160
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $159
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $158
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $157
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $156
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $155
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 67
+byte 1 0
+align 1
+LABELV $153
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $152
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $151
+byte 1 80
+byte 1 0
+align 1
+LABELV $150
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 0
+align 1
+LABELV $149
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $148
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $147
+byte 1 83
+byte 1 0
+align 1
+LABELV $146
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $145
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $144
+byte 1 102
+byte 1 0
+align 1
+LABELV $143
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $142
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 73
+byte 1 80
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $141
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 40
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 41
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $140
+byte 1 66
+byte 1 0
+align 1
+LABELV $139
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $138
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 124
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $137
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $136
+byte 1 115
+byte 1 0
+align 1
+LABELV $135
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $134
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 40
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 41
+byte 1 0
+align 1
+LABELV $133
+byte 1 114
+byte 1 0
+align 1
+LABELV $132
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $131
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $130
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $129
+byte 1 78
+byte 1 0
+align 1
+LABELV $128
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $127
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $126
+byte 1 71
+byte 1 0
+align 1
+LABELV $125
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 0
+align 1
+LABELV $124
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 104
+byte 1 124
+byte 1 97
+byte 1 124
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $123
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $122
+byte 1 112
+byte 1 0
+align 1
+LABELV $121
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $120
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $119
+byte 1 86
+byte 1 0
+align 1
+LABELV $118
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $117
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 102
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 33
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $116
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $115
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $114
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $112
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $111
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $110
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $108
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $106
+byte 1 109
+byte 1 0
+align 1
+LABELV $105
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $104
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $103
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $102
+byte 1 77
+byte 1 0
+align 1
+LABELV $101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $100
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 97
+byte 1 124
+byte 1 104
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $99
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $98
+byte 1 75
+byte 1 0
+align 1
+LABELV $97
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $96
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $95
+byte 1 105
+byte 1 0
+align 1
+LABELV $94
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $93
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $92
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $91
+byte 1 68
+byte 1 0
+align 1
+LABELV $90
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $89
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $88
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $87
+byte 1 107
+byte 1 0
+align 1
+LABELV $86
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $85
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $84
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $83
+byte 1 104
+byte 1 0
+align 1
+LABELV $82
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 0
+align 1
+LABELV $81
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $80
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $79
+byte 1 100
+byte 1 0
+align 1
+LABELV $78
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $76
+byte 1 99
+byte 1 0
+align 1
+LABELV $75
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $74
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 124
+byte 1 73
+byte 1 80
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $73
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 39
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 104
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 109
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $72
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $70
+byte 1 121
+byte 1 0
+align 1
+LABELV $69
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $68
+byte 1 0
+align 1
+LABELV $67
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $66
+byte 1 97
+byte 1 0
+align 1
+LABELV $65
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $64
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $63
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 39
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 104
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 109
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 45
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $62
+byte 1 98
+byte 1 0
+align 1
+LABELV $61
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 0
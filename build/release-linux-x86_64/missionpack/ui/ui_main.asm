@@ -0,0 +1,47703 @@
+data
+align 4
+LABELV MonthAbbrev
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+address $101
+address $102
+align 4
+LABELV skillLevels
+address $103
+address $104
+address $105
+address $106
+address $107
+lit
+align 4
+LABELV numSkillLevels
+byte 4 5
+data
+align 4
+LABELV netSources
+address $108
+address $109
+address $110
+address $111
+lit
+align 4
+LABELV numNetSources
+byte 4 4
+align 4
+LABELV serverFilters
+address $112
+address $109
+address $113
+address $109
+address $114
+address $115
+address $116
+address $117
+address $118
+address $119
+address $120
+address $121
+address $122
+address $123
+data
+align 4
+LABELV teamArenaGameTypes
+address $124
+address $125
+address $126
+address $127
+address $128
+address $129
+address $130
+address $131
+address $132
+address $133
+address $134
+address $135
+address $136
+lit
+align 4
+LABELV numTeamArenaGameTypes
+byte 4 13
+align 4
+LABELV numServerFilters
+byte 4 7
+data
+align 4
+LABELV netnames
+address $137
+address $138
+byte 4 0
+align 4
+LABELV gamecodetoui
+byte 4 4
+byte 4 2
+byte 4 3
+byte 4 0
+byte 4 5
+byte 4 1
+byte 4 6
+align 4
+LABELV uitogamecode
+byte 4 4
+byte 4 6
+byte 4 2
+byte 4 3
+byte 4 1
+byte 4 5
+byte 4 7
+export vmMain
+code
+proc vmMain 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $153
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $153
+address $142
+address $143
+address $144
+address $145
+address $146
+address $147
+address $148
+address $149
+address $150
+address $151
+address $152
+code
+LABELV $142
+CNSTI4 6
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $143
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 _UI_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $144
+ADDRGP4 _UI_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $145
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 _UI_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $146
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 _UI_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $147
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 _UI_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $148
+ADDRLP4 4
+ADDRGP4 _UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $149
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 _UI_SetActiveMenu
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $151
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $152
+CNSTI4 1
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $140
+CNSTI4 -1
+RETI4
+LABELV $139
+endproc vmMain 12 8
+export AssetCache
+proc AssetCache 128 8
+ADDRGP4 $157
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61704
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61856
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $183
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61724
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61728
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61732
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61712
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61708
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61716
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61720
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61736
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61752
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61756
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61760
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61764
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61768
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61780
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61784
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $230
+ADDRGP4 $236
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+228+61888
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $230
+ADDRGP4 $238
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+565664
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $241
+ARGP4
+ADDRLP4 104
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+228+8
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 108
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+228+12
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 112
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+228+16
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 116
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+228+20
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 120
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+228+24
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 124
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+228+28
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+228+32
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 uiInfo+228+36
+CNSTF4 1119879168
+ASGNF4
+ADDRGP4 uiInfo+228+40
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 uiInfo+228+44
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 uiInfo+228+48
+CNSTF4 1101004800
+ASGNF4
+ADDRGP4 uiInfo+228+61772
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 uiInfo+228+61776
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 uiInfo+228+61788
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 uiInfo+228+61792
+CNSTF4 1098907648
+ASGNF4
+LABELV $154
+endproc AssetCache 128 8
+export _UI_DrawSides
+proc _UI_DrawSides 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 uiInfo+200
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $275
+endproc _UI_DrawSides 12 36
+export _UI_DrawTopBottom
+proc _UI_DrawTopBottom 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 uiInfo+196
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $279
+endproc _UI_DrawTopBottom 12 36
+export _UI_DrawRect
+proc _UI_DrawRect 0 20
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 _UI_DrawTopBottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 _UI_DrawSides
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $283
+endproc _UI_DrawRect 0 20
+export Text_Width
+proc Text_Width 52 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 uiInfo+228+56
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $287
+ADDRLP4 12
+ADDRGP4 uiInfo+228+20604
+ASGNP4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $292
+ADDRLP4 12
+ADDRGP4 uiInfo+228+41152
+ASGNP4
+LABELV $292
+LABELV $288
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $299
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $299
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $299
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $304
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $304
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $304
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+GTI4 $304
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $304
+ADDRLP4 16
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $302
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $307
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $307
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $301
+LABELV $307
+LABELV $297
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $284
+endproc Text_Width 52 4
+export Text_Height
+proc Text_Height 48 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 uiInfo+228+56
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $311
+ADDRLP4 20
+ADDRGP4 uiInfo+228+20604
+ASGNP4
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRFP4 4
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $316
+ADDRLP4 20
+ADDRGP4 uiInfo+228+41152
+ASGNP4
+LABELV $316
+LABELV $312
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $323
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $323
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $323
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $328
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $328
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $328
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+GTI4 $328
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $326
+JUMPV
+LABELV $328
+ADDRLP4 12
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+GEF4 $330
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $330
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $326
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $333
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $333
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $325
+LABELV $333
+LABELV $321
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $308
+endproc Text_Height 48 4
+export Text_PaintChar
+proc Text_PaintChar 12 36
+ADDRLP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $334
+endproc Text_PaintChar 12 36
+export Text_Paint
+proc Text_Paint 184 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 uiInfo+228+56
+ASGNP4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $338
+ADDRLP4 28
+ADDRGP4 uiInfo+228+20604
+ASGNP4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $343
+ADDRLP4 28
+ADDRGP4 uiInfo+228+41152
+ASGNP4
+LABELV $343
+LABELV $339
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $348
+ADDRLP4 36
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LEI4 $350
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $350
+ADDRLP4 32
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $350
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $355
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $355
+ADDRLP4 52
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRLP4 52
+INDIRI4
+CNSTI4 48
+LTI4 $355
+ADDRLP4 52
+INDIRI4
+CNSTI4 56
+GTI4 $355
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $353
+JUMPV
+LABELV $355
+ADDRLP4 56
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $360
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $358
+LABELV $360
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $362
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+LABELV $363
+ADDRLP4 64
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 colorBlack+12
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRFP4 28
+INDIRI4
+CNSTI4 7
+NEI4 $367
+ADDRLP4 128
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 64
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+12
+CNSTF4 1045220557
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 4+4
+INDIRF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 4+8
+INDIRF4
+ASGNF4
+ADDRLP4 80+12
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+CNSTF4 1069547520
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1065353216
+LEF4 $382
+ADDRLP4 132
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 132
+CNSTF4 1069547520
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $383
+ADDRLP4 96
+ADDRLP4 132
+INDIRF4
+ASGNF4
+CNSTF4 1069547520
+ADDRLP4 4+4
+INDIRF4
+MULF4
+CNSTF4 1065353216
+LEF4 $388
+ADDRLP4 136
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 136
+CNSTF4 1069547520
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $389
+ADDRLP4 96+4
+ADDRLP4 136
+INDIRF4
+ASGNF4
+CNSTF4 1069547520
+ADDRLP4 4+8
+INDIRF4
+MULF4
+CNSTF4 1065353216
+LEF4 $394
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 140
+CNSTF4 1069547520
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $395
+ADDRLP4 96+8
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 96+12
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 112+12
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 148
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 156
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 160
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 172
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 180
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 112
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $367
+LABELV $359
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $353
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $402
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $402
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $352
+LABELV $402
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $348
+LABELV $335
+endproc Text_Paint 184 40
+export Text_PaintWithCursor
+proc Text_PaintWithCursor 84 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 uiInfo+228+56
+ASGNP4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $406
+ADDRLP4 36
+ADDRGP4 uiInfo+228+20604
+ASGNP4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRFP4 8
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $411
+ADDRLP4 36
+ADDRGP4 uiInfo+228+41152
+ASGNP4
+LABELV $411
+LABELV $407
+ADDRLP4 4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $416
+ADDRLP4 44
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LEI4 $418
+ADDRLP4 40
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $418
+ADDRLP4 40
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $418
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ADDRFP4 24
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $423
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $423
+ADDRLP4 60
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 60
+INDIRI4
+CNSTI4 48
+LTI4 $423
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+GTI4 $423
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $421
+JUMPV
+LABELV $423
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 32
+INDIRI4
+CNSTI4 3
+EQI4 $428
+ADDRFP4 32
+INDIRI4
+CNSTI4 6
+NEI4 $426
+LABELV $428
+ADDRFP4 32
+INDIRI4
+CNSTI4 3
+NEI4 $430
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+LABELV $431
+ADDRLP4 68
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 colorBlack+12
+ADDRLP4 12+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 76
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $426
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEI4 $435
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $435
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+LABELV $435
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $421
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $439
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $439
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $420
+LABELV $439
+ADDRFP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $440
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $440
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+LABELV $440
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $416
+LABELV $403
+endproc Text_PaintWithCursor 84 40
+proc Text_Paint_Limit 76 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $444
+ADDRLP4 28
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 uiInfo+228+56
+ASGNP4
+ADDRFP4 12
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $448
+ADDRLP4 36
+ADDRGP4 uiInfo+228+20604
+ASGNP4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRFP4 12
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LEF4 $453
+ADDRLP4 36
+ADDRGP4 uiInfo+228+41152
+ASGNP4
+LABELV $453
+LABELV $449
+ADDRLP4 32
+ADDRFP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $458
+ADDRLP4 24
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $458
+ADDRLP4 24
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $458
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $463
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $463
+ADDRLP4 56
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRLP4 56
+INDIRI4
+CNSTI4 48
+LTI4 $463
+ADDRLP4 56
+INDIRI4
+CNSTI4 56
+GTI4 $463
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $461
+JUMPV
+LABELV $463
+ADDRLP4 60
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+LEF4 $466
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $462
+JUMPV
+LABELV $466
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintChar
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $461
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $469
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $469
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $460
+LABELV $469
+LABELV $462
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $444
+LABELV $443
+endproc Text_Paint_Limit 76 40
+export UI_ShowPostGame
+proc UI_ShowPostGame 0 8
+ADDRGP4 $471
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uiInfo+73524
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRGP4 _UI_SetActiveMenu
+CALLV
+pop
+LABELV $470
+endproc UI_ShowPostGame 0 8
+export UI_DrawCenteredPic
+proc UI_DrawCenteredPic 20 20
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+CNSTI4 640
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 480
+ADDRLP4 16
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $475
+endproc UI_DrawCenteredPic 20 20
+data
+export frameCount
+align 4
+LABELV frameCount
+byte 4 0
+bss
+align 4
+LABELV $477
+skip 4
+align 4
+LABELV $478
+skip 16
+export _UI_Refresh
+code
+proc _UI_Refresh 24 20
+ADDRGP4 uiInfo+212
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uiInfo+208
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $477
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $478
+ADDP4
+ADDRGP4 uiInfo+212
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 $477
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $483
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $485
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $478
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $486
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $485
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $489
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $489
+ADDRGP4 uiInfo+73500
+CNSTI4 4000
+ADDRLP4 8
+INDIRI4
+DIVI4
+CVIF4 4
+ASGNF4
+LABELV $483
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $492
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 Menu_PaintEnd
+CALLV
+pop
+ADDRGP4 UI_DoServerRefresh
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildFindPlayerList
+CALLV
+pop
+LABELV $492
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $494
+ADDRGP4 $496
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $494
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRGP4 uiInfo+216
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+228+61700
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $494
+ADDRGP4 uiInfo+224
+INDIRI4
+CNSTI4 0
+EQI4 $501
+LABELV $501
+LABELV $476
+endproc _UI_Refresh 24 20
+export _UI_Shutdown
+proc _UI_Shutdown 0 0
+ADDRGP4 trap_LAN_SaveCachedServers
+CALLV
+pop
+LABELV $504
+endproc _UI_Shutdown 0 0
+data
+export defaultMenu
+align 4
+LABELV defaultMenu
+byte 4 0
+bss
+align 1
+LABELV $506
+skip 32768
+export GetMenuBuffer
+code
+proc GetMenuBuffer 16 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $507
+ADDRGP4 $509
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 defaultMenu
+INDIRP4
+RETP4
+ADDRGP4 $505
+JUMPV
+LABELV $507
+ADDRLP4 0
+INDIRI4
+CNSTI4 32768
+LTI4 $510
+ADDRGP4 $512
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 defaultMenu
+INDIRP4
+RETP4
+ADDRGP4 $505
+JUMPV
+LABELV $510
+ADDRGP4 $506
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $506
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $506
+RETP4
+LABELV $505
+endproc GetMenuBuffer 16 16
+export Asset_Parse
+proc Asset_Parse 1272 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $514
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $514
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $520
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1040
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $523
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $523
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $525
+CNSTI4 1
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $525
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $529
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $535
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $533
+LABELV $535
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $533
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+56
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 uiInfo+228+61852
+CNSTI4 1
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $529
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $540
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $544
+LABELV $546
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $544
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+20604
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $521
+JUMPV
+LABELV $540
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $549
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $553
+LABELV $555
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $553
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+41152
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRGP4 $521
+JUMPV
+LABELV $549
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $558
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $562
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $562
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61704
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $558
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $566
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $570
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $570
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61796
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $566
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $577
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $574
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $578
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $578
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61800
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $574
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $585
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $582
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $586
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $586
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61808
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $582
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $590
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $594
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $594
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61804
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $590
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $601
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $602
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $602
+ADDRGP4 uiInfo+228+4
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61700
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $598
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $613
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $610
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61812
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $610
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $618
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61816
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $618
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $629
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $626
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61820
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $626
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $637
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $634
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61824
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $634
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $645
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $642
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61828
+ARGP4
+ADDRLP4 1116
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $642
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $653
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $650
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61832
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $654
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $654
+ADDRGP4 uiInfo+228+61848
+ADDRGP4 uiInfo+228+61832+12
+INDIRF4
+ASGNF4
+ADDRGP4 $521
+JUMPV
+LABELV $650
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $666
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $663
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+8
+ARGP4
+ADDRLP4 1124
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $663
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $671
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+12
+ARGP4
+ADDRLP4 1128
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $671
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $682
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $679
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+16
+ARGP4
+ADDRLP4 1132
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $679
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $690
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $687
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+20
+ARGP4
+ADDRLP4 1136
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $687
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $698
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $695
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+24
+ARGP4
+ADDRLP4 1140
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $695
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $706
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $703
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+28
+ARGP4
+ADDRLP4 1144
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $703
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $711
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+32
+ARGP4
+ADDRLP4 1148
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $711
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $722
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $719
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+36
+ARGP4
+ADDRLP4 1152
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $719
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $730
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $727
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+40
+ARGP4
+ADDRLP4 1156
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $727
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $738
+ARGP4
+ADDRLP4 1156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $735
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+44
+ARGP4
+ADDRLP4 1160
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $735
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $746
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $743
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+48
+ARGP4
+ADDRLP4 1164
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $743
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $754
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1168
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $755
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $755
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1172
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61752
+ADDRLP4 1172
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $751
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $762
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $759
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1172
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $763
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $763
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1176
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61756
+ADDRLP4 1176
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $759
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $770
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $767
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1176
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $771
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $771
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1180
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61760
+ADDRLP4 1180
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $767
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $778
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $775
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1180
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $779
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $779
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1184
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61724
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $775
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $786
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $783
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1184
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $787
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $787
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1188
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61728
+ADDRLP4 1188
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $783
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $794
+ARGP4
+ADDRLP4 1184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $791
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1188
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $795
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $795
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61736
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $791
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $802
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $799
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1192
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $803
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $803
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1196
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61708
+ADDRLP4 1196
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $799
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $810
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $807
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1196
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $811
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $811
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1200
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61712
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $807
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $818
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $815
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1200
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $819
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $819
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61716
+ADDRLP4 1204
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $815
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $826
+ARGP4
+ADDRLP4 1200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $823
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1204
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $827
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $827
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61720
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $823
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $834
+ARGP4
+ADDRLP4 1204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $831
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1208
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $835
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $835
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1212
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61856
+ADDRLP4 1212
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $831
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $842
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $839
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1212
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $843
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $843
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $839
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $850
+ARGP4
+ADDRLP4 1212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $847
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1216
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $851
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $851
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1220
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+4
+ADDRLP4 1220
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $847
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $859
+ARGP4
+ADDRLP4 1216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $856
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1220
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $860
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $860
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1224
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+8
+ADDRLP4 1224
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $856
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $868
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $865
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1224
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $869
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $869
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+12
+ADDRLP4 1228
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $865
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $877
+ARGP4
+ADDRLP4 1224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $874
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1228
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $878
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $878
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+16
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $874
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $886
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $883
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1232
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $887
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $887
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1236
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+20
+ADDRLP4 1236
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $883
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $895
+ARGP4
+ADDRLP4 1232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $892
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1236
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $896
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $896
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1240
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61860+24
+ADDRLP4 1240
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $892
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $904
+ARGP4
+ADDRLP4 1236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $901
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1240
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $905
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $905
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1244
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61764
+ADDRLP4 1244
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $901
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $912
+ARGP4
+ADDRLP4 1240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $909
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1244
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 0
+NEI4 $913
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $913
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1248
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61768
+ADDRLP4 1248
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $909
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $920
+ARGP4
+ADDRLP4 1244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 0
+NEI4 $917
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61772
+ARGP4
+ADDRLP4 1248
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $917
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $928
+ARGP4
+ADDRLP4 1248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $925
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61776
+ARGP4
+ADDRLP4 1252
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $925
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 1252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $933
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1256
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $937
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $937
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61780
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $933
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $944
+ARGP4
+ADDRLP4 1256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $941
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1260
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+NEI4 $945
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $945
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1264
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+228+61784
+ADDRLP4 1264
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $941
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 1260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+NEI4 $949
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61788
+ARGP4
+ADDRLP4 1264
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $949
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $960
+ARGP4
+ADDRLP4 1264
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $957
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+228+61792
+ARGP4
+ADDRLP4 1268
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+CNSTI4 0
+NEI4 $521
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $957
+LABELV $521
+ADDRGP4 $520
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $513
+endproc Asset_Parse 1272 12
+export Font_Report
+proc Font_Report 8 12
+ADDRGP4 $966
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $967
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+LABELV $968
+ADDRGP4 $972
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+228+56+44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $969
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 96
+LTI4 $968
+LABELV $965
+endproc Font_Report 8 12
+export UI_Report
+proc UI_Report 0 0
+ADDRGP4 String_Report
+CALLV
+pop
+LABELV $976
+endproc UI_Report 0 0
+export UI_ParseMenu
+proc UI_ParseMenu 1060 12
+ADDRGP4 $978
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $982
+ADDRGP4 $977
+JUMPV
+LABELV $981
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1040
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $984
+ADDRGP4 $983
+JUMPV
+LABELV $984
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $986
+ADDRGP4 $983
+JUMPV
+LABELV $986
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $992
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $989
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 Asset_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $983
+ADDRGP4 $982
+JUMPV
+LABELV $989
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $998
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $995
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Menu_New
+CALLV
+pop
+LABELV $995
+LABELV $982
+ADDRGP4 $981
+JUMPV
+LABELV $983
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $977
+endproc UI_ParseMenu 1060 12
+export Load_Menu
+proc Load_Menu 1048 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1000
+CNSTI4 0
+RETI4
+ADDRGP4 $999
+JUMPV
+LABELV $1000
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $1006
+CNSTI4 0
+RETI4
+ADDRGP4 $999
+JUMPV
+LABELV $1005
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1008
+CNSTI4 0
+RETI4
+ADDRGP4 $999
+JUMPV
+LABELV $1008
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1010
+CNSTI4 0
+RETI4
+ADDRGP4 $999
+JUMPV
+LABELV $1010
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $1013
+CNSTI4 1
+RETI4
+ADDRGP4 $999
+JUMPV
+LABELV $1013
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 UI_ParseMenu
+CALLV
+pop
+LABELV $1006
+ADDRGP4 $1005
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $999
+endproc Load_Menu 1048 8
+export UI_LoadMenus
+proc UI_LoadMenus 1068 8
+ADDRLP4 1048
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1018
+ADDRGP4 $1020
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 1060
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1022
+ADDRGP4 $1024
+ARGP4
+ADDRLP4 1064
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $1022
+LABELV $1018
+ADDRGP4 ui_new+12
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1029
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $1029
+JUMPV
+LABELV $1028
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1031
+ADDRGP4 $1030
+JUMPV
+LABELV $1031
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1037
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $1033
+LABELV $1037
+ADDRGP4 $1030
+JUMPV
+LABELV $1033
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $1038
+ADDRGP4 $1030
+JUMPV
+LABELV $1038
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1044
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1041
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 Load_Menu
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+LABELV $1041
+LABELV $1029
+ADDRGP4 $1028
+JUMPV
+LABELV $1030
+ADDRLP4 1056
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $1047
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $1017
+endproc UI_LoadMenus 1068 8
+export UI_Load
+proc UI_Load 1052 8
+ADDRLP4 1028
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRGP4 ui_introPlayed+12
+INDIRI4
+CNSTI4 0
+NEI4 $1049
+ADDRLP4 1032
+ADDRGP4 $1052
+ASGNP4
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $1050
+JUMPV
+LABELV $1049
+ADDRGP4 $1053
+ARGP4
+ADDRLP4 1036
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTU4 0
+ASGNU4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+ADDRLP4 1044
+INDIRU4
+EQU4 $1054
+ADDRLP4 1040
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 1044
+INDIRU4
+EQU4 $1054
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1054
+ADDRLP4 1048
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1058
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1056
+LABELV $1058
+ADDRLP4 1032
+ADDRGP4 $1021
+ASGNP4
+LABELV $1056
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 $1059
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $1050
+LABELV $1048
+endproc UI_Load 1052 8
+data
+align 4
+LABELV handicapValues
+address $1060
+address $1061
+address $1062
+address $1063
+address $1064
+address $1065
+address $1066
+address $1067
+address $1068
+address $1069
+address $1070
+address $1071
+address $1072
+address $1073
+address $1074
+address $1075
+address $1076
+address $1077
+address $1078
+address $1079
+byte 4 0
+code
+proc UI_DrawHandicap 20 32
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 handicapValues
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1080
+endproc UI_DrawHandicap 20 32
+proc UI_DrawClanName 8 32
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1082
+endproc UI_DrawClanName 8 32
+proc UI_SetCapFragLimits 16 8
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1085
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1086
+JUMPV
+LABELV $1085
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $1090
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+LABELV $1090
+LABELV $1086
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1099
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1096
+JUMPV
+LABELV $1095
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1101
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1096
+LABELV $1084
+endproc UI_SetCapFragLimits 16 8
+proc UI_DrawGameType 4 32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1102
+endproc UI_DrawGameType 4 32
+proc UI_DrawNetGameType 4 32
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $1111
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+78664
+INDIRI4
+LEI4 $1106
+LABELV $1111
+ADDRGP4 $1112
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1113
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1106
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1105
+endproc UI_DrawNetGameType 4 32
+proc UI_DrawJoinGameType 4 32
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $1122
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRGP4 uiInfo+78796
+INDIRI4
+LEI4 $1117
+LABELV $1122
+ADDRGP4 $1123
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1117
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78800
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1116
+endproc UI_DrawJoinGameType 4 32
+proc UI_TeamIndexFromName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1127
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1127
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1132
+JUMPV
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1134
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1134
+LABELV $1130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1132
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+LTI4 $1129
+LABELV $1127
+CNSTI4 0
+RETI4
+LABELV $1126
+endproc UI_TeamIndexFromName 12 8
+proc UI_DrawClanLogo 48 20
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1138
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+GEI4 $1138
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1141
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 24
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 36
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $1141
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1138
+LABELV $1137
+endproc UI_DrawClanLogo 48 20
+proc UI_DrawClanCinematic 32 24
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1162
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+GEI4 $1162
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+CNSTI4 -2
+LTI4 $1165
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1169
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $1169
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1178
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+ADDRGP4 $1166
+JUMPV
+LABELV $1178
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1165
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1166
+LABELV $1162
+LABELV $1161
+endproc UI_DrawClanCinematic 32 24
+proc UI_DrawPreviewCinematic 16 24
+ADDRGP4 uiInfo+545440
+INDIRI4
+CNSTI4 -2
+LEI4 $1195
+ADDRGP4 $1175
+ARGP4
+ADDRGP4 uiInfo+545436
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+544408
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+545440
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+545440
+INDIRI4
+CNSTI4 0
+LTI4 $1201
+ADDRGP4 uiInfo+545440
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+545440
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRGP4 uiInfo+545440
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+ADDRGP4 $1202
+JUMPV
+LABELV $1201
+ADDRGP4 uiInfo+545440
+CNSTI4 -2
+ASGNI4
+LABELV $1202
+LABELV $1195
+LABELV $1194
+endproc UI_DrawPreviewCinematic 16 24
+proc UI_DrawSkill 16 32
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1212
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $1210
+LABELV $1212
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1210
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1208
+endproc UI_DrawSkill 16 32
+proc UI_DrawTeamName 32 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1218
+ADDRLP4 4
+ADDRGP4 $1215
+ASGNP4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRLP4 4
+ADDRGP4 $1216
+ASGNP4
+LABELV $1219
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1220
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+GEI4 $1220
+ADDRGP4 $1223
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1228
+ADDRLP4 20
+ADDRGP4 $1224
+ASGNP4
+ADDRGP4 $1229
+JUMPV
+LABELV $1228
+ADDRLP4 20
+ADDRGP4 $1225
+ASGNP4
+LABELV $1229
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1220
+LABELV $1214
+endproc UI_DrawTeamName 32 32
+proc UI_DrawTeamMember 28 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1234
+ADDRLP4 8
+ADDRGP4 $1231
+ASGNP4
+ADDRGP4 $1235
+JUMPV
+LABELV $1234
+ADDRLP4 8
+ADDRGP4 $1232
+ASGNP4
+LABELV $1235
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1236
+ADDRLP4 4
+ADDRGP4 $1238
+ASGNP4
+ADDRGP4 $1237
+JUMPV
+LABELV $1236
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1239
+ADDRLP4 4
+ADDRGP4 $1241
+ASGNP4
+ADDRGP4 $1240
+JUMPV
+LABELV $1239
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $1242
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+LTI4 $1245
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1245
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1243
+JUMPV
+LABELV $1242
+ADDRLP4 20
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $1249
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1249
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $1243
+LABELV $1240
+LABELV $1237
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1230
+endproc UI_DrawTeamMember 28 32
+proc UI_DrawEffects 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1096810496
+SUBF4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 uiInfo+228+61856
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+643500
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+CVIF4 4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRLP4 12
+CNSTF4 1098907648
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 uiInfo+643500
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+228+61860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $1251
+endproc UI_DrawEffects 16 20
+proc UI_DrawMapPreview 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1262
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1263
+JUMPV
+LABELV $1262
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $1263
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1267
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LEI4 $1264
+LABELV $1267
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1268
+ADDRGP4 ui_currentNetMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1271
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1269
+JUMPV
+LABELV $1268
+ADDRGP4 ui_currentMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1273
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1269
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1264
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1274
+ADDRLP4 12
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+83384+8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1274
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1282
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $1283
+JUMPV
+LABELV $1282
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $1283
+LABELV $1258
+endproc UI_DrawMapPreview 20 20
+proc UI_DrawMapTimeToBeat 28 32
+ADDRGP4 ui_currentMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $1295
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LEI4 $1290
+LABELV $1295
+ADDRGP4 ui_currentMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1273
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1290
+ADDRLP4 0
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+40
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $1303
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1289
+endproc UI_DrawMapTimeToBeat 28 32
+proc UI_DrawMapCinematic 28 24
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1308
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1309
+JUMPV
+LABELV $1308
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $1309
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1313
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LEI4 $1310
+LABELV $1313
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1314
+ADDRGP4 ui_currentNetMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1271
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1315
+JUMPV
+LABELV $1314
+ADDRGP4 ui_currentMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1273
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1315
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1310
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+CNSTI4 -1
+LTI4 $1318
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1322
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 12
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1322
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1330
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1330
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $1319
+JUMPV
+LABELV $1318
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMapPreview
+CALLV
+pop
+LABELV $1319
+LABELV $1304
+endproc UI_DrawMapCinematic 28 24
+data
+align 4
+LABELV updateModel
+byte 4 1
+align 4
+LABELV q3Model
+byte 4 0
+bss
+align 4
+LABELV $1343
+skip 2952
+code
+proc UI_DrawPlayerModel 616 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1346
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 600
+INDIRF4
+CNSTF4 0
+EQF4 $1344
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 604
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1348
+ARGP4
+ADDRLP4 608
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+NEI4 $1349
+ADDRLP4 612
+CNSTI4 1
+ASGNI4
+ADDRGP4 q3Model
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 612
+INDIRI4
+ASGNI4
+LABELV $1349
+ADDRLP4 76
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1345
+JUMPV
+LABELV $1344
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 604
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 608
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1348
+ARGP4
+ADDRLP4 612
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 612
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+EQI4 $1351
+ADDRGP4 q3Model
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+LABELV $1351
+LABELV $1345
+ADDRGP4 updateModel
+INDIRI4
+CNSTI4 0
+EQI4 $1353
+ADDRGP4 $1343
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2952
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 604
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+ADDRLP4 588+8
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 588+4
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 588
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRGP4 $1343
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1343
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 0
+ASGNI4
+LABELV $1353
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1343
+ARGP4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $1342
+endproc UI_DrawPlayerModel 616 28
+bss
+align 4
+LABELV $1361
+skip 2952
+code
+proc UI_DrawPlayerModel2 632 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1346
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 600
+INDIRF4
+CNSTF4 0
+EQF4 $1362
+ADDRGP4 $1364
+ARGP4
+ADDRLP4 604
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1365
+ARGP4
+ADDRLP4 608
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 344
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+NEI4 $1366
+ADDRLP4 612
+CNSTI4 1
+ASGNI4
+ADDRGP4 q3Model
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 612
+INDIRI4
+ASGNI4
+LABELV $1366
+ADDRLP4 88
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1363
+JUMPV
+LABELV $1362
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 604
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 608
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1348
+ARGP4
+ADDRLP4 612
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 344
+ARGP4
+ADDRLP4 612
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+EQI4 $1368
+ADDRGP4 q3Model
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+LABELV $1368
+LABELV $1363
+ADDRGP4 updateModel
+INDIRI4
+CNSTI4 0
+EQI4 $1370
+ADDRGP4 $1373
+ARGP4
+ADDRLP4 604
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRGP4 $1374
+ARGP4
+ADDRLP4 608
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1377
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRGP4 $1378
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 616
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 uiInfo+643508
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 344
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 $1382
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $1383
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $1384
+ARGP4
+ADDRLP4 628
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+643508
+ARGP4
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 628
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 0
+ASGNI4
+LABELV $1370
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1361
+ARGP4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayerII
+CALLV
+pop
+LABELV $1360
+endproc UI_DrawPlayerModel2 632 28
+bss
+align 4
+LABELV $1387
+skip 2952
+code
+proc UI_DrawOC 748 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1388
+ARGP4
+ADDRLP4 728
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 728
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1389
+ARGP4
+ADDRLP4 732
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 732
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 updateModel
+INDIRI4
+CNSTI4 0
+EQI4 $1390
+ADDRGP4 $1387
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2952
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 736
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 740
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 740
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 740
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 740
+INDIRF4
+ASGNF4
+ADDRGP4 $1387
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 472
+ARGP4
+ADDRLP4 216
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1387
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+ADDRLP4 744
+INDIRI4
+ARGI4
+ADDRLP4 744
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 0
+ASGNI4
+LABELV $1390
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1387
+ARGP4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayerOC
+CALLV
+pop
+LABELV $1386
+endproc UI_DrawOC 748 28
+proc UI_DrawNetSource 8 32
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+LTI4 $1402
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LEI4 $1398
+LABELV $1402
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+LABELV $1398
+ADDRGP4 $1404
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1397
+endproc UI_DrawNetSource 8 32
+proc UI_DrawNetMapPreview 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+545444+10428
+INDIRI4
+CNSTI4 0
+LEI4 $1407
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+545444+10428
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $1408
+JUMPV
+LABELV $1407
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $1408
+LABELV $1406
+endproc UI_DrawNetMapPreview 8 20
+proc UI_DrawNetMapCinematic 4 20
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $1419
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LEI4 $1414
+LABELV $1419
+ADDRGP4 ui_currentNetMap+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1271
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1414
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+CNSTI4 0
+LTI4 $1421
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+ADDRGP4 $1422
+JUMPV
+LABELV $1421
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapPreview
+CALLV
+pop
+LABELV $1422
+LABELV $1413
+endproc UI_DrawNetMapCinematic 4 20
+proc UI_DrawNetFilter 8 32
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+LTI4 $1436
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ADDRGP4 numServerFilters
+INDIRI4
+LEI4 $1432
+LABELV $1436
+ADDRGP4 ui_serverFilterType+12
+CNSTI4 0
+ASGNI4
+LABELV $1432
+ADDRGP4 $1438
+ARGP4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverFilters
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1431
+endproc UI_DrawNetFilter 8 32
+proc UI_DrawTier 20 32
+ADDRGP4 $1441
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1445
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+542136
+INDIRI4
+LTI4 $1442
+LABELV $1445
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1442
+ADDRGP4 $1446
+ARGP4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+542140
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1440
+endproc UI_DrawTier 20 32
+proc UI_DrawTierMap 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1441
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1452
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+542136
+INDIRI4
+LTI4 $1449
+LABELV $1452
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1449
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+542140+28
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1453
+ADDRGP4 $1459
+ARGP4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+542140+4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+542140+28
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1453
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+542140+28
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $1448
+endproc UI_DrawTierMap 28 20
+proc UI_EnglishMapName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1468
+JUMPV
+LABELV $1465
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1470
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1464
+JUMPV
+LABELV $1470
+LABELV $1466
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1468
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LTI4 $1465
+ADDRGP4 $109
+RETP4
+LABELV $1464
+endproc UI_EnglishMapName 8 8
+proc UI_DrawTierMapName 32 32
+ADDRGP4 $1441
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1479
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+542136
+INDIRI4
+LTI4 $1476
+LABELV $1479
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1476
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1482
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LEI4 $1480
+LABELV $1482
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1480
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+542140+4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_EnglishMapName
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1475
+endproc UI_DrawTierMapName 32 32
+proc UI_DrawTierGameType 28 32
+ADDRGP4 $1441
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1489
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+542136
+INDIRI4
+LTI4 $1486
+LABELV $1489
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1486
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1492
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LEI4 $1490
+LABELV $1492
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1490
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+542140+16
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1485
+endproc UI_DrawTierGameType 28 32
+proc UI_AIFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1500
+JUMPV
+LABELV $1497
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1502
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076+4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1496
+JUMPV
+LABELV $1502
+LABELV $1498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1500
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75072
+INDIRI4
+LTI4 $1497
+ADDRGP4 $1507
+RETP4
+LABELV $1496
+endproc UI_AIFromName 8 8
+data
+align 4
+LABELV updateOpponentModel
+byte 4 1
+bss
+align 4
+LABELV $1509
+skip 2952
+code
+proc UI_DrawOpponent 424 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 updateOpponentModel
+INDIRI4
+CNSTI4 0
+EQI4 $1510
+ADDRGP4 $1512
+ARGP4
+ADDRLP4 408
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1512
+ARGP4
+ADDRLP4 412
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 152
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1509
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2952
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 416
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 0
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRGP4 $1509
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1509
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 $1509
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 0
+ASGNI4
+LABELV $1510
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1509
+ARGP4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $1508
+endproc UI_DrawOpponent 424 28
+bss
+align 4
+LABELV $1519
+skip 2952
+code
+proc UI_DrawOpponent2 424 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 updateOpponentModel
+INDIRI4
+CNSTI4 0
+EQI4 $1520
+ADDRGP4 $1512
+ARGP4
+ADDRLP4 408
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1512
+ARGP4
+ADDRLP4 412
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 152
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1519
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2952
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 416
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 0
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRGP4 $1519
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1519
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 $1519
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 0
+ASGNI4
+LABELV $1520
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1519
+ARGP4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayerII
+CALLV
+pop
+LABELV $1518
+endproc UI_DrawOpponent2 424 28
+proc UI_NextOpponent 24 8
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+LTI4 $1529
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1529
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1532
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+LTI4 $1534
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1534
+LABELV $1532
+ADDRGP4 $1528
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1527
+endproc UI_NextOpponent 24 8
+proc UI_PriorOpponent 24 8
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1539
+ADDRLP4 0
+ADDRGP4 uiInfo+75844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1539
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1544
+ADDRLP4 0
+ADDRGP4 uiInfo+75844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1544
+LABELV $1542
+ADDRGP4 $1528
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1538
+endproc UI_PriorOpponent 24 8
+proc UI_DrawPlayerLogo 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1549
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1549
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1548
+endproc UI_DrawPlayerLogo 44 20
+bss
+align 4
+LABELV $1568
+skip 2952
+code
+proc UI_DrawPlayerPortrait 616 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1364
+ARGP4
+ADDRLP4 604
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1365
+ARGP4
+ADDRLP4 608
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 336
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+NEI4 $1569
+ADDRLP4 612
+CNSTI4 1
+ASGNI4
+ADDRGP4 q3Model
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 612
+INDIRI4
+ASGNI4
+LABELV $1569
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 604
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTF4 1157234688
+ADDRLP4 604
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1571
+ADDRLP4 0+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRGP4 $1568
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $1571
+ADDRGP4 updateModel
+INDIRI4
+CNSTI4 0
+EQI4 $1575
+ADDRGP4 $1568
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2952
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 0
+ASGNF4
+ADDRLP4 592+8
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRLP4 592+4
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRLP4 592
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRGP4 $1568
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 336
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1568
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 0
+ASGNI4
+LABELV $1575
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1568
+ARGP4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayersBust
+CALLV
+pop
+LABELV $1567
+endproc UI_DrawPlayerPortrait 616 28
+proc UI_DrawPlayerLogoMetal 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1583
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1583
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1582
+endproc UI_DrawPlayerLogoMetal 44 20
+proc UI_DrawPlayerLogoName 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1602
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1602
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1601
+endproc UI_DrawPlayerLogoName 44 20
+proc UI_DrawOpponentLogo 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1621
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1621
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1620
+endproc UI_DrawOpponentLogo 44 20
+proc UI_DrawOpponentLogoMetal 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1640
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1640
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1639
+endproc UI_DrawOpponentLogoMetal 44 20
+proc UI_DrawOpponentLogoName 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1659
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1659
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1658
+endproc UI_DrawOpponentLogoName 44 20
+proc UI_DrawAllMapsSelection 16 32
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1681
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1682
+JUMPV
+LABELV $1681
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $1682
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1683
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+GEI4 $1683
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1683
+LABELV $1677
+endproc UI_DrawAllMapsSelection 16 32
+proc UI_DrawOpponentName 8 32
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1687
+endproc UI_DrawOpponentName 8 32
+proc UI_DrawMenuMapName 4 32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+83384+224+4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $1692
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1688
+endproc UI_DrawMenuMapName 4 32
+proc UI_OwnerDrawWidth 120 12
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 250
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1759
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $1768
+LABELV $1767
+ADDRLP4 28
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 200
+LTI4 $1695
+ADDRLP4 28
+INDIRI4
+CNSTI4 247
+GTI4 $1695
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1769-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1769
+address $1696
+address $1695
+address $1695
+address $1697
+address $1695
+address $1698
+address $1695
+address $1701
+address $1706
+address $1711
+address $1716
+address $1716
+address $1716
+address $1716
+address $1716
+address $1726
+address $1726
+address $1726
+address $1726
+address $1726
+address $1735
+address $1695
+address $1745
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1695
+address $1764
+code
+LABELV $1768
+ADDRFP4 0
+INDIRI4
+CNSTI4 260
+EQI4 $1695
+ADDRGP4 $1695
+JUMPV
+LABELV $1696
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 handicapValues
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1697
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1698
+ADDRLP4 0
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1701
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+LTI4 $1704
+ADDRLP4 48
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $1702
+LABELV $1704
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $1702
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1706
+ADDRGP4 $1215
+ARGP4
+ADDRLP4 52
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $1695
+ADDRLP4 60
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+GEI4 $1695
+ADDRGP4 $1223
+ARGP4
+ADDRGP4 $1224
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1711
+ADDRGP4 $1216
+ARGP4
+ADDRLP4 64
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LTI4 $1695
+ADDRLP4 72
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+GEI4 $1695
+ADDRGP4 $1223
+ARGP4
+ADDRGP4 $1225
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1716
+ADDRGP4 $1231
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1717
+ADDRLP4 12
+ADDRGP4 $1238
+ASGNP4
+ADDRGP4 $1718
+JUMPV
+LABELV $1717
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1719
+ADDRLP4 12
+ADDRGP4 $1241
+ASGNP4
+ADDRGP4 $1720
+JUMPV
+LABELV $1719
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+75072
+INDIRI4
+LTI4 $1721
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1721
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1720
+LABELV $1718
+ADDRGP4 $1725
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1726
+ADDRGP4 $1232
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1727
+ADDRLP4 12
+ADDRGP4 $1238
+ASGNP4
+ADDRGP4 $1728
+JUMPV
+LABELV $1727
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1729
+ADDRLP4 12
+ADDRGP4 $1241
+ASGNP4
+ADDRGP4 $1730
+JUMPV
+LABELV $1729
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+75072
+INDIRI4
+LTI4 $1731
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1731
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1730
+LABELV $1728
+ADDRGP4 $1725
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1735
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+LTI4 $1741
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 uiInfo+78796
+INDIRI4
+LEI4 $1736
+LABELV $1741
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+LABELV $1736
+ADDRGP4 $1743
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1745
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+LTI4 $1750
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ADDRGP4 numServerFilters
+INDIRI4
+LEI4 $1746
+LABELV $1750
+ADDRGP4 ui_serverFilterType+12
+CNSTI4 0
+ASGNI4
+LABELV $1746
+ADDRGP4 $1438
+ARGP4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverFilters
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1759
+ADDRLP4 108
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $1760
+ADDRLP4 0
+ADDRGP4 $1762
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1760
+ADDRLP4 0
+ADDRGP4 $1763
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1764
+ADDRGP4 $1765
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+ASGNP4
+LABELV $1695
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1771
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $1693
+JUMPV
+LABELV $1771
+CNSTI4 0
+RETI4
+LABELV $1693
+endproc UI_OwnerDrawWidth 120 12
+proc UI_DrawBotName 28 32
+ADDRLP4 0
+ADDRGP4 uiInfo+73532
+INDIRI4
+ASGNI4
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 $109
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $1776
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $1776
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+LTI4 $1778
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1778
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1777
+JUMPV
+LABELV $1776
+ADDRLP4 20
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $1782
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1782
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $1777
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1773
+endproc UI_DrawBotName 28 32
+proc UI_DrawBotSkill 4 32
+ADDRGP4 uiInfo+542780
+INDIRI4
+CNSTI4 0
+LTI4 $1785
+ADDRGP4 uiInfo+542780
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+GEI4 $1785
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+542780
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1785
+LABELV $1784
+endproc UI_DrawBotSkill 4 32
+proc UI_DrawRedBlue 8 32
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+78996
+INDIRI4
+CNSTI4 0
+NEI4 $1793
+ADDRLP4 0
+ADDRGP4 $1225
+ASGNP4
+ADDRGP4 $1794
+JUMPV
+LABELV $1793
+ADDRLP4 0
+ADDRGP4 $1224
+ASGNP4
+LABELV $1794
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1790
+endproc UI_DrawRedBlue 8 32
+proc UI_DrawCrosshair 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 uiInfo+565656
+INDIRI4
+CNSTI4 0
+LTI4 $1800
+ADDRGP4 uiInfo+565656
+INDIRI4
+CNSTI4 10
+LTI4 $1796
+LABELV $1800
+ADDRGP4 uiInfo+565656
+CNSTI4 0
+ASGNI4
+LABELV $1796
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+565656
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+228+61888
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1795
+endproc UI_DrawCrosshair 8 20
+proc UI_BuildPlayerList 4180 12
+ADDRLP4 1040
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 1040+8
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRGP4 uiInfo+79020
+ADDRLP4 1040+8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1810
+ARGP4
+ADDRLP4 4128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4128
+INDIRP4
+ARGP4
+ADDRLP4 4132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+79024
+ADDRLP4 4132
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1811
+ARGP4
+ADDRLP4 4136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4136
+INDIRP4
+ARGP4
+ADDRLP4 4140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1812
+ARGP4
+ADDRLP4 4144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4144
+INDIRP4
+ARGP4
+ADDRLP4 4148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 4148
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+79000
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+79004
+CNSTI4 0
+ASGNI4
+ADDRLP4 4152
+CNSTI4 0
+ASGNI4
+ADDRLP4 4124
+ADDRLP4 4152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4152
+INDIRI4
+ASGNI4
+ADDRGP4 $1818
+JUMPV
+LABELV $1815
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1819
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1823
+ARGP4
+ADDRLP4 4156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+79000
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+79028
+ADDP4
+ARGP4
+ADDRLP4 4156
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+79000
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+79028
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4160
+ADDRGP4 uiInfo+79000
+ASGNP4
+ADDRLP4 4160
+INDIRP4
+ADDRLP4 4160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1811
+ARGP4
+ADDRLP4 4164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4164
+INDIRP4
+ARGP4
+ADDRLP4 4168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 4168
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+NEI4 $1827
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1823
+ARGP4
+ADDRLP4 4172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+79004
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRLP4 4172
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+79004
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+79004
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+83124
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+79020
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1835
+ADDRLP4 4124
+ADDRGP4 uiInfo+79004
+INDIRI4
+ASGNI4
+LABELV $1835
+ADDRLP4 4176
+ADDRGP4 uiInfo+79004
+ASGNP4
+ADDRLP4 4176
+INDIRP4
+ADDRLP4 4176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1827
+LABELV $1819
+LABELV $1816
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1818
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1815
+ADDRGP4 uiInfo+79024
+INDIRI4
+CNSTI4 0
+NEI4 $1840
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4124
+INDIRI4
+ARGI4
+ADDRLP4 4156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 4156
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1840
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 4156
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4156
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1847
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+LEI4 $1844
+LABELV $1847
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1844
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $1848
+ADDRGP4 $1851
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1848
+LABELV $1805
+endproc UI_BuildPlayerList 4180 12
+proc UI_DrawSelectedPlayer 16 32
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 uiInfo+79012
+INDIRI4
+LEI4 $1854
+ADDRGP4 uiInfo+79012
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $1854
+ADDRGP4 uiInfo+79024
+INDIRI4
+CNSTI4 0
+EQI4 $1863
+ADDRGP4 $1851
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1864
+JUMPV
+LABELV $1863
+ADDRGP4 $1861
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $1864
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1853
+endproc UI_DrawSelectedPlayer 16 32
+proc UI_DrawServerRefreshDate 80 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+545444+2212
+INDIRI4
+CNSTI4 0
+EQI4 $1866
+ADDRLP4 32
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 $1874
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 uiInfo+78992
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1867
+JUMPV
+LABELV $1866
+ADDRGP4 $1765
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1878
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 uiInfo+78992
+INDIRI4
+CNSTI4 0
+EQI4 $1879
+ADDRGP4 uiInfo+78992
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+556928
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTF4 1073741824
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $1879
+LABELV $1867
+LABELV $1865
+endproc UI_DrawServerRefreshDate 80 32
+proc UI_DrawServerMOTD 20 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+545444+10436
+INDIRI4
+CNSTI4 0
+EQI4 $1891
+ADDRGP4 uiInfo+545444+10440
+INDIRI4
+CNSTI4 -1
+NEI4 $1895
+ADDRGP4 uiInfo+545444+10440
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10444
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 uiInfo+545444+10448
+CNSTI4 -1
+ASGNI4
+LABELV $1895
+ADDRGP4 uiInfo+545444+10452
+INDIRI4
+ADDRGP4 uiInfo+545444+10436
+INDIRI4
+LEI4 $1905
+ADDRGP4 uiInfo+545444+10452
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10444
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 uiInfo+545444+10448
+CNSTI4 -1
+ASGNI4
+LABELV $1905
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 uiInfo+545444+10456
+INDIRI4
+LEI4 $1917
+ADDRGP4 uiInfo+545444+10456
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10444
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+GTF4 $1925
+ADDRGP4 uiInfo+545444+10452
+INDIRI4
+ADDRGP4 uiInfo+545444+10436
+INDIRI4
+GEI4 $1929
+ADDRGP4 uiInfo+545444+10452
+INDIRI4
+ADDRGP4 uiInfo+545444+10460
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 uiInfo+545444+10444
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 uiInfo+545444+10452
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1926
+JUMPV
+LABELV $1929
+ADDRGP4 uiInfo+545444+10452
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10448
+INDIRI4
+CNSTI4 0
+LTI4 $1945
+ADDRGP4 uiInfo+545444+10444
+ADDRGP4 uiInfo+545444+10448
+INDIRI4
+ASGNI4
+ADDRGP4 $1946
+JUMPV
+LABELV $1945
+ADDRGP4 uiInfo+545444+10444
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $1946
+ADDRGP4 uiInfo+545444+10448
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1926
+JUMPV
+LABELV $1925
+ADDRLP4 4
+ADDRGP4 uiInfo+545444+10444
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10448
+INDIRI4
+CNSTI4 0
+LTI4 $1959
+ADDRLP4 8
+ADDRGP4 uiInfo+545444+10448
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $1959
+LABELV $1926
+LABELV $1917
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 uiInfo+545444+10444
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+545444+10452
+INDIRI4
+ADDRGP4 uiInfo+545444+10460
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 Text_Paint_Limit
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10448
+INDIRI4
+CNSTI4 0
+LTI4 $1971
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 uiInfo+545444+10448
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+545444+10460
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+545444+10452
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint_Limit
+CALLV
+pop
+LABELV $1971
+ADDRGP4 uiInfo+545444+10452
+INDIRI4
+CNSTI4 0
+EQI4 $1981
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1981
+ADDRGP4 uiInfo+545444+10448
+INDIRI4
+CNSTI4 -1
+NEI4 $1982
+ADDRGP4 uiInfo+545444+10448
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1982
+JUMPV
+LABELV $1981
+ADDRGP4 uiInfo+545444+10448
+CNSTI4 -1
+ASGNI4
+LABELV $1982
+LABELV $1891
+LABELV $1890
+endproc UI_DrawServerMOTD 20 32
+proc UI_DrawKeyBindStatus 8 32
+ADDRLP4 0
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1994
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1762
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $1995
+JUMPV
+LABELV $1994
+ADDRFP4 16
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+NEI4 $1996
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1763
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $1996
+LABELV $1995
+LABELV $1993
+endproc UI_DrawKeyBindStatus 8 32
+proc UI_DrawGLInfo 1336 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1999
+ARGP4
+ADDRGP4 uiInfo+62156+1024
+ARGP4
+ADDRLP4 1296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $2002
+ARGP4
+ADDRGP4 uiInfo+62156+2048
+ARGP4
+ADDRGP4 uiInfo+62156
+ARGP4
+ADDRLP4 1304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRGP4 $2006
+ARGP4
+ADDRGP4 uiInfo+62156+11272
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+62156+11276
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+62156+11280
+INDIRI4
+ARGI4
+ADDRLP4 1312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 uiInfo+62156+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 272
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2016
+JUMPV
+LABELV $2018
+ADDRLP4 1320
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1320
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $2019
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $2018
+ADDRLP4 1324
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+EQI4 $2024
+ADDRLP4 1324
+INDIRI4
+CNSTI4 32
+EQI4 $2024
+ADDRLP4 1328
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1328
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2024
+JUMPV
+LABELV $2023
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2024
+ADDRLP4 1328
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+EQI4 $2026
+ADDRLP4 1328
+INDIRI4
+CNSTI4 32
+NEI4 $2023
+LABELV $2026
+LABELV $2016
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $2027
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2019
+LABELV $2027
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2029
+JUMPV
+LABELV $2028
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1324
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $2031
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1328
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $2031
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1093664768
+SUBF4
+LEF4 $2033
+ADDRGP4 $2030
+JUMPV
+LABELV $2033
+LABELV $2029
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $2028
+LABELV $2030
+LABELV $1998
+endproc UI_DrawGLInfo 1336 32
+proc UI_OwnerDraw 24 24
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 200
+LTI4 $2040
+ADDRLP4 16
+INDIRI4
+CNSTI4 262
+GTI4 $2040
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2094-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2094
+address $2041
+address $2042
+address $2043
+address $2046
+address $2047
+address $2050
+address $2053
+address $2057
+address $2058
+address $2059
+address $2060
+address $2060
+address $2060
+address $2060
+address $2060
+address $2061
+address $2061
+address $2061
+address $2061
+address $2061
+address $2062
+address $2063
+address $2065
+address $2066
+address $2067
+address $2069
+address $2070
+address $2071
+address $2072
+address $2075
+address $2073
+address $2076
+address $2074
+address $2077
+address $2079
+address $2080
+address $2081
+address $2083
+address $2040
+address $2084
+address $2085
+address $2086
+address $2087
+address $2088
+address $2055
+address $2051
+address $2064
+address $2089
+address $2090
+address $2091
+address $2092
+address $2048
+address $2054
+address $2052
+address $2049
+address $2056
+address $2082
+address $2044
+address $2068
+address $2040
+address $2078
+address $2093
+address $2045
+code
+LABELV $2041
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandicap
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2042
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawEffects
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2043
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawPlayerModel
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2044
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawPlayerModel2
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2045
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawOC
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2046
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawClanName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2047
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawClanLogo
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2048
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawClanCinematic
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2049
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPreviewCinematic
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2050
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawGameType
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2051
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetGameType
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2052
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawJoinGameType
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2053
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawMapPreview
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2054
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMapTimeToBeat
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2055
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawMapCinematic
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2056
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawMapCinematic
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2057
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawSkill
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2058
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2059
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2060
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 210
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamMember
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2061
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamMember
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2062
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetSource
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2063
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapPreview
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2064
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapCinematic
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2065
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetFilter
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2066
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTier
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2067
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawOpponent
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2068
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawOpponent2
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2069
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2070
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2071
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2072
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogo
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2073
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogoMetal
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2074
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogoName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2075
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogo
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2076
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogoMetal
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2077
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogoName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2078
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMenuMapName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2079
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTierMapName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2080
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTierGameType
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2081
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawAllMapsSelection
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2082
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawAllMapsSelection
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2083
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawOpponentName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2084
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBotName
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2085
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBotSkill
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2086
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawRedBlue
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2087
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawCrosshair
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2088
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawSelectedPlayer
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2089
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawServerRefreshDate
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2090
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawServerMOTD
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2091
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawGLInfo
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2092
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawKeyBindStatus
+CALLV
+pop
+ADDRGP4 $2040
+JUMPV
+LABELV $2093
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawPlayerPortrait
+CALLV
+pop
+LABELV $2040
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $2035
+endproc UI_OwnerDraw 24 24
+proc UI_OwnerDrawVisible 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2098
+JUMPV
+LABELV $2097
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2100
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $2104
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1092616192
+EQF4 $2102
+LABELV $2104
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2102
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $2100
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $2105
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $2109
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1092616192
+NEF4 $2107
+LABELV $2109
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2107
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $2105
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2110
+ADDRGP4 uiInfo+79024
+INDIRI4
+CNSTI4 0
+NEI4 $2112
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2113
+JUMPV
+LABELV $2112
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $2115
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+83124
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+79020
+INDIRI4
+NEI4 $2115
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2115
+LABELV $2113
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $2110
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2122
+ADDRGP4 uiInfo+79024
+INDIRI4
+CNSTI4 0
+EQI4 $2124
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $2134
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+83124
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+79020
+INDIRI4
+EQI4 $2127
+LABELV $2134
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2127
+LABELV $2124
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $2122
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2135
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+EQI4 $2137
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2137
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+LABELV $2135
+ADDRFP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2140
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+NEI4 $2142
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2142
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $2140
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2145
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $2155
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $2147
+LABELV $2155
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2147
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $2145
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $2156
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $2166
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2158
+LABELV $2166
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2158
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+LABELV $2156
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $2167
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $2169
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $2169
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2169
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+LABELV $2167
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2177
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $2187
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $2179
+LABELV $2187
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2179
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+LABELV $2177
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2188
+ADDRGP4 uiInfo+73504
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+GEI4 $2190
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2191
+JUMPV
+LABELV $2190
+ADDRGP4 uiInfo+73524
+INDIRI4
+CNSTI4 0
+EQI4 $2194
+ADDRGP4 $2199
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $2197
+ADDRGP4 uiInfo+565664
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 uiInfo+73524
+CNSTI4 0
+ASGNI4
+LABELV $2197
+LABELV $2194
+LABELV $2191
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $2188
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2202
+ADDRGP4 uiInfo+73508
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+GEI4 $2204
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2204
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $2202
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $2208
+ADDRGP4 uiInfo+73520
+INDIRI4
+CNSTI4 0
+NEI4 $2210
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2210
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $2209
+JUMPV
+LABELV $2208
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2209
+LABELV $2098
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2097
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $2096
+endproc UI_OwnerDrawVisible 12 8
+proc UI_Handicap_HandleKey 20 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2218
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2218
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2218
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2214
+LABELV $2218
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2219
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+SUBI4
+ASGNI4
+ADDRGP4 $2220
+JUMPV
+LABELV $2219
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $2220
+ADDRLP4 4
+INDIRI4
+CNSTI4 100
+LEI4 $2221
+ADDRLP4 4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $2222
+JUMPV
+LABELV $2221
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2223
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $2223
+LABELV $2222
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2213
+JUMPV
+LABELV $2214
+CNSTI4 0
+RETI4
+LABELV $2213
+endproc UI_Handicap_HandleKey 20 12
+proc UI_Effects_HandleKey 8 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2231
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2231
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2231
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2227
+LABELV $2231
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2232
+ADDRLP4 4
+ADDRGP4 uiInfo+643500
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2233
+JUMPV
+LABELV $2232
+ADDRLP4 4
+ADDRGP4 uiInfo+643500
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2233
+ADDRGP4 uiInfo+643500
+INDIRI4
+CNSTI4 6
+LEI4 $2236
+ADDRGP4 uiInfo+643500
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2237
+JUMPV
+LABELV $2236
+ADDRGP4 uiInfo+643500
+INDIRI4
+CNSTI4 0
+GEI4 $2240
+ADDRGP4 uiInfo+643500
+CNSTI4 6
+ASGNI4
+LABELV $2240
+LABELV $2237
+ADDRGP4 $2244
+ARGP4
+ADDRGP4 uiInfo+643500
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uitogamecode
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2226
+JUMPV
+LABELV $2227
+CNSTI4 0
+RETI4
+LABELV $2226
+endproc UI_Effects_HandleKey 8 8
+proc UI_ClanName_HandleKey 36 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2251
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2251
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2251
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2247
+LABELV $2251
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2252
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2252
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2260
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2261
+JUMPV
+LABELV $2260
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2261
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+LTI4 $2262
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2263
+JUMPV
+LABELV $2262
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2265
+ADDRLP4 4
+ADDRGP4 uiInfo+75844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2265
+LABELV $2263
+ADDRGP4 $1083
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_HeadCountByTeam
+CALLI4
+pop
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 28
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $2269
+ADDRGP4 UI_NextOpponent
+CALLV
+pop
+LABELV $2269
+CNSTI4 1
+RETI4
+ADDRGP4 $2246
+JUMPV
+LABELV $2247
+CNSTI4 0
+RETI4
+LABELV $2246
+endproc UI_ClanName_HandleKey 36 8
+proc UI_GameType_HandleKey 20 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2276
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2276
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2276
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2272
+LABELV $2276
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2277
+LABELV $2279
+ADDRLP4 12
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $2283
+ADDRGP4 ui_gameType+12
+ADDRGP4 uiInfo+78664
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2283
+LABELV $2280
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2279
+ADDRGP4 $2278
+JUMPV
+LABELV $2277
+LABELV $2292
+ADDRLP4 12
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRGP4 uiInfo+78664
+INDIRI4
+LTI4 $2296
+ADDRGP4 ui_gameType+12
+CNSTI4 0
+ASGNI4
+LABELV $2296
+LABELV $2293
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2292
+LABELV $2278
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2305
+ADDRGP4 $1346
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2306
+JUMPV
+LABELV $2305
+ADDRGP4 $1346
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2306
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2311
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2319
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2319
+ADDRGP4 $1273
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $2319
+CNSTI4 1
+RETI4
+ADDRGP4 $2271
+JUMPV
+LABELV $2272
+CNSTI4 0
+RETI4
+LABELV $2271
+endproc UI_GameType_HandleKey 20 16
+proc UI_NetGameType_HandleKey 12 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2326
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2326
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2326
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2322
+LABELV $2326
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2327
+LABELV $2329
+ADDRLP4 4
+ADDRGP4 ui_netGameType+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $2333
+ADDRGP4 ui_netGameType+12
+ADDRGP4 uiInfo+78664
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2333
+LABELV $2330
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2329
+ADDRGP4 $2328
+JUMPV
+LABELV $2327
+LABELV $2342
+ADDRLP4 4
+ADDRGP4 ui_netGameType+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+78664
+INDIRI4
+LTI4 $2346
+ADDRGP4 ui_netGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $2346
+LABELV $2343
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2342
+LABELV $2328
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1112
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1271
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2321
+JUMPV
+LABELV $2322
+CNSTI4 0
+RETI4
+LABELV $2321
+endproc UI_NetGameType_HandleKey 12 16
+proc UI_JoinGameType_HandleKey 12 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2365
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2365
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2365
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2361
+LABELV $2365
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2366
+ADDRLP4 4
+ADDRGP4 ui_joinGameType+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2367
+JUMPV
+LABELV $2366
+ADDRLP4 4
+ADDRGP4 ui_joinGameType+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2367
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $2370
+ADDRGP4 ui_joinGameType+12
+ADDRGP4 uiInfo+78796
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2370
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRGP4 uiInfo+78796
+INDIRI4
+LTI4 $2375
+ADDRGP4 ui_joinGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $2375
+LABELV $2371
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1123
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2360
+JUMPV
+LABELV $2361
+CNSTI4 0
+RETI4
+LABELV $2360
+endproc UI_JoinGameType_HandleKey 12 8
+proc UI_Skill_HandleKey 16 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2386
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2386
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2386
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2382
+LABELV $2386
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2387
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2388
+JUMPV
+LABELV $2387
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2388
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+GEI4 $2389
+ADDRLP4 4
+ADDRGP4 numSkillLevels
+INDIRI4
+ASGNI4
+ADDRGP4 $2390
+JUMPV
+LABELV $2389
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $2391
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $2391
+LABELV $2390
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2381
+JUMPV
+LABELV $2382
+CNSTI4 0
+RETI4
+LABELV $2381
+endproc UI_Skill_HandleKey 16 8
+proc UI_TeamName_HandleKey 24 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2398
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2398
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2398
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2394
+LABELV $2398
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2400
+ADDRLP4 8
+ADDRGP4 $1215
+ASGNP4
+ADDRGP4 $2401
+JUMPV
+LABELV $2400
+ADDRLP4 8
+ADDRGP4 $1216
+ASGNP4
+LABELV $2401
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2402
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2403
+JUMPV
+LABELV $2402
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2403
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+LTI4 $2404
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2405
+JUMPV
+LABELV $2404
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2407
+ADDRLP4 4
+ADDRGP4 uiInfo+75844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2407
+LABELV $2405
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2412
+ADDRLP4 20
+ADDRGP4 $1215
+ASGNP4
+ADDRGP4 $2413
+JUMPV
+LABELV $2412
+ADDRLP4 20
+ADDRGP4 $1216
+ASGNP4
+LABELV $2413
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2393
+JUMPV
+LABELV $2394
+CNSTI4 0
+RETI4
+LABELV $2393
+endproc UI_TeamName_HandleKey 24 8
+proc UI_TeamMember_HandleKey 32 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2419
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2419
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2419
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2415
+LABELV $2419
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2421
+ADDRLP4 12
+ADDRGP4 $1231
+ASGNP4
+ADDRGP4 $2422
+JUMPV
+LABELV $2421
+ADDRLP4 12
+ADDRGP4 $1232
+ASGNP4
+LABELV $2422
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2423
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2424
+JUMPV
+LABELV $2423
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2424
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2425
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $2428
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2426
+JUMPV
+LABELV $2428
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2426
+ADDRLP4 4
+ADDRGP4 uiInfo+73528
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2426
+JUMPV
+LABELV $2425
+ADDRLP4 24
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $2434
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2435
+JUMPV
+LABELV $2434
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2436
+ADDRLP4 28
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2436
+LABELV $2435
+LABELV $2426
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2414
+JUMPV
+LABELV $2415
+CNSTI4 0
+RETI4
+LABELV $2414
+endproc UI_TeamMember_HandleKey 32 8
+proc UI_NetSource_HandleKey 16 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2443
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2443
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2443
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2439
+LABELV $2443
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2444
+ADDRLP4 4
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $2445
+ADDRLP4 12
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2445
+JUMPV
+LABELV $2444
+ADDRLP4 4
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $2452
+ADDRLP4 12
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2452
+LABELV $2445
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $2456
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2457
+JUMPV
+LABELV $2456
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+GEI4 $2460
+ADDRGP4 ui_netSource+12
+ADDRGP4 numNetSources
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2460
+LABELV $2457
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+EQI4 $2464
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+LABELV $2464
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2467
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2439
+CNSTI4 0
+RETI4
+LABELV $2438
+endproc UI_NetSource_HandleKey 16 8
+proc UI_NetFilter_HandleKey 8 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2474
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2474
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2474
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2470
+LABELV $2474
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2475
+ADDRLP4 4
+ADDRGP4 ui_serverFilterType+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2475
+ADDRLP4 4
+ADDRGP4 ui_serverFilterType+12
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2476
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ADDRGP4 numServerFilters
+INDIRI4
+LTI4 $2479
+ADDRGP4 ui_serverFilterType+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2480
+JUMPV
+LABELV $2479
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+GEI4 $2483
+ADDRGP4 ui_serverFilterType+12
+ADDRGP4 numServerFilters
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2483
+LABELV $2480
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2469
+JUMPV
+LABELV $2470
+CNSTI4 0
+RETI4
+LABELV $2469
+endproc UI_NetFilter_HandleKey 8 8
+proc UI_OpponentName_HandleKey 4 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2492
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2492
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2492
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2488
+LABELV $2492
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2493
+ADDRGP4 UI_PriorOpponent
+CALLV
+pop
+ADDRGP4 $2494
+JUMPV
+LABELV $2493
+ADDRGP4 UI_NextOpponent
+CALLV
+pop
+LABELV $2494
+CNSTI4 1
+RETI4
+ADDRGP4 $2487
+JUMPV
+LABELV $2488
+CNSTI4 0
+RETI4
+LABELV $2487
+endproc UI_OpponentName_HandleKey 4 0
+proc UI_BotName_HandleKey 28 4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2500
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2500
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2500
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2496
+LABELV $2500
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 uiInfo+73532
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2502
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2503
+JUMPV
+LABELV $2502
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2503
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LTI4 $2504
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+EQI4 $2504
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $2506
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2505
+JUMPV
+LABELV $2506
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2505
+ADDRLP4 4
+ADDRGP4 uiInfo+73528
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2505
+JUMPV
+LABELV $2504
+ADDRLP4 20
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $2512
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2513
+JUMPV
+LABELV $2512
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2514
+ADDRLP4 24
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2514
+LABELV $2513
+LABELV $2505
+ADDRGP4 uiInfo+73532
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2495
+JUMPV
+LABELV $2496
+CNSTI4 0
+RETI4
+LABELV $2495
+endproc UI_BotName_HandleKey 28 4
+proc UI_BotSkill_HandleKey 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2522
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2522
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2522
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2518
+LABELV $2522
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2523
+ADDRLP4 4
+ADDRGP4 uiInfo+542780
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2524
+JUMPV
+LABELV $2523
+ADDRLP4 4
+ADDRGP4 uiInfo+542780
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2524
+ADDRGP4 uiInfo+542780
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LTI4 $2527
+ADDRGP4 uiInfo+542780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2528
+JUMPV
+LABELV $2527
+ADDRGP4 uiInfo+542780
+INDIRI4
+CNSTI4 0
+GEI4 $2531
+ADDRGP4 uiInfo+542780
+ADDRGP4 numSkillLevels
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2531
+LABELV $2528
+CNSTI4 1
+RETI4
+ADDRGP4 $2517
+JUMPV
+LABELV $2518
+CNSTI4 0
+RETI4
+LABELV $2517
+endproc UI_BotSkill_HandleKey 8 0
+proc UI_RedBlue_HandleKey 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2540
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2540
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2540
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2536
+LABELV $2540
+ADDRLP4 4
+ADDRGP4 uiInfo+78996
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2535
+JUMPV
+LABELV $2536
+CNSTI4 0
+RETI4
+LABELV $2535
+endproc UI_RedBlue_HandleKey 8 0
+proc UI_Crosshair_HandleKey 8 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2547
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2547
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2547
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2543
+LABELV $2547
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2548
+ADDRLP4 4
+ADDRGP4 uiInfo+565656
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2549
+JUMPV
+LABELV $2548
+ADDRLP4 4
+ADDRGP4 uiInfo+565656
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2549
+ADDRGP4 uiInfo+565656
+INDIRI4
+CNSTI4 10
+LTI4 $2552
+ADDRGP4 uiInfo+565656
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2553
+JUMPV
+LABELV $2552
+ADDRGP4 uiInfo+565656
+INDIRI4
+CNSTI4 0
+GEI4 $2556
+ADDRGP4 uiInfo+565656
+CNSTI4 9
+ASGNI4
+LABELV $2556
+LABELV $2553
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 uiInfo+565656
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2560
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2543
+CNSTI4 0
+RETI4
+LABELV $2542
+endproc UI_Crosshair_HandleKey 8 8
+proc UI_SelectedPlayer_HandleKey 16 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 178
+EQI4 $2567
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+EQI4 $2567
+ADDRFP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $2567
+ADDRFP4 8
+INDIRI4
+CNSTI4 169
+NEI4 $2563
+LABELV $2567
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+ADDRGP4 uiInfo+79024
+INDIRI4
+CNSTI4 0
+NEI4 $2568
+CNSTI4 0
+RETI4
+ADDRGP4 $2562
+JUMPV
+LABELV $2568
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 179
+NEI4 $2571
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2572
+JUMPV
+LABELV $2571
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2572
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+LEI4 $2573
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2574
+JUMPV
+LABELV $2573
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2576
+ADDRLP4 4
+ADDRGP4 uiInfo+79004
+INDIRI4
+ASGNI4
+LABELV $2576
+LABELV $2574
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+NEI4 $2579
+ADDRGP4 $1851
+ARGP4
+ADDRGP4 $2582
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2580
+JUMPV
+LABELV $2579
+ADDRGP4 $1851
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2580
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2563
+CNSTI4 0
+RETI4
+LABELV $2562
+endproc UI_SelectedPlayer_HandleKey 16 8
+proc UI_OwnerDrawHandleKey 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $2586
+ADDRLP4 0
+INDIRI4
+CNSTI4 253
+GTI4 $2586
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2606-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2606
+address $2587
+address $2588
+address $2586
+address $2589
+address $2586
+address $2590
+address $2586
+address $2593
+address $2594
+address $2595
+address $2596
+address $2596
+address $2596
+address $2596
+address $2596
+address $2597
+address $2597
+address $2597
+address $2597
+address $2597
+address $2598
+address $2586
+address $2599
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2600
+address $2586
+address $2601
+address $2602
+address $2603
+address $2604
+address $2605
+address $2586
+address $2591
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2586
+address $2592
+code
+LABELV $2587
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Handicap_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2588
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_Effects_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2589
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_ClanName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2590
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2591
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_NetGameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2592
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_JoinGameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2593
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_Skill_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2594
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_TeamName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2595
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_TeamName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2596
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 UI_TeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2597
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 UI_TeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2598
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_NetSource_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2599
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_NetFilter_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2600
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_OpponentName_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2601
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_BotName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2602
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 UI_BotSkill_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+RETI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2603
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_RedBlue_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2604
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Crosshair_HandleKey
+CALLI4
+pop
+ADDRGP4 $2586
+JUMPV
+LABELV $2605
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_SelectedPlayer_HandleKey
+CALLI4
+pop
+LABELV $2586
+CNSTI4 0
+RETI4
+LABELV $2584
+endproc UI_OwnerDrawHandleKey 52 20
+proc UI_GetValue 0 0
+CNSTF4 0
+RETF4
+LABELV $2608
+endproc UI_GetValue 0 0
+proc UI_ServersQsortCompare 4 20
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2200
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2204
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_LAN_CompareServers
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $2609
+endproc UI_ServersQsortCompare 4 20
+export UI_ServersSort
+proc UI_ServersSort 0 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2616
+ADDRGP4 uiInfo+545444+2200
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2618
+ADDRGP4 $2615
+JUMPV
+LABELV $2618
+LABELV $2616
+ADDRGP4 uiInfo+545444+2200
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+545444+2220
+ARGP4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 UI_ServersQsortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $2615
+endproc UI_ServersSort 0 16
+proc UI_LoadMods 2100 16
+ADDRGP4 uiInfo+543296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2630
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 2068
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 2068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2634
+JUMPV
+LABELV $2631
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2072
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2080
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+543296
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+542784
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+543296
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+542784+4
+ADDP4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2088
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2092
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 2088
+INDIRI4
+ADDI4
+ADDRLP4 2092
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2096
+ADDRGP4 uiInfo+543296
+ASGNP4
+ADDRLP4 2096
+INDIRP4
+ADDRLP4 2096
+INDIRP4
+INDIRI4
+ADDRLP4 2092
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+543296
+INDIRI4
+CNSTI4 64
+LTI4 $2641
+ADDRGP4 $2633
+JUMPV
+LABELV $2641
+LABELV $2632
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2634
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $2631
+LABELV $2633
+LABELV $2628
+endproc UI_LoadMods 2100 16
+proc UI_LoadTeams 4120 16
+ADDRGP4 $109
+ARGP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4112
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4112
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2645
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2650
+JUMPV
+LABELV $2647
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4116
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_ParseTeamInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $2648
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2650
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $2647
+LABELV $2645
+LABELV $2644
+endproc UI_LoadTeams 4120 16
+proc UI_LoadMovies 4124 16
+ADDRGP4 $2653
+ARGP4
+ADDRGP4 $2654
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4108
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+545432
+ADDRLP4 4108
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+545432
+INDIRI4
+CNSTI4 0
+EQI4 $2655
+ADDRGP4 uiInfo+545432
+INDIRI4
+CNSTI4 256
+LEI4 $2658
+ADDRGP4 uiInfo+545432
+CNSTI4 256
+ASGNI4
+LABELV $2658
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2665
+JUMPV
+LABELV $2662
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4112
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI4 -4
+ADDP4
+ARGP4
+ADDRGP4 $2669
+ARGP4
+ADDRLP4 4116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4116
+INDIRI4
+CNSTI4 0
+NEI4 $2667
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $2667
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4120
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+544408
+ADDP4
+ADDRLP4 4120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $2663
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2665
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+545432
+INDIRI4
+LTI4 $2662
+LABELV $2655
+LABELV $2651
+endproc UI_LoadMovies 4124 16
+proc UI_LoadDemos 4168 16
+ADDRGP4 $2673
+ARGP4
+ADDRLP4 4140
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2672
+ARGP4
+ADDRLP4 4140
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2675
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4144
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+544328
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRGP4 $2673
+ARGP4
+ADDRLP4 4148
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2676
+ARGP4
+ADDRLP4 4148
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 uiInfo+544328
+INDIRI4
+CNSTI4 0
+EQI4 $2677
+ADDRGP4 uiInfo+544328
+INDIRI4
+CNSTI4 256
+LEI4 $2680
+ADDRGP4 uiInfo+544328
+CNSTI4 256
+ASGNI4
+LABELV $2680
+ADDRLP4 0
+ADDRLP4 44
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2687
+JUMPV
+LABELV $2684
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4152
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4152
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDRLP4 4156
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4160
+INDIRI4
+CNSTI4 0
+NEI4 $2689
+ADDRLP4 4
+ARGP4
+ADDRLP4 4164
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 4164
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $2689
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4164
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+543304
+ADDP4
+ADDRLP4 4164
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $2685
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2687
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+544328
+INDIRI4
+LTI4 $2684
+LABELV $2677
+LABELV $2671
+endproc UI_LoadDemos 4168 16
+proc UI_SetNextMap 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2696
+JUMPV
+LABELV $2693
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+108
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2698
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2692
+JUMPV
+LABELV $2698
+LABELV $2694
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2696
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LTI4 $2693
+CNSTI4 0
+RETI4
+LABELV $2692
+endproc UI_SetNextMap 8 16
+proc UI_StartSkirmish 2444 32
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2703
+ADDRGP4 $2705
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1056
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 UI_SetNextMap
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $2706
+ADDRGP4 $2707
+JUMPV
+LABELV $2706
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 178
+ARGI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $2707
+LABELV $2703
+ADDRLP4 1040
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2711
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRGP4 $2715
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 1056
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 1064
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1064
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2719
+ARGP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1101
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1072
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2720
+ARGP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+ADDRGP4 $2721
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1080
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2722
+ARGP4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2723
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1088
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1092
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2724
+ARGP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2725
+ARGP4
+ADDRLP4 1096
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1096
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2726
+ARGP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2727
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1104
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2728
+ARGP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2729
+ARGP4
+ADDRLP4 1112
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1112
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2730
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2731
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1120
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2225
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2732
+ARGP4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $471
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2721
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2723
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2729
+ARGP4
+ADDRGP4 $1077
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2731
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2725
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 1128
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2733
+ARGP4
+ADDRLP4 1128
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 1132
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2734
+ARGP4
+ADDRLP4 1132
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2737
+ARGP4
+ADDRLP4 1136
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1136
+INDIRF4
+CNSTF4 0
+EQF4 $2735
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2738
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2742
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2735
+ADDRLP4 1028
+CNSTI4 500
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+NEI4 $2743
+ADDRGP4 $2727
+ARGP4
+ADDRGP4 $2745
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2746
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2744
+JUMPV
+LABELV $2743
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2750
+ADDRGP4 $2727
+ARGP4
+ADDRGP4 $2752
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2729
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 1412
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1140
+ADDRLP4 1412
+ASGNP4
+ADDRLP4 1148
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2757
+JUMPV
+LABELV $2759
+ADDRLP4 1140
+ADDRLP4 1140
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2760
+ADDRLP4 1140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $2759
+ADDRLP4 1140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2762
+ADDRGP4 $2758
+JUMPV
+LABELV $2762
+ADDRLP4 1144
+ADDRLP4 1140
+INDIRP4
+ASGNP4
+ADDRGP4 $2765
+JUMPV
+LABELV $2764
+ADDRLP4 1140
+ADDRLP4 1140
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2765
+ADDRLP4 1140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $2764
+ADDRLP4 1140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2767
+ADDRLP4 2436
+ADDRLP4 1140
+INDIRP4
+ASGNP4
+ADDRLP4 1140
+ADDRLP4 2436
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2436
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $2767
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 2436
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 1152
+ADDRLP4 2436
+INDIRP4
+ASGNP4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRGP4 $1861
+ARGP4
+ADDRLP4 2440
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1144
+ADDRLP4 2440
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2746
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1148
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 1156
+ADDP4
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 50
+ADDI4
+ASGNI4
+ADDRLP4 1148
+ADDRLP4 1148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2757
+ADDRLP4 1140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2769
+ADDRLP4 1148
+INDIRI4
+CNSTI4 16
+LTI4 $2760
+LABELV $2769
+LABELV $2758
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2770
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2751
+JUMPV
+LABELV $2750
+ADDRLP4 1032
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+28
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2727
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2777
+JUMPV
+LABELV $2774
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 UI_AIFromName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2781
+ARGP4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2787
+ADDRLP4 1144
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 $2788
+JUMPV
+LABELV $2787
+ADDRLP4 1144
+ADDRGP4 $1224
+ASGNP4
+LABELV $2788
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2775
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2777
+ADDRLP4 1024
+INDIRI4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+28
+ADDP4
+INDIRI4
+LTI4 $2774
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 1144
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1148
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2792
+JUMPV
+LABELV $2789
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ADDRGP4 UI_AIFromName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2781
+ARGP4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2801
+ADDRLP4 1152
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 $2802
+JUMPV
+LABELV $2801
+ADDRLP4 1152
+ADDRGP4 $1225
+ASGNP4
+LABELV $2802
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2790
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2792
+ADDRLP4 1024
+INDIRI4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+28
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2789
+LABELV $2751
+LABELV $2744
+ADDRLP4 1040
+INDIRI4
+CNSTI4 3
+LTI4 $2803
+CNSTI4 2
+ARGI4
+ADDRGP4 $2805
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2803
+LABELV $2702
+endproc UI_StartSkirmish 2444 32
+proc UI_Update 56 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2809
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2807
+ADDRGP4 $2810
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1861
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2808
+JUMPV
+LABELV $2807
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2813
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2811
+ADDRGP4 $2814
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1167867904
+LTF4 $2815
+ADDRGP4 $2817
+ARGP4
+ADDRGP4 $1074
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2818
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2812
+JUMPV
+LABELV $2815
+ADDRLP4 16
+INDIRF4
+CNSTF4 1165623296
+LTF4 $2819
+ADDRGP4 $2817
+ARGP4
+ADDRGP4 $1077
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2818
+ARGP4
+ADDRGP4 $2745
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2812
+JUMPV
+LABELV $2819
+ADDRGP4 $2817
+ARGP4
+ADDRGP4 $1077
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2818
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2812
+JUMPV
+LABELV $2811
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2823
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2821
+ADDRGP4 $1861
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2810
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2822
+JUMPV
+LABELV $2821
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2826
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2824
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 16
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $2832
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $2835
+LABELV $2834
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2829
+ADDRGP4 $2825
+JUMPV
+LABELV $2835
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+EQI4 $2833
+ADDRGP4 $2825
+JUMPV
+LABELV $2829
+ADDRGP4 $2830
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2831
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2825
+JUMPV
+LABELV $2832
+ADDRGP4 $2830
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2831
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2825
+JUMPV
+LABELV $2833
+ADDRGP4 $2830
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2825
+JUMPV
+LABELV $2824
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2838
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2836
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2841
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $2843
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $2844
+ADDRGP4 $2837
+JUMPV
+LABELV $2841
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2837
+JUMPV
+LABELV $2843
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2837
+JUMPV
+LABELV $2844
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2837
+JUMPV
+LABELV $2836
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2847
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2845
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $2846
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+GTI4 $2846
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2866
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2866
+address $2850
+address $2862
+address $2863
+address $2865
+code
+LABELV $2850
+ADDRGP4 $2851
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2852
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2838
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2826
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2830
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2853
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2854
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2855
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2856
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2857
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2858
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2859
+ARGP4
+CNSTF4 1159479296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2860
+ARGP4
+ADDRGP4 $2861
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2846
+JUMPV
+LABELV $2862
+ADDRGP4 $2851
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2852
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2838
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2826
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2830
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2853
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2854
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2855
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2856
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2857
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2859
+ARGP4
+CNSTF4 1159479296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2860
+ARGP4
+ADDRGP4 $2861
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2858
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2846
+JUMPV
+LABELV $2863
+ADDRGP4 $2851
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2852
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2838
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2826
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2830
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2853
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2854
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2855
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2858
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2856
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2857
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2859
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2860
+ARGP4
+ADDRGP4 $2864
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2846
+JUMPV
+LABELV $2865
+ADDRGP4 $2851
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2842
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2852
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2838
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2826
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2830
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2854
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2853
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2855
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2858
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2859
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2856
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2857
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2860
+ARGP4
+ADDRGP4 $2864
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2846
+JUMPV
+LABELV $2845
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2869
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2867
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2870
+ADDRGP4 $2872
+ARGP4
+CNSTF4 1018444120
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2868
+JUMPV
+LABELV $2870
+ADDRGP4 $2872
+ARGP4
+CNSTF4 3165927768
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2868
+JUMPV
+LABELV $2867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2875
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $2873
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1271
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2874
+JUMPV
+LABELV $2873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2467
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $2879
+ADDRGP4 $2467
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 ui_netSource+12
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2467
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uiInfo+556992+3328
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10428
+CNSTI4 0
+ASGNI4
+LABELV $2879
+LABELV $2874
+LABELV $2868
+LABELV $2846
+LABELV $2837
+LABELV $2825
+LABELV $2822
+LABELV $2812
+LABELV $2808
+LABELV $2806
+endproc UI_Update 56 16
+export SP_LoadGame
+proc SP_LoadGame 0 0
+CNSTI4 0
+RETI4
+LABELV $2887
+endproc SP_LoadGame 0 0
+proc UI_RunMenuScript 1344 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1032
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $2889
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2893
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $2891
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $471
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 ui_dedicated+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $2894
+ARGP4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1095761920
+ARGF4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1060
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 1060
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2733
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 1068
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2734
+ARGP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2711
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1076
+INDIRF4
+ASGNF4
+ADDRGP4 $2727
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1080
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+LABELV $2902
+ADDRGP4 $1231
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1092
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 1096
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+LTI4 $2906
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2906
+ADDRGP4 $1232
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 1104
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+LTI4 $2908
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2908
+LABELV $2903
+ADDRLP4 1040
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 5
+LTI4 $2902
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2910
+ADDRLP4 1044
+CNSTI4 8
+ASGNI4
+LABELV $2910
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+LEI4 $2912
+ADDRLP4 1044
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+LABELV $2912
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2727
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $2914
+ADDRGP4 $1231
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1092
+ADDRLP4 1100
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 1
+LEI4 $2918
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2920
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2923
+ARGP4
+CNSTI4 24
+ADDRLP4 1092
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536-48
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 $1224
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2921
+JUMPV
+LABELV $2920
+ADDRLP4 1092
+INDIRI4
+CNSTI4 2
+SUBI4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2926
+ARGP4
+ADDRLP4 1104
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2921
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2918
+ADDRGP4 $1232
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1104
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1092
+ADDRLP4 1108
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 1
+LEI4 $2927
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2929
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2923
+ARGP4
+CNSTI4 24
+ADDRLP4 1092
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536-48
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 $1225
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2930
+JUMPV
+LABELV $2929
+ADDRLP4 1092
+INDIRI4
+CNSTI4 2
+SUBI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2926
+ARGP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2930
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2927
+LABELV $2915
+ADDRLP4 1040
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 5
+LTI4 $2914
+ADDRGP4 $2890
+JUMPV
+LABELV $2891
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2936
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2934
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 UI_GetIndexFromSelection
+CALLI4
+ASGNI4
+ADDRGP4 ui_mapIndex+12
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2705
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+ARGI4
+ADDRGP4 $2941
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 178
+ARGI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 179
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2934
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2936
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2942
+ADDRLP4 1048
+CNSTI1 0
+ASGNI1
+ADDRLP4 1048
+ARGP4
+ADDRGP4 $2941
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1080
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $2944
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2944
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 UI_GetIndexFromSelection
+CALLI4
+ASGNI4
+ADDRGP4 ui_mapIndex+12
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+ARGI4
+ADDRLP4 1088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2705
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 178
+ARGI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRLP4 1096
+CNSTI4 0
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 179
+ARGI4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2942
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2952
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2950
+ADDRLP4 1052
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2956
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2950
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2959
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2957
+CNSTI4 2
+ARGI4
+ADDRGP4 $2960
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2961
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 $2962
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2963
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2957
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2966
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2964
+ADDRLP4 0
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 trap_GetCDKey
+CALLV
+pop
+ADDRGP4 $2967
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2968
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2969
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2970
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 16
+NEI4 $2890
+ADDRLP4 1060
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2967
+ARGP4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 1060
+ARGP4
+ADDRLP4 0+4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2968
+ARGP4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 1060
+ARGP4
+ADDRLP4 0+8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2969
+ARGP4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 1060
+ARGP4
+ADDRLP4 0+12
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2970
+ARGP4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2964
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2978
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2976
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRGP4 $2967
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $2968
+ARGP4
+ADDRLP4 1068
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $2969
+ARGP4
+ADDRLP4 1072
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $2970
+ARGP4
+ADDRLP4 1076
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $2979
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2982
+ARGP4
+ADDRLP4 1080
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_VerifyCDKey
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+EQI4 $2980
+ADDRGP4 $2983
+ARGP4
+ADDRGP4 $2984
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetCDKey
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2980
+ADDRGP4 $2983
+ARGP4
+ADDRGP4 $2985
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2976
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2988
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2986
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $2989
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2986
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2988
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $2990
+ADDRLP4 1072
+CNSTI1 0
+ASGNI1
+ADDRLP4 1072
+ARGP4
+ADDRGP4 $2989
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1104
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $2992
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $2992
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1072
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2990
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2996
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $2994
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2994
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2999
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $2997
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2997
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3002
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $3000
+ADDRGP4 $3003
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3000
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3006
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $3004
+ADDRGP4 $1059
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 $1273
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3004
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3015
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $3013
+ADDRGP4 UI_ClearScores
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3013
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3018
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $3016
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRLP4 1096
+CNSTI4 1
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+ADDRLP4 1096
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3016
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3021
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $3019
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRLP4 1100
+CNSTI4 1
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+556928
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3019
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3031
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $3029
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRLP4 1104
+CNSTI4 1
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3029
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3034
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $3032
+ADDRGP4 uiInfo+73520
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRGP4 $3038
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3032
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3047
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $3045
+ADDRGP4 UI_LoadDemos
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3045
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3050
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $3048
+ADDRGP4 UI_LoadMovies
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3048
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3053
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $3051
+ADDRGP4 UI_LoadMods
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3051
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3056
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $3054
+ADDRGP4 uiInfo+545440
+INDIRI4
+CNSTI4 0
+LTI4 $3057
+ADDRGP4 uiInfo+545440
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $3057
+ADDRGP4 $3061
+ARGP4
+ADDRGP4 uiInfo+545436
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+544408
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3054
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3066
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $3064
+ADDRGP4 $3067
+ARGP4
+ADDRGP4 uiInfo+543300
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+542784
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $3070
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3064
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3073
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $3071
+ADDRGP4 $3074
+ARGP4
+ADDRGP4 uiInfo+544332
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+543304
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1132
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1132
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3071
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3079
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $3077
+ADDRGP4 $3067
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $3070
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3077
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3082
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $3080
+ADDRGP4 uiInfo+545444+2212
+INDIRI4
+CNSTI4 0
+EQI4 $3083
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10420
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+560324
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+565652
+CNSTI4 0
+ASGNI4
+ADDRLP4 1140
+CNSTI4 1
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+ARGI4
+ADDRLP4 1140
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3083
+ADDRGP4 $3091
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $241
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3080
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3094
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $3092
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10420
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+560324
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+565652
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2890
+JUMPV
+LABELV $3092
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3101
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $3099
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $3102
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+LABELV $3102
+ADDRLP4 1148
+CNSTI4 1
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+ARGI4
+ADDRLP4 1148
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTF4 1073741824
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3099
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3107
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $3105
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+556928
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3105
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3117
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $3115
+ADDRGP4 uiInfo+556928
+ARGP4
+ADDRGP4 uiInfo+565644
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+563596
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 14
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3115
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3124
+ARGP4
+ADDRLP4 1156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $3122
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildFindPlayerList
+CALLV
+pop
+ADDRGP4 uiInfo+556992+3328
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 14
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3122
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3129
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $3127
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $471
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 0
+LTI4 $2890
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+GEI4 $2890
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+ADDRGP4 $3143
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1164
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1164
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3127
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3146
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $3144
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uiInfo+565644
+INDIRI4
+CNSTI4 0
+LTI4 $2890
+ADDRGP4 uiInfo+565644
+INDIRI4
+ADDRGP4 uiInfo+565648
+INDIRI4
+GEI4 $2890
+ADDRGP4 $3143
+ARGP4
+ADDRGP4 uiInfo+565644
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+563596
+ADDP4
+ARGP4
+ADDRLP4 1168
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1168
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3144
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3156
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $3154
+ADDRGP4 $2718
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $3157
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3154
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3160
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $3158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1176
+ARGP4
+ADDRLP4 1180
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRLP4 1176
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3158
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3166
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $3164
+CNSTI4 2
+ARGI4
+ADDRGP4 $3167
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 uiInfo+228+8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3164
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3172
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $3170
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $3173
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1188
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+EQI4 $3177
+ADDRLP4 1188
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $3177
+LABELV $3174
+ADDRLP4 1184
+ADDRLP4 1184
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 16
+LTI4 $3173
+ADDRGP4 $3181
+JUMPV
+LABELV $3180
+ADDRLP4 1192
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 1192
+INDIRP4
+ADDRLP4 1192
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRGP4 uiInfo+78664
+INDIRI4
+LTI4 $3188
+ADDRGP4 ui_gameType+12
+CNSTI4 0
+ASGNI4
+LABELV $3188
+LABELV $3181
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3180
+ADDRGP4 $3194
+JUMPV
+LABELV $3193
+ADDRLP4 1192
+ADDRGP4 ui_netGameType+12
+ASGNP4
+ADDRLP4 1192
+INDIRP4
+ADDRLP4 1192
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+78664
+INDIRI4
+LTI4 $3201
+ADDRGP4 ui_netGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $3201
+LABELV $3194
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3193
+ADDRGP4 $2890
+JUMPV
+LABELV $3170
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3208
+ARGP4
+ADDRLP4 1184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $3206
+ADDRLP4 1188
+CNSTI4 0
+ASGNI4
+LABELV $3209
+ADDRLP4 1188
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3210
+ADDRLP4 1188
+ADDRLP4 1188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 16
+LTI4 $3209
+ADDRGP4 $2890
+JUMPV
+LABELV $3206
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3216
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $3214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRLP4 1192
+INDIRI4
+ADDRGP4 uiInfo+545444+2200
+INDIRI4
+NEI4 $3219
+ADDRGP4 uiInfo+545444+2204
+INDIRI4
+CNSTI4 0
+NEI4 $3228
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3229
+JUMPV
+LABELV $3228
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $3229
+ADDRGP4 uiInfo+545444+2204
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+LABELV $3219
+ADDRLP4 1192
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_ServersSort
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3214
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3232
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $3230
+CNSTI4 1
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3230
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3235
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $3233
+ADDRLP4 1200
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1232
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+EQI4 $3236
+ADDRLP4 1200
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 1200
+ARGP4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3236
+CNSTI4 1
+ARGI4
+ADDRGP4 $2941
+ARGP4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3233
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3240
+ARGP4
+ADDRLP4 1200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $3238
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3238
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3243
+ARGP4
+ADDRLP4 1204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $3241
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3241
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3246
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $3244
+ADDRLP4 1212
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3244
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3249
+ARGP4
+ADDRLP4 1212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $3247
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $2890
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+GEI4 $2890
+ADDRGP4 $3255
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1216
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3247
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3261
+ARGP4
+ADDRLP4 1216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $3259
+ADDRGP4 uiInfo+79016
+INDIRI4
+CNSTI4 0
+LTI4 $2890
+ADDRGP4 uiInfo+79016
+INDIRI4
+ADDRGP4 uiInfo+79000
+INDIRI4
+GEI4 $2890
+ADDRGP4 $3267
+ARGP4
+ADDRGP4 uiInfo+79016
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+79028
+ADDP4
+ARGP4
+ADDRLP4 1220
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1220
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3259
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3272
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $3270
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $2890
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+78664
+INDIRI4
+GEI4 $2890
+ADDRGP4 $3278
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3270
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3284
+ARGP4
+ADDRLP4 1224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $3282
+ADDRGP4 uiInfo+79008
+INDIRI4
+CNSTI4 0
+LTI4 $2890
+ADDRGP4 uiInfo+79008
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $2890
+ADDRGP4 $3290
+ARGP4
+ADDRGP4 uiInfo+79008
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3282
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3295
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $3293
+ADDRGP4 $1775
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1232
+INDIRF4
+CNSTF4 1077936128
+LTF4 $3296
+ADDRGP4 $3296
+JUMPV
+ADDRGP4 $3298
+ARGP4
+CNSTI4 24
+ADDRGP4 uiInfo+73532
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+542780
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 uiInfo+78996
+INDIRI4
+CNSTI4 0
+NEI4 $3304
+ADDRLP4 1236
+ADDRGP4 $1225
+ASGNP4
+ADDRGP4 $3305
+JUMPV
+LABELV $3304
+ADDRLP4 1236
+ADDRGP4 $1224
+ASGNP4
+LABELV $3305
+ADDRLP4 1236
+INDIRP4
+ARGP4
+ADDRLP4 1240
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1240
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3296
+ADDRGP4 uiInfo+73532
+INDIRI4
+ARGI4
+ADDRLP4 1240
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRGP4 $3298
+ARGP4
+ADDRLP4 1240
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+542780
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 uiInfo+78996
+INDIRI4
+CNSTI4 0
+NEI4 $3310
+ADDRLP4 1236
+ADDRGP4 $1225
+ASGNP4
+ADDRGP4 $3311
+JUMPV
+LABELV $3310
+ADDRLP4 1236
+ADDRGP4 $1224
+ASGNP4
+LABELV $3311
+ADDRLP4 1236
+INDIRP4
+ARGP4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1244
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3293
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3314
+ARGP4
+ADDRLP4 1232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $3312
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1236
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3320
+ARGP4
+ADDRLP4 1268
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1236
+ARGP4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1236
+ARGP4
+ADDRLP4 1272
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 0
+LEI4 $3321
+ADDRGP4 $3323
+ARGP4
+ADDRLP4 1236
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3321
+ADDRGP4 $3323
+ARGP4
+ADDRGP4 $3324
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3312
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3327
+ARGP4
+ADDRLP4 1236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $3325
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+EQI4 $2890
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1308
+CNSTI1 0
+ASGNI1
+ADDRLP4 1240
+ADDRLP4 1308
+INDIRI1
+ASGNI1
+ADDRLP4 1272
+ADDRLP4 1308
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3320
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1272
+ARGP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3336
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1240
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1272
+ARGP4
+ADDRLP4 1320
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+ADDRLP4 1240
+ARGP4
+ADDRLP4 1324
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+CNSTI4 3
+ARGI4
+ADDRLP4 1272
+ARGP4
+ADDRLP4 1240
+ARGP4
+ADDRLP4 1328
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1304
+ADDRLP4 1328
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 0
+NEI4 $3339
+ADDRGP4 $3341
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3339
+ADDRLP4 1304
+INDIRI4
+CNSTI4 -1
+NEI4 $3342
+ADDRGP4 $3344
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3342
+ADDRGP4 $3345
+ARGP4
+ADDRLP4 1240
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3325
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3348
+ARGP4
+ADDRLP4 1240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $3346
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+NEI4 $2890
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1244
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3336
+ARGP4
+ADDRLP4 1276
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1244
+ARGP4
+ADDRLP4 1276
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1244
+ARGP4
+ADDRLP4 1280
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+CNSTI4 3
+ARGI4
+ADDRLP4 1244
+ARGP4
+ADDRGP4 trap_LAN_RemoveServer
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3346
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3361
+ARGP4
+ADDRLP4 1244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 0
+NEI4 $3359
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+NEI4 $3362
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1248
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3336
+ARGP4
+ADDRLP4 1280
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1248
+ARGP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1248
+ARGP4
+ADDRLP4 1284
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+CNSTI4 0
+LEI4 $3370
+CNSTI4 3
+ARGI4
+ADDRLP4 1248
+ARGP4
+ADDRGP4 trap_LAN_RemoveServer
+CALLV
+pop
+LABELV $3370
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRLP4 1288
+CNSTI4 1
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+ARGI4
+ADDRLP4 1288
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3362
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1316
+CNSTI1 0
+ASGNI1
+ADDRLP4 1248
+ADDRLP4 1316
+INDIRI1
+ASGNI1
+ADDRLP4 1280
+ADDRLP4 1316
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3320
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1280
+ARGP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $3336
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1248
+ARGP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1280
+ARGP4
+ADDRLP4 1328
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+ADDRLP4 1248
+ARGP4
+ADDRLP4 1332
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+CNSTI4 3
+ARGI4
+ADDRLP4 1280
+ARGP4
+ADDRLP4 1248
+ARGP4
+ADDRLP4 1336
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1312
+ADDRLP4 1336
+INDIRI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 0
+NEI4 $3379
+ADDRGP4 $3341
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3379
+ADDRLP4 1312
+INDIRI4
+CNSTI4 -1
+NEI4 $3381
+ADDRGP4 $3344
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3381
+ADDRGP4 $3345
+ARGP4
+ADDRLP4 1248
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3359
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3385
+ARGP4
+ADDRLP4 1248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $3383
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+NEI4 $2890
+ADDRLP4 1320
+CNSTI1 0
+ASGNI1
+ADDRLP4 1252
+ADDRLP4 1320
+INDIRI1
+ASGNI1
+ADDRLP4 1284
+ADDRLP4 1320
+INDIRI1
+ASGNI1
+ADDRGP4 $3389
+ARGP4
+ADDRLP4 1324
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1284
+ARGP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $3390
+ARGP4
+ADDRLP4 1328
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1252
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1284
+ARGP4
+ADDRLP4 1332
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+ADDRLP4 1252
+ARGP4
+ADDRLP4 1336
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+LEI4 $2890
+CNSTI4 3
+ARGI4
+ADDRLP4 1284
+ARGP4
+ADDRLP4 1252
+ARGP4
+ADDRLP4 1340
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1316
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+NEI4 $3393
+ADDRGP4 $3341
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3393
+ADDRLP4 1316
+INDIRI4
+CNSTI4 -1
+NEI4 $3395
+ADDRGP4 $3344
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3395
+ADDRGP4 $3345
+ARGP4
+ADDRLP4 1252
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3383
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3399
+ARGP4
+ADDRLP4 1252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $3397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1256
+ARGP4
+ADDRLP4 1260
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 1268
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1264
+ADDRLP4 1268
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $3402
+ADDRLP4 0
+ARGP4
+ADDRLP4 1256
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+83124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1272
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $3406
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $3403
+JUMPV
+LABELV $3402
+ADDRLP4 1272
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3410
+JUMPV
+LABELV $3407
+ADDRGP4 $1861
+ARGP4
+ADDRLP4 1276
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1276
+INDIRP4
+ARGP4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+NEI4 $3412
+ADDRGP4 $3408
+JUMPV
+LABELV $3412
+ADDRLP4 0
+ARGP4
+ADDRLP4 1256
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+ARGP4
+ADDRLP4 1284
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1284
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $3406
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $3408
+ADDRLP4 1272
+ADDRLP4 1272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3410
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+LTI4 $3407
+LABELV $3403
+ADDRLP4 1272
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3397
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3418
+ARGP4
+ADDRLP4 1256
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+NEI4 $3416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1260
+ARGP4
+ADDRLP4 1264
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 1272
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1268
+ADDRLP4 1272
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+NEI4 $3421
+CNSTI4 2
+ARGI4
+ADDRLP4 1260
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $3406
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $3421
+ADDRLP4 1276
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3416
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3426
+ARGP4
+ADDRLP4 1260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+NEI4 $3424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1264
+ARGP4
+ADDRLP4 1268
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 1276
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1272
+ADDRLP4 1276
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $3429
+ADDRLP4 0
+ARGP4
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+83124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1280
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $3406
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $3429
+ADDRLP4 1280
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3424
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3435
+ARGP4
+ADDRLP4 1264
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $3433
+ADDRGP4 $2847
+ARGP4
+ADDRGP4 $3436
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3433
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3439
+ARGP4
+ADDRLP4 1268
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+CNSTI4 0
+NEI4 $3437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1272
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 UI_Update
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $3437
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3444
+ARGP4
+ADDRLP4 1272
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+CNSTI4 0
+NEI4 $2890
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1276
+ARGP4
+ADDRLP4 1280
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+EQI4 $2890
+ADDRLP4 1276
+INDIRI4
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+ADDRGP4 $2890
+JUMPV
+LABELV $2889
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $3449
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $3447
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3448
+JUMPV
+LABELV $3447
+ADDRGP4 $3450
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3448
+LABELV $2890
+LABELV $2888
+endproc UI_RunMenuScript 1344 24
+proc UI_GetTeamColor 0 0
+LABELV $3451
+endproc UI_GetTeamColor 0 0
+proc UI_MapCountByGameType 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $3460
+ADDRLP4 12
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $3461
+JUMPV
+LABELV $3460
+ADDRLP4 12
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3461
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $3462
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3462
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $3464
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $3464
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3469
+JUMPV
+LABELV $3466
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+108
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+32
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $3473
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3477
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+32
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $3479
+ADDRGP4 $3467
+JUMPV
+LABELV $3479
+LABELV $3477
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+108
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $3473
+LABELV $3467
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3469
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LTI4 $3466
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $3452
+endproc UI_MapCountByGameType 24 0
+export UI_hasSkinForBase
+proc UI_hasSkinForBase 1032 20
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3486
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1024
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+EQI4 $3487
+CNSTI4 1
+RETI4
+ADDRGP4 $3485
+JUMPV
+LABELV $3487
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3489
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1028
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $3490
+CNSTI4 1
+RETI4
+ADDRGP4 $3485
+JUMPV
+LABELV $3490
+CNSTI4 0
+RETI4
+LABELV $3485
+endproc UI_hasSkinForBase 1032 20
+data
+align 4
+LABELV $3493
+byte 4 0
+code
+proc UI_HeadCountByTeam 44 8
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $3493
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $3494
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3499
+JUMPV
+LABELV $3496
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3506
+JUMPV
+LABELV $3503
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_hasSkinForBase
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $3508
+ADDRLP4 28
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+20
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 8
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $3508
+LABELV $3504
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3506
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+LTI4 $3503
+LABELV $3497
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3499
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+LTI4 $3496
+ADDRGP4 $3493
+CNSTI4 1
+ASGNI4
+LABELV $3494
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3518
+JUMPV
+LABELV $3515
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $3522
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3526
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $3530
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3524
+JUMPV
+LABELV $3530
+LABELV $3526
+LABELV $3523
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $3522
+LABELV $3524
+LABELV $3516
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3518
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+LTI4 $3515
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $3536
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3543
+JUMPV
+LABELV $3540
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3545
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3548
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3556
+JUMPV
+LABELV $3553
+ADDRLP4 36
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+73536+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $3558
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+73536+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $3558
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $3558
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3555
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3555
+JUMPV
+LABELV $3558
+LABELV $3554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3556
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+LTI4 $3553
+LABELV $3555
+LABELV $3548
+LABELV $3545
+LABELV $3541
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3543
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+75072
+INDIRI4
+LTI4 $3540
+LABELV $3537
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $3536
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $3492
+endproc UI_HeadCountByTeam 44 8
+proc UI_InsertServerIntoDisplayList 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3578
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+LEI4 $3574
+LABELV $3578
+ADDRGP4 $3573
+JUMPV
+LABELV $3574
+ADDRLP4 8
+ADDRGP4 uiInfo+545444+10412
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+ASGNI4
+ADDRGP4 $3584
+JUMPV
+LABELV $3581
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+545444+2220-4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3582
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3584
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $3581
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $3573
+endproc UI_InsertServerIntoDisplayList 16 0
+proc UI_RemoveServerFromDisplayList 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3598
+JUMPV
+LABELV $3595
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3601
+ADDRLP4 8
+ADDRGP4 uiInfo+545444+10412
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3610
+JUMPV
+LABELV $3607
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+545444+2220+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3608
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3610
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+LTI4 $3607
+ADDRGP4 $3594
+JUMPV
+LABELV $3601
+LABELV $3596
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3598
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+LTI4 $3595
+LABELV $3594
+endproc UI_RemoveServerFromDisplayList 16 0
+proc UI_BinaryServerInsertion 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3622
+JUMPV
+LABELV $3621
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2200
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+2204
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_LAN_CompareServers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3631
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 UI_InsertServerIntoDisplayList
+CALLV
+pop
+ADDRGP4 $3618
+JUMPV
+LABELV $3631
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $3633
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $3634
+JUMPV
+LABELV $3633
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $3634
+LABELV $3622
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $3621
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $3635
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3635
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_InsertServerIntoDisplayList
+CALLV
+pop
+LABELV $3618
+endproc UI_BinaryServerInsertion 28 20
+proc UI_BuildServerDisplayList 1120 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3638
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 uiInfo+545444+10420
+INDIRI4
+GTI4 $3638
+ADDRGP4 $3637
+JUMPV
+LABELV $3638
+ADDRGP4 $3643
+ARGP4
+ADDRGP4 uiInfo+545444+10460
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10460
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $3650
+ADDRGP4 uiInfo+545444+10460
+ARGP4
+ADDRGP4 $3654
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 uiInfo+545444+10460
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+LABELV $3650
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 uiInfo+545444+10436
+INDIRI4
+EQI4 $3657
+ADDRGP4 uiInfo+545444+10436
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10440
+CNSTI4 -1
+ASGNI4
+LABELV $3657
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3665
+ADDRGP4 uiInfo+545444+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10416
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+LABELV $3665
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+EQI4 $3676
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+NEI4 $3673
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+NEI4 $3673
+LABELV $3676
+ADDRGP4 uiInfo+545444+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10416
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10420
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 $3637
+JUMPV
+LABELV $3673
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 $3687
+JUMPV
+LABELV $3684
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 trap_LAN_ServerIsVisible
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $3688
+ADDRGP4 $3685
+JUMPV
+LABELV $3688
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 trap_LAN_GetServerPing
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $3695
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+NEI4 $3692
+LABELV $3695
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $3699
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1084
+INDIRF4
+CNSTF4 0
+EQF4 $3697
+ADDRLP4 8
+ARGP4
+ADDRGP4 $3700
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $3698
+JUMPV
+LABELV $3697
+ADDRLP4 8
+ARGP4
+ADDRGP4 $3701
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+LABELV $3698
+ADDRLP4 1104
+ADDRGP4 uiInfo+545444+10416
+ASGNP4
+ADDRLP4 1104
+INDIRP4
+ADDRLP4 1104
+INDIRP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CNSTI4 0
+NEI4 $3704
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $3707
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $3685
+JUMPV
+LABELV $3707
+LABELV $3704
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CNSTI4 0
+NEI4 $3710
+ADDRLP4 8
+ARGP4
+ADDRGP4 $1812
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+NEI4 $3713
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $3685
+JUMPV
+LABELV $3713
+LABELV $3710
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78800+4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $3716
+ADDRLP4 8
+ARGP4
+ADDRGP4 $3721
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78800+4
+ADDP4
+INDIRI4
+EQI4 $3722
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $3685
+JUMPV
+LABELV $3722
+LABELV $3716
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+LEI4 $3728
+ADDRLP4 8
+ARGP4
+ADDRGP4 $3733
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverFilters+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+EQI4 $3729
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $3685
+JUMPV
+LABELV $3728
+ADDRLP4 8
+ARGP4
+ADDRGP4 $3733
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3739
+ARGP4
+ADDRLP4 1112
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+EQI4 $3737
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $3685
+JUMPV
+LABELV $3737
+LABELV $3729
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+NEI4 $3741
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_RemoveServerFromDisplayList
+CALLV
+pop
+LABELV $3741
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_BinaryServerInsertion
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $3744
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+LABELV $3744
+LABELV $3692
+LABELV $3685
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3687
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LTI4 $3684
+ADDRGP4 uiInfo+545444+2192
+ADDRGP4 uiInfo+208
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $3750
+LABELV $3750
+LABELV $3637
+endproc UI_BuildServerDisplayList 1120 16
+data
+export serverStatusCvars
+align 4
+LABELV serverStatusCvars
+address $3753
+address $3754
+address $3755
+address $109
+address $3756
+address $3757
+address $1775
+address $3758
+address $3759
+address $3760
+address $3761
+address $109
+address $2673
+address $109
+address $3762
+address $109
+address $1101
+address $109
+byte 4 0
+byte 4 0
+code
+proc UI_SortServerStatusInfo 64 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $3767
+JUMPV
+LABELV $3764
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3771
+JUMPV
+LABELV $3768
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3774
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3772
+LABELV $3774
+ADDRGP4 $3769
+JUMPV
+LABELV $3772
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3775
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $3777
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars+4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $3777
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3775
+LABELV $3769
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3771
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+LTI4 $3768
+LABELV $3765
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3767
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3764
+LABELV $3763
+endproc UI_SortServerStatusInfo 64 8
+proc UI_GetServerStatusInfo 184 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3782
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3781
+JUMPV
+LABELV $3782
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 3332
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2112
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $3784
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 2112
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $3755
+ASGNP4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3787
+JUMPV
+LABELV $3786
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 56
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3789
+ADDRGP4 $3788
+JUMPV
+LABELV $3789
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $3791
+ADDRGP4 $3788
+JUMPV
+LABELV $3791
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 80
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3793
+ADDRGP4 $3788
+JUMPV
+LABELV $3793
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $3795
+ADDRGP4 $3788
+JUMPV
+LABELV $3795
+LABELV $3787
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3797
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3786
+LABELV $3797
+LABELV $3788
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 125
+GEI4 $3798
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $109
+ASGNP4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $3800
+ASGNP4
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRGP4 $3801
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $3802
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1861
+ASGNP4
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $3804
+JUMPV
+LABELV $3803
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $3806
+ADDRLP4 112
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $3806
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3808
+ADDRGP4 $3805
+JUMPV
+LABELV $3808
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 120
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3810
+ADDRGP4 $3805
+JUMPV
+LABELV $3810
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 124
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 132
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3812
+ADDRGP4 $3805
+JUMPV
+LABELV $3812
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 192
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $3814
+ADDRGP4 $3805
+JUMPV
+LABELV $3814
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 176
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3816
+ADDRGP4 $3805
+JUMPV
+LABELV $3816
+ADDRLP4 180
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3804
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3818
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3803
+LABELV $3818
+LABELV $3805
+LABELV $3798
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_SortServerStatusInfo
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $3781
+JUMPV
+LABELV $3784
+CNSTI4 0
+RETI4
+LABELV $3781
+endproc UI_GetServerStatusInfo 184 16
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $3821
+JUMPV
+LABELV $3820
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3826
+JUMPV
+LABELV $3823
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $3827
+ADDRGP4 $3825
+JUMPV
+LABELV $3827
+LABELV $3824
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3826
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $3829
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $3823
+LABELV $3829
+LABELV $3825
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3830
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $3819
+JUMPV
+LABELV $3830
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $3821
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3820
+CNSTP4 0
+RETP4
+LABELV $3819
+endproc stristr 12 4
+bss
+align 4
+LABELV $3833
+skip 4
+align 4
+LABELV $3834
+skip 4
+code
+proc UI_BuildFindPlayerList 4424 24
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3835
+ADDRGP4 uiInfo+565652
+INDIRI4
+CNSTI4 0
+EQI4 $3842
+ADDRGP4 uiInfo+565652
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+LEI4 $3836
+LABELV $3842
+ADDRGP4 $3832
+JUMPV
+LABELV $3835
+ADDRGP4 uiInfo+560328
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2244
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 uiInfo+565648
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+565644
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3847
+ARGP4
+ADDRGP4 uiInfo+562572
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 uiInfo+562572
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+562572
+ARGP4
+ADDRLP4 4404
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4404
+INDIRI4
+CNSTI4 0
+NEI4 $3851
+ADDRGP4 uiInfo+565652
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3832
+JUMPV
+LABELV $3851
+ADDRLP4 4400
+ADDRGP4 ui_serverStatusTimeOut+12
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 10
+SUBI4
+ASGNI4
+ADDRLP4 4400
+INDIRI4
+CNSTI4 50
+GEI4 $3856
+ADDRLP4 4400
+CNSTI4 50
+ASGNI4
+LABELV $3856
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4400
+INDIRI4
+ARGI4
+ADDRLP4 4408
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $3858
+ARGP4
+ADDRLP4 4408
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+ADDRGP4 uiInfo+565648
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+564620-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3866
+ARGP4
+ADDRGP4 uiInfo+560328
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3833
+CNSTI4 0
+ASGNI4
+ADDRLP4 4412
+ADDRGP4 $3834
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3836
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3868
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3872
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4404
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+ASGNI4
+ADDRLP4 4404
+INDIRI4
+CNSTI4 0
+EQI4 $3877
+ADDRLP4 4408
+ADDRGP4 $3833
+ASGNP4
+ADDRLP4 4408
+INDIRP4
+ADDRLP4 4408
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3884
+JUMPV
+LABELV $3881
+ADDRLP4 4412
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4412
+INDIRI4
+ADDRLP4 8+64+8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3892
+ADDRLP4 4412
+INDIRI4
+ADDRLP4 8+64+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3886
+LABELV $3892
+ADDRGP4 $3882
+JUMPV
+LABELV $3886
+ADDRLP4 3340
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 8+64+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3340
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 3340
+ARGP4
+ADDRGP4 uiInfo+562572
+ARGP4
+ADDRLP4 4416
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 4416
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3895
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 15
+GEI4 $3898
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+563596-64
+ADDP4
+ARGP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+564620-64
+ADDP4
+ARGP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4420
+ADDRGP4 uiInfo+565648
+ASGNP4
+ADDRLP4 4420
+INDIRP4
+ADDRLP4 4420
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3899
+JUMPV
+LABELV $3898
+ADDRGP4 uiInfo+560328
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+ASGNI4
+LABELV $3899
+LABELV $3895
+LABELV $3882
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3884
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8+3328
+INDIRI4
+LTI4 $3881
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+564620-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3924
+ARGP4
+ADDRGP4 uiInfo+560328
+INDIRI4
+ARGI4
+ADDRGP4 $3833
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3877
+LABELV $3872
+ADDRLP4 4404
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4404
+INDIRI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3939
+ADDRLP4 4404
+INDIRI4
+ADDRGP4 uiInfo+560328+4+128
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 ui_serverStatusTimeOut+12
+INDIRI4
+SUBI4
+GEI4 $3929
+LABELV $3939
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3940
+ADDRLP4 4408
+ADDRGP4 $3834
+ASGNP4
+ADDRLP4 4408
+INDIRP4
+ADDRLP4 4408
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3940
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+560328
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+GEI4 $3950
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+128
+ADDP4
+ADDRGP4 uiInfo+208
+INDIRI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+560328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+560328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3374
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 3374
+ARGP4
+ADDRGP4 $3320
+ARGP4
+ADDRLP4 4408
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+64
+ADDP4
+ARGP4
+ADDRLP4 4408
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4412
+ADDRGP4 uiInfo+560328
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+564620-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3924
+ARGP4
+ADDRGP4 uiInfo+560328
+INDIRI4
+ARGI4
+ADDRGP4 $3833
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3950
+LABELV $3929
+LABELV $3869
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3868
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3988
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+560328+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3992
+ADDRGP4 $3990
+JUMPV
+LABELV $3992
+LABELV $3989
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3988
+LABELV $3990
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+GEI4 $3997
+ADDRGP4 uiInfo+565652
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRGP4 $3998
+JUMPV
+LABELV $3997
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 0
+NEI4 $4001
+ADDRGP4 $4002
+JUMPV
+LABELV $4001
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+564620-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $4008
+ARGP4
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 2
+NEI4 $4014
+ADDRLP4 4404
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 $4015
+JUMPV
+LABELV $4014
+ADDRLP4 4404
+ADDRGP4 $4011
+ASGNP4
+LABELV $4015
+ADDRLP4 4404
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+562572
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4002
+ADDRGP4 uiInfo+565652
+CNSTI4 0
+ASGNI4
+CNSTF4 1096810496
+ARGF4
+ADDRGP4 uiInfo+565644
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $3998
+LABELV $3832
+endproc UI_BuildFindPlayerList 4424 24
+proc UI_BuildServerStatus 8 16
+ADDRGP4 uiInfo+565652
+INDIRI4
+CNSTI4 0
+EQI4 $4019
+ADDRGP4 $4018
+JUMPV
+LABELV $4019
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4022
+ADDRGP4 uiInfo+560324
+INDIRI4
+CNSTI4 0
+EQI4 $4029
+ADDRGP4 uiInfo+560324
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+LEI4 $4023
+LABELV $4029
+ADDRGP4 $4018
+JUMPV
+LABELV $4022
+CNSTP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 uiInfo+556992+3328
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+LABELV $4023
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $4043
+ADDRGP4 uiInfo+545444+2216
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+GTI4 $4043
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $4032
+LABELV $4043
+ADDRGP4 $4018
+JUMPV
+LABELV $4032
+ADDRGP4 uiInfo+556928
+ARGP4
+ADDRGP4 uiInfo+556992
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4044
+ADDRGP4 uiInfo+560324
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+556928
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+pop
+ADDRGP4 $4045
+JUMPV
+LABELV $4044
+ADDRGP4 uiInfo+560324
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $4045
+LABELV $4018
+endproc UI_BuildServerStatus 8 16
+proc UI_FeederCount 12 4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $4053
+ADDRLP4 0
+ADDRGP4 UI_HeadCountByTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4053
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $4055
+ADDRGP4 uiInfo+565668
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4055
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $4058
+ADDRGP4 uiInfo+545432
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4058
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $4063
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $4061
+LABELV $4063
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $4065
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4066
+JUMPV
+LABELV $4065
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $4066
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4061
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $4067
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4067
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $4071
+ADDRGP4 uiInfo+556992+3328
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4071
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $4075
+ADDRGP4 uiInfo+565648
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4075
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $4078
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 uiInfo+79012
+INDIRI4
+LEI4 $4080
+ADDRGP4 uiInfo+79012
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $4080
+ADDRGP4 uiInfo+79000
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4078
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $4087
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 uiInfo+79012
+INDIRI4
+LEI4 $4089
+ADDRGP4 uiInfo+79012
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $4089
+ADDRGP4 uiInfo+79004
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4087
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $4096
+ADDRGP4 uiInfo+543296
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4096
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $4099
+ADDRGP4 uiInfo+544328
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4099
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+NEF4 $4102
+ADDRGP4 uiInfo+544400
+INDIRI4
+RETI4
+ADDRGP4 $4052
+JUMPV
+LABELV $4102
+CNSTI4 0
+RETI4
+LABELV $4052
+endproc UI_FeederCount 12 4
+proc UI_SelectedMap 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4109
+JUMPV
+LABELV $4106
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+108
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4111
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $4115
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4105
+JUMPV
+LABELV $4115
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4111
+LABELV $4107
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4109
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LTI4 $4106
+ADDRGP4 $109
+RETP4
+LABELV $4105
+endproc UI_SelectedMap 12 0
+proc UI_SelectedHead 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4122
+JUMPV
+LABELV $4119
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4124
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $4128
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4118
+JUMPV
+LABELV $4128
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4124
+LABELV $4120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+LTI4 $4119
+ADDRGP4 $109
+RETP4
+LABELV $4118
+endproc UI_SelectedHead 12 0
+proc UI_GetIndexFromSelection 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4135
+JUMPV
+LABELV $4132
+CNSTI4 112
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+108
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $4137
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $4141
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $4131
+JUMPV
+LABELV $4141
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4137
+LABELV $4133
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4135
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+LTI4 $4132
+CNSTI4 0
+RETI4
+LABELV $4131
+endproc UI_GetIndexFromSelection 12 0
+proc UI_UpdatePendingPings 0 4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ResetPings
+CALLV
+pop
+ADDRGP4 uiInfo+545444+2212
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+545444+2192
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $4143
+endproc UI_UpdatePendingPings 0 4
+bss
+align 1
+LABELV $4151
+skip 1024
+align 1
+LABELV $4152
+skip 1024
+align 1
+LABELV $4153
+skip 32
+data
+align 4
+LABELV $4154
+byte 4 -1
+align 4
+LABELV $4155
+byte 4 0
+code
+proc UI_FeederItemText 68 20
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $4156
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_SelectedHead
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4156
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $4158
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4159
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+565668
+INDIRI4
+GEI4 $4159
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+565672
+ADDP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4158
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+NEF4 $4164
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4165
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+646460
+INDIRI4
+GEI4 $4165
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+646464
+ADDP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4164
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $4172
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $4170
+LABELV $4172
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_SelectedMap
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4170
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $4173
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4174
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+GEI4 $4174
+ADDRGP4 $4154
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $4182
+ADDRGP4 $4155
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 5000
+ADDI4
+LEI4 $4179
+LABELV $4182
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $4151
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $4154
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $4155
+ADDRGP4 uiInfo+208
+INDIRI4
+ASGNI4
+LABELV $4179
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3802
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $4187
+LABELV $4187
+ADDRLP4 24
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $4174
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+GTI4 $4174
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4213
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4213
+address $4191
+address $4199
+address $4200
+address $4205
+address $4209
+code
+LABELV $4191
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $4192
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3336
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4192
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4194
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3320
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $4198
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $4152
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $4197
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4152
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4194
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3320
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $4152
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4152
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4199
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3759
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4200
+ADDRGP4 $3699
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $4203
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3700
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 $4204
+JUMPV
+LABELV $4203
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3701
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $4204
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $1812
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $4153
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $4201
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4153
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4205
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3721
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $4206
+ADDRLP4 60
+INDIRI4
+ADDRGP4 numTeamArenaGameTypes
+INDIRI4
+GEI4 $4206
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamArenaGameTypes
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4206
+ADDRGP4 $4208
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4209
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $4210
+ADDRGP4 $4212
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4210
+ADDRGP4 $4151
+ARGP4
+ADDRGP4 $3802
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4173
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $4214
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4215
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+556992+3328
+INDIRI4
+GEI4 $4215
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $4215
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+GEI4 $4215
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 uiInfo+556992+64
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4214
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $4224
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4225
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+565648
+INDIRI4
+GEI4 $4225
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+564620
+ADDP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4224
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $4230
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4231
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+79000
+INDIRI4
+GEI4 $4231
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+79028
+ADDP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4230
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $4236
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4237
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+79004
+INDIRI4
+GEI4 $4237
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+81076
+ADDP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4236
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $4242
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4243
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+543296
+INDIRI4
+GEI4 $4243
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+542784+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4247
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+542784+4
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4247
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+542784+4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4247
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+542784
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4242
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $4256
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4257
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+545432
+INDIRI4
+GEI4 $4257
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+544408
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4256
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $4262
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4264
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+544328
+INDIRI4
+GEI4 $4264
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+543304
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $4150
+JUMPV
+LABELV $4264
+LABELV $4262
+LABELV $4257
+LABELV $4243
+LABELV $4237
+LABELV $4231
+LABELV $4225
+LABELV $4215
+LABELV $4174
+LABELV $4165
+LABELV $4159
+ADDRGP4 $109
+RETP4
+LABELV $4150
+endproc UI_FeederItemText 68 20
+proc UI_FeederItemImage 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $4269
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedHead
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4270
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+GEI4 $4270
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $4274
+ADDRLP4 8
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+73536+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+73536+8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $4274
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+8
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $4268
+JUMPV
+LABELV $4269
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $4284
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4285
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+565668
+INDIRI4
+GEI4 $4285
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+631208
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $4268
+JUMPV
+LABELV $4284
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+NEF4 $4290
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4291
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+646460
+INDIRI4
+GEI4 $4291
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+635304
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $4268
+JUMPV
+LABELV $4290
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+EQF4 $4298
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $4296
+LABELV $4298
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4299
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+GEI4 $4299
+CNSTI4 112
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $4302
+ADDRLP4 12
+CNSTI4 112
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+83384+8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $4302
+CNSTI4 112
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $4268
+JUMPV
+LABELV $4299
+LABELV $4296
+LABELV $4291
+LABELV $4285
+LABELV $4270
+CNSTI4 0
+RETI4
+LABELV $4268
+endproc UI_FeederItemImage 20 8
+bss
+align 1
+LABELV $4313
+skip 1024
+code
+proc UI_FeederSelection 40 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $4314
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedHead
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4315
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+GEI4 $4315
+ADDRGP4 $1404
+ARGP4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $4321
+ARGP4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1348
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4315
+JUMPV
+LABELV $4314
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $4323
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4324
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+565668
+INDIRI4
+GEI4 $4324
+ADDRGP4 $1364
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+565672
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1365
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+565672
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4324
+JUMPV
+LABELV $4323
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+NEF4 $4330
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $4331
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+646460
+INDIRI4
+GEI4 $4331
+ADDRGP4 $1364
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+646464
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1365
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+646464
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4331
+JUMPV
+LABELV $4330
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $4339
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $4337
+LABELV $4339
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $4343
+ADDRLP4 12
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $4344
+JUMPV
+LABELV $4343
+ADDRLP4 12
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $4344
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 112
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $4345
+CNSTI4 112
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 112
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $4345
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRGP4 $1098
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2705
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 ui_mapIndex+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $4354
+ADDRGP4 ui_currentMap+12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 24
+CNSTI4 112
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 $1512
+ARGP4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4338
+JUMPV
+LABELV $4354
+ADDRGP4 ui_currentNetMap+12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 24
+CNSTI4 112
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $4338
+JUMPV
+LABELV $4337
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $4379
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 uiInfo+545444+2216
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+545444+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $4313
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $4313
+ARGP4
+ADDRGP4 $3759
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $1459
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10428
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+CNSTI4 0
+LTI4 $4388
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+545444+10432
+CNSTI4 -1
+ASGNI4
+LABELV $4388
+ADDRGP4 $4313
+ARGP4
+ADDRGP4 $3759
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4380
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4380
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10432
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $4380
+JUMPV
+LABELV $4379
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $4400
+ADDRGP4 $4401
+JUMPV
+LABELV $4400
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $4402
+ADDRGP4 uiInfo+565644
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+565648
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $4403
+ADDRGP4 uiInfo+556928
+ARGP4
+ADDRGP4 uiInfo+565644
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+563596
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $4403
+JUMPV
+LABELV $4402
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $4412
+ADDRGP4 uiInfo+79016
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $4413
+JUMPV
+LABELV $4412
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $4415
+ADDRGP4 uiInfo+79008
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $4416
+JUMPV
+LABELV $4415
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $4418
+ADDRGP4 uiInfo+543300
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $4419
+JUMPV
+LABELV $4418
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $4421
+ADDRGP4 uiInfo+545436
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+545440
+INDIRI4
+CNSTI4 0
+LTI4 $4424
+ADDRGP4 uiInfo+545440
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $4424
+ADDRGP4 uiInfo+545440
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4422
+JUMPV
+LABELV $4421
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $4429
+ADDRGP4 uiInfo+544332
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $4429
+LABELV $4422
+LABELV $4419
+LABELV $4416
+LABELV $4413
+LABELV $4403
+LABELV $4401
+LABELV $4380
+LABELV $4338
+LABELV $4331
+LABELV $4324
+LABELV $4315
+LABELV $4312
+endproc UI_FeederSelection 40 24
+proc Team_Parse 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $4436
+CNSTI4 0
+RETI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4435
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $4438
+CNSTI4 1
+RETI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4438
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4442
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4440
+LABELV $4442
+CNSTI4 0
+RETI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4440
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4443
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $4449
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4445
+LABELV $4449
+CNSTI4 0
+RETI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4445
+CNSTI4 44
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 44
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+28
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 44
+CNSTI4 44
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+32
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 56
+CNSTI4 44
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+36
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4474
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+8
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $4481
+CNSTI4 0
+RETI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4481
+LABELV $4475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $4474
+ADDRGP4 $4486
+ARGP4
+CNSTI4 44
+ADDRGP4 uiInfo+75844
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 uiInfo+75844
+INDIRI4
+CNSTI4 64
+GEI4 $4489
+ADDRLP4 68
+ADDRGP4 uiInfo+75844
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4490
+JUMPV
+LABELV $4489
+ADDRGP4 $4493
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4490
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $4494
+CNSTI4 0
+RETI4
+ADDRGP4 $4432
+JUMPV
+LABELV $4494
+LABELV $4443
+LABELV $4436
+ADDRGP4 $4435
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $4432
+endproc Team_Parse 72 12
+proc Character_Parse 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $4500
+CNSTI4 0
+RETI4
+ADDRGP4 $4496
+JUMPV
+LABELV $4499
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $4502
+CNSTI4 1
+RETI4
+ADDRGP4 $4496
+JUMPV
+LABELV $4502
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4506
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4504
+LABELV $4506
+CNSTI4 0
+RETI4
+ADDRGP4 $4496
+JUMPV
+LABELV $4504
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4507
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 24
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4509
+LABELV $4513
+CNSTI4 0
+RETI4
+ADDRGP4 $4496
+JUMPV
+LABELV $4509
+CNSTI4 24
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+8
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4520
+ARGP4
+ADDRLP4 32
+CNSTI4 24
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+4
+ADDP4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4523
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $4525
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $4523
+ADDRGP4 $4529
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+12
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $4524
+JUMPV
+LABELV $4523
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4530
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $4532
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $4530
+ADDRGP4 $1507
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+12
+ADDP4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $4531
+JUMPV
+LABELV $4530
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+12
+ADDP4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+LABELV $4531
+LABELV $4524
+ADDRGP4 $4539
+ARGP4
+ADDRLP4 60
+CNSTI4 24
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 uiInfo+73528
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+73536
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 uiInfo+73528
+INDIRI4
+CNSTI4 64
+GEI4 $4545
+ADDRLP4 64
+ADDRGP4 uiInfo+73528
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4546
+JUMPV
+LABELV $4545
+ADDRGP4 $4549
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4546
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $4550
+CNSTI4 0
+RETI4
+ADDRGP4 $4496
+JUMPV
+LABELV $4550
+LABELV $4507
+LABELV $4500
+ADDRGP4 $4499
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $4496
+endproc Character_Parse 68 12
+proc Alias_Parse 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $4556
+CNSTI4 0
+RETI4
+ADDRGP4 $4552
+JUMPV
+LABELV $4555
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4558
+CNSTI4 1
+RETI4
+ADDRGP4 $4552
+JUMPV
+LABELV $4558
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4562
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4560
+LABELV $4562
+CNSTI4 0
+RETI4
+ADDRGP4 $4552
+JUMPV
+LABELV $4560
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4563
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+75072
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4576
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+75072
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076+4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4576
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+75072
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076+8
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4565
+LABELV $4576
+CNSTI4 0
+RETI4
+ADDRGP4 $4552
+JUMPV
+LABELV $4565
+ADDRGP4 $4577
+ARGP4
+ADDRLP4 32
+CNSTI4 12
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75072
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+75072
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75076+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 uiInfo+75072
+INDIRI4
+CNSTI4 64
+GEI4 $4583
+ADDRLP4 36
+ADDRGP4 uiInfo+75072
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4584
+JUMPV
+LABELV $4583
+ADDRGP4 $4587
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4584
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $4588
+CNSTI4 0
+RETI4
+ADDRGP4 $4552
+JUMPV
+LABELV $4588
+LABELV $4563
+LABELV $4556
+ADDRGP4 $4555
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $4552
+endproc Alias_Parse 40 12
+proc UI_ParseTeamInfo 44 8
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 GetMenuBuffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4591
+ADDRGP4 $4590
+JUMPV
+LABELV $4591
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $4594
+JUMPV
+LABELV $4593
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4599
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4599
+ADDRLP4 24
+INDIRI4
+CNSTI4 125
+NEI4 $4596
+LABELV $4599
+ADDRGP4 $4595
+JUMPV
+LABELV $4596
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4600
+ADDRGP4 $4595
+JUMPV
+LABELV $4600
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4604
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4602
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Team_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $4595
+ADDRGP4 $4594
+JUMPV
+LABELV $4602
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4609
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $4607
+ADDRLP4 4
+ARGP4
+ADDRGP4 Character_Parse
+CALLI4
+pop
+LABELV $4607
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4612
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $4610
+ADDRLP4 4
+ARGP4
+ADDRGP4 Alias_Parse
+CALLI4
+pop
+LABELV $4610
+LABELV $4594
+ADDRGP4 $4593
+JUMPV
+LABELV $4595
+LABELV $4590
+endproc UI_ParseTeamInfo 44 8
+proc GameType_Parse 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $4614
+CNSTI4 0
+RETI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4614
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4616
+ADDRGP4 uiInfo+78796
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4621
+JUMPV
+LABELV $4616
+ADDRGP4 uiInfo+78664
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4621
+JUMPV
+LABELV $4620
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4623
+CNSTI4 1
+RETI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4623
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4627
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4625
+LABELV $4627
+CNSTI4 0
+RETI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4625
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4628
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+78796
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78800
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+78796
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78800+4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $4631
+LABELV $4639
+CNSTI4 0
+RETI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+78664
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4647
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+78664
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $4640
+LABELV $4647
+CNSTI4 0
+RETI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4640
+LABELV $4631
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4648
+ADDRGP4 uiInfo+78796
+INDIRI4
+CNSTI4 16
+GEI4 $4650
+ADDRLP4 20
+ADDRGP4 uiInfo+78796
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4649
+JUMPV
+LABELV $4650
+ADDRGP4 $4654
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $4649
+JUMPV
+LABELV $4648
+ADDRGP4 uiInfo+78664
+INDIRI4
+CNSTI4 16
+GEI4 $4655
+ADDRLP4 20
+ADDRGP4 uiInfo+78664
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4656
+JUMPV
+LABELV $4655
+ADDRGP4 $4659
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4656
+LABELV $4649
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $4660
+CNSTI4 0
+RETI4
+ADDRGP4 $4613
+JUMPV
+LABELV $4660
+LABELV $4628
+LABELV $4621
+ADDRGP4 $4620
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $4613
+endproc GameType_Parse 28 8
+proc MapList_Parse 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $4663
+CNSTI4 0
+RETI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4663
+ADDRGP4 uiInfo+83380
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4667
+JUMPV
+LABELV $4666
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4669
+CNSTI4 1
+RETI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4669
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4673
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4671
+LABELV $4673
+CNSTI4 0
+RETI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4671
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $4674
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $4687
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4687
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+28
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4676
+LABELV $4687
+CNSTI4 0
+RETI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4676
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+12
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4688
+CNSTI4 0
+RETI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4688
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4697
+JUMPV
+LABELV $4696
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $4698
+ADDRLP4 40
+INDIRI4
+CNSTI4 57
+GTI4 $4698
+ADDRLP4 44
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+32
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 2
+LSHI4
+CNSTI4 192
+SUBI4
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+40
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $4700
+CNSTI4 0
+RETI4
+ADDRGP4 $4662
+JUMPV
+LABELV $4700
+LABELV $4697
+ADDRGP4 $4696
+JUMPV
+LABELV $4698
+CNSTI4 112
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1459
+ARGP4
+ADDRLP4 36
+CNSTI4 112
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+104
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+83380
+INDIRI4
+CNSTI4 4096
+GEI4 $4718
+ADDRLP4 48
+ADDRGP4 uiInfo+83380
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4719
+JUMPV
+LABELV $4718
+ADDRGP4 $4722
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4719
+LABELV $4674
+LABELV $4667
+ADDRGP4 $4666
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $4662
+endproc MapList_Parse 52 8
+proc UI_ParseGameInfo 44 8
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 GetMenuBuffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4724
+ADDRGP4 $4723
+JUMPV
+LABELV $4724
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $4727
+JUMPV
+LABELV $4726
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4732
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $4732
+ADDRLP4 24
+INDIRI4
+CNSTI4 125
+NEI4 $4729
+LABELV $4732
+ADDRGP4 $4728
+JUMPV
+LABELV $4729
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $4733
+ADDRGP4 $4728
+JUMPV
+LABELV $4733
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4737
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $4735
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 GameType_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $4728
+ADDRGP4 $4727
+JUMPV
+LABELV $4735
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4742
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $4740
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 GameType_Parse
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $4728
+ADDRGP4 $4727
+JUMPV
+LABELV $4740
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $4747
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $4745
+ADDRLP4 4
+ARGP4
+ADDRGP4 MapList_Parse
+CALLI4
+pop
+LABELV $4745
+LABELV $4727
+ADDRGP4 $4726
+JUMPV
+LABELV $4728
+LABELV $4723
+endproc UI_ParseGameInfo 44 8
+proc UI_Pause 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4749
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $4750
+JUMPV
+LABELV $4749
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $4750
+LABELV $4748
+endproc UI_Pause 4 8
+proc UI_PlayCinematic 4 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $4751
+endproc UI_PlayCinematic 4 24
+proc UI_StopCinematic 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $4753
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 $4754
+JUMPV
+LABELV $4753
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 244
+NEI4 $4755
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $4756
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+36
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4756
+JUMPV
+LABELV $4755
+ADDRFP4 0
+INDIRI4
+CNSTI4 246
+NEI4 $4768
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+CNSTI4 0
+LTI4 $4769
+ADDRGP4 uiInfo+545444+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+545444+10432
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4769
+JUMPV
+LABELV $4768
+ADDRFP4 0
+INDIRI4
+CNSTI4 251
+NEI4 $4778
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $4780
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+75844
+INDIRI4
+GEI4 $4780
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $4783
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+75848+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $4783
+LABELV $4780
+LABELV $4778
+LABELV $4769
+LABELV $4756
+LABELV $4754
+LABELV $4752
+endproc UI_StopCinematic 20 4
+proc UI_DrawCinematic 0 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+LABELV $4791
+endproc UI_DrawCinematic 0 20
+proc UI_RunCinematicFrame 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+LABELV $4792
+endproc UI_RunCinematicFrame 0 4
+proc UI_BuildQ3Model_List 4528 20
+ADDRGP4 uiInfo+565668
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+646460
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4796
+ARGP4
+ADDRGP4 $4797
+ARGP4
+ADDRLP4 2408
+ARGP4
+CNSTI4 32768
+ARGI4
+ADDRLP4 4456
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 2404
+ADDRLP4 4456
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 2408
+ASGNP4
+ADDRLP4 352
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4801
+JUMPV
+LABELV $4798
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 4460
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 348
+ADDRLP4 4460
+INDIRI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $4803
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $4803
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $4803
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 $4807
+ARGP4
+ADDRLP4 4468
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4468
+INDIRI4
+CNSTI4 0
+EQI4 $4809
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 $4808
+ARGP4
+ADDRLP4 4472
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4472
+INDIRI4
+CNSTI4 0
+NEI4 $4805
+LABELV $4809
+ADDRGP4 $4799
+JUMPV
+LABELV $4805
+ADDRGP4 $4810
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 4476
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4476
+INDIRP4
+ARGP4
+ADDRGP4 $4811
+ARGP4
+ADDRLP4 356
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4480
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 4480
+INDIRI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 356
+ASGNP4
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4815
+JUMPV
+LABELV $4812
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 4484
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 4484
+INDIRI4
+ASGNI4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4819
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4488
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4488
+INDIRI4
+CNSTI4 0
+NEI4 $4817
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4820
+ARGP4
+ADDRLP4 4492
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4492
+INDIRI4
+CNSTI4 0
+EQI4 $4817
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4821
+ARGP4
+ADDRLP4 4496
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4496
+INDIRI4
+CNSTI4 0
+EQI4 $4817
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4824
+ARGP4
+ADDRLP4 4500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4500
+INDIRI4
+CNSTI4 0
+NEI4 $4822
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4823
+JUMPV
+LABELV $4822
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $4825
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260+5
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4823
+ADDRLP4 4504
+CNSTI4 0
+ASGNI4
+ADDRLP4 324
+ADDRLP4 4504
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4504
+INDIRI4
+ASGNI4
+ADDRGP4 $4830
+JUMPV
+LABELV $4827
+ADDRLP4 4
+ARGP4
+ADDRGP4 uiInfo+565668
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+565672
+ADDP4
+ARGP4
+ADDRLP4 4508
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 0
+NEI4 $4832
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4829
+JUMPV
+LABELV $4832
+LABELV $4828
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4830
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+565668
+INDIRI4
+LTI4 $4827
+LABELV $4829
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $4836
+ADDRGP4 uiInfo+565668
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+565672
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4512
+ADDRGP4 uiInfo+565668
+ASGNP4
+ADDRLP4 4508
+ADDRLP4 4512
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4512
+INDIRP4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4844
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 4516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4516
+INDIRP4
+ARGP4
+ADDRLP4 4520
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+631208
+ADDP4
+ADDRLP4 4520
+INDIRI4
+ASGNI4
+LABELV $4836
+LABELV $4817
+LABELV $4813
+ADDRLP4 4484
+CNSTI4 1
+ASGNI4
+ADDRLP4 332
+ADDRLP4 332
+INDIRI4
+ADDRLP4 4484
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 336
+INDIRI4
+ADDRLP4 4484
+INDIRI4
+ADDI4
+ADDRLP4 328
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $4815
+ADDRLP4 332
+INDIRI4
+ADDRLP4 344
+INDIRI4
+GEI4 $4845
+ADDRGP4 uiInfo+565668
+INDIRI4
+CNSTI4 1024
+LTI4 $4812
+LABELV $4845
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4849
+JUMPV
+LABELV $4846
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 4488
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 4488
+INDIRI4
+ASGNI4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4819
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4492
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4492
+INDIRI4
+CNSTI4 0
+NEI4 $4851
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4820
+ARGP4
+ADDRLP4 4496
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4496
+INDIRI4
+CNSTI4 0
+EQI4 $4851
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4821
+ARGP4
+ADDRLP4 4500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4500
+INDIRI4
+CNSTI4 0
+EQI4 $4851
+ADDRLP4 260
+ARGP4
+ADDRGP4 $4824
+ARGP4
+ADDRLP4 4504
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4504
+INDIRI4
+CNSTI4 0
+NEI4 $4853
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4854
+JUMPV
+LABELV $4853
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $4825
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260+5
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4854
+ADDRLP4 4508
+CNSTI4 0
+ASGNI4
+ADDRLP4 324
+ADDRLP4 4508
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4508
+INDIRI4
+ASGNI4
+ADDRGP4 $4859
+JUMPV
+LABELV $4856
+ADDRLP4 4
+ARGP4
+ADDRGP4 uiInfo+646460
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+646464
+ADDP4
+ARGP4
+ADDRLP4 4512
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4512
+INDIRI4
+CNSTI4 0
+NEI4 $4861
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4858
+JUMPV
+LABELV $4861
+LABELV $4857
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $4859
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+646460
+INDIRI4
+LTI4 $4856
+LABELV $4858
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $4865
+ADDRGP4 uiInfo+646460
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+646464
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4516
+ADDRGP4 uiInfo+646460
+ASGNP4
+ADDRLP4 4512
+ADDRLP4 4516
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4516
+INDIRP4
+ADDRLP4 4512
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $4844
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 4520
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4520
+INDIRP4
+ARGP4
+ADDRLP4 4524
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+631208
+ADDP4
+ADDRLP4 4524
+INDIRI4
+ASGNI4
+LABELV $4865
+LABELV $4851
+LABELV $4847
+ADDRLP4 4488
+CNSTI4 1
+ASGNI4
+ADDRLP4 332
+ADDRLP4 332
+INDIRI4
+ADDRLP4 4488
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 336
+INDIRI4
+ADDRLP4 4488
+INDIRI4
+ADDI4
+ADDRLP4 328
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $4849
+ADDRLP4 332
+INDIRI4
+ADDRLP4 344
+INDIRI4
+GEI4 $4873
+ADDRGP4 uiInfo+646460
+INDIRI4
+CNSTI4 1024
+LTI4 $4846
+LABELV $4873
+LABELV $4799
+ADDRLP4 4460
+CNSTI4 1
+ASGNI4
+ADDRLP4 352
+ADDRLP4 352
+INDIRI4
+ADDRLP4 4460
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 348
+INDIRI4
+ADDRLP4 4460
+INDIRI4
+ADDI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $4801
+ADDRLP4 352
+INDIRI4
+ADDRLP4 2404
+INDIRI4
+GEI4 $4874
+ADDRGP4 uiInfo+565668
+INDIRI4
+CNSTI4 1024
+LTI4 $4798
+LABELV $4874
+LABELV $4793
+endproc UI_BuildQ3Model_List 4528 20
+export _UI_Init
+proc _UI_Init 644 16
+ADDRGP4 UI_RegisterCvars
+CALLV
+pop
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 uiInfo+62156
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 uiInfo+196
+CNSTF4 990414985
+ADDRGP4 uiInfo+62156+11308
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+200
+CNSTF4 986500301
+ADDRGP4 uiInfo+62156+11304
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 realxscale
+ADDRGP4 uiInfo+200
+INDIRF4
+ASGNF4
+ADDRGP4 realyscale
+ADDRGP4 uiInfo+196
+INDIRF4
+ASGNF4
+ADDRGP4 realVidWidth
+ADDRGP4 uiInfo+62156+11304
+INDIRI4
+ASGNI4
+ADDRGP4 realVidHeight
+ADDRGP4 uiInfo+62156+11308
+INDIRI4
+ASGNI4
+ADDRLP4 604
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 608
+ADDRGP4 realVidWidth
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 600
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 616
+ADDRGP4 realVidHeight
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 588
+ADDRLP4 604
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 592
+ADDRLP4 612
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 588
+ADDRLP4 608
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 592
+ADDRLP4 616
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 596
+CNSTF4 1056964608
+ADDRLP4 588
+INDIRI4
+CVIF4 4
+CNSTF4 1068149419
+ADDRLP4 592
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 wideAdjustX
+ADDRLP4 596
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 480
+ADDRGP4 uiInfo+62156+11304
+INDIRI4
+MULI4
+CNSTI4 640
+ADDRGP4 uiInfo+62156+11308
+INDIRI4
+MULI4
+LEI4 $4889
+ADDRGP4 uiInfo+204
+CNSTF4 1056964608
+ADDRGP4 uiInfo+62156+11304
+INDIRI4
+CVIF4 4
+CNSTF4 1068149419
+ADDRGP4 uiInfo+62156+11308
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+200
+ADDRGP4 uiInfo+196
+INDIRF4
+ASGNF4
+ADDRGP4 $4890
+JUMPV
+LABELV $4889
+ADDRGP4 uiInfo+204
+CNSTF4 0
+ASGNF4
+LABELV $4890
+ADDRGP4 uiInfo
+ADDRGP4 trap_R_RegisterShaderNoMip
+ASGNP4
+ADDRGP4 uiInfo+4
+ADDRGP4 UI_SetColor
+ASGNP4
+ADDRGP4 uiInfo+8
+ADDRGP4 UI_DrawHandlePic
+ASGNP4
+ADDRGP4 uiInfo+12
+ADDRGP4 trap_R_DrawStretchPic
+ASGNP4
+ADDRGP4 uiInfo+16
+ADDRGP4 Text_Paint
+ASGNP4
+ADDRGP4 uiInfo+20
+ADDRGP4 Text_Width
+ASGNP4
+ADDRGP4 uiInfo+24
+ADDRGP4 Text_Height
+ASGNP4
+ADDRGP4 uiInfo+28
+ADDRGP4 trap_R_RegisterModel
+ASGNP4
+ADDRGP4 uiInfo+32
+ADDRGP4 trap_R_ModelBounds
+ASGNP4
+ADDRGP4 uiInfo+36
+ADDRGP4 UI_FillRect
+ASGNP4
+ADDRGP4 uiInfo+40
+ADDRGP4 _UI_DrawRect
+ASGNP4
+ADDRGP4 uiInfo+44
+ADDRGP4 _UI_DrawSides
+ASGNP4
+ADDRGP4 uiInfo+48
+ADDRGP4 _UI_DrawTopBottom
+ASGNP4
+ADDRGP4 uiInfo+52
+ADDRGP4 trap_R_ClearScene
+ASGNP4
+ADDRGP4 uiInfo+44
+ADDRGP4 _UI_DrawSides
+ASGNP4
+ADDRGP4 uiInfo+56
+ADDRGP4 trap_R_AddRefEntityToScene
+ASGNP4
+ADDRGP4 uiInfo+60
+ADDRGP4 trap_R_RenderScene
+ASGNP4
+ADDRGP4 uiInfo+64
+ADDRGP4 trap_R_RegisterFont
+ASGNP4
+ADDRGP4 uiInfo+68
+ADDRGP4 UI_OwnerDraw
+ASGNP4
+ADDRGP4 uiInfo+72
+ADDRGP4 UI_GetValue
+ASGNP4
+ADDRGP4 uiInfo+76
+ADDRGP4 UI_OwnerDrawVisible
+ASGNP4
+ADDRGP4 uiInfo+80
+ADDRGP4 UI_RunMenuScript
+ASGNP4
+ADDRGP4 uiInfo+84
+ADDRGP4 UI_GetTeamColor
+ASGNP4
+ADDRGP4 uiInfo+96
+ADDRGP4 trap_Cvar_Set
+ASGNP4
+ADDRGP4 uiInfo+88
+ADDRGP4 trap_Cvar_VariableStringBuffer
+ASGNP4
+ADDRGP4 uiInfo+92
+ADDRGP4 trap_Cvar_VariableValue
+ASGNP4
+ADDRGP4 uiInfo+100
+ADDRGP4 Text_PaintWithCursor
+ASGNP4
+ADDRGP4 uiInfo+104
+ADDRGP4 trap_Key_SetOverstrikeMode
+ASGNP4
+ADDRGP4 uiInfo+108
+ADDRGP4 trap_Key_GetOverstrikeMode
+ASGNP4
+ADDRGP4 uiInfo+112
+ADDRGP4 trap_S_StartLocalSound
+ASGNP4
+ADDRGP4 uiInfo+116
+ADDRGP4 UI_OwnerDrawHandleKey
+ASGNP4
+ADDRGP4 uiInfo+120
+ADDRGP4 UI_FeederCount
+ASGNP4
+ADDRGP4 uiInfo+128
+ADDRGP4 UI_FeederItemImage
+ASGNP4
+ADDRGP4 uiInfo+124
+ADDRGP4 UI_FeederItemText
+ASGNP4
+ADDRGP4 uiInfo+132
+ADDRGP4 UI_FeederSelection
+ASGNP4
+ADDRGP4 uiInfo+144
+ADDRGP4 trap_Key_SetBinding
+ASGNP4
+ADDRGP4 uiInfo+140
+ADDRGP4 trap_Key_GetBindingBuf
+ASGNP4
+ADDRGP4 uiInfo+136
+ADDRGP4 trap_Key_KeynumToStringBuf
+ASGNP4
+ADDRGP4 uiInfo+148
+ADDRGP4 trap_Cmd_ExecuteText
+ASGNP4
+ADDRGP4 uiInfo+152
+ADDRGP4 Com_Error
+ASGNP4
+ADDRGP4 uiInfo+156
+ADDRGP4 Com_Printf
+ASGNP4
+ADDRGP4 uiInfo+160
+ADDRGP4 UI_Pause
+ASGNP4
+ADDRGP4 uiInfo+164
+ADDRGP4 UI_OwnerDrawWidth
+ASGNP4
+ADDRGP4 uiInfo+168
+ADDRGP4 trap_S_RegisterSound
+ASGNP4
+ADDRGP4 uiInfo+172
+ADDRGP4 trap_S_StartBackgroundTrack
+ASGNP4
+ADDRGP4 uiInfo+176
+ADDRGP4 trap_S_StopBackgroundTrack
+ASGNP4
+ADDRGP4 uiInfo+180
+ADDRGP4 UI_PlayCinematic
+ASGNP4
+ADDRGP4 uiInfo+184
+ADDRGP4 UI_StopCinematic
+ASGNP4
+ADDRGP4 uiInfo+188
+ADDRGP4 UI_DrawCinematic
+ASGNP4
+ADDRGP4 uiInfo+192
+ADDRGP4 UI_RunCinematicFrame
+ASGNP4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 $4953
+ARGP4
+ADDRLP4 584
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+73496
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $4955
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+73488
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 AssetCache
+CALLV
+pop
+ADDRGP4 uiInfo+75844
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+73528
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+75072
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4959
+ARGP4
+ADDRGP4 UI_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 UI_LoadTeams
+CALLV
+pop
+ADDRGP4 $1059
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 $1053
+ARGP4
+ADDRLP4 592
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4962
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4960
+LABELV $4962
+ADDRLP4 4
+ADDRGP4 $1021
+ASGNP4
+LABELV $4960
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 $4963
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 trap_LAN_LoadCachedServers
+CALLV
+pop
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+78668+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 UI_BuildQ3Model_List
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 $2244
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+643500
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamecodetoui-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2560
+ARGP4
+ADDRLP4 604
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+565656
+ADDRLP4 604
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2872
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 612
+INDIRF4
+CNSTF4 0
+LTF4 $4974
+ADDRLP4 608
+ADDRGP4 $472
+ASGNP4
+ADDRGP4 $4975
+JUMPV
+LABELV $4974
+ADDRLP4 608
+ADDRGP4 $2310
+ASGNP4
+LABELV $4975
+ADDRGP4 $2869
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uiInfo+545444+10432
+CNSTI4 -1
+ASGNI4
+ADDRGP4 uiInfo+545440
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4981
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 616
+INDIRF4
+CNSTF4 0
+NEF4 $4979
+ADDRGP4 $4982
+ARGP4
+ADDRGP4 $4983
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $4984
+ARGP4
+ADDRGP4 $4985
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $4981
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $4979
+CNSTP4 0
+ARGP4
+ADDRGP4 $4986
+ARGP4
+ADDRGP4 $109
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ARGI4
+ADDRLP4 620
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1113
+ARGP4
+ADDRLP4 620
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRLP4 624
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1382
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 628
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1383
+ARGP4
+ADDRLP4 628
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1098
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1384
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1373
+ARGP4
+ADDRGP4 $4988
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1374
+ARGP4
+ADDRGP4 $1078
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1377
+ARGP4
+ADDRGP4 $4988
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1378
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1364
+ARGP4
+ADDRLP4 636
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 636
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1365
+ARGP4
+ADDRLP4 640
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 640
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 uiInfo+643508
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $4990
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+78928
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $4991
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $4990
+LABELV $4875
+endproc _UI_Init 644 16
+export _UI_KeyEvent
+proc _UI_KeyEvent 16 12
+ADDRLP4 0
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4996
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4998
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $5000
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $5000
+ADDRLP4 12
+ADDRGP4 Menus_AnyFullScreenVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $5000
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4999
+JUMPV
+LABELV $5000
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+ADDRGP4 $4999
+JUMPV
+LABELV $4998
+ADDRLP4 12
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $4999
+LABELV $4996
+LABELV $4995
+endproc _UI_KeyEvent 16 12
+export _UI_MouseEvent
+proc _UI_MouseEvent 12 12
+ADDRLP4 0
+ADDRGP4 uiInfo+216
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+216
+INDIRI4
+ADDRGP4 wideAdjustX
+INDIRI4
+NEGI4
+GEI4 $5004
+ADDRGP4 uiInfo+216
+ADDRGP4 wideAdjustX
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $5005
+JUMPV
+LABELV $5004
+ADDRGP4 uiInfo+216
+INDIRI4
+ADDRGP4 wideAdjustX
+INDIRI4
+CNSTI4 640
+ADDI4
+LEI4 $5008
+ADDRGP4 uiInfo+216
+ADDRGP4 wideAdjustX
+INDIRI4
+CNSTI4 640
+ADDI4
+ASGNI4
+LABELV $5008
+LABELV $5005
+ADDRLP4 4
+ADDRGP4 uiInfo+220
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 0
+GEI4 $5013
+ADDRGP4 uiInfo+220
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5014
+JUMPV
+LABELV $5013
+ADDRGP4 uiInfo+220
+INDIRI4
+CNSTI4 480
+LEI4 $5017
+ADDRGP4 uiInfo+220
+CNSTI4 480
+ASGNI4
+LABELV $5017
+LABELV $5014
+ADDRLP4 8
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $5021
+CNSTP4 0
+ARGP4
+ADDRGP4 uiInfo+216
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+220
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $5021
+LABELV $5002
+endproc _UI_MouseEvent 12 12
+export UI_LoadNonIngame
+proc UI_LoadNonIngame 12 8
+ADDRGP4 $1053
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5028
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $5026
+LABELV $5028
+ADDRLP4 0
+ADDRGP4 $1021
+ASGNP4
+LABELV $5026
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 uiInfo+643504
+CNSTI4 0
+ASGNI4
+LABELV $5025
+endproc UI_LoadNonIngame 12 8
+export _UI_SetActiveMenu
+proc _UI_SetActiveMenu 300 12
+ADDRLP4 256
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+LEI4 $5031
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+LTI4 $5035
+ADDRLP4 276
+INDIRI4
+CNSTI4 6
+GTI4 $5035
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5077
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5077
+address $5038
+address $5039
+address $5074
+address $5030
+address $5030
+address $5063
+address $5068
+code
+LABELV $5038
+ADDRLP4 284
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $5030
+JUMPV
+LABELV $5039
+ADDRGP4 $2199
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uiInfo+643504
+INDIRI4
+CNSTI4 0
+EQI4 $5040
+ADDRGP4 UI_LoadNonIngame
+CALLV
+pop
+LABELV $5040
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 uiInfo+228+8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $3003
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $5045
+ADDRGP4 ui_singlePlayerActive+12
+INDIRI4
+CNSTI4 0
+NEI4 $5047
+ADDRGP4 uiInfo+228+16
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $5048
+JUMPV
+LABELV $5047
+ADDRGP4 $3003
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $5048
+LABELV $5045
+ADDRGP4 $5054
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+CNSTF4 1065353216
+NEF4 $5030
+ADDRGP4 uiInfo+228+24
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5055
+ADDRGP4 uiInfo+228+24
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $5030
+JUMPV
+LABELV $5055
+ADDRGP4 uiInfo+228+8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $5030
+JUMPV
+LABELV $5063
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uiInfo+228+28
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $5030
+JUMPV
+LABELV $5068
+ADDRGP4 $2199
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uiInfo+643504
+INDIRI4
+CNSTI4 0
+EQI4 $5069
+ADDRGP4 UI_LoadNonIngame
+CALLV
+pop
+LABELV $5069
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 uiInfo+228+24
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $5030
+JUMPV
+LABELV $5074
+ADDRGP4 $3163
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 uiInfo+228+12
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $5035
+LABELV $5031
+LABELV $5030
+endproc _UI_SetActiveMenu 300 12
+export _UI_IsFullscreen
+proc _UI_IsFullscreen 4 0
+ADDRLP4 0
+ADDRGP4 Menus_AnyFullScreenVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $5078
+endproc _UI_IsFullscreen 4 0
+proc UI_ReadableSize 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1073741824
+LEI4 $5080
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1098
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1073741824
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 $5082
+ARGP4
+ADDRLP4 12
+CNSTI4 1073741824
+ASGNI4
+CNSTI4 100
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $5081
+JUMPV
+LABELV $5080
+ADDRFP4 8
+INDIRI4
+CNSTI4 1048576
+LEI4 $5083
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1098
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1048576
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 $5085
+ARGP4
+ADDRLP4 12
+CNSTI4 1048576
+ASGNI4
+CNSTI4 100
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $5084
+JUMPV
+LABELV $5083
+ADDRFP4 8
+INDIRI4
+CNSTI4 1024
+LEI4 $5086
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $5088
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1024
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $5087
+JUMPV
+LABELV $5086
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $5089
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $5087
+LABELV $5084
+LABELV $5081
+LABELV $5079
+endproc UI_ReadableSize 16 16
+proc UI_PrintTime 8 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 3600
+LEI4 $5091
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $5093
+ARGP4
+ADDRLP4 4
+CNSTI4 3600
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+CNSTI4 60
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $5092
+JUMPV
+LABELV $5091
+ADDRFP4 8
+INDIRI4
+CNSTI4 60
+LEI4 $5094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $5096
+ARGP4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $5095
+JUMPV
+LABELV $5094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $5097
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $5095
+LABELV $5092
+LABELV $5090
+endproc UI_PrintTime 8 20
+export Text_PaintCenter
+proc Text_PaintCenter 8 32
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $5098
+endproc Text_PaintCenter 8 32
+export Text_PaintCenter_AutoWrapped
+proc Text_PaintCenter_AutoWrapped 1064 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5102
+ADDRFP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $5100
+LABELV $5102
+ADDRGP4 $5099
+JUMPV
+LABELV $5100
+ADDRLP4 20
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $5104
+JUMPV
+LABELV $5103
+LABELV $5106
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $5107
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $5109
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $5106
+LABELV $5109
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+LEF4 $5110
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $5112
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $5112
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $5114
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5105
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5105
+JUMPV
+LABELV $5114
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $5111
+JUMPV
+LABELV $5110
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $5118
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5105
+JUMPV
+LABELV $5118
+LABELV $5111
+LABELV $5104
+ADDRGP4 $5103
+JUMPV
+LABELV $5105
+LABELV $5099
+endproc Text_PaintCenter_AutoWrapped 1064 24
+data
+align 1
+LABELV $5121
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $5122
+byte 1 69
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $5123
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+code
+proc UI_DisplayDownloadInfo 312 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $5124
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $5125
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 284
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $5126
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+ASGNI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1121976320
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $5121
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1128267776
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $5122
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1131937792
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $5123
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $5127
+ADDRGP4 $5129
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRGP4 $5128
+JUMPV
+LABELV $5127
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $5128
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1124597760
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 4096
+LTI4 $5132
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $5130
+LABELV $5132
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $5133
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5134
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5131
+JUMPV
+LABELV $5130
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 0
+EQI4 $5135
+ADDRLP4 144
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+DIVI4
+ASGNI4
+ADDRGP4 $5136
+JUMPV
+LABELV $5135
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $5136
+ADDRLP4 152
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 292
+INDIRI4
+EQI4 $5139
+ADDRLP4 144
+INDIRI4
+ADDRLP4 292
+INDIRI4
+EQI4 $5139
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 216
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 300
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 304
+CNSTI4 1024
+ASGNI4
+CNSTI4 1000
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 304
+INDIRI4
+DIVI4
+ADDRLP4 300
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+DIVI4
+DIVI4
+SUBI4
+MULI4
+ARGI4
+ADDRGP4 UI_PrintTime
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 216
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5134
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5140
+JUMPV
+LABELV $5139
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $5133
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $5141
+ADDRGP4 $5134
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5142
+JUMPV
+LABELV $5141
+ADDRGP4 $5143
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $5142
+LABELV $5140
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $5144
+ADDRGP4 $5146
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1132986368
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $5144
+LABELV $5131
+LABELV $5120
+endproc UI_DisplayDownloadInfo 312 24
+export UI_DrawConnectScreen
+proc UI_DrawConnectScreen 5444 32
+ADDRGP4 $5148
+ARGP4
+ADDRLP4 4384
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 4120
+ADDRLP4 4384
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5149
+ADDRLP4 4120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $5149
+ADDRLP4 4120
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $5149
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5151
+ADDRLP4 3084
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 3092
+CNSTF4 1124204544
+ASGNF4
+ADDRLP4 3088
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $5152
+JUMPV
+LABELV $5151
+ADDRLP4 3084
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 3092
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 3088
+CNSTF4 1058642330
+ASGNF4
+ADDRGP4 $5147
+JUMPV
+LABELV $5152
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 3096
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+ARGI4
+ADDRLP4 3096
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4388
+ADDRGP4 trap_GetConfigString
+CALLI4
+ASGNI4
+ADDRLP4 4388
+INDIRI4
+CNSTI4 0
+EQI4 $5153
+ADDRLP4 3096
+ARGP4
+ADDRGP4 $3759
+ARGP4
+ADDRLP4 4392
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $5155
+ARGP4
+ADDRLP4 4392
+INDIRP4
+ARGP4
+ADDRLP4 4396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 3092
+INDIRF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $5153
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 $5159
+ARGP4
+ADDRLP4 4392
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4392
+INDIRI4
+CNSTI4 0
+NEI4 $5156
+ADDRGP4 $5160
+ARGP4
+ADDRLP4 4396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 3092
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4396
+INDIRP4
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $5157
+JUMPV
+LABELV $5156
+ADDRGP4 $5161
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 4396
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4124
+ARGP4
+ADDRLP4 4396
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 3092
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4124
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $5157
+ADDRLP4 0+1036
+ARGP4
+ADDRGP4 $5164
+ARGP4
+ADDRLP4 4396
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+CNSTF4 1142292480
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4396
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GEI4 $5165
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 3092
+INDIRF4
+CNSTF4 1127219200
+ADDF4
+ARGF4
+CNSTF4 1142784000
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0+2060
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter_AutoWrapped
+CALLV
+pop
+LABELV $5165
+ADDRGP4 lastConnState
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $5168
+ADDRGP4 lastLoadingText
+CNSTI1 0
+ASGNI1
+LABELV $5168
+ADDRLP4 4404
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 lastConnState
+ADDRLP4 4404
+INDIRI4
+ASGNI4
+ADDRLP4 4400
+ADDRLP4 4404
+INDIRI4
+ASGNI4
+ADDRLP4 4400
+INDIRI4
+CNSTI4 3
+LTI4 $5147
+ADDRLP4 4400
+INDIRI4
+CNSTI4 7
+GTI4 $5147
+ADDRLP4 4400
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $5186-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $5186
+address $5173
+address $5176
+address $5179
+address $5147
+address $5147
+code
+LABELV $5173
+ADDRGP4 $5174
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 4412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4380
+ADDRLP4 4412
+INDIRP4
+ASGNP4
+ADDRGP4 $5171
+JUMPV
+LABELV $5176
+ADDRGP4 $5177
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 4416
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4380
+ADDRLP4 4416
+INDIRP4
+ASGNP4
+ADDRGP4 $5171
+JUMPV
+LABELV $5179
+ADDRGP4 $5180
+ARGP4
+ADDRLP4 4420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4420
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $5181
+ADDRLP4 4420
+ARGP4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 3092
+INDIRF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 UI_DisplayDownloadInfo
+CALLV
+pop
+ADDRGP4 $5147
+JUMPV
+LABELV $5181
+ADDRLP4 4380
+ADDRGP4 $5183
+ASGNP4
+LABELV $5171
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 $5159
+ARGP4
+ADDRLP4 4412
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4412
+INDIRI4
+CNSTI4 0
+EQI4 $5188
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRLP4 3092
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ARGF4
+ADDRLP4 3088
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4380
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Text_PaintCenter
+CALLV
+pop
+LABELV $5188
+LABELV $5147
+endproc UI_DrawConnectScreen 5444 32
+data
+align 4
+LABELV cvarTable
+address ui_ffa_fraglimit
+address $5192
+address $1076
+byte 4 1
+address ui_ffa_timelimit
+address $5193
+address $472
+byte 4 1
+address ui_tourney_fraglimit
+address $5194
+address $472
+byte 4 1
+address ui_tourney_timelimit
+address $5195
+address $1077
+byte 4 1
+address ui_team_fraglimit
+address $5196
+address $472
+byte 4 1
+address ui_team_timelimit
+address $5197
+address $1076
+byte 4 1
+address ui_team_friendly
+address $5198
+address $2310
+byte 4 1
+address ui_ctf_capturelimit
+address $5199
+address $5200
+byte 4 1
+address ui_ctf_timelimit
+address $5201
+address $1074
+byte 4 1
+address ui_ctf_friendly
+address $5202
+address $472
+byte 4 1
+address ui_arenasFile
+address $5203
+address $109
+byte 4 80
+address ui_botsFile
+address $5204
+address $109
+byte 4 80
+address ui_spScores1
+address $5205
+address $109
+byte 4 65
+address ui_spScores2
+address $5206
+address $109
+byte 4 65
+address ui_spScores3
+address $5207
+address $109
+byte 4 65
+address ui_spScores4
+address $5208
+address $109
+byte 4 65
+address ui_spScores5
+address $5209
+address $109
+byte 4 65
+address ui_spAwards
+address $5210
+address $109
+byte 4 65
+address ui_spVideos
+address $5211
+address $109
+byte 4 65
+address ui_spSkill
+address $1209
+address $2745
+byte 4 1
+address ui_spSelection
+address $5212
+address $109
+byte 4 64
+address ui_browserMaster
+address $5213
+address $472
+byte 4 1
+address ui_browserGameType
+address $5214
+address $472
+byte 4 1
+address ui_browserSortKey
+address $5215
+address $3436
+byte 4 1
+address ui_browserShowFull
+address $5216
+address $2310
+byte 4 1
+address ui_browserShowEmpty
+address $5217
+address $2310
+byte 4 1
+address ui_brassTime
+address $2859
+address $5218
+byte 4 1
+address ui_drawCrosshair
+address $2560
+address $3436
+byte 4 1
+address ui_drawCrosshairNames
+address $5219
+address $2310
+byte 4 1
+address ui_marks
+address $5220
+address $2310
+byte 4 1
+address ui_server1
+address $5221
+address $109
+byte 4 1
+address ui_server2
+address $5222
+address $109
+byte 4 1
+address ui_server3
+address $5223
+address $109
+byte 4 1
+address ui_server4
+address $5224
+address $109
+byte 4 1
+address ui_server5
+address $5225
+address $109
+byte 4 1
+address ui_server6
+address $5226
+address $109
+byte 4 1
+address ui_server7
+address $5227
+address $109
+byte 4 1
+address ui_server8
+address $5228
+address $109
+byte 4 1
+address ui_server9
+address $5229
+address $109
+byte 4 1
+address ui_server10
+address $5230
+address $109
+byte 4 1
+address ui_server11
+address $5231
+address $109
+byte 4 1
+address ui_server12
+address $5232
+address $109
+byte 4 1
+address ui_server13
+address $5233
+address $109
+byte 4 1
+address ui_server14
+address $5234
+address $109
+byte 4 1
+address ui_server15
+address $5235
+address $109
+byte 4 1
+address ui_server16
+address $5236
+address $109
+byte 4 1
+address ui_cdkeychecked
+address $5237
+address $472
+byte 4 64
+address ui_new
+address $5238
+address $472
+byte 4 256
+address ui_debug
+address $5239
+address $472
+byte 4 256
+address ui_leidebug
+address $5240
+address $472
+byte 4 256
+address ui_initialized
+address $5241
+address $472
+byte 4 256
+address ui_teamName
+address $1083
+address $5242
+byte 4 1
+address ui_opponentName
+address $1528
+address $5243
+byte 4 1
+address ui_redteam
+address $5244
+address $5242
+byte 4 1
+address ui_blueteam
+address $5245
+address $5243
+byte 4 1
+address ui_dedicated
+address $5246
+address $472
+byte 4 1
+address ui_gameType
+address $5247
+address $5248
+byte 4 1
+address ui_joinGameType
+address $5249
+address $472
+byte 4 1
+address ui_netGameType
+address $2875
+address $5248
+byte 4 1
+address ui_actualNetGameType
+address $5250
+address $5248
+byte 4 1
+address ui_redteam1
+address $5251
+address $472
+byte 4 1
+address ui_redteam2
+address $5252
+address $472
+byte 4 1
+address ui_redteam3
+address $5253
+address $472
+byte 4 1
+address ui_redteam4
+address $5254
+address $472
+byte 4 1
+address ui_redteam5
+address $5255
+address $472
+byte 4 1
+address ui_blueteam1
+address $5256
+address $472
+byte 4 1
+address ui_blueteam2
+address $5257
+address $472
+byte 4 1
+address ui_blueteam3
+address $5258
+address $472
+byte 4 1
+address ui_blueteam4
+address $5259
+address $472
+byte 4 1
+address ui_blueteam5
+address $5260
+address $472
+byte 4 1
+address ui_netSource
+address $2467
+address $472
+byte 4 1
+address ui_menuFiles
+address $1053
+address $1021
+byte 4 1
+address ui_currentTier
+address $1441
+address $472
+byte 4 1
+address ui_currentMap
+address $1273
+address $472
+byte 4 1
+address ui_currentNetMap
+address $1271
+address $472
+byte 4 1
+address ui_mapIndex
+address $2705
+address $472
+byte 4 1
+address ui_currentOpponent
+address $5261
+address $472
+byte 4 1
+address ui_selectedPlayer
+address $1843
+address $472
+byte 4 1
+address ui_selectedPlayerName
+address $1851
+address $109
+byte 4 1
+address ui_lastServerRefresh_0
+address $5262
+address $109
+byte 4 1
+address ui_lastServerRefresh_1
+address $5263
+address $109
+byte 4 1
+address ui_lastServerRefresh_2
+address $5264
+address $109
+byte 4 1
+address ui_lastServerRefresh_3
+address $5265
+address $109
+byte 4 1
+address ui_singlePlayerActive
+address $2718
+address $472
+byte 4 0
+address ui_scoreAccuracy
+address $5266
+address $472
+byte 4 1
+address ui_scoreImpressives
+address $5267
+address $472
+byte 4 1
+address ui_scoreExcellents
+address $5268
+address $472
+byte 4 1
+address ui_scoreCaptures
+address $5269
+address $472
+byte 4 1
+address ui_scoreDefends
+address $5270
+address $472
+byte 4 1
+address ui_scoreAssists
+address $5271
+address $472
+byte 4 1
+address ui_scoreGauntlets
+address $5272
+address $472
+byte 4 1
+address ui_scoreScore
+address $5273
+address $472
+byte 4 1
+address ui_scorePerfect
+address $5274
+address $472
+byte 4 1
+address ui_scoreTeam
+address $5275
+address $5276
+byte 4 1
+address ui_scoreBase
+address $5277
+address $472
+byte 4 1
+address ui_scoreTime
+address $5278
+address $5279
+byte 4 1
+address ui_scoreTimeBonus
+address $5280
+address $472
+byte 4 1
+address ui_scoreSkillBonus
+address $5281
+address $472
+byte 4 1
+address ui_scoreShutoutBonus
+address $5282
+address $472
+byte 4 1
+address ui_fragLimit
+address $1099
+address $1078
+byte 4 0
+address ui_captureLimit
+address $1097
+address $1079
+byte 4 0
+address ui_smallFont
+address $5283
+address $5284
+byte 4 1
+address ui_bigFont
+address $5285
+address $5286
+byte 4 1
+address ui_findPlayer
+address $3847
+address $5287
+byte 4 1
+address ui_Q3Model
+address $5288
+address $472
+byte 4 1
+address ui_hudFiles
+address $5289
+address $5290
+byte 4 1
+address ui_recordSPDemo
+address $2737
+address $472
+byte 4 1
+address ui_teamArenaFirstRun
+address $5291
+address $472
+byte 4 1
+address ui_realWarmUp
+address $2729
+address $1076
+byte 4 1
+address ui_realCaptureLimit
+address $1100
+address $5200
+byte 4 1029
+address ui_serverStatusTimeOut
+address $5292
+address $5293
+byte 4 1
+address ui_humansonly
+address $3699
+address $472
+byte 4 1
+address ui_LowerAnim
+address $1382
+address $472
+byte 4 1
+address ui_UpperAnim
+address $1383
+address $472
+byte 4 1
+address ui_Weapon
+address $1384
+address $472
+byte 4 1
+address ui_PlayerViewAngleYaw
+address $1373
+address $472
+byte 4 1
+address ui_PlayerViewAnglePitch
+address $1374
+address $472
+byte 4 1
+address ui_PlayerMoveAngleYaw
+address $1377
+address $472
+byte 4 1
+address ui_PlayerMoveAnglePitch
+address $1378
+address $472
+byte 4 1
+address ui_SaveGame
+address $5294
+address $109
+byte 4 16
+address ui_LoadGame
+address $5295
+address $109
+byte 4 16
+address ui_CustomServer
+address $3739
+address $109
+byte 4 16
+address ui_HostName
+address $3323
+address $109
+byte 4 16
+address ui_SpecialGame
+address $5296
+address $109
+byte 4 16
+address ui_TeamMembers
+address $2956
+address $472
+byte 4 16
+address ui_loading
+address $496
+address $472
+byte 4 16
+address ui_transitionkey
+address $5297
+address $472
+byte 4 16
+address ui_applychanges
+address $5298
+address $472
+byte 4 16
+address Save_Loading
+address $5299
+address $472
+byte 4 16
+address persid
+address $5300
+address $472
+byte 4 16
+address gameover
+address $5054
+address $472
+byte 4 16
+address ui_introPlayed
+address $5301
+address $472
+byte 4 16
+align 4
+LABELV cvarTableSize
+byte 4 132
+export UI_RegisterCvars
+code
+proc UI_RegisterCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $5306
+JUMPV
+LABELV $5303
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $5304
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $5306
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $5303
+LABELV $5302
+endproc UI_RegisterCvars 12 16
+export UI_UpdateCvars
+proc UI_UpdateCvars 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $5311
+JUMPV
+LABELV $5308
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $5309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $5311
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $5308
+LABELV $5307
+endproc UI_UpdateCvars 8 4
+proc UI_StopServerRefresh 12 12
+ADDRGP4 uiInfo+545444+2212
+INDIRI4
+CNSTI4 0
+NEI4 $5313
+ADDRGP4 $5312
+JUMPV
+LABELV $5313
+ADDRGP4 uiInfo+545444+2212
+CNSTI4 0
+ASGNI4
+ADDRGP4 $5319
+ARGP4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+545444+10416
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+SUBI4
+CNSTI4 0
+LEI4 $5325
+ADDRGP4 $5332
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $5329
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+545444+10412
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $5325
+LABELV $5312
+endproc UI_StopServerRefresh 12 12
+proc UI_DoServerRefresh 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+2212
+INDIRI4
+CNSTI4 0
+NEI4 $5334
+ADDRGP4 $5333
+JUMPV
+LABELV $5334
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 3
+EQI4 $5338
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $5341
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $5342
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $5342
+JUMPV
+LABELV $5341
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $5347
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $5347
+LABELV $5342
+LABELV $5338
+ADDRGP4 uiInfo+208
+INDIRI4
+ADDRGP4 uiInfo+545444+2192
+INDIRI4
+GEI4 $5350
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $5355
+ADDRGP4 $5333
+JUMPV
+LABELV $5355
+LABELV $5350
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_UpdateVisiblePings
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $5357
+ADDRGP4 uiInfo+545444+2192
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $5358
+JUMPV
+LABELV $5357
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5363
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+LABELV $5363
+LABELV $5358
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+LABELV $5333
+endproc UI_DoServerRefresh 12 8
+proc UI_StartServerRefresh 64 24
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 $1765
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $5367
+ARGP4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 MonthAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $5373
+ADDRGP4 UI_UpdatePendingPings
+CALLV
+pop
+ADDRGP4 $5365
+JUMPV
+LABELV $5373
+ADDRGP4 uiInfo+545444+2212
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+545444+10420
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+545444+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+545444+10416
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ResetPings
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $5386
+CNSTI4 0
+ARGI4
+ADDRGP4 $5389
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 uiInfo+545444+2192
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $5365
+JUMPV
+LABELV $5386
+ADDRGP4 uiInfo+545444+2192
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+NEI4 $5396
+ADDRGP4 $4986
+ARGP4
+ADDRLP4 48
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $5399
+ADDRGP4 $5401
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $5400
+JUMPV
+LABELV $5399
+ADDRGP4 $2673
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $5402
+ARGP4
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $5400
+LABELV $5396
+LABELV $5365
+endproc UI_StartServerRefresh 64 24
+bss
+export gameover
+align 4
+LABELV gameover
+skip 272
+export persid
+align 4
+LABELV persid
+skip 272
+export Save_Loading
+align 4
+LABELV Save_Loading
+skip 272
+export ui_applychanges
+align 4
+LABELV ui_applychanges
+skip 272
+export ui_transitionkey
+align 4
+LABELV ui_transitionkey
+skip 272
+export ui_loading
+align 4
+LABELV ui_loading
+skip 272
+export ui_TeamMembers
+align 4
+LABELV ui_TeamMembers
+skip 272
+export ui_SpecialGame
+align 4
+LABELV ui_SpecialGame
+skip 272
+export ui_HostName
+align 4
+LABELV ui_HostName
+skip 272
+export ui_CustomServer
+align 4
+LABELV ui_CustomServer
+skip 272
+export ui_LoadGame
+align 4
+LABELV ui_LoadGame
+skip 272
+export ui_SaveGame
+align 4
+LABELV ui_SaveGame
+skip 272
+export ui_PlayerMoveAnglePitch
+align 4
+LABELV ui_PlayerMoveAnglePitch
+skip 272
+export ui_PlayerMoveAngleYaw
+align 4
+LABELV ui_PlayerMoveAngleYaw
+skip 272
+export ui_PlayerViewAnglePitch
+align 4
+LABELV ui_PlayerViewAnglePitch
+skip 272
+export ui_PlayerViewAngleYaw
+align 4
+LABELV ui_PlayerViewAngleYaw
+skip 272
+export ui_Weapon
+align 4
+LABELV ui_Weapon
+skip 272
+export ui_UpperAnim
+align 4
+LABELV ui_UpperAnim
+skip 272
+export ui_LowerAnim
+align 4
+LABELV ui_LowerAnim
+skip 272
+export ui_realWarmUp
+align 4
+LABELV ui_realWarmUp
+skip 272
+export ui_realCaptureLimit
+align 4
+LABELV ui_realCaptureLimit
+skip 272
+export ui_recordSPDemo
+align 4
+LABELV ui_recordSPDemo
+skip 272
+export ui_hudFiles
+align 4
+LABELV ui_hudFiles
+skip 272
+export ui_Q3Model
+align 4
+LABELV ui_Q3Model
+skip 272
+export ui_findPlayer
+align 4
+LABELV ui_findPlayer
+skip 272
+export ui_scoreCaptures
+align 4
+LABELV ui_scoreCaptures
+skip 272
+export ui_teamName
+align 4
+LABELV ui_teamName
+skip 272
+export ui_blueteam5
+align 4
+LABELV ui_blueteam5
+skip 272
+export ui_blueteam4
+align 4
+LABELV ui_blueteam4
+skip 272
+export ui_blueteam3
+align 4
+LABELV ui_blueteam3
+skip 272
+export ui_blueteam2
+align 4
+LABELV ui_blueteam2
+skip 272
+export ui_blueteam1
+align 4
+LABELV ui_blueteam1
+skip 272
+export ui_blueteam
+align 4
+LABELV ui_blueteam
+skip 272
+export ui_redteam5
+align 4
+LABELV ui_redteam5
+skip 272
+export ui_redteam4
+align 4
+LABELV ui_redteam4
+skip 272
+export ui_redteam3
+align 4
+LABELV ui_redteam3
+skip 272
+export ui_redteam2
+align 4
+LABELV ui_redteam2
+skip 272
+export ui_redteam1
+align 4
+LABELV ui_redteam1
+skip 272
+export ui_redteam
+align 4
+LABELV ui_redteam
+skip 272
+align 1
+LABELV lastLoadingText
+skip 1024
+align 4
+LABELV lastConnState
+skip 4
+export realyscale
+align 4
+LABELV realyscale
+skip 4
+export realxscale
+align 4
+LABELV realxscale
+skip 4
+export realVidHeight
+align 4
+LABELV realVidHeight
+skip 4
+export realVidWidth
+align 4
+LABELV realVidWidth
+skip 4
+export startTime
+align 4
+LABELV startTime
+skip 4
+export ui_teamArenaFirstRun
+align 4
+LABELV ui_teamArenaFirstRun
+skip 272
+export ui_initialized
+align 4
+LABELV ui_initialized
+skip 272
+export ui_debug
+align 4
+LABELV ui_debug
+skip 272
+export ui_leidebug
+align 4
+LABELV ui_leidebug
+skip 272
+export ui_new
+align 4
+LABELV ui_new
+skip 272
+import ProcessNewUI
+export wideAdjustX
+align 4
+LABELV wideAdjustX
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetBotNameByNumber
+import UI_LoadBots
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_R_RemapShader
+import trap_RealTime
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_R_RegisterFont
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_CompareServers
+import trap_LAN_ServerStatus
+import trap_LAN_ResetPings
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import UI_LoadBestScores
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawSides
+import UI_DrawTopBottom
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+export uiInfo
+align 4
+LABELV uiInfo
+skip 712000
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayersBust
+import UI_DrawPlayerOC
+import UI_DrawPlayerII
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_MainMenu
+import MainMenu_Cache
+import UI_LoadArenas
+import UI_ClearScores
+import UI_AdjustTimeByGame
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+export ui_introPlayed
+align 4
+LABELV ui_introPlayed
+skip 272
+export ui_humansonly
+align 4
+LABELV ui_humansonly
+skip 272
+export ui_serverStatusTimeOut
+align 4
+LABELV ui_serverStatusTimeOut
+skip 272
+export ui_bigFont
+align 4
+LABELV ui_bigFont
+skip 272
+export ui_smallFont
+align 4
+LABELV ui_smallFont
+skip 272
+export ui_scoreTime
+align 4
+LABELV ui_scoreTime
+skip 272
+export ui_scoreShutoutBonus
+align 4
+LABELV ui_scoreShutoutBonus
+skip 272
+export ui_scoreSkillBonus
+align 4
+LABELV ui_scoreSkillBonus
+skip 272
+export ui_scoreTimeBonus
+align 4
+LABELV ui_scoreTimeBonus
+skip 272
+export ui_scoreBase
+align 4
+LABELV ui_scoreBase
+skip 272
+export ui_scoreTeam
+align 4
+LABELV ui_scoreTeam
+skip 272
+export ui_scorePerfect
+align 4
+LABELV ui_scorePerfect
+skip 272
+export ui_scoreScore
+align 4
+LABELV ui_scoreScore
+skip 272
+export ui_scoreGauntlets
+align 4
+LABELV ui_scoreGauntlets
+skip 272
+export ui_scoreAssists
+align 4
+LABELV ui_scoreAssists
+skip 272
+export ui_scoreDefends
+align 4
+LABELV ui_scoreDefends
+skip 272
+export ui_scoreExcellents
+align 4
+LABELV ui_scoreExcellents
+skip 272
+export ui_scoreImpressives
+align 4
+LABELV ui_scoreImpressives
+skip 272
+export ui_scoreAccuracy
+align 4
+LABELV ui_scoreAccuracy
+skip 272
+export ui_singlePlayerActive
+align 4
+LABELV ui_singlePlayerActive
+skip 272
+export ui_lastServerRefresh_3
+align 4
+LABELV ui_lastServerRefresh_3
+skip 272
+export ui_lastServerRefresh_2
+align 4
+LABELV ui_lastServerRefresh_2
+skip 272
+export ui_lastServerRefresh_1
+align 4
+LABELV ui_lastServerRefresh_1
+skip 272
+export ui_lastServerRefresh_0
+align 4
+LABELV ui_lastServerRefresh_0
+skip 272
+export ui_selectedPlayerName
+align 4
+LABELV ui_selectedPlayerName
+skip 272
+export ui_selectedPlayer
+align 4
+LABELV ui_selectedPlayer
+skip 272
+export ui_currentOpponent
+align 4
+LABELV ui_currentOpponent
+skip 272
+export ui_mapIndex
+align 4
+LABELV ui_mapIndex
+skip 272
+export ui_currentNetMap
+align 4
+LABELV ui_currentNetMap
+skip 272
+export ui_currentMap
+align 4
+LABELV ui_currentMap
+skip 272
+export ui_currentTier
+align 4
+LABELV ui_currentTier
+skip 272
+import ui_introFiles
+export ui_menuFiles
+align 4
+LABELV ui_menuFiles
+skip 272
+export ui_opponentName
+align 4
+LABELV ui_opponentName
+skip 272
+export ui_dedicated
+align 4
+LABELV ui_dedicated
+skip 272
+export ui_serverFilterType
+align 4
+LABELV ui_serverFilterType
+skip 272
+export ui_netSource
+align 4
+LABELV ui_netSource
+skip 272
+export ui_joinGameType
+align 4
+LABELV ui_joinGameType
+skip 272
+export ui_actualNetGameType
+align 4
+LABELV ui_actualNetGameType
+skip 272
+export ui_netGameType
+align 4
+LABELV ui_netGameType
+skip 272
+export ui_gameType
+align 4
+LABELV ui_gameType
+skip 272
+export ui_fragLimit
+align 4
+LABELV ui_fragLimit
+skip 272
+export ui_captureLimit
+align 4
+LABELV ui_captureLimit
+skip 272
+export ui_cdkeychecked
+align 4
+LABELV ui_cdkeychecked
+skip 272
+import ui_cdkey
+export ui_server16
+align 4
+LABELV ui_server16
+skip 272
+export ui_server15
+align 4
+LABELV ui_server15
+skip 272
+export ui_server14
+align 4
+LABELV ui_server14
+skip 272
+export ui_server13
+align 4
+LABELV ui_server13
+skip 272
+export ui_server12
+align 4
+LABELV ui_server12
+skip 272
+export ui_server11
+align 4
+LABELV ui_server11
+skip 272
+export ui_server10
+align 4
+LABELV ui_server10
+skip 272
+export ui_server9
+align 4
+LABELV ui_server9
+skip 272
+export ui_server8
+align 4
+LABELV ui_server8
+skip 272
+export ui_server7
+align 4
+LABELV ui_server7
+skip 272
+export ui_server6
+align 4
+LABELV ui_server6
+skip 272
+export ui_server5
+align 4
+LABELV ui_server5
+skip 272
+export ui_server4
+align 4
+LABELV ui_server4
+skip 272
+export ui_server3
+align 4
+LABELV ui_server3
+skip 272
+export ui_server2
+align 4
+LABELV ui_server2
+skip 272
+export ui_server1
+align 4
+LABELV ui_server1
+skip 272
+export ui_marks
+align 4
+LABELV ui_marks
+skip 272
+export ui_drawCrosshairNames
+align 4
+LABELV ui_drawCrosshairNames
+skip 272
+export ui_drawCrosshair
+align 4
+LABELV ui_drawCrosshair
+skip 272
+export ui_brassTime
+align 4
+LABELV ui_brassTime
+skip 272
+export ui_browserShowEmpty
+align 4
+LABELV ui_browserShowEmpty
+skip 272
+export ui_browserShowFull
+align 4
+LABELV ui_browserShowFull
+skip 272
+export ui_browserSortKey
+align 4
+LABELV ui_browserSortKey
+skip 272
+export ui_browserGameType
+align 4
+LABELV ui_browserGameType
+skip 272
+export ui_browserMaster
+align 4
+LABELV ui_browserMaster
+skip 272
+export ui_spSelection
+align 4
+LABELV ui_spSelection
+skip 272
+export ui_spSkill
+align 4
+LABELV ui_spSkill
+skip 272
+export ui_spVideos
+align 4
+LABELV ui_spVideos
+skip 272
+export ui_spAwards
+align 4
+LABELV ui_spAwards
+skip 272
+export ui_spScores5
+align 4
+LABELV ui_spScores5
+skip 272
+export ui_spScores4
+align 4
+LABELV ui_spScores4
+skip 272
+export ui_spScores3
+align 4
+LABELV ui_spScores3
+skip 272
+export ui_spScores2
+align 4
+LABELV ui_spScores2
+skip 272
+export ui_spScores1
+align 4
+LABELV ui_spScores1
+skip 272
+export ui_botsFile
+align 4
+LABELV ui_botsFile
+skip 272
+export ui_arenasFile
+align 4
+LABELV ui_arenasFile
+skip 272
+export ui_ctf_friendly
+align 4
+LABELV ui_ctf_friendly
+skip 272
+export ui_ctf_timelimit
+align 4
+LABELV ui_ctf_timelimit
+skip 272
+export ui_ctf_capturelimit
+align 4
+LABELV ui_ctf_capturelimit
+skip 272
+export ui_team_friendly
+align 4
+LABELV ui_team_friendly
+skip 272
+export ui_team_timelimit
+align 4
+LABELV ui_team_timelimit
+skip 272
+export ui_team_fraglimit
+align 4
+LABELV ui_team_fraglimit
+skip 272
+export ui_tourney_timelimit
+align 4
+LABELV ui_tourney_timelimit
+skip 272
+export ui_tourney_fraglimit
+align 4
+LABELV ui_tourney_fraglimit
+skip 272
+export ui_ffa_timelimit
+align 4
+LABELV ui_ffa_timelimit
+skip 272
+export ui_ffa_fraglimit
+align 4
+LABELV ui_ffa_fraglimit
+skip 272
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $5402
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $5401
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $5389
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $5367
+byte 1 37
+byte 1 115
+byte 1 45
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $5332
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $5329
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $5319
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $5301
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5300
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $5299
+byte 1 83
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $5298
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5297
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $5296
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5295
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5294
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 83
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5293
+byte 1 55
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $5292
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $5291
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $5290
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $5289
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5288
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $5287
+byte 1 83
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $5286
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $5285
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5284
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $5283
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5282
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $5281
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $5280
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $5279
+byte 1 48
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $5278
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5277
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $5276
+byte 1 48
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $5275
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5274
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $5273
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $5272
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5271
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5270
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $5269
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5268
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $5267
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5266
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $5265
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 51
+byte 1 0
+align 1
+LABELV $5264
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 50
+byte 1 0
+align 1
+LABELV $5263
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $5262
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $5261
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5260
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $5259
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $5258
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $5257
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $5256
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $5255
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $5254
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $5253
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $5252
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $5251
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $5250
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $5249
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $5248
+byte 1 51
+byte 1 0
+align 1
+LABELV $5247
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $5246
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5245
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5244
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $5243
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $5242
+byte 1 80
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $5241
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5240
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $5239
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $5238
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $5237
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $5236
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $5235
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $5234
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $5233
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $5232
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $5231
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $5230
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $5229
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 57
+byte 1 0
+align 1
+LABELV $5228
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 56
+byte 1 0
+align 1
+LABELV $5227
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 55
+byte 1 0
+align 1
+LABELV $5226
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 54
+byte 1 0
+align 1
+LABELV $5225
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $5224
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $5223
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $5222
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $5221
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $5220
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $5219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5218
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $5217
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $5216
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $5215
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $5214
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $5213
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $5212
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $5211
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $5210
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $5209
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 53
+byte 1 0
+align 1
+LABELV $5208
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 52
+byte 1 0
+align 1
+LABELV $5207
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 51
+byte 1 0
+align 1
+LABELV $5206
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $5205
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $5204
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $5203
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $5202
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $5201
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5200
+byte 1 56
+byte 1 0
+align 1
+LABELV $5199
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5198
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $5197
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5196
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5195
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5194
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5193
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5192
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $5183
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $5180
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5177
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $5174
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $5164
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $5161
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5160
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $5159
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $5155
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $5148
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $5146
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $5143
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $5134
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $5133
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $5129
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 0
+align 1
+LABELV $5126
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $5125
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $5124
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $5097
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $5096
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $5093
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $5089
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $5088
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 0
+align 1
+LABELV $5085
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 77
+byte 1 66
+byte 1 0
+align 1
+LABELV $5082
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 71
+byte 1 66
+byte 1 0
+align 1
+LABELV $5054
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $4988
+byte 1 49
+byte 1 54
+byte 1 53
+byte 1 0
+align 1
+LABELV $4986
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $4985
+byte 1 48
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $4984
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4983
+byte 1 48
+byte 1 46
+byte 1 56
+byte 1 0
+align 1
+LABELV $4982
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4981
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $4963
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $4959
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $4955
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $4953
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $4844
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4825
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4824
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $4821
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4820
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $4819
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 0
+align 1
+LABELV $4811
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $4810
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4808
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4807
+byte 1 46
+byte 1 0
+align 1
+LABELV $4797
+byte 1 47
+byte 1 0
+align 1
+LABELV $4796
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $4747
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $4742
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4737
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4722
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4659
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4654
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4612
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4609
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $4604
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $4587
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4577
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $4549
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4539
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $4532
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4529
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 0
+align 1
+LABELV $4525
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4520
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $4493
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $4486
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $4321
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4212
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4208
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $4201
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $4198
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4197
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 93
+byte 1 0
+align 1
+LABELV $4011
+byte 1 115
+byte 1 0
+align 1
+LABELV $4008
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3924
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3866
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3858
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3847
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3802
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3801
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $3800
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $3762
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3761
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $3760
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $3759
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3758
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3757
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3756
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3755
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $3754
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3753
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3739
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3733
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3721
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3701
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $3700
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3699
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $3654
+byte 1 87
+byte 1 101
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 33
+byte 1 0
+align 1
+LABELV $3643
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $3489
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3486
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3450
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3449
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $3444
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 98
+byte 1 67
+byte 1 108
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3439
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3436
+byte 1 52
+byte 1 0
+align 1
+LABELV $3435
+byte 1 103
+byte 1 108
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $3426
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3418
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $3406
+byte 1 10
+byte 1 0
+align 1
+LABELV $3399
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3390
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $3389
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3385
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3361
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3348
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3345
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3344
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $3341
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3336
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $3327
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3324
+byte 1 60
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 62
+byte 1 0
+align 1
+LABELV $3323
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3320
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3314
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3298
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3295
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $3290
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3284
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3278
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $3272
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3267
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3261
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 75
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3255
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3249
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $3246
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3243
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $3240
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $3235
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $3232
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 79
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $3216
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $3208
+byte 1 117
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3172
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3167
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3166
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $3163
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3160
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $3157
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3156
+byte 1 81
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $3146
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3143
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3129
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3124
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3117
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3107
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3101
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3094
+byte 1 83
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $3091
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3082
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $3079
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $3074
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3073
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $3070
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 59
+byte 1 0
+align 1
+LABELV $3067
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3066
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $3061
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 32
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $3056
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $3053
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $3050
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3047
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $3038
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $3034
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $3031
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $3021
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $3018
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3015
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3006
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $3003
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3002
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2999
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2996
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2989
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2988
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $2985
+byte 1 67
+byte 1 68
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $2984
+byte 1 67
+byte 1 68
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 65
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $2983
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $2982
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $2979
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $2978
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 67
+byte 1 68
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $2970
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 52
+byte 1 0
+align 1
+LABELV $2969
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 51
+byte 1 0
+align 1
+LABELV $2968
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 50
+byte 1 0
+align 1
+LABELV $2967
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 49
+byte 1 0
+align 1
+LABELV $2966
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 67
+byte 1 68
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $2963
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2962
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2961
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2960
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2959
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2956
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2952
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2941
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $2936
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 80
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $2926
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $2923
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2894
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2893
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2875
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2872
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2869
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2864
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $2861
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $2860
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2859
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2858
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $2857
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 0
+align 1
+LABELV $2856
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 121
+byte 1 0
+align 1
+LABELV $2855
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2854
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2853
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2852
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2851
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2847
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2842
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2838
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 98
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $2831
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2830
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2826
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2823
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2818
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 100
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2817
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2814
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2813
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2810
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2809
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2805
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2781
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2770
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 10
+byte 1 0
+align 1
+LABELV $2752
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $2746
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $2745
+byte 1 50
+byte 1 0
+align 1
+LABELV $2742
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2738
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2737
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2734
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2733
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2732
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2731
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2730
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2729
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2728
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2727
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2726
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2725
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2724
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2723
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2722
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2721
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2720
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2719
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2718
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $2715
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2711
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2705
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2676
+byte 1 46
+byte 1 100
+byte 1 109
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2675
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $2673
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $2672
+byte 1 100
+byte 1 109
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2669
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $2654
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $2653
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 0
+align 1
+LABELV $2630
+byte 1 36
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2582
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $2560
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $2467
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $2356
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2311
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2310
+byte 1 49
+byte 1 0
+align 1
+LABELV $2244
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $2225
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2199
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2006
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $2002
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1999
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1878
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1874
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 41
+byte 1 0
+align 1
+LABELV $1861
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1851
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1843
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1823
+byte 1 110
+byte 1 0
+align 1
+LABELV $1812
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1811
+byte 1 116
+byte 1 0
+align 1
+LABELV $1810
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $1775
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1765
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1763
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1762
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1743
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1725
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1692
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1528
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1512
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1507
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 0
+align 1
+LABELV $1459
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1446
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1441
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1438
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1404
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1389
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1388
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1384
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1383
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $1382
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $1378
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1377
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 89
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $1374
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 86
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1373
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 86
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 89
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $1365
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1364
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1348
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1347
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1346
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 81
+byte 1 51
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1303
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $1288
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1273
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1271
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1241
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $1238
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1232
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1231
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1225
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1224
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1223
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1216
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1215
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1209
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1175
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $1156
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1151
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1123
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1113
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1112
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1100
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1099
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1098
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1097
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1083
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1081
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1079
+byte 1 53
+byte 1 0
+align 1
+LABELV $1078
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1077
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $1076
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $1075
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $1074
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $1073
+byte 1 51
+byte 1 53
+byte 1 0
+align 1
+LABELV $1072
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $1071
+byte 1 52
+byte 1 53
+byte 1 0
+align 1
+LABELV $1070
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $1069
+byte 1 53
+byte 1 53
+byte 1 0
+align 1
+LABELV $1068
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $1067
+byte 1 54
+byte 1 53
+byte 1 0
+align 1
+LABELV $1066
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $1065
+byte 1 55
+byte 1 53
+byte 1 0
+align 1
+LABELV $1064
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $1063
+byte 1 56
+byte 1 53
+byte 1 0
+align 1
+LABELV $1062
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $1061
+byte 1 57
+byte 1 53
+byte 1 0
+align 1
+LABELV $1060
+byte 1 78
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1059
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1053
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1052
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1047
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1044
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1024
+byte 1 94
+byte 1 49
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1021
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1020
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $998
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $992
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $978
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $972
+byte 1 71
+byte 1 108
+byte 1 121
+byte 1 112
+byte 1 104
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $967
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $966
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $960
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $952
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $944
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $936
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 0
+align 1
+LABELV $928
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $920
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $912
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $904
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $895
+byte 1 102
+byte 1 120
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $886
+byte 1 102
+byte 1 120
+byte 1 67
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $877
+byte 1 102
+byte 1 120
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $868
+byte 1 102
+byte 1 120
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $859
+byte 1 102
+byte 1 120
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $850
+byte 1 102
+byte 1 120
+byte 1 89
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $842
+byte 1 102
+byte 1 120
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $834
+byte 1 102
+byte 1 120
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $826
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 82
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $818
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $810
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $802
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $794
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $786
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $778
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 72
+byte 1 111
+byte 1 114
+byte 1 122
+byte 1 0
+align 1
+LABELV $770
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $762
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $754
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $746
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $738
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $730
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $722
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $714
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $706
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $698
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $690
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $682
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $674
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $666
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $653
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $645
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 89
+byte 1 0
+align 1
+LABELV $637
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 88
+byte 1 0
+align 1
+LABELV $629
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $621
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $613
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $601
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $593
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $585
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $577
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $569
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $561
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $552
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $543
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $532
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $528
+byte 1 125
+byte 1 0
+align 1
+LABELV $519
+byte 1 123
+byte 1 0
+align 1
+LABELV $512
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $509
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $496
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $473
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $472
+byte 1 48
+byte 1 0
+align 1
+LABELV $471
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $256
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $253
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $250
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $247
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $244
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $241
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $238
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $236
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $229
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $226
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $223
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $220
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $215
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $212
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $209
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $206
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $203
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $200
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $197
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 100
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $190
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $187
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $183
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $179
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $175
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $171
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $167
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $163
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $160
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $157
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $138
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 0
+align 1
+LABELV $137
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $136
+byte 1 68
+byte 1 79
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $135
+byte 1 68
+byte 1 79
+byte 1 85
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 68
+byte 1 0
+align 1
+LABELV $134
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 0
+align 1
+LABELV $133
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $132
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $131
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $130
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 76
+byte 1 79
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $129
+byte 1 49
+byte 1 70
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $128
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $127
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $126
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $125
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $124
+byte 1 70
+byte 1 70
+byte 1 65
+byte 1 0
+align 1
+LABELV $123
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $122
+byte 1 79
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $121
+byte 1 119
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $120
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $119
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $118
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $117
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $116
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $115
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $114
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $113
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $112
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $111
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $110
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $109
+byte 1 0
+align 1
+LABELV $108
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $107
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $104
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $103
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $102
+byte 1 68
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $101
+byte 1 78
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $100
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $99
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $98
+byte 1 65
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $97
+byte 1 74
+byte 1 117
+byte 1 108
+byte 1 0
+align 1
+LABELV $96
+byte 1 74
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $95
+byte 1 77
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $94
+byte 1 65
+byte 1 112
+byte 1 114
+byte 1 0
+align 1
+LABELV $93
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $92
+byte 1 70
+byte 1 101
+byte 1 98
+byte 1 0
+align 1
+LABELV $91
+byte 1 74
+byte 1 97
+byte 1 110
+byte 1 0
@@ -0,0 +1,40792 @@
+data
+align 4
+LABELV captureFunc
+byte 4 0
+align 4
+LABELV captureData
+byte 4 0
+align 4
+LABELV itemCapture
+byte 4 0
+export DC
+align 4
+LABELV DC
+byte 4 0
+align 4
+LABELV g_waitingForKey
+byte 4 0
+align 4
+LABELV g_editingField
+byte 4 0
+export BackgroundTrack
+align 4
+LABELV BackgroundTrack
+byte 4 0
+align 4
+LABELV g_bindItem
+byte 4 0
+align 4
+LABELV g_editItem
+byte 4 0
+export menuCount
+align 4
+LABELV menuCount
+byte 4 0
+export openMenuCount
+align 4
+LABELV openMenuCount
+byte 4 0
+align 4
+LABELV debugMode
+byte 4 0
+align 4
+LABELV lastListBoxClickTime
+byte 4 0
+export UI_Alloc
+code
+proc UI_Alloc 12 4
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 1048576
+LEI4 $42
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $44
+ADDRGP4 $46
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $44
+CNSTP4 0
+RETP4
+ADDRGP4 $41
+JUMPV
+LABELV $42
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 15
+ADDI4
+CNSTI4 -16
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $41
+endproc UI_Alloc 12 4
+export UI_InitMemory
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $47
+endproc UI_InitMemory 4 0
+export UI_OutOfMemory
+proc UI_OutOfMemory 0 0
+ADDRGP4 outOfMemory
+INDIRI4
+RETI4
+LABELV $48
+endproc UI_OutOfMemory 0 0
+proc hashForString 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $51
+JUMPV
+LABELV $50
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CVIU4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+CVIU4 4
+MULU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $51
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $50
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 2047
+BANDU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+RETU4
+LABELV $49
+endproc hashForString 20 4
+data
+align 4
+LABELV strPoolIndex
+byte 4 0
+align 4
+LABELV strHandleCount
+byte 4 0
+align 4
+LABELV $54
+address $55
+export String_Alloc
+code
+proc String_Alloc 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $56
+CNSTP4 0
+RETP4
+ADDRGP4 $53
+JUMPV
+LABELV $56
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $58
+ADDRGP4 $54
+INDIRP4
+RETP4
+ADDRGP4 $53
+JUMPV
+LABELV $58
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 hashForString
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16
+INDIRU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $61
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $63
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $53
+JUMPV
+LABELV $63
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $61
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $60
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 393216
+GEI4 $65
+ADDRLP4 24
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ADDRGP4 strPoolIndex
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $68
+JUMPV
+LABELV $67
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $68
+ADDRLP4 36
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $70
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+NEU4 $67
+LABELV $70
+CNSTI4 8
+ARGI4
+ADDRLP4 40
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $71
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $72
+JUMPV
+LABELV $71
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $72
+ADDRLP4 24
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+RETP4
+ADDRGP4 $53
+JUMPV
+LABELV $65
+CNSTP4 0
+RETP4
+LABELV $53
+endproc String_Alloc 44 8
+export String_Report
+proc String_Report 12 16
+ADDRGP4 $74
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $75
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1220542464
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 393216
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 allocPoint
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1233125376
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $73
+endproc String_Report 12 16
+export String_Init
+proc String_Init 16 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $79
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 strHandle
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $80
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+LTI4 $79
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 strHandleCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 menuCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 openMenuCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 Item_SetupKeywordHash
+CALLV
+pop
+ADDRGP4 Menu_SetupKeywordHash
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $83
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $83
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+LABELV $83
+LABELV $78
+endproc String_Init 16 0
+bss
+align 1
+LABELV $86
+skip 4096
+code
+proc PC_SourceError 136 16
+ADDRLP4 132
+ADDRFP4 4+4
+ASGNP4
+ADDRGP4 $86
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_PC_SourceFileAndLine
+CALLI4
+pop
+ADDRGP4 $88
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $85
+endproc PC_SourceError 136 16
+export LerpColor
+proc LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $90
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $94
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $96
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $96
+LABELV $95
+LABELV $91
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $90
+LABELV $89
+endproc LerpColor 12 0
+export Float_Parse
+proc Float_Parse 24 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $99
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $99
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $101
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $101
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $103
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $104
+CNSTI4 1
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $101
+CNSTI4 0
+RETI4
+LABELV $98
+endproc Float_Parse 24 8
+export PC_Float_Parse
+proc PC_Float_Parse 1052 12
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $106
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $108
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $111
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $111
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+LABELV $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $113
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $113
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+ASGNF4
+LABELV $118
+CNSTI4 1
+RETI4
+LABELV $105
+endproc PC_Float_Parse 1052 12
+export Color_Parse
+proc Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $126
+CNSTI4 0
+RETI4
+ADDRGP4 $121
+JUMPV
+LABELV $126
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $122
+CNSTI4 1
+RETI4
+LABELV $121
+endproc Color_Parse 12 8
+export PC_Color_Parse
+proc PC_Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $133
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $129
+CNSTI4 1
+RETI4
+LABELV $128
+endproc PC_Color_Parse 12 8
+export Int_Parse
+proc Int_Parse 20 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $136
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRLP4 12
+INDIRI4
+CNSTI4 59
+EQI4 $136
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $136
+CNSTI4 0
+RETI4
+LABELV $135
+endproc Int_Parse 20 8
+export PC_Int_Parse
+proc PC_Int_Parse 1052 12
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $139
+CNSTI4 0
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $139
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $141
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $144
+CNSTI4 0
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $144
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+LABELV $141
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $146
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $146
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $151
+ADDRLP4 1048
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $151
+CNSTI4 1
+RETI4
+LABELV $138
+endproc PC_Int_Parse 1052 12
+export Rect_Parse
+proc Rect_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $160
+CNSTI4 1
+RETI4
+ADDRGP4 $153
+JUMPV
+LABELV $160
+LABELV $158
+LABELV $156
+LABELV $154
+CNSTI4 0
+RETI4
+LABELV $153
+endproc Rect_Parse 16 8
+export PC_Rect_Parse
+proc PC_Rect_Parse 16 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $165
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $167
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $169
+CNSTI4 1
+RETI4
+ADDRGP4 $162
+JUMPV
+LABELV $169
+LABELV $167
+LABELV $165
+LABELV $163
+CNSTI4 0
+RETI4
+LABELV $162
+endproc PC_Rect_Parse 16 8
+export String_Parse
+proc String_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $172
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $172
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $171
+JUMPV
+LABELV $172
+CNSTI4 0
+RETI4
+LABELV $171
+endproc String_Parse 16 8
+export PC_String_Parse
+proc PC_String_Parse 1048 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $175
+CNSTI4 0
+RETI4
+ADDRGP4 $174
+JUMPV
+LABELV $175
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1044
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $174
+endproc PC_String_Parse 1048 8
+export PC_Script_Parse
+proc PC_Script_Parse 5156 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 5136
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 5136
+INDIRI4
+CNSTI4 0
+NEI4 $179
+CNSTI4 0
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $179
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 5140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5140
+INDIRI4
+CNSTI4 0
+EQI4 $186
+CNSTI4 0
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $185
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 5144
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 5144
+INDIRI4
+CNSTI4 0
+NEI4 $188
+CNSTI4 0
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $188
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 5148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 5148
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRLP4 1040
+ARGP4
+ADDRLP4 5152
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 5152
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $178
+JUMPV
+LABELV $190
+ADDRLP4 0+16+1
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $194
+ADDRGP4 $198
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 5152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 5152
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRLP4 1040
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $195
+ADDRLP4 1040
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRGP4 $201
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $186
+ADDRGP4 $185
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $178
+endproc PC_Script_Parse 5156 12
+export Init_Display
+proc Init_Display 0 0
+ADDRGP4 DC
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $202
+endproc Init_Display 0 0
+export GradientBar_Paint
+proc GradientBar_Paint 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 61932
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $203
+endproc GradientBar_Paint 12 20
+export Window_Init
+proc Window_Init 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 180
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $204
+endproc Window_Init 8 12
+export Fade
+proc Fade 8 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 96
+BANDI4
+CNSTI4 0
+EQI4 $206
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+LEI4 $208
+ADDRFP4 12
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $210
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+GTF4 $211
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -37
+BANDI4
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LTF4 $214
+ADDRFP4 4
+INDIRP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $216
+LABELV $214
+LABELV $211
+LABELV $208
+LABELV $206
+LABELV $205
+endproc Fade 8 0
+export Window_Paint
+proc Window_Paint 64 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $222
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $224
+LABELV $226
+ADDRGP4 $218
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 16+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+LABELV $227
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $234
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $242
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $244
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $250
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $254
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $255
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $268
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -2
+ASGNI4
+LABELV $268
+LABELV $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 16+8
+INDIRF4
+ARGF4
+ADDRLP4 16+12
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $270
+LABELV $261
+LABELV $255
+LABELV $245
+LABELV $243
+LABELV $233
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $277
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $279
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $280
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $276
+JUMPV
+LABELV $277
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $290
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRLP4 44+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+LABELV $290
+LABELV $289
+LABELV $287
+LABELV $276
+LABELV $218
+endproc Window_Paint 64 28
+export Item_SetScreenCoords
+proc Item_SetScreenCoords 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $295
+ADDRGP4 $294
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $297
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $294
+endproc Item_SetScreenCoords 16 0
+export Item_UpdatePosition
+proc Item_UpdatePosition 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $300
+LABELV $302
+ADDRGP4 $299
+JUMPV
+LABELV $300
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $303
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $299
+endproc Item_UpdatePosition 28 12
+export Menu_UpdatePosition
+proc Menu_UpdatePosition 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $306
+ADDRGP4 $305
+JUMPV
+LABELV $306
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $308
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $310
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $311
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $313
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $310
+LABELV $305
+endproc Menu_UpdatePosition 20 12
+export Menu_PostParse
+proc Menu_PostParse 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $315
+ADDRGP4 $314
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1142947840
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1139802112
+ASGNF4
+LABELV $317
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $314
+endproc Menu_PostParse 0 4
+export Menu_ClearFocus
+proc Menu_ClearFocus 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $320
+CNSTP4 0
+RETP4
+ADDRGP4 $319
+JUMPV
+LABELV $320
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $322
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $326
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $326
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $328
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $328
+LABELV $323
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $325
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $322
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $319
+endproc Menu_ClearFocus 20 8
+export IsVisible
+proc IsVisible 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $332
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $332
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $333
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $330
+endproc IsVisible 12 0
+export Rect_ContainsPoint
+proc Rect_ContainsPoint 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $335
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $337
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $337
+ADDRLP4 12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $337
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $337
+CNSTI4 1
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $337
+LABELV $335
+CNSTI4 0
+RETI4
+LABELV $334
+endproc Rect_ContainsPoint 20 0
+export Menu_ItemsMatchingGroup
+proc Menu_ItemsMatchingGroup 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $346
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $344
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $344
+LABELV $346
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $344
+LABELV $341
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $343
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $340
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $339
+endproc Menu_ItemsMatchingGroup 20 8
+export Menu_GetMatchingItemByNumber
+proc Menu_GetMatchingItemByNumber 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $348
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $352
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $352
+LABELV $354
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $355
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $347
+JUMPV
+LABELV $355
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $352
+LABELV $349
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $351
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $348
+CNSTP4 0
+RETP4
+LABELV $347
+endproc Menu_GetMatchingItemByNumber 20 8
+export Script_SetColor
+proc Script_SetColor 36 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $360
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4194304
+BORI4
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $363
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+LABELV $366
+LABELV $364
+LABELV $361
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $369
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $371
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRGP4 $357
+JUMPV
+LABELV $375
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $372
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $371
+LABELV $369
+LABELV $358
+LABELV $357
+endproc Script_SetColor 36 8
+export Script_SetAsset
+proc Script_SetAsset 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $380
+LABELV $380
+LABELV $378
+LABELV $377
+endproc Script_SetAsset 8 8
+export Script_SetBackground
+proc Script_SetBackground 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $383
+LABELV $382
+endproc Script_SetBackground 12 8
+export Menu_FindItemByName
+proc Menu_FindItemByName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $388
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $386
+LABELV $388
+CNSTP4 0
+RETP4
+ADDRGP4 $385
+JUMPV
+LABELV $386
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $389
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $393
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $385
+JUMPV
+LABELV $393
+LABELV $390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $392
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $389
+CNSTP4 0
+RETP4
+LABELV $385
+endproc Menu_FindItemByName 12 8
+export Script_SetTeamColor
+proc Script_SetTeamColor 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $396
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $398
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $399
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $398
+LABELV $396
+LABELV $395
+endproc Script_SetTeamColor 24 4
+export Script_SetItemColor
+proc Script_SetItemColor 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 32
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 36
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 56
+ADDRGP4 Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $405
+ADDRGP4 $402
+JUMPV
+LABELV $405
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $411
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $413
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $365
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $415
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $417
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+LABELV $417
+LABELV $416
+LABELV $414
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $419
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $421
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $422
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $421
+LABELV $419
+LABELV $411
+LABELV $408
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $410
+ADDRLP4 40
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $407
+LABELV $403
+LABELV $402
+endproc Script_SetItemColor 80 12
+export Menu_ClearItemByName
+proc Menu_ClearItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 20
+INDIRU4
+CNSTU4 0
+EQU4 $430
+ADDRLP4 20
+INDIRU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $430
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $430
+LABELV $427
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $429
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $426
+LABELV $425
+endproc Menu_ClearItemByName 24 12
+export Menu_DisableItemFocus
+proc Menu_DisableItemFocus 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $436
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 67108864
+BORI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -67108865
+BANDI4
+ASGNI4
+LABELV $438
+LABELV $434
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $436
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $433
+LABELV $432
+endproc Menu_DisableItemFocus 24 12
+export Menu_ClearItemAlpha
+proc Menu_ClearItemAlpha 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $441
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $443
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $440
+LABELV $439
+endproc Menu_ClearItemAlpha 20 12
+export Menu_ShowItemByName
+proc Menu_ShowItemByName 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $448
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $449
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $453
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $454
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $457
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $457
+LABELV $452
+LABELV $449
+LABELV $446
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $448
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $445
+LABELV $444
+endproc Menu_ShowItemByName 28 12
+export Menu_FadeItemByName
+proc Menu_FadeItemByName 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $464
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 36
+BORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRLP4 20
+CNSTI4 68
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $467
+LABELV $464
+LABELV $461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $463
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $460
+LABELV $459
+endproc Menu_FadeItemByName 32 12
+export Menus_FindByName
+proc Menus_FindByName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $472
+JUMPV
+LABELV $469
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $473
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $468
+JUMPV
+LABELV $473
+LABELV $470
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $472
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $469
+CNSTP4 0
+RETP4
+LABELV $468
+endproc Menus_FindByName 8 8
+export Menus_ShowByName
+proc Menus_ShowByName 8 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $477
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+LABELV $477
+LABELV $476
+endproc Menus_ShowByName 8 4
+export Menus_OpenByName
+proc Menus_OpenByName 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $479
+endproc Menus_OpenByName 0 4
+proc Menu_RunCloseScript 612 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $481
+ADDRLP4 8+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $481
+LABELV $480
+endproc Menu_RunCloseScript 612 8
+export Menus_CloseByName
+proc Menus_CloseByName 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $484
+JUMPV
+LABELV $485
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $488
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $488
+LABELV $484
+endproc Menus_CloseByName 16 8
+export Menus_CloseAll
+proc Menus_CloseAll 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $491
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $492
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $494
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $491
+LABELV $490
+endproc Menus_CloseAll 8 4
+export Script_Clear
+proc Script_Clear 12 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $497
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearItemByName
+CALLV
+pop
+LABELV $497
+LABELV $496
+endproc Script_Clear 12 12
+export Script_FocusDisable
+proc Script_FocusDisable 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_DisableItemFocus
+CALLV
+pop
+LABELV $500
+LABELV $499
+endproc Script_FocusDisable 8 12
+export Script_FocusEnable
+proc Script_FocusEnable 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_DisableItemFocus
+CALLV
+pop
+LABELV $503
+LABELV $502
+endproc Script_FocusEnable 8 12
+export Script_ClearAlpha
+proc Script_ClearAlpha 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearItemAlpha
+CALLV
+pop
+LABELV $506
+LABELV $505
+endproc Script_ClearAlpha 8 8
+export Script_Show
+proc Script_Show 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $509
+LABELV $508
+endproc Script_Show 8 12
+export Script_Hide
+proc Script_Hide 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $512
+LABELV $511
+endproc Script_Hide 8 12
+export Script_FadeIn
+proc Script_FadeIn 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $515
+LABELV $514
+endproc Script_FadeIn 8 12
+export Script_FadeOut
+proc Script_FadeOut 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $518
+LABELV $517
+endproc Script_FadeOut 8 12
+export Script_Open
+proc Script_Open 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $521
+LABELV $520
+endproc Script_Open 8 8
+export Script_ConditionalOpen
+proc Script_ConditionalOpen 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $524
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $524
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $524
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $526
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $527
+LABELV $524
+LABELV $523
+endproc Script_ConditionalOpen 32 8
+export Script_Close
+proc Script_Close 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $529
+LABELV $528
+endproc Script_Close 8 8
+export Menu_TransitionItemByName
+proc Menu_TransitionItemByName 56 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $535
+JUMPV
+LABELV $532
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $536
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 260
+BORI4
+ASGNI4
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $538
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 33554432
+BORI4
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRLP4 24
+CNSTI4 264
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $539
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRFP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRFP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ADDRFP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 52
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ADDRFP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $536
+LABELV $533
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $535
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $532
+LABELV $531
+endproc Menu_TransitionItemByName 56 12
+export Script_Transition
+proc Script_Transition 100 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 52
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 56
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 80
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_TransitionItemByName
+CALLV
+pop
+LABELV $543
+LABELV $541
+LABELV $540
+endproc Script_Transition 100 32
+export Script_xTransition
+proc Script_xTransition 100 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 52
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 56
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 80
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_TransitionItemByName
+CALLV
+pop
+LABELV $548
+LABELV $546
+LABELV $545
+endproc Script_xTransition 100 32
+export Menu_OrbitItemByName
+proc Menu_OrbitItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $554
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $555
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 65540
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $555
+LABELV $552
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $554
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $551
+LABELV $550
+endproc Menu_OrbitItemByName 24 12
+export Script_Orbit
+proc Script_Orbit 48 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $558
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Menu_OrbitItemByName
+CALLV
+pop
+LABELV $560
+LABELV $558
+LABELV $557
+endproc Script_Orbit 48 28
+export Script_SetFocus
+proc Script_SetFocus 36 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_FindItemByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $565
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $565
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $565
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearFocus
+CALLP4
+pop
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $567
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $567
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62036
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $569
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 62036
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $569
+LABELV $565
+LABELV $563
+LABELV $562
+endproc Script_SetFocus 36 8
+export Script_ClearFocus
+proc Script_ClearFocus 4 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 String_Parse
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearFocus
+CALLP4
+pop
+LABELV $571
+endproc Script_ClearFocus 4 8
+export Script_SetPlayerModel
+proc Script_SetPlayerModel 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $573
+ADDRGP4 $575
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $573
+LABELV $572
+endproc Script_SetPlayerModel 8 8
+export Script_SetPlayerHead
+proc Script_SetPlayerHead 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRGP4 $579
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $577
+LABELV $576
+endproc Script_SetPlayerHead 8 8
+export Script_SetCvar
+proc Script_SetCvar 16 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $581
+LABELV $580
+endproc Script_SetCvar 16 8
+export Script_ClearCvar
+proc Script_ClearCvar 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $584
+LABELV $583
+endproc Script_ClearCvar 8 8
+export Script_SetCvarFloat
+proc Script_SetCvarFloat 20 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $589
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $587
+LABELV $586
+endproc Script_SetCvarFloat 20 8
+export Script_CopyCvar
+proc Script_CopyCvar 1040 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $591
+LABELV $590
+endproc Script_CopyCvar 1040 12
+export Script_Exec
+proc Script_Exec 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $594
+ADDRGP4 $596
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $594
+LABELV $593
+endproc Script_Exec 12 8
+export Script_Play
+proc Script_Play 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $598
+LABELV $597
+endproc Script_Play 12 8
+export Script_playLooped
+proc Script_playLooped 20 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 BackgroundTrack
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $603
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 BackgroundTrack
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRGP4 BackgroundTrack
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 BackgroundTrack
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $605
+LABELV $604
+LABELV $601
+LABELV $600
+endproc Script_playLooped 20 8
+data
+export commandList
+align 4
+LABELV commandList
+address $607
+address Script_FadeIn
+address $608
+address Script_FadeOut
+address $609
+address Script_Show
+address $610
+address Script_Hide
+address $611
+address Script_SetColor
+address $612
+address Script_Open
+address $613
+address Script_ConditionalOpen
+address $614
+address Script_Close
+address $615
+address Script_SetAsset
+address $616
+address Script_SetBackground
+address $617
+address Script_SetItemColor
+address $618
+address Script_SetTeamColor
+address $619
+address Script_SetFocus
+address $620
+address Script_SetPlayerModel
+address $621
+address Script_SetPlayerHead
+address $622
+address Script_Transition
+address $623
+address Script_SetCvar
+address $624
+address Script_xTransition
+address $625
+address Script_SetCvarFloat
+address $626
+address Script_ClearCvar
+address $627
+address Script_Clear
+address $628
+address Script_FocusDisable
+address $629
+address Script_FocusEnable
+address $630
+address Script_CopyCvar
+address $631
+address Script_ClearFocus
+address $632
+address Script_ClearAlpha
+address $633
+address Script_Exec
+address $634
+address Script_Play
+address $635
+address Script_playLooped
+address $636
+address Script_Orbit
+export scriptCommandCount
+align 4
+LABELV scriptCommandCount
+byte 4 30
+export Item_RunScript
+code
+proc Item_RunScript 4136 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4108
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4108
+INDIRU4
+EQU4 $638
+ADDRLP4 4112
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4112
+INDIRP4
+CVPU4 4
+ADDRLP4 4108
+INDIRU4
+EQU4 $638
+ADDRLP4 4112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $638
+ADDRLP4 12
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 8
+ARGP4
+ADDRLP4 4116
+ARGP4
+ADDRLP4 4120
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4120
+INDIRI4
+CNSTI4 0
+NEI4 $643
+ADDRGP4 $637
+JUMPV
+LABELV $643
+ADDRLP4 4124
+ADDRLP4 4116
+INDIRP4
+ASGNP4
+ADDRLP4 4124
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $645
+ADDRLP4 4124
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $645
+ADDRGP4 $641
+JUMPV
+LABELV $645
+ADDRLP4 4128
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4128
+INDIRI4
+ASGNI4
+ADDRGP4 $650
+JUMPV
+LABELV $647
+ADDRLP4 4116
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4132
+INDIRI4
+CNSTI4 0
+NEI4 $651
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList+4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $651
+LABELV $648
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $650
+ADDRLP4 0
+INDIRI4
+ADDRGP4 scriptCommandCount
+INDIRI4
+LTI4 $647
+LABELV $649
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $654
+ADDRLP4 8
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $654
+LABELV $641
+ADDRGP4 $640
+JUMPV
+LABELV $638
+LABELV $637
+endproc Item_RunScript 4136 12
+export Item_EnableShowViaCvar
+proc Item_EnableShowViaCvar 2088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1024
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1032
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $657
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $657
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1040
+INDIRI4
+EQI4 $657
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $657
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1040
+INDIRI4
+EQI4 $657
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $660
+JUMPV
+LABELV $659
+ADDRLP4 0
+ARGP4
+ADDRLP4 2072
+ARGP4
+ADDRLP4 2076
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $662
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $665
+ADDRLP4 2080
+CNSTI4 0
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $665
+ADDRLP4 2080
+CNSTI4 1
+ASGNI4
+LABELV $666
+ADDRLP4 2080
+INDIRI4
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $662
+ADDRLP4 2080
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 2080
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $667
+ADDRLP4 2080
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $667
+ADDRGP4 $660
+JUMPV
+LABELV $667
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $669
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $670
+CNSTI4 1
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $669
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $673
+CNSTI4 0
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $673
+LABELV $670
+LABELV $660
+ADDRGP4 $659
+JUMPV
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $676
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 2072
+CNSTI4 1
+ASGNI4
+LABELV $677
+ADDRLP4 2072
+INDIRI4
+RETI4
+ADDRGP4 $656
+JUMPV
+LABELV $657
+CNSTI4 1
+RETI4
+LABELV $656
+endproc Item_EnableShowViaCvar 2088 12
+export Item_SetFocus
+proc Item_SetFocus 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62036
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $684
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $684
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $684
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $684
+ADDRLP4 24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $679
+LABELV $684
+CNSTI4 0
+RETI4
+ADDRGP4 $678
+JUMPV
+LABELV $679
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $685
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $685
+CNSTI4 0
+RETI4
+ADDRGP4 $678
+JUMPV
+LABELV $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $687
+CNSTI4 0
+RETI4
+ADDRGP4 $678
+JUMPV
+LABELV $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Menu_ClearFocus
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $689
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 52+4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 52+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ASGNP4
+LABELV $695
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $690
+JUMPV
+LABELV $693
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $690
+ADDRLP4 72
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $690
+ADDRLP4 76
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $690
+JUMPV
+LABELV $689
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $701
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $701
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ASGNP4
+LABELV $703
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $690
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $705
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $705
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $710
+JUMPV
+LABELV $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $711
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+JUMPV
+LABELV $711
+LABELV $708
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $710
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $707
+LABELV $709
+CNSTI4 1
+RETI4
+LABELV $678
+endproc Item_SetFocus 80 12
+export Item_ListBox_MaxScroll
+proc Item_ListBox_MaxScroll 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $714
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $715
+JUMPV
+LABELV $714
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $715
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $716
+CNSTI4 0
+RETI4
+ADDRGP4 $713
+JUMPV
+LABELV $716
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $713
+endproc Item_ListBox_MaxScroll 16 4
+export Item_ListBox_ThumbPosition
+proc Item_ListBox_ThumbPosition 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $719
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $721
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $722
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+ADDRGP4 $718
+JUMPV
+LABELV $719
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $723
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $724
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+LABELV $718
+endproc Item_ListBox_ThumbPosition 20 4
+export Item_ListBox_ThumbDrawPosition
+proc Item_ListBox_ThumbDrawPosition 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+LTF4 $730
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+GTF4 $730
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $725
+JUMPV
+LABELV $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $725
+JUMPV
+LABELV $728
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+LTF4 $732
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+GTF4 $732
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $725
+JUMPV
+LABELV $732
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $725
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $725
+endproc Item_ListBox_ThumbDrawPosition 32 4
+export Item_Slider_ThumbPosition
+proc Item_Slider_ThumbPosition 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $735
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $736
+JUMPV
+LABELV $735
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $736
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $737
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $737
+ADDRLP4 8
+INDIRF4
+RETF4
+ADDRGP4 $734
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+GEF4 $739
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $741
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $741
+LABELV $740
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1119879168
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $734
+endproc Item_Slider_ThumbPosition 28 4
+export Item_Slider_OverSlider
+proc Item_Slider_OverSlider 24 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $747
+CNSTI4 8192
+RETI4
+ADDRGP4 $743
+JUMPV
+LABELV $747
+CNSTI4 0
+RETI4
+LABELV $743
+endproc Item_Slider_OverSlider 24 12
+export Item_ListBox_OverLB
+proc Item_ListBox_OverLB 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $750
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $755
+CNSTI4 2048
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $755
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $757
+CNSTI4 4096
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $757
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $759
+CNSTI4 8192
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $759
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $762
+CNSTI4 16384
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $762
+ADDRLP4 52
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $751
+CNSTI4 32768
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $750
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $770
+CNSTI4 2048
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $770
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $773
+CNSTI4 4096
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $773
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $776
+CNSTI4 8192
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $776
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $781
+CNSTI4 16384
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $781
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $785
+CNSTI4 32768
+RETI4
+ADDRGP4 $749
+JUMPV
+LABELV $785
+LABELV $751
+CNSTI4 0
+RETI4
+LABELV $749
+endproc Item_ListBox_OverLB 64 12
+export Item_ListBox_MouseEnter
+proc Item_ListBox_MouseEnter 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $788
+ADDRGP4 $787
+JUMPV
+LABELV $788
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -63489
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $791
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $791
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $791
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $791
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $803
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $808
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $811
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $811
+LABELV $808
+LABELV $803
+LABELV $791
+LABELV $787
+endproc Item_ListBox_MouseEnter 60 12
+export Item_MouseEnter
+proc Item_MouseEnter 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $814
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $818
+ADDRGP4 $813
+JUMPV
+LABELV $818
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $820
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $820
+ADDRGP4 $813
+JUMPV
+LABELV $820
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $822
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $822
+ADDRGP4 $813
+JUMPV
+LABELV $822
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $826
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $826
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $825
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $825
+JUMPV
+LABELV $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $830
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $830
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $832
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $834
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_ListBox_MouseEnter
+CALLV
+pop
+LABELV $834
+LABELV $825
+LABELV $814
+LABELV $813
+endproc Item_MouseEnter 44 12
+export Item_MouseLeave
+proc Item_MouseLeave 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $839
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $839
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -6145
+BANDI4
+ASGNI4
+LABELV $837
+LABELV $836
+endproc Item_MouseLeave 8 8
+export Menu_HitTest
+proc Menu_HitTest 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $842
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $846
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $841
+JUMPV
+LABELV $846
+LABELV $843
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $845
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $842
+CNSTP4 0
+RETP4
+LABELV $841
+endproc Menu_HitTest 8 12
+export Item_SetMouseOver
+proc Item_SetMouseOver 4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $849
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $851
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $852
+JUMPV
+LABELV $851
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $852
+LABELV $849
+LABELV $848
+endproc Item_SetMouseOver 4 0
+export Item_OwnerDraw_HandleKey
+proc Item_OwnerDraw_HandleKey 12 16
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $854
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $854
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $853
+JUMPV
+LABELV $854
+CNSTI4 0
+RETI4
+LABELV $853
+endproc Item_OwnerDraw_HandleKey 12 16
+export Item_ListBox_HandleKey
+proc Item_ListBox_HandleKey 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $857
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $857
+LABELV $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $860
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+NEI4 $862
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $864
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $866
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $866
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $868
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $868
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $870
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $870
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $865
+JUMPV
+LABELV $864
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $872
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $872
+LABELV $865
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $862
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+NEI4 $861
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $876
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $878
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $878
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $880
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $880
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $882
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $882
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $877
+JUMPV
+LABELV $876
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $884
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $884
+LABELV $877
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $860
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+NEI4 $886
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $888
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $890
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $890
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $892
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $892
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $894
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $889
+JUMPV
+LABELV $888
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $896
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $896
+LABELV $889
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $886
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+NEI4 $898
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $900
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $902
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $902
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $904
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $904
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $906
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $906
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $908
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $908
+LABELV $901
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $898
+LABELV $861
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $912
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+NEI4 $910
+LABELV $912
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $913
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $915
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $915
+CNSTI4 0
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $913
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $917
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $919
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $919
+CNSTI4 0
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $917
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $921
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $923
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $923
+CNSTI4 0
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $921
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $925
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $927
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $927
+CNSTI4 0
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $925
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $929
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRGP4 lastListBoxClickTime
+INDIRI4
+GEI4 $931
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $931
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+NEI4 $931
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $931
+ADDRGP4 lastListBoxClickTime
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 300
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+EQI4 $933
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $933
+CNSTI4 0
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $930
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $910
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+NEI4 $935
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $935
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+NEI4 $937
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $937
+ADDRFP4 4
+INDIRI4
+CNSTI4 142
+NEI4 $939
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $941
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $943
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $943
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $945
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $945
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $947
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $947
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $949
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $949
+LABELV $942
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $939
+ADDRFP4 4
+INDIRI4
+CNSTI4 141
+NEI4 $951
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $953
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $955
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $955
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $957
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $957
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $959
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $959
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $961
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $961
+LABELV $954
+CNSTI4 1
+RETI4
+ADDRGP4 $856
+JUMPV
+LABELV $951
+LABELV $857
+CNSTI4 0
+RETI4
+LABELV $856
+endproc Item_ListBox_HandleKey 56 12
+export Item_Checkbox_HandleKey
+proc Item_Checkbox_HandleKey 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $964
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $964
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $964
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 178
+EQI4 $970
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $970
+ADDRLP4 16
+INDIRI4
+CNSTI4 179
+EQI4 $970
+ADDRLP4 16
+INDIRI4
+CNSTI4 180
+NEI4 $966
+LABELV $970
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+NEF4 $973
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $974
+JUMPV
+LABELV $973
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $974
+ADDRGP4 $971
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $963
+JUMPV
+LABELV $966
+LABELV $964
+CNSTI4 0
+RETI4
+LABELV $963
+endproc Item_Checkbox_HandleKey 32 12
+export Item_Combo_HandleKey
+proc Item_Combo_HandleKey 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62016
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62020
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $979
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62016
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $979
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $981
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $982
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $982
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $982
+ADDRLP4 40
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 178
+EQI4 $989
+ADDRLP4 40
+INDIRI4
+CNSTI4 13
+EQI4 $989
+ADDRLP4 40
+INDIRI4
+CNSTI4 179
+EQI4 $989
+ADDRLP4 40
+INDIRI4
+CNSTI4 180
+NEI4 $982
+LABELV $989
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $990
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $992
+ADDRGP4 $994
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $993
+LABELV $990
+ADDRLP4 16
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $975
+JUMPV
+LABELV $981
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $995
+ADDRLP4 40
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 178
+EQI4 $1001
+ADDRLP4 40
+INDIRI4
+CNSTI4 13
+EQI4 $1001
+ADDRLP4 40
+INDIRI4
+CNSTI4 179
+EQI4 $1001
+ADDRLP4 40
+INDIRI4
+CNSTI4 180
+NEI4 $997
+LABELV $1001
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1002
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1004
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1006
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LEF4 $1010
+ADDRLP4 60
+ADDRLP4 48
+INDIRF4
+ASGNF4
+LABELV $1010
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LEF4 $1012
+ADDRLP4 56
+ADDRLP4 48
+INDIRF4
+ASGNF4
+LABELV $1012
+LABELV $1007
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1009
+ADDRLP4 52
+INDIRI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1006
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+CVIF4 4
+ADDF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $975
+JUMPV
+LABELV $1004
+LABELV $1002
+LABELV $997
+LABELV $995
+LABELV $982
+ADDRLP4 16
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $975
+endproc Item_Combo_HandleKey 84 12
+export Item_YesNo_HandleKey
+proc Item_YesNo_HandleKey 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1015
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1015
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1015
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 178
+EQI4 $1021
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $1021
+ADDRLP4 16
+INDIRI4
+CNSTI4 179
+EQI4 $1021
+ADDRLP4 16
+INDIRI4
+CNSTI4 180
+NEI4 $1017
+LABELV $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+NEF4 $1023
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $1024
+ADDRGP4 $971
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1014
+JUMPV
+LABELV $1017
+LABELV $1015
+CNSTI4 0
+RETI4
+LABELV $1014
+endproc Item_YesNo_HandleKey 32 12
+export Item_Multi_CountSettings
+proc Item_Multi_CountSettings 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1026
+CNSTI4 0
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1026
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+RETI4
+LABELV $1025
+endproc Item_Multi_CountSettings 4 0
+export Item_Multi_FindCvarByValue
+proc Item_Multi_FindCvarByValue 1040 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1029
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1031
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1032
+JUMPV
+LABELV $1031
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $1032
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1033
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1037
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1038
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1028
+JUMPV
+LABELV $1037
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $1041
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1028
+JUMPV
+LABELV $1041
+LABELV $1038
+LABELV $1034
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1036
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1033
+LABELV $1029
+CNSTI4 0
+RETI4
+LABELV $1028
+endproc Item_Multi_FindCvarByValue 1040 12
+export Item_Multi_Setting
+proc Item_Multi_Setting 1040 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1046
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1047
+JUMPV
+LABELV $1046
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $1047
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1051
+JUMPV
+LABELV $1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1052
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1053
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1043
+JUMPV
+LABELV $1052
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $1056
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1043
+JUMPV
+LABELV $1056
+LABELV $1053
+LABELV $1049
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1051
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1048
+LABELV $1044
+ADDRGP4 $55
+RETP4
+LABELV $1043
+endproc Item_Multi_Setting 1040 12
+export Item_Multi_HandleKey
+proc Item_Multi_HandleKey 56 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1059
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1061
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1061
+ADDRLP4 16
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1061
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 178
+EQI4 $1067
+ADDRLP4 20
+INDIRI4
+CNSTI4 13
+EQI4 $1067
+ADDRLP4 20
+INDIRI4
+CNSTI4 179
+EQI4 $1067
+ADDRLP4 20
+INDIRI4
+CNSTI4 180
+NEI4 $1063
+LABELV $1067
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Item_Multi_FindCvarByValue
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Item_Multi_CountSettings
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $1070
+ADDRLP4 40
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1068
+LABELV $1070
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1068
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1071
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1072
+JUMPV
+LABELV $1071
+ADDRLP4 44
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+NEF4 $1073
+ADDRGP4 $971
+ARGP4
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1074
+JUMPV
+LABELV $1073
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1074
+LABELV $1072
+CNSTI4 1
+RETI4
+ADDRGP4 $1058
+JUMPV
+LABELV $1063
+LABELV $1061
+LABELV $1059
+CNSTI4 0
+RETI4
+LABELV $1058
+endproc Item_Multi_HandleKey 56 12
+export Item_TextField_HandleKey
+proc Item_TextField_HandleKey 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1077
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1024
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1079
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+LEI4 $1079
+ADDRLP4 1032
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1079
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1081
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $1083
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1085
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4-1
+ADDP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1088
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1088
+LABELV $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1083
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $1092
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1090
+LABELV $1092
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1090
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1093
+ADDRFP4 4
+INDIRI4
+CNSTI4 48
+LTI4 $1097
+ADDRFP4 4
+INDIRI4
+CNSTI4 57
+LEI4 $1095
+LABELV $1097
+CNSTI4 0
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1095
+LABELV $1093
+ADDRLP4 1044
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1098
+ADDRLP4 1048
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 255
+EQI4 $1102
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1100
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1100
+LABELV $1102
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1100
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1056
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $1099
+JUMPV
+LABELV $1098
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $1104
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1104
+LABELV $1099
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+GEI4 $1082
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LEI4 $1082
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1082
+JUMPV
+LABELV $1081
+ADDRFP4 4
+INDIRI4
+CNSTI4 140
+NEI4 $1110
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1112
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1112
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1110
+ADDRFP4 4
+INDIRI4
+CNSTI4 135
+NEI4 $1115
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $1117
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+LTI4 $1117
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1117
+ADDRLP4 1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1117
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1119
+ADDRLP4 1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1119
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1115
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+NEI4 $1121
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1123
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1123
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1125
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1125
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1121
+ADDRFP4 4
+INDIRI4
+CNSTI4 143
+NEI4 $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1127
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+NEI4 $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LEI4 $1131
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1131
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1129
+ADDRFP4 4
+INDIRI4
+CNSTI4 139
+NEI4 $1133
+ADDRLP4 1048
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $1136
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1137
+JUMPV
+LABELV $1136
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $1137
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1133
+LABELV $1082
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1140
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+NEI4 $1138
+LABELV $1140
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1141
+ADDRLP4 1056
+ADDRLP4 1028
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 4
+EQI4 $1143
+ADDRLP4 1056
+INDIRI4
+CNSTI4 9
+NEI4 $1141
+LABELV $1143
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1141
+LABELV $1138
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+NEI4 $1144
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1146
+ADDRLP4 1056
+ADDRLP4 1028
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 4
+EQI4 $1148
+ADDRLP4 1056
+INDIRI4
+CNSTI4 9
+NEI4 $1146
+LABELV $1148
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1146
+LABELV $1144
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1152
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $1152
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+NEI4 $1149
+LABELV $1152
+CNSTI4 0
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1149
+CNSTI4 1
+RETI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1077
+CNSTI4 0
+RETI4
+LABELV $1076
+endproc Item_TextField_HandleKey 1060 12
+proc Scroll_ListBox_AutoFunc 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1154
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1154
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1156
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1158
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1158
+LABELV $1156
+LABELV $1153
+endproc Scroll_ListBox_AutoFunc 12 16
+proc Scroll_ListBox_ThumbFunc 64 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1161
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEF4 $1163
+ADDRGP4 $1160
+JUMPV
+LABELV $1163
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1169
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1169
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1171
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1171
+LABELV $1170
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1162
+JUMPV
+LABELV $1161
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+EQF4 $1173
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+ASGNP4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4+12
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1180
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1181
+JUMPV
+LABELV $1180
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1182
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1182
+LABELV $1181
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1173
+LABELV $1162
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1184
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1184
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1186
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1188
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1188
+LABELV $1186
+LABELV $1160
+endproc Scroll_ListBox_ThumbFunc 64 16
+proc Scroll_Slider_ThumbFunc 28 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1191
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1192
+JUMPV
+LABELV $1191
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1192
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $1193
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $1194
+JUMPV
+LABELV $1193
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $1195
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1195
+LABELV $1194
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1190
+endproc Scroll_Slider_ThumbFunc 28 8
+export Item_StartCapture
+proc Item_StartCapture 28 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1198
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GTI4 $1198
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1225-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1225
+address $1201
+address $1198
+address $1201
+address $1198
+address $1198
+address $1201
+address $1218
+code
+LABELV $1201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6144
+BANDI4
+CNSTI4 0
+EQI4 $1202
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+ASGNP4
+ADDRGP4 scrollInfo
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+8
+CNSTI4 500
+ASGNI4
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1209
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1210
+JUMPV
+LABELV $1209
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1210
+ADDRGP4 scrollInfo+28
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_AutoFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1199
+JUMPV
+LABELV $1202
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1199
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1199
+JUMPV
+LABELV $1218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_Slider_OverSlider
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1199
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_Slider_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1198
+LABELV $1199
+LABELV $1197
+endproc Item_StartCapture 28 12
+export Item_StopCapture
+proc Item_StopCapture 0 0
+LABELV $1227
+endproc Item_StopCapture 0 0
+export Item_Slider_HandleKey
+proc Item_Slider_HandleKey 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1229
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1229
+ADDRLP4 28
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 178
+EQI4 $1235
+ADDRLP4 28
+INDIRI4
+CNSTI4 13
+EQI4 $1235
+ADDRLP4 28
+INDIRI4
+CNSTI4 179
+EQI4 $1235
+ADDRLP4 28
+INDIRI4
+CNSTI4 180
+NEI4 $1231
+LABELV $1235
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1236
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1238
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1239
+JUMPV
+LABELV $1238
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1239
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 36
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 52
+INDIRP4
+CNSTI4 272
+ADDP4
+ASGNP4
+ADDRLP4 60
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 52
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $1241
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1241
+LABELV $1236
+LABELV $1231
+LABELV $1229
+ADDRGP4 $1243
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1228
+endproc Item_Slider_HandleKey 80 12
+export Item_HandleKey
+proc Item_HandleKey 40 16
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1245
+ADDRGP4 itemCapture
+INDIRP4
+ARGP4
+ADDRGP4 Item_StopCapture
+CALLV
+pop
+ADDRGP4 itemCapture
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureFunc
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureData
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1246
+JUMPV
+LABELV $1245
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1247
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 178
+EQI4 $1250
+ADDRLP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $1250
+ADDRLP4 0
+INDIRI4
+CNSTI4 180
+NEI4 $1247
+LABELV $1250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Item_StartCapture
+CALLV
+pop
+LABELV $1247
+LABELV $1246
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1251
+CNSTI4 0
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1251
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1253
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1253
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1267-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1267
+address $1256
+address $1257
+address $1258
+address $1259
+address $1260
+address $1261
+address $1253
+address $1264
+address $1259
+address $1266
+address $1262
+address $1263
+address $1265
+code
+LABELV $1256
+CNSTI4 0
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1257
+CNSTI4 0
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Item_Checkbox_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1259
+CNSTI4 0
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Item_Combo_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1262
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_YesNo_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1263
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_Multi_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_OwnerDraw_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1265
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Item_Slider_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+RETI4
+ADDRGP4 $1244
+JUMPV
+LABELV $1253
+CNSTI4 0
+RETI4
+LABELV $1244
+endproc Item_HandleKey 40 16
+export Item_Action
+proc Item_Action 4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1270
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1270
+LABELV $1269
+endproc Item_Action 4 8
+export Item_TransitionEnd
+proc Item_TransitionEnd 4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1273
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1273
+LABELV $1272
+endproc Item_TransitionEnd 4 8
+export Menu_SetPrevCursorItem
+proc Menu_SetPrevCursorItem 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1279
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1278
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $1281
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1281
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1281
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1275
+JUMPV
+LABELV $1283
+LABELV $1279
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -1
+GTI4 $1278
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1275
+endproc Menu_SetPrevCursorItem 44 12
+export Menu_SetNextCursorItem
+proc Menu_SetNextCursorItem 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1289
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1289
+JUMPV
+LABELV $1288
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1291
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1291
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1291
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1285
+JUMPV
+LABELV $1293
+LABELV $1289
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1288
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1285
+endproc Menu_SetNextCursorItem 44 12
+proc Window_CloseCinematic 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1296
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1296
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1296
+LABELV $1295
+endproc Window_CloseCinematic 4 4
+proc Menu_CloseCinematics 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1304
+JUMPV
+LABELV $1301
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1305
+CNSTI4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1305
+LABELV $1302
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1304
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1301
+LABELV $1299
+LABELV $1298
+endproc Menu_CloseCinematics 4 4
+proc Display_CloseCinematics 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1311
+JUMPV
+LABELV $1308
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_CloseCinematics
+CALLV
+pop
+LABELV $1309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1311
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1308
+LABELV $1307
+endproc Display_CloseCinematics 4 4
+export Menus_Activate
+proc Menus_Activate 608 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 6
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1313
+ADDRLP4 4+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+264
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1313
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1317
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1317
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1317
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1312
+endproc Menus_Activate 608 8
+export Display_VisibleMenuCount
+proc Display_VisibleMenuCount 12 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1323
+JUMPV
+LABELV $1320
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $1324
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1324
+LABELV $1321
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1323
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1320
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1319
+endproc Display_VisibleMenuCount 12 0
+export Menus_HandleOOBClick
+proc Menus_HandleOOBClick 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1328
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1330
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $1330
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1335
+JUMPV
+LABELV $1332
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Menu_OverActiveItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1336
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $1336
+LABELV $1333
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1335
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $1332
+ADDRLP4 8
+ADDRGP4 Display_VisibleMenuCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1338
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1340
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1340
+LABELV $1338
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1328
+LABELV $1327
+endproc Menus_HandleOOBClick 24 12
+bss
+align 4
+LABELV $1343
+skip 16
+code
+proc Item_CorrectedTextRect 4 12
+ADDRGP4 $1343
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1344
+ADDRGP4 $1343
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRGP4 $1343+8
+INDIRF4
+CNSTF4 0
+EQF4 $1346
+ADDRLP4 0
+ADDRGP4 $1343+4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 $1343+12
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1346
+LABELV $1344
+ADDRGP4 $1343
+RETP4
+LABELV $1342
+endproc Item_CorrectedTextRect 4 12
+data
+align 4
+LABELV $1379
+byte 4 0
+export Menu_HandleKey
+code
+proc Menu_HandleKey 680 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1354
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+EQF4 $1352
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1358
+JUMPV
+LABELV $1355
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1359
+ADDRGP4 $1351
+JUMPV
+LABELV $1359
+LABELV $1356
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1358
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1355
+LABELV $1352
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1361
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1361
+ADDRGP4 g_bindItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+pop
+ADDRGP4 $1351
+JUMPV
+LABELV $1361
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1363
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1363
+ADDRGP4 g_editItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_TextField_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1365
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1351
+JUMPV
+LABELV $1365
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1370
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1370
+ADDRFP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1367
+LABELV $1370
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1368
+JUMPV
+LABELV $1367
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1374
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1374
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+NEI4 $1371
+LABELV $1374
+ADDRGP4 $1351
+JUMPV
+LABELV $1371
+LABELV $1368
+LABELV $1363
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1375
+ADDRGP4 $1351
+JUMPV
+LABELV $1375
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1377
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ADDRLP4 20
+INDIRI4
+NEI4 $1377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1377
+ADDRGP4 $1379
+INDIRI4
+CNSTI4 0
+NEI4 $1380
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1383
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $1383
+ADDRFP4 4
+INDIRI4
+CNSTI4 180
+NEI4 $1380
+LABELV $1383
+ADDRGP4 $1379
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menus_HandleOOBClick
+CALLV
+pop
+ADDRGP4 $1379
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1351
+JUMPV
+LABELV $1380
+LABELV $1377
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1384
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1388
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1388
+LABELV $1385
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1387
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1384
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1390
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Item_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1392
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1351
+JUMPV
+LABELV $1392
+LABELV $1390
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1394
+ADDRGP4 $1351
+JUMPV
+LABELV $1394
+ADDRLP4 40
+CNSTI4 27
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $1407
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $1441
+LABELV $1440
+ADDRLP4 48
+CNSTI4 9
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $1412
+ADDRFP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $1396
+LABELV $1442
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1434
+ADDRGP4 $1396
+JUMPV
+LABELV $1441
+ADDRFP4 4
+INDIRI4
+CNSTI4 155
+EQI4 $1398
+ADDRLP4 56
+CNSTI4 156
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $1402
+ADDRFP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $1444
+LABELV $1443
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1406
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $1412
+ADDRGP4 $1396
+JUMPV
+LABELV $1444
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+LTI4 $1396
+ADDRFP4 4
+INDIRI4
+CNSTI4 200
+GTI4 $1396
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1445-676
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1445
+address $1434
+address $1396
+address $1396
+address $1396
+address $1396
+address $1396
+address $1396
+address $1396
+address $1396
+address $1413
+address $1413
+address $1396
+address $1396
+address $1396
+address $1396
+address $1396
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+address $1397
+code
+LABELV $1398
+ADDRGP4 $1401
+ARGP4
+ADDRLP4 68
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 0
+EQF4 $1397
+ADDRLP4 72
+ADDRGP4 debugMode
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $1397
+JUMPV
+LABELV $1402
+ADDRGP4 $1401
+ARGP4
+ADDRLP4 72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 0
+EQF4 $1397
+CNSTI4 2
+ARGI4
+ADDRGP4 $1405
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1407
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+NEI4 $1397
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1397
+ADDRLP4 76+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76+264
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1412
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1413
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1397
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1416
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1416
+ADDRLP4 76
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 4
+EQI4 $1422
+ADDRLP4 76
+INDIRI4
+CNSTI4 9
+NEI4 $1420
+LABELV $1422
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1397
+JUMPV
+LABELV $1420
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $1397
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1429
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 67172352
+BANDI4
+CNSTI4 0
+NEI4 $1397
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1429
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1397
+JUMPV
+LABELV $1434
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1397
+ADDRLP4 76
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 4
+EQI4 $1439
+ADDRLP4 76
+INDIRI4
+CNSTI4 9
+NEI4 $1437
+LABELV $1439
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1397
+JUMPV
+LABELV $1437
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+LABELV $1396
+LABELV $1397
+LABELV $1351
+endproc Menu_HandleKey 680 12
+export ToWindowCoords
+proc ToWindowCoords 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1448
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1448
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1447
+endproc ToWindowCoords 8 0
+export Rect_ToWindowCoords
+proc Rect_ToWindowCoords 4 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1450
+endproc Rect_ToWindowCoords 4 12
+export Item_SetTextExtents
+proc Item_SetTextExtents 296 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1453
+ADDRLP4 4
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1454
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1455
+ADDRGP4 $1451
+JUMPV
+LABELV $1455
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1459
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1457
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1457
+LABELV $1459
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1460
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $1462
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+NEI4 $1460
+LABELV $1462
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1461
+JUMPV
+LABELV $1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1463
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1463
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1463
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 292
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1463
+LABELV $1461
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 DC
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1465
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $1466
+JUMPV
+LABELV $1465
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1467
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $1467
+LABELV $1466
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1457
+LABELV $1451
+endproc Item_SetTextExtents 296 12
+export Item_TextColor
+proc Item_TextColor 68 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1470
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $1470
+ADDRLP4 36
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1471
+JUMPV
+LABELV $1470
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1475
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 36
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1475
+ADDRLP4 40
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1476
+JUMPV
+LABELV $1475
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1476
+LABELV $1471
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTU4 0
+ASGNU4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+ADDRLP4 48
+INDIRU4
+EQU4 $1480
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+EQI4 $1480
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+ADDRLP4 48
+INDIRU4
+EQU4 $1480
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+EQI4 $1480
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1482
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1482
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1482
+LABELV $1480
+LABELV $1469
+endproc Item_TextColor 68 28
+export Item_Text_AutoWrapped_Lines
+proc Item_Text_AutoWrapped_Lines 2104 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1485
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1487
+CNSTI4 0
+RETI4
+ADDRGP4 $1484
+JUMPV
+LABELV $1487
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1048
+ADDRLP4 1052
+ASGNP4
+ADDRGP4 $1486
+JUMPV
+LABELV $1485
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1486
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1489
+CNSTI4 0
+RETI4
+ADDRGP4 $1484
+JUMPV
+LABELV $1489
+ADDRLP4 2076
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2076
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 2076
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRGP4 $1492
+JUMPV
+LABELV $1491
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 2080
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 2080
+INDIRI4
+ASGNI4
+ADDRLP4 2084
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 32
+EQI4 $1498
+ADDRLP4 2084
+INDIRI4
+CNSTI4 9
+EQI4 $1498
+ADDRLP4 2084
+INDIRI4
+CNSTI4 10
+EQI4 $1498
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $1494
+LABELV $1498
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1494
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1499
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1499
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+EQI4 $1499
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1499
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1504
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GTF4 $1505
+LABELV $1504
+ADDRLP4 2088
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 10
+EQI4 $1505
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+NEI4 $1501
+LABELV $1505
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1506
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1506
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $1510
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1508
+LABELV $1510
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1508
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1511
+ADDRGP4 $1493
+JUMPV
+LABELV $1511
+ADDRLP4 0
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 2096
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2096
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2096
+INDIRI4
+ASGNI4
+ADDRGP4 $1492
+JUMPV
+LABELV $1501
+ADDRLP4 2092
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 2100
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2092
+INDIRI4
+ADDRLP4 2100
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 2096
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2096
+INDIRP4
+ADDRLP4 2100
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2092
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 2096
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1492
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1491
+LABELV $1493
+ADDRLP4 1044
+INDIRI4
+RETI4
+LABELV $1484
+endproc Item_Text_AutoWrapped_Lines 2104 12
+data
+align 4
+LABELV cacheIndex
+byte 4 0
+code
+proc checkCache 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1515
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 33052
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 awc
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1519
+ADDRGP4 $1516
+JUMPV
+LABELV $1519
+ADDRLP4 12
+CNSTI4 33052
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 awc+16384
+ADDP4
+INDIRF4
+NEF4 $1532
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 awc+16384+4
+ADDP4
+INDIRF4
+NEF4 $1532
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 awc+16384+8
+ADDP4
+INDIRF4
+NEF4 $1532
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 awc+16384+12
+ADDP4
+INDIRF4
+EQF4 $1521
+LABELV $1532
+ADDRGP4 $1516
+JUMPV
+LABELV $1521
+ADDRLP4 16
+CNSTI4 33052
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 awc+16400
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $1537
+ADDRLP4 16
+INDIRI4
+ADDRGP4 awc+16404
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+EQI4 $1533
+LABELV $1537
+ADDRGP4 $1516
+JUMPV
+LABELV $1533
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1514
+JUMPV
+LABELV $1516
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1515
+CNSTI4 -1
+RETI4
+LABELV $1514
+endproc checkCache 20 8
+lit
+align 1
+LABELV $1539
+byte 1 0
+byte 1 0
+export Item_Text_AutoWrapped_Paint
+code
+proc Item_Text_AutoWrapped_Paint 2188 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+ADDRGP4 $1539
+INDIRB
+ASGNB 2
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1540
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1542
+ADDRGP4 $1538
+JUMPV
+LABELV $1542
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1088
+ADDRLP4 1116
+ASGNP4
+ADDRGP4 $1541
+JUMPV
+LABELV $1540
+ADDRLP4 1088
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1541
+ADDRLP4 1088
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1544
+ADDRGP4 $1538
+JUMPV
+LABELV $1544
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 1092
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRLP4 2140
+ADDRGP4 checkCache
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 2140
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+LTI4 $1546
+ADDRLP4 1052
+CNSTI4 33052
+ADDRLP4 1044
+INDIRI4
+MULI4
+ADDRGP4 awc+33048
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1552
+JUMPV
+LABELV $1549
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 33052
+ADDRLP4 1044
+INDIRI4
+MULI4
+ADDRGP4 awc+32792
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 33052
+ADDRLP4 1044
+INDIRI4
+MULI4
+ADDRGP4 awc+32792
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+LSHI4
+CNSTI4 33052
+ADDRLP4 1044
+INDIRI4
+MULI4
+ADDRGP4 awc+16408
+ADDP4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1550
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1552
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1549
+ADDRGP4 $1547
+JUMPV
+LABELV $1546
+ADDRLP4 1096
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2148
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2148
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 1040
+ADDRLP4 2148
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 2148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2152
+ADDRGP4 Item_Text_AutoWrapped_Lines
+CALLI4
+ASGNI4
+ADDRLP4 1108
+ADDRLP4 2152
+INDIRI4
+ASGNI4
+ADDRLP4 1112
+ADDRLP4 1108
+INDIRI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 5
+ADDI4
+MULI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1104
+ADDRLP4 1112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1104
+INDIRF4
+CNSTF4 0
+LEF4 $1556
+ADDRLP4 1068
+ADDRLP4 1104
+INDIRF4
+ADDRLP4 1092
+INDIRI4
+CVIF4 4
+CNSTF4 1084227584
+ADDF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1557
+JUMPV
+LABELV $1556
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $1557
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc
+ADDP4
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16384
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16384+4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16384+8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16384+12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16400
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16404
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $1568
+JUMPV
+LABELV $1567
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 2156
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 2156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1570
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1048+1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1570
+ADDRLP4 2160
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+CNSTI4 32
+EQI4 $1577
+ADDRLP4 2160
+INDIRI4
+CNSTI4 9
+EQI4 $1577
+ADDRLP4 2160
+INDIRI4
+CNSTI4 10
+EQI4 $1577
+ADDRLP4 2160
+INDIRI4
+CNSTI4 0
+NEI4 $1573
+LABELV $1577
+ADDRLP4 1040
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1064
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $1578
+ADDRLP4 2168
+CNSTI1 0
+ASGNI1
+ADDRLP4 1048+1
+ADDRLP4 2168
+INDIRI1
+ASGNI1
+ADDRLP4 1048
+ADDRLP4 2168
+INDIRI1
+ASGNI1
+ADDRGP4 $1579
+JUMPV
+LABELV $1578
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+LABELV $1579
+LABELV $1573
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1581
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1581
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+EQI4 $1581
+ADDRLP4 1040
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1064
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+LABELV $1581
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1586
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GTF4 $1587
+LABELV $1586
+ADDRLP4 2164
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2164
+INDIRI4
+CNSTI4 10
+EQI4 $1587
+ADDRLP4 2164
+INDIRI4
+CNSTI4 0
+NEI4 $1583
+LABELV $1587
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1588
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1590
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1591
+JUMPV
+LABELV $1590
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1592
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $1593
+JUMPV
+LABELV $1592
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1594
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $1594
+LABELV $1593
+LABELV $1591
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1096
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1596
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1052
+INDIRI4
+CNSTI4 9
+LSHI4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+16408
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1052
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+32792
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+32792
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1596
+LABELV $1588
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1601
+ADDRGP4 $1569
+JUMPV
+LABELV $1601
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1603
+ADDRLP4 1096
+ADDRLP4 1096
+INDIRF4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 5
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $1603
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $1605
+ADDRLP4 1068
+ADDRLP4 1068
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1605
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 2168
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 2172
+CNSTI4 0
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 2172
+INDIRI4
+EQI4 $1568
+ADDRLP4 1048
+INDIRI1
+CVII4 1
+ADDRLP4 2172
+INDIRI4
+EQI4 $1568
+ADDRLP4 2176
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2176
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 1048
+INDIRI1
+ASGNI1
+ADDRLP4 2180
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2180
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 1048+1
+INDIRI1
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1568
+JUMPV
+LABELV $1583
+ADDRLP4 2168
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 2176
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2168
+INDIRI4
+ADDRLP4 2176
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 2172
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2172
+INDIRP4
+ADDRLP4 2176
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2168
+INDIRI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 2172
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1568
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1567
+LABELV $1569
+CNSTI4 33052
+ADDRGP4 cacheIndex
+INDIRI4
+MULI4
+ADDRGP4 awc+33048
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 2156
+ADDRGP4 cacheIndex
+ASGNP4
+ADDRLP4 2156
+INDIRP4
+ADDRLP4 2156
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 16
+MODI4
+ASGNI4
+LABELV $1547
+LABELV $1538
+endproc Item_Text_AutoWrapped_Paint 2188 32
+export Item_Text_Wrapped_Paint
+proc Item_Text_Wrapped_Paint 2124 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1612
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1614
+ADDRGP4 $1611
+JUMPV
+LABELV $1614
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1060
+ADDRLP4 1068
+ASGNP4
+ADDRGP4 $1613
+JUMPV
+LABELV $1612
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1613
+ADDRLP4 1060
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1616
+ADDRGP4 $1611
+JUMPV
+LABELV $1616
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2100
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2100
+INDIRP4
+ASGNP4
+ADDRGP4 $1619
+JUMPV
+LABELV $1618
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRF4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 5
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2120
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2120
+INDIRP4
+ASGNP4
+LABELV $1619
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1621
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1618
+LABELV $1621
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1611
+endproc Item_Text_Wrapped_Paint 2124 32
+export Item_Text_Paint
+proc Item_Text_Paint 1056 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $1623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Wrapped_Paint
+CALLV
+pop
+ADDRGP4 $1622
+JUMPV
+LABELV $1623
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $1625
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_AutoWrapped_Paint
+CALLV
+pop
+ADDRGP4 $1622
+JUMPV
+LABELV $1625
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1627
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1629
+ADDRGP4 $1622
+JUMPV
+LABELV $1629
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 28
+ASGNP4
+ADDRGP4 $1628
+JUMPV
+LABELV $1627
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1631
+ADDRGP4 $1622
+JUMPV
+LABELV $1631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1622
+endproc Item_Text_Paint 1056 32
+export Item_TextField_Paint
+proc Item_TextField_Paint 1120 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1634
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1634
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 1080
+INDIRI4
+EQI4 $1636
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 1080
+INDIRI4
+NEI4 $1636
+ADDRLP4 1084
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1084
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+4
+ADDRLP4 1084
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 1092
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 1092
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1637
+JUMPV
+LABELV $1636
+ADDRLP4 1048
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1637
+ADDRLP4 1088
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1642
+ADDRLP4 1088
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1642
+ADDRLP4 1084
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1643
+JUMPV
+LABELV $1642
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+LABELV $1643
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $1644
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 1092
+INDIRI4
+EQI4 $1644
+ADDRLP4 1104
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $1647
+ADDRLP4 1100
+CNSTI4 95
+ASGNI4
+ADDRGP4 $1648
+JUMPV
+LABELV $1647
+ADDRLP4 1100
+CNSTI4 124
+ASGNI4
+LABELV $1648
+ADDRLP4 1096
+ADDRLP4 1100
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1116
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 1116
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 1096
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1645
+JUMPV
+LABELV $1644
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1645
+LABELV $1633
+endproc Item_TextField_Paint 1120 36
+export Item_Checkbox_Paint
+proc Item_Checkbox_Paint 88 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1651
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $1652
+JUMPV
+LABELV $1651
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $1652
+ADDRLP4 24
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1653
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $1653
+ADDRLP4 68
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 76
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1654
+JUMPV
+LABELV $1653
+ADDRLP4 36
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1654
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62004
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1658
+ADDRLP4 72
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+DIVF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62000
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+DIVF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRGP4 $1659
+JUMPV
+LABELV $1658
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1660
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62000
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1660
+LABELV $1659
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 62000
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 62004
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+EQF4 $1663
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1664
+JUMPV
+LABELV $1663
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61992
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1664
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+LABELV $1665
+LABELV $1649
+endproc Item_Checkbox_Paint 88 28
+export Item_Combo_Paint
+proc Item_Combo_Paint 1096 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRGP4 $55
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1056
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62020
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 1056
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 1056
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1668
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62016
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $1668
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 1072
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+CNSTI4 62016
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1072
+INDIRP4
+CNSTI4 62020
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1671
+ADDRLP4 1068
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62012
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1672
+JUMPV
+LABELV $1671
+ADDRLP4 1068
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62008
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1672
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1673
+ADDRLP4 1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1675
+ADDRLP4 1076
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1677
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1678
+JUMPV
+LABELV $1677
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+LABELV $1678
+ADDRLP4 1080
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1682
+JUMPV
+LABELV $1679
+ADDRLP4 1076
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1683
+ADDRLP4 28
+ARGP4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1076
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1684
+ADDRLP4 8
+ADDRLP4 1080
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1076
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1681
+JUMPV
+LABELV $1683
+ADDRLP4 1080
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1076
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEF4 $1687
+ADDRLP4 8
+ADDRLP4 1080
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1076
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1681
+JUMPV
+LABELV $1687
+LABELV $1684
+LABELV $1680
+ADDRLP4 1080
+ADDRLP4 1080
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1682
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 1076
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1679
+LABELV $1681
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1084
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1084
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1689
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1689
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1691
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+LABELV $1691
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1675
+LABELV $1673
+LABELV $1667
+endproc Item_Combo_Paint 1096 32
+export Item_ComboBox_Paint
+proc Item_ComboBox_Paint 92 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 68
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 24
+ADDRLP4 68
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1061997773
+ADDRLP4 20
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1061997773
+ADDRLP4 20
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 76
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1697
+ADDRLP4 80
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1702
+JUMPV
+LABELV $1699
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $1703
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1704
+JUMPV
+LABELV $1703
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1704
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+LABELV $1700
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1702
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1699
+LABELV $1697
+LABELV $1693
+endproc Item_ComboBox_Paint 92 32
+export Item_YesNo_Paint
+proc Item_YesNo_Paint 68 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1707
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $1708
+JUMPV
+LABELV $1707
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+LABELV $1708
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1709
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $1709
+ADDRLP4 56
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 64
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1710
+JUMPV
+LABELV $1709
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1710
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1719
+ADDRLP4 56
+ADDRGP4 $1716
+ASGNP4
+ADDRGP4 $1720
+JUMPV
+LABELV $1719
+ADDRLP4 56
+ADDRGP4 $1717
+ASGNP4
+LABELV $1720
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1715
+JUMPV
+LABELV $1714
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1722
+ADDRLP4 56
+ADDRGP4 $1716
+ASGNP4
+ADDRGP4 $1723
+JUMPV
+LABELV $1722
+ADDRLP4 56
+ADDRGP4 $1717
+ASGNP4
+LABELV $1723
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1715
+LABELV $1705
+endproc Item_YesNo_Paint 68 32
+export Item_Multi_Paint
+proc Item_Multi_Paint 60 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $55
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1725
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $1725
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1726
+JUMPV
+LABELV $1725
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_Multi_Setting
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1731
+JUMPV
+LABELV $1730
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1731
+LABELV $1724
+endproc Item_Multi_Paint 60 32
+data
+align 4
+LABELV g_bindings
+address $1733
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1734
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1735
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1736
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1737
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1738
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1739
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1740
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1741
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1742
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1743
+byte 4 135
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1744
+byte 4 136
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1745
+byte 4 141
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1746
+byte 4 140
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1747
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1748
+byte 4 144
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1749
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1750
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1751
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1752
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1753
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1754
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1755
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1756
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1757
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1758
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1759
+byte 4 48
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1760
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1761
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1762
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1763
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1764
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1765
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1766
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1767
+byte 4 181
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1768
+byte 4 119
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1769
+byte 4 114
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1770
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1771
+byte 4 121
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1772
+byte 4 110
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1773
+byte 4 111
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1774
+byte 4 100
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1775
+byte 4 112
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1776
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1777
+byte 4 102
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1778
+byte 4 118
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1779
+byte 4 101
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1780
+byte 4 105
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1781
+byte 4 107
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1782
+byte 4 145
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1783
+byte 4 146
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1784
+byte 4 147
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1785
+byte 4 148
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1786
+byte 4 149
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1787
+byte 4 162
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1788
+byte 4 168
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1789
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1790
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1791
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+address $1792
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+skip 4
+lit
+align 4
+LABELV g_bindCount
+byte 4 60
+code
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $1794
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1798
+ADDRGP4 $1795
+JUMPV
+LABELV $1798
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $1800
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $1802
+ADDRGP4 $1796
+JUMPV
+LABELV $1802
+LABELV $1800
+LABELV $1795
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1794
+LABELV $1796
+LABELV $1793
+endproc Controls_GetKeyAssignment 280 12
+export Controls_GetConfig
+proc Controls_GetConfig 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1808
+JUMPV
+LABELV $1805
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $1806
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1808
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1805
+LABELV $1804
+endproc Controls_GetConfig 12 8
+export Controls_SetConfig
+proc Controls_SetConfig 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1816
+JUMPV
+LABELV $1813
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1817
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1821
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1821
+LABELV $1817
+LABELV $1814
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1816
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1813
+CNSTI4 2
+ARGI4
+ADDRGP4 $1825
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1812
+endproc Controls_SetConfig 12 8
+export Controls_SetDefaults
+proc Controls_SetDefaults 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1830
+JUMPV
+LABELV $1827
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+20
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1828
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1830
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1827
+LABELV $1826
+endproc Controls_SetDefaults 12 0
+export BindingIDFromName
+proc BindingIDFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1839
+JUMPV
+LABELV $1836
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1840
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1840
+LABELV $1837
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1839
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1836
+CNSTI4 -1
+RETI4
+LABELV $1835
+endproc BindingIDFromName 8 8
+export BindingFromName
+proc BindingFromName 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1846
+JUMPV
+LABELV $1843
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1847
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1850
+ADDRGP4 $1845
+JUMPV
+LABELV $1850
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1852
+ADDRGP4 $1842
+JUMPV
+LABELV $1852
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1855
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1857
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 $1842
+JUMPV
+LABELV $1857
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind2
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1859
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 $1842
+JUMPV
+LABELV $1855
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1842
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1862
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1842
+JUMPV
+LABELV $1847
+LABELV $1844
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1846
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1843
+LABELV $1845
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1862
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1842
+endproc BindingFromName 16 12
+export Item_Slider_Paint
+proc Item_Slider_Paint 64 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1864
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1865
+JUMPV
+LABELV $1864
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1865
+ADDRLP4 12
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 61980
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+DIVF4
+ADDF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1866
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 61988
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1867
+JUMPV
+LABELV $1866
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 61984
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1867
+LABELV $1863
+endproc Item_Slider_Paint 64 28
+export Item_Bind_Paint
+proc Item_Bind_Paint 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1869
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1869
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1871
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1871
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $1873
+ADDRLP4 4
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ASGNF4
+ADDRGP4 $1874
+JUMPV
+LABELV $1873
+ADDRLP4 64
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1874
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 64
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 64
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1872
+JUMPV
+LABELV $1871
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1872
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1881
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BindingFromName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1882
+JUMPV
+LABELV $1881
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BindingFromName
+CALLV
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1883
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1883
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1885
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+LABELV $1885
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1882
+LABELV $1868
+endproc Item_Bind_Paint 80 32
+export Display_KeyBindPending
+proc Display_KeyBindPending 0 0
+ADDRGP4 g_waitingForKey
+INDIRI4
+RETI4
+LABELV $1887
+endproc Display_KeyBindPending 0 0
+export Item_Bind_HandleKey
+proc Item_Bind_HandleKey 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1889
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1889
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1891
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $1893
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $1891
+LABELV $1893
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1894
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1896
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1896
+ADDRGP4 g_waitingForKey
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_bindItem
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1894
+ADDRGP4 g_waitingForKey
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_bindItem
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1895
+LABELV $1891
+CNSTI4 1
+RETI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1889
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+EQI4 $1900
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1898
+LABELV $1900
+CNSTI4 1
+RETI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1898
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1901
+CNSTI4 1
+RETI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1901
+ADDRLP4 24
+CNSTI4 96
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1917
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $1919
+LABELV $1918
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+EQI4 $1905
+ADDRGP4 $1903
+JUMPV
+LABELV $1919
+ADDRFP4 4
+INDIRI4
+CNSTI4 127
+EQI4 $1906
+ADDRGP4 $1903
+JUMPV
+LABELV $1905
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1906
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1907
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1909
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1910
+JUMPV
+LABELV $1909
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1913
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1914
+JUMPV
+LABELV $1913
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1914
+LABELV $1910
+LABELV $1907
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_bindItem
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1917
+CNSTI4 1
+RETI4
+ADDRGP4 $1888
+JUMPV
+LABELV $1903
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1920
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1925
+JUMPV
+LABELV $1922
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1926
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1926
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1930
+ADDRLP4 20
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1930
+LABELV $1923
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1925
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1922
+LABELV $1920
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1936
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1938
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1940
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1943
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+NEI4 $1940
+LABELV $1943
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1940
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1939
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1949
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+NEI4 $1939
+LABELV $1949
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1939
+JUMPV
+LABELV $1938
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1952
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1955
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+NEI4 $1952
+LABELV $1955
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1952
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1957
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1957
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1958
+JUMPV
+LABELV $1957
+ADDRLP4 28
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1961
+ADDRLP4 28
+INDIRI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1961
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1961
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1962
+JUMPV
+LABELV $1961
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1966
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1967
+JUMPV
+LABELV $1966
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1972
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1973
+JUMPV
+LABELV $1972
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings+20
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $1973
+LABELV $1967
+LABELV $1962
+LABELV $1958
+LABELV $1953
+LABELV $1939
+LABELV $1936
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1888
+endproc Item_Bind_HandleKey 32 12
+export AdjustFrom640
+proc AdjustFrom640 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1978
+endproc AdjustFrom640 20 0
+export Item_Model_Paint
+proc Item_Model_Paint 652 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1980
+ADDRGP4 $1979
+JUMPV
+LABELV $1980
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1982
+ADDRGP4 $1979
+JUMPV
+LABELV $1982
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 156+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 156+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 588
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 568
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 572
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 524
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 592
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 528
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 592
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 568
+ARGP4
+ADDRLP4 572
+ARGP4
+ADDRLP4 524
+ARGP4
+ADDRLP4 528
+ARGP4
+ADDRGP4 AdjustFrom640
+CALLV
+pop
+ADDRLP4 156
+ADDRLP4 568
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 156+4
+ADDRLP4 572
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 156+8
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 156+12
+ADDRLP4 528
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 544
+ARGP4
+ADDRLP4 556
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 144+8
+CNSTF4 3204448256
+ADDRLP4 544+8
+INDIRF4
+ADDRLP4 556+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 144+4
+CNSTF4 1056964608
+ADDRLP4 544+4
+INDIRF4
+ADDRLP4 556+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 596
+CNSTF4 1056964608
+ADDRLP4 556+8
+INDIRF4
+ADDRLP4 544+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 596
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 $1996
+JUMPV
+LABELV $1995
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1996
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2001
+ADDRLP4 596
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $2002
+JUMPV
+LABELV $2001
+ADDRLP4 596
+ADDRLP4 524
+INDIRF4
+ASGNF4
+LABELV $2002
+ADDRLP4 156+16
+ADDRLP4 596
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2005
+ADDRLP4 600
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $2006
+JUMPV
+LABELV $2005
+ADDRLP4 600
+ADDRLP4 528
+INDIRF4
+ASGNF4
+LABELV $2006
+ADDRLP4 156+20
+ADDRLP4 600
+INDIRF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 156+72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2008
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $2010
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 360
+MODI4
+ASGNI4
+LABELV $2010
+LABELV $2008
+ADDRLP4 532
+CNSTF4 0
+ASGNF4
+ADDRLP4 532+4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 532+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 532
+ARGP4
+ADDRLP4 4+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4+8
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2016
+ADDRLP4 608
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+ADDRLP4 608
+INDIRP4
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2016
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $2018
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 580
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 616
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRI4
+ADDRLP4 580
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+LEI4 $2020
+ADDRLP4 628
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 628
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+MODI4
+ADDI4
+ASGNI4
+LABELV $2020
+ADDRLP4 632
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 632
+INDIRP4
+ADDRLP4 632
+INDIRP4
+INDIRI4
+ADDRLP4 580
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+LEI4 $2022
+ADDRLP4 644
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 644
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+MODI4
+ADDI4
+ASGNI4
+LABELV $2022
+ADDRLP4 648
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+ADDRLP4 648
+INDIRP4
+INDIRF4
+ADDRLP4 580
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $2018
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+80
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+96
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+100
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+68
+ADDRLP4 144
+INDIRB
+ASGNB 12
+ADDRLP4 4+12
+ADDRLP4 144
+INDIRB
+ASGNB 12
+ADDRLP4 4+4
+CNSTI4 192
+ASGNI4
+ADDRLP4 4+84
+ADDRLP4 4+68
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 612
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 144+4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+CNSTF4 1140457472
+ARGF4
+ADDRLP4 616
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 616
+INDIRF4
+ARGF4
+ADDRLP4 616
+INDIRF4
+ARGF4
+ADDRLP4 616
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 620
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+ADDRLP4 620
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 144+4
+INDIRF4
+ADDRLP4 620
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+CNSTF4 1140457472
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 624
+CNSTF4 0
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ARGF4
+ADDRLP4 624
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1979
+endproc Item_Model_Paint 652 20
+export Item_Image_Paint
+proc Item_Image_Paint 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2037
+ADDRGP4 $2036
+JUMPV
+LABELV $2037
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+CNSTF4 1073741824
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2036
+endproc Item_Image_Paint 16 20
+export Item_ListBox_Paint
+proc Item_ListBox_Paint 156 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2040
+ADDRLP4 72
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 76
+INDIRP4
+CNSTI4 260
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 61944
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 88
+INDIRP4
+CNSTI4 260
+ADDP4
+ASGNP4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRP4
+CNSTI4 61952
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 61948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $2042
+ADDRLP4 36
+ADDRLP4 16
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $2042
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 116
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 61964
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2041
+ADDRLP4 132
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2049
+JUMPV
+LABELV $2046
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2050
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 148
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2050
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+NEI4 $2052
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2052
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+GEF4 $2054
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2041
+JUMPV
+LABELV $2054
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2047
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2049
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $2046
+ADDRGP4 $2041
+JUMPV
+LABELV $2040
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRLP4 76
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 76
+INDIRP4
+CNSTI4 260
+ADDP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 61936
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 96
+INDIRP4
+CNSTI4 260
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 61956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 61940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $2056
+ADDRLP4 36
+ADDRLP4 12
+INDIRF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $2056
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 116
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 116
+INDIRP4
+CNSTI4 61964
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2058
+ADDRLP4 128
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2063
+JUMPV
+LABELV $2060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2064
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 144
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2064
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+NEI4 $2066
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2066
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GEF4 $2068
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2059
+JUMPV
+LABELV $2068
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2061
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2063
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $2060
+ADDRGP4 $2059
+JUMPV
+LABELV $2058
+ADDRLP4 128
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2073
+JUMPV
+LABELV $2070
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2074
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2079
+JUMPV
+LABELV $2076
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 140
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $2080
+ADDRLP4 148
+CNSTI4 12
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 152
+ADDRLP4 148
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2081
+JUMPV
+LABELV $2080
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2082
+CNSTI4 12
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2082
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 148
+CNSTI4 12
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2082
+LABELV $2081
+LABELV $2077
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2079
+ADDRLP4 136
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+LTI4 $2076
+ADDRGP4 $2075
+JUMPV
+LABELV $2074
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 136
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $2084
+ADDRGP4 $2085
+JUMPV
+LABELV $2084
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2086
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2086
+LABELV $2085
+LABELV $2075
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+NEI4 $2088
+ADDRLP4 136
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2088
+ADDRLP4 136
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+GEF4 $2090
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2072
+JUMPV
+LABELV $2090
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2071
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2073
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $2070
+LABELV $2072
+LABELV $2059
+LABELV $2041
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2039
+endproc Item_ListBox_Paint 156 32
+export Item_OwnerDraw_Paint
+proc Item_OwnerDraw_Paint 64 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2093
+ADDRGP4 $2092
+JUMPV
+LABELV $2093
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2095
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2097
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2097
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2102
+JUMPV
+LABELV $2099
+ADDRLP4 60
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+LTF4 $2103
+ADDRLP4 48
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GTF4 $2103
+ADDRLP4 0
+ARGP4
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2101
+JUMPV
+LABELV $2103
+LABELV $2100
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2102
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+LTI4 $2099
+LABELV $2101
+LABELV $2097
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2105
+ADDRLP4 44
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1061997773
+ADDRLP4 16
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1061997773
+ADDRLP4 16
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $2106
+JUMPV
+LABELV $2105
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $2110
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 44
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $2110
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+LABELV $2110
+LABELV $2106
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2115
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $2115
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2115
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2119
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2118
+JUMPV
+LABELV $2119
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2118
+JUMPV
+LABELV $2117
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2118
+LABELV $2095
+LABELV $2092
+endproc Item_OwnerDraw_Paint 64 56
+export Item_Paint
+proc Item_Paint 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2125
+ADDRGP4 $2121
+JUMPV
+LABELV $2125
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $2127
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $2129
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1029076816
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $2129
+LABELV $2127
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2131
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $2133
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEF4 $2135
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2136
+JUMPV
+LABELV $2135
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+GEF4 $2137
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+LEF4 $2138
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2138
+JUMPV
+LABELV $2137
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+GEF4 $2141
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2141
+LABELV $2138
+LABELV $2136
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEF4 $2143
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2144
+JUMPV
+LABELV $2143
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $2145
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+LEF4 $2146
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2146
+JUMPV
+LABELV $2145
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $2149
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2149
+LABELV $2146
+LABELV $2144
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+NEF4 $2151
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2152
+JUMPV
+LABELV $2151
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $2153
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $2154
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2154
+JUMPV
+LABELV $2153
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $2157
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2157
+LABELV $2154
+LABELV $2152
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+NEF4 $2159
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2160
+JUMPV
+LABELV $2159
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $2161
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+LEF4 $2162
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2162
+JUMPV
+LABELV $2161
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $2165
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2165
+LABELV $2162
+LABELV $2160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+NEI4 $2167
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+NEI4 $2169
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 16777216
+BORI4
+ASGNI4
+LABELV $2169
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $2167
+LABELV $2133
+LABELV $2131
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2171
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2171
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2173
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $2174
+JUMPV
+LABELV $2173
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2174
+LABELV $2171
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2175
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2177
+ADDRGP4 $2121
+JUMPV
+LABELV $2177
+LABELV $2175
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $2179
+LABELV $2179
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2181
+ADDRGP4 $2121
+JUMPV
+LABELV $2181
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2183
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 56
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36+12
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2183
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $2189
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $2189
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2203
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2203
+address $2192
+address $2192
+address $2189
+address $2194
+address $2195
+address $2196
+address $2197
+address $2198
+address $2191
+address $2195
+address $2202
+address $2199
+address $2200
+address $2201
+code
+LABELV $2191
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_OwnerDraw_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Checkbox_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2195
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_TextField_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2196
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Combo_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ListBox_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Model_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_YesNo_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Multi_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Bind_Paint
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Slider_Paint
+CALLV
+pop
+LABELV $2189
+LABELV $2121
+endproc Item_Paint 84 24
+export Menu_Init
+proc Menu_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 780
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62048
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62040
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62044
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2204
+endproc Menu_Init 0 12
+export Menu_GetFocusedItem
+proc Menu_GetFocusedItem 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2206
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2211
+JUMPV
+LABELV $2208
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $2205
+JUMPV
+LABELV $2212
+LABELV $2209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2211
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2208
+LABELV $2206
+CNSTP4 0
+RETP4
+LABELV $2205
+endproc Menu_GetFocusedItem 8 0
+export Menu_GetFocused
+proc Menu_GetFocused 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2218
+JUMPV
+LABELV $2215
+ADDRLP4 4
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2219
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2219
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $2214
+JUMPV
+LABELV $2219
+LABELV $2216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2218
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2215
+CNSTP4 0
+RETP4
+LABELV $2214
+endproc Menu_GetFocused 12 0
+export Menu_ScrollFeeder
+proc Menu_ScrollFeeder 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2224
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2229
+JUMPV
+LABELV $2226
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $2230
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2233
+ADDRLP4 4
+CNSTI4 133
+ASGNI4
+ADDRGP4 $2234
+JUMPV
+LABELV $2233
+ADDRLP4 4
+CNSTI4 132
+ASGNI4
+LABELV $2234
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRGP4 $2223
+JUMPV
+LABELV $2230
+LABELV $2227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2229
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2226
+LABELV $2224
+LABELV $2223
+endproc Menu_ScrollFeeder 12 16
+export Menu_SetFeederSelection
+proc Menu_SetFeederSelection 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2236
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2238
+ADDRLP4 0
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2239
+JUMPV
+LABELV $2238
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2239
+LABELV $2236
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2240
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2245
+JUMPV
+LABELV $2242
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $2246
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2248
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $2248
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2235
+JUMPV
+LABELV $2246
+LABELV $2243
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2245
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2242
+LABELV $2240
+LABELV $2235
+endproc Menu_SetFeederSelection 8 8
+export Menus_AnyFullScreenVisible
+proc Menus_AnyFullScreenVisible 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2254
+JUMPV
+LABELV $2251
+ADDRLP4 4
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2255
+ADDRLP4 4
+INDIRI4
+ADDRGP4 Menus+184
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2255
+CNSTI4 1
+RETI4
+ADDRGP4 $2250
+JUMPV
+LABELV $2255
+LABELV $2252
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2254
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2251
+CNSTI4 0
+RETI4
+LABELV $2250
+endproc Menus_AnyFullScreenVisible 12 0
+export Menus_ActivateByName
+proc Menus_ActivateByName 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2263
+JUMPV
+LABELV $2260
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2264
+ADDRLP4 4
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+ADDRGP4 openMenuCount
+INDIRI4
+CNSTI4 16
+GEI4 $2265
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2265
+ADDRLP4 24
+ADDRGP4 openMenuCount
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 menuStack
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $2265
+JUMPV
+LABELV $2264
+ADDRLP4 20
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $2265
+LABELV $2261
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2263
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $2260
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $2259
+endproc Menus_ActivateByName 28 8
+export Item_Init
+proc Item_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 604
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+CNSTF4 1057803469
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2270
+endproc Item_Init 0 12
+export Menu_HandleMouseMove
+proc Menu_HandleMouseMove 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2272
+ADDRGP4 $2271
+JUMPV
+LABELV $2272
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2274
+ADDRGP4 $2271
+JUMPV
+LABELV $2274
+ADDRGP4 $1354
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+EQF4 $2276
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2281
+JUMPV
+LABELV $2278
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2282
+ADDRGP4 $2271
+JUMPV
+LABELV $2282
+LABELV $2279
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2281
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2278
+LABELV $2276
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2284
+ADDRGP4 $2271
+JUMPV
+LABELV $2284
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2288
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2286
+LABELV $2288
+ADDRGP4 $2271
+JUMPV
+LABELV $2286
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2289
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2296
+JUMPV
+LABELV $2293
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2297
+ADDRGP4 $2294
+JUMPV
+LABELV $2297
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2299
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2299
+ADDRGP4 $2294
+JUMPV
+LABELV $2299
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2301
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $2301
+ADDRGP4 $2294
+JUMPV
+LABELV $2301
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2303
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2305
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2307
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 40
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48+4
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2314
+JUMPV
+LABELV $2311
+ADDRLP4 48+12
+ADDRLP4 40
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $2316
+ADDRLP4 40
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $2271
+JUMPV
+LABELV $2316
+ADDRLP4 48+4
+ADDRLP4 48+4
+INDIRF4
+ADDRLP4 48+12
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+LABELV $2312
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2314
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $2311
+LABELV $2307
+ADDRLP4 40
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $2271
+JUMPV
+LABELV $2305
+LABELV $2303
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2320
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $2321
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2324
+ADDRLP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2324
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $2326
+ADDRGP4 $2294
+JUMPV
+LABELV $2326
+LABELV $2324
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 IsVisible
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $2321
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_MouseEnter
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2321
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $2321
+JUMPV
+LABELV $2320
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2332
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_MouseLeave
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_SetMouseOver
+CALLV
+pop
+LABELV $2332
+LABELV $2321
+LABELV $2294
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2296
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2293
+LABELV $2290
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LTI4 $2289
+LABELV $2271
+endproc Menu_HandleMouseMove 80 12
+export Menu_Paint
+proc Menu_Paint 48 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2335
+ADDRGP4 $2334
+JUMPV
+LABELV $2335
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2337
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2337
+ADDRGP4 $2334
+JUMPV
+LABELV $2337
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2339
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2339
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2339
+ADDRGP4 $2334
+JUMPV
+LABELV $2339
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2341
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1048576
+BORI4
+ASGNI4
+LABELV $2341
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2343
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2344
+JUMPV
+LABELV $2343
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2345
+LABELV $2345
+LABELV $2344
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2350
+JUMPV
+LABELV $2347
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Paint
+CALLV
+pop
+LABELV $2348
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2350
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2347
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2354
+JUMPV
+LABELV $2351
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2355
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2357
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_ComboBox_Paint
+CALLV
+pop
+LABELV $2357
+LABELV $2355
+LABELV $2352
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2354
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2351
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2359
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2359
+LABELV $2334
+endproc Menu_Paint 48 24
+export Item_ValidateTypeData
+proc Item_ValidateTypeData 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2365
+ADDRGP4 $2364
+JUMPV
+LABELV $2365
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2367
+CNSTI4 232
+ARGI4
+ADDRLP4 0
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 232
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $2368
+JUMPV
+LABELV $2367
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $2375
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $2375
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $2375
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $2375
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2375
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2369
+LABELV $2375
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 28
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2370
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2370
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRGP4 $2370
+JUMPV
+LABELV $2369
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $2380
+CNSTI4 392
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2381
+JUMPV
+LABELV $2380
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2382
+CNSTI4 60
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 60
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $2383
+JUMPV
+LABELV $2382
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $2384
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2384
+CNSTI4 72
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 72
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1049582633
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $2384
+LABELV $2383
+LABELV $2381
+LABELV $2370
+LABELV $2368
+LABELV $2364
+endproc Item_ValidateTypeData 12 12
+export KeywordHash_Key
+proc KeywordHash_Key 24 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2390
+JUMPV
+LABELV $2387
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $2391
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+GTI4 $2391
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $2392
+JUMPV
+LABELV $2391
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $2392
+LABELV $2388
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2390
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2387
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+RSHI4
+BXORI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+RSHI4
+BXORI4
+CNSTI4 511
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $2386
+endproc KeywordHash_Key 24 0
+export KeywordHash_Add
+proc KeywordHash_Add 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $2393
+endproc KeywordHash_Add 8 4
+export KeywordHash_Find
+proc KeywordHash_Find 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2398
+JUMPV
+LABELV $2395
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2399
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2394
+JUMPV
+LABELV $2399
+LABELV $2396
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2398
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2395
+CNSTP4 0
+RETP4
+LABELV $2394
+endproc KeywordHash_Find 16 8
+export ItemParse_name
+proc ItemParse_name 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2402
+CNSTI4 0
+RETI4
+ADDRGP4 $2401
+JUMPV
+LABELV $2402
+CNSTI4 1
+RETI4
+LABELV $2401
+endproc ItemParse_name 4 8
+export ItemParse_focusSound
+proc ItemParse_focusSound 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2405
+CNSTI4 0
+RETI4
+ADDRGP4 $2404
+JUMPV
+LABELV $2405
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2404
+endproc ItemParse_focusSound 12 8
+export ItemParse_text
+proc ItemParse_text 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2408
+CNSTI4 0
+RETI4
+ADDRGP4 $2407
+JUMPV
+LABELV $2408
+CNSTI4 1
+RETI4
+LABELV $2407
+endproc ItemParse_text 4 8
+export ItemParse_group
+proc ItemParse_group 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2411
+CNSTI4 0
+RETI4
+ADDRGP4 $2410
+JUMPV
+LABELV $2411
+CNSTI4 1
+RETI4
+LABELV $2410
+endproc ItemParse_group 4 8
+export ItemParse_asset_model
+proc ItemParse_asset_model 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2414
+CNSTI4 0
+RETI4
+ADDRGP4 $2413
+JUMPV
+LABELV $2414
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2413
+endproc ItemParse_asset_model 16 8
+export ItemParse_asset_shader
+proc ItemParse_asset_shader 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2417
+CNSTI4 0
+RETI4
+ADDRGP4 $2416
+JUMPV
+LABELV $2417
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2416
+endproc ItemParse_asset_shader 12 8
+export ItemParse_model_origin
+proc ItemParse_model_origin 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2420
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2422
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2424
+CNSTI4 1
+RETI4
+ADDRGP4 $2419
+JUMPV
+LABELV $2424
+LABELV $2422
+LABELV $2420
+CNSTI4 0
+RETI4
+LABELV $2419
+endproc ItemParse_model_origin 16 8
+export ItemParse_model_fovx
+proc ItemParse_model_fovx 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2427
+CNSTI4 0
+RETI4
+ADDRGP4 $2426
+JUMPV
+LABELV $2427
+CNSTI4 1
+RETI4
+LABELV $2426
+endproc ItemParse_model_fovx 8 8
+export ItemParse_model_fovy
+proc ItemParse_model_fovy 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2430
+CNSTI4 0
+RETI4
+ADDRGP4 $2429
+JUMPV
+LABELV $2430
+CNSTI4 1
+RETI4
+LABELV $2429
+endproc ItemParse_model_fovy 8 8
+export ItemParse_model_rotation
+proc ItemParse_model_rotation 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2433
+CNSTI4 0
+RETI4
+ADDRGP4 $2432
+JUMPV
+LABELV $2433
+CNSTI4 1
+RETI4
+LABELV $2432
+endproc ItemParse_model_rotation 8 8
+export ItemParse_model_angle
+proc ItemParse_model_angle 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2436
+CNSTI4 0
+RETI4
+ADDRGP4 $2435
+JUMPV
+LABELV $2436
+CNSTI4 1
+RETI4
+LABELV $2435
+endproc ItemParse_model_angle 8 8
+export ItemParse_model_animplay
+proc ItemParse_model_animplay 24 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2439
+CNSTI4 0
+RETI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2439
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2441
+CNSTI4 0
+RETI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2441
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2443
+CNSTI4 0
+RETI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2443
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2438
+endproc ItemParse_model_animplay 24 8
+export ItemParse_rect
+proc ItemParse_rect 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2446
+CNSTI4 0
+RETI4
+ADDRGP4 $2445
+JUMPV
+LABELV $2446
+CNSTI4 1
+RETI4
+LABELV $2445
+endproc ItemParse_rect 4 8
+export ItemParse_style
+proc ItemParse_style 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2449
+CNSTI4 0
+RETI4
+ADDRGP4 $2448
+JUMPV
+LABELV $2449
+CNSTI4 1
+RETI4
+LABELV $2448
+endproc ItemParse_style 4 8
+export ItemParse_decoration
+proc ItemParse_decoration 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2451
+endproc ItemParse_decoration 4 0
+export ItemParse_notselectable
+proc ItemParse_notselectable 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2453
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2453
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2453
+CNSTI4 1
+RETI4
+LABELV $2452
+endproc ItemParse_notselectable 4 4
+export ItemParse_wrapped
+proc ItemParse_wrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 262144
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2455
+endproc ItemParse_wrapped 4 0
+export ItemParse_autowrapped
+proc ItemParse_autowrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2456
+endproc ItemParse_autowrapped 4 0
+export ItemParse_horizontalscroll
+proc ItemParse_horizontalscroll 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2457
+endproc ItemParse_horizontalscroll 4 0
+export ItemParse_type
+proc ItemParse_type 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2459
+CNSTI4 0
+RETI4
+ADDRGP4 $2458
+JUMPV
+LABELV $2459
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2458
+endproc ItemParse_type 4 8
+export ItemParse_elementwidth
+proc ItemParse_elementwidth 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2462
+CNSTI4 0
+RETI4
+ADDRGP4 $2461
+JUMPV
+LABELV $2462
+CNSTI4 1
+RETI4
+LABELV $2461
+endproc ItemParse_elementwidth 8 8
+export ItemParse_elementheight
+proc ItemParse_elementheight 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2465
+CNSTI4 0
+RETI4
+ADDRGP4 $2464
+JUMPV
+LABELV $2465
+CNSTI4 1
+RETI4
+LABELV $2464
+endproc ItemParse_elementheight 8 8
+export ItemParse_feeder
+proc ItemParse_feeder 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2468
+CNSTI4 0
+RETI4
+ADDRGP4 $2467
+JUMPV
+LABELV $2468
+CNSTI4 1
+RETI4
+LABELV $2467
+endproc ItemParse_feeder 4 8
+export ItemParse_elementtype
+proc ItemParse_elementtype 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2471
+CNSTI4 0
+RETI4
+ADDRGP4 $2470
+JUMPV
+LABELV $2471
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2473
+CNSTI4 0
+RETI4
+ADDRGP4 $2470
+JUMPV
+LABELV $2473
+CNSTI4 1
+RETI4
+LABELV $2470
+endproc ItemParse_elementtype 8 8
+export ItemParse_columns
+proc ItemParse_columns 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2476
+CNSTI4 0
+RETI4
+ADDRGP4 $2475
+JUMPV
+LABELV $2476
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2478
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+LEI4 $2480
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+LABELV $2480
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2485
+JUMPV
+LABELV $2482
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2486
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2486
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2486
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $2487
+JUMPV
+LABELV $2486
+CNSTI4 0
+RETI4
+ADDRGP4 $2475
+JUMPV
+LABELV $2487
+LABELV $2483
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2485
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $2482
+ADDRGP4 $2479
+JUMPV
+LABELV $2478
+CNSTI4 0
+RETI4
+ADDRGP4 $2475
+JUMPV
+LABELV $2479
+CNSTI4 1
+RETI4
+LABELV $2475
+endproc ItemParse_columns 40 8
+export ItemParse_border
+proc ItemParse_border 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2489
+CNSTI4 0
+RETI4
+ADDRGP4 $2488
+JUMPV
+LABELV $2489
+CNSTI4 1
+RETI4
+LABELV $2488
+endproc ItemParse_border 4 8
+export ItemParse_bordersize
+proc ItemParse_bordersize 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2492
+CNSTI4 0
+RETI4
+ADDRGP4 $2491
+JUMPV
+LABELV $2492
+CNSTI4 1
+RETI4
+LABELV $2491
+endproc ItemParse_bordersize 4 8
+export ItemParse_visible
+proc ItemParse_visible 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2495
+CNSTI4 0
+RETI4
+ADDRGP4 $2494
+JUMPV
+LABELV $2495
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2497
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2497
+CNSTI4 1
+RETI4
+LABELV $2494
+endproc ItemParse_visible 12 8
+export ItemParse_ownerdraw
+proc ItemParse_ownerdraw 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2500
+CNSTI4 0
+RETI4
+ADDRGP4 $2499
+JUMPV
+LABELV $2500
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2499
+endproc ItemParse_ownerdraw 4 8
+export ItemParse_align
+proc ItemParse_align 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2503
+CNSTI4 0
+RETI4
+ADDRGP4 $2502
+JUMPV
+LABELV $2503
+CNSTI4 1
+RETI4
+LABELV $2502
+endproc ItemParse_align 4 8
+export ItemParse_textalign
+proc ItemParse_textalign 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2506
+CNSTI4 0
+RETI4
+ADDRGP4 $2505
+JUMPV
+LABELV $2506
+CNSTI4 1
+RETI4
+LABELV $2505
+endproc ItemParse_textalign 4 8
+export ItemParse_textalignx
+proc ItemParse_textalignx 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2509
+CNSTI4 0
+RETI4
+ADDRGP4 $2508
+JUMPV
+LABELV $2509
+CNSTI4 1
+RETI4
+LABELV $2508
+endproc ItemParse_textalignx 4 8
+export ItemParse_textaligny
+proc ItemParse_textaligny 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2512
+CNSTI4 0
+RETI4
+ADDRGP4 $2511
+JUMPV
+LABELV $2512
+CNSTI4 1
+RETI4
+LABELV $2511
+endproc ItemParse_textaligny 4 8
+export ItemParse_scralign
+proc ItemParse_scralign 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2515
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $2514
+JUMPV
+LABELV $2515
+CNSTI4 1
+RETI4
+LABELV $2514
+endproc ItemParse_scralign 4 8
+export ItemParse_scralignfactor
+proc ItemParse_scralignfactor 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2518
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $2517
+JUMPV
+LABELV $2518
+CNSTI4 1
+RETI4
+LABELV $2517
+endproc ItemParse_scralignfactor 4 8
+export ItemParse_boxtextscale
+proc ItemParse_boxtextscale 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2521
+CNSTI4 0
+RETI4
+ADDRGP4 $2520
+JUMPV
+LABELV $2521
+CNSTI4 1
+RETI4
+LABELV $2520
+endproc ItemParse_boxtextscale 8 8
+export ItemParse_comboalignx
+proc ItemParse_comboalignx 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2524
+CNSTI4 0
+RETI4
+ADDRGP4 $2523
+JUMPV
+LABELV $2524
+CNSTI4 1
+RETI4
+LABELV $2523
+endproc ItemParse_comboalignx 8 8
+export ItemParse_comboaligny
+proc ItemParse_comboaligny 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2527
+CNSTI4 0
+RETI4
+ADDRGP4 $2526
+JUMPV
+LABELV $2527
+CNSTI4 1
+RETI4
+LABELV $2526
+endproc ItemParse_comboaligny 8 8
+export ItemParse_bindtype
+proc ItemParse_bindtype 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2530
+CNSTI4 0
+RETI4
+ADDRGP4 $2529
+JUMPV
+LABELV $2530
+CNSTI4 1
+RETI4
+LABELV $2529
+endproc ItemParse_bindtype 4 8
+export ItemParse_bind2click
+proc ItemParse_bind2click 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2533
+CNSTI4 0
+RETI4
+ADDRGP4 $2532
+JUMPV
+LABELV $2533
+CNSTI4 1
+RETI4
+LABELV $2532
+endproc ItemParse_bind2click 4 8
+export ItemParse_nofocuscolor
+proc ItemParse_nofocuscolor 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2536
+CNSTI4 0
+RETI4
+ADDRGP4 $2535
+JUMPV
+LABELV $2536
+CNSTI4 1
+RETI4
+LABELV $2535
+endproc ItemParse_nofocuscolor 4 8
+export ItemParse_textscale
+proc ItemParse_textscale 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2539
+CNSTI4 0
+RETI4
+ADDRGP4 $2538
+JUMPV
+LABELV $2539
+CNSTI4 1
+RETI4
+LABELV $2538
+endproc ItemParse_textscale 4 8
+export ItemParse_textstyle
+proc ItemParse_textstyle 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2542
+CNSTI4 0
+RETI4
+ADDRGP4 $2541
+JUMPV
+LABELV $2542
+CNSTI4 1
+RETI4
+LABELV $2541
+endproc ItemParse_textstyle 4 8
+export ItemParse_boxcolor
+proc ItemParse_boxcolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2545
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2549
+CNSTI4 0
+RETI4
+ADDRGP4 $2544
+JUMPV
+LABELV $2549
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2546
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2545
+CNSTI4 1
+RETI4
+LABELV $2544
+endproc ItemParse_boxcolor 16 8
+export ItemParse_boxtextcolor
+proc ItemParse_boxtextcolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2552
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2556
+CNSTI4 0
+RETI4
+ADDRGP4 $2551
+JUMPV
+LABELV $2556
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2553
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2552
+CNSTI4 1
+RETI4
+LABELV $2551
+endproc ItemParse_boxtextcolor 16 8
+export ItemParse_backcolor
+proc ItemParse_backcolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2559
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2563
+CNSTI4 0
+RETI4
+ADDRGP4 $2558
+JUMPV
+LABELV $2563
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2560
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2559
+CNSTI4 1
+RETI4
+LABELV $2558
+endproc ItemParse_backcolor 12 8
+export ItemParse_forecolor
+proc ItemParse_forecolor 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2566
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2570
+CNSTI4 0
+RETI4
+ADDRGP4 $2565
+JUMPV
+LABELV $2570
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2567
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2566
+CNSTI4 1
+RETI4
+LABELV $2565
+endproc ItemParse_forecolor 16 8
+export ItemParse_bordercolor
+proc ItemParse_bordercolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2573
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2577
+CNSTI4 0
+RETI4
+ADDRGP4 $2572
+JUMPV
+LABELV $2577
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2574
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2573
+CNSTI4 1
+RETI4
+LABELV $2572
+endproc ItemParse_bordercolor 12 8
+export ItemParse_outlinecolor
+proc ItemParse_outlinecolor 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2580
+CNSTI4 0
+RETI4
+ADDRGP4 $2579
+JUMPV
+LABELV $2580
+CNSTI4 1
+RETI4
+LABELV $2579
+endproc ItemParse_outlinecolor 4 8
+export ItemParse_background
+proc ItemParse_background 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2583
+CNSTI4 0
+RETI4
+ADDRGP4 $2582
+JUMPV
+LABELV $2583
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2582
+endproc ItemParse_background 12 8
+export ItemParse_cinematic
+proc ItemParse_cinematic 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2586
+CNSTI4 0
+RETI4
+ADDRGP4 $2585
+JUMPV
+LABELV $2586
+CNSTI4 1
+RETI4
+LABELV $2585
+endproc ItemParse_cinematic 4 8
+export ItemParse_doubleClick
+proc ItemParse_doubleClick 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2589
+CNSTI4 0
+RETI4
+ADDRGP4 $2588
+JUMPV
+LABELV $2589
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2591
+CNSTI4 0
+RETI4
+ADDRGP4 $2588
+JUMPV
+LABELV $2591
+CNSTI4 1
+RETI4
+LABELV $2588
+endproc ItemParse_doubleClick 8 8
+export ItemParse_onFocus
+proc ItemParse_onFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2594
+CNSTI4 0
+RETI4
+ADDRGP4 $2593
+JUMPV
+LABELV $2594
+CNSTI4 1
+RETI4
+LABELV $2593
+endproc ItemParse_onFocus 4 8
+export ItemParse_leaveFocus
+proc ItemParse_leaveFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2597
+CNSTI4 0
+RETI4
+ADDRGP4 $2596
+JUMPV
+LABELV $2597
+CNSTI4 1
+RETI4
+LABELV $2596
+endproc ItemParse_leaveFocus 4 8
+export ItemParse_mouseEnter
+proc ItemParse_mouseEnter 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2600
+CNSTI4 0
+RETI4
+ADDRGP4 $2599
+JUMPV
+LABELV $2600
+CNSTI4 1
+RETI4
+LABELV $2599
+endproc ItemParse_mouseEnter 4 8
+export ItemParse_mouseExit
+proc ItemParse_mouseExit 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2603
+CNSTI4 0
+RETI4
+ADDRGP4 $2602
+JUMPV
+LABELV $2603
+CNSTI4 1
+RETI4
+LABELV $2602
+endproc ItemParse_mouseExit 4 8
+export ItemParse_mouseEnterText
+proc ItemParse_mouseEnterText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2606
+CNSTI4 0
+RETI4
+ADDRGP4 $2605
+JUMPV
+LABELV $2606
+CNSTI4 1
+RETI4
+LABELV $2605
+endproc ItemParse_mouseEnterText 4 8
+export ItemParse_mouseExitText
+proc ItemParse_mouseExitText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2609
+CNSTI4 0
+RETI4
+ADDRGP4 $2608
+JUMPV
+LABELV $2609
+CNSTI4 1
+RETI4
+LABELV $2608
+endproc ItemParse_mouseExitText 4 8
+export ItemParse_action
+proc ItemParse_action 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2612
+CNSTI4 0
+RETI4
+ADDRGP4 $2611
+JUMPV
+LABELV $2612
+CNSTI4 1
+RETI4
+LABELV $2611
+endproc ItemParse_action 4 8
+export ItemParse_transitionend
+proc ItemParse_transitionend 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2615
+CNSTI4 0
+RETI4
+ADDRGP4 $2614
+JUMPV
+LABELV $2615
+CNSTI4 1
+RETI4
+LABELV $2614
+endproc ItemParse_transitionend 4 8
+export ItemParse_special
+proc ItemParse_special 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2618
+CNSTI4 0
+RETI4
+ADDRGP4 $2617
+JUMPV
+LABELV $2618
+CNSTI4 1
+RETI4
+LABELV $2617
+endproc ItemParse_special 4 8
+export ItemParse_cvarTest
+proc ItemParse_cvarTest 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2621
+CNSTI4 0
+RETI4
+ADDRGP4 $2620
+JUMPV
+LABELV $2621
+CNSTI4 1
+RETI4
+LABELV $2620
+endproc ItemParse_cvarTest 4 8
+export ItemParse_cvar
+proc ItemParse_cvar 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2624
+CNSTI4 0
+RETI4
+ADDRGP4 $2623
+JUMPV
+LABELV $2624
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2626
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $2626
+CNSTI4 1
+RETI4
+LABELV $2623
+endproc ItemParse_cvar 8 8
+export ItemParse_maxChars
+proc ItemParse_maxChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2629
+CNSTI4 0
+RETI4
+ADDRGP4 $2628
+JUMPV
+LABELV $2629
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2631
+CNSTI4 0
+RETI4
+ADDRGP4 $2628
+JUMPV
+LABELV $2631
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2628
+endproc ItemParse_maxChars 12 8
+export ItemParse_maxPaintChars
+proc ItemParse_maxPaintChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2634
+CNSTI4 0
+RETI4
+ADDRGP4 $2633
+JUMPV
+LABELV $2634
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2636
+CNSTI4 0
+RETI4
+ADDRGP4 $2633
+JUMPV
+LABELV $2636
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2633
+endproc ItemParse_maxPaintChars 12 8
+export ItemParse_cvarFloat
+proc ItemParse_cvarFloat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2639
+CNSTI4 0
+RETI4
+ADDRGP4 $2638
+JUMPV
+LABELV $2639
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2641
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2641
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2641
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2641
+CNSTI4 1
+RETI4
+ADDRGP4 $2638
+JUMPV
+LABELV $2641
+CNSTI4 0
+RETI4
+LABELV $2638
+endproc ItemParse_cvarFloat 20 8
+export ItemParse_cvarStrList
+proc ItemParse_cvarStrList 1068 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2644
+CNSTI4 0
+RETI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2644
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2646
+CNSTI4 0
+RETI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2646
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2648
+CNSTI4 0
+RETI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2648
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2652
+JUMPV
+LABELV $2651
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2654
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2656
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2654
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2657
+CNSTI4 1
+RETI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2657
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2664
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2660
+LABELV $2664
+ADDRGP4 $2652
+JUMPV
+LABELV $2660
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2665
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2665
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2669
+CNSTI4 0
+RETI4
+ADDRGP4 $2643
+JUMPV
+LABELV $2669
+LABELV $2666
+LABELV $2652
+ADDRGP4 $2651
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2643
+endproc ItemParse_cvarStrList 1068 8
+export ItemParse_cvarFloatList
+proc ItemParse_cvarFloatList 1072 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2672
+CNSTI4 0
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2672
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2674
+CNSTI4 0
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2674
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2680
+CNSTI4 0
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2679
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2682
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2656
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2682
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2684
+CNSTI4 1
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2684
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2691
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2687
+LABELV $2691
+ADDRGP4 $2680
+JUMPV
+LABELV $2687
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2693
+CNSTI4 0
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2693
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2695
+CNSTI4 0
+RETI4
+ADDRGP4 $2671
+JUMPV
+LABELV $2695
+LABELV $2680
+ADDRGP4 $2679
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2671
+endproc ItemParse_cvarFloatList 1072 8
+export ItemParse_cvarFloatBoxList
+proc ItemParse_cvarFloatBoxList 1076 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2698
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2698
+CNSTI4 392
+ARGI4
+ADDRLP4 1044
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2700
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2700
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2702
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2702
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2708
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2707
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2710
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2656
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2710
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2712
+CNSTI4 1
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2712
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2719
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2715
+LABELV $2719
+ADDRGP4 $2708
+JUMPV
+LABELV $2715
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $2721
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2721
+ADDRLP4 1072
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ADDRLP4 1072
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2723
+CNSTI4 0
+RETI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2723
+LABELV $2708
+ADDRGP4 $2707
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2697
+endproc ItemParse_cvarFloatBoxList 1076 8
+export ItemParse_cvarStrBoxList
+proc ItemParse_cvarStrBoxList 1072 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2726
+CNSTI4 0
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2726
+CNSTI4 392
+ARGI4
+ADDRLP4 1048
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2728
+CNSTI4 0
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2728
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2730
+CNSTI4 0
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2730
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2732
+CNSTI4 0
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2732
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2736
+JUMPV
+LABELV $2735
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2738
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2656
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2738
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2740
+CNSTI4 1
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2740
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2747
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2743
+LABELV $2747
+ADDRGP4 $2736
+JUMPV
+LABELV $2743
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2748
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1060
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2749
+JUMPV
+LABELV $2748
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1060
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1068
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2752
+CNSTI4 0
+RETI4
+ADDRGP4 $2725
+JUMPV
+LABELV $2752
+LABELV $2749
+LABELV $2736
+ADDRGP4 $2735
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2725
+endproc ItemParse_cvarStrBoxList 1072 8
+export ItemParse_addColorRange
+proc ItemParse_addColorRange 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 24
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2755
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2755
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2755
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $2759
+ADDRLP4 36
+CNSTI4 24
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 292
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2759
+CNSTI4 1
+RETI4
+ADDRGP4 $2754
+JUMPV
+LABELV $2755
+CNSTI4 0
+RETI4
+LABELV $2754
+endproc ItemParse_addColorRange 48 12
+export ItemParse_ownerdrawFlag
+proc ItemParse_ownerdrawFlag 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2762
+CNSTI4 0
+RETI4
+ADDRGP4 $2761
+JUMPV
+LABELV $2762
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2761
+endproc ItemParse_ownerdrawFlag 12 8
+export ItemParse_enableCvar
+proc ItemParse_enableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2765
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2764
+JUMPV
+LABELV $2765
+CNSTI4 0
+RETI4
+LABELV $2764
+endproc ItemParse_enableCvar 4 8
+export ItemParse_disableCvar
+proc ItemParse_disableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2768
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 2
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2767
+JUMPV
+LABELV $2768
+CNSTI4 0
+RETI4
+LABELV $2767
+endproc ItemParse_disableCvar 4 8
+export ItemParse_showCvar
+proc ItemParse_showCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2771
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2770
+JUMPV
+LABELV $2771
+CNSTI4 0
+RETI4
+LABELV $2770
+endproc ItemParse_showCvar 4 8
+export ItemParse_hideCvar
+proc ItemParse_hideCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2774
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2773
+JUMPV
+LABELV $2774
+CNSTI4 0
+RETI4
+LABELV $2773
+endproc ItemParse_hideCvar 4 8
+data
+export itemParseKeywords
+align 4
+LABELV itemParseKeywords
+address $2776
+address ItemParse_name
+byte 4 0
+address $2777
+address ItemParse_text
+byte 4 0
+address $2778
+address ItemParse_group
+byte 4 0
+address $2779
+address ItemParse_asset_model
+byte 4 0
+address $2780
+address ItemParse_asset_shader
+byte 4 0
+address $2781
+address ItemParse_model_origin
+byte 4 0
+address $2782
+address ItemParse_model_fovx
+byte 4 0
+address $2783
+address ItemParse_model_fovy
+byte 4 0
+address $2784
+address ItemParse_model_rotation
+byte 4 0
+address $2785
+address ItemParse_model_angle
+byte 4 0
+address $2786
+address ItemParse_model_animplay
+byte 4 0
+address $2787
+address ItemParse_rect
+byte 4 0
+address $2788
+address ItemParse_style
+byte 4 0
+address $2789
+address ItemParse_decoration
+byte 4 0
+address $2790
+address ItemParse_notselectable
+byte 4 0
+address $2791
+address ItemParse_wrapped
+byte 4 0
+address $2792
+address ItemParse_autowrapped
+byte 4 0
+address $2793
+address ItemParse_horizontalscroll
+byte 4 0
+address $2794
+address ItemParse_type
+byte 4 0
+address $2795
+address ItemParse_elementwidth
+byte 4 0
+address $2796
+address ItemParse_elementheight
+byte 4 0
+address $2797
+address ItemParse_feeder
+byte 4 0
+address $2798
+address ItemParse_elementtype
+byte 4 0
+address $2799
+address ItemParse_columns
+byte 4 0
+address $2800
+address ItemParse_border
+byte 4 0
+address $2801
+address ItemParse_bordersize
+byte 4 0
+address $2802
+address ItemParse_visible
+byte 4 0
+address $2803
+address ItemParse_ownerdraw
+byte 4 0
+address $2804
+address ItemParse_align
+byte 4 0
+address $2805
+address ItemParse_textalign
+byte 4 0
+address $2806
+address ItemParse_textalignx
+byte 4 0
+address $2807
+address ItemParse_textaligny
+byte 4 0
+address $2808
+address ItemParse_scralign
+byte 4 0
+address $2809
+address ItemParse_scralignfactor
+byte 4 0
+address $2810
+address ItemParse_textscale
+byte 4 0
+address $2811
+address ItemParse_textstyle
+byte 4 0
+address $362
+address ItemParse_backcolor
+byte 4 0
+address $365
+address ItemParse_forecolor
+byte 4 0
+address $368
+address ItemParse_bordercolor
+byte 4 0
+address $2812
+address ItemParse_outlinecolor
+byte 4 0
+address $2813
+address ItemParse_background
+byte 4 0
+address $2814
+address ItemParse_onFocus
+byte 4 0
+address $2815
+address ItemParse_leaveFocus
+byte 4 0
+address $2816
+address ItemParse_mouseEnter
+byte 4 0
+address $2817
+address ItemParse_mouseExit
+byte 4 0
+address $2818
+address ItemParse_mouseEnterText
+byte 4 0
+address $2819
+address ItemParse_mouseExitText
+byte 4 0
+address $2820
+address ItemParse_action
+byte 4 0
+address $2821
+address ItemParse_special
+byte 4 0
+address $2822
+address ItemParse_cvar
+byte 4 0
+address $2823
+address ItemParse_maxChars
+byte 4 0
+address $2824
+address ItemParse_maxPaintChars
+byte 4 0
+address $2825
+address ItemParse_focusSound
+byte 4 0
+address $2826
+address ItemParse_cvarFloat
+byte 4 0
+address $2827
+address ItemParse_cvarStrList
+byte 4 0
+address $2828
+address ItemParse_cvarFloatList
+byte 4 0
+address $2829
+address ItemParse_transitionend
+byte 4 0
+address $2830
+address ItemParse_cvarFloatBoxList
+byte 4 0
+address $2831
+address ItemParse_cvarStrBoxList
+byte 4 0
+address $2832
+address ItemParse_boxcolor
+byte 4 0
+address $2833
+address ItemParse_boxtextcolor
+byte 4 0
+address $2834
+address ItemParse_boxtextscale
+byte 4 0
+address $2835
+address ItemParse_comboalignx
+byte 4 0
+address $2836
+address ItemParse_comboaligny
+byte 4 0
+address $2837
+address ItemParse_bindtype
+byte 4 0
+address $2838
+address ItemParse_bind2click
+byte 4 0
+address $2839
+address ItemParse_nofocuscolor
+byte 4 0
+address $2840
+address ItemParse_addColorRange
+byte 4 0
+address $2841
+address ItemParse_ownerdrawFlag
+byte 4 0
+address $2842
+address ItemParse_enableCvar
+byte 4 0
+address $2843
+address ItemParse_cvarTest
+byte 4 0
+address $2844
+address ItemParse_disableCvar
+byte 4 0
+address $2845
+address ItemParse_showCvar
+byte 4 0
+address $2846
+address ItemParse_hideCvar
+byte 4 0
+address $2847
+address ItemParse_cinematic
+byte 4 0
+address $2848
+address ItemParse_doubleClick
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export Item_SetupKeywordHash
+code
+proc Item_SetupKeywordHash 4 12
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2048
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2853
+JUMPV
+LABELV $2850
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $2851
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2853
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2850
+LABELV $2849
+endproc Item_SetupKeywordHash 4 12
+export Item_Parse
+proc Item_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2855
+CNSTI4 0
+RETI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2855
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2857
+CNSTI4 0
+RETI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2857
+ADDRFP4 4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 592
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $2861
+JUMPV
+LABELV $2860
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2863
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2656
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2863
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2865
+CNSTI4 1
+RETI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2865
+ADDRGP4 itemParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2869
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2871
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $2861
+JUMPV
+LABELV $2869
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2873
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2875
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2873
+LABELV $2861
+ADDRGP4 $2860
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2854
+endproc Item_Parse 1060 12
+export Item_InitControls
+proc Item_InitControls 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2878
+ADDRGP4 $2877
+JUMPV
+LABELV $2878
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2880
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2882
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2882
+LABELV $2880
+LABELV $2877
+endproc Item_InitControls 4 0
+export MenuParse_font
+proc MenuParse_font 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2885
+CNSTI4 0
+RETI4
+ADDRGP4 $2884
+JUMPV
+LABELV $2885
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62080
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2887
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 284
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62080
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2887
+CNSTI4 1
+RETI4
+LABELV $2884
+endproc MenuParse_font 12 12
+export MenuParse_name
+proc MenuParse_name 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2890
+CNSTI4 0
+RETI4
+ADDRGP4 $2889
+JUMPV
+LABELV $2890
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2894
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2892
+LABELV $2892
+CNSTI4 1
+RETI4
+LABELV $2889
+endproc MenuParse_name 12 8
+export MenuParse_fullscreen
+proc MenuParse_fullscreen 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2896
+CNSTI4 0
+RETI4
+ADDRGP4 $2895
+JUMPV
+LABELV $2896
+CNSTI4 1
+RETI4
+LABELV $2895
+endproc MenuParse_fullscreen 8 8
+export MenuParse_rect
+proc MenuParse_rect 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2899
+CNSTI4 0
+RETI4
+ADDRGP4 $2898
+JUMPV
+LABELV $2899
+CNSTI4 1
+RETI4
+LABELV $2898
+endproc MenuParse_rect 8 8
+export MenuParse_style
+proc MenuParse_style 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2902
+CNSTI4 0
+RETI4
+ADDRGP4 $2901
+JUMPV
+LABELV $2902
+CNSTI4 1
+RETI4
+LABELV $2901
+endproc MenuParse_style 8 8
+export MenuParse_visible
+proc MenuParse_visible 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2905
+CNSTI4 0
+RETI4
+ADDRGP4 $2904
+JUMPV
+LABELV $2905
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2907
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2907
+CNSTI4 1
+RETI4
+LABELV $2904
+endproc MenuParse_visible 16 8
+export MenuParse_onOpen
+proc MenuParse_onOpen 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2910
+CNSTI4 0
+RETI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2910
+CNSTI4 1
+RETI4
+LABELV $2909
+endproc MenuParse_onOpen 8 8
+export MenuParse_onTransition
+proc MenuParse_onTransition 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2913
+CNSTI4 0
+RETI4
+ADDRGP4 $2912
+JUMPV
+LABELV $2913
+CNSTI4 1
+RETI4
+LABELV $2912
+endproc MenuParse_onTransition 8 8
+export MenuParse_escTransition
+proc MenuParse_escTransition 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2916
+CNSTI4 0
+RETI4
+ADDRGP4 $2915
+JUMPV
+LABELV $2916
+CNSTI4 1
+RETI4
+LABELV $2915
+endproc MenuParse_escTransition 8 8
+export MenuParse_onClose
+proc MenuParse_onClose 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2919
+CNSTI4 0
+RETI4
+ADDRGP4 $2918
+JUMPV
+LABELV $2919
+CNSTI4 1
+RETI4
+LABELV $2918
+endproc MenuParse_onClose 8 8
+export MenuParse_onESC
+proc MenuParse_onESC 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2922
+CNSTI4 0
+RETI4
+ADDRGP4 $2921
+JUMPV
+LABELV $2922
+CNSTI4 1
+RETI4
+LABELV $2921
+endproc MenuParse_onESC 8 8
+export MenuParse_border
+proc MenuParse_border 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2925
+CNSTI4 0
+RETI4
+ADDRGP4 $2924
+JUMPV
+LABELV $2925
+CNSTI4 1
+RETI4
+LABELV $2924
+endproc MenuParse_border 8 8
+export MenuParse_borderSize
+proc MenuParse_borderSize 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2928
+CNSTI4 0
+RETI4
+ADDRGP4 $2927
+JUMPV
+LABELV $2928
+CNSTI4 1
+RETI4
+LABELV $2927
+endproc MenuParse_borderSize 8 8
+export MenuParse_backcolor
+proc MenuParse_backcolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2931
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2935
+CNSTI4 0
+RETI4
+ADDRGP4 $2930
+JUMPV
+LABELV $2935
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2932
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2931
+CNSTI4 1
+RETI4
+LABELV $2930
+endproc MenuParse_backcolor 16 8
+export MenuParse_forecolor
+proc MenuParse_forecolor 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2938
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2942
+CNSTI4 0
+RETI4
+ADDRGP4 $2937
+JUMPV
+LABELV $2942
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2939
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2938
+CNSTI4 1
+RETI4
+LABELV $2937
+endproc MenuParse_forecolor 20 8
+export MenuParse_bordercolor
+proc MenuParse_bordercolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2945
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2949
+CNSTI4 0
+RETI4
+ADDRGP4 $2944
+JUMPV
+LABELV $2949
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2946
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2945
+CNSTI4 1
+RETI4
+LABELV $2944
+endproc MenuParse_bordercolor 16 8
+export MenuParse_focuscolor
+proc MenuParse_focuscolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2952
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2956
+CNSTI4 0
+RETI4
+ADDRGP4 $2951
+JUMPV
+LABELV $2956
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2953
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2952
+CNSTI4 1
+RETI4
+LABELV $2951
+endproc MenuParse_focuscolor 16 8
+export MenuParse_disablecolor
+proc MenuParse_disablecolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2959
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2963
+CNSTI4 0
+RETI4
+ADDRGP4 $2958
+JUMPV
+LABELV $2963
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 252
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2960
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2959
+CNSTI4 1
+RETI4
+LABELV $2958
+endproc MenuParse_disablecolor 16 8
+export MenuParse_outlinecolor
+proc MenuParse_outlinecolor 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2966
+CNSTI4 0
+RETI4
+ADDRGP4 $2965
+JUMPV
+LABELV $2966
+CNSTI4 1
+RETI4
+LABELV $2965
+endproc MenuParse_outlinecolor 8 8
+export MenuParse_background
+proc MenuParse_background 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2969
+CNSTI4 0
+RETI4
+ADDRGP4 $2968
+JUMPV
+LABELV $2969
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2968
+endproc MenuParse_background 16 8
+export MenuParse_cinematic
+proc MenuParse_cinematic 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2972
+CNSTI4 0
+RETI4
+ADDRGP4 $2971
+JUMPV
+LABELV $2972
+CNSTI4 1
+RETI4
+LABELV $2971
+endproc MenuParse_cinematic 8 8
+export MenuParse_ownerdrawFlag
+proc MenuParse_ownerdrawFlag 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2975
+CNSTI4 0
+RETI4
+ADDRGP4 $2974
+JUMPV
+LABELV $2975
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2974
+endproc MenuParse_ownerdrawFlag 16 8
+export MenuParse_ownerdraw
+proc MenuParse_ownerdraw 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2978
+CNSTI4 0
+RETI4
+ADDRGP4 $2977
+JUMPV
+LABELV $2978
+CNSTI4 1
+RETI4
+LABELV $2977
+endproc MenuParse_ownerdraw 8 8
+export MenuParse_popup
+proc MenuParse_popup 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2097152
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2980
+endproc MenuParse_popup 8 0
+export MenuParse_outOfBounds
+proc MenuParse_outOfBounds 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2981
+endproc MenuParse_outOfBounds 8 0
+export MenuParse_soundLoop
+proc MenuParse_soundLoop 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2983
+CNSTI4 0
+RETI4
+ADDRGP4 $2982
+JUMPV
+LABELV $2983
+CNSTI4 1
+RETI4
+LABELV $2982
+endproc MenuParse_soundLoop 8 8
+export MenuParse_fadeClamp
+proc MenuParse_fadeClamp 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2986
+CNSTI4 0
+RETI4
+ADDRGP4 $2985
+JUMPV
+LABELV $2986
+CNSTI4 1
+RETI4
+LABELV $2985
+endproc MenuParse_fadeClamp 8 8
+export MenuParse_fadeAmount
+proc MenuParse_fadeAmount 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2989
+CNSTI4 0
+RETI4
+ADDRGP4 $2988
+JUMPV
+LABELV $2989
+CNSTI4 1
+RETI4
+LABELV $2988
+endproc MenuParse_fadeAmount 8 8
+export MenuParse_fadeCycle
+proc MenuParse_fadeCycle 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2992
+CNSTI4 0
+RETI4
+ADDRGP4 $2991
+JUMPV
+LABELV $2992
+CNSTI4 1
+RETI4
+LABELV $2991
+endproc MenuParse_fadeCycle 8 8
+export MenuParse_itemDef
+proc MenuParse_itemDef 40 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 128
+GEI4 $2995
+CNSTI4 604
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Init
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Item_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2997
+CNSTI4 0
+RETI4
+ADDRGP4 $2994
+JUMPV
+LABELV $2997
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_InitControls
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2995
+CNSTI4 1
+RETI4
+LABELV $2994
+endproc MenuParse_itemDef 40 8
+data
+export menuParseKeywords
+align 4
+LABELV menuParseKeywords
+address $2999
+address MenuParse_font
+byte 4 0
+address $2776
+address MenuParse_name
+byte 4 0
+address $3000
+address MenuParse_fullscreen
+byte 4 0
+address $2787
+address MenuParse_rect
+byte 4 0
+address $2788
+address MenuParse_style
+byte 4 0
+address $2802
+address MenuParse_visible
+byte 4 0
+address $3001
+address MenuParse_onOpen
+byte 4 0
+address $3002
+address MenuParse_onTransition
+byte 4 0
+address $3003
+address MenuParse_escTransition
+byte 4 0
+address $3004
+address MenuParse_onClose
+byte 4 0
+address $3005
+address MenuParse_onESC
+byte 4 0
+address $2800
+address MenuParse_border
+byte 4 0
+address $3006
+address MenuParse_borderSize
+byte 4 0
+address $362
+address MenuParse_backcolor
+byte 4 0
+address $365
+address MenuParse_forecolor
+byte 4 0
+address $368
+address MenuParse_bordercolor
+byte 4 0
+address $3007
+address MenuParse_focuscolor
+byte 4 0
+address $3008
+address MenuParse_disablecolor
+byte 4 0
+address $2812
+address MenuParse_outlinecolor
+byte 4 0
+address $2813
+address MenuParse_background
+byte 4 0
+address $2803
+address MenuParse_ownerdraw
+byte 4 0
+address $2841
+address MenuParse_ownerdrawFlag
+byte 4 0
+address $3009
+address MenuParse_outOfBounds
+byte 4 0
+address $3010
+address MenuParse_soundLoop
+byte 4 0
+address $3011
+address MenuParse_itemDef
+byte 4 0
+address $2847
+address MenuParse_cinematic
+byte 4 0
+address $3012
+address MenuParse_popup
+byte 4 0
+address $3013
+address MenuParse_fadeClamp
+byte 4 0
+address $3014
+address MenuParse_fadeCycle
+byte 4 0
+address $3015
+address MenuParse_fadeAmount
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export Menu_SetupKeywordHash
+code
+proc Menu_SetupKeywordHash 4 12
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2048
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3020
+JUMPV
+LABELV $3017
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $3018
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3020
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3017
+LABELV $3016
+endproc Menu_SetupKeywordHash 4 12
+export Menu_Parse
+proc Menu_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $3022
+CNSTI4 0
+RETI4
+ADDRGP4 $3021
+JUMPV
+LABELV $3022
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3028
+CNSTI4 0
+RETI4
+ADDRGP4 $3021
+JUMPV
+LABELV $3027
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1040
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $3030
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3032
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3021
+JUMPV
+LABELV $3030
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $3033
+CNSTI4 1
+RETI4
+ADDRGP4 $3021
+JUMPV
+LABELV $3033
+ADDRGP4 menuParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3037
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3039
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $3028
+JUMPV
+LABELV $3037
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $3041
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3043
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $3021
+JUMPV
+LABELV $3041
+LABELV $3028
+ADDRGP4 $3027
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3021
+endproc Menu_Parse 1060 12
+export Menu_New
+proc Menu_New 12 8
+ADDRLP4 0
+CNSTI4 780
+ADDRGP4 menuCount
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRGP4 menuCount
+INDIRI4
+CNSTI4 64
+GEI4 $3046
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Init
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3048
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_PostParse
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 menuCount
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3048
+LABELV $3046
+LABELV $3045
+endproc Menu_New 12 8
+export Menu_Count
+proc Menu_Count 0 0
+ADDRGP4 menuCount
+INDIRI4
+RETI4
+LABELV $3050
+endproc Menu_Count 0 0
+lit
+align 4
+LABELV $3060
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export Menu_PaintAll
+code
+proc Menu_PaintAll 32 32
+ADDRGP4 captureFunc
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3052
+ADDRGP4 captureData
+INDIRP4
+ARGP4
+ADDRGP4 captureFunc
+INDIRP4
+CALLV
+pop
+LABELV $3052
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3057
+JUMPV
+LABELV $3054
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $3055
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3057
+ADDRLP4 4
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $3054
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $3058
+ADDRLP4 8
+ADDRGP4 $3060
+INDIRB
+ASGNB 16
+ADDRGP4 $3061
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 73500
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $3058
+LABELV $3051
+endproc Menu_PaintAll 32 32
+export Menu_PaintEnd
+proc Menu_PaintEnd 16 4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3066
+JUMPV
+LABELV $3063
+ADDRLP4 4
+CNSTI4 780
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3067
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3072
+JUMPV
+LABELV $3069
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $3073
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_TransitionEnd
+CALLV
+pop
+ADDRGP4 $3062
+JUMPV
+LABELV $3073
+LABELV $3070
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3072
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $3069
+LABELV $3067
+LABELV $3064
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3066
+ADDRLP4 12
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $3063
+LABELV $3062
+endproc Menu_PaintEnd 16 4
+export Menu_Reset
+proc Menu_Reset 0 0
+ADDRGP4 menuCount
+CNSTI4 0
+ASGNI4
+LABELV $3075
+endproc Menu_Reset 0 0
+export Display_GetContext
+proc Display_GetContext 0 0
+ADDRGP4 DC
+INDIRP4
+RETP4
+LABELV $3076
+endproc Display_GetContext 0 0
+export Display_CaptureItem
+proc Display_CaptureItem 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3081
+JUMPV
+LABELV $3078
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3082
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+RETP4
+ADDRGP4 $3077
+JUMPV
+LABELV $3082
+LABELV $3079
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3081
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3078
+CNSTP4 0
+RETP4
+LABELV $3077
+endproc Display_CaptureItem 8 12
+export Display_MouseMove
+proc Display_MouseMove 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3085
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3087
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $3089
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $3084
+JUMPV
+LABELV $3089
+LABELV $3087
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3094
+JUMPV
+LABELV $3091
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+LABELV $3092
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3094
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3091
+ADDRGP4 $3086
+JUMPV
+LABELV $3085
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $3086
+CNSTI4 1
+RETI4
+LABELV $3084
+endproc Display_MouseMove 16 12
+export Display_CursorType
+proc Display_CursorType 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3099
+JUMPV
+LABELV $3096
+ADDRLP4 20
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 Menus
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 Menus+4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1088421888
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $3104
+CNSTI4 4
+RETI4
+ADDRGP4 $3095
+JUMPV
+LABELV $3104
+LABELV $3097
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3099
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3096
+CNSTI4 2
+RETI4
+LABELV $3095
+endproc Display_CursorType 36 12
+export Display_HandleKey
+proc Display_HandleKey 12 12
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3107
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $3107
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3109
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $3109
+LABELV $3106
+endproc Display_HandleKey 12 12
+proc Window_CacheContents 12 20
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3112
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3114
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $3114
+LABELV $3112
+LABELV $3111
+endproc Window_CacheContents 12 20
+proc Item_CacheContents 0 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3117
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+LABELV $3117
+LABELV $3116
+endproc Item_CacheContents 0 4
+proc Menu_CacheContents 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3125
+JUMPV
+LABELV $3122
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_CacheContents
+CALLV
+pop
+LABELV $3123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3125
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $3122
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3126
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3126
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+pop
+LABELV $3126
+LABELV $3120
+LABELV $3119
+endproc Menu_CacheContents 8 8
+export Display_CacheAll
+proc Display_CacheAll 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3132
+JUMPV
+LABELV $3129
+CNSTI4 780
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 Menus
+ADDP4
+ARGP4
+ADDRGP4 Menu_CacheContents
+CALLV
+pop
+LABELV $3130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3132
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menuCount
+INDIRI4
+LTI4 $3129
+LABELV $3128
+endproc Display_CacheAll 4 4
+proc Menu_OverActiveItem 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3134
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $3134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3136
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3141
+JUMPV
+LABELV $3138
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 16
+INDIRI4
+NEI4 $3144
+ADDRLP4 12
+INDIRI4
+CNSTI4 67108864
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $3142
+LABELV $3144
+ADDRGP4 $3139
+JUMPV
+LABELV $3142
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $3145
+ADDRGP4 $3139
+JUMPV
+LABELV $3145
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3147
+ADDRLP4 24
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3149
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3149
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $3139
+CNSTI4 1
+RETI4
+ADDRGP4 $3133
+JUMPV
+LABELV $3149
+CNSTI4 1
+RETI4
+ADDRGP4 $3133
+JUMPV
+LABELV $3147
+LABELV $3139
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3141
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $3138
+LABELV $3136
+LABELV $3134
+CNSTI4 0
+RETI4
+LABELV $3133
+endproc Menu_OverActiveItem 40 12
+bss
+export menuParseKeywordHash
+align 4
+LABELV menuParseKeywordHash
+skip 2048
+export itemParseKeywordHash
+align 4
+LABELV itemParseKeywordHash
+skip 2048
+export g_nameBind2
+align 1
+LABELV g_nameBind2
+skip 32
+export g_nameBind1
+align 1
+LABELV g_nameBind1
+skip 32
+align 4
+LABELV awc
+skip 528832
+align 4
+LABELV strHandle
+skip 8192
+align 1
+LABELV strPool
+skip 393216
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV memoryPool
+skip 1048576
+import trap_R_AddLightToScene
+export menuStack
+align 4
+LABELV menuStack
+skip 64
+export Menus
+align 4
+LABELV Menus
+skip 49920
+align 4
+LABELV scrollInfo
+skip 32
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Script_Parse
+import Display_ExpandMacros
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3061
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $3043
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3039
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3032
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $3015
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3014
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3013
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $3012
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $3011
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $3010
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $3009
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $3008
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3007
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $3006
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $3005
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $3004
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $3003
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3002
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3001
+byte 1 111
+byte 1 110
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $3000
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2999
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2894
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2875
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2871
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2848
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2847
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $2846
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2845
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2844
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2843
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2842
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2841
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2840
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2839
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2838
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 50
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2837
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2836
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $2835
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $2834
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2833
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2832
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2831
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2830
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2829
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2828
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2827
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2826
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2825
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2824
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2823
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2822
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2821
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2820
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2819
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2818
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2817
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2816
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2815
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2814
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2813
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2812
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2811
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2810
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2809
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2808
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2807
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $2806
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $2805
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2804
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2803
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $2802
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2801
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2800
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2799
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2798
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2797
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2796
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2795
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2794
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2793
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2792
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2791
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2790
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2789
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2788
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2787
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $2786
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2785
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2784
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2783
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 121
+byte 1 0
+align 1
+LABELV $2782
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 120
+byte 1 0
+align 1
+LABELV $2781
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2780
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2779
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $2778
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2777
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2776
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2656
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $1862
+byte 1 78
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1859
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $1825
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1792
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $1791
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $1790
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $1789
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1788
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1787
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $1786
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1785
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1784
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1783
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1782
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1781
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1780
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1779
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 69
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1778
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1777
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1776
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1775
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $1774
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1773
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1772
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 121
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1771
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1770
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1769
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1768
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1767
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $1766
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1765
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1764
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $1763
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1762
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $1761
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $1760
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $1759
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1758
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $1757
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $1756
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $1755
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $1754
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $1753
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $1752
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $1751
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $1750
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $1749
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1748
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $1747
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1746
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1745
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1744
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $1743
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1742
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1741
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1740
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1739
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1738
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1737
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1736
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1735
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1734
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $1733
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1717
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $1716
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1405
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1401
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1354
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $1243
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1075
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $994
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $971
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $636
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $635
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $634
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $633
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $632
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 0
+align 1
+LABELV $631
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $630
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $629
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $628
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $627
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $626
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $625
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $624
+byte 1 120
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $623
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $622
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $620
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $619
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $618
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $617
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $614
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $613
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $612
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $611
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $610
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $609
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $608
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $607
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $596
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 0
+align 1
+LABELV $589
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 0
+align 1
+LABELV $579
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $575
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $487
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $368
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $365
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $362
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $201
+byte 1 32
+byte 1 0
+align 1
+LABELV $198
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $193
+byte 1 125
+byte 1 0
+align 1
+LABELV $184
+byte 1 123
+byte 1 0
+align 1
+LABELV $148
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $115
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $88
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $77
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $76
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $75
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $74
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 47
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $55
+byte 1 0
+align 1
+LABELV $46
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 33
+byte 1 10
+byte 1 0
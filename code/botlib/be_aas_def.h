@@ -143,6 +143,16 @@ typedef struct aas_routingcache_s
 	unsigned short int traveltimes[1];			//travel time for every area (variable sized)
 } aas_routingcache_t;
 
+//all pairs routing table for one combination of travel flags
+//rows are start areas, columns goal areas, both numbered by routetableindex
+typedef struct aas_routetable_s
+{
+	int travelflags;							//combinations of the travel flags
+	unsigned short int *traveltimes;			//travel time without the leg in the start area, 0 if unreachable
+	unsigned char *reachabilities;				//reachability of the start area to use
+	struct aas_routetable_s *next;
+} aas_routetable_t;
+
 //fields for the routing algorithm
 typedef struct aas_routingupdate_s
 {
@@ -262,6 +272,11 @@ typedef struct aas_s
 	//cache list sorted on time
 	aas_routingcache_t *oldestcache;		// start of cache list sorted on time
 	aas_routingcache_t *newestcache;		// end of cache list sorted on time
+	//all pairs routing tables, only used while no area is disabled
+	int numroutetableareas;
+	int *routetableindex;					//row and column of every area, -1 if not in the tables
+	aas_routetable_t *routetables;
+	int numdisabledareas;
 	//maximum travel time through portal areas
 	int *portalmaxtraveltimes;
 	//areas the reachabilities go through
@@ -156,6 +156,8 @@ int AAS_StartFrame(float time)
 	AAS_ContinueInit(time);
 	//
 	aasworld.frameroutingupdates = 0;
+	//pick up the routing cache built in the background
+	AAS_ContinueRoutingCacheWarming();
 	//
 	if (botDeveloper)
 	{
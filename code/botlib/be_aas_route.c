@@ -47,6 +47,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #define ROUTING_DEBUG
 
+extern int Sys_MilliSeconds(void);
+
 //travel time in hundreths of a second = distance * 100 / speed
 #define DISTANCEFACTOR_CROUCH		1.3f		//crouch speed = 100
 #define DISTANCEFACTOR_SWIM			1		//should be 0.66, swim speed = 150
@@ -84,6 +86,8 @@ int numportalcacheupdates;
 int routingcachesize;
 int max_routingcachesize;
 
+static void AAS_RestartRoutingCacheWarming(void);
+
 //===========================================================================
 //
 // Parameter:			-
@@ -329,6 +333,11 @@ int AAS_EnableRoutingArea(int areanum, int enable)
 	{
 		//remove all routing cache involving this area
 		AAS_RemoveRoutingCacheUsingArea( areanum );
+		//the cache being warmed may have been built with the old state
+		AAS_RestartRoutingCacheWarming();
+		//the routing tables are only used while no area is disabled
+		if (enable) aasworld.numdisabledareas--;
+		else aasworld.numdisabledareas++;
 	} //end if
 	return !flags;
 } //end of the function AAS_EnableRoutingArea
@@ -733,7 +742,7 @@ int AAS_FreeOldestCache(void)
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes)
+static aas_routingcache_t *AAS_NewRoutingCache(int numtraveltimes)
 {
 	aas_routingcache_t *cache;
 	int size;
@@ -743,13 +752,25 @@ aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes)
 						+ numtraveltimes * sizeof(unsigned short int)
 						+ numtraveltimes * sizeof(unsigned char);
 	//
-	routingcachesize += size;
-	//
 	cache = (aas_routingcache_t *) GetClearedMemory(size);
 	cache->reachabilities = (unsigned char *) cache + sizeof(aas_routingcache_t)
 								+ numtraveltimes * sizeof(unsigned short int);
 	cache->size = size;
 	return cache;
+} //end of the function AAS_NewRoutingCache
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes)
+{
+	aas_routingcache_t *cache;
+
+	cache = AAS_NewRoutingCache(numtraveltimes);
+	routingcachesize += cache->size;
+	return cache;
 } //end of the function AAS_AllocRoutingCache
 //===========================================================================
 //
@@ -908,6 +929,250 @@ void AAS_CreateAllRoutingCache(void)
 	aasworld.initialized = qfalse;
 } //end of the function AAS_CreateAllRoutingCache
 //===========================================================================
+// all pairs routing tables
+//
+// For small and medium maps the travel times between all areas with
+// reachabilities can be kept for a few combinations of travel flags.
+// Lookups with those flags are then served from the tables in constant
+// time instead of building area and portal routing cache.  The tables
+// assume no area is disabled and are skipped while one is.
+//===========================================================================
+
+//the travel flags the bots use, tables are built in this order while they fit
+static const int aas_routetableflags[] = {
+	TFL_DEFAULT,
+	TFL_DEFAULT|TFL_ROCKETJUMP,
+	TFL_DEFAULT|TFL_GRAPPLEHOOK
+};
+
+//===========================================================================
+// numbers the areas with reachabilities, these are the rows and columns
+// of the tables
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_InitRouteTableIndex(void)
+{
+	int i;
+
+	if (aasworld.routetableindex) FreeMemory(aasworld.routetableindex);
+	aasworld.routetableindex = (int *) GetMemory(aasworld.numareas * sizeof(int));
+	aasworld.numroutetableareas = 0;
+	for (i = 0; i < aasworld.numareas; i++)
+	{
+		if (i > 0 && aasworld.areasettings[i].numreachableareas > 0)
+		{
+			aasworld.routetableindex[i] = aasworld.numroutetableareas++;
+		} //end if
+		else
+		{
+			aasworld.routetableindex[i] = -1;
+		} //end else
+	} //end for
+} //end of the function AAS_InitRouteTableIndex
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_RouteTableSize(void)
+{
+	return aasworld.numroutetableareas * aasworld.numroutetableareas *
+				(sizeof(unsigned short int) + sizeof(unsigned char));
+} //end of the function AAS_RouteTableSize
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_MaxRouteTableSize(void)
+{
+	return 1024 * (int) LibVarValue("max_routetablesize", "4096");
+} //end of the function AAS_MaxRouteTableSize
+//===========================================================================
+// returns qtrue for the travel flags tables are built for that don't
+// have a table yet, disabled areas or not
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static qboolean AAS_RouteTableMissing(int travelflags)
+{
+	aas_routetable_t *table;
+	int i;
+
+	for (table = aasworld.routetables; table; table = table->next)
+	{
+		if (table->travelflags == travelflags) return qfalse;
+	} //end for
+	for (i = 0; i < ARRAY_LEN(aas_routetableflags); i++)
+	{
+		if (aas_routetableflags[i] == travelflags) return qtrue;
+	} //end for
+	return qfalse;
+} //end of the function AAS_RouteTableMissing
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static aas_routetable_t *AAS_AllocRouteTable(int travelflags)
+{
+	aas_routetable_t *table;
+	int numentries;
+
+	numentries = aasworld.numroutetableareas * aasworld.numroutetableareas;
+	table = (aas_routetable_t *) GetClearedMemory(sizeof(aas_routetable_t) + AAS_RouteTableSize());
+	table->travelflags = travelflags;
+	table->traveltimes = (unsigned short int *) (table + 1);
+	table->reachabilities = (unsigned char *) (table->traveltimes + numentries);
+	return table;
+} //end of the function AAS_AllocRouteTable
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_LinkRouteTable(aas_routetable_t *table)
+{
+	aas_routetable_t **prev;
+
+	//keep them in the order they were built in
+	for (prev = &aasworld.routetables; *prev; prev = &(*prev)->next)
+		;
+	table->next = NULL;
+	*prev = table;
+} //end of the function AAS_LinkRouteTable
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_FreeRouteTables(void)
+{
+	aas_routetable_t *table, *next;
+
+	for (table = aasworld.routetables; table; table = next)
+	{
+		next = table->next;
+		FreeMemory(table);
+	} //end for
+	aasworld.routetables = NULL;
+} //end of the function AAS_FreeRouteTables
+//===========================================================================
+// returns the table for the given travel flags or NULL if there is none
+// or it can't be used right now
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static ID_INLINE aas_routetable_t *AAS_RouteTable(int travelflags)
+{
+	aas_routetable_t *table;
+
+	if (aasworld.numdisabledareas) return NULL;
+	for (table = aasworld.routetables; table; table = table->next)
+	{
+		if (table->travelflags == travelflags) return table;
+	} //end for
+	return NULL;
+} //end of the function AAS_RouteTable
+//===========================================================================
+// fills a table through the routing cache, one goal area at a time so
+// the cache towards it is reused for all the start areas
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static aas_routetable_t *AAS_CreateRouteTable(int travelflags)
+{
+	int i, j, n, startareanum, goalareanum, traveltime, reachnum, *areas;
+	aas_routetable_t *table;
+	aas_reachability_t *reach;
+
+	n = aasworld.numroutetableareas;
+	table = AAS_AllocRouteTable(travelflags);
+	areas = (int *) GetMemory(n * sizeof(int));
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (aasworld.routetableindex[i] >= 0) areas[aasworld.routetableindex[i]] = i;
+	} //end for
+	//
+	for (j = 0; j < n; j++)
+	{
+		goalareanum = areas[j];
+		for (i = 0; i < n; i++)
+		{
+			if (i == j) continue;
+			startareanum = areas[i];
+			reachnum = 0;
+			if (!AAS_AreaRouteToGoalArea(startareanum, aasworld.areas[startareanum].center,
+								goalareanum, travelflags, &traveltime, &reachnum)) continue;
+			if (!traveltime) continue;
+			reach = &aasworld.reachability[reachnum];
+			//the leg from the origin to the reachability is added on lookup,
+			//portal areas are routed without it
+			if (aasworld.areasettings[startareanum].cluster > 0)
+			{
+				traveltime -= AAS_AreaTravelTime(startareanum, aasworld.areas[startareanum].center, reach->start);
+				if (traveltime < 1) traveltime = 1;
+			} //end if
+			table->traveltimes[i * n + j] = traveltime;
+			table->reachabilities[i * n + j] = reachnum - aasworld.areasettings[startareanum].firstreachablearea;
+		} //end for
+	} //end for
+	FreeMemory(areas);
+	return table;
+} //end of the function AAS_CreateRouteTable
+//===========================================================================
+// builds the tables that aren't there yet and fit in max_routetablesize
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_CreateRouteTables(void)
+{
+	int i, size, maxsize, used, initialized, starttime;
+	aas_routetable_t *table;
+
+	if (aasworld.numdisabledareas || !aasworld.numroutetableareas) return;
+	//
+	size = sizeof(aas_routetable_t) + AAS_RouteTableSize();
+	maxsize = AAS_MaxRouteTableSize();
+	used = 0;
+	for (table = aasworld.routetables; table; table = table->next) used += size;
+	//
+	starttime = Sys_MilliSeconds();
+	initialized = aasworld.initialized;
+	aasworld.initialized = qtrue;
+	for (i = 0; i < ARRAY_LEN(aas_routetableflags); i++)
+	{
+		if (AAS_RouteTable(aas_routetableflags[i])) continue;
+		//leave room for the routing cache of the other travel flags
+		if (used + size > maxsize || AvailableMemory() < size + 2 * 1024 * 1024)
+		{
+			botimport.Print(PRT_MESSAGE, "%d areas are too many for more routing tables\n", aasworld.numroutetableareas);
+			break;
+		} //end if
+		AAS_LinkRouteTable(AAS_CreateRouteTable(aas_routetableflags[i]));
+		used += size;
+	} //end for
+	aasworld.initialized = initialized;
+	botimport.Print(PRT_MESSAGE, "routing tables for %d areas, %d KB in %d msec\n",
+						aasworld.numroutetableareas, used >> 10, Sys_MilliSeconds() - starttime);
+} //end of the function AAS_CreateRouteTables
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -916,7 +1181,8 @@ void AAS_CreateAllRoutingCache(void)
 
 //the route cache header
 //this header is followed by numportalcache + numareacache aas_routingcache_t
-//structures that store routing cache
+//structures that store routing cache, since version 3 followed by a
+//routetableheader_t and the routing tables
 typedef struct routecacheheader_s
 {
 	int ident;
@@ -929,8 +1195,17 @@ typedef struct routecacheheader_s
 	int numareacache;
 } routecacheheader_t;
 
+//header of the routing tables, each is stored as its travel flags followed
+//by the travel times and the reachabilities
+typedef struct routetableheader_s
+{
+	int numroutetables;
+	int numroutetableareas;
+} routetableheader_t;
+
 #define RCID						(('C'<<24)+('R'<<16)+('E'<<8)+'M')
-#define RCVERSION					2
+#define RCVERSION					3
+#define RCVERSION_NOTABLES			2
 
 //void AAS_DecompressVis(byte *in, int numareas, byte *decompressed);
 //int AAS_CompressVis(byte *vis, int numareas, byte *dest);
@@ -943,6 +1218,8 @@ void AAS_WriteRouteCache(void)
 	fileHandle_t fp;
 	char filename[MAX_QPATH];
 	routecacheheader_t routecacheheader;
+	routetableheader_t routetableheader;
+	aas_routetable_t *table;
 
 	numportalcache = 0;
 	for (i = 0; i < aasworld.numareas; i++)
@@ -1006,6 +1283,20 @@ void AAS_WriteRouteCache(void)
 			} //end for
 		} //end for
 	} //end for
+	//write the routing tables
+	routetableheader.numroutetables = 0;
+	for (table = aasworld.routetables; table; table = table->next)
+	{
+		routetableheader.numroutetables++;
+	} //end for
+	routetableheader.numroutetableareas = aasworld.numroutetableareas;
+	botimport.FS_Write(&routetableheader, sizeof(routetableheader_t), fp);
+	for (table = aasworld.routetables; table; table = table->next)
+	{
+		botimport.FS_Write(&table->travelflags, sizeof(int), fp);
+		botimport.FS_Write(table->traveltimes, AAS_RouteTableSize(), fp);
+		totalsize += AAS_RouteTableSize();
+	} //end for
 	// write the visareas
 	/*
 	for (i = 0; i < aasworld.numareas; i++)
@@ -1053,11 +1344,13 @@ aas_routingcache_t *AAS_ReadCache(fileHandle_t fp)
 //===========================================================================
 int AAS_ReadRouteCache(void)
 {
-	int i, clusterareanum;//, size;
+	int i, clusterareanum, travelflags, size, used;
 	fileHandle_t fp;
 	char filename[MAX_QPATH];
 	routecacheheader_t routecacheheader;
+	routetableheader_t routetableheader;
 	aas_routingcache_t *cache;
+	aas_routetable_t *table;
 
 	Com_sprintf(filename, MAX_QPATH, "maps/%s.rcd", aasworld.mapname);
 	botimport.FS_FOpenFile( filename, &fp, FS_READ );
@@ -1071,7 +1364,7 @@ int AAS_ReadRouteCache(void)
 		AAS_Error("%s is not a route cache dump\n", filename);
 		return qfalse;
 	} //end if
-	if (routecacheheader.version != RCVERSION)
+	if (routecacheheader.version != RCVERSION && routecacheheader.version != RCVERSION_NOTABLES)
 	{
 		AAS_Error("route cache dump has wrong version %d, should be %d\n", routecacheheader.version, RCVERSION);
 		return qfalse;
@@ -1119,6 +1412,30 @@ int AAS_ReadRouteCache(void)
 			aasworld.clusterareacache[cache->cluster][clusterareanum]->prev = cache;
 		aasworld.clusterareacache[cache->cluster][clusterareanum] = cache;
 	} //end for
+	//read the routing tables
+	if (routecacheheader.version >= RCVERSION)
+	{
+		botimport.FS_Read(&routetableheader, sizeof(routetableheader_t), fp);
+		//a damaged file must not get more or bigger tables than
+		//AAS_CreateRouteTables would build
+		if (routetableheader.numroutetableareas == aasworld.numroutetableareas &&
+			routetableheader.numroutetables >= 0 &&
+			routetableheader.numroutetables <= (int) ARRAY_LEN(aas_routetableflags))
+		{
+			size = sizeof(aas_routetable_t) + AAS_RouteTableSize();
+			used = 0;
+			for (i = 0; i < routetableheader.numroutetables; i++)
+			{
+				botimport.FS_Read(&travelflags, sizeof(int), fp);
+				if (!AAS_RouteTableMissing(travelflags)) break;
+				if (used + size > AAS_MaxRouteTableSize()) break;
+				used += size;
+				table = AAS_AllocRouteTable(travelflags);
+				botimport.FS_Read(table->traveltimes, AAS_RouteTableSize(), fp);
+				AAS_LinkRouteTable(table);
+			} //end for
+		} //end if
+	} //end if
 	// read the visareas
 	/*
 	aasworld.areavisibility = (byte **) GetClearedMemory(aasworld.numareas * sizeof(byte *));
@@ -1218,6 +1535,8 @@ void AAS_InitReachabilityAreas(void)
 //===========================================================================
 void AAS_InitRouting(void)
 {
+	int i;
+
 	AAS_InitTravelFlagFromType();
 	//
 	AAS_InitAreaContentsTravelFlags();
@@ -1243,8 +1562,22 @@ void AAS_InitRouting(void)
 	//
 	routingcachesize = 0;
 	max_routingcachesize = 1024 * (int) LibVarValue("max_routingcache", "4096");
+	//number the areas of the routing tables
+	AAS_InitRouteTableIndex();
+	aasworld.numdisabledareas = 0;
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (aasworld.areasettings[i].areaflags & AREA_DISABLED) aasworld.numdisabledareas++;
+	} //end for
 	// read any routing cache if available
 	AAS_ReadRouteCache();
+	//build the routing tables that weren't in the cache
+	if ((int) LibVarValue("routetables", "0"))
+	{
+		AAS_CreateRouteTables();
+	} //end if
+	//build the rest of the routing cache in the background
+	AAS_StartRoutingCacheWarming();
 } //end of the function AAS_InitRouting
 //===========================================================================
 //
@@ -1254,10 +1587,16 @@ void AAS_InitRouting(void)
 //===========================================================================
 void AAS_FreeRoutingCaches(void)
 {
+	// stop building cache before freeing what it is built from
+	AAS_StopRoutingCacheWarming();
 	// free all the existing cluster area cache
 	AAS_FreeAllClusterAreaCache();
 	// free all the existing portal cache
 	AAS_FreeAllPortalCache();
+	// free the routing tables
+	AAS_FreeRouteTables();
+	if (aasworld.routetableindex) FreeMemory(aasworld.routetableindex);
+	aasworld.routetableindex = NULL;
 	// free cached travel times within areas
 	if (aasworld.areatraveltimes) FreeMemory(aasworld.areatraveltimes);
 	aasworld.areatraveltimes = NULL;
@@ -1283,13 +1622,15 @@ void AAS_FreeRoutingCaches(void)
 	aasworld.areacontentstravelflags = NULL;
 } //end of the function AAS_FreeRoutingCaches
 //===========================================================================
-// update the given routing cache
+// fill the given routing cache, the update fields are passed in so the
+// routing cache warming thread can use its own
 //
-// Parameter:			areacache		: routing cache to update
+// Parameter:			areacache		: routing cache to fill
+//						areaupdate		: routing update fields
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
+static void AAS_FloodAreaRoutingCache(aas_routingcache_t *areacache, aas_routingupdate_t *areaupdate)
 {
 	int i, nextareanum, cluster, badtravelflags, clusterareanum, linknum;
 	int numreachabilityareas;
@@ -1299,13 +1640,8 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 	aas_reversedreachability_t *revreach;
 	aas_reversedlink_t *revlink;
 
-#ifdef ROUTING_DEBUG
-	numareacacheupdates++;
-#endif //ROUTING_DEBUG
 	//number of reachability areas within this cluster
 	numreachabilityareas = aasworld.clusters[areacache->cluster].numreachabilityareas;
-	//
-	aasworld.frameroutingupdates++;
 	//clear the routing update fields
 //	memset(aasworld.areaupdate, 0, aasworld.numareas * sizeof(aas_routingupdate_t));
 	//
@@ -1316,7 +1652,7 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 	//
 	memset(startareatraveltimes, 0, sizeof(startareatraveltimes));
 	//
-	curupdate = &aasworld.areaupdate[clusterareanum];
+	curupdate = &areaupdate[clusterareanum];
 	curupdate->areanum = areacache->areanum;
 	//VectorCopy(areacache->origin, curupdate->start);
 	curupdate->areatraveltimes = startareatraveltimes;
@@ -1372,7 +1708,7 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 			{
 				areacache->traveltimes[clusterareanum] = t;
 				areacache->reachabilities[clusterareanum] = linknum - aasworld.areasettings[nextareanum].firstreachablearea;
-				nextupdate = &aasworld.areaupdate[clusterareanum];
+				nextupdate = &areaupdate[clusterareanum];
 				nextupdate->areanum = nextareanum;
 				nextupdate->tmptraveltime = t;
 				//VectorCopy(reach->start, nextupdate->start);
@@ -1393,6 +1729,22 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 			} //end if
 		} //end for
 	} //end while
+} //end of the function AAS_FloodAreaRoutingCache
+//===========================================================================
+// update the given routing cache
+//
+// Parameter:			areacache		: routing cache to update
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
+{
+#ifdef ROUTING_DEBUG
+	numareacacheupdates++;
+#endif //ROUTING_DEBUG
+	//
+	aasworld.frameroutingupdates++;
+	AAS_FloodAreaRoutingCache(areacache, aasworld.areaupdate);
 } //end of the function AAS_UpdateAreaRoutingCache
 //===========================================================================
 //
@@ -1581,6 +1933,278 @@ aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int t
 	return cache;
 } //end of the function AAS_GetPortalRoutingCache
 //===========================================================================
+// routing cache warming
+//
+// A background thread builds area routing cache before the bots ask for
+// it, first towards the cluster portals, which every route leaving a
+// cluster goes through, then towards the other reachability areas, for
+// the travel flags of the routing tables.  The thread only reads the AAS
+// data and uses its own routing update fields.  It fills in caches the bot
+// thread allocated along with the job, GetMemory and FreeMemory keep
+// statistics that aren't thread safe.  The built caches are handed back
+// through a ring and linked in at the start of the frame, so the lookups
+// never take a lock.  When an area is enabled or disabled the
+// caches still in the ring are thrown away and the warming starts over.
+//===========================================================================
+
+#define MAX_ROUTINGWARMJOBS		64		//jobs in flight, must be a power of two
+
+typedef struct aas_routingwarmjob_s
+{
+	int cluster;
+	int areanum;
+	int travelflags;
+	int generation;
+} aas_routingwarmjob_t;
+
+typedef struct aas_routingwarm_s
+{
+	void *thread;
+	void *wake;							//one post for every job
+	volatile int quit;
+	aas_routingupdate_t *areaupdate;	//routing update fields of the thread
+	aas_routingwarmjob_t jobs[MAX_ROUTINGWARMJOBS];
+	aas_routingcache_t *caches[MAX_ROUTINGWARMJOBS];	//allocated when the job is queued
+	volatile int numbuilt;				//written by the warming thread
+	//only used by the bot thread
+	int numjobs;
+	int numlinked;
+	int cursor;							//next job to consider
+	int generation;						//changes when an area is enabled or disabled
+} aas_routingwarm_t;
+
+static aas_routingwarm_t routingwarm;
+
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_RoutingWarmThread(void *arg)
+{
+	int i;
+	aas_routingwarmjob_t *job;
+	aas_routingcache_t *cache;
+
+	for (i = 0; ; i++)
+	{
+		botimport.SemaphoreWait(routingwarm.wake);
+		if (routingwarm.quit) break;
+		//
+		job = &routingwarm.jobs[i & (MAX_ROUTINGWARMJOBS-1)];
+		cache = routingwarm.caches[i & (MAX_ROUTINGWARMJOBS-1)];
+		cache->cluster = job->cluster;
+		cache->areanum = job->areanum;
+		VectorCopy(aasworld.areas[job->areanum].center, cache->origin);
+		cache->starttraveltime = 1;
+		cache->travelflags = job->travelflags;
+		cache->type = CACHETYPE_AREA;
+		AAS_FloodAreaRoutingCache(cache, routingwarm.areaupdate);
+		//
+		botimport.AtomicAdd(&routingwarm.numbuilt, 1);
+	} //end for
+} //end of the function AAS_RoutingWarmThread
+//===========================================================================
+// returns the area routing cache with the given travel flags if it exists
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static aas_routingcache_t *AAS_FindAreaRoutingCache(int clusternum, int clusterareanum, int travelflags)
+{
+	aas_routingcache_t *cache;
+
+	for (cache = aasworld.clusterareacache[clusternum][clusterareanum]; cache; cache = cache->next)
+	{
+		if (cache->travelflags == travelflags) break;
+	} //end for
+	return cache;
+} //end of the function AAS_FindAreaRoutingCache
+//===========================================================================
+// the jobs for one set of travel flags are every cluster portal once for
+// each side and then every area
+//
+// Parameter:			job			: filled in with the next cache to build
+// Returns:				qfalse when there is nothing left to build
+// Changes Globals:		-
+//===========================================================================
+static int AAS_NextRoutingWarmJob(aas_routingwarmjob_t *job)
+{
+	int n, jobsperflags, clusterareanum;
+	aas_portal_t *portal;
+
+	jobsperflags = 2 * aasworld.numportals + aasworld.numareas;
+	while (routingwarm.cursor < jobsperflags * (int) ARRAY_LEN(aas_routetableflags))
+	{
+		n = routingwarm.cursor % jobsperflags;
+		job->travelflags = aas_routetableflags[routingwarm.cursor / jobsperflags];
+		routingwarm.cursor++;
+		//lookups with these travel flags use the routing tables
+		if (!aasworld.numdisabledareas && AAS_RouteTable(job->travelflags)) continue;
+		//
+		if (n < 2 * aasworld.numportals)
+		{
+			portal = &aasworld.portals[n >> 1];
+			if (!portal->areanum) continue;
+			if ((n & 1) && portal->backcluster == portal->frontcluster) continue;
+			job->areanum = portal->areanum;
+			job->cluster = (n & 1) ? portal->backcluster : portal->frontcluster;
+		} //end if
+		else
+		{
+			job->areanum = n - 2 * aasworld.numportals;
+			job->cluster = aasworld.areasettings[job->areanum].cluster;
+			//portal areas were done above
+			if (job->cluster <= 0) continue;
+			if (!AAS_AreaReachability(job->areanum)) continue;
+		} //end else
+		if (job->cluster <= 0) continue;
+		//only the reachability areas of a cluster have travel times
+		clusterareanum = AAS_ClusterAreaNum(job->cluster, job->areanum);
+		if (clusterareanum >= aasworld.clusters[job->cluster].numreachabilityareas) continue;
+		//the bots may have needed this cache already
+		if (AAS_FindAreaRoutingCache(job->cluster, clusterareanum, job->travelflags)) continue;
+		//
+		job->generation = routingwarm.generation;
+		return qtrue;
+	} //end while
+	return qfalse;
+} //end of the function AAS_NextRoutingWarmJob
+//===========================================================================
+// links in the caches the warming thread built and hands it new jobs,
+// called at the start of every frame
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_ContinueRoutingCacheWarming(void)
+{
+	int i, numbuilt, clusterareanum;
+	aas_routingwarmjob_t *job;
+	aas_routingcache_t *cache, *clustercache;
+
+	if (!routingwarm.thread) return;
+	//
+	numbuilt = botimport.AtomicAdd(&routingwarm.numbuilt, 0);
+	for (; routingwarm.numlinked < numbuilt; routingwarm.numlinked++)
+	{
+		i = routingwarm.numlinked & (MAX_ROUTINGWARMJOBS-1);
+		job = &routingwarm.jobs[i];
+		cache = routingwarm.caches[i];
+		//built before an area was enabled or disabled
+		if (job->generation != routingwarm.generation)
+		{
+			FreeMemory(cache);
+			continue;
+		} //end if
+		clusterareanum = AAS_ClusterAreaNum(cache->cluster, cache->areanum);
+		//the bots built the same cache in the meantime
+		if (AAS_FindAreaRoutingCache(cache->cluster, clusterareanum, cache->travelflags))
+		{
+			FreeMemory(cache);
+			continue;
+		} //end if
+		clustercache = aasworld.clusterareacache[cache->cluster][clusterareanum];
+		cache->prev = NULL;
+		cache->next = clustercache;
+		if (clustercache) clustercache->prev = cache;
+		aasworld.clusterareacache[cache->cluster][clusterareanum] = cache;
+		routingcachesize += cache->size;
+		cache->time = AAS_RoutingTime();
+		AAS_LinkCache(cache);
+	} //end for
+	//keep the thread busy while the cache may grow
+	while (routingwarm.numjobs - routingwarm.numlinked < MAX_ROUTINGWARMJOBS)
+	{
+		if (routingcachesize >= max_routingcachesize) break;
+		if (AvailableMemory() < 2 * 1024 * 1024) break;
+		i = routingwarm.numjobs & (MAX_ROUTINGWARMJOBS-1);
+		job = &routingwarm.jobs[i];
+		if (!AAS_NextRoutingWarmJob(job)) break;
+		routingwarm.caches[i] = AAS_NewRoutingCache(aasworld.clusters[job->cluster].numreachabilityareas);
+		routingwarm.numjobs++;
+		botimport.SemaphorePost(routingwarm.wake, 1);
+	} //end while
+} //end of the function AAS_ContinueRoutingCacheWarming
+//===========================================================================
+// throws away the caches that are being built and starts over, called
+// when an area is enabled or disabled
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_RestartRoutingCacheWarming(void)
+{
+	routingwarm.generation++;
+	routingwarm.cursor = 0;
+} //end of the function AAS_RestartRoutingCacheWarming
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_StopRoutingCacheWarming(void)
+{
+	int i;
+
+	if (!routingwarm.thread) return;
+	//
+	routingwarm.quit = qtrue;
+	botimport.SemaphorePost(routingwarm.wake, 1);
+	botimport.JoinThread(routingwarm.thread);
+	botimport.DestroySemaphore(routingwarm.wake);
+	//free the caches that were never linked, built or not
+	for (i = routingwarm.numlinked; i < routingwarm.numjobs; i++)
+	{
+		FreeMemory(routingwarm.caches[i & (MAX_ROUTINGWARMJOBS-1)]);
+	} //end for
+	FreeMemory(routingwarm.areaupdate);
+	memset(&routingwarm, 0, sizeof(aas_routingwarm_t));
+} //end of the function AAS_StopRoutingCacheWarming
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_StartRoutingCacheWarming(void)
+{
+	int i, maxreachabilityareas;
+
+	AAS_StopRoutingCacheWarming();
+	//
+	if (!(int) LibVarValue("warmroutingcache", "1")) return;
+	//the host may not have threads
+	if (!botimport.CreateThread) return;
+	//
+	maxreachabilityareas = 0;
+	for (i = 0; i < aasworld.numclusters; i++)
+	{
+		if (aasworld.clusters[i].numreachabilityareas > maxreachabilityareas)
+		{
+			maxreachabilityareas = aasworld.clusters[i].numreachabilityareas;
+		} //end if
+	} //end for
+	routingwarm.areaupdate = (aas_routingupdate_t *) GetClearedMemory(
+									maxreachabilityareas * sizeof(aas_routingupdate_t));
+	//
+	routingwarm.wake = botimport.CreateSemaphore(0);
+	if (routingwarm.wake)
+	{
+		routingwarm.thread = botimport.CreateThread(AAS_RoutingWarmThread, NULL);
+		if (routingwarm.thread) return;
+		botimport.DestroySemaphore(routingwarm.wake);
+	} //end if
+	botimport.Print(PRT_WARNING, "couldn't start the routing cache warming thread\n");
+	FreeMemory(routingwarm.areaupdate);
+	memset(&routingwarm, 0, sizeof(aas_routingwarm_t));
+} //end of the function AAS_StartRoutingCacheWarming
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -1588,12 +2212,13 @@ aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int t
 //===========================================================================
 int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime, int *reachnum)
 {
-	int clusternum, goalclusternum, portalnum, i, clusterareanum, bestreachnum;
+	int clusternum, goalclusternum, portalnum, i, clusterareanum, bestreachnum, startindex, goalindex;
 	unsigned short int t, besttime;
 	aas_portal_t *portal;
 	aas_cluster_t *cluster;
 	aas_routingcache_t *areacache, *portalcache;
 	aas_reachability_t *reach;
+	aas_routetable_t *table;
 
 	if (!aasworld.initialized) return qfalse;
 
@@ -1620,6 +2245,21 @@ int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int tra
 		} //end if
 		return qfalse;
 	} //end if
+	//look up the route in the routing tables if there are any
+	startindex = aasworld.routetableindex[areanum];
+	goalindex = aasworld.routetableindex[goalareanum];
+	if (startindex >= 0 && goalindex >= 0 && (table = AAS_RouteTable(travelflags)) != NULL)
+	{
+		i = startindex * aasworld.numroutetableareas + goalindex;
+		if (!table->traveltimes[i]) return qfalse;
+		*reachnum = aasworld.areasettings[areanum].firstreachablearea + table->reachabilities[i];
+		*traveltime = table->traveltimes[i];
+		if (origin && aasworld.areasettings[areanum].cluster > 0)
+		{
+			*traveltime += AAS_AreaTravelTime(areanum, origin, aasworld.reachability[*reachnum].start);
+		} //end if
+		return qtrue;
+	} //end if
 	// make sure the routing cache doesn't grow to large
 	while(AvailableMemory() < 1 * 1024 * 1024) {
 		if (!AAS_FreeOldestCache()) break;
@@ -38,7 +38,12 @@ void AAS_FreeRoutingCaches(void);
 unsigned short int AAS_AreaTravelTime(int areanum, vec3_t start, vec3_t end);
 //
 void AAS_CreateAllRoutingCache(void);
+void AAS_CreateRouteTables(void);
 void AAS_WriteRouteCache(void);
+//background thread filling the routing cache
+void AAS_StartRoutingCacheWarming(void);
+void AAS_StopRoutingCacheWarming(void);
+void AAS_ContinueRoutingCacheWarming(void);
 //
 void AAS_RoutingInfo(void);
 #endif //AASINTERN
@@ -59,6 +64,8 @@ int AAS_EnableRoutingArea(int areanum, int enable);
 unsigned short int AAS_AreaTravelTime(int areanum, vec3_t start, vec3_t end);
 //returns the travel time from the area to the goal area using the given travel flags
 int AAS_AreaTravelTimeToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags);
+//returns the travel time and the reachability to use towards the goal area
+int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime, int *reachnum);
 //predict a route up to a stop event
 int AAS_PredictRoute(struct aas_predictroute_s *route, int areanum, vec3_t origin,
 							int goalareanum, int travelflags, int maxareas, int maxtime,
@@ -190,6 +190,14 @@ typedef struct botlib_import_s
 	void		(*FreeMemory)(void *ptr);		// free memory from Zone
 	int			(*AvailableMemory)(void);		// available Zone memory
 	void		*(*HunkAlloc)(int size);		// allocate from hunk
+	//background threads, all NULL when there are none
+	void		*(*CreateThread)(void (*func)(void *arg), void *arg);
+	void		(*JoinThread)(void *thread);
+	void		*(*CreateSemaphore)(int count);
+	void		(*DestroySemaphore)(void *sem);
+	void		(*SemaphoreWait)(void *sem);
+	void		(*SemaphorePost)(void *sem, int count);
+	int			(*AtomicAdd)(volatile int *value, int add);	// returns the new value, full barrier
 	//file system access
 	int			(*FS_FOpenFile)( const char *qpath, fileHandle_t *file, fsMode_t mode );
 	int			(*FS_Read)( void *buffer, int len, fileHandle_t f );
@@ -485,6 +493,9 @@ name:						default:			module(s):			description:
 
 "max_aaslinks"				"4096"				be_aas_sample.c		maximum links in the AAS
 "max_routingcache"			"4096"				be_aas_route.c		maximum routing cache size in KB
+"routetables"				"0"					be_aas_route.c		build all pairs routing tables on map load
+"max_routetablesize"		"4096"				be_aas_route.c		maximum size of the routing tables in KB
+"warmroutingcache"			"1"					be_aas_route.c		build routing cache in a background thread
 "forceclustering"			"0"					be_aas_main.c		force recalculation of clusters
 "forcereachability"			"0"					be_aas_main.c		force recalculation of reachabilities
 "forcewrite"				"0"					be_aas_main.c		force writing of aas file
@@ -833,7 +833,7 @@ qboolean CL_GameCommand( void )
 
 void CL_CGameRendering(void)
 {
-	VM_Call( cgvm, CG_DRAW_ACTIVE_FRAME, cl.serverTime, 0, clc.demoplaying );
+	VM_Call3( cgvm, CG_DRAW_ACTIVE_FRAME, cl.serverTime, 0, clc.demoplaying );
 	VM_Debug( 0 );
 }
 
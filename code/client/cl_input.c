@@ -389,11 +389,11 @@ void CL_MouseEvent(int dx, int dy, int time)
 {
 	if( Key_GetCatcher() & KEYCATCH_UI )
     {
-		VM_Call( uivm, UI_MOUSE_EVENT, dx, dy );
+		VM_Call2( uivm, UI_MOUSE_EVENT, dx, dy );
 	}
     else if (Key_GetCatcher() & KEYCATCH_CGAME)
     {
-		VM_Call (cgvm, CG_MOUSE_EVENT, dx, dy);
+		VM_Call2( cgvm, CG_MOUSE_EVENT, dx, dy );
 	}
     else
     {
@@ -3255,6 +3255,8 @@ void CL_InitRef(void)
 	ri.FS_ListFiles = FS_ListFiles;
 	ri.FS_FileIsInPAK = FS_FileIsInPAK;
 	ri.FS_FileExists = FS_FileExists;
+	ri.FS_ReadPrivateFile = FS_SV_ReadPrivateFile;
+	ri.FS_WritePrivateFile = FS_SV_WritePrivateFile;
 	ri.Cvar_Get = Cvar_Get;
 	ri.Cvar_Set = Cvar_Set;
 	ri.Cvar_SetValue = Cvar_SetValue;
@@ -3290,6 +3292,13 @@ void CL_InitRef(void)
 	// ri.Sys_SetEnv = Sys_SetEnv;
 	ri.Sys_LowPhysicalMemory = Sys_LowPhysicalMemory;
 
+	ri.Sys_CreateThread = Sys_CreateThread;
+	ri.Sys_JoinThread = Sys_JoinThread;
+	ri.Sys_CreateSemaphore = Sys_CreateSemaphore;
+	ri.Sys_DestroySemaphore = Sys_DestroySemaphore;
+	ri.Sys_SemaphoreWait = Sys_SemaphoreWait;
+	ri.Sys_SemaphorePost = Sys_SemaphorePost;
+
 	GetRefAPI( REF_API_VERSION, &ri, &re);
 
 
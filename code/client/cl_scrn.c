@@ -471,7 +471,7 @@ static void SCR_DrawScreenField(void)
     // but keep the ABI / interface consistent ...
 	re.BeginFrame( 0 );
 
-	qboolean uiFullscreen = (uivm && VM_Call( uivm, UI_IS_FULLSCREEN ));
+	qboolean uiFullscreen = (uivm && VM_Call0( uivm, UI_IS_FULLSCREEN ));
 
 	// wide aspect ratio screens need to have the sides cleared
 	// unless they are displaying game renderings
@@ -508,7 +508,7 @@ static void SCR_DrawScreenField(void)
 		case CA_CONNECTED:
 			// connecting clients will only show the connection dialog
 			// refresh to update the time
-			VM_Call( uivm, UI_REFRESH, cls.realtime );
+			VM_Call1( uivm, UI_REFRESH, cls.realtime );
 			VM_Call( uivm, UI_DRAW_CONNECT_SCREEN, qfalse );
 			break;
 		case CA_LOADING:
@@ -519,7 +519,7 @@ static void SCR_DrawScreenField(void)
 			// also draw the connection information, so it doesn't
 			// flash away too briefly on local or lan games
 			// refresh to update the time
-			VM_Call( uivm, UI_REFRESH, cls.realtime );
+			VM_Call1( uivm, UI_REFRESH, cls.realtime );
 			VM_Call( uivm, UI_DRAW_CONNECT_SCREEN, qtrue );
 			break;
 		case CA_ACTIVE:
@@ -535,7 +535,7 @@ static void SCR_DrawScreenField(void)
 
 	// the menu draws next
 	if ( Key_GetCatcher( ) & KEYCATCH_UI && uivm ) {
-		VM_Call( uivm, UI_REFRESH, cls.realtime );
+		VM_Call1( uivm, UI_REFRESH, cls.realtime );
 	}
 
 	// console draws next
@@ -77,6 +77,7 @@ int			s_numSfx = 0;
 static	sfx_t		*sfxHash[LOOP_HASH];
 
 cvar_t		*s_testsound;
+cvar_t		*s_mixSIMD;
 cvar_t		*s_show;
 cvar_t		*s_mixahead;
 cvar_t		*s_mixPreStep;
@@ -1556,6 +1557,7 @@ void S_Base_Shutdown( void ) {
 	s_numSfx = 0;
 
 	Cmd_RemoveCommand("s_info");
+	Cmd_RemoveCommand("s_mixbench");
 }
 
 /*
@@ -1574,6 +1576,7 @@ qboolean S_Base_Init( soundInterface_t *si ) {
 	s_mixPreStep = Cvar_Get ("s_mixPreStep", "0.05", CVAR_ARCHIVE);
 	s_show = Cvar_Get ("s_show", "0", CVAR_CHEAT);
 	s_testsound = Cvar_Get ("s_testsound", "0", CVAR_CHEAT);
+	s_mixSIMD = Cvar_Get ("s_mixSIMD", "1", CVAR_ARCHIVE);
 
 	r = SNDDMA_Init();
 
@@ -1588,6 +1591,8 @@ qboolean S_Base_Init( soundInterface_t *si ) {
 		s_paintedtime = 0;
 
 		S_Base_StopAllSounds( );
+
+		Cmd_AddCommand("s_mixbench", S_MixBenchmark_f);
 	} else {
 		return qfalse;
 	}
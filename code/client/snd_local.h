@@ -210,6 +210,7 @@ extern cvar_t *s_muted;
 extern cvar_t *s_doppler;
 
 extern cvar_t *s_testsound;
+extern cvar_t *s_mixSIMD;
 
 qboolean S_LoadSound( sfx_t *sfx );
 
@@ -219,6 +220,7 @@ void		SND_setup( void );
 void		SND_shutdown(void);
 
 void S_PaintChannels(int endtime);
+void S_MixBenchmark_f(void);
 
 void S_memoryLoad(sfx_t *sfx);
 
@@ -23,9 +23,19 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "client.h"
 #include "snd_local.h"
+#include "../platform/sys_public.h"
+
+// SSE2 is always there on x86-64, 32 bit builds need it enabled
+#if idx64 || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SND_SIMD 1
+#include <emmintrin.h>
+#else
+#define SND_SIMD 0
+#endif
 
 static portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE];
 static int snd_vol;
+static int snd_simd;
 
 static int*     snd_p;  
 static int      snd_linear_count;
@@ -35,10 +45,24 @@ static short*   snd_out;
 
 void S_WriteLinearBlastStereo16 (void)
 {
-	int		i;
+	int		i = 0;
 	int		val;
 
-	for (i=0 ; i<snd_linear_count ; i+=2)
+#if SND_SIMD
+	if (snd_simd)
+	{
+		// the saturating pack clamps just like the code below
+		for ( ; i+8<=snd_linear_count ; i+=8)
+		{
+			__m128i	a = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(snd_p + i)), 8);
+			__m128i	b = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(snd_p + i + 4)), 8);
+
+			_mm_storeu_si128((__m128i *)(snd_out + i), _mm_packs_epi32(a, b));
+		}
+	}
+#endif
+
+	for ( ; i<snd_linear_count ; i+=2)
 	{
 		val = snd_p[i]>>8;
 		if (val > 0x7fff)
@@ -237,9 +261,193 @@ CHANNEL MIXING
 ===============================================================================
 */
 
+/*
+Plain 16 bit channels are not mixed one at a time.  They are queued as
+mix sources and mixed MAX_MIX_SOURCES at a time, so the paint buffer is
+read and written once for all of them.  A pass runs up to where the
+first of its sources reaches the end of a chunk or of its sound.
+*/
+
+#define	MAX_MIX_SOURCES		4
+
+typedef struct {
+	const sfx_t		*sfx;
+	sndBuffer		*chunk;
+	const short		*samples;		// next sample frame in chunk
+	int				avail;			// sample frames left in chunk
+	int				count;			// sample frames left to paint
+	int				stereo;
+	int				leftvol;
+	int				rightvol;
+} mixSource_t;
+
+static mixSource_t	mixSources[MAX_MIX_SOURCES];
+static int			numMixSources;
+static int			mixBufferOffset;
+
+static void S_MixFrames( portable_samplepair_t *samp, const mixSource_t *src, int numSources, int first, int count ) {
+	int		i, s, data;
+
+	for ( i = first ; i < count ; i++ ) {
+		for ( s = 0 ; s < numSources ; s++ ) {
+			if ( src[s].stereo ) {
+				samp[i].left += (src[s].samples[i*2] * src[s].leftvol)>>8;
+				samp[i].right += (src[s].samples[i*2+1] * src[s].rightvol)>>8;
+			} else {
+				data = src[s].samples[i];
+				samp[i].left += (data * src[s].leftvol)>>8;
+				samp[i].right += (data * src[s].rightvol)>>8;
+			}
+		}
+	}
+}
+
+#if SND_SIMD
+/*
+pmaddwd does a sample times a volume of up to 65534 exactly, with the
+volume split in two halves that each fit a short, and puts the left and
+right products next to each other like in portable_samplepair_t
+*/
+static void S_MixFramesSIMD( portable_samplepair_t *samp, const mixSource_t *src, int numSources, int count ) {
+	__m128i		vol[MAX_MIX_SOURCES];
+	__m128i		lo, hi, d, a, b;
+	int			i, s, l, r;
+
+	for ( s = 0 ; s < numSources ; s++ ) {
+		l = src[s].leftvol;
+		r = src[s].rightvol;
+		vol[s] = _mm_set_epi16( r - r/2, r/2, l - l/2, l/2, r - r/2, r/2, l - l/2, l/2 );
+	}
+
+	for ( i = 0 ; i + 4 <= count ; i += 4 ) {
+		lo = _mm_loadu_si128( (const __m128i *)&samp[i] );
+		hi = _mm_loadu_si128( (const __m128i *)&samp[i+2] );
+
+		for ( s = 0 ; s < numSources ; s++ ) {
+			if ( src[s].stereo ) {
+				// l0 r0 l1 r1 l2 r2 l3 r3
+				d = _mm_loadu_si128( (const __m128i *)(src[s].samples + i*2) );
+				a = _mm_unpacklo_epi16( d, d );
+				b = _mm_unpackhi_epi16( d, d );
+			} else {
+				// d0 d1 d2 d3
+				d = _mm_loadl_epi64( (const __m128i *)(src[s].samples + i) );
+				d = _mm_unpacklo_epi16( d, d );
+				a = _mm_unpacklo_epi32( d, d );
+				b = _mm_unpackhi_epi32( d, d );
+			}
+			lo = _mm_add_epi32( lo, _mm_srai_epi32( _mm_madd_epi16( a, vol[s] ), 8 ) );
+			hi = _mm_add_epi32( hi, _mm_srai_epi32( _mm_madd_epi16( b, vol[s] ), 8 ) );
+		}
+
+		_mm_storeu_si128( (__m128i *)&samp[i], lo );
+		_mm_storeu_si128( (__m128i *)&samp[i+2], hi );
+	}
+
+	S_MixFrames( samp, src, numSources, i, count );
+}
+#endif
+
+/*
+===================
+S_FlushMixSources
+
+Mixes the queued sources into the paint buffer
+===================
+*/
+static void S_FlushMixSources( void ) {
+	mixSource_t	*src;
+	int			i, n, pos, simd;
+
+	simd = 0;
+#if SND_SIMD
+	if ( snd_simd ) {
+		simd = 1;
+		for ( i = 0 ; i < numMixSources ; i++ ) {
+			if ( mixSources[i].leftvol < 0 || mixSources[i].leftvol > 0xfffe ||
+				mixSources[i].rightvol < 0 || mixSources[i].rightvol > 0xfffe ) {
+				simd = 0;
+			}
+		}
+	}
+#endif
+
+	pos = mixBufferOffset;
+
+	while ( numMixSources ) {
+		n = PAINTBUFFER_SIZE;
+		for ( i = 0 ; i < numMixSources ; i++ ) {
+			if ( mixSources[i].count < n ) {
+				n = mixSources[i].count;
+			}
+			if ( mixSources[i].avail < n ) {
+				n = mixSources[i].avail;
+			}
+		}
+
+#if SND_SIMD
+		if ( simd ) {
+			S_MixFramesSIMD( &paintbuffer[pos], mixSources, numMixSources, n );
+		} else
+#endif
+		S_MixFrames( &paintbuffer[pos], mixSources, numMixSources, 0, n );
+
+		pos += n;
+
+		for ( i = 0 ; i < numMixSources ; i++ ) {
+			src = &mixSources[i];
+			src->count -= n;
+			src->avail -= n;
+			src->samples += n << src->stereo;
+
+			if ( !src->count ) {
+				// done, the last source takes its place
+				*src = mixSources[--numMixSources];
+				i--;
+			} else if ( !src->avail ) {
+				src->chunk = src->chunk->next;
+				if ( !src->chunk ) {
+					src->chunk = src->sfx->soundData;
+				}
+				src->samples = src->chunk->sndChunk;
+				src->avail = SND_CHUNK_SIZE >> src->stereo;
+			}
+		}
+	}
+}
+
+/*
+===================
+S_QueueMixSource
+
+sampleOffset is in shorts and within chunk
+===================
+*/
+static void S_QueueMixSource( const sfx_t *sc, sndBuffer *chunk, int sampleOffset, int count, int bufferOffset, int leftvol, int rightvol ) {
+	mixSource_t	*src;
+
+	if ( numMixSources && bufferOffset != mixBufferOffset ) {
+		S_FlushMixSources();
+	}
+	mixBufferOffset = bufferOffset;
+
+	src = &mixSources[numMixSources++];
+	src->sfx = sc;
+	src->chunk = chunk;
+	src->samples = chunk->sndChunk + sampleOffset;
+	src->stereo = ( sc->soundChannels == 2 );
+	src->avail = ( SND_CHUNK_SIZE - sampleOffset ) >> src->stereo;
+	src->count = count;
+	src->leftvol = leftvol;
+	src->rightvol = rightvol;
+
+	if ( numMixSources == MAX_MIX_SOURCES ) {
+		S_FlushMixSources();
+	}
+}
+
 static void S_PaintChannelFrom16( channel_t *ch, const sfx_t *sc, int count, int sampleOffset, int bufferOffset ) {
-	int						data, aoff, boff;
-	int						leftvol, rightvol;
+	int						aoff, boff;
 	int						i, j;
 	portable_samplepair_t	*samp;
 	sndBuffer				*chunk;
@@ -274,24 +482,8 @@ static void S_PaintChannelFrom16( channel_t *ch, const sfx_t *sc, int count, int
 	}
 
 	if (!ch->doppler || ch->dopplerScale==1.0f) {
-		leftvol = ch->leftvol*snd_vol;
-		rightvol = ch->rightvol*snd_vol;
-		samples = chunk->sndChunk;
-		for ( i=0 ; i<count ; i++ ) {
-			data  = samples[sampleOffset++];
-			samp[i].left += (data * leftvol)>>8;
-
-			if ( sc->soundChannels == 2 ) {
-				data = samples[sampleOffset++];
-			}
-			samp[i].right += (data * rightvol)>>8;
-
-			if (sampleOffset == SND_CHUNK_SIZE) {
-				chunk = chunk->next;
-				samples = chunk->sndChunk;
-				sampleOffset = 0;
-			}
-		}
+		S_QueueMixSource( sc, chunk, sampleOffset, count, bufferOffset,
+			ch->leftvol*snd_vol, ch->rightvol*snd_vol );
 	} else {
 		fleftvol = ch->leftvol*snd_vol;
 		frightvol = ch->rightvol*snd_vol;
@@ -495,6 +687,8 @@ void S_PaintChannels( int endtime ) {
 	else
 		snd_vol = s_volume->value*255;
 
+	snd_simd = s_mixSIMD->integer;
+
 //Com_Printf ("%i to %i\n", s_paintedtime, endtime);
 	while ( s_paintedtime < endtime ) {
 		// if paintbuffer is smaller than DMA buffer
@@ -591,8 +785,116 @@ void S_PaintChannels( int endtime ) {
 			} while ( ltime < end);
 		}
 
+		S_FlushMixSources();
+
 		// transfer out according to DMA format
 		S_TransferPaintBuffer( end );
 		s_paintedtime = end;
 	}
 }
+
+/*
+===================
+S_MixBenchmark_f
+
+s_mixbench [channels] [seconds]
+
+Mixes channels synthetic 16 bit sounds, every other one stereo, for
+seconds of audio, with the scalar code and then with SIMD, and checks
+that both give the same samples
+===================
+*/
+#define	MIXBENCH_CHUNKS		32
+
+void S_MixBenchmark_f( void ) {
+	static short			out[PAINTBUFFER_SIZE*2];
+	sfx_t					sfx[2];
+	sndBuffer				*chunks;
+	int						numChannels, numFrames, speed;
+	int						pass, c, i, pos, end, offset, count;
+	unsigned				checksum[2];
+	int64_t					usec[2];
+
+	numChannels = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 96;
+	speed = dma.speed ? dma.speed : 22050;
+	numFrames = ( Cmd_Argc() > 2 ? atof( Cmd_Argv( 2 ) ) : 10.0f ) * speed;
+
+	if ( numChannels <= 0 || numFrames <= 0 ) {
+		Com_Printf( "usage: s_mixbench [channels] [seconds]\n" );
+		return;
+	}
+
+	// one mono and one stereo sound of noise
+	chunks = Z_Malloc( 2 * MIXBENCH_CHUNKS * sizeof( sndBuffer ) );
+	for ( i = 0 ; i < 2 * MIXBENCH_CHUNKS ; i++ ) {
+		for ( c = 0 ; c < SND_CHUNK_SIZE ; c++ ) {
+			chunks[i].sndChunk[c] = rand() - RAND_MAX/2;
+		}
+		chunks[i].next = ( i % MIXBENCH_CHUNKS == MIXBENCH_CHUNKS - 1 ) ? NULL : &chunks[i+1];
+	}
+	memset( sfx, 0, sizeof( sfx ) );
+	for ( i = 0 ; i < 2 ; i++ ) {
+		sfx[i].soundData = &chunks[i * MIXBENCH_CHUNKS];
+		sfx[i].soundChannels = i + 1;
+		sfx[i].soundLength = MIXBENCH_CHUNKS * SND_CHUNK_SIZE / sfx[i].soundChannels;
+	}
+
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		snd_simd = pass;
+		checksum[pass] = 0;
+		usec[pass] = Sys_Microseconds();
+
+		for ( pos = 0 ; pos < numFrames ; pos = end ) {
+			end = pos + PAINTBUFFER_SIZE;
+			if ( end > numFrames ) {
+				end = numFrames;
+			}
+
+			memset( paintbuffer, 0, sizeof( paintbuffer ) );
+
+			for ( c = 0 ; c < numChannels ; c++ ) {
+				const sfx_t	*sc = &sfx[c & 1];
+				int			ltime = pos;
+
+				// looped like loop_channels, at a phase of their own
+				do {
+					offset = ( ltime + c * 997 ) % sc->soundLength;
+					count = end - ltime;
+					if ( offset + count > sc->soundLength ) {
+						count = sc->soundLength - offset;
+					}
+					offset *= sc->soundChannels;
+					S_QueueMixSource( sc, sc->soundData + offset / SND_CHUNK_SIZE, offset % SND_CHUNK_SIZE,
+						count, ltime - pos, ( c * 37 & 255 ) * 255, ( c * 91 & 255 ) * 255 );
+					ltime += count;
+				} while ( ltime < end );
+			}
+			S_FlushMixSources();
+
+			snd_p = &paintbuffer[0].left;
+			snd_out = out;
+			snd_linear_count = ( end - pos ) * 2;
+			S_WriteLinearBlastStereo16();
+
+			for ( i = 0 ; i < snd_linear_count ; i++ ) {
+				checksum[pass] = checksum[pass] * 31 + (unsigned short)out[i];
+			}
+		}
+
+		usec[pass] = Sys_Microseconds() - usec[pass];
+	}
+
+	snd_simd = s_mixSIMD->integer;
+	Z_Free( chunks );
+
+	Com_Printf( "%i channels, %.1f seconds at %i Hz\n", numChannels, (float)numFrames / speed, speed );
+	Com_Printf( "scalar: %.2f msec\n", usec[0] / 1000.0 );
+#if SND_SIMD
+	Com_Printf( "SIMD:   %.2f msec, %.2fx\n", usec[1] / 1000.0, usec[1] ? (double)usec[0] / usec[1] : 0.0 );
+	if ( checksum[0] != checksum[1] ) {
+		Com_Printf( S_COLOR_RED "SIMD and scalar mixing differ\n" );
+	}
+#else
+	Com_Printf( "no SIMD mixing in this build\n" );
+#endif
+}
@@ -1374,50 +1374,41 @@ explosions and melee attacks.
 */
 qboolean CanDamage (gentity_t *targ, vec3_t origin)
 {
-	vec3_t	dest;
+	static const float	corners[4][2] = {
+		{ 15.0, 15.0 }, { 15.0, -15.0 }, { -15.0, 15.0 }, { -15.0, -15.0 }
+	};
+	traceRequest_t	requests[4];
+	trace_t	results[4];
 	trace_t	tr;
 	vec3_t	midpoint;
+	int		i;
 
 	// use the midpoint of the bounds instead of the origin, because
 	// bmodels may have their origin is 0,0,0
 	VectorAdd (targ->r.absmin, targ->r.absmax, midpoint);
 	VectorScale (midpoint, 0.5, midpoint);
 
-	VectorCopy (midpoint, dest);
-	trap_Trace ( &tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
+	trap_Trace ( &tr, origin, vec3_origin, vec3_origin, midpoint, ENTITYNUM_NONE, MASK_SOLID);
 	if (tr.fraction == 1.0 || tr.entityNum == targ->s.number)
 		return qtrue;
 
 	// this should probably check in the plane of projection,
 	// rather than in world coordinate, and also include Z
-	VectorCopy (midpoint, dest);
-	dest[0] += 15.0;
-	dest[1] += 15.0;
-	trap_Trace ( &tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
-
-	VectorCopy (midpoint, dest);
-	dest[0] += 15.0;
-	dest[1] -= 15.0;
-	trap_Trace ( &tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
-
-	VectorCopy (midpoint, dest);
-	dest[0] -= 15.0;
-	dest[1] += 15.0;
-	trap_Trace ( &tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
-
-	VectorCopy (midpoint, dest);
-	dest[0] -= 15.0;
-	dest[1] -= 15.0;
-	trap_Trace ( &tr, origin, vec3_origin, vec3_origin, dest, ENTITYNUM_NONE, MASK_SOLID);
-	if (tr.fraction == 1.0)
-		return qtrue;
+	memset( requests, 0, sizeof( requests ) );
+	for ( i = 0 ; i < 4 ; i++ ) {
+		VectorCopy( origin, requests[i].start );
+		VectorCopy( midpoint, requests[i].end );
+		requests[i].end[0] += corners[i][0];
+		requests[i].end[1] += corners[i][1];
+		requests[i].passEntityNum = ENTITYNUM_NONE;
+		requests[i].contentmask = MASK_SOLID;
+	}
+	trap_TraceBatch( requests, results, 4 );
 
+	for ( i = 0 ; i < 4 ; i++ ) {
+		if (results[i].fraction == 1.0)
+			return qtrue;
+	}
 
 	return qfalse;
 }
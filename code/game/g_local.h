@@ -316,7 +316,9 @@ typedef struct {
 // the size of history we'll keep
 #define NUM_CLIENT_HISTORY 17
 
-// everything we need to know to backward reconcile
+// everything we need to know to put a client back where it was; the
+// history itself is kept as parallel arrays in gclient_t so the time
+// search only touches historyTime[]
 typedef struct {
 	vec3_t		mins, maxs;
 	vec3_t		currentOrigin;
@@ -407,12 +409,20 @@ struct gclient_s {
 	// the serverTime the button was pressed
 	// (stored before pmove_fixed changes serverTime)
 	int			attackTime;
-	// the head of the history queue
+	// the head of the history queue (newest entry, oldest is head + 1)
 	int			historyHead;
-	// the history queue
-	clientHistory_t	history[NUM_CLIENT_HISTORY];
+	// the history queue, times never decrease from oldest to newest
+	int			historyTime[NUM_CLIENT_HISTORY];
+	vec3_t		historyOrigin[NUM_CLIENT_HISTORY];
+	vec3_t		historyMins[NUM_CLIENT_HISTORY];
+	vec3_t		historyMaxs[NUM_CLIENT_HISTORY];
 	// the client's saved position
 	clientHistory_t	saved;			// used to restore after time shift
+	// the time the client is currently shifted to, valid while
+	// saved.leveltime == level.time
+	int			timeShiftTime;
+	// already dead when saved, so saved.maxs are corpse bounds too
+	qboolean	savedDead;
 	// an approximation of the actual server time we received this
 	// command (not in 50ms increments)
 	int			frameOffset;
@@ -772,7 +782,7 @@ void G_ResetHistory( gentity_t *ent );
 void G_StoreHistory( gentity_t *ent );
 void G_TimeShiftAllClients( int time, gentity_t *skip );
 void G_UnTimeShiftAllClients( gentity_t *skip );
-void G_DoTimeShiftFor( gentity_t *ent );
+void G_DoTimeShiftFor( gentity_t *ent, const vec3_t start, const vec3_t end );
 void G_UndoTimeShiftFor( gentity_t *ent );
 void G_UnTimeShiftClient( gentity_t *client );
 void G_PredictPlayerMove( gentity_t *ent, float frametime );
@@ -1221,6 +1231,7 @@ void	trap_SetUserinfo( int num, const char *buffer );
 void	trap_GetServerinfo( char *buffer, int bufferSize );
 void	trap_SetBrushModel( gentity_t *ent, const char *name );
 void	trap_Trace( trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask );
+void	trap_TraceBatch( const traceRequest_t *requests, trace_t *results, int count );
 int		trap_PointContents( const vec3_t point, int passEntityNum );
 qboolean trap_InPVS( const vec3_t p1, const vec3_t p2 );
 qboolean trap_InPVSIgnorePortals( const vec3_t p1, const vec3_t p2 );
@@ -97,6 +97,20 @@ typedef struct {
 } sharedEntity_t;
 
 
+// one entry of a G_TRACE_BATCH call, same parameters as G_TRACE
+#define	MAX_TRACE_BATCH		64
+
+typedef struct {
+	vec3_t		start;
+	vec3_t		mins;
+	vec3_t		maxs;
+	vec3_t		end;
+	int			passEntityNum;
+	int			contentmask;
+	qboolean	capsule;
+} traceRequest_t;
+
+
 
 //===============================================================
 
@@ -229,6 +243,10 @@ typedef enum {
 	// 1.32
 	G_FS_SEEK,
 
+	G_TRACE_BATCH,	// ( const traceRequest_t *requests, trace_t *results, int count );
+	// runs up to MAX_TRACE_BATCH traces in one call, requests with
+	// overlapping moves share the entity gathering
+
 	BOTLIB_SETUP = 200,				// ( void );
 	BOTLIB_SHUTDOWN,				// ( void );
 	BOTLIB_LIBVAR_SET,
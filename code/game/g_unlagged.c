@@ -34,15 +34,16 @@ Clear out the given client's history (should be called when the teleport bit is
 */
 void G_ResetHistory( gentity_t *ent )
 {
+	gclient_t	*client = ent->client;
 	int		i, time;
 
 	// fill up the history with data (assume the current position)
-	ent->client->historyHead = NUM_CLIENT_HISTORY - 1;
-	for ( i = ent->client->historyHead, time = level.time; i >= 0; i--, time -= 50 ) {
-		VectorCopy( ent->r.mins, ent->client->history[i].mins );
-		VectorCopy( ent->r.maxs, ent->client->history[i].maxs );
-		VectorCopy( ent->r.currentOrigin, ent->client->history[i].currentOrigin );
-		ent->client->history[i].leveltime = time;
+	client->historyHead = NUM_CLIENT_HISTORY - 1;
+	for ( i = client->historyHead, time = level.time; i >= 0; i--, time -= 50 ) {
+		VectorCopy( ent->r.mins, client->historyMins[i] );
+		VectorCopy( ent->r.maxs, client->historyMaxs[i] );
+		VectorCopy( ent->r.currentOrigin, client->historyOrigin[i] );
+		client->historyTime[i] = time;
 	}
 }
 
@@ -56,21 +57,22 @@ Keep track of where the client's been
 */
 void G_StoreHistory( gentity_t *ent )
 {
+	gclient_t	*client = ent->client;
 	int		head;
 
-	ent->client->historyHead++;
-	if ( ent->client->historyHead >= NUM_CLIENT_HISTORY ) {
-		ent->client->historyHead = 0;
+	client->historyHead++;
+	if ( client->historyHead >= NUM_CLIENT_HISTORY ) {
+		client->historyHead = 0;
 	}
 
-	head = ent->client->historyHead;
+	head = client->historyHead;
 
 	// store all the collision-detection info and the time
-	VectorCopy( ent->r.mins, ent->client->history[head].mins );
-	VectorCopy( ent->r.maxs, ent->client->history[head].maxs );
-	VectorCopy( ent->s.pos.trBase, ent->client->history[head].currentOrigin );
-	SnapVector( ent->client->history[head].currentOrigin );
-	ent->client->history[head].leveltime = level.time;
+	VectorCopy( ent->r.mins, client->historyMins[head] );
+	VectorCopy( ent->r.maxs, client->historyMaxs[head] );
+	VectorCopy( ent->s.pos.trBase, client->historyOrigin[head] );
+	SnapVector( client->historyOrigin[head] );
+	client->historyTime[head] = level.time;
 }
 
 
@@ -98,109 +100,222 @@ static void TimeShiftLerp( float frac, vec3_t start, vec3_t end, vec3_t result )
 }
 
 
+/*
+=============
+G_FindHistory
+
+Binary search the history ring for the newest entry at or before "time".
+Returns its age order (0 is the oldest entry, NUM_CLIENT_HISTORY - 1 the
+head), or -1 if every stored entry is newer than "time"
+=============
+*/
+static int G_FindHistory( gclient_t *client, int time )
+{
+	int		oldest, lo, hi, mid, slot;
+
+	oldest = client->historyHead + 1;
+	lo = 0;
+	hi = NUM_CLIENT_HISTORY - 1;
+
+	while ( lo <= hi ) {
+		mid = ( lo + hi ) >> 1;
+		slot = ( oldest + mid ) % NUM_CLIENT_HISTORY;
+		if ( client->historyTime[slot] <= time ) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid - 1;
+		}
+	}
+
+	return hi;
+}
+
+
+// slack so a point trace grazing the box edge is never culled
+#define	TIMESHIFT_EPSILON	1.0f
+
+/*
+=============
+G_SegmentTouchesBounds
+
+Slab test of the segment from "start" to "end" against an axial box
+=============
+*/
+static qboolean G_SegmentTouchesBounds( const vec3_t start, const vec3_t end,
+		const vec3_t mins, const vec3_t maxs )
+{
+	float	enter, leave, delta, lo, hi, t0, t1;
+	int		i;
+
+	enter = 0.0f;
+	leave = 1.0f;
+
+	for ( i = 0; i < 3; i++ ) {
+		lo = mins[i] - TIMESHIFT_EPSILON;
+		hi = maxs[i] + TIMESHIFT_EPSILON;
+		delta = end[i] - start[i];
+
+		if ( delta == 0.0f ) {
+			if ( start[i] < lo || start[i] > hi ) {
+				return qfalse;
+			}
+			continue;
+		}
+
+		t0 = ( lo - start[i] ) / delta;
+		t1 = ( hi - start[i] ) / delta;
+		if ( t0 > t1 ) {
+			float t = t0; t0 = t1; t1 = t;
+		}
+		if ( t0 > enter ) {
+			enter = t0;
+		}
+		if ( t1 < leave ) {
+			leave = t1;
+		}
+		if ( enter > leave ) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+
+
 /*
 =================
 G_TimeShiftClient
 
 Move a client back to where he was at the specified "time"
+
+If "start" is not NULL the client is only moved when either its current or
+its shifted bounds touch the shot from "start" to "end", anything else
+can't change the outcome of the trace and isn't worth a relink
 =================
 */
-void G_TimeShiftClient( gentity_t *ent, int time, qboolean debug, gentity_t *debugger )
+static void G_TimeShiftClient( gentity_t *ent, int time, const vec3_t start, const vec3_t end )
 {
-	int		j, k;
-	j = k = ent->client->historyHead;
-	do {
-		if ( ent->client->history[j].leveltime <= time )
-			break;
+	gclient_t	*client = ent->client;
+	vec3_t		origin, mins, maxs, absmin, absmax;
+	int			n, j, k;
 
-		k = j;
-	
-		if ( --j < 0 ) {
-			j = NUM_CLIENT_HISTORY - 1;
-		}
+	// already moved there for an earlier shot this frame
+	if ( client->saved.leveltime == level.time && client->timeShiftTime == time ) {
+		return;
 	}
-	while ( j != ent->client->historyHead );
-
-	// if we got past the first iteration above, we've sandwiched (or wrapped)
-	if ( j != k ) {
-		// make sure it doesn't get re-saved
-		if ( ent->client->saved.leveltime != level.time ) {
-			// save the current origin and bounding box
-			VectorCopy( ent->r.mins, ent->client->saved.mins );
-			VectorCopy( ent->r.maxs, ent->client->saved.maxs );
-			VectorCopy( ent->r.currentOrigin, ent->client->saved.currentOrigin );
-			ent->client->saved.leveltime = level.time;
-		}
 
-		// if we haven't wrapped back to the head, we've sandwiched, so
-		// we shift the client's position back to where he was at "time"
-		if ( j != ent->client->historyHead ) {
-			float frac = (float)(time - ent->client->history[j].leveltime) /
-			    (ent->client->history[k].leveltime - ent->client->history[j].leveltime);
+	n = G_FindHistory( client, time );
 
-			// interpolate between the two origins to give position at time index "time"
-			TimeShiftLerp( frac, ent->client->history[j].currentOrigin, 
-                ent->client->history[k].currentOrigin, ent->r.currentOrigin );
-
-			// lerp these too, just for fun (and ducking)
-			TimeShiftLerp( frac, ent->client->history[j].mins,
-                    ent->client->history[k].mins, ent->r.mins );
+	// the newest entry is already old enough, nothing to do
+	if ( n == NUM_CLIENT_HISTORY - 1 ) {
+		return;
+	}
 
-			TimeShiftLerp( frac, ent->client->history[j].maxs,
-                    ent->client->history[k].maxs, ent->r.maxs );
+	if ( n >= 0 ) {
+		// sandwiched, so shift the client's position back to where he was at "time"
+		j = ( client->historyHead + 1 + n ) % NUM_CLIENT_HISTORY;
+		k = ( j + 1 ) % NUM_CLIENT_HISTORY;
+		{
+			float frac = (float)(time - client->historyTime[j]) /
+			    (client->historyTime[k] - client->historyTime[j]);
 
+			// interpolate between the two origins to give position at time index "time"
+			TimeShiftLerp( frac, client->historyOrigin[j], client->historyOrigin[k], origin );
 
-			// this will recalculate absmin and absmax
-			trap_LinkEntity( ent );
+			// lerp these too, just for fun (and ducking)
+			TimeShiftLerp( frac, client->historyMins[j], client->historyMins[k], mins );
+			TimeShiftLerp( frac, client->historyMaxs[j], client->historyMaxs[k], maxs );
 		}
-		else {
-			// we wrapped, so grab the earliest
-			VectorCopy( ent->client->history[k].currentOrigin, ent->r.currentOrigin );
-			VectorCopy( ent->client->history[k].mins, ent->r.mins );
-			VectorCopy( ent->client->history[k].maxs, ent->r.maxs );
+	}
+	else {
+		// older than anything we have, so grab the earliest
+		k = ( client->historyHead + 1 ) % NUM_CLIENT_HISTORY;
+		VectorCopy( client->historyOrigin[k], origin );
+		VectorCopy( client->historyMins[k], mins );
+		VectorCopy( client->historyMaxs[k], maxs );
+	}
 
-			// this will recalculate absmin and absmax
-			trap_LinkEntity( ent );
+	if ( start && client->saved.leveltime != level.time ) {
+		VectorAdd( origin, mins, absmin );
+		VectorAdd( origin, maxs, absmax );
+		if ( !G_SegmentTouchesBounds( start, end, absmin, absmax )
+			&& !G_SegmentTouchesBounds( start, end, ent->r.absmin, ent->r.absmax ) ) {
+			return;
 		}
 	}
+
+	// make sure it doesn't get re-saved
+	if ( client->saved.leveltime != level.time ) {
+		// save the current origin and bounding box
+		VectorCopy( ent->r.mins, client->saved.mins );
+		VectorCopy( ent->r.maxs, client->saved.maxs );
+		VectorCopy( ent->r.currentOrigin, client->saved.currentOrigin );
+		client->saved.leveltime = level.time;
+		client->savedDead = ( client->ps.pm_type == PM_DEAD );
+	}
+	client->timeShiftTime = time;
+
+	VectorCopy( origin, ent->r.currentOrigin );
+	VectorCopy( mins, ent->r.mins );
+	VectorCopy( maxs, ent->r.maxs );
+
+	// this will recalculate absmin and absmax
+	trap_LinkEntity( ent );
 }
 
 
 /*
 =====================
-G_TimeShiftAllClients
+G_TimeShiftClientsFor
 
-Move ALL clients back to where they were at the specified "time",
-except for "skip"
+Move the clients that matter for a shot back to where they were at the
+specified "time", except for "skip"
 =====================
 */
-void G_TimeShiftAllClients( int time, gentity_t *skip )
+static void G_TimeShiftClientsFor( int time, gentity_t *skip, const vec3_t start, const vec3_t end )
 {
 	int			i;
 	gentity_t	*ent;
-	qboolean debug = ( (skip != NULL) && skip->client && (skip->s.weapon == WP_RAILGUN) );
 
 	// for every client
 	ent = &g_entities[0];
-	for ( i = 0; i < MAX_CLIENTS; i++, ent++ )
+	for ( i = 0; i < level.maxclients; i++, ent++ )
     {
 		if ( (ent != skip) && ent->client && ent->inuse && 
                 (ent->client->sess.sessionTeam < TEAM_SPECTATOR) )
         {
-			G_TimeShiftClient( ent, time, debug, skip );
+			G_TimeShiftClient( ent, time, start, end );
 		}
 	}
 }
 
 
+/*
+=====================
+G_TimeShiftAllClients
+
+Move ALL clients back to where they were at the specified "time",
+except for "skip"
+=====================
+*/
+void G_TimeShiftAllClients( int time, gentity_t *skip )
+{
+	G_TimeShiftClientsFor( time, skip, NULL, NULL );
+}
+
+
 /*
 ================
 G_DoTimeShiftFor
 
-Decide what time to shift everyone back to, and do it
+Decide what time to shift everyone back to, and do it for the clients the
+shot from "start" to "end" could touch.  Calling it again before
+G_UndoTimeShiftFor only moves the clients that weren't moved yet, so every
+trace of one attack shares a single shift and restore pass
 ================
 */
-void G_DoTimeShiftFor( gentity_t *ent )
+void G_DoTimeShiftFor( gentity_t *ent, const vec3_t start, const vec3_t end )
 {
 	int wpflags[WP_NUM_WEAPONS] = { 0, 0, 2, 4, 0, 0, 8, 16, 0, 0, 0, 32, 0, 64 };
 
@@ -225,7 +340,7 @@ void G_DoTimeShiftFor( gentity_t *ent )
 		time = level.previousTime + ent->client->frameOffset;
 	}
 
-	G_TimeShiftAllClients( time, ent );
+	G_TimeShiftClientsFor( time, ent, start, end );
 }
 
 
@@ -240,9 +355,12 @@ void G_UnTimeShiftClient( gentity_t *ent )
 {
 	// if it was saved
 	if ( ent->client->saved.leveltime == level.time ) {
-		// move it back
-		VectorCopy( ent->client->saved.mins, ent->r.mins );
-		VectorCopy( ent->client->saved.maxs, ent->r.maxs );
+		// move it back, a client killed while shifted keeps
+		// the corpse bounds player_die gave it
+		if ( ent->client->ps.pm_type != PM_DEAD || ent->client->savedDead ) {
+			VectorCopy( ent->client->saved.mins, ent->r.mins );
+			VectorCopy( ent->client->saved.maxs, ent->r.maxs );
+		}
 		VectorCopy( ent->client->saved.currentOrigin, ent->r.currentOrigin );
 		ent->client->saved.leveltime = 0;
 
@@ -266,7 +384,7 @@ void G_UnTimeShiftAllClients( gentity_t *skip )
 	gentity_t	*ent;
 
 	ent = &g_entities[0];
-	for ( i = 0; i < MAX_CLIENTS; i++, ent++) {
+	for ( i = 0; i < level.maxclients; i++, ent++) {
 		if ( ent->client && ent->inuse && ent->client->sess.sessionTeam < TEAM_SPECTATOR && ent != skip ) {
 			G_UnTimeShiftClient( ent );
 		}
@@ -233,19 +233,15 @@ void Bullet_Fire (gentity_t *ent, float spread, int damage )
 	for (i = 0; i < 10; i++) {
 
 //unlagged - backward reconciliation #2
-		// backward-reconcile the other clients
-		G_DoTimeShiftFor( ent );
+		// backward-reconcile the other clients, a bounce only adds
+		// the ones near the new path
+		G_DoTimeShiftFor( ent, muzzle, end );
 //unlagged - backward reconciliation #2
 
 		trap_Trace (&tr, muzzle, NULL, NULL, end, passent, MASK_SHOT);
 
-//unlagged - backward reconciliation #2
-		// put them back
-		G_UndoTimeShiftFor( ent );
-//unlagged - backward reconciliation #2
-
 		if ( tr.surfaceFlags & SURF_NOIMPACT ) {
-			return;
+			break;
 		}
 
 		traceEnt = &g_entities[ tr.entityNum ];
@@ -292,6 +288,12 @@ void Bullet_Fire (gentity_t *ent, float spread, int damage )
 				continue;
 			}
 			else {
+//unlagged - backward reconciliation #2
+				// put them back before the damage, a kill
+				// relinks the target with corpse bounds
+				G_UndoTimeShiftFor( ent );
+//unlagged - backward reconciliation #2
+
 				if(spread == CHAINGUN_SPREAD) {
 					G_Damage( traceEnt, ent, ent, forward, tr.endpos,
 					          damage, 0, MOD_CHAINGUN);
@@ -306,6 +308,11 @@ void Bullet_Fire (gentity_t *ent, float spread, int damage )
 		}
 		break;
 	}
+
+//unlagged - backward reconciliation #2
+	// put them back
+	G_UndoTimeShiftFor( ent );
+//unlagged - backward reconciliation #2
 }
 
 
@@ -369,6 +376,11 @@ qboolean ShotgunPellet( vec3_t start, vec3_t end, gentity_t *ent )
 					VectorCopy( impactpoint, tr_start );
 					// the player can hit him/herself with the bounced rail
 					passent = ENTITYNUM_NONE;
+//unlagged - backward reconciliation #2
+					// ShotgunPattern only shifted the clients along the
+					// pellets, add the ones near the bounced one
+					G_DoTimeShiftFor( ent, tr_start, tr_end );
+//unlagged - backward reconciliation #2
 				}
 				else {
 					VectorCopy( tr.endpos, tr_start );
@@ -394,7 +406,7 @@ void ShotgunPattern( vec3_t origin, vec3_t origin2, int seed, gentity_t *ent )
 {
 	int			i;
 	float		r, u;
-	vec3_t		end;
+	vec3_t		end[DEFAULT_SHOTGUN_COUNT];
 	vec3_t		forward, right, up;
 	qboolean	hitClient = qfalse;
 
@@ -410,19 +422,25 @@ void ShotgunPattern( vec3_t origin, vec3_t origin2, int seed, gentity_t *ent )
 	CrossProduct( forward, right, up );
 
 
-//unlagged - backward reconciliation #2
-	// backward-reconcile the other clients
-	G_DoTimeShiftFor( ent );
-//unlagged - backward reconciliation #2
-
 	// generate the "random" spread pattern
 	for ( i = 0 ; i < DEFAULT_SHOTGUN_COUNT ; i++ ) {
 		r = Q_crandom( &seed ) * DEFAULT_SHOTGUN_SPREAD * 16;
 		u = Q_crandom( &seed ) * DEFAULT_SHOTGUN_SPREAD * 16;
-		VectorMA( origin, 8192 * 16, forward, end);
-		VectorMA (end, r, right, end);
-		VectorMA (end, u, up, end);
-		if( ShotgunPellet( origin, end, ent ) && !hitClient ) {
+		VectorMA( origin, 8192 * 16, forward, end[i]);
+		VectorMA (end[i], r, right, end[i]);
+		VectorMA (end[i], u, up, end[i]);
+	}
+
+//unlagged - backward reconciliation #2
+	// backward-reconcile the other clients any of the pellets can
+	// reach, every call only moves the ones not moved yet
+	for ( i = 0 ; i < DEFAULT_SHOTGUN_COUNT ; i++ ) {
+		G_DoTimeShiftFor( ent, origin, end[i] );
+	}
+//unlagged - backward reconciliation #2
+
+	for ( i = 0 ; i < DEFAULT_SHOTGUN_COUNT ; i++ ) {
+		if( ShotgunPellet( origin, end[i], ent ) && !hitClient ) {
 			hitClient = qtrue;
 			ent->client->accuracy_hits++;
 		}
@@ -556,7 +574,7 @@ void weapon_railgun_fire (gentity_t *ent)
 
 //unlagged - backward reconciliation #2
 	// backward-reconcile the other clients
-	G_DoTimeShiftFor( ent );
+	G_DoTimeShiftFor( ent, muzzle, end );
 //unlagged - backward reconciliation #2
 
 	// trace only against the solids, so the railgun will go through people
@@ -588,6 +606,9 @@ void weapon_railgun_fire (gentity_t *ent)
 					VectorCopy( impactpoint, muzzle );
 					// the player can hit him/herself with the bounced rail
 					passent = ENTITYNUM_NONE;
+//unlagged - backward reconciliation #2
+					G_DoTimeShiftFor( ent, muzzle, end );
+//unlagged - backward reconciliation #2
 				}
 			}
 			else {
@@ -732,17 +753,13 @@ void Weapon_LightningFire( gentity_t *ent )
 
 //Sago: I'm not sure this should recieve backward reconciliation. It is not a real instant hit weapon, it can normally be dogded
 //unlagged - backward reconciliation #2
-		// backward-reconcile the other clients
-		G_DoTimeShiftFor( ent );
+		// backward-reconcile the other clients, a bounce only adds
+		// the ones near the new path
+		G_DoTimeShiftFor( ent, muzzle, end );
 //unlagged - backward reconciliation #2
 
 		trap_Trace( &tr, muzzle, NULL, NULL, end, passent, MASK_SHOT );
 
-//unlagged - backward reconciliation #2
-		// put them back
-		G_UndoTimeShiftFor( ent );
-//unlagged - backward reconciliation #2
-
 		// if not the first trace (the lightning bounced of an invulnerability sphere)
 		if (i) {
 			// add bounced off lightning bolt temp entity
@@ -754,7 +771,7 @@ void Weapon_LightningFire( gentity_t *ent )
 			VectorCopy( end, tent->s.origin2 );
 		}
 		if ( tr.entityNum == ENTITYNUM_NONE ) {
-			return;
+			break;
 		}
 
 		traceEnt = &g_entities[ tr.entityNum ];
@@ -776,6 +793,12 @@ void Weapon_LightningFire( gentity_t *ent )
 				continue;
 			}
 			else {
+//unlagged - backward reconciliation #2
+				// put them back before the damage, a kill
+				// relinks the target with corpse bounds
+				G_UndoTimeShiftFor( ent );
+//unlagged - backward reconciliation #2
+
 				G_Damage( traceEnt, ent, ent, forward, tr.endpos,
 				          damage, 0, MOD_LIGHTNING);
 			}
@@ -798,6 +821,11 @@ void Weapon_LightningFire( gentity_t *ent )
 
 		break;
 	}
+
+//unlagged - backward reconciliation #2
+	// put them back
+	G_UndoTimeShiftFor( ent );
+//unlagged - backward reconciliation #2
 }
 
 /*
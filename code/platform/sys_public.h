@@ -61,6 +61,13 @@ void    Sys_AnsiColorPrint(const char *msg);
 // Sys_Milliseconds should only be used for profiling purposes,
 // any game related timing information should come from event timestamps
 int	Sys_Milliseconds(void);
+// monotonic, for timing short stretches of code
+int64_t	Sys_Microseconds(void);
+
+// sample is called with the pc and stack pointer of the main thread about
+// hz times a second, from a signal handler or with the thread suspended
+qboolean Sys_StartSampling( int hz, void (*sample)( void *pc, void *sp ) );
+void	Sys_StopSampling( void );
 
 qboolean Sys_RandomBytes(byte *string, int len);
 
@@ -82,6 +89,14 @@ qboolean Sys_Mkdir(const char *path);
 FILE	*Sys_Mkfifo(const char *ospath);
 char	*Sys_Cwd(void);
 
+// maps a whole file copy-on-write, so the memory may be written to
+// without touching the file.  NULL if it can't be mapped
+void	*Sys_MapFile(const char *ospath, int *length);
+void	Sys_UnmapFile(void *data, int length);
+
+// size and modification time of a regular file, without opening it
+qboolean Sys_StatFile(const char *ospath, int *size, int *mtime);
+
 
 // Console
 void CON_Shutdown(void);
@@ -99,6 +114,34 @@ void	Sys_FreeFileList(char **list);
 void	Sys_Sleep(int msec);
 
 qboolean Sys_LowPhysicalMemory(void);
+int		Sys_NumCPUs(void);
+
+// Z_Malloc and Z_Free may be called from worker threads, but
+// Z_FreeTags, the heap logs and the console expect them to be idle
+typedef struct sysThread_s		sysThread_t;
+typedef struct sysMutex_s		sysMutex_t;
+typedef struct sysSemaphore_s	sysSemaphore_t;
+
+typedef void (*sysThreadFunc_t)(void *arg);
+
+sysThread_t	*Sys_CreateThread(sysThreadFunc_t func, void *arg);
+void		Sys_JoinThread(sysThread_t *thread);
+
+sysMutex_t	*Sys_CreateMutex(void);
+void		Sys_DestroyMutex(sysMutex_t *mutex);
+void		Sys_LockMutex(sysMutex_t *mutex);
+void		Sys_UnlockMutex(sysMutex_t *mutex);
+
+sysSemaphore_t *Sys_CreateSemaphore(int count);
+void		Sys_DestroySemaphore(sysSemaphore_t *sem);
+void		Sys_SemaphoreWait(sysSemaphore_t *sem);
+void		Sys_SemaphorePost(sysSemaphore_t *sem, int count);
+
+// returns the new value
+int			Sys_AtomicAdd(volatile int *value, int add);
+
+// gives the rest of the time slice to another runnable thread
+void		Sys_Yield(void);
 
 void Sys_SetEnv(const char *name, const char *value);
 
@@ -20,6 +20,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE		// REG_RIP and friends for the sampling timer
+#endif
+
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -29,11 +33,14 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/time.h>
+#include <time.h>
 #include <pwd.h>
 #include <libgen.h>
 #include <fcntl.h>
 #include <fenv.h>
 #include <sys/wait.h>
+#include <pthread.h>
+#include <sched.h>
 
 #include "../qcommon/q_shared.h"
 #include "../qcommon/qcommon.h"
@@ -267,6 +274,121 @@ int Sys_Milliseconds (void)
 	return curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+int64_t Sys_Microseconds( void )
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+==============================================================================
+
+SAMPLING TIMER
+
+ITIMER_PROF runs on the cpu time of the whole process, samples that land
+on another thread are dropped.
+==============================================================================
+*/
+
+#if defined( __linux__ ) && defined( __x86_64__ )
+#define SAMPLE_PC( uc )		( (uc)->uc_mcontext.gregs[REG_RIP] )
+#define SAMPLE_SP( uc )		( (uc)->uc_mcontext.gregs[REG_RSP] )
+#elif defined( __linux__ ) && defined( __i386__ )
+#define SAMPLE_PC( uc )		( (uc)->uc_mcontext.gregs[REG_EIP] )
+#define SAMPLE_SP( uc )		( (uc)->uc_mcontext.gregs[REG_ESP] )
+#elif defined( __FreeBSD__ ) && defined( __x86_64__ )
+#define SAMPLE_PC( uc )		( (uc)->uc_mcontext.mc_rip )
+#define SAMPLE_SP( uc )		( (uc)->uc_mcontext.mc_rsp )
+#elif defined( __FreeBSD__ ) && defined( __i386__ )
+#define SAMPLE_PC( uc )		( (uc)->uc_mcontext.mc_eip )
+#define SAMPLE_SP( uc )		( (uc)->uc_mcontext.mc_esp )
+#elif defined( __APPLE__ ) && defined( __x86_64__ )
+#define SAMPLE_PC( uc )		( (uc)->uc_mcontext->__ss.__rip )
+#define SAMPLE_SP( uc )		( (uc)->uc_mcontext->__ss.__rsp )
+#endif
+
+#ifdef SAMPLE_PC
+static void (* volatile sys_sampleFunc)( void *pc, void *sp );
+static pthread_t sys_sampleThread;
+
+static void Sys_SampleSignal( int sig, siginfo_t *info, void *context )
+{
+	ucontext_t *uc = context;
+	int savedErrno;
+
+	if ( !sys_sampleFunc || !pthread_equal( pthread_self(), sys_sampleThread ) ) {
+		return;
+	}
+
+	savedErrno = errno;
+	sys_sampleFunc( (void *)SAMPLE_PC( uc ), (void *)SAMPLE_SP( uc ) );
+	errno = savedErrno;
+}
+#endif
+
+/*
+================
+Sys_StartSampling
+================
+*/
+qboolean Sys_StartSampling( int hz, void (*sample)( void *pc, void *sp ) )
+{
+#ifdef SAMPLE_PC
+	struct sigaction sa;
+	struct itimerval timer;
+
+	sys_sampleThread = pthread_self();
+	sys_sampleFunc = sample;
+
+	memset( &sa, 0, sizeof( sa ) );
+	sa.sa_sigaction = Sys_SampleSignal;
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset( &sa.sa_mask );
+
+	memset( &timer, 0, sizeof( timer ) );
+	timer.it_interval.tv_usec = 1000000 / hz;
+	timer.it_value = timer.it_interval;
+
+	if ( sigaction( SIGPROF, &sa, NULL ) || setitimer( ITIMER_PROF, &timer, NULL ) ) {
+		Com_Printf( "Sys_StartSampling: %s\n", strerror( errno ) );
+		Sys_StopSampling();
+		return qfalse;
+	}
+
+	return qtrue;
+#else
+	Com_Printf( "Sys_StartSampling: not supported on this platform\n" );
+	return qfalse;
+#endif
+}
+
+/*
+================
+Sys_StopSampling
+================
+*/
+void Sys_StopSampling( void )
+{
+#ifdef SAMPLE_PC
+	struct itimerval timer;
+
+	memset( &timer, 0, sizeof( timer ) );
+	setitimer( ITIMER_PROF, &timer, NULL );
+
+	// one may still be pending
+	signal( SIGPROF, SIG_IGN );
+	sys_sampleFunc = NULL;
+#endif
+}
+
 /*
 ==================
 Sys_RandomBytes
@@ -319,6 +441,210 @@ qboolean Sys_LowPhysicalMemory(void)
 	return qfalse;
 }
 
+/*
+==================
+Sys_NumCPUs
+==================
+*/
+int Sys_NumCPUs(void)
+{
+	long count;
+
+#if defined(__linux__) && defined(CPU_COUNT)
+	// the affinity mask is what we may actually run on, containers
+	// and taskset often leave only a few of the online cpus
+	cpu_set_t set;
+
+	if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 )
+	{
+		count = CPU_COUNT( &set );
+		if( count >= 1 )
+			return (int)count;
+	}
+#endif
+
+	count = sysconf( _SC_NPROCESSORS_ONLN );
+
+	if( count < 1 )
+		return 1;
+
+	return (int)count;
+}
+
+/*
+==============================================================
+
+THREADS
+
+These are allocated with malloc rather than the zone,
+because the zone's own lock is one of them.
+==============================================================
+*/
+
+struct sysThread_s
+{
+	pthread_t		handle;
+	sysThreadFunc_t	func;
+	void			*arg;
+};
+
+struct sysMutex_s
+{
+	pthread_mutex_t	mutex;
+};
+
+struct sysSemaphore_s
+{
+	pthread_mutex_t	mutex;
+	pthread_cond_t	cond;
+	int				count;
+};
+
+static void *Sys_ThreadMain( void *arg )
+{
+	sysThread_t *thread = arg;
+	sigset_t set;
+
+	// leave signal handling to the main thread
+	sigfillset( &set );
+	pthread_sigmask( SIG_BLOCK, &set, NULL );
+
+	thread->func( thread->arg );
+
+	Z_ReleaseThreadCache();
+
+	return NULL;
+}
+
+/*
+==================
+Sys_CreateThread
+==================
+*/
+sysThread_t *Sys_CreateThread( sysThreadFunc_t func, void *arg )
+{
+	sysThread_t *thread = malloc( sizeof( *thread ) );
+
+	if( !thread )
+		return NULL;
+
+	thread->func = func;
+	thread->arg = arg;
+
+	if( pthread_create( &thread->handle, NULL, Sys_ThreadMain, thread ) != 0 )
+	{
+		free( thread );
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+==================
+Sys_JoinThread
+==================
+*/
+void Sys_JoinThread( sysThread_t *thread )
+{
+	if( !thread )
+		return;
+
+	pthread_join( thread->handle, NULL );
+	free( thread );
+}
+
+sysMutex_t *Sys_CreateMutex( void )
+{
+	sysMutex_t *mutex = malloc( sizeof( *mutex ) );
+
+	if( mutex )
+		pthread_mutex_init( &mutex->mutex, NULL );
+
+	return mutex;
+}
+
+void Sys_DestroyMutex( sysMutex_t *mutex )
+{
+	if( !mutex )
+		return;
+
+	pthread_mutex_destroy( &mutex->mutex );
+	free( mutex );
+}
+
+void Sys_LockMutex( sysMutex_t *mutex )
+{
+	pthread_mutex_lock( &mutex->mutex );
+}
+
+void Sys_UnlockMutex( sysMutex_t *mutex )
+{
+	pthread_mutex_unlock( &mutex->mutex );
+}
+
+/*
+==================
+Sys_CreateSemaphore
+
+unnamed posix semaphores are not available on OS X,
+so build a counting semaphore from a condition variable
+==================
+*/
+sysSemaphore_t *Sys_CreateSemaphore( int count )
+{
+	sysSemaphore_t *sem = malloc( sizeof( *sem ) );
+
+	if( !sem )
+		return NULL;
+
+	pthread_mutex_init( &sem->mutex, NULL );
+	pthread_cond_init( &sem->cond, NULL );
+	sem->count = count;
+
+	return sem;
+}
+
+void Sys_DestroySemaphore( sysSemaphore_t *sem )
+{
+	if( !sem )
+		return;
+
+	pthread_cond_destroy( &sem->cond );
+	pthread_mutex_destroy( &sem->mutex );
+	free( sem );
+}
+
+void Sys_SemaphoreWait( sysSemaphore_t *sem )
+{
+	pthread_mutex_lock( &sem->mutex );
+	while( sem->count <= 0 )
+		pthread_cond_wait( &sem->cond, &sem->mutex );
+	sem->count--;
+	pthread_mutex_unlock( &sem->mutex );
+}
+
+void Sys_SemaphorePost( sysSemaphore_t *sem, int count )
+{
+	pthread_mutex_lock( &sem->mutex );
+	sem->count += count;
+	if( count > 1 )
+		pthread_cond_broadcast( &sem->cond );
+	else
+		pthread_cond_signal( &sem->cond );
+	pthread_mutex_unlock( &sem->mutex );
+}
+
+int Sys_AtomicAdd( volatile int *value, int add )
+{
+	return __sync_add_and_fetch( value, add );
+}
+
+void Sys_Yield( void )
+{
+	sched_yield();
+}
+
 /*
 ==================
 Sys_Basename
@@ -351,6 +677,64 @@ FILE *Sys_FOpen( const char *ospath, const char *mode )
 	return fopen( ospath, mode );
 }
 
+/*
+==============
+Sys_MapFile
+==============
+*/
+void *Sys_MapFile( const char *ospath, int *length )
+{
+	struct stat buf;
+	void *data;
+	int fd;
+
+	fd = open( ospath, O_RDONLY );
+	if ( fd == -1 )
+		return NULL;
+
+	if ( fstat( fd, &buf ) || !S_ISREG( buf.st_mode ) || buf.st_size <= 0 || buf.st_size > INT_MAX )
+	{
+		close( fd );
+		return NULL;
+	}
+
+	data = mmap( NULL, buf.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+	close( fd );
+
+	if ( data == MAP_FAILED )
+		return NULL;
+
+	*length = buf.st_size;
+	return data;
+}
+
+/*
+==============
+Sys_UnmapFile
+==============
+*/
+void Sys_UnmapFile( void *data, int length )
+{
+	munmap( data, length );
+}
+
+/*
+==============
+Sys_StatFile
+==============
+*/
+qboolean Sys_StatFile( const char *ospath, int *size, int *mtime )
+{
+	struct stat buf;
+
+	if ( stat( ospath, &buf ) || !S_ISREG( buf.st_mode ) || buf.st_size > INT_MAX )
+		return qfalse;
+
+	*size = buf.st_size;
+	*mtime = buf.st_mtime;
+	return qtrue;
+}
+
 /*
 ==================
 Sys_Mkdir
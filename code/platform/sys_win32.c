@@ -204,6 +204,118 @@ int Sys_Milliseconds (void)
 	return sys_curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+int64_t Sys_Microseconds( void )
+{
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER count;
+
+	if ( !freq.QuadPart )
+		QueryPerformanceFrequency( &freq );
+
+	QueryPerformanceCounter( &count );
+
+	// split up so the multiplication can't overflow
+	return count.QuadPart / freq.QuadPart * 1000000 +
+		count.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart;
+}
+
+/*
+==============================================================================
+
+SAMPLING TIMER
+
+There are no profiling signals, a thread suspends the main thread every
+interval and reads its context.  This runs on wall clock time.
+==============================================================================
+*/
+
+static void (*sys_sampleFunc)( void *pc, void *sp );
+static HANDLE sys_sampleTarget, sys_sampleThread;
+static DWORD sys_sampleInterval;
+static volatile qboolean sys_sampleStop;
+
+static DWORD WINAPI Sys_SampleThread( LPVOID param )
+{
+	CONTEXT ctx;
+
+	while ( !sys_sampleStop )
+	{
+		Sleep( sys_sampleInterval );
+
+		if ( SuspendThread( sys_sampleTarget ) == (DWORD)-1 )
+			break;
+
+		memset( &ctx, 0, sizeof( ctx ) );
+		ctx.ContextFlags = CONTEXT_CONTROL;
+		if ( GetThreadContext( sys_sampleTarget, &ctx ) )
+		{
+#ifdef _WIN64
+			sys_sampleFunc( (void *)ctx.Rip, (void *)ctx.Rsp );
+#else
+			sys_sampleFunc( (void *)ctx.Eip, (void *)ctx.Esp );
+#endif
+		}
+
+		ResumeThread( sys_sampleTarget );
+	}
+
+	return 0;
+}
+
+/*
+================
+Sys_StartSampling
+================
+*/
+qboolean Sys_StartSampling( int hz, void (*sample)( void *pc, void *sp ) )
+{
+	if ( !DuplicateHandle( GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &sys_sampleTarget,
+		THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION, FALSE, 0 ) )
+	{
+		Com_Printf( "Sys_StartSampling: DuplicateHandle failed\n" );
+		return qfalse;
+	}
+
+	sys_sampleFunc = sample;
+	sys_sampleInterval = hz < 1000 ? 1000 / hz : 1;
+	sys_sampleStop = qfalse;
+
+	sys_sampleThread = CreateThread( NULL, 0, Sys_SampleThread, NULL, 0, NULL );
+	if ( !sys_sampleThread )
+	{
+		Com_Printf( "Sys_StartSampling: CreateThread failed\n" );
+		CloseHandle( sys_sampleTarget );
+		sys_sampleTarget = NULL;
+		return qfalse;
+	}
+
+	SetThreadPriority( sys_sampleThread, THREAD_PRIORITY_TIME_CRITICAL );
+	return qtrue;
+}
+
+/*
+================
+Sys_StopSampling
+================
+*/
+void Sys_StopSampling( void )
+{
+	if ( !sys_sampleThread )
+		return;
+
+	sys_sampleStop = qtrue;
+	WaitForSingleObject( sys_sampleThread, INFINITE );
+
+	CloseHandle( sys_sampleThread );
+	CloseHandle( sys_sampleTarget );
+	sys_sampleThread = sys_sampleTarget = NULL;
+}
+
 
 
 /*
@@ -302,6 +414,177 @@ qboolean Sys_LowPhysicalMemory(void)
 	return (stat.ullTotalPhys <= MEM_THRESHOLD) ? qtrue : qfalse;
 }
 
+/*
+==================
+Sys_NumCPUs
+==================
+*/
+int Sys_NumCPUs(void)
+{
+	SYSTEM_INFO info;
+
+	GetSystemInfo( &info );
+
+	if( info.dwNumberOfProcessors < 1 )
+		return 1;
+
+	return (int)info.dwNumberOfProcessors;
+}
+
+/*
+==============================================================
+
+THREADS
+
+These are allocated with malloc rather than the zone,
+because the zone's own lock is one of them.
+==============================================================
+*/
+
+struct sysThread_s
+{
+	HANDLE			handle;
+	sysThreadFunc_t	func;
+	void			*arg;
+};
+
+struct sysMutex_s
+{
+	CRITICAL_SECTION	cs;
+};
+
+struct sysSemaphore_s
+{
+	HANDLE			handle;
+};
+
+static DWORD WINAPI Sys_ThreadMain( LPVOID arg )
+{
+	sysThread_t *thread = arg;
+
+	thread->func( thread->arg );
+
+	Z_ReleaseThreadCache();
+
+	return 0;
+}
+
+/*
+==================
+Sys_CreateThread
+==================
+*/
+sysThread_t *Sys_CreateThread( sysThreadFunc_t func, void *arg )
+{
+	sysThread_t *thread = malloc( sizeof( *thread ) );
+
+	if( !thread )
+		return NULL;
+
+	thread->func = func;
+	thread->arg = arg;
+	thread->handle = CreateThread( NULL, 0, Sys_ThreadMain, thread, 0, NULL );
+
+	if( !thread->handle )
+	{
+		free( thread );
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+==================
+Sys_JoinThread
+==================
+*/
+void Sys_JoinThread( sysThread_t *thread )
+{
+	if( !thread )
+		return;
+
+	WaitForSingleObject( thread->handle, INFINITE );
+	CloseHandle( thread->handle );
+	free( thread );
+}
+
+sysMutex_t *Sys_CreateMutex( void )
+{
+	sysMutex_t *mutex = malloc( sizeof( *mutex ) );
+
+	if( mutex )
+		InitializeCriticalSection( &mutex->cs );
+
+	return mutex;
+}
+
+void Sys_DestroyMutex( sysMutex_t *mutex )
+{
+	if( !mutex )
+		return;
+
+	DeleteCriticalSection( &mutex->cs );
+	free( mutex );
+}
+
+void Sys_LockMutex( sysMutex_t *mutex )
+{
+	EnterCriticalSection( &mutex->cs );
+}
+
+void Sys_UnlockMutex( sysMutex_t *mutex )
+{
+	LeaveCriticalSection( &mutex->cs );
+}
+
+sysSemaphore_t *Sys_CreateSemaphore( int count )
+{
+	sysSemaphore_t *sem = malloc( sizeof( *sem ) );
+
+	if( !sem )
+		return NULL;
+
+	sem->handle = CreateSemaphore( NULL, count, 0x7fffffff, NULL );
+
+	if( !sem->handle )
+	{
+		free( sem );
+		return NULL;
+	}
+
+	return sem;
+}
+
+void Sys_DestroySemaphore( sysSemaphore_t *sem )
+{
+	if( !sem )
+		return;
+
+	CloseHandle( sem->handle );
+	free( sem );
+}
+
+void Sys_SemaphoreWait( sysSemaphore_t *sem )
+{
+	WaitForSingleObject( sem->handle, INFINITE );
+}
+
+void Sys_SemaphorePost( sysSemaphore_t *sem, int count )
+{
+	ReleaseSemaphore( sem->handle, count, NULL );
+}
+
+int Sys_AtomicAdd( volatile int *value, int add )
+{
+	return InterlockedExchangeAdd( (volatile LONG *)value, add ) + add;
+}
+
+void Sys_Yield( void )
+{
+	SwitchToThread();
+}
+
 
 
 /*
@@ -370,6 +653,78 @@ FILE *Sys_FOpen( const char *ospath, const char *mode )
 	return fopen( ospath, mode );
 }
 
+/*
+==============
+Sys_MapFile
+==============
+*/
+void *Sys_MapFile( const char *ospath, int *length )
+{
+	HANDLE file, mapping;
+	DWORD sizeHigh, sizeLow;
+	void *data;
+
+	file = CreateFileA( ospath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if ( file == INVALID_HANDLE_VALUE )
+		return NULL;
+
+	sizeLow = GetFileSize( file, &sizeHigh );
+	if ( sizeLow == INVALID_FILE_SIZE || sizeHigh || !sizeLow || sizeLow > INT_MAX )
+	{
+		CloseHandle( file );
+		return NULL;
+	}
+
+	mapping = CreateFileMapping( file, NULL, PAGE_WRITECOPY, 0, 0, NULL );
+	CloseHandle( file );
+	if ( !mapping )
+		return NULL;
+
+	// the view keeps the mapping alive
+	data = MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 );
+	CloseHandle( mapping );
+	if ( !data )
+		return NULL;
+
+	*length = sizeLow;
+	return data;
+}
+
+/*
+==============
+Sys_UnmapFile
+==============
+*/
+void Sys_UnmapFile( void *data, int length )
+{
+	UnmapViewOfFile( data );
+}
+
+/*
+==============
+Sys_StatFile
+==============
+*/
+qboolean Sys_StatFile( const char *ospath, int *size, int *mtime )
+{
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+	ULARGE_INTEGER time;
+
+	if ( !GetFileAttributesExA( ospath, GetFileExInfoStandard, &attr ) )
+		return qfalse;
+
+	if ( ( attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) || attr.nFileSizeHigh || attr.nFileSizeLow > INT_MAX )
+		return qfalse;
+
+	// 100ns ticks since 1601 to unix seconds
+	time.LowPart = attr.ftLastWriteTime.dwLowDateTime;
+	time.HighPart = attr.ftLastWriteTime.dwHighDateTime;
+
+	*size = attr.nFileSizeLow;
+	*mtime = (int)( time.QuadPart / 10000000 - 11644473600ULL );
+	return qtrue;
+}
+
 /*
 ==============
 Sys_Mkdir
@@ -45,6 +45,7 @@ byte		*cmod_base;
 cvar_t		*cm_noAreas;
 cvar_t		*cm_noCurves;
 cvar_t		*cm_playerCurveClip;
+cvar_t		*cm_debugSurfaceUpdate;
 #endif
 
 cmodel_t	box_model;
@@ -223,6 +224,9 @@ void CMod_LoadBrushes( lump_t *l ) {
 	count = l->filelen / sizeof(*in);
 
 	cm.brushes = Hunk_Alloc( ( BOX_BRUSHES + count ) * sizeof( *cm.brushes ), h_high );
+	if ( count > MAX_MAP_BRUSHES ) {
+		Com_Error( ERR_DROP, "CMod_LoadBrushes: MAX_MAP_BRUSHES exceeded" );
+	}
 	cm.numBrushes = count;
 
 	out = cm.brushes;
@@ -279,6 +283,11 @@ void CMod_LoadLeafs (lump_t *l)
 			cm.numClusters = out->cluster + 1;
 		if (out->area >= cm.numAreas)
 			cm.numAreas = out->area + 1;
+
+		// areas index the snapshot area bits and the server's
+		// per client area tables
+		if (out->area < -1 || out->area >= MAX_MAP_AREAS)
+			Com_Error (ERR_DROP, "CMod_LoadLeafs: bad area %i", out->area);
 	}
 
 	cm.areas = Hunk_Alloc( cm.numAreas * sizeof( *cm.areas ), h_high );
@@ -435,17 +444,19 @@ void CMod_LoadVisibility( lump_t *l )
 	unsigned char *buf;
 
     len = l->filelen;
+	// the server tests rows a 64 bit word at a time, so keep a word
+	// past the last row readable
 	if ( !len )
     {
 		cm.clusterBytes = ( cm.numClusters + 31 ) & ~31;
-		cm.visibility = Hunk_Alloc( cm.clusterBytes, h_high );
+		cm.visibility = Hunk_Alloc( cm.clusterBytes + 8, h_high );
 		memset( cm.visibility, 255, cm.clusterBytes );
 		return;
 	}
 	buf = cmod_base + l->fileofs;
 
 	cm.vised = qtrue;
-	cm.visibility = Hunk_Alloc( len, h_high );
+	cm.visibility = Hunk_Alloc( len + 8, h_high );
 	cm.numClusters = LittleLong( ((int *)buf)[0] );
 	cm.clusterBytes = LittleLong( ((int *)buf)[1] );
 	memcpy(cm.visibility, buf + VIS_HEADER, len - VIS_HEADER );
@@ -475,6 +486,9 @@ void CMod_LoadPatches( lump_t *surfs, lump_t *verts ) {
 	if (surfs->filelen % sizeof(*in))
 		Com_Error (ERR_DROP, "MOD_LoadBmodel: funny lump size");
 	cm.numSurfaces = count = surfs->filelen / sizeof(*in);
+	if ( count > MAX_MAP_DRAW_SURFS ) {
+		Com_Error( ERR_DROP, "CMod_LoadPatches: MAX_MAP_DRAW_SURFS exceeded" );
+	}
 	cm.surfaces = Hunk_Alloc( cm.numSurfaces * sizeof( cm.surfaces[0] ), h_high );
 
 	dv = (void *)(cmod_base + verts->fileofs);
@@ -564,6 +578,7 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum )
 	cm_noAreas = Cvar_Get ("cm_noAreas", "0", CVAR_CHEAT);
 	cm_noCurves = Cvar_Get ("cm_noCurves", "0", CVAR_CHEAT);
 	cm_playerCurveClip = Cvar_Get ("cm_playerCurveClip", "1", CVAR_ARCHIVE|CVAR_CHEAT );
+	cm_debugSurfaceUpdate = Cvar_Get ("r_debugSurfaceUpdate", "1", 0 );
 #endif
 	Com_DPrintf( "CM_LoadMap( %s, %i )\n", name, clientload );
 
@@ -697,6 +712,10 @@ int		CM_NumClusters( void ) {
 	return cm.numClusters;
 }
 
+int		CM_NumAreas( void ) {
+	return cm.numAreas;
+}
+
 int		CM_NumInlineModels( void ) {
 	return cm.numSubModels;
 }
@@ -725,48 +744,40 @@ int		CM_LeafArea( int leafnum ) {
 
 /*
 ===================
-CM_InitBoxHull
+CM_SetupBoxBrush
 
-Set up the planes and nodes so that the six floats of a bounding box
-can just be stored out and get a proper clipping hull structure.
+Links a brush to six axial sides and their twelve planes, the plane
+distances are filled in by CM_SetBoxBounds.
 ===================
 */
-void CM_InitBoxHull (void)
+void CM_SetupBoxBrush( cbrush_t *brush, cbrushside_t *sides, cplane_t *planes )
 {
 	int			i;
 	int			side;
 	cplane_t	*p;
 	cbrushside_t	*s;
 
-	box_planes = &cm.planes[cm.numPlanes];
-
-	box_brush = &cm.brushes[cm.numBrushes];
-	box_brush->numsides = 6;
-	box_brush->sides = cm.brushsides + cm.numBrushSides;
-	box_brush->contents = CONTENTS_BODY;
-
-	box_model.leaf.numLeafBrushes = 1;
-//	box_model.leaf.firstLeafBrush = cm.numBrushes;
-	box_model.leaf.firstLeafBrush = cm.numLeafBrushes;
-	cm.leafbrushes[cm.numLeafBrushes] = cm.numBrushes;
+	brush->numsides = 6;
+	brush->sides = sides;
+	brush->contents = CONTENTS_BODY;
 
 	for (i=0 ; i<6 ; i++)
 	{
 		side = i&1;
 
 		// brush sides
-		s = &cm.brushsides[cm.numBrushSides+i];
-		s->plane = 	cm.planes + (cm.numPlanes+i*2+side);
+		s = &sides[i];
+		s->plane = 	planes + (i*2+side);
 		s->surfaceFlags = 0;
 
 		// planes
-		p = &box_planes[i*2];
+		p = &planes[i*2];
 		p->type = i>>1;
 		p->signbits = 0;
 		VectorClear (p->normal);
 		p->normal[i>>1] = 1;
 
-		p = &box_planes[i*2+1];
+		p = &planes[i*2+1];
 		p->type = 3 + (i>>1);
 		p->signbits = 0;
 		VectorClear (p->normal);
@@ -787,6 +798,53 @@ void CM_InitBoxHull (void)
 	}	
 }
 
+/*
+===================
+CM_InitBoxHull
+
+Set up the planes and nodes so that the six floats of a bounding box
+can just be stored out and get a proper clipping hull structure.
+===================
+*/
+void CM_InitBoxHull (void)
+{
+	box_planes = &cm.planes[cm.numPlanes];
+	box_brush = &cm.brushes[cm.numBrushes];
+
+	box_model.leaf.numLeafBrushes = 1;
+//	box_model.leaf.firstLeafBrush = cm.numBrushes;
+	box_model.leaf.firstLeafBrush = cm.numLeafBrushes;
+	cm.leafbrushes[cm.numLeafBrushes] = cm.numBrushes;
+
+	CM_SetupBoxBrush( box_brush, cm.brushsides + cm.numBrushSides, box_planes );
+}
+
+/*
+===================
+CM_SetBoxBounds
+===================
+*/
+void CM_SetBoxBounds( cmodel_t *model, cbrush_t *brush, cplane_t *planes, const vec3_t mins, const vec3_t maxs ) {
+	VectorCopy( mins, model->mins );
+	VectorCopy( maxs, model->maxs );
+
+	planes[0].dist = maxs[0];
+	planes[1].dist = -maxs[0];
+	planes[2].dist = mins[0];
+	planes[3].dist = -mins[0];
+	planes[4].dist = maxs[1];
+	planes[5].dist = -maxs[1];
+	planes[6].dist = mins[1];
+	planes[7].dist = -mins[1];
+	planes[8].dist = maxs[2];
+	planes[9].dist = -maxs[2];
+	planes[10].dist = mins[2];
+	planes[11].dist = -mins[2];
+
+	VectorCopy( mins, brush->bounds[0] );
+	VectorCopy( maxs, brush->bounds[1] );
+}
+
 /*
 ===================
 CM_TempBoxModel
@@ -798,32 +856,69 @@ Capsules are handled differently though.
 */
 clipHandle_t CM_TempBoxModel( const vec3_t mins, const vec3_t maxs, int capsule ) {
 
-	VectorCopy( mins, box_model.mins );
-	VectorCopy( maxs, box_model.maxs );
-
 	if ( capsule ) {
+		VectorCopy( mins, box_model.mins );
+		VectorCopy( maxs, box_model.maxs );
 		return CAPSULE_MODEL_HANDLE;
 	}
 
-	box_planes[0].dist = maxs[0];
-	box_planes[1].dist = -maxs[0];
-	box_planes[2].dist = mins[0];
-	box_planes[3].dist = -mins[0];
-	box_planes[4].dist = maxs[1];
-	box_planes[5].dist = -maxs[1];
-	box_planes[6].dist = mins[1];
-	box_planes[7].dist = -mins[1];
-	box_planes[8].dist = maxs[2];
-	box_planes[9].dist = -maxs[2];
-	box_planes[10].dist = mins[2];
-	box_planes[11].dist = -mins[2];
+	CM_SetBoxBounds( &box_model, box_brush, box_planes, mins, maxs );
 
-	VectorCopy( mins, box_brush->bounds[0] );
-	VectorCopy( maxs, box_brush->bounds[1] );
+	return BOX_MODEL_HANDLE;
+}
+
+/*
+===================
+CM_TempBoxModelContext
+
+Same as CM_TempBoxModel, but the box lives in the trace context so
+other threads can build their own at the same time.
+===================
+*/
+clipHandle_t CM_TempBoxModelContext( cmTraceContext_t *ctx, const vec3_t mins, const vec3_t maxs, int capsule ) {
+	if ( !ctx || !ctx->ownBox ) {
+		return CM_TempBoxModel( mins, maxs, capsule );
+	}
+
+	if ( capsule ) {
+		VectorCopy( mins, ctx->boxModel.mins );
+		VectorCopy( maxs, ctx->boxModel.maxs );
+		return CAPSULE_MODEL_HANDLE;
+	}
+
+	CM_SetBoxBounds( &ctx->boxModel, &ctx->boxBrush, ctx->boxPlanes, mins, maxs );
 
 	return BOX_MODEL_HANDLE;
 }
 
+/*
+===================
+CM_CreateTraceContext
+===================
+*/
+cmTraceContext_t *CM_CreateTraceContext( void ) {
+	cmTraceContext_t	*ctx;
+
+	ctx = Z_Malloc( sizeof( *ctx ) );
+
+	ctx->ownBox = qtrue;
+	ctx->boxModel.leaf.numLeafBrushes = 1;
+	CM_SetupBoxBrush( &ctx->boxBrush, ctx->boxSides, ctx->boxPlanes );
+
+	return ctx;
+}
+
+/*
+===================
+CM_FreeTraceContext
+===================
+*/
+void CM_FreeTraceContext( cmTraceContext_t *ctx ) {
+	if ( ctx && ctx != &cm_traceContext ) {
+		Z_Free( ctx );
+	}
+}
+
 /*
 ===================
 CM_ModelBounds
@@ -62,12 +62,10 @@ typedef struct {
 	vec3_t		bounds[2];
 	int			numsides;
 	cbrushside_t	*sides;
-	int			checkcount;		// to avoid repeated testings
 } cbrush_t;
 
 
 typedef struct {
-	int			checkcount;				// to avoid repeated testings
 	int			surfaceFlags;
 	int			contents;
 	struct patchCollide_s	*pc;
@@ -125,10 +123,74 @@ typedef struct {
 	cPatch_t	**surfaces;			// non-patches will be NULL
 
 	int			floodvalid;
-	int			checkcount;					// incremented on each trace
 } clipMap_t;
 
 
+/*
+A trace context holds everything a trace writes to, so two threads can
+trace the same map at once as long as each uses its own context.
+Brushes and patches already tested in another leaf are remembered in
+bitsets whose words are only valid while their stamp matches the
+current generation, so starting a trace never has to clear them.
+*/
+#define	CM_VISIT_WORDS(n)	(((n) + 31) >> 5)
+#define	CM_VISIT_BRUSHES	(MAX_MAP_BRUSHES + 1)	// + the shared box brush
+
+struct cmTraceContext_s {
+	unsigned	generation;		// incremented on each trace
+
+	unsigned	brushStamp[CM_VISIT_WORDS(CM_VISIT_BRUSHES)];
+	unsigned	brushBits[CM_VISIT_WORDS(CM_VISIT_BRUSHES)];
+	unsigned	patchStamp[CM_VISIT_WORDS(MAX_MAP_DRAW_SURFS)];
+	unsigned	patchBits[CM_VISIT_WORDS(MAX_MAP_DRAW_SURFS)];
+
+	// private temp box, the shared context uses the one in cm.brushes
+	qboolean	ownBox;
+	cmodel_t	boxModel;
+	cbrush_t	boxBrush;
+	cbrushside_t	boxSides[6];
+	cplane_t	boxPlanes[12];
+};
+
+// used by the plain CM_BoxTrace family, main thread only
+extern	cmTraceContext_t	cm_traceContext;
+
+void CM_BeginTraceGeneration( cmTraceContext_t *ctx );
+
+// returns qtrue if the brush was already visited during this generation
+static ID_INLINE qboolean CM_CheckBrushVisited( cmTraceContext_t *ctx, int brushnum ) {
+	int			word = brushnum >> 5;
+	unsigned	bit = 1u << ( brushnum & 31 );
+
+	if ( ctx->brushStamp[word] != ctx->generation ) {
+		ctx->brushStamp[word] = ctx->generation;
+		ctx->brushBits[word] = bit;
+		return qfalse;
+	}
+	if ( ctx->brushBits[word] & bit ) {
+		return qtrue;
+	}
+	ctx->brushBits[word] |= bit;
+	return qfalse;
+}
+
+static ID_INLINE qboolean CM_CheckPatchVisited( cmTraceContext_t *ctx, int surfnum ) {
+	int			word = surfnum >> 5;
+	unsigned	bit = 1u << ( surfnum & 31 );
+
+	if ( ctx->patchStamp[word] != ctx->generation ) {
+		ctx->patchStamp[word] = ctx->generation;
+		ctx->patchBits[word] = bit;
+		return qfalse;
+	}
+	if ( ctx->patchBits[word] & bit ) {
+		return qtrue;
+	}
+	ctx->patchBits[word] |= bit;
+	return qfalse;
+}
+
+
 // keep 1/8 unit away to keep the position valid before network snapping
 // and to avoid various numeric issues
 #define	SURFACE_CLIP_EPSILON	(0.125)
@@ -139,6 +201,7 @@ extern	int			c_traces, c_brush_traces, c_patch_traces;
 extern	cvar_t		*cm_noAreas;
 extern	cvar_t		*cm_noCurves;
 extern	cvar_t		*cm_playerCurveClip;
+extern	cvar_t		*cm_debugSurfaceUpdate;
 
 // cm_test.c
 
@@ -164,6 +227,7 @@ typedef struct {
 	qboolean	isPoint;	// optimized case
 	trace_t		trace;		// returned from trace call
 	sphere_t	sphere;		// sphere for oriendted capsule collision
+	cmTraceContext_t	*ctx;	// visit state and temp box of the caller
 } traceWork_t;
 
 typedef struct leafList_s {
@@ -185,6 +249,8 @@ void CM_StoreBrushes( leafList_t *ll, int nodenum );
 void CM_BoxLeafnums_r( leafList_t *ll, int nodenum );
 
 cmodel_t	*CM_ClipHandleToModel( clipHandle_t handle );
+void		CM_SetupBoxBrush( cbrush_t *brush, cbrushside_t *sides, cplane_t *planes );
+void		CM_SetBoxBounds( cmodel_t *model, cbrush_t *brush, cplane_t *planes, const vec3_t mins, const vec3_t maxs );
 qboolean CM_BoundsIntersect( const vec3_t mins, const vec3_t maxs, const vec3_t mins2, const vec3_t maxs2 );
 qboolean CM_BoundsIntersectPoint( const vec3_t mins, const vec3_t maxs, const vec3_t point );
 
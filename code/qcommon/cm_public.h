@@ -31,6 +31,7 @@ clipHandle_t CM_TempBoxModel( const vec3_t mins, const vec3_t maxs, int capsule
 void		CM_ModelBounds( clipHandle_t model, vec3_t mins, vec3_t maxs );
 
 int			CM_NumClusters (void);
+int			CM_NumAreas (void);
 int			CM_NumInlineModels( void );
 char		*CM_EntityString (void);
 
@@ -46,6 +47,24 @@ void		CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule );
 
+// The calls above share one trace context and must stay on the main
+// thread. Any other thread that traces needs a context of its own; temp
+// box and capsule handles are then only valid with the context they
+// were made for. Contexts are created and freed on the main thread,
+// passing NULL selects the shared one.
+typedef struct cmTraceContext_s cmTraceContext_t;
+
+cmTraceContext_t *CM_CreateTraceContext( void );
+void		CM_FreeTraceContext( cmTraceContext_t *ctx );
+clipHandle_t CM_TempBoxModelContext( cmTraceContext_t *ctx, const vec3_t mins, const vec3_t maxs, int capsule );
+void		CM_BoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask, int capsule );
+void		CM_TransformedBoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask,
+						  const vec3_t origin, const vec3_t angles, int capsule );
+
 byte		*CM_ClusterPVS (int cluster);
 
 int			CM_PointLeafnum( const vec3_t p );
@@ -28,6 +28,39 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 //#define CAPSULE_DEBUG
 
+cmTraceContext_t	cm_traceContext;
+
+/*
+================
+CM_BeginTraceGeneration
+
+Forgets every brush and patch visited by the previous trace
+================
+*/
+void CM_BeginTraceGeneration( cmTraceContext_t *ctx ) {
+	ctx->generation++;
+	if ( !ctx->generation ) {
+		// wrapped around, old stamps could match again
+		memset( ctx->brushStamp, 0, sizeof( ctx->brushStamp ) );
+		memset( ctx->patchStamp, 0, sizeof( ctx->patchStamp ) );
+		ctx->generation = 1;
+	}
+}
+
+/*
+================
+CM_TraceHandleToModel
+
+Temp box and capsule handles resolve to the box of the trace context
+================
+*/
+static cmodel_t *CM_TraceHandleToModel( cmTraceContext_t *ctx, clipHandle_t handle ) {
+	if ( ctx->ownBox && ( handle == BOX_MODEL_HANDLE || handle == CAPSULE_MODEL_HANDLE ) ) {
+		return &ctx->boxModel;
+	}
+	return CM_ClipHandleToModel( handle );
+}
+
 /*
 ===============================================================================
 
@@ -245,15 +278,23 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	int			brushnum;
 	cbrush_t	*b;
 	cPatch_t	*patch;
+	int			surfnum;
+
+	if ( leaf == &tw->ctx->boxModel.leaf ) {
+		// private temp box, not part of cm.brushes
+		if ( tw->ctx->boxBrush.contents & tw->contents ) {
+			CM_TestBoxInBrush( tw, &tw->ctx->boxBrush );
+		}
+		return;
+	}
 
 	// test box position against all brushes in the leaf
 	for (k=0 ; k<leaf->numLeafBrushes ; k++) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
-		b = &cm.brushes[brushnum];
-		if (b->checkcount == cm.checkcount) {
+		if ( CM_CheckBrushVisited( tw->ctx, brushnum ) ) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		b = &cm.brushes[brushnum];
 
 		if ( !(b->contents & tw->contents)) {
 			continue;
@@ -272,14 +313,14 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	if ( !cm_noCurves->integer ) {
 #endif //BSPC
 		for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
-			patch = cm.surfaces[ cm.leafsurfaces[ leaf->firstLeafSurface + k ] ];
+			surfnum = cm.leafsurfaces[ leaf->firstLeafSurface + k ];
+			patch = cm.surfaces[ surfnum ];
 			if ( !patch ) {
 				continue;
 			}
-			if ( patch->checkcount == cm.checkcount ) {
+			if ( CM_CheckPatchVisited( tw->ctx, surfnum ) ) {
 				continue;	// already checked this brush in another leaf
 			}
-			patch->checkcount = cm.checkcount;
 
 			if ( !(patch->contents & tw->contents)) {
 				continue;
@@ -309,8 +350,11 @@ void CM_TestCapsuleInCapsule( traceWork_t *tw, clipHandle_t model ) {
 	vec3_t p1, p2, tmp;
 	vec3_t offset, symetricSize[2];
 	float radius, halfwidth, halfheight, offs, r;
+	cmodel_t *cmod;
 
-	CM_ModelBounds(model, mins, maxs);
+	cmod = CM_TraceHandleToModel( tw->ctx, model );
+	VectorCopy( cmod->mins, mins );
+	VectorCopy( cmod->maxs, maxs );
 
 	VectorAdd(tw->start, tw->sphere.offset, top);
 	VectorSubtract(tw->start, tw->sphere.offset, bottom);
@@ -378,7 +422,9 @@ void CM_TestBoundingBoxInCapsule( traceWork_t *tw, clipHandle_t model ) {
 	int i;
 
 	// mins maxs of the capsule
-	CM_ModelBounds(model, mins, maxs);
+	cmod = CM_TraceHandleToModel( tw->ctx, model );
+	VectorCopy( cmod->mins, mins );
+	VectorCopy( cmod->maxs, maxs );
 
 	// offset for capsule center
 	for ( i = 0 ; i < 3 ; i++ ) {
@@ -396,9 +442,9 @@ void CM_TestBoundingBoxInCapsule( traceWork_t *tw, clipHandle_t model ) {
 	VectorSet( tw->sphere.offset, 0, 0, size[1][2] - tw->sphere.radius );
 
 	// replace the capsule with the bounding box
-	h = CM_TempBoxModel(tw->size[0], tw->size[1], qfalse);
+	h = CM_TempBoxModelContext(tw->ctx, tw->size[0], tw->size[1], qfalse);
 	// calculate collision
-	cmod = CM_ClipHandleToModel( h );
+	cmod = CM_TraceHandleToModel( tw->ctx, h );
 	CM_TestInLeaf( tw, &cmod->leaf );
 }
 
@@ -429,12 +475,9 @@ void CM_PositionTest( traceWork_t *tw ) {
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
 
-	cm.checkcount++;
-
 	CM_BoxLeafnums_r( &ll, 0 );
 
-
-	cm.checkcount++;
+	CM_BeginTraceGeneration( tw->ctx );
 
 	// test the contents of the leafs
 	for (i=0 ; i < ll.count ; i++) {
@@ -672,16 +715,26 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	int			brushnum;
 	cbrush_t	*b;
 	cPatch_t	*patch;
+	int			surfnum;
+
+	if ( leaf == &tw->ctx->boxModel.leaf ) {
+		// private temp box, not part of cm.brushes
+		b = &tw->ctx->boxBrush;
+		if ( ( b->contents & tw->contents ) && CM_BoundsIntersect( tw->bounds[0], tw->bounds[1],
+					b->bounds[0], b->bounds[1] ) ) {
+			CM_TraceThroughBrush( tw, b );
+		}
+		return;
+	}
 
 	// trace line against all brushes in the leaf
 	for ( k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
 
-		b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
+		if ( CM_CheckBrushVisited( tw->ctx, brushnum ) ) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		b = &cm.brushes[brushnum];
 
 		if ( !(b->contents & tw->contents) ) {
 			continue;
@@ -705,14 +758,14 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	if ( !cm_noCurves->integer ) {
 #endif
 		for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
-			patch = cm.surfaces[ cm.leafsurfaces[ leaf->firstLeafSurface + k ] ];
+			surfnum = cm.leafsurfaces[ leaf->firstLeafSurface + k ];
+			patch = cm.surfaces[ surfnum ];
 			if ( !patch ) {
 				continue;
 			}
-			if ( patch->checkcount == cm.checkcount ) {
+			if ( CM_CheckPatchVisited( tw->ctx, surfnum ) ) {
 				continue;	// already checked this patch in another leaf
 			}
-			patch->checkcount = cm.checkcount;
 
 			if ( !(patch->contents & tw->contents) ) {
 				continue;
@@ -934,8 +987,11 @@ void CM_TraceCapsuleThroughCapsule( traceWork_t *tw, clipHandle_t model ) {
 	vec3_t top, bottom, starttop, startbottom, endtop, endbottom;
 	vec3_t offset, symetricSize[2];
 	float radius, halfwidth, halfheight, offs, h;
+	cmodel_t *cmod;
 
-	CM_ModelBounds(model, mins, maxs);
+	cmod = CM_TraceHandleToModel( tw->ctx, model );
+	VectorCopy( cmod->mins, mins );
+	VectorCopy( cmod->maxs, maxs );
 	// test trace bounds vs. capsule bounds
 	if ( tw->bounds[0][0] > maxs[0] + RADIUS_EPSILON
 		|| tw->bounds[0][1] > maxs[1] + RADIUS_EPSILON
@@ -997,7 +1053,9 @@ void CM_TraceBoundingBoxThroughCapsule( traceWork_t *tw, clipHandle_t model ) {
 	int i;
 
 	// mins maxs of the capsule
-	CM_ModelBounds(model, mins, maxs);
+	cmod = CM_TraceHandleToModel( tw->ctx, model );
+	VectorCopy( cmod->mins, mins );
+	VectorCopy( cmod->maxs, maxs );
 
 	// offset for capsule center
 	for ( i = 0 ; i < 3 ; i++ ) {
@@ -1015,9 +1073,9 @@ void CM_TraceBoundingBoxThroughCapsule( traceWork_t *tw, clipHandle_t model ) {
 	VectorSet( tw->sphere.offset, 0, 0, size[1][2] - tw->sphere.radius );
 
 	// replace the capsule with the bounding box
-	h = CM_TempBoxModel(tw->size[0], tw->size[1], qfalse);
+	h = CM_TempBoxModelContext(tw->ctx, tw->size[0], tw->size[1], qfalse);
 	// calculate collision
-	cmod = CM_ClipHandleToModel( h );
+	cmod = CM_TraceHandleToModel( tw->ctx, h );
 	CM_TraceThroughLeaf( tw, &cmod->leaf );
 }
 
@@ -1146,21 +1204,22 @@ void CM_TraceThroughTree( traceWork_t *tw, int num, float p1f, float p2f, vec3_t
 CM_Trace
 ==================
 */
-void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mins, vec3_t maxs,
+static void CM_Trace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end, vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, const vec3_t origin, int brushmask, int capsule, sphere_t *sphere ) {
 	int			i;
 	traceWork_t	tw;
 	vec3_t		offset;
 	cmodel_t	*cmod;
 
-	cmod = CM_ClipHandleToModel( model );
+	cmod = CM_TraceHandleToModel( ctx, model );
 
-	cm.checkcount++;		// for multi-check avoidance
+	CM_BeginTraceGeneration( ctx );	// for multi-check avoidance
 
 	c_traces++;				// for statistics, may be zeroed
 
 	// fill in a default trace
 	memset( &tw, 0, sizeof(tw) );
+	tw.ctx = ctx;
 	tw.trace.fraction = 1;	// assume it goes the entire distance until shown otherwise
 	VectorCopy(origin, tw.modelOrigin);
 
@@ -1367,7 +1426,21 @@ CM_BoxTrace
 void CM_BoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
 						  vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, int brushmask, int capsule ) {
-	CM_Trace( results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
+	CM_Trace( &cm_traceContext, results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
+}
+
+/*
+==================
+CM_BoxTraceContext
+==================
+*/
+void CM_BoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask, int capsule ) {
+	if ( !ctx ) {
+		ctx = &cm_traceContext;
+	}
+	CM_Trace( ctx, results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
 }
 
 /*
@@ -1378,7 +1451,7 @@ Handles offseting and rotation of the end points for moving and
 rotating entities
 ==================
 */
-void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
+void CM_TransformedBoxTraceContext( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
 						  vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule ) {
@@ -1394,6 +1467,9 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 	float		t;
 	sphere_t	sphere;
 
+	if ( !ctx ) {
+		ctx = &cm_traceContext;
+	}
 	if ( !mins ) {
 		mins = vec3_origin;
 	}
@@ -1452,7 +1528,7 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 	}
 
 	// sweep the box through the model
-	CM_Trace( &trace, start_l, end_l, symetricSize[0], symetricSize[1], model, origin, brushmask, capsule, &sphere );
+	CM_Trace( ctx, &trace, start_l, end_l, symetricSize[0], symetricSize[1], model, origin, brushmask, capsule, &sphere );
 
 	// if the bmodel was rotated and there was a collision
 	if ( rotated && trace.fraction != 1.0 ) {
@@ -1469,3 +1545,16 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 
 	*results = trace;
 }
+
+/*
+==================
+CM_TransformedBoxTrace
+==================
+*/
+void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask,
+						  const vec3_t origin, const vec3_t angles, int capsule ) {
+	CM_TransformedBoxTraceContext( &cm_traceContext, results, start, end, mins, maxs,
+		model, brushmask, origin, angles, capsule );
+}
@@ -344,6 +344,9 @@ void QDECL Com_Error( int code, const char *fmt, ... )
 	
 	lastErrorTime = currentTime;
 
+	// the frame is abandoned, so open packet batches never get closed
+	NET_AbortPacketBatch();
+
 	va_start(argptr, fmt);
 	Q_vsnprintf(com_errorMessage, sizeof(com_errorMessage), fmt, argptr);
 	va_end (argptr);
@@ -818,6 +821,7 @@ all big things are allocated on the hunk.
 */
 
 #define	ZONEID	0x1d4a11
+#define	SLABID	0x1d4a12
 #define MINFRAGMENT	64
 
 typedef struct zonedebug_s {
@@ -831,7 +835,7 @@ typedef struct memblock_s {
 	int		size;           // including the header and possibly tiny fragments
 	int     tag;            // a tag of 0 is a free block
 	struct memblock_s       *next, *prev;
-	int     id;        		// should be ZONEID
+	int     id;        		// should be ZONEID or SLABID
 #ifdef ZONE_DEBUG
 	zonedebug_t d;
 #endif
@@ -849,6 +853,9 @@ static memzone_t *mainzone;
 // we also have a small zone for small allocations that would only fragment the main zone (think of cvar and cmd strings)
 static memzone_t *smallzone;
 
+// guards both zones and the slab lists, but not the per thread caches
+static sysMutex_t *zoneLock;
+
 static void Z_CheckHeap( void );
 
 static void Z_ClearZone( memzone_t *zone, int size )
@@ -890,43 +897,90 @@ int Z_AvailableMemory( void ) {
 	return Z_AvailableZoneMemory( mainzone );
 }
 
-
-void Z_Free( void *ptr ) {
-	memblock_t	*block, *other;
-	memzone_t *zone;
-	
-	if (!ptr) {
-		Com_Error( ERR_DROP, "Z_Free: NULL pointer" );
+static ID_INLINE void Z_Lock( void ) {
+	if ( zoneLock ) {
+		Sys_LockMutex( zoneLock );
 	}
+}
 
-	block = (memblock_t *) ( (unsigned char *)ptr - sizeof(memblock_t));
-	if (block->id != ZONEID) {
-		Com_Error( ERR_FATAL, "Z_Free: freed a pointer without ZONEID" );
-	}
-	if (block->tag == 0) {
-		Com_Error( ERR_FATAL, "Z_Free: freed a freed pointer" );
-	}
-	// if static memory
-	if (block->tag == TAG_STATIC) {
-		return;
+static ID_INLINE void Z_Unlock( void ) {
+	if ( zoneLock ) {
+		Sys_UnlockMutex( zoneLock );
 	}
+}
 
-	// check the memory trash tester
-	if ( *(int *)((unsigned char *)block + block->size - 4 ) != ZONEID ) {
-		Com_Error( ERR_FATAL, "Z_Free: memory block wrote past end" );
-	}
+/*
+================
+Z_ZoneAlloc
 
-	if (block->tag == TAG_SMALL) {
-		zone = smallzone;
-	}
-	else {
-		zone = mainzone;
+First fit from the rover, size includes the header and trash tester.
+Returns NULL if the zone is full.  Caller holds zoneLock.
+================
+*/
+static memblock_t *Z_ZoneAlloc( memzone_t *zone, int size, int tag ) {
+	int		extra;
+	memblock_t	*start, *rover, *new, *base;
+
+	//
+	// scan through the block list looking for the first free block
+	// of sufficient size
+	//
+	base = rover = zone->rover;
+	start = base->prev;
+	
+	do {
+		if (rover == start)	{
+			// scaned all the way around the list
+			return NULL;
+		}
+		if (rover->tag) {
+			base = rover = rover->next;
+		} else {
+			rover = rover->next;
+		}
+	} while (base->tag || base->size < size);
+	
+	//
+	// found a block big enough
+	//
+	extra = base->size - size;
+	if (extra > MINFRAGMENT) {
+		// there will be a free fragment after the allocated block
+		new = (memblock_t *) ((byte *)base + size );
+		new->size = extra;
+		new->tag = 0;			// free block
+		new->prev = base;
+		new->id = ZONEID;
+		new->next = base->next;
+		new->next->prev = new;
+		base->next = new;
+		base->size = size;
 	}
+	
+	base->tag = tag;			// no longer a free block
+	
+	zone->rover = base->next;	// next allocation will start looking here
+	zone->used += base->size;	//
+	
+	base->id = ZONEID;
+
+	return base;
+}
+
+/*
+================
+Z_ZoneFree
+
+Caller holds zoneLock
+================
+*/
+static void Z_ZoneFree( memzone_t *zone, memblock_t *block ) {
+	memblock_t	*other;
 
 	zone->used -= block->size;
 	// set the block to something that should cause problems
 	// if it is referenced...
-	memset( ptr, 0xaa, block->size - sizeof( *block ) );
+	memset( block + 1, 0xaa, block->size - sizeof( *block ) );
 
 	block->tag = 0;		// mark as free
 	
@@ -953,6 +1007,372 @@ void Z_Free( void *ptr ) {
 	}
 }
 
+/*
+==============================================================================
+
+SLAB ALLOCATOR
+
+Small blocks come from size classes carved out of slab pages, which are
+ordinary TAG_SLAB blocks in the zone the allocation would have used.
+A slab object keeps the memblock_t header so Z_Free and the heap logs
+can tell it apart by its SLABID; prev points at the owning slab and
+next links free objects.
+
+Every thread keeps a short free list per class, so a Z_Malloc / Z_Free
+pair normally takes no lock.  Only whole batches move between a thread
+and the slabs.
+==============================================================================
+*/
+
+#define	SLAB_PAGE_SIZE		4096
+#define	SLAB_CACHE_MAX		32		// free objects a thread holds per class
+#define	NUM_SLAB_CLASSES	7
+
+#define	SLAB_MAIN			0
+#define	SLAB_SMALL			1
+
+#ifdef _MSC_VER
+#define	Z_THREADLOCAL		__declspec(thread)
+#else
+#define	Z_THREADLOCAL		__thread
+#endif
+
+// object sizes, including the header and trash tester
+static const int slabClassSize[NUM_SLAB_CLASSES] = { 64, 96, 128, 192, 256, 384, 512 };
+
+typedef struct slab_s {
+	struct slab_s	*next, *prev;
+	memblock_t		*free;			// objects not handed out
+	int				used;			// objects handed out, thread caches included
+	int				numObjects;
+	int				zoneNum;
+	int				classNum;
+} slab_t;
+
+typedef struct {
+	slab_t		*partial;			// slabs with free objects
+	slab_t		*full;
+	int			numSlabs;
+} slabClass_t;
+
+typedef struct {
+	memblock_t	*free[2][NUM_SLAB_CLASSES];
+	int			count[2][NUM_SLAB_CLASSES];
+} slabCache_t;
+
+static slabClass_t	slabClasses[2][NUM_SLAB_CLASSES];
+static Z_THREADLOCAL slabCache_t	slabCache;
+
+// zonebench turns the slabs off to time the rover alone, for its own
+// thread only
+static Z_THREADLOCAL qboolean	z_noSlabs;
+
+static ID_INLINE memzone_t *Z_SlabZone( int zoneNum ) {
+	return zoneNum == SLAB_SMALL ? smallzone : mainzone;
+}
+
+static ID_INLINE memblock_t *Z_SlabObject( slab_t *slab, int index ) {
+	return (memblock_t *)( (byte *)slab + PAD( sizeof( *slab ), sizeof( intptr_t ) ) +
+		index * slabClassSize[slab->classNum] );
+}
+
+static int Z_SlabClassForSize( int size ) {
+	int		i;
+
+	if ( z_noSlabs ) {
+		return -1;
+	}
+
+	for ( i = 0; i < NUM_SLAB_CLASSES; i++ ) {
+		if ( size <= slabClassSize[i] ) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static void Z_SlabLink( slab_t **list, slab_t *slab ) {
+	slab->prev = NULL;
+	slab->next = *list;
+	if ( *list ) {
+		(*list)->prev = slab;
+	}
+	*list = slab;
+}
+
+static void Z_SlabUnlink( slab_t **list, slab_t *slab ) {
+	if ( slab->prev ) {
+		slab->prev->next = slab->next;
+	} else {
+		*list = slab->next;
+	}
+	if ( slab->next ) {
+		slab->next->prev = slab->prev;
+	}
+}
+
+/*
+================
+Z_NewSlab
+
+Caller holds zoneLock
+================
+*/
+static slab_t *Z_NewSlab( int zoneNum, int classNum ) {
+	slabClass_t	*cls = &slabClasses[zoneNum][classNum];
+	memblock_t	*block, *obj;
+	slab_t		*slab;
+	int			i;
+
+	block = Z_ZoneAlloc( Z_SlabZone( zoneNum ), SLAB_PAGE_SIZE, TAG_SLAB );
+	if ( !block ) {
+		return NULL;
+	}
+#ifdef ZONE_DEBUG
+	block->d.label = "slab";
+	block->d.file = __FILE__;
+	block->d.line = __LINE__;
+	block->d.allocSize = SLAB_PAGE_SIZE;
+#endif
+	*(int *)((byte *)block + block->size - 4) = ZONEID;
+
+	slab = (slab_t *)( block + 1 );
+	slab->free = NULL;
+	slab->used = 0;
+	slab->zoneNum = zoneNum;
+	slab->classNum = classNum;
+	slab->numObjects = ( SLAB_PAGE_SIZE - sizeof( *block ) - 4 - PAD( sizeof( *slab ), sizeof( intptr_t ) ) ) /
+		slabClassSize[classNum];
+
+	// push backwards so objects are handed out in address order
+	for ( i = slab->numObjects - 1; i >= 0; i-- ) {
+		obj = Z_SlabObject( slab, i );
+		obj->size = slabClassSize[classNum];
+		obj->tag = 0;
+		obj->id = SLABID;
+		obj->prev = (memblock_t *)slab;
+		obj->next = slab->free;
+		slab->free = obj;
+	}
+
+	Z_SlabLink( &cls->partial, slab );
+	cls->numSlabs++;
+
+	return slab;
+}
+
+/*
+================
+Z_SlabReturn
+
+Gives a free object back to its slab.  Caller holds zoneLock.
+================
+*/
+static void Z_SlabReturn( memblock_t *obj ) {
+	slab_t		*slab = (slab_t *)obj->prev;
+	slabClass_t	*cls = &slabClasses[slab->zoneNum][slab->classNum];
+
+	if ( !slab->free ) {
+		Z_SlabUnlink( &cls->full, slab );
+		Z_SlabLink( &cls->partial, slab );
+	}
+
+	obj->next = slab->free;
+	slab->free = obj;
+	slab->used--;
+
+	// empty pages go back to the zone, but a class keeps its last one
+	if ( !slab->used && cls->numSlabs > 1 ) {
+		Z_SlabUnlink( &cls->partial, slab );
+		cls->numSlabs--;
+		Z_ZoneFree( Z_SlabZone( slab->zoneNum ), (memblock_t *)slab - 1 );
+	}
+}
+
+/*
+================
+Z_SlabRefill
+
+Moves half a cache worth of objects to this thread.  Returns NULL if
+the zone has no room for another slab page.
+================
+*/
+static memblock_t *Z_SlabRefill( int zoneNum, int classNum ) {
+	slabClass_t	*cls = &slabClasses[zoneNum][classNum];
+	slabCache_t	*cache = &slabCache;
+	slab_t		*slab;
+	memblock_t	*obj;
+
+	Z_Lock();
+	while ( cache->count[zoneNum][classNum] < SLAB_CACHE_MAX / 2 ) {
+		slab = cls->partial;
+		if ( !slab ) {
+			slab = Z_NewSlab( zoneNum, classNum );
+			if ( !slab ) {
+				break;
+			}
+		}
+
+		obj = slab->free;
+		slab->free = obj->next;
+		slab->used++;
+		if ( !slab->free ) {
+			Z_SlabUnlink( &cls->partial, slab );
+			Z_SlabLink( &cls->full, slab );
+		}
+
+		obj->next = cache->free[zoneNum][classNum];
+		cache->free[zoneNum][classNum] = obj;
+		cache->count[zoneNum][classNum]++;
+	}
+	Z_Unlock();
+
+	return cache->free[zoneNum][classNum];
+}
+
+/*
+================
+Z_SlabFree
+================
+*/
+static void Z_SlabFree( memblock_t *obj ) {
+	slab_t		*slab = (slab_t *)obj->prev;
+	slabCache_t	*cache = &slabCache;
+	int			zoneNum = slab->zoneNum;
+	int			classNum = slab->classNum;
+	int			i;
+
+	// set the block to something that should cause problems
+	// if it is referenced...
+	memset( obj + 1, 0xaa, obj->size - sizeof( *obj ) );
+	obj->tag = 0;
+
+	obj->next = cache->free[zoneNum][classNum];
+	cache->free[zoneNum][classNum] = obj;
+
+	if ( ++cache->count[zoneNum][classNum] > SLAB_CACHE_MAX ) {
+		Z_Lock();
+		for ( i = 0; i < SLAB_CACHE_MAX / 2; i++ ) {
+			obj = cache->free[zoneNum][classNum];
+			cache->free[zoneNum][classNum] = obj->next;
+			Z_SlabReturn( obj );
+		}
+		cache->count[zoneNum][classNum] -= SLAB_CACHE_MAX / 2;
+		Z_Unlock();
+	}
+}
+
+/*
+================
+Z_SlabFreeTags
+
+Caller holds zoneLock
+================
+*/
+static void Z_SlabFreeTags( int zoneNum, int tag ) {
+	slabClass_t	*cls;
+	slab_t		*slab, *next;
+	slab_t		**lists[2];
+	memblock_t	*obj;
+	int			i, j, l, last;
+
+	for ( i = 0; i < NUM_SLAB_CLASSES; i++ ) {
+		cls = &slabClasses[zoneNum][i];
+
+		// full slabs move to the head of the partial list as they are
+		// freed from, which has already been walked by then
+		lists[0] = &cls->partial;
+		lists[1] = &cls->full;
+
+		for ( l = 0; l < 2; l++ ) {
+			for ( slab = *lists[l]; slab; slab = next ) {
+				next = slab->next;
+
+				for ( j = 0; j < slab->numObjects; j++ ) {
+					obj = Z_SlabObject( slab, j );
+					if ( obj->tag != tag ) {
+						continue;
+					}
+
+					last = ( slab->used == 1 );
+
+					memset( obj + 1, 0xaa, obj->size - sizeof( *obj ) );
+					obj->tag = 0;
+					Z_SlabReturn( obj );
+
+					if ( last ) {
+						break;		// the page may be gone
+					}
+				}
+			}
+		}
+	}
+}
+
+/*
+================
+Z_ReleaseThreadCache
+
+Hands the calling thread's cached objects back to their slabs, for
+threads that are about to exit
+================
+*/
+void Z_ReleaseThreadCache( void ) {
+	slabCache_t	*cache = &slabCache;
+	memblock_t	*obj;
+	int			z, c;
+
+	Z_Lock();
+	for ( z = 0; z < 2; z++ ) {
+		for ( c = 0; c < NUM_SLAB_CLASSES; c++ ) {
+			while ( cache->free[z][c] ) {
+				obj = cache->free[z][c];
+				cache->free[z][c] = obj->next;
+				Z_SlabReturn( obj );
+			}
+			cache->count[z][c] = 0;
+		}
+	}
+	Z_Unlock();
+}
+
+//==============================================================================
+
+void Z_Free( void *ptr ) {
+	memblock_t	*block;
+	
+	if (!ptr) {
+		Com_Error( ERR_DROP, "Z_Free: NULL pointer" );
+	}
+
+	block = (memblock_t *) ( (unsigned char *)ptr - sizeof(memblock_t));
+	if (block->id != ZONEID && block->id != SLABID) {
+		Com_Error( ERR_FATAL, "Z_Free: freed a pointer without ZONEID" );
+	}
+	if (block->tag == 0) {
+		Com_Error( ERR_FATAL, "Z_Free: freed a freed pointer" );
+	}
+	// if static memory
+	if (block->tag == TAG_STATIC) {
+		return;
+	}
+
+	// check the memory trash tester
+	if ( *(int *)((unsigned char *)block + block->size - 4 ) != ZONEID ) {
+		Com_Error( ERR_FATAL, "Z_Free: memory block wrote past end" );
+	}
+
+	if (block->id == SLABID) {
+		Z_SlabFree( block );
+		return;
+	}
+
+	Z_Lock();
+	Z_ZoneFree( block->tag == TAG_SMALL ? smallzone : mainzone, block );
+	Z_Unlock();
+}
+
 
 /*
 ================
@@ -962,22 +1382,28 @@ Z_FreeTags
 void Z_FreeTags( int tag ) {
 	memzone_t	*zone;
 
+	Z_Lock();
+
 	if ( tag == TAG_SMALL ) {
 		zone = smallzone;
+		Z_SlabFreeTags( SLAB_SMALL, tag );
 	}
 	else {
 		zone = mainzone;
+		Z_SlabFreeTags( SLAB_MAIN, tag );
 	}
 	// use the rover as our pointer, because
-	// Z_Free automatically adjusts it
+	// Z_ZoneFree automatically adjusts it
 	zone->rover = zone->blocklist.next;
 	do {
 		if ( zone->rover->tag == tag ) {
-			Z_Free( (void *)(zone->rover + 1) );
+			Z_ZoneFree( zone, zone->rover );
 			continue;
 		}
 		zone->rover = zone->rover->next;
 	} while ( zone->rover != &zone->blocklist );
+
+	Z_Unlock();
 }
 
 
@@ -992,79 +1418,56 @@ void *Z_TagMallocDebug( int size, int tag, char *label, char *file, int line ) {
 #else
 void *Z_TagMalloc( int size, int tag ) {
 #endif
-	int		extra;
-	memblock_t	*start, *rover, *new, *base;
-	memzone_t *zone;
+	memblock_t	*base;
+	int		zoneNum, classNum;
 
 	if (!tag) {
 		Com_Error( ERR_FATAL, "Z_TagMalloc: tried to use a 0 tag" );
 	}
 
-	if ( tag == TAG_SMALL ) {
-		zone = smallzone;
-	}
-	else {
-		zone = mainzone;
-	}
+	zoneNum = ( tag == TAG_SMALL ) ? SLAB_SMALL : SLAB_MAIN;
 
 #ifdef ZONE_DEBUG
 	allocSize = size;
 #endif
-	//
-	// scan through the block list looking for the first free block
-	// of sufficient size
-	//
 	size += sizeof(memblock_t);	// account for size of block header
 	size += 4;					// space for memory trash tester
 	size = PAD(size, sizeof(intptr_t));		// align to 32/64 bit boundary
-	
-	base = rover = zone->rover;
-	start = base->prev;
-	
-	do {
-		if (rover == start)	{
-			// scaned all the way around the list
+
+	base = NULL;
+
+	classNum = Z_SlabClassForSize( size );
+	if ( classNum >= 0 ) {
+		base = slabCache.free[zoneNum][classNum];
+		if ( !base ) {
+			base = Z_SlabRefill( zoneNum, classNum );
+		}
+		if ( base ) {
+			slabCache.free[zoneNum][classNum] = base->next;
+			slabCache.count[zoneNum][classNum]--;
+			base->tag = tag;
+		}
+	}
+
+	// too big for a slab, or the zone has no room for another slab page
+	if ( !base ) {
+		Z_Lock();
+		base = Z_ZoneAlloc( Z_SlabZone( zoneNum ), size, tag );
+		Z_Unlock();
+	}
+
+	if ( !base ) {
 #ifdef ZONE_DEBUG
-			Z_LogHeap();
+		Z_LogHeap();
 
-			Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone: %s, line: %d (%s)",
-								size, zone == smallzone ? "small" : "main", file, line, label);
+		Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone: %s, line: %d (%s)",
+							size, zoneNum == SLAB_SMALL ? "small" : "main", file, line, label);
 #else
-			Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone",
-								size, zone == smallzone ? "small" : "main");
+		Com_Error(ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone",
+							size, zoneNum == SLAB_SMALL ? "small" : "main");
 #endif
-			return NULL;
-		}
-		if (rover->tag) {
-			base = rover = rover->next;
-		} else {
-			rover = rover->next;
-		}
-	} while (base->tag || base->size < size);
-	
-	//
-	// found a block big enough
-	//
-	extra = base->size - size;
-	if (extra > MINFRAGMENT) {
-		// there will be a free fragment after the allocated block
-		new = (memblock_t *) ((byte *)base + size );
-		new->size = extra;
-		new->tag = 0;			// free block
-		new->prev = base;
-		new->id = ZONEID;
-		new->next = base->next;
-		new->next->prev = new;
-		base->next = new;
-		base->size = size;
+		return NULL;
 	}
-	
-	base->tag = tag;			// no longer a free block
-	
-	zone->rover = base->next;	// next allocation will start looking here
-	zone->used += base->size;	//
-	
-	base->id = ZONEID;
 
 #ifdef ZONE_DEBUG
 	base->d.label = label;
@@ -1138,46 +1541,65 @@ static void Z_CheckHeap( void ) {
 
 /*
 ========================
-Z_LogZoneHeap
+Z_LogBlock
 ========================
 */
-void Z_LogZoneHeap( memzone_t *zone, char *name ) {
+static void Z_LogBlock( memblock_t *block, int *size, int *allocSize, int *numBlocks ) {
 #ifdef ZONE_DEBUG
 	char dump[32], *ptr;
 	int  i, j;
+	char		buf[4096];
+
+	ptr = ((char *) block) + sizeof(memblock_t);
+	j = 0;
+	for (i = 0; i < 20 && i < block->d.allocSize; i++) {
+		if (ptr[i] >= 32 && ptr[i] < 127) {
+			dump[j++] = ptr[i];
+		}
+		else {
+			dump[j++] = '_';
+		}
+	}
+	dump[j] = '\0';
+	Com_sprintf(buf, sizeof(buf), "size = %8d: %s, line: %d (%s) [%s]\r\n", block->d.allocSize, block->d.file, block->d.line, block->d.label, dump);
+	FS_Write(buf, strlen(buf), logfile);
+	*allocSize += block->d.allocSize;
 #endif
-	memblock_t	*block;
+	*size += block->size;
+	(*numBlocks)++;
+}
+
+/*
+========================
+Z_LogZoneHeap
+========================
+*/
+void Z_LogZoneHeap( memzone_t *zone, char *name ) {
+	memblock_t	*block, *obj;
+	slab_t		*slab;
 	char		buf[4096];
 	int size, allocSize, numBlocks;
+	int i;
 
 	if (!logfile || !FS_Initialized())
 		return;
 	size = numBlocks = 0;
-#ifdef ZONE_DEBUG
 	allocSize = 0;
-#endif
 	Com_sprintf(buf, sizeof(buf), "\r\n================\r\n%s log\r\n================\r\n", name);
 	FS_Write(buf, strlen(buf), logfile);
 	for (block = zone->blocklist.next ; block->next != &zone->blocklist; block = block->next) {
-		if (block->tag) {
-#ifdef ZONE_DEBUG
-			ptr = ((char *) block) + sizeof(memblock_t);
-			j = 0;
-			for (i = 0; i < 20 && i < block->d.allocSize; i++) {
-				if (ptr[i] >= 32 && ptr[i] < 127) {
-					dump[j++] = ptr[i];
-				}
-				else {
-					dump[j++] = '_';
+		if (block->tag == TAG_SLAB) {
+			// log the objects rather than the page
+			slab = (slab_t *)(block + 1);
+			for (i = 0; i < slab->numObjects; i++) {
+				obj = Z_SlabObject(slab, i);
+				if (obj->tag) {
+					Z_LogBlock(obj, &size, &allocSize, &numBlocks);
 				}
 			}
-			dump[j] = '\0';
-			Com_sprintf(buf, sizeof(buf), "size = %8d: %s, line: %d (%s) [%s]\r\n", block->d.allocSize, block->d.file, block->d.line, block->d.label, dump);
-			FS_Write(buf, strlen(buf), logfile);
-			allocSize += block->d.allocSize;
-#endif
-			size += block->size;
-			numBlocks++;
+		}
+		else if (block->tag) {
+			Z_LogBlock(block, &size, &allocSize, &numBlocks);
 		}
 	}
 #ifdef ZONE_DEBUG
@@ -1319,25 +1741,74 @@ static	int		s_smallZoneTotal;
 /*
 =================
 Com_Meminfo_f
+
+Walks the zones under zoneLock, other threads allocate too.  Nothing is
+printed until the lock is dropped, so the block list is copied out.
 =================
 */
-void Com_Meminfo_f( void ) {
+typedef struct {
 	memblock_t	*block;
+	int			size, tag;
+} meminfoBlock_t;
+
+void Com_Meminfo_f( void ) {
+	memblock_t	*block, *obj;
+	slab_t		*slab;
+	meminfoBlock_t	*list;
+	int			numList;
+	qboolean	badSize, badLink, badFree;
 	int			zoneBytes, zoneBlocks;
 	int			smallZoneBytes;
 	int			botlibBytes, rendererBytes;
+	int			slabBytes, slabPages;
 	int			unused;
+	int			i;
 
 	zoneBytes = 0;
 	botlibBytes = 0;
 	rendererBytes = 0;
 	zoneBlocks = 0;
+	slabBytes = 0;
+	slabPages = 0;
+	badSize = badLink = badFree = qfalse;
+	list = NULL;
+	numList = 0;
+
+	Z_Lock();
+
+	if ( Cmd_Argc() != 1 ) {
+		for (block = mainzone->blocklist.next, i = 1 ; block->next != &mainzone->blocklist ; block = block->next) {
+			i++;
+		}
+		list = malloc( i * sizeof( *list ) );
+	}
+
 	for (block = mainzone->blocklist.next ; ; block = block->next) {
-		if ( Cmd_Argc() != 1 ) {
-			Com_Printf ("block:%p    size:%7i    tag:%3i\n",
-				(void *)block, block->size, block->tag);
+		if ( list ) {
+			list[numList].block = block;
+			list[numList].size = block->size;
+			list[numList].tag = block->tag;
+			numList++;
 		}
-		if ( block->tag ) {
+		if ( block->tag == TAG_SLAB ) {
+			// count what the page holds
+			slab = (slab_t *)( block + 1 );
+			for ( i = 0; i < slab->numObjects; i++ ) {
+				obj = Z_SlabObject( slab, i );
+				if ( !obj->tag ) {
+					continue;
+				}
+				zoneBytes += obj->size;
+				zoneBlocks++;
+				if ( obj->tag == TAG_BOTLIB ) {
+					botlibBytes += obj->size;
+				} else if ( obj->tag == TAG_RENDERER ) {
+					rendererBytes += obj->size;
+				}
+			}
+			slabBytes += block->size;
+			slabPages++;
+		} else if ( block->tag ) {
 			zoneBytes += block->size;
 			zoneBlocks++;
 			if ( block->tag == TAG_BOTLIB ) {
@@ -1351,19 +1822,29 @@ void Com_Meminfo_f( void ) {
 			break;			// all blocks have been hit	
 		}
 		if ( (byte *)block + block->size != (byte *)block->next) {
-			Com_Printf ("ERROR: block size does not touch the next block\n");
+			badSize = qtrue;
 		}
 		if ( block->next->prev != block) {
-			Com_Printf ("ERROR: next block doesn't have proper back link\n");
+			badLink = qtrue;
 		}
 		if ( !block->tag && !block->next->tag ) {
-			Com_Printf ("ERROR: two consecutive free blocks\n");
+			badFree = qtrue;
 		}
 	}
 
 	smallZoneBytes = 0;
 	for (block = smallzone->blocklist.next ; ; block = block->next) {
-		if ( block->tag ) {
+		if ( block->tag == TAG_SLAB ) {
+			slab = (slab_t *)( block + 1 );
+			for ( i = 0; i < slab->numObjects; i++ ) {
+				obj = Z_SlabObject( slab, i );
+				if ( obj->tag ) {
+					smallZoneBytes += obj->size;
+				}
+			}
+			slabBytes += block->size;
+			slabPages++;
+		} else if ( block->tag ) {
 			smallZoneBytes += block->size;
 		}
 
@@ -1372,6 +1853,24 @@ void Com_Meminfo_f( void ) {
 		}
 	}
 
+	Z_Unlock();
+
+	for ( i = 0; i < numList; i++ ) {
+		Com_Printf ("block:%p    size:%7i    tag:%3i\n",
+			(void *)list[i].block, list[i].size, list[i].tag);
+	}
+	free( list );
+
+	if ( badSize ) {
+		Com_Printf ("ERROR: block size does not touch the next block\n");
+	}
+	if ( badLink ) {
+		Com_Printf ("ERROR: next block doesn't have proper back link\n");
+	}
+	if ( badFree ) {
+		Com_Printf ("ERROR: two consecutive free blocks\n");
+	}
+
 	Com_Printf( "%8i bytes total hunk\n", s_hunkTotal );
 	Com_Printf( "%8i bytes total zone\n", s_zoneTotal );
 	Com_Printf( "\n" );
@@ -1404,6 +1903,74 @@ void Com_Meminfo_f( void ) {
 	Com_Printf( "        %8i bytes in dynamic renderer\n", rendererBytes );
 	Com_Printf( "        %8i bytes in dynamic other\n", zoneBytes - ( botlibBytes + rendererBytes ) );
 	Com_Printf( "        %8i bytes in small Zone memory\n", smallZoneBytes );
+	Com_Printf( "%8i bytes in %i slab pages\n", slabBytes, slabPages );
+}
+
+/*
+=================
+Com_ZoneBench_f
+
+Replays one random mix of allocations and frees through the slab classes
+and then through the rover alone
+=================
+*/
+#define	ZONEBENCH_SLOTS	2048
+
+static void Com_ZoneBench_f( void ) {
+	void		**slots;
+	unsigned	seed;
+	int			iterations, pass, i, slot, size, start;
+	int			msec[2];
+
+	iterations = 1000000;
+	if ( Cmd_Argc() > 1 ) {
+		iterations = atoi( Cmd_Argv( 1 ) );
+	}
+
+	slots = calloc( ZONEBENCH_SLOTS, sizeof( *slots ) );
+	if ( !slots ) {
+		return;
+	}
+
+	for ( pass = 0; pass < 2; pass++ ) {
+		z_noSlabs = ( pass == 1 );
+		seed = 0x1d4a11;
+
+		start = Sys_Milliseconds();
+		for ( i = 0; i < iterations; i++ ) {
+			seed = seed * 1103515245 + 12345;
+			slot = ( seed >> 8 ) % ZONEBENCH_SLOTS;
+
+			if ( slots[slot] ) {
+				Z_Free( slots[slot] );
+				slots[slot] = NULL;
+				continue;
+			}
+
+			// mostly strings and small structures, some larger blocks
+			if ( ( seed >> 28 ) < 12 ) {
+				size = 1 + ( ( seed >> 16 ) & 63 );
+			} else {
+				size = 64 + ( ( seed >> 16 ) & 1023 );
+			}
+			slots[slot] = Z_TagMalloc( size, TAG_GENERAL );
+		}
+
+		for ( i = 0; i < ZONEBENCH_SLOTS; i++ ) {
+			if ( slots[i] ) {
+				Z_Free( slots[i] );
+				slots[i] = NULL;
+			}
+		}
+		msec[pass] = Sys_Milliseconds() - start;
+	}
+
+	z_noSlabs = qfalse;
+	free( slots );
+
+	Com_Printf( "%i operations over %i slots\n", iterations, ZONEBENCH_SLOTS );
+	Com_Printf( "slab: %6i msec\n", msec[0] );
+	Com_Printf( "zone: %6i msec\n", msec[1] );
 }
 
 /*
@@ -1456,6 +2023,12 @@ void Com_TouchMemory( void ) {
 
 void Com_InitSmallZoneMemory( void )
 {
+	// the small zone comes up first
+	zoneLock = Sys_CreateMutex();
+	if ( !zoneLock ) {
+		Com_Error( ERR_FATAL, "Zone lock failed to allocate" );
+	}
+
 	s_smallZoneTotal = 512 * 1024;
 	smallzone = calloc( s_smallZoneTotal, 1 );
 	if ( !smallzone ) {
@@ -1609,6 +2182,7 @@ void Com_InitHunkMemory( void )
 	Hunk_Clear();
 
 	Cmd_AddCommand( "meminfo", Com_Meminfo_f );
+	Cmd_AddCommand( "zonebench", Com_ZoneBench_f );
 #ifdef ZONE_DEBUG
 	Cmd_AddCommand( "zonelog", Z_LogHeap );
 #endif
@@ -1703,6 +2277,8 @@ void Hunk_Clear( void ) {
 	hunk_permanent = &hunk_low;
 	hunk_temp = &hunk_high;
 
+	FS_ForgetPrefetchedFiles();
+
 	Com_Printf("Hunk_Clear: reset the hunk ok\n");
 	VM_Clear();
 #ifdef HUNK_DEBUG
@@ -2785,6 +3361,7 @@ void Com_Init(char *commandLine )
 	Com_RandomBytes( (unsigned char*)&qport, sizeof(int) );
 	Netchan_Init( qport & 0xffff );
 
+	Job_Init();
 	VM_Init();
 	SV_Init();
 
@@ -3188,6 +3765,8 @@ void Com_Frame(void)
 
 	Com_ReadFromPipe( );
 
+	Job_EndFrame();
+
 	com_frameNumber++;
 }
 
@@ -3195,6 +3774,8 @@ void Com_Frame(void)
 
 void Com_Shutdown (void)
 {
+	Job_Shutdown();
+
 	if (logfile) {
 		FS_FCloseFile (logfile);
 		logfile = 0;
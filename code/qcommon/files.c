@@ -217,6 +217,10 @@ typedef struct fileInPack_s {
 	char*                   name;		// name of the file
 	unsigned long			pos;		// file info position in zip
 	unsigned long			len;		// uncompress file size
+	unsigned long			localHeader;	// local header position in zip
+	unsigned long			compressedLen;
+	unsigned long			dataPos;	// found from the local header on first mapped read, 0 until then
+	int						method;		// zip compression method, -1 if it can't be read from the mapping
 	struct	fileInPack_s*	next;		// next file in the hash
 } fileInPack_t;
 
@@ -234,6 +238,10 @@ typedef struct {
 	int				hashSize;					// hash table size (power of 2)
 	fileInPack_t*	*hashTable;					// hash table
 	fileInPack_t*	buildBuffer;				// buffer with the filenames etc.
+	byte			*mapData;					// whole pk3 when fs_mmap is on
+	int				mapLength;
+	int				mapRefs;					// buffers handed out from mapData
+	qboolean		freePending;				// FS_FreePak is waiting on mapRefs
 } pack_t;
 
 typedef struct {
@@ -263,6 +271,8 @@ static  cvar_t          *fs_apppath;
 static	cvar_t		*fs_basepath;
 static	cvar_t		*fs_basegame;
 static	cvar_t		*fs_gamedirvar;
+static	cvar_t		*fs_mmap;
+static	cvar_t		*fs_pakIndex;
 static	searchpath_t	*fs_searchpaths;
 static	int			fs_readCount;			// total bytes read
 static	int			fs_loadCount;			// total files read
@@ -289,11 +299,47 @@ typedef struct {
 	int			zipFilePos;
 	int			zipFileLen;
 	qboolean	zipFile;
+	pack_t		*zipPack;
+	fileInPack_t	*zipEntry;
+	struct prefetchedFile_s	*prefetch;	// reads come from a prefetched buffer
+	int			prefetchPos;
 	char		name[MAX_ZPATH];
 } fileHandleData_t;
 
 static fileHandleData_t	fsh[MAX_FILE_HANDLES];
 
+static void FS_FreePak(pack_t *thepak);
+
+// stored pk3 entries handed out by FS_ReadFile as pointers into the
+// pk3 mapping, until they come back through FS_FreeFile
+#define	MAX_MAPPED_BUFFERS	64
+
+typedef struct {
+	byte		*buffer;
+	int			length;
+	pack_t		*pack;
+	byte		terminator;		// mapped byte under the trailing 0
+} mappedBuffer_t;
+
+static mappedBuffer_t	fs_mappedBuffers[MAX_MAPPED_BUFFERS];
+
+// pk3 entries inflated ahead of time by FS_PrefetchFiles, the first
+// handle opened on one reads from the buffer instead of unzip
+#define	MAX_PREFETCH_FILES	8
+
+typedef struct prefetchedFile_s {
+	pack_t			*pack;			// NULL if the slot is free
+	fileInPack_t	*entry;
+	byte			*buffer;		// temp memory, NULL once handed out
+	qboolean		valid;			// inflated without errors
+	fileHandle_t	handle;			// reading from it, 0 if none
+} prefetchedFile_t;
+
+static prefetchedFile_t	fs_prefetched[MAX_PREFETCH_FILES];
+
+static void FS_ReleasePrefetchedFile( prefetchedFile_t *slot );
+static void FS_AttachPrefetchedFile( fileHandle_t f );
+
 // TTimo - https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=540
 // wether we did a reorder on the current search path when joining the server
 static qboolean fs_reordered;
@@ -397,6 +443,24 @@ static long FS_HashFileName( const char *fname, int hashSize ) {
 	return hash;
 }
 
+/*
+================
+FS_PakHandle
+
+Paks rebuilt from the index cache aren't opened until something
+has to be streamed out of them
+================
+*/
+static unzFile FS_PakHandle( pack_t *pak ) {
+	if ( !pak->handle ) {
+		pak->handle = unzOpen( pak->pakFilename );
+		if ( !pak->handle ) {
+			Com_Error( ERR_FATAL, "Couldn't open %s", pak->pakFilename );
+		}
+	}
+	return pak->handle;
+}
+
 
 static fileHandle_t	FS_HandleForFile(void)
 {
@@ -575,16 +639,85 @@ qboolean FS_CreatePath (char *OSPath)
 	return qfalse;
 }
 
+/*
+=================
+FS_IsPathComponent
+
+qtrue if the path component from s to end is name, compared the way
+a case insensitive filesystem that drops trailing dots would
+=================
+*/
+static qboolean FS_IsPathComponent( const char *s, const char *end, const char *name )
+{
+	int len = strlen( name );
+
+	if ( end - s < len || Q_stricmpn( s, name, len ) )
+		return qfalse;
+
+	for ( s += len; s < end; s++ ) {
+		if ( *s != '.' && *s != ' ' )
+			return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+=================
+FS_IsInDirectory
+
+qtrue if path is, or is inside of, a directory named dir
+=================
+*/
+static qboolean FS_IsInDirectory( const char *path, const char *dir )
+{
+	const char *s, *end;
+
+	for ( s = path; *s; s = end ) {
+		for ( end = s; *end && *end != '/' && *end != '\\'; end++ )
+			;
+
+		if ( FS_IsPathComponent( s, end, dir ) )
+			return qtrue;
+
+		if ( *end )
+			end++;
+	}
+
+	return qfalse;
+}
+
+/*
+=================
+FS_IsNamed
+
+qtrue if the last component of path is name
+=================
+*/
+static qboolean FS_IsNamed( const char *path, const char *name )
+{
+	const char *s, *end;
+
+	end = path + strlen( path );
+	for ( s = end; s > path && s[-1] != '/' && s[-1] != '\\'; s-- )
+		;
+
+	return FS_IsPathComponent( s, end, name );
+}
+
 /*
 =================
 FS_CheckFilenameIsMutable
 
-ERR_FATAL if trying to maniuplate a file with the platform library, QVM, or pk3 extension
+ERR_FATAL if trying to maniuplate a file with the platform library, QVM, or pk3 extension,
+anything in the compiled QVM code cache, or the Vulkan pipeline cache
 =================
  */
 static void FS_CheckFilenameIsMutable( const char *filename,
 		const char *function )
 {
+	const char *relative = filename;
+
 	// Check if the filename ends with the library, QVM, or pk3 extension
 	if( COM_CompareExtension( filename, DLL_EXT )
 		|| COM_CompareExtension( filename, ".qvm" )
@@ -593,6 +726,23 @@ static void FS_CheckFilenameIsMutable( const char *filename,
 		Com_Error( ERR_FATAL, "%s: Not allowed to manipulate '%s' due "
 			"to %s extension", function, filename, COM_GetExtension( filename ) );
 	}
+
+	// VM_LoadCache runs whatever it finds there as native code
+	if( fs_homepath && !Q_stricmpn( filename, fs_homepath->string, strlen( fs_homepath->string ) ) )
+		relative = filename + strlen( fs_homepath->string );
+
+	if( FS_IsInDirectory( relative, "vmcache" ) )
+	{
+		Com_Error( ERR_FATAL, "%s: Not allowed to manipulate '%s' in "
+			"the vmcache directory", function, filename );
+	}
+
+	// vk_createPipelineCache hands it to the driver
+	if( FS_IsNamed( filename, "vkpipelines.cache" ) )
+	{
+		Com_Error( ERR_FATAL, "%s: Not allowed to manipulate '%s'",
+			function, filename );
+	}
 }
 
 /*
@@ -866,6 +1016,9 @@ void FS_FCloseFile( fileHandle_t f )
 	}
 
 	if (fsh[f].zipFile == qtrue) {
+		if ( fsh[f].prefetch ) {
+			FS_ReleasePrefetchedFile( fsh[f].prefetch );
+		}
 		unzCloseCurrentFile( fsh[f].handleFiles.file.z );
 		if ( fsh[f].handleFiles.unique ) {
 			unzClose( fsh[f].handleFiles.file.z );
@@ -1276,10 +1429,12 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 							Com_Error(ERR_FATAL, "Couldn't open %s", pak->pakFilename);
 					}
 					else
-						fsh[*file].handleFiles.file.z = pak->handle;
+						fsh[*file].handleFiles.file.z = FS_PakHandle(pak);
 
 					Q_strncpyz(fsh[*file].name, filename, sizeof(fsh[*file].name));
 					fsh[*file].zipFile = qtrue;
+					fsh[*file].zipPack = pak;
+					fsh[*file].zipEntry = pakFile;
 
 					// set the file position in the zip file (also sets the current file info)
 					unzSetOffset(fsh[*file].handleFiles.file.z, pakFile->pos);
@@ -1289,6 +1444,8 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 					fsh[*file].zipFilePos = pakFile->pos;
 					fsh[*file].zipFileLen = pakFile->len;
 
+					FS_AttachPrefetchedFile( *file );
+
 					if(fs_debug->integer)
 					{
 						Com_Printf("FS_FOpenFileRead: %s (found in '%s')\n", 
@@ -1524,6 +1681,18 @@ int FS_Read( void *buffer, int len, fileHandle_t f )
 	}
 
 	buf = (unsigned char *)buffer;
+
+	if ( fsh[f].prefetch ) {
+		remaining = fsh[f].zipFileLen - fsh[f].prefetchPos;
+		if ( len > remaining ) {
+			len = remaining;
+		}
+		memcpy( buf, fsh[f].prefetch->buffer + fsh[f].prefetchPos, len );
+		fsh[f].prefetchPos += len;
+		fs_readCount += len;
+		return len;
+	}
+
 	fs_readCount += len;
 
 	if (fsh[f].zipFile == qfalse) {
@@ -1638,6 +1807,31 @@ int FS_Seek( fileHandle_t f, long offset, int origin ) {
 		return -1;
 	}
 
+	if ( fsh[f].prefetch ) {
+		switch( origin ) {
+			case FS_SEEK_SET:
+				_origin = 0;
+				break;
+			case FS_SEEK_CUR:
+				_origin = fsh[f].prefetchPos;
+				break;
+			case FS_SEEK_END:
+				_origin = fsh[f].zipFileLen;
+				break;
+			default:
+				Com_Error( ERR_FATAL, "Bad origin in FS_Seek" );
+				return -1;
+		}
+		_origin += offset;
+		if ( _origin < 0 ) {
+			_origin = 0;
+		} else if ( _origin > fsh[f].zipFileLen ) {
+			_origin = fsh[f].zipFileLen;
+		}
+		fsh[f].prefetchPos = _origin;
+		return offset;
+	}
+
 	if (fsh[f].zipFile == qtrue) {
 		//FIXME: this is really, really crappy
 		//(but better than what was here before)
@@ -1791,341 +1985,1388 @@ int	FS_FileIsInPAK(const char *filename, int *pChecksum )
 
 /*
 ============
-FS_ReadFileDir
+FS_MappedDataPos
 
-Filename are relative to the oenarena search path
-a null buffer will just return the file length without loading
-If searchPath is non-NULL search only in that specific search path
+Finds where an entry's data starts from its local header.  The first
+byte of the header is not checked, it may be the trailing 0 of the
+entry before it.
 ============
 */
-long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer)
+static qboolean FS_MappedDataPos( pack_t *pak, fileInPack_t *pakFile )
 {
-	fileHandle_t h;
-	searchpath_t* search;
-	qboolean		isConfig;
-	long			len;
-	unsigned char *	buf = NULL;
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	const byte		*header;
+	unsigned long	pos;
+
+	if ( pakFile->dataPos ) {
+		return qtrue;
 	}
 
-	if ( !qpath || !qpath[0] ) {
-		Com_Error( ERR_FATAL, "FS_ReadFile with empty name" );
+	if ( pakFile->localHeader + 30 > pak->mapLength ) {
+		return qfalse;
 	}
 
-	// if this is a .cfg file and we are playing back a journal, read it from the journal file
-	if( strstr( qpath, ".cfg" ) )
-    {
-		isConfig = qtrue;
-		if( com_journal && com_journal->integer == 2 )
-        {
-			int	r;
+	header = pak->mapData + pakFile->localHeader;
+	if ( header[1] != 'K' || header[2] != 3 || header[3] != 4 ) {
+		return qfalse;
+	}
 
-			Com_DPrintf("Loading %s from journal file.\n", qpath);
-			r = FS_Read( &len, sizeof( len ), com_journalDataFile );
-			if( r != sizeof( len ) )
-            {
-				if (buffer != NULL)
-                    *buffer = NULL;
-				return -1;
-			}
-			// if the file didn't exist when the journal was created
-			if(!len)
-            {
-				if (buffer == NULL)
-                {
-					return 1;			// hack for old journal files
-				}
-				*buffer = NULL;
-				return -1;
-			}
-			if(buffer == NULL)
-            {
-				return len;
-			}
+	pos = pakFile->localHeader + 30 + ( header[26] | ( header[27] << 8 ) ) + ( header[28] | ( header[29] << 8 ) );
 
-			buf = Hunk_AllocateTempMemory(len+1);
-			*buffer = buf;
+	// there is always more zip after the data for the trailing 0
+	if ( pos + pakFile->compressedLen >= pak->mapLength ) {
+		return qfalse;
+	}
 
-			r = FS_Read(buf, len, com_journalDataFile);
-			if( r != len )
-            {
-				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
-			}
+	pakFile->dataPos = pos;
+	return qtrue;
+}
 
-			fs_loadCount++;
-			fs_loadStack++;
+/*
+============
+FS_InflateMapped
 
-			// guarantee that it will have a trailing 0 for string operations
-			buf[len] = 0;
+Inflates a whole deflated entry in one go.  Touches nothing but its
+arguments, so it is safe on any thread.
+============
+*/
+static qboolean FS_InflateMapped( const byte *data, int compressedLen, byte *buf, int len )
+{
+	z_stream	stream;
+	int			err;
 
-			return len;
-		}
+	memset( &stream, 0, sizeof( stream ) );
+	stream.next_in = (byte *)data;
+	stream.avail_in = compressedLen;
+	stream.next_out = buf;
+	stream.avail_out = len;
+
+	// raw deflate, zip entries have no zlib header
+	if ( inflateInit2( &stream, -MAX_WBITS ) != Z_OK ) {
+		return qfalse;
 	}
-    else
-		isConfig = qfalse;
+	err = inflate( &stream, Z_FINISH );
+	inflateEnd( &stream );
 
-	search = searchPath;
+	return err == Z_STREAM_END && stream.total_out == len;
+}
 
-	if(search == NULL)
-	{
-		// look for it in the filesystem or pack files
-		len = FS_FOpenFileRead(qpath, &h, qfalse);
+/*
+============
+FS_ReadMappedFile
+
+Loads an open pk3 entry straight from the pk3 mapping.  Stored entries
+are returned in place, deflated ones are inflated into temp memory in one
+go.  Returns NULL if the entry has to go through unzip instead.
+============
+*/
+static byte *FS_ReadMappedFile( fileHandle_t f )
+{
+	pack_t			*pak;
+	fileInPack_t	*pakFile;
+	mappedBuffer_t	*slot;
+	byte			*data, *buf;
+	int				i;
+
+	// a prefetched buffer is handed over as it is
+	if ( fsh[f].prefetch && fsh[f].prefetchPos == 0 ) {
+		buf = fsh[f].prefetch->buffer;
+		memset( fsh[f].prefetch, 0, sizeof( *fsh[f].prefetch ) );
+		fsh[f].prefetch = NULL;
+
+		// FS_ReadFile counts it again
+		fs_loadStack--;
+		fs_readCount += fsh[f].zipFileLen;
+		return buf;
 	}
-	else
-	{
-		// look for it in a specific search path only
-		len = FS_FOpenFileReadDir(qpath, search, &h, qfalse, unpure);
+
+	if ( !fsh[f].zipFile || !fsh[f].zipPack || !fsh[f].zipPack->mapData ) {
+		return NULL;
 	}
 
-	if( h == 0 )
-    {
-		if ( buffer ) {
-			*buffer = NULL;
+	pak = fsh[f].zipPack;
+	pakFile = fsh[f].zipEntry;
+
+	if ( pakFile->method < 0 || !FS_MappedDataPos( pak, pakFile ) ) {
+		return NULL;
+	}
+
+	data = pak->mapData + pakFile->dataPos;
+
+	if ( pakFile->method == 0 ) {
+		if ( pakFile->compressedLen != pakFile->len ) {
+			return NULL;
 		}
-		// if we are journalling and it is a config file, write a zero to the journal file
-		if ( isConfig && com_journal && com_journal->integer == 1 ) {
-			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
-			len = 0;
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
+
+		// a second reader of the same entry gets a copy, so the two
+		// can't see each other's changes
+		slot = NULL;
+		for ( i = 0; i < MAX_MAPPED_BUFFERS; i++ ) {
+			if ( fs_mappedBuffers[i].buffer == data ) {
+				slot = NULL;
+				break;
+			}
+			if ( !slot && !fs_mappedBuffers[i].buffer ) {
+				slot = &fs_mappedBuffers[i];
+			}
 		}
-		return -1;
-	}
 
-	if ( !buffer )
-    {
-		if ( isConfig && com_journal && com_journal->integer == 1 )
-        {
-			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
+#ifdef Q3_BIG_ENDIAN
+		// loaders byte swap in place, which would stick to the mapping
+		slot = NULL;
+#endif
+
+		if ( !slot ) {
+			buf = Hunk_AllocateTempMemory( pakFile->len + 1 );
+			memcpy( buf, data, pakFile->len );
+			buf[pakFile->len] = 0;
+
+			fs_readCount += pakFile->len;
+			return buf;
 		}
-		FS_FCloseFile(h);
-		return len;
+
+		slot->buffer = data;
+		slot->length = pakFile->len;
+		slot->pack = pak;
+		slot->terminator = data[pakFile->len];
+		pak->mapRefs++;
+
+		// guarantee that it will have a trailing 0 for string operations
+		data[pakFile->len] = 0;
+
+		fs_readCount += pakFile->len;
+		return data;
 	}
 
-	fs_loadCount++;
-	fs_loadStack++;
+	if ( pakFile->method != Z_DEFLATED ) {
+		return NULL;
+	}
 
-	buf = Hunk_AllocateTempMemory(len+1);
-	*buffer = buf;
+	buf = Hunk_AllocateTempMemory( pakFile->len + 1 );
 
-	FS_Read(buf, len, h);
+	if ( !FS_InflateMapped( data, pakFile->compressedLen, buf, pakFile->len ) ) {
+		Hunk_FreeTempMemory( buf );
+		return NULL;
+	}
 
 	// guarantee that it will have a trailing 0 for string operations
-	buf[len] = 0;
-	FS_FCloseFile( h );
+	buf[pakFile->len] = 0;
 
-	// if we are journalling and it is a config file, write it to the journal file
-	if( isConfig && com_journal && com_journal->integer == 1 )
-    {
-		Com_DPrintf( "Writing %s to journal file.\n", qpath );
-		FS_Write( &len, sizeof( len ), com_journalDataFile );
-		FS_Write( buf, len, com_journalDataFile );
-		FS_Flush( com_journalDataFile );
+	fs_readCount += pakFile->len;
+	return buf;
+}
+
+/*
+============
+FS_ReleaseMappedBuffer
+
+Returns qfalse if the buffer did not come from a pk3 mapping
+============
+*/
+static qboolean FS_ReleaseMappedBuffer( void *buffer )
+{
+	mappedBuffer_t	*slot;
+	pack_t			*pak;
+	int				i;
+
+	for ( i = 0, slot = fs_mappedBuffers; i < MAX_MAPPED_BUFFERS; i++, slot++ ) {
+		if ( slot->buffer == buffer ) {
+			break;
+		}
+	}
+	if ( i == MAX_MAPPED_BUFFERS ) {
+		return qfalse;
+	}
+
+	pak = slot->pack;
+	slot->buffer[slot->length] = slot->terminator;
+	slot->buffer = NULL;
+
+	if ( !--pak->mapRefs && pak->freePending ) {
+		FS_FreePak( pak );
+	}
+
+	return qtrue;
+}
+
+/*
+=============================================================================
+
+PREFETCH
+
+=============================================================================
+*/
+
+/*
+============
+FS_ReleasePrefetchedFile
+============
+*/
+static void FS_ReleasePrefetchedFile( prefetchedFile_t *slot )
+{
+	if ( slot->handle ) {
+		fsh[slot->handle].prefetch = NULL;
+	}
+
+	if ( slot->buffer ) {
+		Hunk_FreeTempMemory( slot->buffer );
+		if ( --fs_loadStack == 0 ) {
+			Hunk_ClearTempMemory();
+		}
+	}
+
+	memset( slot, 0, sizeof( *slot ) );
+}
+
+/*
+============
+FS_AttachPrefetchedFile
+
+Called for every pk3 entry that is opened, the first handle on a
+prefetched entry reads from its buffer
+============
+*/
+static void FS_AttachPrefetchedFile( fileHandle_t f )
+{
+	prefetchedFile_t	*slot;
+	int					i;
+
+	for ( i = 0, slot = fs_prefetched; i < MAX_PREFETCH_FILES; i++, slot++ ) {
+		if ( slot->pack == fsh[f].zipPack && slot->entry == fsh[f].zipEntry
+			&& slot->buffer && slot->valid && !slot->handle ) {
+			slot->handle = f;
+			fsh[f].prefetch = slot;
+			fsh[f].prefetchPos = 0;
+			return;
+		}
+	}
+}
+
+static void FS_PrefetchJob( void *data, int index )
+{
+	prefetchedFile_t	*slot = (prefetchedFile_t *)data + index;
+	const byte			*src;
+	int					len;
+
+	if ( !slot->buffer ) {
+		return;
+	}
+
+	src = slot->pack->mapData + slot->entry->dataPos;
+	len = slot->entry->len;
+
+	if ( slot->entry->method == 0 ) {
+		memcpy( slot->buffer, src, len );
+		slot->valid = qtrue;
+	} else {
+		slot->valid = FS_InflateMapped( src, slot->entry->compressedLen, slot->buffer, len );
+	}
+
+	slot->buffer[len] = 0;
+}
+
+/*
+============
+FS_PrefetchFiles
+
+Files that aren't mapped pk3 entries are left to the normal read
+============
+*/
+void FS_PrefetchFiles( const char **qpaths, int count )
+{
+	prefetchedFile_t	*slot;
+	fileInPack_t		*pakFile;
+	fileHandle_t		h;
+	int					i, n;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	FS_FlushPrefetchedFiles();
+
+	for ( i = 0, n = 0; i < count && n < MAX_PREFETCH_FILES; i++ ) {
+		FS_FOpenFileRead( qpaths[i], &h, qfalse );
+		if ( !h ) {
+			continue;
+		}
+
+		pakFile = fsh[h].zipEntry;
+		if ( fsh[h].zipFile && fsh[h].zipPack && fsh[h].zipPack->mapData && pakFile->method >= 0
+			&& ( pakFile->method == Z_DEFLATED || pakFile->compressedLen == pakFile->len )
+			&& FS_MappedDataPos( fsh[h].zipPack, pakFile ) ) {
+			slot = &fs_prefetched[n++];
+			slot->pack = fsh[h].zipPack;
+			slot->entry = pakFile;
+			slot->buffer = Hunk_AllocateTempMemory( pakFile->len + 1 );
+			fs_loadStack++;
+		}
+
+		FS_FCloseFile( h );
+	}
+
+	Job_ParallelFor( "fs prefetch", n, 1, FS_PrefetchJob, fs_prefetched );
+
+	if ( fs_debug->integer ) {
+		for ( i = 0; i < n; i++ ) {
+			Com_Printf( "FS_PrefetchFiles: %s %s\n", fs_prefetched[i].entry->name,
+				fs_prefetched[i].valid ? "ok" : "failed" );
+		}
+	}
+}
+
+/*
+============
+FS_FlushPrefetchedFiles
+
+Newest first, so the temp memory is freed in stack order
+============
+*/
+void FS_FlushPrefetchedFiles( void )
+{
+	int		i;
+
+	for ( i = MAX_PREFETCH_FILES - 1; i >= 0; i-- ) {
+		if ( fs_prefetched[i].pack && !fs_prefetched[i].handle ) {
+			FS_ReleasePrefetchedFile( &fs_prefetched[i] );
+		}
+	}
+}
+
+/*
+============
+FS_ForgetPrefetchedFiles
+============
+*/
+void FS_ForgetPrefetchedFiles( void )
+{
+	int		i;
+
+	for ( i = 0; i < MAX_PREFETCH_FILES; i++ ) {
+		if ( fs_prefetched[i].handle ) {
+			fsh[fs_prefetched[i].handle].prefetch = NULL;
+		}
+		if ( fs_prefetched[i].buffer ) {
+			fs_loadStack--;
+		}
+	}
+
+	memset( fs_prefetched, 0, sizeof( fs_prefetched ) );
+}
+
+/*
+============
+FS_TestPrefetch
+
+Prefetches the files and compares what the prefetched handles read
+against plain FS_ReadFile reads of the same files.  A second handle on
+an entry never gets the prefetched buffer, so the plain read goes
+through unzip.  Compared in chunks, so nothing extra goes to the zone.
+Files that don't get prefetched aren't checked.
+Returns qfalse on a mismatch or a failed inflate.
+============
+*/
+qboolean FS_TestPrefetch( const char **qpaths, int count )
+{
+	byte				chunk[8192];
+	prefetchedFile_t	*slot;
+	fileHandle_t		h;
+	char				*plain;
+	long				len, plainLen, pos;
+	int					i, n, part, checked;
+	qboolean			ok, same;
+
+	if ( count > MAX_PREFETCH_FILES ) {
+		count = MAX_PREFETCH_FILES;
+	}
+
+	FS_PrefetchFiles( qpaths, count );
+
+	// newest first, the temp memory is freed in stack order
+	ok = qtrue;
+	checked = 0;
+	for ( i = count - 1; i >= 0; i-- ) {
+		len = FS_FOpenFileRead( qpaths[i], &h, qfalse );
+		if ( !h ) {
+			continue;
+		}
+
+		if ( fsh[h].prefetch ) {
+			plainLen = FS_ReadFile( qpaths[i], &plain );
+
+			same = ( plain && plainLen == len );
+			for ( pos = 0; same && pos < len; pos += part ) {
+				part = len - pos > (long) sizeof( chunk ) ? (int) sizeof( chunk ) : len - pos;
+				same = FS_Read( chunk, part, h ) == part && !memcmp( chunk, plain + pos, part );
+			}
+
+			if ( !same ) {
+				Com_Printf( S_COLOR_RED "jobtest: prefetched %s differs from a plain read\n", qpaths[i] );
+				ok = qfalse;
+			}
+
+			if ( plain ) {
+				FS_FreeFile( plain );
+			}
+			checked++;
+		} else if ( fsh[h].zipFile ) {
+			// a prefetch that failed to inflate is never attached
+			for ( n = 0, slot = fs_prefetched; n < MAX_PREFETCH_FILES; n++, slot++ ) {
+				if ( slot->pack == fsh[h].zipPack && slot->entry == fsh[h].zipEntry && !slot->valid ) {
+					Com_Printf( S_COLOR_RED "jobtest: prefetching %s failed\n", qpaths[i] );
+					ok = qfalse;
+				}
+			}
+		}
+
+		FS_FCloseFile( h );
+	}
+
+	FS_FlushPrefetchedFiles();
+
+	if ( ok ) {
+		Com_Printf( "jobtest: %i of %i prefetched files match plain reads\n", checked, count );
+	}
+
+	return ok;
+}
+
+/*
+============
+FS_ReadFileDir
+
+Filename are relative to the oenarena search path
+a null buffer will just return the file length without loading
+If searchPath is non-NULL search only in that specific search path
+============
+*/
+long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer)
+{
+	fileHandle_t h;
+	searchpath_t* search;
+	qboolean		isConfig;
+	long			len;
+	unsigned char *	buf = NULL;
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	if ( !qpath || !qpath[0] ) {
+		Com_Error( ERR_FATAL, "FS_ReadFile with empty name" );
+	}
+
+	// if this is a .cfg file and we are playing back a journal, read it from the journal file
+	if( strstr( qpath, ".cfg" ) )
+    {
+		isConfig = qtrue;
+		if( com_journal && com_journal->integer == 2 )
+        {
+			int	r;
+
+			Com_DPrintf("Loading %s from journal file.\n", qpath);
+			r = FS_Read( &len, sizeof( len ), com_journalDataFile );
+			if( r != sizeof( len ) )
+            {
+				if (buffer != NULL)
+                    *buffer = NULL;
+				return -1;
+			}
+			// if the file didn't exist when the journal was created
+			if(!len)
+            {
+				if (buffer == NULL)
+                {
+					return 1;			// hack for old journal files
+				}
+				*buffer = NULL;
+				return -1;
+			}
+			if(buffer == NULL)
+            {
+				return len;
+			}
+
+			buf = Hunk_AllocateTempMemory(len+1);
+			*buffer = buf;
+
+			r = FS_Read(buf, len, com_journalDataFile);
+			if( r != len )
+            {
+				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
+			}
+
+			fs_loadCount++;
+			fs_loadStack++;
+
+			// guarantee that it will have a trailing 0 for string operations
+			buf[len] = 0;
+
+			return len;
+		}
+	}
+    else
+		isConfig = qfalse;
+
+	search = searchPath;
+
+	if(search == NULL)
+	{
+		// look for it in the filesystem or pack files
+		len = FS_FOpenFileRead(qpath, &h, qfalse);
+	}
+	else
+	{
+		// look for it in a specific search path only
+		len = FS_FOpenFileReadDir(qpath, search, &h, qfalse, unpure);
+	}
+
+	if( h == 0 )
+    {
+		if ( buffer ) {
+			*buffer = NULL;
+		}
+		// if we are journalling and it is a config file, write a zero to the journal file
+		if ( isConfig && com_journal && com_journal->integer == 1 ) {
+			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
+			len = 0;
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		return -1;
+	}
+
+	if ( !buffer )
+    {
+		if ( isConfig && com_journal && com_journal->integer == 1 )
+        {
+			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		FS_FCloseFile(h);
+		return len;
+	}
+
+	fs_loadCount++;
+	fs_loadStack++;
+
+	buf = FS_ReadMappedFile(h);
+	if(!buf)
+	{
+		buf = Hunk_AllocateTempMemory(len+1);
+		FS_Read(buf, len, h);
+
+		// guarantee that it will have a trailing 0 for string operations
+		buf[len] = 0;
+	}
+	*buffer = buf;
+	FS_FCloseFile( h );
+
+	// if we are journalling and it is a config file, write it to the journal file
+	if( isConfig && com_journal && com_journal->integer == 1 )
+    {
+		Com_DPrintf( "Writing %s to journal file.\n", qpath );
+		FS_Write( &len, sizeof( len ), com_journalDataFile );
+		FS_Write( buf, len, com_journalDataFile );
+		FS_Flush( com_journalDataFile );
+	}
+	return len;
+}
+
+
+
+
+
+/*
+============
+FS_ReadFile
+
+Filename are relative to the openarena search path
+a null buffer will just return the file length without loading
+============
+*/
+long FS_ReadFile(const char *qpath, char **buffer)
+{
+//  long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer)    
+//	return FS_ReadFileDir(qpath, NULL, qfalse, buffer);
+	qboolean		isConfig;
+
+    if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	if ( !qpath || !qpath[0] ) {
+		Com_Error( ERR_FATAL, "FS_ReadFile with empty name" );
+	}
+
+	// if this is a .cfg file and we are playing back a journal, read it from the journal file
+	if( strstr(qpath, ".cfg") )
+    {
+		isConfig = qtrue;
+		if( com_journal && com_journal->integer == 2 )
+        {
+		    int r;
+        	long len;
+			Com_DPrintf("Loading %s from journal file.\n", qpath);
+			
+            r = FS_Read( &len, sizeof( len ), com_journalDataFile );
+			if( r != sizeof( len ) )
+            {
+				if (buffer != NULL)
+                    *buffer = NULL;
+				return -1;
+			}
+			// if the file didn't exist when the journal was created
+			if(!len)
+            {
+				if (buffer == NULL)
+                {
+					return 1;			// hack for old journal files
+				}
+				*buffer = NULL;
+				return -1;
+			}
+			if(buffer == NULL)
+            {
+				return len;
+			}
+
+			
+            char* buf = Hunk_AllocateTempMemory(len+1);
+			*buffer = buf;
+
+			r = FS_Read(buf, len, com_journalDataFile);
+			if( r != len )
+            {
+				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
+			}
+
+			++fs_loadCount;
+			++fs_loadStack;
+
+			// guarantee that it will have a trailing 0 for string operations
+			buf[len] = 0;
+
+			return len;
+		}
+	}
+    else
+		isConfig = qfalse;
+
+
+    
+	fileHandle_t h;
+	long len = FS_FOpenFileRead(qpath, &h, qfalse);
+
+	if( h == 0 )
+    {
+		if ( buffer ) {
+			*buffer = NULL;
+		}
+		// if we are journalling and it is a config file, write a zero to the journal file
+		if ( isConfig && com_journal && com_journal->integer == 1 ) {
+			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
+			len = 0;
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		return -1;
+	}
+
+	if ( !buffer )
+    {
+		if ( isConfig && com_journal && com_journal->integer == 1 )
+        {
+			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		FS_FCloseFile(h);
+		return len;
+	}
+
+	++fs_loadCount;
+	++fs_loadStack;
+
+	char* buf = (char *)FS_ReadMappedFile(h);
+	if(!buf)
+	{
+		buf = Hunk_AllocateTempMemory(len+1);
+		FS_Read(buf, len, h);
+
+		// guarantee that it will have a trailing 0 for string operations
+		buf[len] = 0;
+	}
+	*buffer = buf;
+	FS_FCloseFile( h );
+
+	// if we are journalling and it is a config file, write it to the journal file
+	if( isConfig && com_journal && com_journal->integer == 1 )
+    {
+		Com_DPrintf( "Writing %s to journal file.\n", qpath );
+		FS_Write( &len, sizeof( len ), com_journalDataFile );
+		FS_Write( buf, len, com_journalDataFile );
+		FS_Flush( com_journalDataFile );
+	}
+	return len;
+}
+
+/*
+=============
+FS_FreeFile
+=============
+*/
+void FS_FreeFile( void *buffer )
+{
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+	if ( !buffer ) {
+		Com_Error( ERR_FATAL, "FS_FreeFile( NULL )" );
+	}
+	fs_loadStack--;
+
+	if ( !FS_ReleaseMappedBuffer( buffer ) ) {
+		Hunk_FreeTempMemory( buffer );
+	}
+
+	// if all of our temp files are free, clear all of our space
+	if ( fs_loadStack == 0 ) {
+		Hunk_ClearTempMemory();
+	}
+}
+
+/*
+============
+FS_WriteFile
+
+Filename are relative to the quake search path
+============
+*/
+void FS_WriteFile( const char *qpath, const void *buffer, int size )
+{
+	fileHandle_t f;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	if ( !qpath || !buffer ) {
+		Com_Error( ERR_FATAL, "FS_WriteFile: NULL parameter" );
+	}
+
+	f = FS_FOpenFileWrite( qpath );
+	if ( !f ) {
+		Com_Printf( "Failed to open %s\n", qpath );
+		return;
+	}
+
+	FS_Write( buffer, size, f );
+
+	FS_FCloseFile( f );
+}
+
+/*
+============
+FS_SV_ReadPrivateFile
+
+Reads a file the engine keeps for itself directly in fs_homepath, never
+from a pk3 or a game directory.  Returns the length and a zone buffer to
+release with Z_Free, or -1 and NULL if there is no such file
+============
+*/
+long FS_SV_ReadPrivateFile( const char *filename, void **buffer )
+{
+	char	*ospath;
+	FILE	*f;
+	long	len;
+	void	*buf;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	*buffer = NULL;
+
+	ospath = FS_BuildOSPath( fs_homepath->string, filename, "" );
+	ospath[strlen(ospath)-1] = '\0';
+
+	f = Sys_FOpen( ospath, "rb" );
+	if ( !f ) {
+		return -1;
+	}
+
+	fseek( f, 0, SEEK_END );
+	len = ftell( f );
+	fseek( f, 0, SEEK_SET );
+
+	if ( len < 0 ) {
+		fclose( f );
+		return -1;
+	}
+
+	buf = Z_Malloc( len + 1 );
+	if ( fread( buf, 1, len, f ) != (size_t) len ) {
+		Z_Free( buf );
+		fclose( f );
+		return -1;
+	}
+	fclose( f );
+
+	*buffer = buf;
+	return len;
+}
+
+/*
+============
+FS_SV_WritePrivateFile
+
+Writes a file for FS_SV_ReadPrivateFile.  It goes through stdio because
+FS_CheckFilenameIsMutable refuses these names to everything reachable
+from a VM.  A partial write never replaces the old file
+============
+*/
+void FS_SV_WritePrivateFile( const char *filename, const void *buffer, int size )
+{
+	char		ospath[MAX_OSPATH], tmppath[MAX_OSPATH];
+	FILE		*f;
+	qboolean	written;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	Q_strncpyz( ospath, FS_BuildOSPath( fs_homepath->string, filename, "" ), sizeof( ospath ) );
+	ospath[strlen(ospath)-1] = '\0';
+	Com_sprintf( tmppath, sizeof( tmppath ), "%s.tmp", ospath );
+
+	if ( FS_CreatePath( tmppath ) ) {
+		return;
+	}
+
+	f = Sys_FOpen( tmppath, "wb" );
+	if ( !f ) {
+		Com_Printf( "Failed to open %s\n", tmppath );
+		return;
+	}
+
+	written = ( fwrite( buffer, 1, size, f ) == (size_t) size );
+	if ( fclose( f ) ) {
+		written = qfalse;
+	}
+
+	if ( written ) {
+		remove( ospath );
+		rename( tmppath, ospath );
+	} else {
+		remove( tmppath );
+	}
+}
+
+
+
+/*
+==========================================================================
+
+PK3 INDEX CACHE
+
+Walking the central directory costs a read per entry, so the file lists
+of the paks are kept in fs_homepath/pakindex.dat between runs, keyed by
+os path, size and modification time.  FS_Startup maps the cache, paks
+that haven't changed are rebuilt from it without being opened, and the
+ones that had to be scanned are written back once the search paths are
+set up.
+
+==========================================================================
+*/
+
+#define PAKINDEX_IDENT		(('X'<<24)+('I'<<16)+('K'<<8)+'P')
+#define PAKINDEX_VERSION	1
+#define PAKINDEX_FILENAME	"pakindex.dat"
+#define PAKINDEX_HASH_SIZE	512
+
+typedef struct {
+	int		ident;
+	int		version;
+	int		numRecords;
+} pakIndexHeader_t;
+
+// followed by the os path, the crcs that feed the checksums, the
+// entries and their names, each padded out to 4 bytes
+typedef struct {
+	int		recordLength;
+	int		size;
+	int		mtime;
+	int		checksum;
+	int		numCrcs;
+	int		numFiles;
+	int		pathLength;
+	int		namesLength;
+} pakIndexRecord_t;
+
+typedef struct {
+	int		name;			// offset into the record names
+	int		hash;			// bucket in the pack hash table
+	int		pos;
+	int		len;
+	int		localHeader;
+	int		compressedLen;
+	int		method;
+} pakIndexEntry_t;
+
+typedef enum {
+	PIR_UNTOUCHED,
+	PIR_USED,
+	PIR_REPLACED
+} pakIndexState_t;
+
+typedef struct {
+	qboolean			active;			// only between FS_OpenPakIndex and FS_ClosePakIndex
+	byte				*data;			// mapped cache file
+	int					length;
+	int					numRecords;
+	pakIndexRecord_t	**records;
+	int					*next;			// hash chains through records
+	byte				*state;			// pakIndexState_t
+	int					hash[PAKINDEX_HASH_SIZE];
+	FILE				*out;			// rewritten cache, NULL until something changed
+	int					numOut;
+	int					numCached;
+	int					numScanned;
+	qboolean			stale;
+} pakIndex_t;
+
+static pakIndex_t	fs_index;
+
+/*
+=================
+FS_PakIndexHash
+=================
+*/
+static int FS_PakIndexHash( const char *ospath ) {
+	unsigned	hash;
+
+	for ( hash = 0; *ospath; ospath++ ) {
+		hash = hash * 31 + (byte)*ospath;
+	}
+	return hash & ( PAKINDEX_HASH_SIZE - 1 );
+}
+
+/*
+=================
+FS_PakHashSize
+
+Gets the hash table size from the number of files in the zip
+because lots of custom pk3 files have less than 32 or 64 files
+=================
+*/
+static int FS_PakHashSize( int numFiles ) {
+	int		i;
+
+	for ( i = 1; i <= MAX_FILEHASH_SIZE; i <<= 1 ) {
+		if ( i > numFiles ) {
+			break;
+		}
+	}
+	return i;
+}
+
+/*
+=================
+FS_PakIndexRecordValid
+
+Only checks that the record stays inside the cache,
+the entries are checked when the pak is rebuilt
+=================
+*/
+static qboolean FS_PakIndexRecordValid( const pakIndexRecord_t *rec, int remaining ) {
+	int64_t		length;
+
+	if ( remaining < sizeof( *rec ) || rec->recordLength < sizeof( *rec ) || rec->recordLength > remaining || ( rec->recordLength & 3 ) ) {
+		return qfalse;
+	}
+	if ( rec->numCrcs < 0 || rec->numFiles < 0 || rec->pathLength <= 0 || rec->namesLength < 0 ) {
+		return qfalse;
+	}
+
+	length = sizeof( *rec ) + PAD( (int64_t)rec->pathLength, 4 ) + (int64_t)rec->numCrcs * sizeof( int )
+		+ (int64_t)rec->numFiles * sizeof( pakIndexEntry_t ) + PAD( (int64_t)rec->namesLength, 4 );
+	if ( length != rec->recordLength ) {
+		return qfalse;
+	}
+
+	return ((const char *)( rec + 1 ))[rec->pathLength - 1] == 0;
+}
+
+/*
+=================
+FS_PakIndexPath
+=================
+*/
+static void FS_PakIndexPath( char *path, int size, const char *suffix ) {
+	Com_sprintf( path, size, "%s%c%s%s", fs_homepath->string, PATH_SEP, PAKINDEX_FILENAME, suffix );
+}
+
+/*
+=================
+FS_ReleasePakIndex
+=================
+*/
+static void FS_ReleasePakIndex( void ) {
+	if ( fs_index.out ) {
+		fclose( fs_index.out );
+	}
+	if ( fs_index.data ) {
+		Sys_UnmapFile( fs_index.data, fs_index.length );
+	}
+	if ( fs_index.records ) {
+		Z_Free( fs_index.records );
+	}
+	memset( &fs_index, 0, sizeof( fs_index ) );
+}
+
+/*
+=================
+FS_OpenPakIndex
+
+Maps the cache written by the last FS_Startup
+=================
+*/
+static void FS_OpenPakIndex( void ) {
+	char				path[MAX_OSPATH];
+	pakIndexHeader_t	*header;
+	pakIndexRecord_t	*rec;
+	int					i, h, ofs;
+
+	// an error during the last startup can leave it open
+	FS_ReleasePakIndex();
+
+	if ( !fs_pakIndex->integer || !fs_homepath->string[0] ) {
+		return;
+	}
+
+	fs_index.active = qtrue;
+	for ( i = 0; i < PAKINDEX_HASH_SIZE; i++ ) {
+		fs_index.hash[i] = -1;
+	}
+
+	FS_PakIndexPath( path, sizeof( path ), "" );
+	fs_index.data = Sys_MapFile( path, &fs_index.length );
+	if ( !fs_index.data ) {
+		return;
+	}
+
+	header = (pakIndexHeader_t *)fs_index.data;
+	if ( fs_index.length < sizeof( *header ) || header->ident != PAKINDEX_IDENT || header->version != PAKINDEX_VERSION
+		|| header->numRecords <= 0 || header->numRecords > ( fs_index.length - sizeof( *header ) ) / sizeof( *rec ) ) {
+		Com_Printf( "%s is out of date, rebuilding\n", path );
+		fs_index.stale = qtrue;
+		return;
+	}
+
+	fs_index.records = Z_Malloc( header->numRecords * ( sizeof( *fs_index.records ) + sizeof( *fs_index.next ) + sizeof( *fs_index.state ) ) );
+	fs_index.next = (int *)( fs_index.records + header->numRecords );
+	fs_index.state = (byte *)( fs_index.next + header->numRecords );
+
+	ofs = sizeof( *header );
+	for ( i = 0; i < header->numRecords; i++ ) {
+		rec = (pakIndexRecord_t *)( fs_index.data + ofs );
+		if ( !FS_PakIndexRecordValid( rec, fs_index.length - ofs ) ) {
+			Com_Printf( "%s is damaged, rebuilding\n", path );
+			fs_index.stale = qtrue;
+			break;
+		}
+
+		h = FS_PakIndexHash( (char *)( rec + 1 ) );
+		fs_index.records[i] = rec;
+		fs_index.next[i] = fs_index.hash[h];
+		fs_index.hash[h] = i;
+		ofs += rec->recordLength;
 	}
-	return len;
+	fs_index.numRecords = i;
 }
 
+/*
+=================
+FS_FindPakIndexRecord
+=================
+*/
+static pakIndexRecord_t *FS_FindPakIndexRecord( const char *zipfile, int size, int mtime ) {
+	pakIndexRecord_t	*rec;
+	int					i;
 
+	for ( i = fs_index.hash[FS_PakIndexHash( zipfile )]; i != -1; i = fs_index.next[i] ) {
+		rec = fs_index.records[i];
+		if ( fs_index.state[i] == PIR_REPLACED || strcmp( (char *)( rec + 1 ), zipfile ) ) {
+			continue;
+		}
 
+		if ( rec->size == size && rec->mtime == mtime ) {
+			fs_index.state[i] = PIR_USED;
+			return rec;
+		}
 
+		// the pak changed on disk, the scan gets written instead
+		fs_index.state[i] = PIR_REPLACED;
+		fs_index.stale = qtrue;
+	}
+	return NULL;
+}
 
 /*
-============
-FS_ReadFile
+=================
+FS_BeginPakIndexWrite
 
-Filename are relative to the openarena search path
-a null buffer will just return the file length without loading
-============
+Starts the replacement cache next to the one that's mapped,
+the header is filled in by FS_ClosePakIndex
+=================
 */
-long FS_ReadFile(const char *qpath, char **buffer)
-{
-//  long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer)    
-//	return FS_ReadFileDir(qpath, NULL, qfalse, buffer);
-	qboolean		isConfig;
+static qboolean FS_BeginPakIndexWrite( void ) {
+	char				path[MAX_OSPATH];
+	pakIndexHeader_t	header;
 
-    if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	if ( fs_index.out ) {
+		return qtrue;
 	}
 
-	if ( !qpath || !qpath[0] ) {
-		Com_Error( ERR_FATAL, "FS_ReadFile with empty name" );
+	FS_PakIndexPath( path, sizeof( path ), ".tmp" );
+	fs_index.out = Sys_FOpen( path, "wb" );
+	if ( !fs_index.out ) {
+		Com_DPrintf( "Couldn't write %s\n", path );
+		fs_index.active = qfalse;
+		return qfalse;
 	}
 
-	// if this is a .cfg file and we are playing back a journal, read it from the journal file
-	if( strstr(qpath, ".cfg") )
-    {
-		isConfig = qtrue;
-		if( com_journal && com_journal->integer == 2 )
-        {
-		    int r;
-        	long len;
-			Com_DPrintf("Loading %s from journal file.\n", qpath);
-			
-            r = FS_Read( &len, sizeof( len ), com_journalDataFile );
-			if( r != sizeof( len ) )
-            {
-				if (buffer != NULL)
-                    *buffer = NULL;
-				return -1;
-			}
-			// if the file didn't exist when the journal was created
-			if(!len)
-            {
-				if (buffer == NULL)
-                {
-					return 1;			// hack for old journal files
-				}
-				*buffer = NULL;
-				return -1;
-			}
-			if(buffer == NULL)
-            {
-				return len;
-			}
+	memset( &header, 0, sizeof( header ) );
+	fwrite( &header, sizeof( header ), 1, fs_index.out );
+	return qtrue;
+}
 
-			
-            char* buf = Hunk_AllocateTempMemory(len+1);
-			*buffer = buf;
+/*
+=================
+FS_WritePakIndexRecord
 
-			r = FS_Read(buf, len, com_journalDataFile);
-			if( r != len )
-            {
-				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
-			}
+Records a pak that had to be scanned
+=================
+*/
+static void FS_WritePakIndexRecord( const pack_t *pack, int size, int mtime, const int *crcs, int numCrcs ) {
+	static const byte	pad[4];
+	pakIndexRecord_t	rec;
+	pakIndexEntry_t		entry;
+	const fileInPack_t	*file;
+	int					i, names;
+
+	if ( !FS_BeginPakIndexWrite() ) {
+		return;
+	}
 
-			++fs_loadCount;
-			++fs_loadStack;
+	rec.size = size;
+	rec.mtime = mtime;
+	rec.checksum = pack->checksum;
+	rec.numCrcs = numCrcs;
+	rec.numFiles = pack->numfiles;
+	rec.pathLength = strlen( pack->pakFilename ) + 1;
+	rec.namesLength = 0;
+	for ( i = 0; i < pack->numfiles; i++ ) {
+		rec.namesLength += strlen( pack->buildBuffer[i].name ) + 1;
+	}
+	rec.recordLength = sizeof( rec ) + PAD( rec.pathLength, 4 ) + numCrcs * sizeof( int )
+		+ pack->numfiles * sizeof( entry ) + PAD( rec.namesLength, 4 );
+
+	fwrite( &rec, sizeof( rec ), 1, fs_index.out );
+	fwrite( pack->pakFilename, rec.pathLength, 1, fs_index.out );
+	fwrite( pad, PADLEN( rec.pathLength, 4 ), 1, fs_index.out );
+	fwrite( crcs, sizeof( int ), numCrcs, fs_index.out );
+
+	names = 0;
+	for ( i = 0; i < pack->numfiles; i++ ) {
+		file = &pack->buildBuffer[i];
+		entry.name = names;
+		entry.hash = FS_HashFileName( file->name, pack->hashSize );
+		entry.pos = file->pos;
+		entry.len = file->len;
+		entry.localHeader = file->localHeader;
+		entry.compressedLen = file->compressedLen;
+		entry.method = file->method;
+		fwrite( &entry, sizeof( entry ), 1, fs_index.out );
+		names += strlen( file->name ) + 1;
+	}
+
+	for ( i = 0; i < pack->numfiles; i++ ) {
+		fwrite( pack->buildBuffer[i].name, strlen( pack->buildBuffer[i].name ) + 1, 1, fs_index.out );
+	}
+	fwrite( pad, PADLEN( rec.namesLength, 4 ), 1, fs_index.out );
+
+	fs_index.numOut++;
+}
 
-			// guarantee that it will have a trailing 0 for string operations
-			buf[len] = 0;
+/*
+=================
+FS_ClosePakIndex
 
-			return len;
-		}
+Replaces the cache if any pak had to be scanned.  Records for paks that
+weren't loaded this time are carried over while the files are unchanged,
+so switching between mods doesn't keep rebuilding them
+=================
+*/
+static void FS_ClosePakIndex( void ) {
+	char				path[MAX_OSPATH], tmpPath[MAX_OSPATH];
+	pakIndexHeader_t	header;
+	pakIndexRecord_t	*rec;
+	int					i, size, mtime;
+	qboolean			written;
+
+	if ( !fs_index.active ) {
+		FS_ReleasePakIndex();
+		return;
 	}
-    else
-		isConfig = qfalse;
-
 
-    
-	fileHandle_t h;
-	long len = FS_FOpenFileRead(qpath, &h, qfalse);
+	if ( fs_debug->integer ) {
+		Com_Printf( "pak index: %d cached, %d scanned\n", fs_index.numCached, fs_index.numScanned );
+	}
 
-	if( h == 0 )
-    {
-		if ( buffer ) {
-			*buffer = NULL;
+	written = qfalse;
+	if ( ( fs_index.out || fs_index.stale ) && FS_BeginPakIndexWrite() ) {
+		for ( i = 0; i < fs_index.numRecords; i++ ) {
+			rec = fs_index.records[i];
+			if ( fs_index.state[i] == PIR_REPLACED ) {
+				continue;
+			}
+			if ( fs_index.state[i] == PIR_UNTOUCHED ) {
+				if ( !Sys_StatFile( (char *)( rec + 1 ), &size, &mtime ) || rec->size != size || rec->mtime != mtime ) {
+					continue;
+				}
+			}
+			fwrite( rec, rec->recordLength, 1, fs_index.out );
+			fs_index.numOut++;
 		}
-		// if we are journalling and it is a config file, write a zero to the journal file
-		if ( isConfig && com_journal && com_journal->integer == 1 ) {
-			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
-			len = 0;
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
+
+		header.ident = PAKINDEX_IDENT;
+		header.version = PAKINDEX_VERSION;
+		header.numRecords = fs_index.numOut;
+		fseek( fs_index.out, 0, SEEK_SET );
+		fwrite( &header, sizeof( header ), 1, fs_index.out );
+
+		written = !ferror( fs_index.out );
+		if ( fclose( fs_index.out ) ) {
+			written = qfalse;
 		}
-		return -1;
+		fs_index.out = NULL;
 	}
 
-	if ( !buffer )
-    {
-		if ( isConfig && com_journal && com_journal->integer == 1 )
-        {
-			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
-		}
-		FS_FCloseFile(h);
-		return len;
+	// the mapping has to go before the file can be replaced on windows
+	FS_ReleasePakIndex();
+
+	if ( written ) {
+		FS_PakIndexPath( path, sizeof( path ), "" );
+		FS_PakIndexPath( tmpPath, sizeof( tmpPath ), ".tmp" );
+		remove( path );
+		rename( tmpPath, path );
 	}
+}
 
-	++fs_loadCount;
-	++fs_loadStack;
 
-	
-    char* buf = Hunk_AllocateTempMemory(len+1);
-	*buffer = buf;
 
-	FS_Read(buf, len, h);
+/*
+==========================================================================
 
-	// guarantee that it will have a trailing 0 for string operations
-	buf[len] = 0;
-	FS_FCloseFile( h );
+ZIP FILE LOADING
 
-	// if we are journalling and it is a config file, write it to the journal file
-	if( isConfig && com_journal && com_journal->integer == 1 )
-    {
-		Com_DPrintf( "Writing %s to journal file.\n", qpath );
-		FS_Write( &len, sizeof( len ), com_journalDataFile );
-		FS_Write( buf, len, com_journalDataFile );
-		FS_Flush( com_journalDataFile );
-	}
-	return len;
-}
+==========================================================================
+*/
 
 /*
-=============
-FS_FreeFile
-=============
+=================
+FS_AllocPack
+=================
 */
-void FS_FreeFile( void *buffer )
+static pack_t *FS_AllocPack( const char *zipfile, const char *basename, int numFiles )
 {
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
-	}
-	if ( !buffer ) {
-		Com_Error( ERR_FATAL, "FS_FreeFile( NULL )" );
+	pack_t	*pack;
+	int		i;
+
+	i = FS_PakHashSize( numFiles );
+	pack = Z_Malloc( sizeof( pack_t ) + i * sizeof(fileInPack_t *) );
+	pack->hashSize = i;
+	pack->hashTable = (fileInPack_t **) (((char *) pack) + sizeof( pack_t ));
+	for(i = 0; i < pack->hashSize; i++) {
+		pack->hashTable[i] = NULL;
 	}
-	fs_loadStack--;
 
-	Hunk_FreeTempMemory( buffer );
+	Q_strncpyz( pack->pakFilename, zipfile, sizeof( pack->pakFilename ) );
+	Q_strncpyz( pack->pakBasename, basename, sizeof( pack->pakBasename ) );
 
-	// if all of our temp files are free, clear all of our space
-	if ( fs_loadStack == 0 ) {
-		Hunk_ClearTempMemory();
+	// strip .pk3 if needed
+	if ( strlen( pack->pakBasename ) > 4 && !Q_stricmp( pack->pakBasename + strlen( pack->pakBasename ) - 4, ".pk3" ) ) {
+		pack->pakBasename[strlen( pack->pakBasename ) - 4] = 0;
 	}
+
+	pack->numfiles = numFiles;
+
+	return pack;
 }
 
 /*
-============
-FS_WriteFile
+=================
+FS_LoadIndexedZipFile
 
-Filename are relative to the quake search path
-============
+Rebuilds a pak from its index cache record, NULL if the record doesn't add up
+=================
 */
-void FS_WriteFile( const char *qpath, const void *buffer, int size )
+static pack_t *FS_LoadIndexedZipFile( const char *zipfile, const char *basename, const pakIndexRecord_t *rec )
 {
-	fileHandle_t f;
-
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
-	}
-
-	if ( !qpath || !buffer ) {
-		Com_Error( ERR_FATAL, "FS_WriteFile: NULL parameter" );
+	const int				*crcs;
+	const pakIndexEntry_t	*entries, *entry;
+	const char				*names;
+	fileInPack_t			*buildBuffer;
+	pack_t					*pack;
+	int						*fs_headerLongs;
+	int						i, hashSize;
+
+	crcs = (const int *)( (const byte *)( rec + 1 ) + PAD( rec->pathLength, 4 ) );
+	entries = (const pakIndexEntry_t *)( crcs + rec->numCrcs );
+	names = (const char *)( entries + rec->numFiles );
+
+	hashSize = FS_PakHashSize( rec->numFiles );
+	if ( rec->namesLength && names[rec->namesLength - 1] ) {
+		return NULL;
 	}
-
-	f = FS_FOpenFileWrite( qpath );
-	if ( !f ) {
-		Com_Printf( "Failed to open %s\n", qpath );
-		return;
+	for ( i = 0, entry = entries; i < rec->numFiles; i++, entry++ ) {
+		if ( entry->name < 0 || entry->name >= rec->namesLength || entry->hash < 0 || entry->hash >= hashSize ) {
+			return NULL;
+		}
 	}
 
-	FS_Write( buffer, size, f );
+	pack = FS_AllocPack( zipfile, basename, rec->numFiles );
+	buildBuffer = Z_Malloc( ( rec->numFiles * sizeof( fileInPack_t ) ) + rec->namesLength );
+	memcpy( buildBuffer + rec->numFiles, names, rec->namesLength );
+	names = (const char *)( buildBuffer + rec->numFiles );
 
-	FS_FCloseFile( f );
-}
+	for ( i = 0, entry = entries; i < rec->numFiles; i++, entry++ ) {
+		buildBuffer[i].name = (char *)names + entry->name;
+		buildBuffer[i].pos = (unsigned)entry->pos;
+		buildBuffer[i].len = (unsigned)entry->len;
+		buildBuffer[i].localHeader = (unsigned)entry->localHeader;
+		buildBuffer[i].compressedLen = (unsigned)entry->compressedLen;
+		buildBuffer[i].method = entry->method;
+		buildBuffer[i].next = pack->hashTable[entry->hash];
+		pack->hashTable[entry->hash] = &buildBuffer[i];
+	}
 
+	// the pure checksum depends on the feed, so only the crcs are kept
+	fs_headerLongs = Z_Malloc( ( rec->numCrcs + 1 ) * sizeof(int) );
+	fs_headerLongs[0] = LittleLong( fs_checksumFeed );
+	memcpy( fs_headerLongs + 1, crcs, rec->numCrcs * sizeof(int) );
 
+	pack->checksum = rec->checksum;
+	pack->pure_checksum = Com_BlockChecksum( fs_headerLongs, sizeof(*fs_headerLongs) * ( rec->numCrcs + 1 ) );
+	pack->pure_checksum = LittleLong( pack->pure_checksum );
 
-/*
-==========================================================================
+	Z_Free(fs_headerLongs);
 
-ZIP FILE LOADING
+	pack->buildBuffer = buildBuffer;
 
-==========================================================================
-*/
+	return pack;
+}
 
 /*
 =================
@@ -2148,6 +3389,25 @@ static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename)
 	int				fs_numHeaderLongs;
 	int				*fs_headerLongs;
 	char			*namePtr;
+	pakIndexRecord_t *rec;
+	int				size, mtime;
+	qboolean		indexed;
+
+	indexed = fs_index.active && Sys_StatFile( zipfile, &size, &mtime );
+	if ( indexed ) {
+		rec = FS_FindPakIndexRecord( zipfile, size, mtime );
+		if ( rec ) {
+			pack = FS_LoadIndexedZipFile( zipfile, basename, rec );
+			if ( pack ) {
+				fs_index.numCached++;
+				if (fs_mmap && fs_mmap->integer) {
+					pack->mapData = Sys_MapFile(zipfile, &pack->mapLength);
+				}
+				return pack;
+			}
+			fs_index.stale = qtrue;
+		}
+	}
 
 	fs_numHeaderLongs = 0;
 
@@ -2174,31 +3434,8 @@ static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename)
 	fs_headerLongs = Z_Malloc( ( gi.number_entry + 1 ) * sizeof(int) );
 	fs_headerLongs[ fs_numHeaderLongs++ ] = LittleLong( fs_checksumFeed );
 
-	// get the hash table size from the number of files in the zip
-	// because lots of custom pk3 files have less than 32 or 64 files
-	for (i = 1; i <= MAX_FILEHASH_SIZE; i <<= 1) {
-		if (i > gi.number_entry) {
-			break;
-		}
-	}
-
-	pack = Z_Malloc( sizeof( pack_t ) + i * sizeof(fileInPack_t *) );
-	pack->hashSize = i;
-	pack->hashTable = (fileInPack_t **) (((char *) pack) + sizeof( pack_t ));
-	for(i = 0; i < pack->hashSize; i++) {
-		pack->hashTable[i] = NULL;
-	}
-
-	Q_strncpyz( pack->pakFilename, zipfile, sizeof( pack->pakFilename ) );
-	Q_strncpyz( pack->pakBasename, basename, sizeof( pack->pakBasename ) );
-
-	// strip .pk3 if needed
-	if ( strlen( pack->pakBasename ) > 4 && !Q_stricmp( pack->pakBasename + strlen( pack->pakBasename ) - 4, ".pk3" ) ) {
-		pack->pakBasename[strlen( pack->pakBasename ) - 4] = 0;
-	}
-
+	pack = FS_AllocPack( zipfile, basename, gi.number_entry );
 	pack->handle = uf;
-	pack->numfiles = gi.number_entry;
 	unzGoToFirstFile(uf);
 
 	for (i = 0; i < gi.number_entry; i++)
@@ -2218,6 +3455,10 @@ static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename)
 		// store the file position in the zip
 		buildBuffer[i].pos = unzGetOffset(uf);
 		buildBuffer[i].len = file_info.uncompressed_size;
+		buildBuffer[i].localHeader = unzGetLocalHeaderOffset(uf);
+		buildBuffer[i].compressedLen = file_info.compressed_size;
+		// encrypted entries only go through unzip
+		buildBuffer[i].method = (file_info.flag & 1) ? -1 : file_info.compression_method;
 		buildBuffer[i].next = pack->hashTable[hash];
 		pack->hashTable[hash] = &buildBuffer[i];
 		unzGoToNextFile(uf);
@@ -2228,9 +3469,20 @@ static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename)
 	pack->checksum = LittleLong( pack->checksum );
 	pack->pure_checksum = LittleLong( pack->pure_checksum );
 
+	pack->buildBuffer = buildBuffer;
+
+	// a pak with a broken central directory gets scanned every time
+	if ( indexed && i == gi.number_entry ) {
+		FS_WritePakIndexRecord( pack, size, mtime, &fs_headerLongs[ 1 ], fs_numHeaderLongs - 1 );
+		fs_index.numScanned++;
+	}
+
 	Z_Free(fs_headerLongs);
 
-	pack->buildBuffer = buildBuffer;
+	if (fs_mmap && fs_mmap->integer) {
+		pack->mapData = Sys_MapFile(zipfile, &pack->mapLength);
+	}
+
 	return pack;
 }
 
@@ -2244,7 +3496,20 @@ Frees a pak structure and releases all associated resources
 
 static void FS_FreePak(pack_t *thepak)
 {
-	unzClose(thepak->handle);
+	if (thepak->handle) {
+		unzClose(thepak->handle);
+		thepak->handle = NULL;
+	}
+
+	// FS_FreeFile finishes the job once the last mapped buffer is back
+	if (thepak->mapRefs) {
+		thepak->freePending = qtrue;
+		return;
+	}
+
+	if (thepak->mapData) {
+		Sys_UnmapFile(thepak->mapData, thepak->mapLength);
+	}
 	Z_Free(thepak->buildBuffer);
 	Z_Free(thepak);
 }
@@ -3319,6 +4584,10 @@ void FS_Shutdown( qboolean closemfp ) {
 		}
 	}
 
+	// a map load that dropped out may have left blocks stacked under
+	// its own leaked temp memory, the next Hunk_Clear reclaims them
+	FS_ForgetPrefetchedFiles();
+
 	// free everything
 	for(p = fs_searchpaths; p; p = next)
 	{
@@ -3417,6 +4686,10 @@ static void FS_Startup( const char *gameName )
 	}
 	fs_homepath = Cvar_Get ("fs_homepath", homePath, CVAR_INIT|CVAR_PROTECTED );
 	fs_gamedirvar = Cvar_Get ("fs_game", "", CVAR_INIT|CVAR_SYSTEMINFO );
+	fs_mmap = Cvar_Get ("fs_mmap", "1", CVAR_ARCHIVE|CVAR_LATCH );
+	fs_pakIndex = Cvar_Get ("fs_pakIndex", "1", CVAR_ARCHIVE );
+
+	FS_OpenPakIndex();
 
 	// add search path elements in reverse priority order
 	if (fs_basepath->string[0])
@@ -3463,6 +4736,8 @@ static void FS_Startup( const char *gameName )
 		}
 	}
 
+	FS_ClosePakIndex();
+
 #ifndef STANDALONE
 	if(!com_standalone->integer)
 	{
@@ -4199,7 +5474,9 @@ int		FS_FOpenFileByMode( const char *qpath, fileHandle_t *f, fsMode_t mode ) {
 
 int		FS_FTell( fileHandle_t f ) {
 	int pos;
-	if (fsh[f].zipFile == qtrue) {
+	if ( fsh[f].prefetch ) {
+		pos = fsh[f].prefetchPos;
+	} else if (fsh[f].zipFile == qtrue) {
 		pos = unztell(fsh[f].handleFiles.file.z);
 	} else {
 		pos = ftell(fsh[f].handleFiles.file.o);
@@ -29,14 +29,15 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 static int	bloc = 0;
 
+/* The offset functions keep their cursor in the caller's offset instead
+ * of the shared bloc, so several messages can be written at once */
 void Huff_putBit( int bit, byte *fout, int *offset) {
-	bloc = *offset;
-	if ((bloc&7) == 0) {
-		fout[(bloc>>3)] = 0;
+	int b = *offset;
+	if ((b&7) == 0) {
+		fout[(b>>3)] = 0;
 	}
-	fout[(bloc>>3)] |= bit << (bloc&7);
-	bloc++;
-	*offset = bloc;
+	fout[(b>>3)] |= bit << (b&7);
+	*offset = b + 1;
 }
 
 int		Huff_getBloc(void)
@@ -50,12 +51,9 @@ void	Huff_setBloc(int _bloc)
 }
 
 int		Huff_getBit( byte *fin, int *offset) {
-	int t;
-	bloc = *offset;
-	t = (fin[(bloc>>3)] >> (bloc&7)) & 0x1;
-	bloc++;
-	*offset = bloc;
-	return t;
+	int b = *offset;
+	*offset = b + 1;
+	return (fin[(b>>3)] >> (b&7)) & 0x1;
 }
 
 /* Add a bit to the output file (buffered) */
@@ -286,13 +284,14 @@ int Huff_Receive (node_t *node, int *ch, byte *fin)
 
 /* Get a symbol */
 void Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset) {
-	bloc = *offset;
+	int b = *offset;
 	while (node && node->symbol == INTERNAL_NODE) {
-		if (get_bit(fin)) {
+		if ((fin[(b>>3)] >> (b&7)) & 0x1) {
 			node = node->right;
 		} else {
 			node = node->left;
 		}
+		b++;
 	}
 	if (!node) {
 		*ch = 0;
@@ -300,7 +299,7 @@ void Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset) {
 //		Com_Error(ERR_DROP, "Illegal tree!");
 	}
 	*ch = node->symbol;
-	*offset = bloc;
+	*offset = b;
 }
 
 /* Send the prefix code for this node */
@@ -331,10 +330,122 @@ void Huff_transmit (huff_t *huff, int ch, byte *fout) {
 	}
 }
 
+/* Send the prefix code for this node at the caller's offset */
+static void offsetSend(node_t *node, node_t *child, byte *fout, int *offset) {
+	if (node->parent) {
+		offsetSend(node->parent, node, fout, offset);
+	}
+	if (child) {
+		Huff_putBit(node->right == child, fout, offset);
+	}
+}
+
 void Huff_offsetTransmit (huff_t *huff, int ch, byte *fout, int *offset) {
-	bloc = *offset;
-	send(huff->loc[ch], NULL, fout);
-	*offset = bloc;
+	offsetSend(huff->loc[ch], NULL, fout, offset);
+}
+
+/* Flatten the tree into a code table for sending and a lookup table
+ * indexed by the next HUFF_LOOKUP_BITS bits for receiving. The tree must
+ * not change afterwards. Returns qfalse if a code is too long to be
+ * sent from the table */
+qboolean Huff_BuildTable( huff_t *huff, huffTable_t *table ) {
+	node_t	*node;
+	int		ch, i, len;
+	unsigned int code;
+
+	memset( table, 0, sizeof( *table ) );
+	table->tree = huff->tree;
+
+	for ( ch = 0; ch <= HMAX; ch++ ) {
+		if ( !huff->loc[ch] ) {
+			continue;
+		}
+		/* walk up to the root, the last bit found is the first one sent */
+		code = 0;
+		len = 0;
+		for ( node = huff->loc[ch]; node->parent; node = node->parent ) {
+			if ( len == HUFF_MAX_CODE ) {
+				return qfalse;
+			}
+			code = (code << 1) | (node->parent->right == node);
+			len++;
+		}
+		table->code[ch] = code;
+		table->length[ch] = len;
+
+		if ( len == 0 || len > HUFF_LOOKUP_BITS ) {
+			continue;
+		}
+		/* every index that starts with this code decodes to it */
+		for ( i = code; i < (1<<HUFF_LOOKUP_BITS); i += (1<<len) ) {
+			table->lookup[i] = (ch << 4) | len;
+		}
+	}
+	return qtrue;
+}
+
+/* Write count bits, lsb first, at the caller's offset. Same result as
+ * count calls to Huff_putBit, bits above count must be clear */
+void Huff_putBits( uint64_t bits, int count, byte *fout, int *offset ) {
+	int		b = *offset;
+	int		shift = b & 7;
+	byte	*p = fout + (b >> 3);
+
+	*offset = b + count;
+
+	if ( shift && count > 0 ) {
+		/* finish the byte that is already started */
+		*p++ |= (byte)(bits << shift);
+		bits >>= 8 - shift;
+		count -= 8 - shift;
+	}
+	while ( count > 0 ) {
+		*p++ = (byte)bits;
+		bits >>= 8;
+		count -= 8;
+	}
+}
+
+/* Read count raw bits, lsb first, at the caller's offset */
+int Huff_getBits( const byte *fin, int *offset, int count ) {
+	int		b = *offset;
+	int		value = 0;
+	int		got = 0;
+	int		n;
+
+	while ( got < count ) {
+		n = 8 - (b & 7);
+		if ( n > count - got ) {
+			n = count - got;
+		}
+		value |= ((fin[b >> 3] >> (b & 7)) & ((1 << n) - 1)) << got;
+		got += n;
+		b += n;
+	}
+	*offset = b;
+	return value;
+}
+
+/* Get a symbol with the lookup table, the bytes past maxBytes are never
+ * read */
+int Huff_offsetReceiveTable( const huffTable_t *table, byte *fin, int *offset, int maxBytes ) {
+	int		b = *offset;
+	int		i = b >> 3;
+	int		ch, entry;
+	unsigned int window;
+
+	if ( i + 2 < maxBytes ) {
+		window = ( fin[i] | (fin[i+1] << 8) | (fin[i+2] << 16) ) >> (b & 7);
+		entry = table->lookup[window & ((1<<HUFF_LOOKUP_BITS) - 1)];
+		if ( entry ) {
+			*offset = b + (entry & 15);
+			return entry >> 4;
+		}
+	}
+
+	/* near the end of the buffer or a long code */
+	Huff_offsetReceive( table->tree, &ch, fin, offset );
+	return ch;
 }
 
 
@@ -0,0 +1,771 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// jobs.c -- work stealing job system shared by the whole engine
+
+#include "q_shared.h"
+#include "qcommon.h"
+#include "../platform/sys_public.h"
+
+/*
+=============================================================================
+
+Every worker thread owns a queue, and so do all other threads together
+(queue 0).  A thread pushes and pops its own jobs at the bottom of its
+queue, and when that runs dry it steals from the top of the others, so
+the oldest and usually largest pieces of work move.  The queues are
+short critical sections rather than lock free deques, which keeps them
+portable to everything Sys_CreateMutex runs on.
+
+A thread waiting on a counter runs jobs until the counter drops to zero,
+so nested waits can't deadlock and the engine keeps working with
+com_jobThreads 0.
+
+=============================================================================
+*/
+
+#define	MAX_JOB_THREADS		31
+#define	JOB_QUEUE_SIZE		1024		// power of two
+#define	MAX_JOB_WAITS		256			// jobs held back by Job_AddAfter
+#define	MAX_JOB_PROFILES	32
+
+#ifdef _MSC_VER
+#define	JOB_THREADLOCAL		__declspec(thread)
+#else
+#define	JOB_THREADLOCAL		__thread
+#endif
+
+typedef struct {
+	jobFunc_t		func;
+	void			*data;
+	int				start, end;		// indexes handed to func
+	jobCounter_t	*counter;		// may be NULL
+	int				profile;		// slot in jobs.profiles
+} job_t;
+
+typedef struct jobWait_s {
+	job_t				job;
+	struct jobWait_s	*next;
+} jobWait_t;
+
+typedef struct {
+	sysMutex_t		*lock;
+	volatile int	top, bottom;	// thieves take from top, the owner works at bottom
+	job_t			jobs[JOB_QUEUE_SIZE];
+} jobQueue_t;
+
+typedef struct {
+	const char		*name;
+	volatile int	jobs;
+	volatile int	items;
+	volatile int	usec;			// time spent running them, summed over threads
+} jobProfile_t;
+
+static struct {
+	qboolean		initialized;
+	int				numThreads;		// workers, not counting queue 0
+	sysThread_t		*threads[MAX_JOB_THREADS];
+	jobQueue_t		queues[MAX_JOB_THREADS + 1];
+	sysSemaphore_t	*wake;
+	volatile int	sleeping;
+	volatile int	quit;
+
+	sysMutex_t		*lock;			// counters, waits and profiles
+	jobWait_t		waits[MAX_JOB_WAITS];
+	jobWait_t		*freeWaits;
+
+	jobProfile_t	profiles[MAX_JOB_PROFILES];
+	int				numProfiles;
+	int				frameStart;
+} jobs;
+
+static JOB_THREADLOCAL int	job_thread;		// queue of the calling thread
+
+static cvar_t	*com_jobThreads;
+static cvar_t	*com_jobSpeeds;
+
+/*
+=================
+Job_Push
+
+Returns qfalse if the queue is full
+=================
+*/
+static qboolean Job_Push( jobQueue_t *q, const job_t *job ) {
+	Sys_LockMutex( q->lock );
+	if ( q->bottom - q->top >= JOB_QUEUE_SIZE ) {
+		Sys_UnlockMutex( q->lock );
+		return qfalse;
+	}
+	q->jobs[q->bottom & ( JOB_QUEUE_SIZE - 1 )] = *job;
+	q->bottom++;
+	Sys_UnlockMutex( q->lock );
+
+	return qtrue;
+}
+
+static qboolean Job_Pop( jobQueue_t *q, job_t *job ) {
+	if ( q->bottom == q->top ) {
+		return qfalse;
+	}
+
+	Sys_LockMutex( q->lock );
+	if ( q->bottom == q->top ) {
+		Sys_UnlockMutex( q->lock );
+		return qfalse;
+	}
+	q->bottom--;
+	*job = q->jobs[q->bottom & ( JOB_QUEUE_SIZE - 1 )];
+	Sys_UnlockMutex( q->lock );
+
+	return qtrue;
+}
+
+static qboolean Job_Steal( jobQueue_t *q, job_t *job ) {
+	if ( q->bottom == q->top ) {
+		return qfalse;
+	}
+
+	Sys_LockMutex( q->lock );
+	if ( q->bottom == q->top ) {
+		Sys_UnlockMutex( q->lock );
+		return qfalse;
+	}
+	*job = q->jobs[q->top & ( JOB_QUEUE_SIZE - 1 )];
+	q->top++;
+	Sys_UnlockMutex( q->lock );
+
+	return qtrue;
+}
+
+static void Job_Run( const job_t *job );
+
+/*
+=================
+Job_Queue
+
+Hands a ready job to the calling thread's queue and wakes a sleeper
+=================
+*/
+static void Job_Queue( const job_t *job ) {
+	if ( !jobs.numThreads || !Job_Push( &jobs.queues[job_thread], job ) ) {
+		Job_Run( job );
+		return;
+	}
+
+	if ( Sys_AtomicAdd( &jobs.sleeping, 0 ) > 0 ) {
+		Sys_SemaphorePost( jobs.wake, 1 );
+	}
+}
+
+/*
+=================
+Job_Finish
+
+The counter is only touched under jobs.lock, so once a waiter has seen it
+reach zero and taken the lock itself, it may throw the counter away
+=================
+*/
+static void Job_Finish( jobCounter_t *counter ) {
+	jobWait_t	*wait, *next;
+
+	Sys_LockMutex( jobs.lock );
+	if ( Sys_AtomicAdd( &counter->count, -1 ) > 0 ) {
+		Sys_UnlockMutex( jobs.lock );
+		return;
+	}
+	wait = counter->waiting;
+	counter->waiting = NULL;
+	Sys_UnlockMutex( jobs.lock );
+
+	for ( ; wait ; wait = next ) {
+		next = wait->next;
+		Job_Queue( &wait->job );
+
+		Sys_LockMutex( jobs.lock );
+		wait->next = jobs.freeWaits;
+		jobs.freeWaits = wait;
+		Sys_UnlockMutex( jobs.lock );
+	}
+}
+
+static void Job_Run( const job_t *job ) {
+	int64_t	start;
+	int		i;
+
+	start = Sys_Microseconds();
+
+	for ( i = job->start ; i < job->end ; i++ ) {
+		job->func( job->data, i );
+	}
+
+	if ( job->profile >= 0 ) {
+		jobProfile_t *p = &jobs.profiles[job->profile];
+
+		Sys_AtomicAdd( &p->jobs, 1 );
+		Sys_AtomicAdd( &p->items, job->end - job->start );
+		Sys_AtomicAdd( &p->usec, (int)( Sys_Microseconds() - start ) );
+	}
+
+	if ( job->counter ) {
+		Job_Finish( job->counter );
+	}
+}
+
+/*
+=================
+Job_RunOne
+
+Runs a job from the thread's own queue, or failing that one stolen from
+another.  Returns qfalse if there was nothing to do.
+=================
+*/
+static qboolean Job_RunOne( int self ) {
+	job_t	job;
+	int		i, n, numQueues;
+
+	if ( Job_Pop( &jobs.queues[self], &job ) ) {
+		Job_Run( &job );
+		return qtrue;
+	}
+
+	numQueues = jobs.numThreads + 1;
+	for ( i = 1 ; i < numQueues ; i++ ) {
+		n = ( self + i ) % numQueues;
+		if ( Job_Steal( &jobs.queues[n], &job ) ) {
+			Job_Run( &job );
+			return qtrue;
+		}
+	}
+
+	return qfalse;
+}
+
+static void Job_WorkerThread( void *arg ) {
+	job_thread = (int)(intptr_t)arg;
+
+	while ( !jobs.quit ) {
+		if ( Job_RunOne( job_thread ) ) {
+			continue;
+		}
+
+		// announce the nap before the last look, so a job pushed in
+		// between always finds someone to wake
+		Sys_AtomicAdd( &jobs.sleeping, 1 );
+		if ( !jobs.quit && !Job_RunOne( job_thread ) ) {
+			Sys_SemaphoreWait( jobs.wake );
+		}
+		Sys_AtomicAdd( &jobs.sleeping, -1 );
+	}
+}
+
+/*
+=================
+Job_FindProfile
+=================
+*/
+static int Job_FindProfile( const char *name ) {
+	int		i;
+
+	if ( !name ) {
+		return -1;
+	}
+
+	Sys_LockMutex( jobs.lock );
+	for ( i = 0 ; i < jobs.numProfiles ; i++ ) {
+		if ( jobs.profiles[i].name == name || !strcmp( jobs.profiles[i].name, name ) ) {
+			break;
+		}
+	}
+	if ( i == jobs.numProfiles ) {
+		if ( jobs.numProfiles == MAX_JOB_PROFILES ) {
+			i = -1;
+		} else {
+			jobs.profiles[i].name = name;
+			jobs.numProfiles++;
+		}
+	}
+	Sys_UnlockMutex( jobs.lock );
+
+	return i;
+}
+
+static void Job_Make( job_t *job, const char *name, jobFunc_t func, void *data, int start, int end, jobCounter_t *counter ) {
+	job->func = func;
+	job->data = data;
+	job->start = start;
+	job->end = end;
+	job->counter = counter;
+	job->profile = Job_FindProfile( name );
+
+	if ( counter ) {
+		Sys_AtomicAdd( &counter->count, 1 );
+	}
+}
+
+/*
+=================
+Job_Add
+
+Queues func for every index in [start, end).  The counter, if any, is
+raised now and dropped once the job has run.  The name is only kept for
+the profile, so it has to be a string constant.
+=================
+*/
+void Job_Add( const char *name, jobFunc_t func, void *data, int start, int end, jobCounter_t *counter ) {
+	job_t	job;
+
+	if ( !jobs.initialized ) {
+		Com_Error( ERR_FATAL, "Job_Add: job system not initialized" );
+	}
+
+	Job_Make( &job, name, func, data, start, end, counter );
+	Job_Queue( &job );
+}
+
+/*
+=================
+Job_AddAfter
+
+Like Job_Add, but the job is held back until "after" has dropped to zero
+=================
+*/
+void Job_AddAfter( jobCounter_t *after, const char *name, jobFunc_t func, void *data, int start, int end, jobCounter_t *counter ) {
+	jobWait_t	*wait;
+	job_t		job;
+
+	if ( !jobs.initialized ) {
+		Com_Error( ERR_FATAL, "Job_AddAfter: job system not initialized" );
+	}
+
+	Job_Make( &job, name, func, data, start, end, counter );
+
+	Sys_LockMutex( jobs.lock );
+	if ( after->count > 0 && jobs.freeWaits ) {
+		wait = jobs.freeWaits;
+		jobs.freeWaits = wait->next;
+		wait->job = job;
+		wait->next = after->waiting;
+		after->waiting = wait;
+		Sys_UnlockMutex( jobs.lock );
+		return;
+	}
+	Sys_UnlockMutex( jobs.lock );
+
+	// out of wait slots, so settle the dependency here
+	Job_Wait( after );
+	Job_Queue( &job );
+}
+
+/*
+=================
+Job_Wait
+
+Runs jobs until the counter drops to zero
+=================
+*/
+void Job_Wait( jobCounter_t *counter ) {
+	int		spins;
+
+	for ( spins = 0 ; counter->count > 0 ; ) {
+		if ( Job_RunOne( job_thread ) ) {
+			spins = 0;
+			continue;
+		}
+
+		// the last jobs are running on other threads
+		if ( ++spins > 64 ) {
+			Sys_Yield();
+		}
+	}
+
+	// let the thread that finished it leave Job_Finish
+	Sys_LockMutex( jobs.lock );
+	Sys_UnlockMutex( jobs.lock );
+}
+
+/*
+=================
+Job_ParallelFor
+
+Calls func for every index below count, split into jobs of grain indexes
+(0 picks a grain that gives every thread a few jobs), and returns when
+all of them are done.  The calling thread takes part.
+=================
+*/
+void Job_ParallelFor( const char *name, int count, int grain, jobFunc_t func, void *data ) {
+	jobCounter_t	counter;
+	job_t			job;
+	int				start;
+
+	if ( count <= 0 ) {
+		return;
+	}
+
+	if ( grain <= 0 ) {
+		grain = count / ( ( jobs.numThreads + 1 ) * 4 );
+		if ( grain < 1 ) {
+			grain = 1;
+		}
+	}
+
+	if ( !jobs.numThreads || count <= grain ) {
+		Job_Make( &job, name, func, data, 0, count, NULL );
+		Job_Run( &job );
+		return;
+	}
+
+	counter.count = 0;
+	counter.waiting = NULL;
+
+	// queued back to front, so the owner pops the low indexes first
+	// and thieves start at the far end
+	for ( start = ( ( count - 1 ) / grain ) * grain ; start >= 0 ; start -= grain ) {
+		Job_Add( name, func, data, start, ( start + grain < count ? start + grain : count ), &counter );
+	}
+
+	Job_Wait( &counter );
+}
+
+/*
+=================
+Job_NumThreads
+
+Threads that run jobs, counting the caller of Job_Wait
+=================
+*/
+int Job_NumThreads( void ) {
+	return jobs.numThreads + 1;
+}
+
+/*
+=================
+Job_StartThreads
+=================
+*/
+static void Job_StartThreads( void ) {
+	int		count;
+
+	count = com_jobThreads->integer;
+	if ( count < 0 ) {
+		count = Sys_NumCPUs() - 1;
+	}
+	if ( count > MAX_JOB_THREADS ) {
+		count = MAX_JOB_THREADS;
+	}
+
+	jobs.quit = 0;
+	jobs.numThreads = 0;
+
+	while ( jobs.numThreads < count ) {
+		// queues have to exist before anyone can steal from them
+		jobs.numThreads++;
+		jobs.threads[jobs.numThreads - 1] = Sys_CreateThread( Job_WorkerThread, (void *)(intptr_t)jobs.numThreads );
+		if ( !jobs.threads[jobs.numThreads - 1] ) {
+			jobs.numThreads--;
+			Com_Printf( S_COLOR_YELLOW "WARNING: only %i of %i job threads started\n", jobs.numThreads, count );
+			break;
+		}
+	}
+
+	if ( jobs.numThreads ) {
+		Com_Printf( "Running jobs on %i worker threads\n", jobs.numThreads );
+	}
+}
+
+/*
+=================
+Job_StopThreads
+
+Anything still queued is run by the caller first
+=================
+*/
+static void Job_StopThreads( void ) {
+	int		i;
+
+	while ( Job_RunOne( 0 ) )
+		;
+
+	jobs.quit = 1;
+	Sys_SemaphorePost( jobs.wake, jobs.numThreads );
+
+	for ( i = 0 ; i < jobs.numThreads ; i++ ) {
+		Sys_JoinThread( jobs.threads[i] );
+		jobs.threads[i] = NULL;
+	}
+
+	jobs.numThreads = 0;
+}
+
+/*
+=================
+Job_EndFrame
+
+Prints and clears the profile with com_jobSpeeds, and restarts the
+workers when com_jobThreads changed.  Main thread only.
+=================
+*/
+void Job_EndFrame( void ) {
+	jobProfile_t	*p;
+	int				i, now, busy;
+
+	if ( !jobs.initialized ) {
+		return;
+	}
+
+	if ( com_jobSpeeds->integer ) {
+		now = Sys_Milliseconds();
+		busy = 0;
+
+		for ( i = 0, p = jobs.profiles ; i < jobs.numProfiles ; i++, p++ ) {
+			if ( !p->jobs ) {
+				continue;
+			}
+			Com_Printf( "%s:%i/%i %ius ", p->name, p->jobs, p->items, p->usec );
+			busy += p->usec;
+		}
+		if ( busy ) {
+			Com_Printf( "busy:%ius of %ims x %i\n", busy, now - jobs.frameStart, jobs.numThreads + 1 );
+		}
+		jobs.frameStart = now;
+	}
+
+	for ( i = 0, p = jobs.profiles ; i < jobs.numProfiles ; i++, p++ ) {
+		p->jobs = p->items = p->usec = 0;
+	}
+
+	if ( com_jobThreads->modified ) {
+		com_jobThreads->modified = qfalse;
+		Job_StopThreads();
+		Job_StartThreads();
+	}
+}
+
+/*
+=============================================================================
+
+jobtest: runs the same work through the job system and serially and
+compares the results.  Every item is a chain of hashes, the second pass
+depends on the first through Job_AddAfter, so both the split and the
+ordering are checked.
+
+With a map running, the users of the job system are checked as well:
+the snapshots of every client are written serially and threaded on the
+same frame, and the map's bsp and aas are prefetched and compared with
+plain reads.
+
+=============================================================================
+*/
+
+#define	JOBTEST_ITEMS		65536
+#define	JOBTEST_ROUNDS		64
+#define	JOBTEST_BLOCK		256
+
+typedef struct {
+	unsigned int	*hashes;
+	unsigned int	*sums;		// one per JOBTEST_BLOCK hashes
+} jobTest_t;
+
+static void Job_TestHash( void *data, int index ) {
+	jobTest_t		*t = data;
+	unsigned int	h;
+	int				i;
+
+	h = index * 2654435761u;
+	for ( i = 0 ; i < JOBTEST_ROUNDS ; i++ ) {
+		h ^= h << 13;
+		h ^= h >> 17;
+		h ^= h << 5;
+		h += i;
+	}
+	t->hashes[index] = h;
+}
+
+static void Job_TestSum( void *data, int index ) {
+	jobTest_t		*t = data;
+	unsigned int	sum;
+	int				i;
+
+	sum = 0;
+	for ( i = 0 ; i < JOBTEST_BLOCK ; i++ ) {
+		sum = sum * 31 + t->hashes[index * JOBTEST_BLOCK + i];
+	}
+	t->sums[index] = sum;
+}
+
+static void Job_Test_f( void ) {
+	jobTest_t		serial, parallel;
+	jobCounter_t	hashed, summed;
+	int64_t			start, serialTime, parallelTime;
+	int				i, blocks, passes;
+	qboolean		ok;
+	jobFunc_t volatile	hash, sum;
+	char			bspName[MAX_QPATH], aasName[MAX_QPATH];
+	const char		*prefetch[2];
+
+	passes = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 8;
+	if ( passes < 1 ) {
+		passes = 1;
+	}
+
+	blocks = JOBTEST_ITEMS / JOBTEST_BLOCK;
+	serial.hashes = Z_Malloc( JOBTEST_ITEMS * sizeof( int ) );
+	serial.sums = Z_Malloc( blocks * sizeof( int ) );
+	parallel.hashes = Z_Malloc( JOBTEST_ITEMS * sizeof( int ) );
+	parallel.sums = Z_Malloc( blocks * sizeof( int ) );
+
+	// called through pointers like the jobs are, so the compiler can't
+	// fold the serial loops into something the jobs don't get
+	hash = Job_TestHash;
+	sum = Job_TestSum;
+
+	start = Sys_Microseconds();
+	for ( i = 0 ; i < JOBTEST_ITEMS ; i++ ) {
+		hash( &serial, i );
+	}
+	for ( i = 0 ; i < blocks ; i++ ) {
+		sum( &serial, i );
+	}
+	serialTime = Sys_Microseconds() - start;
+
+	ok = qtrue;
+	parallelTime = 0;
+	for ( i = 0 ; i < passes && ok ; i++ ) {
+		memset( parallel.hashes, 0, JOBTEST_ITEMS * sizeof( int ) );
+		memset( parallel.sums, 0, blocks * sizeof( int ) );
+
+		start = Sys_Microseconds();
+
+		// odd passes go through parallel for, even ones through
+		// hand made jobs and a dependency
+		if ( i & 1 ) {
+			Job_ParallelFor( "jobtest", JOBTEST_ITEMS, 0, Job_TestHash, &parallel );
+			Job_ParallelFor( "jobtest", blocks, 1, Job_TestSum, &parallel );
+		} else {
+			int		n;
+
+			memset( &hashed, 0, sizeof( hashed ) );
+			memset( &summed, 0, sizeof( summed ) );
+
+			for ( n = 0 ; n < blocks ; n++ ) {
+				Job_Add( "jobtest", Job_TestHash, &parallel, n * JOBTEST_BLOCK, ( n + 1 ) * JOBTEST_BLOCK, &hashed );
+			}
+			Job_AddAfter( &hashed, "jobtest", Job_TestSum, &parallel, 0, blocks, &summed );
+			Job_Wait( &summed );
+		}
+
+		parallelTime += Sys_Microseconds() - start;
+
+		ok = !memcmp( serial.hashes, parallel.hashes, JOBTEST_ITEMS * sizeof( int ) )
+			&& !memcmp( serial.sums, parallel.sums, blocks * sizeof( int ) );
+	}
+
+	if ( ok ) {
+		Com_Printf( "jobtest passed: serial %ius, jobs %ius on %i threads\n",
+			(int)serialTime, (int)( parallelTime / passes ), Job_NumThreads() );
+	} else {
+		Com_Printf( S_COLOR_RED "jobtest FAILED on pass %i\n", i );
+	}
+
+	Z_Free( serial.hashes );
+	Z_Free( serial.sums );
+	Z_Free( parallel.hashes );
+	Z_Free( parallel.sums );
+
+	if ( !SV_TestSnapshotJobs( Job_NumThreads() ) ) {
+		Com_Printf( S_COLOR_RED "jobtest FAILED on snapshots\n" );
+	}
+
+	if ( com_sv_running->integer ) {
+		// same order as SV_SpawnServer
+		Com_sprintf( aasName, sizeof( aasName ), "maps/%s.aas", Cvar_VariableString( "mapname" ) );
+		Com_sprintf( bspName, sizeof( bspName ), "maps/%s.bsp", Cvar_VariableString( "mapname" ) );
+		prefetch[0] = aasName;
+		prefetch[1] = bspName;
+		if ( !FS_TestPrefetch( prefetch, 2 ) ) {
+			Com_Printf( S_COLOR_RED "jobtest FAILED on prefetched files\n" );
+		}
+	}
+}
+
+/*
+=================
+Job_Init
+=================
+*/
+void Job_Init( void ) {
+	int		i;
+
+	com_jobThreads = Cvar_Get( "com_jobThreads", "-1", CVAR_ARCHIVE );
+	com_jobSpeeds = Cvar_Get( "com_jobSpeeds", "0", 0 );
+	com_jobThreads->modified = qfalse;
+
+	jobs.lock = Sys_CreateMutex();
+	jobs.wake = Sys_CreateSemaphore( 0 );
+	if ( !jobs.lock || !jobs.wake ) {
+		Com_Error( ERR_FATAL, "Job_Init: couldn't create job system locks" );
+	}
+
+	for ( i = 0 ; i <= MAX_JOB_THREADS ; i++ ) {
+		jobs.queues[i].lock = Sys_CreateMutex();
+		if ( !jobs.queues[i].lock ) {
+			Com_Error( ERR_FATAL, "Job_Init: couldn't create job queue locks" );
+		}
+	}
+
+	jobs.freeWaits = NULL;
+	for ( i = 0 ; i < MAX_JOB_WAITS ; i++ ) {
+		jobs.waits[i].next = jobs.freeWaits;
+		jobs.freeWaits = &jobs.waits[i];
+	}
+
+	jobs.initialized = qtrue;
+	jobs.frameStart = Sys_Milliseconds();
+
+	Job_StartThreads();
+
+	Cmd_AddCommand( "jobtest", Job_Test_f );
+}
+
+/*
+=================
+Job_Shutdown
+=================
+*/
+void Job_Shutdown( void ) {
+	int		i;
+
+	if ( !jobs.initialized ) {
+		return;
+	}
+
+	Cmd_RemoveCommand( "jobtest" );
+
+	Job_StopThreads();
+
+	for ( i = 0 ; i <= MAX_JOB_THREADS ; i++ ) {
+		Sys_DestroyMutex( jobs.queues[i].lock );
+	}
+	Sys_DestroyMutex( jobs.lock );
+	Sys_DestroySemaphore( jobs.wake );
+
+	memset( &jobs, 0, sizeof( jobs ) );
+}
@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "qcommon.h"
 
 static huffman_t		msgHuff;
+static huffTable_t		msgHuffTable;	// msgHuff flattened, the tree never changes after MSG_initHuffman
 
 static qboolean			msgInit = qfalse;
 
@@ -168,26 +169,34 @@ void MSG_WriteBits( msg_t *msg, int value, int bits ) {
 		else 
 			Com_Error(ERR_DROP, "can't write %d bits", bits);
 	} else {
-//		fp = fopen("c:\\netchan.bin", "a");
+		uint64_t	acc;
+		int			accBits;
+
+		// gather the raw bits and the codes of all the bytes, at most
+		// 7 + 4 * HUFF_MAX_CODE bits, and store them in one go
 		value &= (0xffffffff>>(32-bits));
+		acc = 0;
+		accBits = 0;
 		if (bits&7) {
-			int nbits;
-			nbits = bits&7;
-			for(i=0;i<nbits;i++) {
-				Huff_putBit((value&1), msg->data, &msg->bit);
-				value = (value>>1);
-			}
-			bits = bits - nbits;
+			accBits = bits&7;
+			acc = value & ((1<<accBits)-1);
+			value = (value>>accBits);
+			bits = bits - accBits;
 		}
-		if (bits) {
-			for(i=0;i<bits;i+=8) {
-//				fwrite(bp, 1, 1, fp);
-				Huff_offsetTransmit (&msgHuff.compressor, (value&0xff), msg->data, &msg->bit);
-				value = (value>>8);
+		for(i=0;i<bits;i+=8) {
+			int		ch = value&0xff;
+
+			if ( accBits + msgHuffTable.length[ch] > 64 ) {
+				Huff_putBits( acc, accBits, msg->data, &msg->bit );
+				acc = 0;
+				accBits = 0;
 			}
+			acc |= (uint64_t)msgHuffTable.code[ch] << accBits;
+			accBits += msgHuffTable.length[ch];
+			value = (value>>8);
 		}
+		Huff_putBits( acc, accBits, msg->data, &msg->bit );
 		msg->cursize = (msg->bit>>3)+1;
-//		fclose(fp);
 	}
 }
 
@@ -235,19 +244,12 @@ int MSG_ReadBits( msg_t *msg, int bits ) {
 		nbits = 0;
 		if (bits&7) {
 			nbits = bits&7;
-			for(i=0;i<nbits;i++) {
-				value |= (Huff_getBit(msg->data, &msg->bit)<<i);
-			}
+			value = Huff_getBits(msg->data, &msg->bit, nbits);
 			bits = bits - nbits;
 		}
-		if (bits) {
-//			fp = fopen("c:\\netchan.bin", "a");
-			for(i=0;i<bits;i+=8) {
-				Huff_offsetReceive (msgHuff.decompressor.tree, &get, msg->data, &msg->bit);
-//				fwrite(&get, 1, 1, fp);
-				value |= (get<<(i+nbits));
-			}
-//			fclose(fp);
+		for(i=0;i<bits;i+=8) {
+			get = Huff_offsetReceiveTable (&msgHuffTable, msg->data, &msg->bit, msg->maxsize);
+			value |= (get<<(i+nbits));
 		}
 		msg->readcount = (msg->bit>>3)+1;
 	}
@@ -1723,6 +1725,9 @@ void MSG_initHuffman( void )
 			Huff_addRef(&msgHuff.decompressor,	(byte)i);			// Do update
 		}
 	}
+	if ( !Huff_BuildTable( &msgHuff.decompressor, &msgHuffTable ) ) {
+		Com_Error( ERR_FATAL, "MSG_initHuffman: code longer than %i bits", HUFF_MAX_CODE );
+	}
 }
 
 /*
@@ -465,60 +465,188 @@ void NET_SendLoopPacket (netsrc_t sock, int length, const void *data, netadr_t t
 
 //=============================================================================
 
-typedef struct packetQueue_s {
-        struct packetQueue_s *next;
-        int length;
-        unsigned char *data;
-        netadr_t to;
-        int release;
-} packetQueue_t;
+/*
+=============================================================================
+
+DELAYED PACKETS
+
+cl_packetdelay / sv_packetdelay hold outgoing packets on a timing wheel
+with one slot per millisecond.  Entries come from a slab that only grows,
+so steady state queueing does not touch the zone.
+
+=============================================================================
+*/
+
+#define	PACKET_WHEEL_SLOTS	1024		// must be a power of two
+#define	PACKET_SLAB_SIZE	256
+
+typedef struct delayedPacket_s {
+	struct delayedPacket_s	*next;
+	int				release;
+	int				length;
+	netadr_t		to;
+	byte			*data;			// points at buf unless the packet is oversize
+	byte			buf[MAX_PACKETLEN];
+} delayedPacket_t;
+
+typedef struct {
+	delayedPacket_t	*head;
+	delayedPacket_t	*tail;
+} packetSlot_t;
+
+static packetSlot_t		packetWheel[PACKET_WHEEL_SLOTS];
+static delayedPacket_t	*packetFree;
+static int				packetWheelTime;	// first millisecond not yet released
+static int				packetsDelayed;
+
+
+/*
+==================
+NET_AllocDelayedPacket
+==================
+*/
+static delayedPacket_t *NET_AllocDelayedPacket( void )
+{
+	delayedPacket_t	*p;
+	int				i;
+
+	if ( !packetFree ) {
+		p = Z_Malloc( PACKET_SLAB_SIZE * sizeof( *p ) );
+		for ( i = 0; i < PACKET_SLAB_SIZE; i++ ) {
+			p[i].next = packetFree;
+			packetFree = &p[i];
+		}
+	}
 
-packetQueue_t *packetQueue = NULL;
+	p = packetFree;
+	packetFree = p->next;
+	return p;
+}
 
+/*
+==================
+NET_FreeDelayedPacket
+==================
+*/
+static void NET_FreeDelayedPacket( delayedPacket_t *p )
+{
+	if ( p->data != p->buf ) {
+		Z_Free( p->data );
+	}
+
+	p->next = packetFree;
+	packetFree = p;
+}
 
+/*
+==================
+NET_QueuePacket
+==================
+*/
 static void NET_QueuePacket( int length, const void *data, netadr_t to, int offset )
 {
-	packetQueue_t* next = packetQueue;
+	delayedPacket_t	*p;
+	packetSlot_t	*slot;
+	int				now;
 
 	if(offset > 999)
 		offset = 999;
 
-	packetQueue_t *new = S_Malloc(sizeof(packetQueue_t));
-	new->data = S_Malloc(length);
-	memcpy(new->data, data, length);
-	new->length = length;
-	new->to = to;
-	new->release = Sys_Milliseconds() + (int)((float)offset / com_timescale->value);	
-	new->next = NULL;
+	now = Sys_Milliseconds();
+	if ( !packetsDelayed ) {
+		packetWheelTime = now;
+	}
 
-	if(!packetQueue) {
-		packetQueue = new;
-		return;
+	p = NET_AllocDelayedPacket();
+
+	// only out of band messages can be larger than a netchan packet
+	if ( length > sizeof( p->buf ) ) {
+		p->data = Z_Malloc( length );
+	} else {
+		p->data = p->buf;
 	}
-	while(next) {
-		if(!next->next) {
-			next->next = new;
-			return;
-		}
-		next = next->next;
+	memcpy( p->data, data, length );
+	p->length = length;
+	p->to = to;
+	p->release = now + (int)((float)offset / com_timescale->value);
+	p->next = NULL;
+
+	if ( p->release < packetWheelTime ) {
+		p->release = packetWheelTime;
 	}
+
+	// release times a full turn or more ahead share the slot and are
+	// skipped until their lap comes around
+	slot = &packetWheel[p->release & (PACKET_WHEEL_SLOTS - 1)];
+	if ( slot->tail ) {
+		slot->tail->next = p;
+	} else {
+		slot->head = p;
+	}
+	slot->tail = p;
+
+	packetsDelayed++;
 }
 
+/*
+==================
+NET_FlushPacketQueue
+
+Sends every delayed packet whose release time has passed
+==================
+*/
 void NET_FlushPacketQueue(void)
 {
-	while(packetQueue)
-    {
-	    int now = Sys_Milliseconds();
-		if(packetQueue->release >= now)
-			break;
-        
-		Sys_SendPacket(packetQueue->length, packetQueue->data, packetQueue->to);
-		
-        packetQueue_t *last = packetQueue;
-		packetQueue = packetQueue->next;
-		Z_Free(last->data);
-		Z_Free(last);
+	delayedPacket_t	*p, *next, *keep, *keepTail;
+	packetSlot_t	*slot;
+	int				now, ticks, i;
+
+	if ( !packetsDelayed ) {
+		return;
 	}
+
+	now = Sys_Milliseconds();
+	ticks = now - packetWheelTime;
+	if ( ticks <= 0 ) {
+		return;
+	}
+	if ( ticks > PACKET_WHEEL_SLOTS ) {
+		ticks = PACKET_WHEEL_SLOTS;
+	}
+
+	NET_BeginPacketBatch();
+
+	for ( i = 0; i < ticks && packetsDelayed; i++ ) {
+		slot = &packetWheel[(packetWheelTime + i) & (PACKET_WHEEL_SLOTS - 1)];
+
+		keep = keepTail = NULL;
+		for ( p = slot->head; p; p = next ) {
+			next = p->next;
+
+			if ( p->release >= now ) {
+				// a later lap
+				p->next = NULL;
+				if ( keepTail ) {
+					keepTail->next = p;
+				} else {
+					keep = p;
+				}
+				keepTail = p;
+				continue;
+			}
+
+			Sys_SendPacket( p->length, p->data, p->to );
+			NET_FreeDelayedPacket( p );
+			packetsDelayed--;
+		}
+
+		slot->head = keep;
+		slot->tail = keepTail;
+	}
+
+	packetWheelTime = now;
+
+	NET_EndPacketBatch();
 }
 
 
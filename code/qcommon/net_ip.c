@@ -20,6 +20,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE		// sendmmsg / recvmmsg
+#endif
+
 #include "../qcommon/q_shared.h"
 #include "../qcommon/qcommon.h"
 
@@ -93,6 +97,11 @@ typedef int SOCKET;
 typedef int	ioctlarg_t;
 #define socketError			errno
 
+#ifdef __linux__
+	// batch datagrams through sendmmsg / recvmmsg
+	#define NET_HAVE_MMSG
+#endif
+
 #endif
 
 static qboolean usingSocks = qfalse;
@@ -114,6 +123,7 @@ static cvar_t	*net_mcast6addr;
 static cvar_t	*net_mcast6iface;
 
 static cvar_t	*net_dropsim;
+static cvar_t	*net_batch;
 
 static struct sockaddr	socksRelayAddr;
 
@@ -122,6 +132,19 @@ static SOCKET	ip6_socket = INVALID_SOCKET;
 static SOCKET	socks_socket = INVALID_SOCKET;
 static SOCKET	multicast6_socket = INVALID_SOCKET;
 
+// socket syscall counters for net_stats
+typedef struct {
+	int		startFrame;
+	int		startTime;
+	int		sendCalls;
+	int		recvCalls;
+	int		selectCalls;
+	int		packetsSent;
+	int		packetsReceived;
+} netStats_t;
+
+static netStats_t	netStats;
+
 // Keep track of currently joined multicast group.
 static struct ipv6_mreq curgroup;
 // And the currently bound address.
@@ -518,6 +541,52 @@ qboolean	NET_IsLocalAddress( netadr_t adr ) {
 
 //=============================================================================
 
+/*
+==================
+NET_FinishPacket
+
+Fills in the sender and message bounds of a datagram that has already
+been read into net_message->data
+==================
+*/
+static qboolean NET_FinishPacket(SOCKET sock, struct sockaddr_storage *from, socklen_t fromlen, int ret, netadr_t *net_from, msg_t *net_message)
+{
+	if(sock == ip_socket)
+	{
+		memset( ((struct sockaddr_in *)from)->sin_zero, 0, 8 );
+	
+		if ( usingSocks && memcmp( from, &socksRelayAddr, fromlen ) == 0 ) {
+			if ( ret < 10 || net_message->data[0] != 0 || net_message->data[1] != 0 || net_message->data[2] != 0 || net_message->data[3] != 1 ) {
+				return qfalse;
+			}
+			net_from->type = NA_IP;
+			net_from->ip[0] = net_message->data[4];
+			net_from->ip[1] = net_message->data[5];
+			net_from->ip[2] = net_message->data[6];
+			net_from->ip[3] = net_message->data[7];
+			net_from->port = *(short *)&net_message->data[8];
+			net_message->readcount = 10;
+		}
+		else {
+			SockadrToNetadr( (struct sockaddr *) from, net_from );
+			net_message->readcount = 0;
+		}
+	}
+	else
+	{
+		SockadrToNetadr( (struct sockaddr *) from, net_from );
+		net_message->readcount = 0;
+	}
+
+	if( ret >= net_message->maxsize ) {
+		Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
+		return qfalse;
+	}
+	
+	net_message->cursize = ret;
+	return qtrue;
+}
+
 /*
 ==================
 NET_GetPacket: Receive one packet
@@ -525,15 +594,26 @@ NET_GetPacket: Receive one packet
 */
 qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr)
 {
-	int 	ret;
+	SOCKET	sockets[3];
+	int		numSockets;
+	int 	i, ret;
 	struct sockaddr_storage from;
 	socklen_t	fromlen;
 	int		err;
-	
+
+	numSockets = 0;
 	if(ip_socket != INVALID_SOCKET && FD_ISSET(ip_socket, fdr))
+		sockets[numSockets++] = ip_socket;
+	if(ip6_socket != INVALID_SOCKET && FD_ISSET(ip6_socket, fdr))
+		sockets[numSockets++] = ip6_socket;
+	if(multicast6_socket != INVALID_SOCKET && multicast6_socket != ip6_socket && FD_ISSET(multicast6_socket, fdr))
+		sockets[numSockets++] = multicast6_socket;
+
+	for(i = 0; i < numSockets; i++)
 	{
 		fromlen = sizeof(from);
-		ret = recvfrom( ip_socket, (void *)net_message->data, net_message->maxsize, 0, (struct sockaddr *) &from, &fromlen );
+		ret = recvfrom( sockets[i], (void *)net_message->data, net_message->maxsize, 0, (struct sockaddr *) &from, &fromlen );
+		netStats.recvCalls++;
 		
 		if (ret == SOCKET_ERROR)
 		{
@@ -544,98 +624,204 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr)
 		}
 		else
 		{
-
-			memset( ((struct sockaddr_in *)&from)->sin_zero, 0, 8 );
-		
-			if ( usingSocks && memcmp( &from, &socksRelayAddr, fromlen ) == 0 ) {
-				if ( ret < 10 || net_message->data[0] != 0 || net_message->data[1] != 0 || net_message->data[2] != 0 || net_message->data[3] != 1 ) {
-					return qfalse;
-				}
-				net_from->type = NA_IP;
-				net_from->ip[0] = net_message->data[4];
-				net_from->ip[1] = net_message->data[5];
-				net_from->ip[2] = net_message->data[6];
-				net_from->ip[3] = net_message->data[7];
-				net_from->port = *(short *)&net_message->data[8];
-				net_message->readcount = 10;
-			}
-			else {
-				SockadrToNetadr( (struct sockaddr *) &from, net_from );
-				net_message->readcount = 0;
-			}
-		
-			if( ret >= net_message->maxsize ) {
-				Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
-				return qfalse;
-			}
-			
-			net_message->cursize = ret;
-			return qtrue;
+			netStats.packetsReceived++;
+			return NET_FinishPacket( sockets[i], &from, fromlen, ret, net_from, net_message );
 		}
 	}
 	
-	if(ip6_socket != INVALID_SOCKET && FD_ISSET(ip6_socket, fdr))
-	{
-		fromlen = sizeof(from);
-		ret = recvfrom(ip6_socket, (void *)net_message->data, net_message->maxsize, 0, (struct sockaddr *) &from, &fromlen);
-		
-		if (ret == SOCKET_ERROR)
-		{
-			err = socketError;
+	return qfalse;
+}
 
-			if( err != EAGAIN && err != ECONNRESET )
-				Com_Printf( "NET_GetPacket: %s\n", NET_ErrorString() );
-		}
-		else
-		{
-			SockadrToNetadr((struct sockaddr *) &from, net_from);
-			net_message->readcount = 0;
-		
-			if(ret >= net_message->maxsize)
-			{
-				Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
-				return qfalse;
-			}
-			
-			net_message->cursize = ret;
-			return qtrue;
-		}
+//=============================================================================
+
+static char socksBuf[4096];
+
+/*
+==================
+NET_SendPacketError
+==================
+*/
+static void NET_SendPacketError( netadrtype_t type )
+{
+	int err = socketError;
+
+	// wouldblock is silent
+	if( err == EAGAIN ) {
+		return;
 	}
 
-	if(multicast6_socket != INVALID_SOCKET && multicast6_socket != ip6_socket && FD_ISSET(multicast6_socket, fdr))
+	// some PPP links do not allow broadcasts and return an error
+	if( ( err == EADDRNOTAVAIL ) && ( ( type == NA_BROADCAST ) ) ) {
+		return;
+	}
+
+	Com_Printf( "Sys_SendPacket: %s\n", NET_ErrorString() );
+}
+
+#ifdef NET_HAVE_MMSG
+
+/*
+=============================================================================
+
+BATCHED SENDS
+
+Between NET_BeginPacketBatch and NET_EndPacketBatch outgoing datagrams
+are copied into a queue and handed to the kernel with one sendmmsg per
+socket instead of one sendto per packet.  Anything that does not fit a
+queue slot, or goes through the socks relay, is sent immediately after
+flushing the queue so packet order is kept.
+
+=============================================================================
+*/
+
+#define	NET_SEND_BATCH		64
+#define	NET_BATCH_PACKETLEN	1400	// MAX_PACKETLEN in net_chan.c
+
+typedef struct {
+	SOCKET			sock;
+	netadrtype_t	type;
+	struct sockaddr_storage	addr;
+	socklen_t		addrlen;
+	int				length;
+	byte			data[NET_BATCH_PACKETLEN];
+} netQueuedPacket_t;
+
+static netQueuedPacket_t	netSendQueue[NET_SEND_BATCH];
+static int					netSendQueued;
+static int					netBatchDepth;
+
+/*
+==================
+NET_FlushSendQueue
+==================
+*/
+static void NET_FlushSendQueue( void )
+{
+	struct mmsghdr	hdr[NET_SEND_BATCH];
+	struct iovec	iov[NET_SEND_BATCH];
+	netQueuedPacket_t	*p;
+	int		i, start, end, ret;
+
+	if( !netSendQueued ) {
+		return;
+	}
+
+	memset( hdr, 0, netSendQueued * sizeof( hdr[0] ) );
+	for( i = 0, p = netSendQueue; i < netSendQueued; i++, p++ )
 	{
-		fromlen = sizeof(from);
-		ret = recvfrom(multicast6_socket, (void *)net_message->data, net_message->maxsize, 0, (struct sockaddr *) &from, &fromlen);
-		
-		if (ret == SOCKET_ERROR)
-		{
-			err = socketError;
+		iov[i].iov_base = p->data;
+		iov[i].iov_len = p->length;
+		hdr[i].msg_hdr.msg_name = &p->addr;
+		hdr[i].msg_hdr.msg_namelen = p->addrlen;
+		hdr[i].msg_hdr.msg_iov = &iov[i];
+		hdr[i].msg_hdr.msg_iovlen = 1;
+	}
 
-			if( err != EAGAIN && err != ECONNRESET )
-				Com_Printf( "NET_GetPacket: %s\n", NET_ErrorString() );
-		}
-		else
+	for( start = 0; start < netSendQueued; )
+	{
+		// sendmmsg works on a single socket, so send runs that share one
+		for( end = start + 1; end < netSendQueued && netSendQueue[end].sock == netSendQueue[start].sock; end++ )
+			;
+
+		ret = sendmmsg( netSendQueue[start].sock, &hdr[start], end - start, 0 );
+		netStats.sendCalls++;
+
+		if( ret <= 0 )
 		{
-			SockadrToNetadr((struct sockaddr *) &from, net_from);
-			net_message->readcount = 0;
-		
-			if(ret >= net_message->maxsize)
-			{
-				Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
-				return qfalse;
-			}
-			
-			net_message->cursize = ret;
-			return qtrue;
+			// the first packet of the run failed, report it and carry on with the rest
+			NET_SendPacketError( netSendQueue[start].type );
+			start++;
+			continue;
 		}
+
+		netStats.packetsSent += ret;
+		start += ret;
 	}
-	
-	return qfalse;
+
+	netSendQueued = 0;
 }
 
-//=============================================================================
+/*
+==================
+NET_QueueBatchedPacket
 
-static char socksBuf[4096];
+Returns qfalse if the packet has to be sent right away
+==================
+*/
+static qboolean NET_QueueBatchedPacket( SOCKET sock, netadrtype_t type, int length, const void *data,
+								 struct sockaddr_storage *addr, socklen_t addrlen )
+{
+	netQueuedPacket_t *p;
+
+	if( !netBatchDepth || !net_batch->integer || length > NET_BATCH_PACKETLEN ) {
+		NET_FlushSendQueue();
+		return qfalse;
+	}
+
+	p = &netSendQueue[netSendQueued++];
+	p->sock = sock;
+	p->type = type;
+	p->addr = *addr;
+	p->addrlen = addrlen;
+	p->length = length;
+	memcpy( p->data, data, length );
+
+	if( netSendQueued == NET_SEND_BATCH ) {
+		NET_FlushSendQueue();
+	}
+
+	return qtrue;
+}
+
+#endif
+
+/*
+==================
+NET_BeginPacketBatch
+
+Packets sent until the matching NET_EndPacketBatch may be held back and
+written together.  Batches nest.
+==================
+*/
+void NET_BeginPacketBatch( void )
+{
+#ifdef NET_HAVE_MMSG
+	netBatchDepth++;
+#endif
+}
+
+/*
+==================
+NET_EndPacketBatch
+==================
+*/
+void NET_EndPacketBatch( void )
+{
+#ifdef NET_HAVE_MMSG
+	if( netBatchDepth <= 0 ) {
+		Com_Error( ERR_FATAL, "NET_EndPacketBatch without NET_BeginPacketBatch" );
+	}
+
+	if( !--netBatchDepth ) {
+		NET_FlushSendQueue();
+	}
+#endif
+}
+
+/*
+==================
+NET_AbortPacketBatch
+
+Com_Error unwinds the frame past any open batch
+==================
+*/
+void NET_AbortPacketBatch( void )
+{
+#ifdef NET_HAVE_MMSG
+	netBatchDepth = 0;
+	NET_FlushSendQueue();
+#endif
+}
 
 /*
 ==================
@@ -646,6 +832,8 @@ void Sys_SendPacket( int length, const void *data, netadr_t to )
 {
 	int	ret = SOCKET_ERROR;
 	struct sockaddr_storage	addr;
+	SOCKET		sock;
+	socklen_t	addrlen;
 
 	if( to.type != NA_BROADCAST && to.type != NA_IP && to.type != NA_IP6 && to.type != NA_MULTICAST6)
 	{
@@ -667,6 +855,9 @@ void Sys_SendPacket( int length, const void *data, netadr_t to )
 
 	if( usingSocks && to.type == NA_IP )
     {
+#ifdef NET_HAVE_MMSG
+		NET_FlushSendQueue();
+#endif
 		socksBuf[0] = 0;	// reserved
 		socksBuf[1] = 0;
 		socksBuf[2] = 0;	// fragment (not fragmented)
@@ -675,30 +866,43 @@ void Sys_SendPacket( int length, const void *data, netadr_t to )
 		*(short *)&socksBuf[8] = ((struct sockaddr_in *)&addr)->sin_port;
 		memcpy( &socksBuf[10], data, length );
 		ret = sendto( ip_socket, socksBuf, length+10, 0, &socksRelayAddr, sizeof(socksRelayAddr) );
+		netStats.sendCalls++;
 	}
 	else
     {
 		if(addr.ss_family == AF_INET)
-			ret = sendto( ip_socket, data, length, 0, (struct sockaddr *) &addr, sizeof(struct sockaddr_in) );
+		{
+			sock = ip_socket;
+			addrlen = sizeof(struct sockaddr_in);
+		}
 		else if(addr.ss_family == AF_INET6)
-			ret = sendto( ip6_socket, data, length, 0, (struct sockaddr *) &addr, sizeof(struct sockaddr_in6) );
-	}
-	if( ret == SOCKET_ERROR )
-    {
-		int err = socketError;
-
-		// wouldblock is silent
-		if( err == EAGAIN ) {
-			return;
+		{
+			sock = ip6_socket;
+			addrlen = sizeof(struct sockaddr_in6);
 		}
-
-		// some PPP links do not allow broadcasts and return an error
-		if( ( err == EADDRNOTAVAIL ) && ( ( to.type == NA_BROADCAST ) ) ) {
-			return;
+		else
+		{
+			sock = INVALID_SOCKET;
+			addrlen = 0;
 		}
 
-		Com_Printf( "Sys_SendPacket: %s\n", NET_ErrorString() );
+		if(sock != INVALID_SOCKET)
+		{
+#ifdef NET_HAVE_MMSG
+			if(NET_QueueBatchedPacket(sock, to.type, length, data, &addr, addrlen))
+				return;
+#endif
+			ret = sendto( sock, data, length, 0, (struct sockaddr *) &addr, addrlen );
+			netStats.sendCalls++;
+		}
 	}
+	if( ret == SOCKET_ERROR )
+    {
+		NET_SendPacketError( to.type );
+		return;
+	}
+
+	netStats.packetsSent++;
 }
 
 
@@ -1485,6 +1689,9 @@ static qboolean NET_GetCvars( void ) {
 
 	net_dropsim = Cvar_Get("net_dropsim", "", CVAR_TEMP);
 
+	// only has an effect where sendmmsg / recvmmsg are available
+	net_batch = Cvar_Get( "net_batch", "1", CVAR_ARCHIVE );
+
 	return modified ? qtrue : qfalse;
 }
 
@@ -1540,6 +1747,10 @@ void NET_Config( qboolean enableNetworking )
 
 	if( stop )
     {
+#ifdef NET_HAVE_MMSG
+		NET_FlushSendQueue();
+#endif
+
 		if ( ip_socket != INVALID_SOCKET ) {
 			closesocket( ip_socket );
 			ip_socket = INVALID_SOCKET;
@@ -1576,6 +1787,50 @@ void NET_Config( qboolean enableNetworking )
 }
 
 
+/*
+====================
+NET_Stats_f
+
+Reports socket syscalls per frame since the last "net_stats reset"
+====================
+*/
+static void NET_Stats_f( void )
+{
+	int		frames, msec, calls, packets;
+
+	if( !Q_stricmp( Cmd_Argv( 1 ), "reset" ) )
+	{
+		memset( &netStats, 0, sizeof( netStats ) );
+		netStats.startFrame = com_frameNumber;
+		netStats.startTime = Com_Milliseconds();
+		return;
+	}
+
+	frames = com_frameNumber - netStats.startFrame;
+	msec = Com_Milliseconds() - netStats.startTime;
+	if( frames < 1 )
+		frames = 1;
+
+	calls = netStats.sendCalls + netStats.recvCalls + netStats.selectCalls;
+	packets = netStats.packetsSent + netStats.packetsReceived;
+
+	Com_Printf( "%i frames in %i msec, net_batch %s\n", frames, msec,
+#ifdef NET_HAVE_MMSG
+		net_batch->integer ? "on" : "off"
+#else
+		"unsupported"
+#endif
+		);
+	Com_Printf( "send:   %8i calls %8i packets %7.2f calls/frame\n", netStats.sendCalls, netStats.packetsSent,
+		(float)netStats.sendCalls / frames );
+	Com_Printf( "recv:   %8i calls %8i packets %7.2f calls/frame\n", netStats.recvCalls, netStats.packetsReceived,
+		(float)netStats.recvCalls / frames );
+	Com_Printf( "select: %8i calls %25.2f calls/frame\n", netStats.selectCalls,
+		(float)netStats.selectCalls / frames );
+	Com_Printf( "total:  %8i calls %8i packets %7.2f calls/frame %5.2f packets/call\n", calls, packets,
+		(float)calls / frames, calls ? (float)packets / calls : 0.0f );
+}
+
 void NET_Init( void )
 {
 #ifdef _WIN32
@@ -1592,6 +1847,7 @@ void NET_Init( void )
 	NET_Config( qtrue );
 	
 	Cmd_AddCommand ("net_restart", NET_Restart_f);
+	Cmd_AddCommand ("net_stats", NET_Stats_f);
 	Com_Printf("--- NET_Init finished ---\n");
 }
 
@@ -1611,6 +1867,93 @@ void NET_Shutdown( void )
 #endif
 }
 
+/*
+====================
+NET_DispatchPacket
+====================
+*/
+static void NET_DispatchPacket(netadr_t *from, msg_t *netmsg)
+{
+	if(net_dropsim->value > 0.0f && net_dropsim->value <= 100.0f)
+	{
+		// com_dropsim->value percent of incoming packets get dropped.
+		if(rand() < (int) (((double) RAND_MAX) / 100.0 * (double) net_dropsim->value))
+			return;          // drop this packet
+	}
+
+	if(com_sv_running->integer)
+		Com_RunAndTimeServerPacket(from, netmsg);
+	else
+		CL_PacketEvent(*from, netmsg);
+}
+
+#ifdef NET_HAVE_MMSG
+
+#define	NET_RECV_BATCH	16
+
+static byte						netRecvData[NET_RECV_BATCH][MAX_MSGLEN + 1];
+static struct sockaddr_storage	netRecvFrom[NET_RECV_BATCH];
+
+/*
+====================
+NET_EventBatch
+
+Drains a socket with recvmmsg.  The socket is passed by reference
+because handling a packet may restart networking.
+====================
+*/
+static void NET_EventBatch(SOCKET *sockp)
+{
+	struct mmsghdr	hdr[NET_RECV_BATCH];
+	struct iovec	iov[NET_RECV_BATCH];
+	SOCKET		sock = *sockp;
+	netadr_t	from = {0};
+	msg_t		netmsg;
+	int			i, count, err;
+
+	for(i = 0; i < NET_RECV_BATCH; i++)
+	{
+		iov[i].iov_base = netRecvData[i];
+		iov[i].iov_len = sizeof(netRecvData[i]);
+	}
+
+	do
+	{
+		memset(hdr, 0, sizeof(hdr));
+		for(i = 0; i < NET_RECV_BATCH; i++)
+		{
+			hdr[i].msg_hdr.msg_name = &netRecvFrom[i];
+			hdr[i].msg_hdr.msg_namelen = sizeof(netRecvFrom[i]);
+			hdr[i].msg_hdr.msg_iov = &iov[i];
+			hdr[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		count = recvmmsg(sock, hdr, NET_RECV_BATCH, MSG_DONTWAIT, NULL);
+		netStats.recvCalls++;
+
+		if(count == SOCKET_ERROR)
+		{
+			err = socketError;
+
+			if( err != EAGAIN && err != ECONNRESET )
+				Com_Printf( "NET_GetPacket: %s\n", NET_ErrorString() );
+			return;
+		}
+
+		netStats.packetsReceived += count;
+
+		for(i = 0; i < count && *sockp == sock; i++)
+		{
+			MSG_Init(&netmsg, netRecvData[i], sizeof(netRecvData[i]));
+
+			if(NET_FinishPacket(sock, &netRecvFrom[i], hdr[i].msg_hdr.msg_namelen, hdr[i].msg_len, &from, &netmsg))
+				NET_DispatchPacket(&from, &netmsg);
+		}
+	} while(count == NET_RECV_BATCH && *sockp == sock);
+}
+
+#endif
+
 /*
 ====================
 NET_Event
@@ -1624,28 +1967,36 @@ void NET_Event(fd_set *fdr)
 	byte bufData[MAX_MSGLEN + 1];
 	netadr_t from = {0};
 	msg_t netmsg;
+
+	// replies to a burst of queries go out together
+	NET_BeginPacketBatch();
+
+#ifdef NET_HAVE_MMSG
+	if(net_batch->integer)
+	{
+		if(ip_socket != INVALID_SOCKET && FD_ISSET(ip_socket, fdr))
+			NET_EventBatch(&ip_socket);
+		if(ip6_socket != INVALID_SOCKET && FD_ISSET(ip6_socket, fdr))
+			NET_EventBatch(&ip6_socket);
+		if(multicast6_socket != INVALID_SOCKET && multicast6_socket != ip6_socket && FD_ISSET(multicast6_socket, fdr))
+			NET_EventBatch(&multicast6_socket);
+
+		NET_EndPacketBatch();
+		return;
+	}
+#endif
 	
 	while(1)
 	{
 		MSG_Init(&netmsg, bufData, sizeof(bufData));
 
 		if(NET_GetPacket(&from, &netmsg, fdr))
-		{
-			if(net_dropsim->value > 0.0f && net_dropsim->value <= 100.0f)
-			{
-				// com_dropsim->value percent of incoming packets get dropped.
-				if(rand() < (int) (((double) RAND_MAX) / 100.0 * (double) net_dropsim->value))
-					continue;          // drop this packet
-			}
-
-			if(com_sv_running->integer)
-				Com_RunAndTimeServerPacket(&from, &netmsg);
-			else
-				CL_PacketEvent(from, &netmsg);
-		}
+			NET_DispatchPacket(&from, &netmsg);
 		else
 			break;
 	}
+
+	NET_EndPacketBatch();
 }
 
 /*
@@ -1694,6 +2045,7 @@ void NET_Sleep(int msec)
 	timeout.tv_usec = (msec%1000)*1000;
 
 	retval = select(highestfd + 1, &fdr, NULL, NULL, &timeout);
+	netStats.selectCalls++;
 
 	if(retval == SOCKET_ERROR)
 		Com_Printf("Warning: select() syscall failed: %s\n", NET_ErrorString());
@@ -168,6 +168,9 @@ void		NET_Shutdown( void );
 void		NET_Restart_f( void );
 void		NET_Config( qboolean enableNetworking );
 void		NET_FlushPacketQueue(void);
+void		NET_BeginPacketBatch(void);
+void		NET_EndPacketBatch(void);
+void		NET_AbortPacketBatch(void);
 void		NET_SendPacket (netsrc_t sock, int length, const void *data, netadr_t to);
 void		QDECL NET_OutOfBandPrint( netsrc_t net_socket, netadr_t adr, const char *format, ...) __attribute__ ((format (printf, 3, 4)));
 void		QDECL NET_OutOfBandData( netsrc_t sock, netadr_t adr, byte *format, int len );
@@ -190,7 +193,7 @@ void		NET_Sleep(int msec);
 
 #define MAX_DOWNLOAD_WINDOW		48	// ACK window of 48 download chunks. Cannot set this higher, or clients
 						// will overflow the reliable commands buffer
-#define MAX_DOWNLOAD_BLKSIZE		2048	// 896 byte block chunks
+#define MAX_DOWNLOAD_BLKSIZE		2048	// size of the first download blocks, the server adapts it
 
 #define NETCHAN_GENCHECKSUM(challenge, sequence) ((challenge) ^ ((sequence) * (challenge)))
 
@@ -362,6 +365,13 @@ void	VM_Init( void );
 vm_t	*VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *), vmInterpret_t interpret );
 // module should be bare: "cgame", not "cgame.dll" or "vm/cgame.qvm"
 
+typedef intptr_t (*vmSyscall_t)( intptr_t *args );
+
+// traps with an entry in the table are dispatched to it directly, NULL
+// entries and anything past the end still go through systemCalls.
+// The table isn't copied and has to stay around for the lifetime of the vm
+void	VM_SetSyscallTable( vm_t *vm, const vmSyscall_t *table, int numSyscalls );
+
 void	VM_Free( vm_t *vm );
 void	VM_Clear(void);
 void	VM_Forced_Unload_Start(void);
@@ -369,6 +379,12 @@ void	VM_Forced_Unload_Done(void);
 vm_t	*VM_Restart(vm_t *vm, qboolean unpure);
 
 intptr_t QDECL VM_Call( vm_t *vm, int callNum, ... );
+// fixed arity versions for the per frame calls, the missing
+// arguments are passed as 0
+intptr_t	VM_Call0( vm_t *vm, int callNum );
+intptr_t	VM_Call1( vm_t *vm, int callNum, int arg0 );
+intptr_t	VM_Call2( vm_t *vm, int callNum, int arg0, int arg1 );
+intptr_t	VM_Call3( vm_t *vm, int callNum, int arg0, int arg1, int arg2 );
 
 void	VM_Debug( int level );
 
@@ -688,9 +704,28 @@ void	FS_ForceFlush( fileHandle_t f );
 void	FS_FreeFile( void *buffer );
 // frees the memory returned by FS_ReadFile
 
+void	FS_PrefetchFiles( const char **qpaths, int count );
+// inflates pk3 entries that are about to be read together on the job
+// system, list them in the reverse of the order they will be read in,
+// so their temp memory comes back in stack order
+
+void	FS_FlushPrefetchedFiles( void );
+// frees the prefetched files nobody opened
+
+qboolean FS_TestPrefetch( const char **qpaths, int count );
+// checks FS_PrefetchFiles against plain reads, for jobtest
+
+void	FS_ForgetPrefetchedFiles( void );
+// drops them without freeing, when the hunk is cleared under them
+
 void	FS_WriteFile( const char *qpath, const void *buffer, int size );
 // writes a complete file, creating any subdirectories needed
 
+long	FS_SV_ReadPrivateFile( const char *filename, void **buffer );
+void	FS_SV_WritePrivateFile( const char *filename, const void *buffer, int size );
+// engine owned files directly in fs_homepath that no VM may write,
+// free the buffer with Z_Free
+
 long FS_filelength(fileHandle_t f);
 // doesn't work for files that are opened from a pack file
 
@@ -881,6 +916,7 @@ extern	int		time_frontend;
 extern	int		time_backend;		// renderer backend time
 
 extern	int		com_frameTime;
+extern	int		com_frameNumber;
 
 extern	qboolean	com_errorEntered;
 extern	qboolean	com_fullyInitialized;
@@ -894,7 +930,8 @@ typedef enum {
 	TAG_BOTLIB,
 	TAG_RENDERER,
 	TAG_SMALL,
-	TAG_STATIC
+	TAG_STATIC,
+	TAG_SLAB		// slab pages, never handed out by Z_TagMalloc
 } memtag_t;
 
 /*
@@ -936,6 +973,7 @@ void Z_Free( void *ptr );
 void Z_FreeTags( int tag );
 int Z_AvailableMemory( void );
 void Z_LogHeap( void );
+void Z_ReleaseThreadCache( void );
 
 void Hunk_Clear( void );
 void Hunk_ClearToMark( void );
@@ -955,6 +993,37 @@ void Com_Frame( void );
 void Com_Shutdown( void );
 
 
+/*
+==============================================================
+
+JOB SYSTEM
+
+Jobs run on any thread, so they must not print, raise errors or touch
+the hunk.  Z_Malloc and Z_Free are fine.
+
+==============================================================
+*/
+
+// called once for every index of a job
+typedef void (*jobFunc_t)( void *data, int index );
+
+// raised for every job added with it, dropped when one finishes
+typedef struct jobCounter_s {
+	volatile int		count;
+	struct jobWait_s	*waiting;	// jobs held back until count is zero
+} jobCounter_t;
+
+void	Job_Init( void );
+void	Job_Shutdown( void );
+void	Job_EndFrame( void );
+int		Job_NumThreads( void );
+
+void	Job_Add( const char *name, jobFunc_t func, void *data, int start, int end, jobCounter_t *counter );
+void	Job_AddAfter( jobCounter_t *after, const char *name, jobFunc_t func, void *data, int start, int end, jobCounter_t *counter );
+void	Job_Wait( jobCounter_t *counter );
+void	Job_ParallelFor( const char *name, int count, int grain, jobFunc_t func, void *data );
+
+
 /*
 ==============================================================
 
@@ -1038,6 +1107,7 @@ void SV_PacketEvent( netadr_t from, msg_t *msg );
 int SV_FrameMsec(void);
 qboolean SV_GameCommand( void );
 int SV_SendQueuedPackets(void);
+qboolean SV_TestSnapshotJobs( int numJobs );
 
 //
 // UI interface
@@ -1085,6 +1155,18 @@ typedef struct {
 	huff_t		decompressor;
 } huffman_t;
 
+// a tree that no longer changes can be flattened into tables, so a
+// symbol is sent or received in one step instead of one bit at a time
+#define	HUFF_LOOKUP_BITS	11
+#define	HUFF_MAX_CODE		32
+
+typedef struct {
+	unsigned int	code[HMAX+1];		// first bit sent is in the lsb
+	byte			length[HMAX+1];
+	unsigned short	lookup[1<<HUFF_LOOKUP_BITS];	// symbol << 4 | length, 0 if the code is longer
+	node_t			*tree;				// for codes longer than HUFF_LOOKUP_BITS
+} huffTable_t;
+
 void	Huff_Compress(msg_t *buf, int offset);
 void	Huff_Decompress(msg_t *buf, int offset);
 void	Huff_Init(huffman_t *huff);
@@ -1095,6 +1177,10 @@ void	Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset);
 void	Huff_offsetTransmit (huff_t *huff, int ch, byte *fout, int *offset);
 void	Huff_putBit( int bit, byte *fout, int *offset);
 int		Huff_getBit( byte *fout, int *offset);
+qboolean Huff_BuildTable( huff_t *huff, huffTable_t *table );
+void	Huff_putBits( uint64_t bits, int count, byte *fout, int *offset );
+int		Huff_getBits( const byte *fin, int *offset, int count );
+int		Huff_offsetReceiveTable( const huffTable_t *table, byte *fin, int *offset, int maxBytes );
 
 // don't use if you don't know what you're doing.
 int		Huff_getBloc(void);
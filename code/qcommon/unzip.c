@@ -1606,3 +1606,16 @@ extern int ZEXPORT unzSetOffset (file, pos)
     s->current_file_ok = (err == UNZ_OK);
     return err;
 }
+
+extern uLong ZEXPORT unzGetLocalHeaderOffset (file)
+    unzFile file;
+{
+    unz_s* s;
+
+    if (file==NULL)
+          return 0;
+    s=(unz_s*)file;
+    if (!s->current_file_ok)
+      return 0;
+    return s->cur_file_info_internal.offset_curfile + s->byte_before_the_zipfile;
+}
@@ -343,6 +343,10 @@ extern uLong ZEXPORT unzGetOffset (unzFile file);
 /* Set the current file offset */
 extern int ZEXPORT unzSetOffset (unzFile file, uLong pos);
 
+/* Get the position of the current file's local header in the archive,
+   for callers that read the zip data themselves */
+extern uLong ZEXPORT unzGetLocalHeaderOffset (unzFile file);
+
 
 
 #ifdef __cplusplus
@@ -34,6 +34,9 @@ and one exported function: Perform
 #include "../platform/sys_public.h"
 ////////// globals //////////////
 vm_t* currentVM = NULL;
+cvar_t *vm_jitOptimize;
+cvar_t *vm_cache;
+cvar_t *vm_syscallTiming;
 
 
 ////////// static ///////////////
@@ -228,7 +231,13 @@ void VM_LoadSymbols( vm_t *vm )
 
 		// convert value from an instruction number to a code offset
 		if ( value >= 0 && value < numInstructions ) {
-			value = vm->instructionPointers[value];
+			intptr_t ofs = vm->instructionPointers[value];
+
+			// compiled ones are addresses by now
+			if ( vm->compiled ) {
+				ofs -= (intptr_t)vm->codeBase;
+			}
+			value = ofs;
 		}
 
 		sym->symValue = value;
@@ -286,12 +295,65 @@ intptr_t QDECL VM_DllSyscall( intptr_t arg, ... )
     args[i] = va_arg(ap, intptr_t);
   va_end(ap);
   
-  return currentVM->systemCall( args );
+  return VM_SystemCall( currentVM, args );
 #else // original id code
-	return currentVM->systemCall( &arg );
+	return VM_SystemCall( currentVM, &arg );
 #endif
 }
 
+/*
+============
+VM_SystemCall
+
+Every trap from the vm ends up here.  The ones the module put in its
+table are called directly instead of going through its switch
+============
+*/
+intptr_t VM_SystemCall( vm_t *vm, intptr_t *args )
+{
+	intptr_t (*func)( intptr_t *parms ) = vm->systemCall;
+	uintptr_t num = args[0];
+	int64_t start;
+	intptr_t r;
+	int slot;
+
+	if ( num < (uintptr_t) vm->numSyscalls && vm->syscallTable[num] ) {
+		func = vm->syscallTable[num];
+	}
+
+	if ( !vm->syscallStats ) {
+		return func( args );
+	}
+
+	slot = num < VM_MAX_SYSCALL_STATS ? num : VM_MAX_SYSCALL_STATS - 1;
+	vm->syscallStats[slot].count++;
+
+	if ( !vm_syscallTiming->integer ) {
+		return func( args );
+	}
+
+	start = Sys_Microseconds();
+	r = func( args );
+
+	// the vm can get freed from inside a trap
+	if ( vm->syscallStats ) {
+		vm->syscallStats[slot].usec += Sys_Microseconds() - start;
+	}
+
+	return r;
+}
+
+/*
+============
+VM_SetSyscallTable
+============
+*/
+void VM_SetSyscallTable( vm_t *vm, const vmSyscall_t *table, int numSyscalls )
+{
+	vm->syscallTable = table;
+	vm->numSyscalls = numSyscalls;
+}
+
 
 /*
 =================
@@ -385,7 +447,7 @@ vmHeader_t *VM_LoadQVM( vm_t *vm, qboolean alloc, qboolean unpure)
 	if(alloc)
 	{
 		// allocate zero filled space for initialized and uninitialized data
-		vm->dataBase = Hunk_Alloc(dataLength, h_high);
+		vm->dataBase = Hunk_Alloc(dataLength + VM_DATA_GUARD, h_high);
 		vm->dataMask = dataLength - 1;
 	}
 	else
@@ -556,6 +618,7 @@ vm_t* VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInter
 			if(vm->dllHandle)
 			{
 				vm->systemCall = systemCalls;
+				vm->syscallStats = Z_Malloc( VM_MAX_SYSCALL_STATS * sizeof( *vm->syscallStats ) );
 				return vm;
 			}
 			
@@ -576,6 +639,7 @@ vm_t* VM_Create(const char *module, intptr_t (*systemCalls)(intptr_t *), vmInter
 		return NULL;
 
 	vm->systemCall = systemCalls;
+	vm->syscallStats = Z_Malloc( VM_MAX_SYSCALL_STATS * sizeof( *vm->syscallStats ) );
 
 	// allocate space for the jump targets, which will be filled in by the compile/prep functions
 	vm->instructionCount = header->instructionCount;
@@ -646,6 +710,9 @@ void VM_Free( vm_t *vm )
 	if(vm->destroy)
 		vm->destroy(vm);
 
+	if(vm->syscallStats)
+		Z_Free(vm->syscallStats);
+
 	if ( vm->dllHandle )
     {
 		Sys_UnloadDll( vm->dllHandle );
@@ -735,70 +802,88 @@ which will subtract space for locals from sp
 ==============
 */
 
-intptr_t QDECL VM_Call(struct vm_s *vm, int callnum, ... )
+static intptr_t VM_CallArgs( vm_t *vm, int *args )
 {
-	intptr_t r = 0;
+	intptr_t r;
 
 	if(!vm || !vm->name[0])
 		Com_Error(ERR_FATAL, "VM_Call with NULL vm");
 
-    struct vm_s* oldVM = currentVM;
+	struct vm_s* oldVM = currentVM;
 	currentVM = vm;
 	lastVM = vm;
 
 //	if ( vm_debugLevel )
-//	  Com_Printf(S_COLOR_YELLOW "VM_Call( %d )\n", callnum );
+//	  Com_Printf(S_COLOR_YELLOW "VM_Call( %d )\n", args[0] );
 
-    ++vm->callLevel;
+	++vm->callLevel;
 	// if we have a dll loaded, call it directly
 	if ( vm->entryPoint )
-    {
+	{
 		//rcg010207 - see dissertation at top of VM_DllSyscall() in this file.
-
-		int args[MAX_VMMAIN_ARGS-1];
-		va_list ap;
-		va_start(ap, callnum);
-		for (unsigned int i = 0; i < ARRAY_LEN(args); ++i)
-        {
-			args[i] = va_arg(ap, int);
-		}
-		va_end(ap);
-
-		r = vm->entryPoint( callnum,  args[0],  args[1],  args[2], args[3], args[4],
-                  args[5],  args[6], args[7],  args[8],  args[9], args[10], args[11]);
-
+		r = vm->entryPoint( args[0], args[1], args[2], args[3], args[4], args[5],
+				args[6], args[7], args[8], args[9], args[10], args[11], args[12] );
 	}
-    else
-    {
-		struct {
-			int callnum;
-			int args[MAX_VMMAIN_ARGS-1];
-		} a;
-		va_list ap;
-
-		a.callnum = callnum;
-		va_start(ap, callnum);
-		
-        for(unsigned int i = 0; i < MAX_VMMAIN_ARGS-1; ++i)
-        {
-			a.args[i] = va_arg(ap, int);
-		}
-		va_end(ap);
-    #ifndef NO_VM_COMPILED
-		if ( vm->compiled )
-        {
-            r = VM_CallCompiled( vm, &a.callnum ); // here
-        }
-		else
-    #endif
-        	r = VM_CallInterpreted( vm, &a.callnum );
+#ifndef NO_VM_COMPILED
+	else if ( vm->compiled )
+	{
+		r = VM_CallCompiled( vm, args );
+	}
+#endif
+	else
+	{
+		r = VM_CallInterpreted( vm, args );
 	}
 	--vm->callLevel;
 
 	if( oldVM != NULL )
-        currentVM = oldVM;
-	
-    return r;
+		currentVM = oldVM;
+
+	return r;
+}
+
+intptr_t QDECL VM_Call( vm_t *vm, int callnum, ... )
+{
+	int args[MAX_VMMAIN_ARGS];
+	va_list ap;
+
+	args[0] = callnum;
+	va_start(ap, callnum);
+	for (unsigned int i = 1; i < ARRAY_LEN(args); ++i)
+	{
+		args[i] = va_arg(ap, int);
+	}
+	va_end(ap);
+
+	return VM_CallArgs( vm, args );
+}
+
+intptr_t VM_Call0( vm_t *vm, int callnum )
+{
+	int args[MAX_VMMAIN_ARGS] = { callnum };
+
+	return VM_CallArgs( vm, args );
+}
+
+intptr_t VM_Call1( vm_t *vm, int callnum, int arg0 )
+{
+	int args[MAX_VMMAIN_ARGS] = { callnum, arg0 };
+
+	return VM_CallArgs( vm, args );
+}
+
+intptr_t VM_Call2( vm_t *vm, int callnum, int arg0, int arg1 )
+{
+	int args[MAX_VMMAIN_ARGS] = { callnum, arg0, arg1 };
+
+	return VM_CallArgs( vm, args );
+}
+
+intptr_t VM_Call3( vm_t *vm, int callnum, int arg0, int arg1, int arg2 )
+{
+	int args[MAX_VMMAIN_ARGS] = { callnum, arg0, arg1, arg2 };
+
+	return VM_CallArgs( vm, args );
 }
 
 //=================================================================
@@ -820,19 +905,8 @@ static int QDECL VM_ProfileSort( const void *a, const void *b )
 }
 
 
-void VM_VmProfile_f( void )
+static void VM_ProfileSymbols( vm_t *vm )
 {
-
-    if ( !lastVM ) {
-		return;
-	}
-
-	vm_t* vm = lastVM;
-
-	if ( !vm->numSymbols ) {
-		return;
-	}
-
 	vmSymbol_t** sorted = Z_Malloc( vm->numSymbols * sizeof( *sorted ) );
 	sorted[0] = vm->symbols;
 	double total = sorted[0]->profileCount;
@@ -861,6 +935,475 @@ void VM_VmProfile_f( void )
 }
 
 
+typedef struct {
+	int				num;
+	vmSyscallStat_t	stat;
+} vmSyscallProfile_t;
+
+static int QDECL VM_SyscallProfileSort( const void *a, const void *b )
+{
+	const vmSyscallStat_t *sa = &((const vmSyscallProfile_t *)a)->stat;
+	const vmSyscallStat_t *sb = &((const vmSyscallProfile_t *)b)->stat;
+
+	if ( sa->usec != sb->usec ) {
+		return sa->usec < sb->usec ? -1 : 1;
+	}
+	if ( sa->count != sb->count ) {
+		return sa->count < sb->count ? -1 : 1;
+	}
+	return 0;
+}
+
+/*
+=================
+VM_SyscallName
+
+The map file lists the traps at -1 - their number
+=================
+*/
+static const char *VM_SyscallName( vm_t *vm, int num )
+{
+	vmSymbol_t *sym;
+
+	if ( num == VM_MAX_SYSCALL_STATS - 1 ) {
+		return "(higher traps)";
+	}
+
+	for ( sym = vm->symbols ; sym ; sym = sym->next ) {
+		if ( sym->symValue == -1 - num ) {
+			return sym->symName;
+		}
+	}
+
+	return va( "trap %i", num );
+}
+
+static void VM_ProfileSyscalls( vm_t *vm )
+{
+	vmSyscallProfile_t *sorted;
+	double totalCount, totalUsec;
+	int i, count;
+
+	sorted = Z_Malloc( VM_MAX_SYSCALL_STATS * sizeof( *sorted ) );
+
+	count = 0;
+	totalCount = totalUsec = 0;
+	for ( i = 0 ; i < VM_MAX_SYSCALL_STATS ; i++ )
+	{
+		if ( !vm->syscallStats[i].count ) {
+			continue;
+		}
+		sorted[count].num = i;
+		sorted[count].stat = vm->syscallStats[i];
+		totalCount += vm->syscallStats[i].count;
+		totalUsec += vm->syscallStats[i].usec;
+		count++;
+	}
+
+	qsort( sorted, count, sizeof( *sorted ), VM_SyscallProfileSort );
+
+	Com_Printf( "%s syscalls%s:\n", vm->name, vm_syscallTiming->integer ? "" : " (set vm_syscallTiming 1 for times)" );
+	for ( i = 0 ; i < count ; i++ )
+	{
+		vmSyscallStat_t *stat = &sorted[i].stat;
+
+		Com_Printf( "%10u %10.1fms %8.2fus %s\n", stat->count, stat->usec / 1000.0,
+			(double)stat->usec / stat->count, VM_SyscallName( vm, sorted[i].num ) );
+	}
+	Com_Printf( "%10.0f %10.1fms            total\n", totalCount, totalUsec / 1000.0 );
+
+	memset( vm->syscallStats, 0, VM_MAX_SYSCALL_STATS * sizeof( *vm->syscallStats ) );
+	Z_Free( sorted );
+}
+
+/*
+==============================================================================
+
+SAMPLING PROFILER
+
+Compiled code doesn't bump the profileCount of its symbols.  Instead,
+"vmprofile start" has the platform interrupt the main thread and
+VM_SampleStack walk the native stack of the compiled vm that is running.
+"vmprofile stop" maps the code offsets to functions through the symbols,
+prints the flat and inclusive profiles and writes the stacks in the folded
+format flamegraph.pl reads to vmprofile/<vm>.folded.
+
+The modules have to stay loaded and need symbols, so developer 1 and the
+vm/<vm>.map file when they are loaded.
+==============================================================================
+*/
+
+#if !defined( NO_VM_COMPILED ) && ( id386 || idx64 )
+#define	VM_SAMPLING
+#endif
+
+#ifdef VM_SAMPLING
+
+#define	VMPROF_DEFAULT_HZ	1000
+#define	VMPROF_BUFFER_INTS	( 1 << 19 )
+#define	VMPROF_MAX_FRAMES	64
+#define	VMPROF_MAX_LINES	40
+
+// each sample is ( vm index << 16 ) | frame count followed by the frames, leaf first
+static struct {
+	int		*samples;
+	int		used;
+	int		numSamples;
+	int		dropped;		// the buffer was full
+	int		idle;			// no compiled vm was running
+	int		startTime;
+} vmprof;
+
+typedef struct {
+	int			ofs;			// code offset of the function
+	const char	*name;
+	int			self;
+	int			total;
+	int			lastSample;		// already in total for this sample
+} vmProfFunc_t;
+
+static vmProfFunc_t	*vmprofFuncs;
+static int			vmprofNumFuncs;
+
+/*
+=================
+VM_ProfileSample
+
+Called from the signal handler or sampling thread, can't allocate
+=================
+*/
+static void VM_ProfileSample( void *pc, void *sp )
+{
+	int		*sample;
+	int		numFrames;
+	vm_t	*vm;
+
+	if ( vmprof.used + 1 + VMPROF_MAX_FRAMES > VMPROF_BUFFER_INTS ) {
+		vmprof.dropped++;
+		return;
+	}
+
+	sample = vmprof.samples + vmprof.used;
+	vm = VM_SampleStack( pc, sp, sample + 1, VMPROF_MAX_FRAMES, &numFrames );
+	if ( vm < vmTable || vm >= vmTable + MAX_VM ) {
+		vmprof.idle++;
+		return;
+	}
+
+	sample[0] = ( (int)( vm - vmTable ) << 16 ) | numFrames;
+	vmprof.used += 1 + numFrames;
+	vmprof.numSamples++;
+}
+
+static int QDECL VM_ProfileFuncSort( const void *a, const void *b )
+{
+	return ((const vmProfFunc_t *)a)->ofs - ((const vmProfFunc_t *)b)->ofs;
+}
+
+/*
+=================
+VM_ProfileFunctions
+
+The functions of a vm sorted by code offset.  The first is the engine,
+for samples taken in syscalls.
+=================
+*/
+static void VM_ProfileFunctions( vm_t *vm )
+{
+	vmSymbol_t	*sym;
+	int			count;
+
+	vmprofFuncs = Z_Malloc( ( vm->numSymbols + 1 ) * sizeof( *vmprofFuncs ) );
+	vmprofFuncs[0].ofs = VM_SAMPLE_ENGINE;
+	vmprofFuncs[0].name = "[engine]";
+	vmprofFuncs[0].lastSample = -1;
+	count = 1;
+
+	// negative values are the traps
+	for ( sym = vm->symbols ; sym ; sym = sym->next ) {
+		if ( sym->symValue < 0 ) {
+			continue;
+		}
+		vmprofFuncs[count].ofs = sym->symValue;
+		vmprofFuncs[count].name = sym->symName;
+		vmprofFuncs[count].lastSample = -1;
+		count++;
+	}
+
+	qsort( vmprofFuncs + 1, count - 1, sizeof( *vmprofFuncs ), VM_ProfileFuncSort );
+	vmprofNumFuncs = count;
+}
+
+/*
+=================
+VM_ProfileFunction
+
+Same as VM_ValueToFunctionSymbol with a binary search, there are many
+thousand frames to look up
+=================
+*/
+static int VM_ProfileFunction( int ofs )
+{
+	int lo, hi, mid;
+
+	if ( ofs == VM_SAMPLE_ENGINE || vmprofNumFuncs < 2 ) {
+		return 0;
+	}
+
+	lo = 1;
+	hi = vmprofNumFuncs - 1;
+	while ( lo < hi ) {
+		mid = ( lo + hi + 1 ) / 2;
+		if ( vmprofFuncs[mid].ofs <= ofs ) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+static int QDECL VM_ProfileSelfSort( const void *a, const void *b )
+{
+	return vmprofFuncs[*(const int *)b].self - vmprofFuncs[*(const int *)a].self;
+}
+
+static int QDECL VM_ProfileTotalSort( const void *a, const void *b )
+{
+	return vmprofFuncs[*(const int *)b].total - vmprofFuncs[*(const int *)a].total;
+}
+
+/*
+=================
+VM_ProfileStackSort
+
+Orders the stacks root first, so equal ones end up next to each other
+=================
+*/
+static int QDECL VM_ProfileStackSort( const void *a, const void *b )
+{
+	const int	*sa = *(const int **)a;
+	const int	*sb = *(const int **)b;
+	int			na = sa[0] & 0xffff;
+	int			nb = sb[0] & 0xffff;
+	int			i;
+
+	for ( i = 0 ; i < na && i < nb ; i++ ) {
+		if ( sa[na - i] != sb[nb - i] ) {
+			return sa[na - i] - sb[nb - i];
+		}
+	}
+
+	return na - nb;
+}
+
+static void VM_ProfilePrint( const char *title, int *order, int count, int numSamples, qboolean self )
+{
+	int i;
+
+	Com_Printf( "%s:\n", title );
+	for ( i = 0 ; i < count && i < VMPROF_MAX_LINES ; i++ ) {
+		vmProfFunc_t *func = &vmprofFuncs[order[i]];
+		int n = self ? func->self : func->total;
+
+		if ( !n ) {
+			break;
+		}
+		Com_Printf( "%5.1f%% %7i %s\n", 100.0 * n / numSamples, n, func->name );
+	}
+}
+
+/*
+=================
+VM_ProfileReport
+
+Profiles and folded stacks of the samples taken in one vm
+=================
+*/
+static void VM_ProfileReport( vm_t *vm, int index )
+{
+	int				**stacks;
+	int				*order;
+	int				numStacks;
+	int				i, j, n;
+	char			path[MAX_QPATH];
+	fileHandle_t	f;
+
+	stacks = Z_Malloc( vmprof.numSamples * sizeof( *stacks ) );
+	numStacks = 0;
+	for ( i = 0 ; i < vmprof.used ; i += 1 + ( vmprof.samples[i] & 0xffff ) ) {
+		if ( vmprof.samples[i] >> 16 == index ) {
+			stacks[numStacks++] = vmprof.samples + i;
+		}
+	}
+
+	if ( !numStacks ) {
+		Z_Free( stacks );
+		return;
+	}
+
+	if ( !vm->name[0] || !vm->compiled ) {
+		Com_Printf( "%i samples in a vm that has been unloaded\n", numStacks );
+		Z_Free( stacks );
+		return;
+	}
+
+	if ( !vm->numSymbols ) {
+		Com_Printf( "%i samples in %s, but it has no symbols (load it with developer 1)\n", numStacks, vm->name );
+		Z_Free( stacks );
+		return;
+	}
+
+	// turn the code offsets into functions
+	VM_ProfileFunctions( vm );
+	for ( i = 0 ; i < numStacks ; i++ ) {
+		int *stack = stacks[i];
+
+		n = stack[0] & 0xffff;
+		for ( j = 1 ; j <= n ; j++ ) {
+			vmProfFunc_t *func;
+
+			stack[j] = VM_ProfileFunction( stack[j] );
+			func = &vmprofFuncs[stack[j]];
+
+			// recursion only counts once
+			if ( func->lastSample != i ) {
+				func->lastSample = i;
+				func->total++;
+			}
+		}
+		vmprofFuncs[stack[1]].self++;
+	}
+
+	order = Z_Malloc( vmprofNumFuncs * sizeof( *order ) );
+	for ( i = 0 ; i < vmprofNumFuncs ; i++ ) {
+		order[i] = i;
+	}
+
+	Com_Printf( "%s: %i samples\n", vm->name, numStacks );
+	qsort( order, vmprofNumFuncs, sizeof( *order ), VM_ProfileSelfSort );
+	VM_ProfilePrint( "flat", order, vmprofNumFuncs, numStacks, qtrue );
+	qsort( order, vmprofNumFuncs, sizeof( *order ), VM_ProfileTotalSort );
+	VM_ProfilePrint( "inclusive", order, vmprofNumFuncs, numStacks, qfalse );
+
+	// one line per distinct stack, root first
+	Com_sprintf( path, sizeof( path ), "vmprofile/%s.folded", vm->name );
+	f = FS_FOpenFileWrite( path );
+	if ( f ) {
+		qsort( stacks, numStacks, sizeof( *stacks ), VM_ProfileStackSort );
+		for ( i = 0 ; i < numStacks ; i += n ) {
+			int *stack = stacks[i];
+
+			for ( n = 1 ; i + n < numStacks && !VM_ProfileStackSort( &stacks[i], &stacks[i + n] ) ; n++ ) {
+			}
+
+			FS_Printf( f, "%s", vm->name );
+			for ( j = stack[0] & 0xffff ; j > 0 ; j-- ) {
+				FS_Printf( f, ";%s", vmprofFuncs[stack[j]].name );
+			}
+			FS_Printf( f, " %i\n", n );
+		}
+		FS_FCloseFile( f );
+		Com_Printf( "wrote %s\n", path );
+	} else {
+		Com_Printf( "couldn't write %s\n", path );
+	}
+
+	Z_Free( order );
+	Z_Free( vmprofFuncs );
+	vmprofFuncs = NULL;
+	Z_Free( stacks );
+}
+
+static void VM_ProfileStart( int hz )
+{
+	if ( vmprof.samples ) {
+		Com_Printf( "vm profiler is already running\n" );
+		return;
+	}
+
+	memset( &vmprof, 0, sizeof( vmprof ) );
+	vmprof.samples = Z_Malloc( VMPROF_BUFFER_INTS * sizeof( *vmprof.samples ) );
+	vmprof.startTime = Sys_Milliseconds();
+
+	if ( !Sys_StartSampling( hz, VM_ProfileSample ) ) {
+		Z_Free( vmprof.samples );
+		vmprof.samples = NULL;
+		return;
+	}
+
+	Com_Printf( "vm profiler sampling at %i Hz\n", hz );
+}
+
+static void VM_ProfileStop( void )
+{
+	int i;
+
+	if ( !vmprof.samples ) {
+		Com_Printf( "vm profiler isn't running\n" );
+		return;
+	}
+
+	Sys_StopSampling();
+
+	Com_Printf( "%i samples in %.1f seconds, %i outside compiled vms, %i dropped\n",
+		vmprof.numSamples, ( Sys_Milliseconds() - vmprof.startTime ) / 1000.0, vmprof.idle, vmprof.dropped );
+
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		VM_ProfileReport( &vmTable[i], i );
+	}
+
+	Z_Free( vmprof.samples );
+	vmprof.samples = NULL;
+}
+
+#endif
+
+/*
+=================
+VM_VmProfile_f
+
+Function profile of the last vm called, if it was interpreted with symbols,
+followed by the count and time of each syscall it made since the last vmprofile.
+"vmprofile start [hz]" and "vmprofile stop" run the sampling profiler.
+=================
+*/
+void VM_VmProfile_f( void )
+{
+	if ( Cmd_Argc() > 1 ) {
+#ifdef VM_SAMPLING
+		if ( !Q_stricmp( Cmd_Argv( 1 ), "start" ) ) {
+			int hz = Cmd_Argc() > 2 ? atoi( Cmd_Argv( 2 ) ) : VMPROF_DEFAULT_HZ;
+
+			VM_ProfileStart( Com_Clamp( 10, 10000, hz ) );
+		} else if ( !Q_stricmp( Cmd_Argv( 1 ), "stop" ) ) {
+			VM_ProfileStop();
+		} else {
+			Com_Printf( "usage: vmprofile [start [hz] | stop]\n" );
+		}
+#else
+		Com_Printf( "the sampling profiler needs the x86 compiler\n" );
+#endif
+		return;
+	}
+
+    if ( !lastVM ) {
+		return;
+	}
+
+	vm_t* vm = lastVM;
+
+	if ( vm->numSymbols ) {
+		VM_ProfileSymbols( vm );
+	}
+
+	if ( vm->syscallStats ) {
+		VM_ProfileSyscalls( vm );
+	}
+}
+
+
 void VM_VmInfo_f( void )
 {
 	vm_t	*vm;
@@ -925,14 +1468,295 @@ void VM_BlockCopy(unsigned int dest, unsigned int src, size_t n)
 	memcpy(currentVM->dataBase + dest, currentVM->dataBase + src, n);
 }
 
+/*
+==============================================================================
+
+VM BENCHMARK
+
+A small program is assembled in memory and run by the interpreter and by
+the compiler with and without the optimising tier.  The loop mixes integer
+arithmetic, array indexing, float math, a call and a local increment, about
+the instruction mix of the game modules.
+
+==============================================================================
+*/
+
+#define	VMBENCH_ARRAY		16				// 64 ints
+#define	VMBENCH_DATA_SIZE	( 2 * PROGRAM_STACK_SIZE )
+
+typedef struct {
+	byte	code[512];
+	int		codeLength;
+	int		instructionCount;
+} vmBenchProgram_t;
+
+static int VM_BenchOp( vmBenchProgram_t *p, int op )
+{
+	p->code[p->codeLength++] = op;
+	p->instructionCount++;
+	return p->codeLength;
+}
+
+static void VM_BenchOp1( vmBenchProgram_t *p, int op, int value )
+{
+	VM_BenchOp( p, op );
+	p->code[p->codeLength++] = value;
+}
+
+static int VM_BenchOp4( vmBenchProgram_t *p, int op, int value )
+{
+	int ofs = VM_BenchOp( p, op );
+
+	p->code[p->codeLength++] = value & 0xFF;
+	p->code[p->codeLength++] = ( value >> 8 ) & 0xFF;
+	p->code[p->codeLength++] = ( value >> 16 ) & 0xFF;
+	p->code[p->codeLength++] = ( value >> 24 ) & 0xFF;
+	return ofs;
+}
+
+static void VM_BenchPatch( vmBenchProgram_t *p, int ofs, int value )
+{
+	p->code[ofs] = value & 0xFF;
+	p->code[ofs+1] = ( value >> 8 ) & 0xFF;
+	p->code[ofs+2] = ( value >> 16 ) & 0xFF;
+	p->code[ofs+3] = ( value >> 24 ) & 0xFF;
+}
+
+/*
+=================
+VM_BenchAssemble
+
+vmMain( iterations ):
+	for ( i = 0, sum = 0, f = 0 ; i < iterations ; i++ ) {
+		sum = ( sum + i * 3 + ( i >> 2 ) ) ^ array[i & 63];
+		array[i & 63] = sum;
+		f = f * 0.5f + i;
+		t = leaf( i, sum );
+		sum = sum + t;
+	}
+	return sum ^ (int)f;
+
+leaf( a, b ):
+	return a + ( b & 7 );
+
+Returns the number of instructions executed per iteration
+=================
+*/
+static int VM_BenchAssemble( vmBenchProgram_t *p, int *loopStart )
+{
+	int jumpCond, callLeaf, loop, end, leaf;
+	floatint_t half;
+
+	half.f = 0.5f;
+	memset( p, 0, sizeof( *p ) );
+
+	// locals: i 16, sum 20, f 24, t 28, iterations 40
+	VM_BenchOp4( p, OP_ENTER, 32 );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp4( p, OP_CONST, 0 ); VM_BenchOp( p, OP_STORE4 );
+	VM_BenchOp4( p, OP_LOCAL, 20 ); VM_BenchOp4( p, OP_CONST, 0 ); VM_BenchOp( p, OP_STORE4 );
+	VM_BenchOp4( p, OP_LOCAL, 24 ); VM_BenchOp4( p, OP_CONST, 0 ); VM_BenchOp( p, OP_STORE4 );
+	jumpCond = VM_BenchOp4( p, OP_CONST, 0 ); VM_BenchOp( p, OP_JUMP );
+
+	loop = p->instructionCount;
+
+	VM_BenchOp4( p, OP_LOCAL, 20 );
+	VM_BenchOp4( p, OP_LOCAL, 20 ); VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, 3 ); VM_BenchOp( p, OP_MULI );
+	VM_BenchOp( p, OP_ADD );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, 2 ); VM_BenchOp( p, OP_RSHI );
+	VM_BenchOp( p, OP_ADD );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, 63 ); VM_BenchOp( p, OP_BAND );
+	VM_BenchOp4( p, OP_CONST, 2 ); VM_BenchOp( p, OP_LSH ); VM_BenchOp4( p, OP_CONST, VMBENCH_ARRAY ); VM_BenchOp( p, OP_ADD );
+	VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp( p, OP_BXOR );
+	VM_BenchOp( p, OP_STORE4 );
+
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, 63 ); VM_BenchOp( p, OP_BAND );
+	VM_BenchOp4( p, OP_CONST, 2 ); VM_BenchOp( p, OP_LSH ); VM_BenchOp4( p, OP_CONST, VMBENCH_ARRAY ); VM_BenchOp( p, OP_ADD );
+	VM_BenchOp4( p, OP_LOCAL, 20 ); VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp( p, OP_STORE4 );
+
+	VM_BenchOp4( p, OP_LOCAL, 24 );
+	VM_BenchOp4( p, OP_LOCAL, 24 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, half.i ); VM_BenchOp( p, OP_MULF );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp( p, OP_CVIF );
+	VM_BenchOp( p, OP_ADDF );
+	VM_BenchOp( p, OP_STORE4 );
+
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp1( p, OP_ARG, 8 );
+	VM_BenchOp4( p, OP_LOCAL, 20 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp1( p, OP_ARG, 12 );
+	VM_BenchOp4( p, OP_LOCAL, 28 );
+	callLeaf = VM_BenchOp4( p, OP_CONST, 0 ); VM_BenchOp( p, OP_CALL );
+	VM_BenchOp( p, OP_STORE4 );
+	VM_BenchOp4( p, OP_LOCAL, 20 );
+	VM_BenchOp4( p, OP_LOCAL, 20 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_LOCAL, 28 ); VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp( p, OP_ADD );
+	VM_BenchOp( p, OP_STORE4 );
+
+	VM_BenchOp4( p, OP_LOCAL, 16 );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, 1 ); VM_BenchOp( p, OP_ADD );
+	VM_BenchOp( p, OP_STORE4 );
+
+	VM_BenchPatch( p, jumpCond, p->instructionCount );
+	VM_BenchOp4( p, OP_LOCAL, 16 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_LOCAL, 40 ); VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp4( p, OP_LTI, loop );
+
+	end = p->instructionCount;
+
+	VM_BenchOp4( p, OP_LOCAL, 20 ); VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp4( p, OP_LOCAL, 24 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp( p, OP_CVFI );
+	VM_BenchOp( p, OP_BXOR );
+	VM_BenchOp4( p, OP_LEAVE, 32 );
+
+	leaf = p->instructionCount;
+	VM_BenchPatch( p, callLeaf, leaf );
+
+	VM_BenchOp4( p, OP_ENTER, 16 );
+	VM_BenchOp4( p, OP_LOCAL, 24 ); VM_BenchOp( p, OP_LOAD4 );
+	VM_BenchOp4( p, OP_LOCAL, 28 ); VM_BenchOp( p, OP_LOAD4 ); VM_BenchOp4( p, OP_CONST, 7 ); VM_BenchOp( p, OP_BAND );
+	VM_BenchOp( p, OP_ADD );
+	VM_BenchOp4( p, OP_LEAVE, 16 );
+
+	*loopStart = loop;
+	return ( end - loop ) + ( p->instructionCount - leaf );
+}
+
+static intptr_t VM_BenchSyscall( intptr_t *args )
+{
+	return 0;
+}
+
+/*
+=================
+VM_BenchRun
+
+Loads the program into a scratch vm and times one vmMain call
+=================
+*/
+static qboolean VM_BenchRun( vmBenchProgram_t *p, int loopStart, qboolean compile, int iterations, int *result, int *msec )
+{
+	vm_t vm;
+	vm_t *savedVM = currentVM;
+	vmHeader_t *header;
+	int args[MAX_VMMAIN_ARGS];
+	int start;
+
+	memset( &vm, 0, sizeof( vm ) );
+	Q_strncpyz( vm.name, "vmbench", sizeof( vm.name ) );
+	vm.systemCall = VM_BenchSyscall;
+	vm.dataBase = Z_Malloc( VMBENCH_DATA_SIZE + VM_DATA_GUARD );
+	vm.dataMask = VMBENCH_DATA_SIZE - 1;
+	vm.instructionCount = p->instructionCount;
+	vm.instructionPointers = Z_Malloc( p->instructionCount * sizeof( *vm.instructionPointers ) );
+	vm.codeLength = p->codeLength;
+	vm.jumpTableTargets = (unsigned char *) &loopStart;
+	vm.numJumpTableTargets = 1;
+
+	header = Z_Malloc( sizeof( *header ) + p->codeLength );
+	header->vmMagic = VM_MAGIC_VER2;
+	header->instructionCount = p->instructionCount;
+	header->codeOffset = sizeof( *header );
+	header->codeLength = p->codeLength;
+	memcpy( header + 1, p->code, p->codeLength );
+
+#ifndef NO_VM_COMPILED
+	if ( compile ) {
+		vm.compiled = qtrue;
+		VM_Compile( &vm, header );
+	}
+#endif
+	// the interpreter image comes from the hunk and stays there until
+	// the next hunk clear, it is only a few hundred bytes
+	if ( !vm.compiled ) {
+		VM_PrepareInterpreter( &vm, header );
+	}
+	Z_Free( header );
+
+	vm.programStack = vm.dataMask + 1;
+	vm.stackBottom = vm.programStack - PROGRAM_STACK_SIZE;
+
+	memset( args, 0, sizeof( args ) );
+	args[0] = iterations;
+
+	start = Sys_Milliseconds();
+#ifndef NO_VM_COMPILED
+	if ( vm.compiled )
+		*result = VM_CallCompiled( &vm, args );
+	else
+#endif
+		*result = VM_CallInterpreted( &vm, args );
+	*msec = Sys_Milliseconds() - start;
+
+	currentVM = savedVM;
+
+	if ( vm.destroy )
+		vm.destroy( &vm );
+	Z_Free( vm.instructionPointers );
+	Z_Free( vm.dataBase );
+
+	return vm.compiled == compile;
+}
+
+/*
+=================
+VM_VmBench_f
+
+vmbench [iterations]
+=================
+*/
+void VM_VmBench_f( void )
+{
+	static const char *modes[] = { "interpreted", "compiled", "optimised" };
+	vmBenchProgram_t program;
+	char savedOptimize[MAX_CVAR_VALUE_STRING];
+	int iterations, opsPerIteration, loopStart;
+	int results[ARRAY_LEN( modes )];
+	int i, msec;
+
+	iterations = ( Cmd_Argc() > 1 ) ? atoi( Cmd_Argv( 1 ) ) : 5000000;
+	if ( iterations < 1 ) {
+		Com_Printf( "usage: vmbench [iterations]\n" );
+		return;
+	}
+
+	opsPerIteration = VM_BenchAssemble( &program, &loopStart );
+	Q_strncpyz( savedOptimize, vm_jitOptimize->string, sizeof( savedOptimize ) );
+
+	for ( i = 0 ; i < ARRAY_LEN( modes ) ; i++ ) {
+		if ( i ) {
+			Cvar_Set( "vm_jitOptimize", ( i == 2 ) ? "1" : "0" );
+		}
+
+		if ( !VM_BenchRun( &program, loopStart, ( i != 0 ), iterations, &results[i], &msec ) ) {
+			Com_Printf( "%-12s not available\n", modes[i] );
+			results[i] = results[0];
+			continue;
+		}
+
+		Com_Printf( "%-12s %6i msec %9.1f Mops/s\n", modes[i], msec,
+			msec ? (double) iterations * opsPerIteration / msec / 1000.0 : 0.0 );
+
+		if ( results[i] != results[0] ) {
+			Com_Printf( S_COLOR_YELLOW "WARNING: %s result %i differs from interpreted %i\n",
+				modes[i], results[i], results[0] );
+		}
+	}
+
+	Cvar_Set( "vm_jitOptimize", savedOptimize );
+}
+
 void VM_Init( void )
 {
 	Cvar_Get( "vm_cgame", "2", CVAR_ARCHIVE );	// !@# SHIP WITH SET TO 2
 	Cvar_Get( "vm_game", "2", CVAR_ARCHIVE );	// !@# SHIP WITH SET TO 2
 	Cvar_Get( "vm_ui", "2", CVAR_ARCHIVE );		// !@# SHIP WITH SET TO 2
 
+	vm_jitOptimize = Cvar_Get( "vm_jitOptimize", "1", CVAR_ARCHIVE );
+	vm_cache = Cvar_Get( "vm_cache", "1", CVAR_ARCHIVE );
+	vm_syscallTiming = Cvar_Get( "vm_syscallTiming", "0", 0 );
+
 	Cmd_AddCommand ("vmprofile", VM_VmProfile_f );
 	Cmd_AddCommand ("vminfo", VM_VmInfo_f );
+	Cmd_AddCommand ("vmbench", VM_VmBench_f );
 
 	memset( vmTable, 0, sizeof( vmTable ) );
 }
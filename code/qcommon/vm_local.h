@@ -41,6 +41,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define	PROGRAM_STACK_SIZE	0x10000
 #define	PROGRAM_STACK_MASK	(PROGRAM_STACK_SIZE-1)
 
+// slack allocated past the data segment, compiled code may address
+// program stack locals below this offset without masking them
+#define	VM_DATA_GUARD		PROGRAM_STACK_SIZE
+
 typedef enum {
 	OP_UNDEF, 
 
@@ -179,15 +183,36 @@ struct vm_s {
 
 	unsigned char *jumpTableTargets;
 	int	numJumpTableTargets;
+
+	const vmSyscall_t *syscallTable;	// see VM_SetSyscallTable
+	int	numSyscalls;
+	struct vmSyscallStat_s *syscallStats;	// VM_MAX_SYSCALL_STATS, for vmprofile
 };
 
+// trap numbers from here on share the last counter
+#define	VM_MAX_SYSCALL_STATS	1024
+
+typedef struct vmSyscallStat_s {
+	unsigned int	count;
+	int64_t			usec;		// only with vm_syscallTiming, includes vm re-entry
+} vmSyscallStat_t;
+
 
 extern vm_t *currentVM;
+extern cvar_t *vm_jitOptimize;
+extern cvar_t *vm_cache;
+extern cvar_t *vm_syscallTiming;
+
 
+intptr_t VM_SystemCall( vm_t *vm, intptr_t *args );
 
 void VM_Compile( vm_t * const vm, vmHeader_t *header );
 intptr_t VM_CallCompiled( vm_t * const vm, int *args );
 
+// frame of a sample taken while the engine was running, see VM_SampleStack
+#define	VM_SAMPLE_ENGINE	-1
+vm_t *VM_SampleStack( void *pc, void *sp, int *frames, int maxFrames, int *numFrames );
+
 void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header );
 int	VM_CallInterpreted( vm_t *vm, int *args );
 
@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 
 #include "vm_local.h"
+#include "../platform/sys_public.h"
 
 #ifdef _WIN32
   #include <windows.h>
@@ -109,6 +110,8 @@ x86_64:
 static int pc = 0;
 static int compiledOfs = 0;
 
+#define	OPSTACK_GUARD	128
+
 #define FTOL_PTR
 
 static	int	instruction;
@@ -127,7 +130,8 @@ typedef enum
 typedef enum
 {
 	VM_JMP_VIOLATION = 0,
-	VM_BLOCK_COPY = 1
+	VM_BLOCK_COPY = 1,
+	VM_STACK_VIOLATION = 2
 } ESysCallType;
 
 static ELastCommand	LastCommand;
@@ -491,6 +495,14 @@ int *vm_opStackBase;
 uint8_t vm_opStackOfs;
 intptr_t vm_arg;
 
+// innermost VM_CallCompiled on the main thread, for VM_SampleStack
+static volatile struct
+{
+	vm_t *vm;
+	void *stackTop;			// the native stack above belongs to the engine
+	void *syscallFrame;		// set by the DoSyscall stub while the engine runs a syscall
+} activeCall;
+
 static void DoSyscall(void)
 {
 	vm_t *savedVM;
@@ -516,10 +528,10 @@ static void DoSyscall(void)
 		for(index = 1; index < ARRAY_LEN(args); index++)
 			args[index] = data[index];
 			
-		*ret = savedVM->systemCall(args);
+		*ret = VM_SystemCall(savedVM, args);
 #else
 		data[0] = ~vm_syscallNum;
-		*ret = savedVM->systemCall((intptr_t *) data);
+		*ret = VM_SystemCall(savedVM, (intptr_t *) data);
 #endif
 	}
 	else
@@ -535,6 +547,9 @@ static void DoSyscall(void)
 			
 			VM_BlockCopy(vm_opStackBase[(vm_opStackOfs - 1)], vm_opStackBase[vm_opStackOfs], vm_arg);
 		break;
+		case VM_STACK_VIOLATION:
+			Com_Error(ERR_DROP, "VM program stack out of range");
+		break;
 		default:
 			Com_Error(ERR_DROP, "Unknown VM operation %d", vm_syscallNum);
 		break;
@@ -542,6 +557,72 @@ static void DoSyscall(void)
 	}
 
 	currentVM = savedVM;
+	activeCall.syscallFrame = NULL;
+}
+
+/*
+=================
+EmitRelocPtr
+
+Pointer into the engine.  Its position is recorded so that a cached
+image can be patched for wherever the engine got loaded this time
+=================
+*/
+
+typedef enum
+{
+	VM_RELOC_DOSYSCALL = 0,
+	VM_RELOC_SYSCALLNUM,
+	VM_RELOC_PROGRAMSTACK,
+	VM_RELOC_OPSTACKOFS,
+	VM_RELOC_OPSTACKBASE,
+	VM_RELOC_ARG,
+	VM_RELOC_FTOL,
+	VM_RELOC_SYSCALLFRAME,
+	VM_RELOC_MAX
+} EVMRelocType;
+
+typedef struct
+{
+	int ofs;
+	int type;
+} vmReloc_t;
+
+// only collected when the compiled image is going to be cached
+static vmReloc_t *relocs;
+static int numRelocs, maxRelocs;
+
+static void *RelocTarget(int type)
+{
+	switch(type)
+	{
+	case VM_RELOC_DOSYSCALL:	return DoSyscall;
+	case VM_RELOC_SYSCALLNUM:	return &vm_syscallNum;
+	case VM_RELOC_PROGRAMSTACK:	return &vm_programStack;
+	case VM_RELOC_OPSTACKOFS:	return &vm_opStackOfs;
+	case VM_RELOC_OPSTACKBASE:	return &vm_opStackBase;
+	case VM_RELOC_ARG:			return &vm_arg;
+	case VM_RELOC_FTOL:			return Q_VMftol;
+	case VM_RELOC_SYSCALLFRAME:	return (void *) &activeCall.syscallFrame;
+	}
+
+	return NULL;
+}
+
+static void EmitRelocPtr(unsigned char *buf, int type)
+{
+	if(relocs)
+	{
+		// an overflow just leaves the image out of the cache
+		if(numRelocs < maxRelocs)
+		{
+			relocs[numRelocs].ofs = compiledOfs;
+			relocs[numRelocs].type = type;
+		}
+		numRelocs++;
+	}
+
+	EmitPtr(buf, RelocTarget(type));
 }
 
 /*
@@ -567,7 +648,7 @@ static int EmitCallDoSyscall(unsigned char * buf, vm_t *vm)
 {
 	// use edx register to store DoSyscall address
 	EmitRexString(buf, 0x48, "BA");		// mov edx, DoSyscall
-	EmitPtr(buf, DoSyscall);
+	EmitRelocPtr(buf, VM_RELOC_DOSYSCALL);
 
 	// Push important registers to stack as we can't really make
 	// any assumptions about calling conventions.
@@ -582,28 +663,33 @@ static int EmitCallDoSyscall(unsigned char * buf, vm_t *vm)
 	// write arguments to global vars
 	// syscall number
 	EmitString(buf, "A3");			// mov [0x12345678], eax
-	EmitPtr(buf, &vm_syscallNum);
+	EmitRelocPtr(buf, VM_RELOC_SYSCALLNUM);
 	// vm_programStack value
 	EmitString(buf, "89 F0");		// mov eax, esi
 	EmitString(buf, "A3");			// mov [0x12345678], eax
-	EmitPtr(buf, &vm_programStack);
+	EmitRelocPtr(buf, VM_RELOC_PROGRAMSTACK);
 	// vm_opStackOfs 
 	EmitString(buf, "88 D8");			// mov al, bl
 	EmitString(buf, "A2");			// mov [0x12345678], al
-	EmitPtr(buf, &vm_opStackOfs);
+	EmitRelocPtr(buf, VM_RELOC_OPSTACKOFS);
 	// vm_opStackBase
 	EmitRexString(buf, 0x48, "89 F8");		// mov eax, edi
 	EmitRexString(buf, 0x48, "A3");		// mov [0x12345678], eax
-	EmitPtr(buf, &vm_opStackBase);
+	EmitRelocPtr(buf, VM_RELOC_OPSTACKBASE);
 	// vm_arg
 	EmitString(buf, "89 C8");			// mov eax, ecx
 	EmitString(buf, "A3");			// mov [0x12345678], eax
-	EmitPtr(buf, &vm_arg);
+	EmitRelocPtr(buf, VM_RELOC_ARG);
 	
 	// align the stack pointer to a 16-byte-boundary
 	EmitString(buf, "55");			// push ebp
 	EmitRexString(buf, 0x48, "89 E5");		// mov ebp, esp
 	EmitRexString(buf, 0x48, "83 E4 F0");	// and esp, 0xFFFFFFF0
+
+	// let the sampling profiler skip the engine's frames
+	EmitRexString(buf, 0x48, "89 E8");		// mov eax, ebp
+	EmitRexString(buf, 0x48, "A3");		// mov [0x12345678], eax
+	EmitRelocPtr(buf, VM_RELOC_SYSCALLFRAME);
 			
 	// call the syscall wrapper function DoSyscall()
 
@@ -642,6 +728,28 @@ static void EmitCallErrJump(unsigned char * buf, vm_t *vm, int sysCallOfs)
 }
 
 
+#if idx64
+/*
+=================
+EmitStackViolation
+Shared target for the program stack checks of the optimising compiler
+=================
+*/
+
+static int EmitStackViolation(unsigned char * buf, vm_t *vm, int sysCallOfs)
+{
+	int retval = compiledOfs;
+
+	EmitString(buf, "B8");			// mov eax, 0x12345678
+	Emit4(buf, VM_STACK_VIOLATION);
+
+	EmitCallRel(buf, vm, sysCallOfs);
+
+	return retval;
+}
+#endif
+
+
 /*
 =================
 EmitCallProcedure
@@ -1147,170 +1255,1376 @@ static qboolean ConstOptimize(unsigned char * buf, vm_t *vm, int callProcOfsSysc
 	return qfalse;
 }
 
-///////////////////////////////////////////////////////////////////////
-// debug
+#if idx64
+/*
+==============================================================================
 
-void FileSys_PrintfHexToFile(const char * name, unsigned char * pBuf, unsigned int len)
+OPTIMISING TIER
+
+The values at the top of the opStack are kept in a small compile time stack
+instead of being written out by every instruction: constants, program stack
+addresses and registers.  They are only stored to the real opStack at jump
+labels, calls and instructions this tier leaves to the code above, so most
+expressions are evaluated in registers, constants become immediates and
+LOAD/ADD/STORE sequences collapse into single memory operations.
+
+  eax, ecx, edx, r10d, r11d	pending values
+  xmm0, xmm1				float scratch
+
+Program stack addresses are not masked: OP_ENTER and OP_LEAVE keep esi
+inside the data segment and the segment is followed by VM_DATA_GUARD bytes,
+so esi plus any smaller non-negative offset stays within the allocation.
+This depends on the jump table to know every instruction that can be
+reached without falling through, so it is only used for VM_MAGIC_VER2 images.
+
+==============================================================================
+*/
+
+#define	VS_MAX			8
+#define	VS_MAX_MEMPOPS	31
+
+typedef enum
 {
-	char local_name[128] = { 0 };
-#ifndef NDEBUG
-	snprintf(local_name, 127, "compiled_%s_debug.txt", name);
-#else
-	snprintf(local_name, 127, "compiled_%s_release.txt", name);
-#endif
+	VS_CONST,
+	VS_LOCAL,
+	VS_REG
+} vsType_t;
 
-	unsigned char * pOpcode = (unsigned char *) malloc ( len * 3 + len / 20 + 10);
-	unsigned int j = 0;
-	for (unsigned int i = 0; i < len; ++i)
-	{
-		Hes2char(pBuf[i], pOpcode+j);
-		j += 2;
-		pOpcode[j++] = ' ';
-		if ( (i != 0 ) && (i % 20) == 0)
-			pOpcode[j++] = '\n';
-	}
+typedef struct
+{
+	vsType_t	type;
+	int			value;		// constant, program stack offset or register
+} vsEntry_t;
 
-	pOpcode[j] = '\0';
+// addressing modes
+typedef enum
+{
+	MEM_OPSTACK,			// [rdi + rbx * 4 + disp8]
+	MEM_DATA,				// [r9 + disp32]
+	MEM_LOCAL,				// [r9 + rsi + disp32]
+	MEM_INDEXED				// [r9 + index]
+} vsMem_t;
 
-	FILE* log_fp = fopen(local_name, "wt");
+static const int vsRegisters[] = { 0, 1, 2, 10, 11 };
 
-	if (log_fp)
+static vsEntry_t	vs[VS_MAX];
+static int			vsDepth;
+static int			vsMemPops;		// values loaded from the opStack without adjusting bl yet
+static int			vsRegsUsed;
+
+
+static void EmitOpcode(unsigned char * buf, int prefix, int rex, int opcode)
+{
+	if(prefix)
+		Emit1(buf, prefix);
+	if(rex != 0x40)
+		Emit1(buf, rex);
+	if(opcode > 0xFF)
+		Emit1(buf, opcode >> 8);
+	Emit1(buf, opcode & 0xFF);
+}
+
+/*
+=================
+EmitOpReg
+op reg, rm with both operands in registers
+=================
+*/
+static void EmitOpReg(unsigned char * buf, int prefix, int opcode, int reg, int rm)
+{
+	EmitOpcode(buf, prefix, 0x40 | ((reg & 8) >> 1) | ((rm & 8) >> 3), opcode);
+	Emit1(buf, 0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+/*
+=================
+EmitOpMem
+op reg, [mem]
+=================
+*/
+static void EmitOpMem(unsigned char * buf, int prefix, int opcode, int reg, vsMem_t mem, int index, int disp)
+{
+	int rex = 0x40 | ((reg & 8) >> 1);
+
+	if(mem != MEM_OPSTACK)
+		rex |= 0x01;				// r9 base
+	if(mem == MEM_INDEXED)
+		rex |= (index & 8) >> 2;
+
+	EmitOpcode(buf, prefix, rex, opcode);
+
+	switch(mem)
 	{
-		fprintf(log_fp, "%s", pOpcode);
+	case MEM_OPSTACK:
+		Emit1(buf, 0x44 | ((reg & 7) << 3));
+		Emit1(buf, 0x9F);
+		Emit1(buf, disp);
+		break;
+	case MEM_DATA:
+		Emit1(buf, 0x81 | ((reg & 7) << 3));
+		Emit4(buf, disp);
+		break;
+	case MEM_LOCAL:
+		Emit1(buf, 0x84 | ((reg & 7) << 3));
+		Emit1(buf, 0x31);
+		Emit4(buf, disp);
+		break;
+	case MEM_INDEXED:
+		Emit1(buf, 0x04 | ((reg & 7) << 3));
+		Emit1(buf, ((index & 7) << 3) | 0x01);
+		break;
+	}
+}
+
+/*
+=================
+EmitOpImm
+Immediate group 1 operation (add, or, and, sub, xor, cmp) on a register
+=================
+*/
+static void EmitOpImm(unsigned char * buf, int ext, int reg, int imm)
+{
+	if(iss8(imm))
+	{
+		EmitOpReg(buf, 0, 0x83, ext, reg);
+		Emit1(buf, imm);
 	}
 	else
 	{
-		fprintf(stderr, "Error open %s\n", name);
+		EmitOpReg(buf, 0, 0x81, ext, reg);
+		Emit4(buf, imm);
 	}
+}
 
-	fclose(log_fp);
+static int VS_AllocReg(unsigned char * buf);
+static void VS_Flush(unsigned char * buf);
 
-	free(pOpcode);
+static void VS_Reset(void)
+{
+	vsDepth = 0;
+	vsMemPops = 0;
+	vsRegsUsed = 0;
 }
 
+static void VS_FreeReg(int reg)
+{
+	vsRegsUsed &= ~(1 << reg);
+}
 
-////////////////////////////////////////////////////////////////////
-
-void VM_Compile(vm_t * const vm, vmHeader_t *header)
+/*
+=================
+VS_Sync
+Apply the opStack pops that were folded into load displacements
+=================
+*/
+static void VS_Sync(unsigned char * buf)
 {
-	int	op, v;
-    int	callProcOfsSyscall, callProcOfs, callDoSyscallOfs;
+	if(vsMemPops)
+	{
+		EmitString(buf, "80 EB");		// sub bl, vsMemPops
+		Emit1(buf, vsMemPops);
+		vsMemPops = 0;
+	}
+}
 
-	// allocate a very large temp buffer, we will shrink it later
-	int maxLength = header->codeLength * 8 + 64;
-	unsigned char* buf = Z_Malloc(maxLength);
-    memset(buf, 0, maxLength);
+/*
+=================
+VS_Flush
+Write all pending values to the opStack
+=================
+*/
+static void VS_Flush(unsigned char * buf)
+{
+	int i, disp;
 
-	int jusedSize = header->instructionCount + 2;
-	unsigned char* jused = Z_Malloc(jusedSize);
-	memset(jused, 0, jusedSize);
+	VS_Sync(buf);
 
-	unsigned char* code = Z_Malloc(header->codeLength+32);
-	memset(code, 0, header->codeLength+32);
-	
-	Com_Printf(" Starting VM_Compile ... \n");
+	for(i = 0; i < vsDepth; i++)
+	{
+		disp = 4 * (i + 1);
 
-	// copy code in larger buffer and put some zeros at the end
-	// so we can safely look ahead for a few instructions in it
-	// without a chance to get false-positive because of some garbage bytes
-	memcpy(code, (byte *)header + header->codeOffset, header->codeLength );
+		switch(vs[i].type)
+		{
+		case VS_CONST:
+			EmitOpMem(buf, 0, 0xC7, 0, MEM_OPSTACK, 0, disp);		// mov dword ptr [edi + ebx * 4 + disp], const
+			Emit4(buf, vs[i].value);
+			break;
+		case VS_LOCAL:
+			EmitOpMem(buf, 0, 0x89, 6, MEM_OPSTACK, 0, disp);		// mov dword ptr [edi + ebx * 4 + disp], esi
+			if(iss8(vs[i].value))
+			{
+				EmitOpMem(buf, 0, 0x83, 0, MEM_OPSTACK, 0, disp);	// add dword ptr [edi + ebx * 4 + disp], 0x7F
+				Emit1(buf, vs[i].value);
+			}
+			else
+			{
+				EmitOpMem(buf, 0, 0x81, 0, MEM_OPSTACK, 0, disp);	// add dword ptr [edi + ebx * 4 + disp], 0x12345678
+				Emit4(buf, vs[i].value);
+			}
+			break;
+		case VS_REG:
+			EmitOpMem(buf, 0, 0x89, vs[i].value, MEM_OPSTACK, 0, disp);	// mov dword ptr [edi + ebx * 4 + disp], reg
+			VS_FreeReg(vs[i].value);
+			break;
+		}
+	}
 
-	// ensure that the optimisation pass knows about all the jump
-	// table targets
-	pc = -1; // a bogus value to be printed in out-of-bounds error messages
-	for(int i = 0; i < vm->numJumpTableTargets; ++i )
+	if(vsDepth)
 	{
-		Set_JUsed(buf, *(int *)(vm->jumpTableTargets + ( i * sizeof( int ) ) ), jused, vm);
+		EmitString(buf, "80 C3");		// add bl, vsDepth
+		Emit1(buf, vsDepth);
+		vsDepth = 0;
 	}
+}
 
-	// Start buffer with x86-VM specific procedures
-	compiledOfs = 0;
-
-	callDoSyscallOfs = compiledOfs;
-	callProcOfs = EmitCallDoSyscall(buf, vm);
-	callProcOfsSyscall = EmitCallProcedure(buf, vm, callDoSyscallOfs);
-	vm->entryOfs = compiledOfs;
+static int VS_AllocReg(unsigned char * buf)
+{
+	int i;
 
-	for(unsigned int pass=0; pass < 3; ++pass)
+	for(i = 0; i < ARRAY_LEN(vsRegisters); i++)
 	{
-	oc0 = -23423;
-	oc1 = -234354;
-	pop0 = -43435;
-	pop1 = -545455;
-
-	// translate all instructions
-	pc = 0;
-	instruction = 0;
-	//code = (byte *)header + header->codeOffset;
-	compiledOfs = vm->entryOfs;
+		if(!(vsRegsUsed & (1 << vsRegisters[i])))
+		{
+			vsRegsUsed |= 1 << vsRegisters[i];
+			return vsRegisters[i];
+		}
+	}
 
-	LastCommand = LAST_COMMAND_NONE;
+	// spill the pending values, at most two operands are in flight
+	VS_Flush(buf);
 
-	while(instruction < header->instructionCount)
+	for(i = 0; i < ARRAY_LEN(vsRegisters); i++)
 	{
-		if(compiledOfs > maxLength - 16)
+		if(!(vsRegsUsed & (1 << vsRegisters[i])))
 		{
-			Z_Free(buf);
-			Z_Free(jused);
-			Com_Error(ERR_DROP, "VM_CompileX86: maxLength exceeded");
+			vsRegsUsed |= 1 << vsRegisters[i];
+			return vsRegisters[i];
 		}
+	}
 
-		vm->instructionPointers[ instruction ] = compiledOfs;
+	Com_Error(ERR_DROP, "VM_CompileX86: out of registers");
+	return 0;
+}
 
-		if ( !vm->jumpTableTargets )
-			jlabel = 1;
-		else 
-			jlabel = jused[ instruction ];
+static void VS_Push(unsigned char * buf, vsType_t type, int value)
+{
+	if(vsDepth == VS_MAX)
+		VS_Flush(buf);
 
-		instruction++;
+	vs[vsDepth].type = type;
+	vs[vsDepth].value = value;
+	vsDepth++;
+}
 
-		if(pc > header->codeLength)
-		{
-			Z_Free(buf);
-			Z_Free(jused);
-			Com_Error(ERR_DROP, "VM_CompileX86: pc > header->codeLength");
-		}
+static void VS_Pop(unsigned char * buf, vsEntry_t *e)
+{
+	int reg;
 
-		op = code[ pc++ ];
-	
-		switch ( op )
-        {
-		case 0:
-			break;
-		case OP_BREAK:
-			EmitString(buf, "CC");				// int 3
-			break;
-		case OP_ENTER:
-			EmitString(buf, "81 EE");				// sub esi, 0x12345678
-			Emit4(buf, Constant4(code));
-			break;
-		case OP_CONST:
-			if( ConstOptimize(buf, vm, callProcOfsSyscall, pass, jused, code) )
-				break;
+	if(vsDepth)
+	{
+		*e = vs[--vsDepth];
+		return;
+	}
 
-			EmitPushStack(buf, vm);
-			EmitString(buf, "C7 04 9F");				// mov dword ptr [edi + ebx * 4], 0x12345678
-			lastConst = Constant4(code);
+	if(vsMemPops == VS_MAX_MEMPOPS)
+		VS_Sync(buf);
 
-			Emit4(buf, lastConst);
-			if(code[pc] == OP_JUMP)
-				Set_JUsed(buf, lastConst, jused, vm);
+	reg = VS_AllocReg(buf);
+	EmitOpMem(buf, 0, 0x8B, reg, MEM_OPSTACK, 0, -4 * vsMemPops);	// mov reg, dword ptr [edi + ebx * 4 - disp]
+	vsMemPops++;
 
-			break;
-		case OP_LOCAL:
-			EmitPushStack(buf, vm);
-			EmitString(buf, "8D 86");				// lea eax, [0x12345678 + esi]
-			oc0 = oc1;
-			oc1 = Constant4(code);
-			Emit4(buf, oc1);
-			EmitCommand(buf, LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
-			break;
-		case OP_ARG:
-			EmitMovEAXStack(buf, vm, 0);				// mov eax, dword ptr [edi + ebx * 4]
-			EmitString(buf, "8B D6");				// mov edx, esi
-			EmitString(buf, "81 C2");				// add edx, 0x12345678
-			Emit4(buf, code[pc++]);
-			EmitMaskReg(buf, "E2", vm->dataMask);			// and edx, 0x12345678
+	e->type = VS_REG;
+	e->value = reg;
+}
+
+static qboolean VS_TopIs(vsType_t type)
+{
+	return vsDepth && vs[vsDepth - 1].type == type;
+}
+
+/*
+=================
+VS_ToReg
+Move a pending value into a register
+=================
+*/
+static int VS_ToReg(unsigned char * buf, vsEntry_t *e)
+{
+	int reg;
+
+	if(e->type == VS_REG)
+		return e->value;
+
+	reg = VS_AllocReg(buf);
+
+	if(e->type == VS_CONST)
+	{
+		if(reg & 8)
+			Emit1(buf, 0x41);
+		Emit1(buf, 0xB8 + (reg & 7));			// mov reg, 0x12345678
+		Emit4(buf, e->value);
+	}
+	else
+	{
+		if(reg & 8)
+			Emit1(buf, 0x44);
+		Emit1(buf, 0x8D);					// lea reg, [esi + 0x12345678]
+		Emit1(buf, 0x86 | ((reg & 7) << 3));
+		Emit4(buf, e->value);
+	}
+
+	e->type = VS_REG;
+	e->value = reg;
+	return reg;
+}
+
+static qboolean VS_LocalInRange(const vsEntry_t *e, int size)
+{
+	return e->type == VS_LOCAL && e->value >= 0 && e->value <= VM_DATA_GUARD - size;
+}
+
+/*
+=================
+VS_Address
+Turn a pending value into a memory operand for an access of the given size.
+Constant addresses are masked at compile time and program stack addresses
+need no mask at all, everything else is masked like the interpreter does.
+=================
+*/
+static void VS_Address(unsigned char * buf, vm_t *vm, vsEntry_t *e, int size, vsMem_t *mem, int *index, int *disp)
+{
+	int mask = vm->dataMask & ~(size - 1);
+
+	*index = 0;
+	*disp = 0;
+
+	if(e->type == VS_CONST)
+	{
+		*mem = MEM_DATA;
+		*disp = e->value & mask;
+	}
+	else if(VS_LocalInRange(e, size))
+	{
+		*mem = MEM_LOCAL;
+		*disp = e->value;
+	}
+	else
+	{
+		*index = VS_ToReg(buf, e);
+		EmitOpImm(buf, 4, *index, mask);			// and index, mask
+		*mem = MEM_INDEXED;
+	}
+}
+
+/*
+=================
+VS_FuseReadModifyWrite
+addr, addr, LOAD4, CONST v, ADD|SUB, STORE4 with a constant or program
+stack address becomes a single add/sub on memory
+=================
+*/
+static qboolean VS_FuseReadModifyWrite(unsigned char * buf, vm_t *vm, unsigned char *jused, unsigned char *code)
+{
+	vsEntry_t *a, *b;
+	vsMem_t mem;
+	int index, disp, v;
+
+	if(vsDepth < 2)
+		return qfalse;
+
+	a = &vs[vsDepth - 1];
+	b = &vs[vsDepth - 2];
+
+	if(a->type != b->type || a->value != b->value)
+		return qfalse;
+	if(a->type != VS_CONST && !VS_LocalInRange(a, 4))
+		return qfalse;
+
+	if(code[pc] != OP_CONST || (code[pc+5] != OP_ADD && code[pc+5] != OP_SUB) || code[pc+6] != OP_STORE4)
+		return qfalse;
+	if(jused[instruction] || jused[instruction+1] || jused[instruction+2])
+		return qfalse;
+
+	VS_Address(buf, vm, a, 4, &mem, &index, &disp);
+	vsDepth -= 2;
+
+	pc++;						// OP_CONST
+	v = Constant4(code);
+
+	if(iss8(v))
+	{
+		EmitOpMem(buf, 0, 0x83, code[pc] == OP_ADD ? 0 : 5, mem, index, disp);	// add|sub dword ptr [mem], 0x7F
+		Emit1(buf, v);
+	}
+	else
+	{
+		EmitOpMem(buf, 0, 0x81, code[pc] == OP_ADD ? 0 : 5, mem, index, disp);	// add|sub dword ptr [mem], 0x12345678
+		Emit4(buf, v);
+	}
+
+	pc += 2;					// OP_ADD|OP_SUB, OP_STORE4
+	instruction += 3;
+	return qtrue;
+}
+
+/*
+=================
+VS_CompileInstruction
+Returns qfalse with the opStack flushed when the instruction has to be
+compiled by the code in VM_Compile
+=================
+*/
+static qboolean VS_CompileInstruction(unsigned char * buf, vm_t *vm, int op, int pass, unsigned char *jused,
+	unsigned char *code, int callProcOfsSyscall, int stackViolationOfs)
+{
+	vsEntry_t a, b;
+	vsMem_t mem;
+	int index, disp, size, v, ra, rb;
+
+	switch(op)
+	{
+	case OP_ENTER:
+		VS_Flush(buf);
+		EmitString(buf, "81 EE");				// sub esi, 0x12345678
+		Emit4(buf, Constant4(code));
+		EmitString(buf, "8D 86");				// lea eax, [esi - stackBottom]
+		Emit4(buf, PROGRAM_STACK_SIZE - (vm->dataMask + 1));
+		EmitString(buf, "3D");					// cmp eax, PROGRAM_STACK_SIZE
+		Emit4(buf, PROGRAM_STACK_SIZE);
+		EmitString(buf, "0F 87");				// ja stackViolation
+		Emit4(buf, stackViolationOfs - compiledOfs - 4);
+		// with an image smaller than the stack the check above lets esi
+		// go negative, and the program stack accesses aren't masked
+		EmitString(buf, "81 FE");				// cmp esi, dataMask + 1
+		Emit4(buf, vm->dataMask + 1);
+		EmitString(buf, "0F 87");				// ja stackViolation
+		Emit4(buf, stackViolationOfs - compiledOfs - 4);
+		return qtrue;
+
+	case OP_LEAVE:
+		VS_Flush(buf);
+		EmitString(buf, "81 C6");				// add esi, 0x12345678
+		Emit4(buf, Constant4(code));
+		EmitString(buf, "81 FE");				// cmp esi, dataMask + 1
+		Emit4(buf, vm->dataMask + 1);
+		EmitString(buf, "0F 87");				// ja stackViolation
+		Emit4(buf, stackViolationOfs - compiledOfs - 4);
+		EmitString(buf, "C3");					// ret
+		return qtrue;
+
+	case OP_CONST:
+		v = Constant4(code);
+		if(code[pc] == OP_JUMP)
+			Set_JUsed(buf, v, jused, vm);
+		VS_Push(buf, VS_CONST, v);
+		return qtrue;
+
+	case OP_LOCAL:
+		VS_Push(buf, VS_LOCAL, Constant4(code));
+		return qtrue;
+
+	case OP_JUMP:
+		if(!VS_TopIs(VS_CONST))
+			break;
+		VS_Pop(buf, &a);
+		VS_Flush(buf);
+		EmitJumpIns(buf, vm, "E9", a.value, pass, jused);		// jmp 0x12345678
+		return qtrue;
+
+	case OP_CALL:
+		if(!VS_TopIs(VS_CONST))
+			break;
+		VS_Pop(buf, &a);
+		VS_Flush(buf);
+		EmitCallConst(buf, vm, a.value, callProcOfsSyscall, pass, jused);
+		return qtrue;
+
+	case OP_LOAD4:
+		if(VS_FuseReadModifyWrite(buf, vm, jused, code))
+			return qtrue;
+		// fall through
+	case OP_LOAD2:
+	case OP_LOAD1:
+		size = (op == OP_LOAD4) ? 4 : (op == OP_LOAD2) ? 2 : 1;
+		VS_Pop(buf, &a);
+		VS_Address(buf, vm, &a, size, &mem, &index, &disp);
+		ra = (mem == MEM_INDEXED) ? index : VS_AllocReg(buf);
+		EmitOpMem(buf, 0, (op == OP_LOAD4) ? 0x8B : (op == OP_LOAD2) ? 0x0FB7 : 0x0FB6, ra, mem, index, disp);
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_STORE4:
+	case OP_STORE2:
+	case OP_STORE1:
+		size = (op == OP_STORE4) ? 4 : (op == OP_STORE2) ? 2 : 1;
+		VS_Pop(buf, &b);
+		VS_Pop(buf, &a);
+		if(b.type == VS_LOCAL)
+			VS_ToReg(buf, &b);
+		VS_Address(buf, vm, &a, size, &mem, &index, &disp);
+
+		if(b.type == VS_CONST)
+		{
+			EmitOpMem(buf, (size == 2) ? 0x66 : 0, (size == 1) ? 0xC6 : 0xC7, 0, mem, index, disp);
+			if(size == 4)
+				Emit4(buf, b.value);
+			else if(size == 2)
+				Emit2(buf, b.value);
+			else
+				Emit1(buf, b.value);
+		}
+		else
+		{
+			EmitOpMem(buf, (size == 2) ? 0x66 : 0, (size == 1) ? 0x88 : 0x89, b.value, mem, index, disp);
+			VS_FreeReg(b.value);
+		}
+
+		if(mem == MEM_INDEXED)
+			VS_FreeReg(index);
+		return qtrue;
+
+	case OP_ARG:
+		v = code[pc++];
+		VS_Pop(buf, &b);
+		if(b.type == VS_CONST)
+		{
+			EmitOpMem(buf, 0, 0xC7, 0, MEM_LOCAL, 0, v);	// mov dword ptr [r9 + rsi + v], const
+			Emit4(buf, b.value);
+		}
+		else
+		{
+			ra = VS_ToReg(buf, &b);
+			EmitOpMem(buf, 0, 0x89, ra, MEM_LOCAL, 0, v);	// mov dword ptr [r9 + rsi + v], reg
+			VS_FreeReg(ra);
+		}
+		return qtrue;
+
+	case OP_NEGI:
+	case OP_BCOM:
+	case OP_NEGF:
+		VS_Pop(buf, &a);
+		if(a.type == VS_CONST)
+		{
+			if(op == OP_NEGI)
+				v = -(unsigned int) a.value;
+			else if(op == OP_BCOM)
+				v = ~a.value;
+			else
+				v = a.value ^ 0x80000000;
+			VS_Push(buf, VS_CONST, v);
+			return qtrue;
+		}
+		ra = VS_ToReg(buf, &a);
+		if(op == OP_NEGF)
+			EmitOpImm(buf, 6, ra, 0x80000000);		// xor reg, 0x80000000
+		else
+			EmitOpReg(buf, 0, 0xF7, (op == OP_NEGI) ? 3 : 2, ra);	// neg|not reg
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_SEX8:
+	case OP_SEX16:
+		VS_Pop(buf, &a);
+		if(a.type == VS_CONST)
+		{
+			VS_Push(buf, VS_CONST, (op == OP_SEX8) ? (signed char) a.value : (short) a.value);
+			return qtrue;
+		}
+		ra = VS_ToReg(buf, &a);
+		EmitOpReg(buf, 0, (op == OP_SEX8) ? 0x0FBE : 0x0FBF, ra, ra);	// movsx reg, reg8|reg16
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_ADD:
+	case OP_SUB:
+	case OP_MULI:
+	case OP_MULU:
+	case OP_BAND:
+	case OP_BOR:
+	case OP_BXOR:
+		VS_Pop(buf, &b);
+		VS_Pop(buf, &a);
+
+		if(a.type == VS_CONST && b.type == VS_CONST)
+		{
+			unsigned int x = a.value, y = b.value;
+
+			switch(op)
+			{
+			case OP_ADD:	v = x + y;	break;
+			case OP_SUB:	v = x - y;	break;
+			case OP_BAND:	v = x & y;	break;
+			case OP_BOR:	v = x | y;	break;
+			case OP_BXOR:	v = x ^ y;	break;
+			default:		v = x * y;	break;
+			}
+			VS_Push(buf, VS_CONST, v);
+			return qtrue;
+		}
+
+		// address arithmetic on locals stays a program stack offset
+		if(op == OP_ADD && a.type == VS_LOCAL && b.type == VS_CONST)
+		{
+			VS_Push(buf, VS_LOCAL, (unsigned int) a.value + b.value);
+			return qtrue;
+		}
+		if(op == OP_ADD && a.type == VS_CONST && b.type == VS_LOCAL)
+		{
+			VS_Push(buf, VS_LOCAL, (unsigned int) a.value + b.value);
+			return qtrue;
+		}
+		if(op == OP_SUB && a.type == VS_LOCAL && b.type == VS_CONST)
+		{
+			VS_Push(buf, VS_LOCAL, (unsigned int) a.value - b.value);
+			return qtrue;
+		}
+
+		if(op != OP_SUB && a.type == VS_CONST)
+		{
+			vsEntry_t t = a;
+			a = b;
+			b = t;
+		}
+
+		ra = VS_ToReg(buf, &a);
+
+		if(b.type == VS_CONST)
+		{
+			switch(op)
+			{
+			case OP_ADD:	EmitOpImm(buf, 0, ra, b.value);	break;	// add reg, const
+			case OP_SUB:	EmitOpImm(buf, 5, ra, b.value);	break;	// sub reg, const
+			case OP_BAND:	EmitOpImm(buf, 4, ra, b.value);	break;	// and reg, const
+			case OP_BOR:	EmitOpImm(buf, 1, ra, b.value);	break;	// or reg, const
+			case OP_BXOR:	EmitOpImm(buf, 6, ra, b.value);	break;	// xor reg, const
+			default:
+				if(iss8(b.value))
+				{
+					EmitOpReg(buf, 0, 0x6B, ra, ra);		// imul reg, reg, 0x7F
+					Emit1(buf, b.value);
+				}
+				else
+				{
+					EmitOpReg(buf, 0, 0x69, ra, ra);		// imul reg, reg, 0x12345678
+					Emit4(buf, b.value);
+				}
+				break;
+			}
+		}
+		else
+		{
+			rb = VS_ToReg(buf, &b);
+
+			switch(op)
+			{
+			case OP_ADD:	EmitOpReg(buf, 0, 0x01, rb, ra);	break;	// add ra, rb
+			case OP_SUB:	EmitOpReg(buf, 0, 0x29, rb, ra);	break;	// sub ra, rb
+			case OP_BAND:	EmitOpReg(buf, 0, 0x21, rb, ra);	break;	// and ra, rb
+			case OP_BOR:	EmitOpReg(buf, 0, 0x09, rb, ra);	break;	// or ra, rb
+			case OP_BXOR:	EmitOpReg(buf, 0, 0x31, rb, ra);	break;	// xor ra, rb
+			default:		EmitOpReg(buf, 0, 0x0FAF, ra, rb);	break;	// imul ra, rb
+			}
+
+			VS_FreeReg(rb);
+		}
+
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_LSH:
+	case OP_RSHI:
+	case OP_RSHU:
+		// variable shift counts need cl, leave them to the opStack code
+		if(!VS_TopIs(VS_CONST) || vs[vsDepth - 1].value < 0 || vs[vsDepth - 1].value > 31)
+			break;
+
+		VS_Pop(buf, &b);
+		VS_Pop(buf, &a);
+
+		if(a.type == VS_CONST)
+		{
+			if(op == OP_LSH)
+				v = (unsigned int) a.value << b.value;
+			else if(op == OP_RSHI)
+				v = a.value >> b.value;
+			else
+				v = (unsigned int) a.value >> b.value;
+			VS_Push(buf, VS_CONST, v);
+			return qtrue;
+		}
+
+		ra = VS_ToReg(buf, &a);
+		EmitOpReg(buf, 0, 0xC1, (op == OP_LSH) ? 4 : (op == OP_RSHI) ? 7 : 5, ra);	// shl|sar|shr reg, 0x12
+		Emit1(buf, b.value);
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_ADDF:
+	case OP_SUBF:
+	case OP_MULF:
+	case OP_DIVF:
+		VS_Pop(buf, &b);
+		VS_Pop(buf, &a);
+		ra = VS_ToReg(buf, &a);
+		rb = VS_ToReg(buf, &b);
+
+		EmitOpReg(buf, 0x66, 0x0F6E, 0, ra);		// movd xmm0, ra
+		EmitOpReg(buf, 0x66, 0x0F6E, 1, rb);		// movd xmm1, rb
+
+		switch(op)
+		{
+		case OP_ADDF:	EmitOpReg(buf, 0xF3, 0x0F58, 0, 1);	break;	// addss xmm0, xmm1
+		case OP_SUBF:	EmitOpReg(buf, 0xF3, 0x0F5C, 0, 1);	break;	// subss xmm0, xmm1
+		case OP_MULF:	EmitOpReg(buf, 0xF3, 0x0F59, 0, 1);	break;	// mulss xmm0, xmm1
+		default:		EmitOpReg(buf, 0xF3, 0x0F5E, 0, 1);	break;	// divss xmm0, xmm1
+		}
+
+		EmitOpReg(buf, 0x66, 0x0F7E, 0, ra);		// movd ra, xmm0
+		VS_FreeReg(rb);
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_CVIF:
+		VS_Pop(buf, &a);
+		ra = VS_ToReg(buf, &a);
+		EmitOpReg(buf, 0xF3, 0x0F2A, 0, ra);		// cvtsi2ss xmm0, ra
+		EmitOpReg(buf, 0x66, 0x0F7E, 0, ra);		// movd ra, xmm0
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_CVFI:
+		VS_Pop(buf, &a);
+		ra = VS_ToReg(buf, &a);
+		EmitOpReg(buf, 0x66, 0x0F6E, 0, ra);		// movd xmm0, ra
+		EmitOpReg(buf, 0xF3, 0x0F2C, ra, 0);		// cvttss2si ra, xmm0
+		VS_Push(buf, VS_REG, ra);
+		return qtrue;
+
+	case OP_EQ:
+	case OP_NE:
+	case OP_LTI:
+	case OP_LEI:
+	case OP_GTI:
+	case OP_GEI:
+	case OP_LTU:
+	case OP_LEU:
+	case OP_GTU:
+	case OP_GEU:
+		VS_Pop(buf, &b);
+		VS_Pop(buf, &a);
+		ra = VS_ToReg(buf, &a);
+		rb = (b.type == VS_CONST) ? -1 : VS_ToReg(buf, &b);
+
+		// the flush has to come first, it modifies the flags
+		VS_Flush(buf);
+
+		if(rb < 0)
+			EmitOpImm(buf, 7, ra, b.value);			// cmp ra, const
+		else
+		{
+			EmitOpReg(buf, 0, 0x39, rb, ra);		// cmp ra, rb
+			VS_FreeReg(rb);
+		}
+		VS_FreeReg(ra);
+
+		EmitBranchConditions(buf, vm, op, pass, jused, code);
+		return qtrue;
+
+	case OP_EQF:
+	case OP_NEF:
+	case OP_LTF:
+	case OP_LEF:
+	case OP_GTF:
+	case OP_GEF:
+		VS_Pop(buf, &b);
+		VS_Pop(buf, &a);
+		ra = VS_ToReg(buf, &a);
+		rb = VS_ToReg(buf, &b);
+		EmitOpReg(buf, 0x66, 0x0F6E, 0, ra);		// movd xmm0, ra
+		EmitOpReg(buf, 0x66, 0x0F6E, 1, rb);		// movd xmm1, rb
+		VS_FreeReg(ra);
+		VS_FreeReg(rb);
+
+		VS_Flush(buf);
+
+		// branch like the interpreter does, nothing but != holds for NaN
+		switch(op)
+		{
+		case OP_EQF:
+			EmitOpReg(buf, 0, 0x0F2E, 0, 1);			// ucomiss xmm0, xmm1
+			EmitString(buf, "7A 06");				// jp +6
+			EmitJumpIns(buf, vm, "0F 84", Constant4(code), pass, jused);	// je 0x12345678
+			break;
+		case OP_NEF:
+			v = Constant4(code);
+			EmitOpReg(buf, 0, 0x0F2E, 0, 1);			// ucomiss xmm0, xmm1
+			EmitJumpIns(buf, vm, "0F 8A", v, pass, jused);	// jp 0x12345678
+			EmitJumpIns(buf, vm, "0F 85", v, pass, jused);	// jne 0x12345678
+			break;
+		case OP_LTF:
+			EmitOpReg(buf, 0, 0x0F2E, 1, 0);			// ucomiss xmm1, xmm0
+			EmitJumpIns(buf, vm, "0F 87", Constant4(code), pass, jused);	// ja 0x12345678
+			break;
+		case OP_LEF:
+			EmitOpReg(buf, 0, 0x0F2E, 1, 0);			// ucomiss xmm1, xmm0
+			EmitJumpIns(buf, vm, "0F 83", Constant4(code), pass, jused);	// jae 0x12345678
+			break;
+		case OP_GTF:
+			EmitOpReg(buf, 0, 0x0F2E, 0, 1);			// ucomiss xmm0, xmm1
+			EmitJumpIns(buf, vm, "0F 87", Constant4(code), pass, jused);	// ja 0x12345678
+			break;
+		default:
+			EmitOpReg(buf, 0, 0x0F2E, 0, 1);			// ucomiss xmm0, xmm1
+			EmitJumpIns(buf, vm, "0F 83", Constant4(code), pass, jused);	// jae 0x12345678
+			break;
+		}
+		return qtrue;
+
+	default:
+		break;
+	}
+
+	VS_Flush(buf);
+	return qfalse;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////
+// debug
+
+void FileSys_PrintfHexToFile(const char * name, unsigned char * pBuf, unsigned int len)
+{
+	char local_name[128] = { 0 };
+#ifndef NDEBUG
+	snprintf(local_name, 127, "compiled_%s_debug.txt", name);
+#else
+	snprintf(local_name, 127, "compiled_%s_release.txt", name);
+#endif
+
+	unsigned char * pOpcode = (unsigned char *) malloc ( len * 3 + len / 20 + 10);
+	unsigned int j = 0;
+	for (unsigned int i = 0; i < len; ++i)
+	{
+		Hes2char(pBuf[i], pOpcode+j);
+		j += 2;
+		pOpcode[j++] = ' ';
+		if ( (i != 0 ) && (i % 20) == 0)
+			pOpcode[j++] = '\n';
+	}
+
+	pOpcode[j] = '\0';
+
+	FILE* log_fp = fopen(local_name, "wt");
+
+	if (log_fp)
+	{
+		fprintf(log_fp, "%s", pOpcode);
+	}
+	else
+	{
+		fprintf(stderr, "Error open %s\n", name);
+	}
+
+	fclose(log_fp);
+
+	free(pOpcode);
+}
+
+
+///////////////////////////////////////////////////////////////////////
+// executable memory
+
+static unsigned char *VM_AllocCode(int length)
+{
+	unsigned char *code;
+
+#ifdef VM_X86_MMAP
+	code = mmap(NULL, length, PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+	if(code == MAP_FAILED)
+		Com_Error(ERR_FATAL, "VM_CompileX86: can't mmap memory");
+#elif _WIN32
+	// allocate memory with EXECUTE permissions under windows.
+	// Reserves, commits, or changes the state of a region of pages
+	// in the virtual address space of the calling process.
+	// Memory allocated by this function is automatically initialized to zero.
+
+	code = VirtualAlloc(NULL, length, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+	if(!code)
+		Com_Error(ERR_FATAL, "VM_CompileX86: VirtualAlloc failed");
+#else
+	code = malloc(length);
+	if(!code)
+	        Com_Error(ERR_FATAL, "VM_CompileX86: malloc failed");
+#endif
+
+	return code;
+}
+
+static void VM_ProtectCode(unsigned char *code, int length)
+{
+#ifdef VM_X86_MMAP
+	if(mprotect(code, length, PROT_READ|PROT_EXEC))
+		Com_Error(ERR_FATAL, "VM_CompileX86: mprotect failed");
+#elif _WIN32
+	{
+		DWORD oldProtect = 0;
+		
+		// remove write permissions.
+		if(!VirtualProtect(code, length, PAGE_EXECUTE_READ, &oldProtect))
+			Com_Error(ERR_FATAL, "VM_CompileX86: VirtualProtect failed");
+	}
+#endif
+}
+
+
+///////////////////////////////////////////////////////////////////////
+// compiled code cache
+
+/*
+The game QVM gets compiled again on every map change.  The generated
+code only depends on the QVM image, vm_jitOptimize and the engine
+build, so with vm_cache set it is kept in <gamedir>/vmcache/<name>.<arch>
+and mapped back in when all of those match.  The few pointers into the
+engine are stored as relocations and patched after loading.
+
+Only x86_64 code is cached, the 32 bit compiler embeds the address of
+the data segment.
+*/
+
+#define VMCACHE_IDENT		(('C'<<24)+('M'<<16)+('V'<<8)+'Q')
+#define VMCACHE_VERSION		4
+#define VMCACHE_ALIGN		4096
+#define VMCACHE_BUILD		Q3_VERSION " " PLATFORM_STRING " " __DATE__ " " __TIME__
+
+typedef struct
+{
+	int		ident;
+	int		version;
+	char	build[64];
+	int		checksum;			// of the whole qvm image
+	int		optimize;
+	int		dataMask;
+	int		instructionCount;
+	int		entryOfs;
+	int		numRelocs;
+	int		codeOfs;			// page aligned so the code can run from the mapping
+	int		codeLength;
+	int		contentChecksum;	// of everything after the header
+} vmCacheHeader_t;
+
+// followed by an int offset for each instruction and the relocations
+
+
+static qboolean VM_CacheEnabled(vm_t *vm)
+{
+#if idx64
+	// only images that came from the search path, not the vmbench one
+	return vm_cache && vm_cache->integer && vm->searchPath && Cvar_VariableString("fs_homepath")[0];
+#else
+	return qfalse;
+#endif
+}
+
+static int VM_CacheChecksum(vmHeader_t *header)
+{
+	int length = header->codeOffset + header->codeLength;
+	int end = header->dataOffset + header->dataLength + header->litLength;
+
+	if(header->vmMagic == VM_MAGIC_VER2)
+		end += header->jtrgLength;
+	if(end > length)
+		length = end;
+
+	return Com_BlockChecksum(header, length);
+}
+
+static void VM_CachePath(char *path, int size, const char *name)
+{
+	Q_strncpyz(path, FS_BuildOSPath(Cvar_VariableString("fs_homepath"), FS_GetCurrentGameDir(), name), size);
+}
+
+static void VM_PatchRelocs(unsigned char *code, const vmReloc_t *reloc, int count)
+{
+	for(int i = 0; i < count; i++)
+	{
+		void *ptr = RelocTarget(reloc[i].type);
+
+		memcpy(code + reloc[i].ofs, &ptr, sizeof(ptr));
+	}
+}
+
+/*
+=================
+VM_LoadCache
+
+Sets up vm->codeBase and the instruction offsets from the cache,
+qfalse if there's no usable entry
+=================
+*/
+static qboolean VM_LoadCache(vm_t *vm, int checksum, qboolean optimize)
+{
+	char path[MAX_OSPATH];
+	char build[sizeof(((vmCacheHeader_t *) 0)->build)];
+	vmCacheHeader_t *cache;
+	const int *ofs;
+	const vmReloc_t *reloc;
+	unsigned char *data;
+	int length, i;
+	qboolean valid;
+
+	VM_CachePath(path, sizeof(path), va("vmcache/%s.%s", vm->name, ARCH_STRING));
+	data = Sys_MapFile(path, &length);
+	if(!data)
+		return qfalse;
+
+	memset(build, 0, sizeof(build));
+	Q_strncpyz(build, VMCACHE_BUILD, sizeof(build));
+
+	cache = (vmCacheHeader_t *) data;
+	if(length < (int) sizeof(*cache) || cache->ident != VMCACHE_IDENT || cache->version != VMCACHE_VERSION
+		|| memcmp(cache->build, build, sizeof(build)) || cache->checksum != checksum
+		|| cache->optimize != optimize || cache->dataMask != vm->dataMask
+		|| cache->instructionCount != vm->instructionCount
+		|| cache->numRelocs < 0 || cache->numRelocs > vm->instructionCount + VM_RELOC_MAX
+		|| cache->codeOfs % VMCACHE_ALIGN
+		|| cache->codeOfs < (int) (sizeof(*cache) + vm->instructionCount * sizeof(int) + cache->numRelocs * sizeof(vmReloc_t))
+		|| cache->codeLength <= 0 || cache->codeLength != length - cache->codeOfs
+		|| cache->entryOfs < 0 || cache->entryOfs >= cache->codeLength)
+	{
+		Com_DPrintf("%s is out of date\n", path);
+		Sys_UnmapFile(data, length);
+		return qfalse;
+	}
+
+	// the code itself is trusted, FS_CheckFilenameIsMutable keeps the
+	// VMs out of vmcache, but a damaged file must not send anything
+	// outside of it, and must not mix a header with another build's code
+	ofs = (const int *) (cache + 1);
+	reloc = (const vmReloc_t *) (ofs + vm->instructionCount);
+
+	valid = (int) Com_BlockChecksum(ofs, length - sizeof(*cache)) == cache->contentChecksum;
+	for(i = 0; i < vm->instructionCount && valid; i++)
+	{
+		if(ofs[i] < 0 || ofs[i] >= cache->codeLength)
+			valid = qfalse;
+		vm->instructionPointers[i] = ofs[i];
+	}
+
+	for(i = 0; i < cache->numRelocs && valid; i++)
+	{
+		if(reloc[i].ofs < 0 || reloc[i].ofs > cache->codeLength - (int) sizeof(void *)
+			|| reloc[i].type < 0 || reloc[i].type >= VM_RELOC_MAX)
+			valid = qfalse;
+	}
+
+	if(!valid)
+	{
+		Com_Printf(S_COLOR_YELLOW "Warning: %s is damaged\n", path);
+		Sys_UnmapFile(data, length);
+		return qfalse;
+	}
+
+	vm->codeLength = cache->codeLength;
+	vm->entryOfs = cache->entryOfs;
+
+#ifdef VM_X86_MMAP
+	// run the code straight from the private mapping, patching only
+	// copies the pages the relocations land in
+	VM_PatchRelocs(data + cache->codeOfs, reloc, cache->numRelocs);
+	if(!mprotect(data + cache->codeOfs, cache->codeLength, PROT_READ|PROT_EXEC))
+	{
+		// VM_Destroy_Compiled unmaps the code, drop the header now
+		vm->codeBase = data + cache->codeOfs;
+		munmap(data, cache->codeOfs);
+		return qtrue;
+	}
+
+	// fs_homepath on a noexec mount, run a copy instead
+#endif
+	vm->codeBase = VM_AllocCode(cache->codeLength);
+	memcpy(vm->codeBase, data + cache->codeOfs, cache->codeLength);
+	VM_PatchRelocs(vm->codeBase, reloc, cache->numRelocs);
+	VM_ProtectCode(vm->codeBase, cache->codeLength);
+
+	Sys_UnmapFile(data, length);
+	return qtrue;
+}
+
+/*
+=================
+VM_WriteCache
+
+Stores freshly compiled code, vm->instructionPointers still holds offsets.
+The file is put together under a name of its own for this process and
+renamed into place, so servers sharing a homepath never interleave
+=================
+*/
+static void VM_WriteCache(vm_t *vm, int checksum, qboolean optimize, const unsigned char *code)
+{
+	char path[MAX_OSPATH], tmpPath[MAX_OSPATH];
+	vmCacheHeader_t *cache;
+	unsigned char *data;
+	int *ofs;
+	FILE *f;
+	int i, length;
+	qboolean written;
+
+	if(numRelocs > maxRelocs)
+		return;
+
+	// a home directory that can't be written to just means no caching
+	VM_CachePath(path, sizeof(path), "vmcache");
+	if(!Sys_Mkdir(path))
+		return;
+
+	VM_CachePath(path, sizeof(path), va("vmcache/%s.%s", vm->name, ARCH_STRING));
+	VM_CachePath(tmpPath, sizeof(tmpPath), va("vmcache/%s.%s.%i.tmp", vm->name, ARCH_STRING, Sys_PID()));
+
+	f = Sys_FOpen(tmpPath, "wb");
+	if(!f)
+	{
+		Com_DPrintf("Couldn't write %s\n", tmpPath);
+		return;
+	}
+
+	length = sizeof(*cache) + vm->instructionCount * sizeof(int) + numRelocs * sizeof(vmReloc_t);
+	length = (length + VMCACHE_ALIGN - 1) & ~(VMCACHE_ALIGN - 1);
+
+	data = Z_Malloc(length + vm->codeLength);
+	cache = (vmCacheHeader_t *) data;
+	ofs = (int *) (cache + 1);
+
+	cache->ident = VMCACHE_IDENT;
+	cache->version = VMCACHE_VERSION;
+	Q_strncpyz(cache->build, VMCACHE_BUILD, sizeof(cache->build));
+	cache->checksum = checksum;
+	cache->optimize = optimize;
+	cache->dataMask = vm->dataMask;
+	cache->instructionCount = vm->instructionCount;
+	cache->entryOfs = vm->entryOfs;
+	cache->numRelocs = numRelocs;
+	cache->codeOfs = length;
+	cache->codeLength = vm->codeLength;
+
+	for(i = 0; i < vm->instructionCount; i++)
+		ofs[i] = vm->instructionPointers[i];
+	memcpy(ofs + vm->instructionCount, relocs, numRelocs * sizeof(vmReloc_t));
+	memcpy(data + cache->codeOfs, code, vm->codeLength);
+
+	length += vm->codeLength;
+	cache->contentChecksum = Com_BlockChecksum(ofs, length - sizeof(*cache));
+
+	written = fwrite(data, length, 1, f) == 1;
+	if(fclose(f))
+		written = qfalse;
+
+	Z_Free(data);
+
+	if(written)
+	{
+		remove(path);
+		rename(tmpPath, path);
+	}
+	else
+	{
+		remove(tmpPath);
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////
+
+void VM_Compile(vm_t * const vm, vmHeader_t *header)
+{
+	int	op, v;
+    int	callProcOfsSyscall, callProcOfs, callDoSyscallOfs;
+	qboolean optimize = qfalse;
+	qboolean cache = VM_CacheEnabled(vm);
+	int checksum = 0, prologueRelocs;
+
+#if idx64
+	int stackViolationOfs;
+
+	optimize = vm_jitOptimize && vm_jitOptimize->integer && vm->jumpTableTargets;
+#endif
+
+	if(cache)
+	{
+		checksum = VM_CacheChecksum(header);
+
+		if(VM_LoadCache(vm, checksum, optimize))
+		{
+			Com_Printf( "VM file %s loaded %i bytes of code from the cache%s\n", 
+				vm->name, vm->codeLength, optimize ? " (optimised)" : "" );
+
+			vm->destroy = VM_Destroy_Compiled;
+
+			for (int i = 0 ; i < header->instructionCount ; ++i ) {
+				vm->instructionPointers[i] += (intptr_t) vm->codeBase;
+			}
+			return;
+		}
+	}
+
+	// a compile that errored out leaves its relocations behind
+	if(relocs)
+		Z_Free(relocs);
+	relocs = NULL;
+	numRelocs = 0;
+
+	if(cache)
+	{
+		maxRelocs = header->instructionCount + VM_RELOC_MAX;
+		relocs = Z_Malloc(maxRelocs * sizeof(*relocs));
+	}
+
+	// allocate a very large temp buffer, we will shrink it later,
+	// a flush of the pending values can add up to ~100 bytes at once
+	int margin = optimize ? 256 : 16;
+	int maxLength = header->codeLength * (optimize ? 12 : 8) + 48 + margin;
+	unsigned char* buf = Z_Malloc(maxLength);
+    memset(buf, 0, maxLength);
+
+	int jusedSize = header->instructionCount + 2;
+	unsigned char* jused = Z_Malloc(jusedSize);
+	memset(jused, 0, jusedSize);
+
+	unsigned char* code = Z_Malloc(header->codeLength+32);
+	memset(code, 0, header->codeLength+32);
+	
+	Com_Printf(" Starting VM_Compile ... \n");
+
+	// copy code in larger buffer and put some zeros at the end
+	// so we can safely look ahead for a few instructions in it
+	// without a chance to get false-positive because of some garbage bytes
+	memcpy(code, (byte *)header + header->codeOffset, header->codeLength );
+
+	// ensure that the optimisation pass knows about all the jump
+	// table targets
+	pc = -1; // a bogus value to be printed in out-of-bounds error messages
+	for(int i = 0; i < vm->numJumpTableTargets; ++i )
+	{
+		Set_JUsed(buf, *(int *)(vm->jumpTableTargets + ( i * sizeof( int ) ) ), jused, vm);
+	}
+
+	// Start buffer with x86-VM specific procedures
+	compiledOfs = 0;
+
+	callDoSyscallOfs = compiledOfs;
+	callProcOfs = EmitCallDoSyscall(buf, vm);
+	callProcOfsSyscall = EmitCallProcedure(buf, vm, callDoSyscallOfs);
+#if idx64
+	stackViolationOfs = EmitStackViolation(buf, vm, callDoSyscallOfs);
+#endif
+	vm->entryOfs = compiledOfs;
+	prologueRelocs = numRelocs;
+
+	for(unsigned int pass=0; pass < 3; ++pass)
+	{
+	oc0 = -23423;
+	oc1 = -234354;
+	pop0 = -43435;
+	pop1 = -545455;
+
+	// translate all instructions
+	pc = 0;
+	instruction = 0;
+	//code = (byte *)header + header->codeOffset;
+	compiledOfs = vm->entryOfs;
+	numRelocs = prologueRelocs;
+
+	LastCommand = LAST_COMMAND_NONE;
+#if idx64
+	VS_Reset();
+#endif
+
+	while(instruction < header->instructionCount)
+	{
+		if(compiledOfs > maxLength - margin)
+		{
+			Z_Free(buf);
+			Z_Free(jused);
+			Com_Error(ERR_DROP, "VM_CompileX86: maxLength exceeded");
+		}
+
+#if idx64
+		if(optimize && jused[instruction])
+		{
+			VS_Flush(buf);
+			LastCommand = LAST_COMMAND_NONE;
+		}
+#endif
+		vm->instructionPointers[ instruction ] = compiledOfs;
+
+		if ( !vm->jumpTableTargets )
+			jlabel = 1;
+		else 
+			jlabel = jused[ instruction ];
+
+		instruction++;
+
+		if(pc > header->codeLength)
+		{
+			Z_Free(buf);
+			Z_Free(jused);
+			Com_Error(ERR_DROP, "VM_CompileX86: pc > header->codeLength");
+		}
+
+		op = code[ pc++ ];
+
+#if idx64
+		if(optimize)
+		{
+			qboolean handled = VS_CompileInstruction(buf, vm, op, pass, jused, code, callProcOfsSyscall, stackViolationOfs);
+
+			// keep the peephole code below from making assumptions
+			// about what the last instruction left in eax
+			LastCommand = LAST_COMMAND_NONE;
+			pop1 = OP_UNDEF;
+
+			if(handled)
+				continue;
+		}
+#endif
+	
+		switch ( op )
+        {
+		case 0:
+			break;
+		case OP_BREAK:
+			EmitString(buf, "CC");				// int 3
+			break;
+		case OP_ENTER:
+			EmitString(buf, "81 EE");				// sub esi, 0x12345678
+			Emit4(buf, Constant4(code));
+			break;
+		case OP_CONST:
+			if( ConstOptimize(buf, vm, callProcOfsSyscall, pass, jused, code) )
+				break;
+
+			EmitPushStack(buf, vm);
+			EmitString(buf, "C7 04 9F");				// mov dword ptr [edi + ebx * 4], 0x12345678
+			lastConst = Constant4(code);
+
+			Emit4(buf, lastConst);
+			if(code[pc] == OP_JUMP)
+				Set_JUsed(buf, lastConst, jused, vm);
+
+			break;
+		case OP_LOCAL:
+			EmitPushStack(buf, vm);
+			EmitString(buf, "8D 86");				// lea eax, [0x12345678 + esi]
+			oc0 = oc1;
+			oc1 = Constant4(code);
+			Emit4(buf, oc1);
+			EmitCommand(buf, LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
+			break;
+		case OP_ARG:
+			EmitMovEAXStack(buf, vm, 0);				// mov eax, dword ptr [edi + ebx * 4]
+			EmitString(buf, "8B D6");				// mov edx, esi
+			EmitString(buf, "81 C2");				// add edx, 0x12345678
+			Emit4(buf, code[pc++]);
+			EmitMaskReg(buf, "E2", vm->dataMask);			// and edx, 0x12345678
 #if idx64
 			EmitRexString(buf, 0x41, "89 04 11");		// mov dword ptr [r9 + edx], eax
 #else
@@ -1726,7 +3040,7 @@ void VM_Compile(vm_t * const vm, vmHeader_t *header)
 // call the library conversion function
 
 			EmitRexString(buf, 0x48, "BA");			// mov edx, Q_VMftol
-			EmitPtr(buf, Q_VMftol);
+			EmitRelocPtr(buf, VM_RELOC_FTOL);
 			EmitRexString(buf, 0x48, "FF D2");			// call edx
 			EmitCommand(buf, LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
 #endif
@@ -1774,52 +3088,35 @@ void VM_Compile(vm_t * const vm, vmHeader_t *header)
 		pop0 = pop1;
 		pop1 = op;
 	}
+#if idx64
+	if(optimize)
+		VS_Flush(buf);
+#endif
 	}
 
 	// copy to an exact sized buffer with the appropriate permission bits
 	vm->codeLength = compiledOfs;
-#ifdef VM_X86_MMAP
-	vm->codeBase = mmap(NULL, compiledOfs, PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
-	if(vm->codeBase == MAP_FAILED)
-		Com_Error(ERR_FATAL, "VM_CompileX86: can't mmap memory");
-#elif _WIN32
-	// allocate memory with EXECUTE permissions under windows.
-	// Reserves, commits, or changes the state of a region of pages
-	// in the virtual address space of the calling process.
-	// Memory allocated by this function is automatically initialized to zero.
-
-	vm->codeBase = VirtualAlloc(NULL, compiledOfs, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
-	if(!vm->codeBase)
-		Com_Error(ERR_FATAL, "VM_CompileX86: VirtualAlloc failed");
-#else
-	vm->codeBase = malloc(compiledOfs);
-	if(!vm->codeBase)
-	        Com_Error(ERR_FATAL, "VM_CompileX86: malloc failed");
-#endif
+	vm->codeBase = VM_AllocCode(compiledOfs);
 
 	memcpy( vm->codeBase, buf, compiledOfs );
 	
 	// if debug
 	FileSys_PrintfHexToFile(vm->name, buf, compiledOfs);
 
-#ifdef VM_X86_MMAP
-	if(mprotect(vm->codeBase, compiledOfs, PROT_READ|PROT_EXEC))
-		Com_Error(ERR_FATAL, "VM_CompileX86: mprotect failed");
-#elif _WIN32
+	VM_ProtectCode(vm->codeBase, compiledOfs);
+
+	if(relocs)
 	{
-		DWORD oldProtect = 0;
-		
-		// remove write permissions.
-		if(!VirtualProtect(vm->codeBase, compiledOfs, PAGE_EXECUTE_READ, &oldProtect))
-			Com_Error(ERR_FATAL, "VM_CompileX86: VirtualProtect failed");
+		VM_WriteCache(vm, checksum, optimize, buf);
+		Z_Free(relocs);
+		relocs = NULL;
 	}
-#endif
 
 	Z_Free( code );
 	Z_Free( buf );
 	Z_Free( jused );
-	Com_Printf( "VM file %s compiled to %i bytes of code\n", 
-		vm->name, compiledOfs );
+	Com_Printf( "VM file %s compiled to %i bytes of code%s\n", 
+		vm->name, compiledOfs, optimize ? " (optimised)" : "" );
 
 	vm->destroy = VM_Destroy_Compiled;
 
@@ -1833,6 +3130,10 @@ void VM_Compile(vm_t * const vm, vmHeader_t *header)
 
 void VM_Destroy_Compiled(vm_t* self)
 {
+	// a Com_Error out of generated code leaves the call behind
+	if(activeCall.vm == self)
+		activeCall.vm = NULL;
+
 #ifdef VM_X86_MMAP
 	munmap(self->codeBase, self->codeLength);
 #elif _WIN32
@@ -1851,7 +3152,9 @@ This function is called directly by the generated code
 */
 intptr_t VM_CallCompiled(vm_t * const vm, int *args)
 {
-	unsigned char stack[OPSTACK_SIZE + 15];
+	// the optimising compiler addresses a few slots beyond the
+	// current opStack offset, keep that inside the buffer
+	unsigned char stack[OPSTACK_GUARD + OPSTACK_SIZE + OPSTACK_GUARD + 15];
 
 	const unsigned int szStack = 8 + 4 * MAX_VMMAIN_ARGS;
 	currentVM = vm;
@@ -1872,10 +3175,25 @@ intptr_t VM_CallCompiled(vm_t * const vm, int *args)
 
 	// off we go into generated code...
 	void* entryPoint = vm->codeBase + vm->entryOfs;
-	int* opStack = PADP(stack, 16);
+	int* opStack = PADP(stack + OPSTACK_GUARD, 16);
 	*opStack = 0xDEADBEEF;
 	int opStackOfs = 0;
 
+	// stackTop is set first, an outer call is still on the stack.
+	// One below this frame was left behind by a Com_Error.
+	vm_t *savedCallVM = activeCall.vm;
+	void *savedStackTop = activeCall.stackTop;
+	void *savedSyscallFrame = activeCall.syscallFrame;
+	if((unsigned char *) savedStackTop < stack)
+	{
+		savedCallVM = NULL;
+		savedStackTop = NULL;
+		savedSyscallFrame = NULL;
+	}
+	activeCall.stackTop = stack;
+	activeCall.syscallFrame = NULL;
+	activeCall.vm = vm;
+
 
 #ifdef _MSC_VER
   #if idx64
@@ -1926,6 +3244,10 @@ intptr_t VM_CallCompiled(vm_t * const vm, int *args)
 	);
 #endif
 
+	activeCall.vm = savedCallVM;
+	activeCall.syscallFrame = savedSyscallFrame;
+	activeCall.stackTop = savedStackTop;
+
 	if(opStackOfs != 1 || *opStack != 0xDEADBEEF)
 	{
 		Com_Error(ERR_DROP, "opStack corrupted in compiled code");
@@ -1941,3 +3263,93 @@ intptr_t VM_CallCompiled(vm_t * const vm, int *args)
 
 	return opStack[opStackOfs];
 }
+
+/*
+=================
+VM_IsReturnAddress
+
+True if addr follows one of the call instructions emitted above
+=================
+*/
+static qboolean VM_IsReturnAddress(vm_t *vm, intptr_t addr)
+{
+	const unsigned char *p = (const unsigned char *) addr;
+
+	if(p < vm->codeBase + 7 || p > vm->codeBase + vm->codeLength)
+		return qfalse;
+
+	if(p[-5] == 0xE8)								// call rel32
+		return qtrue;
+	if(p[-2] == 0xFF && p[-1] == 0xD2)				// call edx
+		return qtrue;
+#if idx64
+	if(p[-4] == 0x49 && p[-3] == 0xFF && p[-2] == 0x14 && p[-1] == 0xC0)	// call [r8 + rax * 8]
+		return qtrue;
+#else
+	if(p[-7] == 0xFF && p[-6] == 0x14 && p[-5] == 0x85)	// call [instructionPointers + eax * 4]
+		return qtrue;
+#endif
+
+	return qfalse;
+}
+
+/*
+=================
+VM_SampleStack
+
+Called by the sampling profiler with the interrupted pc and stack pointer
+of the main thread, from a signal handler or with the thread suspended.
+Generated code keeps nothing but return addresses on the native stack, so
+the callers are the words under the innermost VM_CallCompiled that point
+just behind a call.  While the engine runs a syscall the walk starts at
+the frame the DoSyscall stub recorded, stale words in the engine's frames
+would look like calls as well.
+
+Stores code offsets leaf first, VM_SAMPLE_ENGINE if the pc was outside the
+generated functions, and returns NULL when no compiled vm is running.
+=================
+*/
+vm_t *VM_SampleStack(void *pc, void *sp, int *frames, int maxFrames, int *numFrames)
+{
+	vm_t *vm = activeCall.vm;
+	intptr_t *top = (intptr_t *) activeCall.stackTop;
+	intptr_t *frame = (intptr_t *) activeCall.syscallFrame;
+	intptr_t *p = (intptr_t *) sp;
+	unsigned char *code, *ip = (unsigned char *) pc;
+	int count = 0;
+
+	*numFrames = 0;
+
+	// a call left behind by a Com_Error is above the stack pointer
+	if(!vm || p >= top || maxFrames < 1)
+		return NULL;
+
+	code = vm->codeBase;
+	if(ip >= code + vm->entryOfs && ip < code + vm->codeLength)
+		frames[count++] = ip - code;
+	else
+	{
+		frames[count++] = VM_SAMPLE_ENGINE;
+
+		if((ip < code || ip >= code + vm->codeLength) && frame > p && frame < top)
+			p = frame;
+	}
+
+	for( ; p < top && count < maxFrames; p++)
+	{
+		int ofs;
+
+		if(!VM_IsReturnAddress(vm, *p))
+			continue;
+
+		// returns into the call stubs don't belong to a function
+		ofs = (unsigned char *) *p - code;
+		if(ofs <= vm->entryOfs)
+			continue;
+
+		frames[count++] = ofs - 1;
+	}
+
+	*numFrames = count;
+	return vm;
+}
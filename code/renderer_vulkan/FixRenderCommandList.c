@@ -46,7 +46,9 @@ sortedIndex.
 static void FixRenderCommandList( int nShader )
 {
     
-    const void * pCmdTable = R_GetCommandBuffer(0);
+    // the list the front end is still filling, the render thread has
+    // been synced by the registration that created the shader
+    const void * pCmdTable = R_GetPendingCommands();
 
     while ( 1 )
     {
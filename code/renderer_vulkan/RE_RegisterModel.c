@@ -1,6 +1,7 @@
 #include "tr_globals.h"
 #include "ref_import.h"
 #include "tr_model.h"
+#include "tr_cmds.h"
 
 typedef struct
 {
@@ -32,6 +33,8 @@ asked for again.
 */
 qhandle_t RE_RegisterModel( const char *name )
 {
+	R_SyncRenderThread();
+
 //    ri.Printf( PRINT_ALL, "RegisterModel: %s. \n", name);
 
     qboolean	orgNameFailed = qfalse;
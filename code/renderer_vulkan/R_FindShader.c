@@ -7,6 +7,7 @@
 #include "R_ShaderText.h"
 #include "tr_shader.h"
 #include "tr_common.h"
+#include "tr_cmds.h"
 
 extern struct shader_s * R_GetDefaultShaderPtr(void);
 extern uint32_t R_GetNumOfLightmaps(void);
@@ -225,6 +226,8 @@ way to ask for different implicit lighting modes (vertex, lightmap, etc)
 */
 qhandle_t RE_RegisterShader( const char * pName )
 {
+	R_SyncRenderThread();
+
 	if ( strlen( pName ) >= MAX_QPATH ) {
 		ri.Printf(PRINT_ALL, "Shader name exceeds MAX_QPATH\n" );
 		return 0;
@@ -253,6 +256,8 @@ For menu graphics that should never be picmiped
 */
 qhandle_t RE_RegisterShaderNoMip( const char * pName )
 {
+	R_SyncRenderThread();
+
 
 	if ( strlen( pName ) >= MAX_QPATH ) {
 		ri.Printf(PRINT_ALL, "Shader name exceeds MAX_QPATH\n" );
@@ -487,6 +492,8 @@ way to ask for different implicit lighting modes (vertex, lightmap, etc)
 
 void RE_RemapShader(const char *shaderName, const char *newShaderName, const char *timeOffset)
 {
+	R_SyncRenderThread();
+
 
     struct shader_s* sh2 = R_GetDefaultShaderPtr();
 
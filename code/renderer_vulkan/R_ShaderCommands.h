@@ -20,6 +20,21 @@ struct stageVars
         float texcoords[NUM_TEXTURE_BUNDLES][SHADER_MAX_VERTEXES][2];
 } ;
 
+
+// A range of world surfaces whose positions and indexes were uploaded
+// to the static world buffers at map load, consecutive surfaces that
+// are also consecutive in those buffers are merged into one run.
+#define MAX_STATIC_RUNS 512
+
+struct staticRun_s
+{
+        uint32_t firstVert;     // in the static vertex buffer
+        uint32_t firstIndex;    // in the static index buffer
+        uint32_t numVerts;
+        uint32_t numIndexes;
+        uint32_t tessVert;      // where the run starts in tess.xyz
+};
+
 typedef struct shaderCommands_s 
 {
         unsigned int indexes[SHADER_MAX_INDEXES];
@@ -42,6 +57,14 @@ typedef struct shaderCommands_s
         int numIndexes;
         int numVertexes;
 
+        // the part of the batch that is already resident on the GPU,
+        // the batch is drawn from the static buffers only if it covers
+        // all of numVertexes and numIndexes
+        uint32_t numStaticRuns;
+        uint32_t numStaticVerts;
+        uint32_t numStaticIndexes;
+        struct staticRun_s staticRuns[MAX_STATIC_RUNS];
+
         // info extracted from current shader
         int numPasses;
         struct shaderStage_s **xstages;
@@ -10,12 +10,16 @@ typedef struct {
 	cplane_t	plane;
 
 	// dynamic lighting information
-	int			dlightBits;
+	int			dlightBits[SMP_FRAMES];
 
 	// triangle definitions (no normals at points)
 	int			numPoints;
 	int			numIndices;
 	int			ofsIndices;
+
+	// position in the static world buffers, -1 if not uploaded
+	int			staticVert;
+	int			staticIndex;
 	float		points[1][VERTEXSIZE];	// variable sized
 										// there is a variable length list of indices here also
 } srfSurfaceFace_t;
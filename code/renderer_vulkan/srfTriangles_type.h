@@ -8,7 +8,7 @@ typedef struct {
 	surfaceType_t surfaceType;
 
 	// dynamic lighting information
-	int	dlightBits;
+	int	dlightBits[SMP_FRAMES];
 
 	// culling information (FIXME: use this!)
 	float bounds[2][3];
@@ -23,6 +23,9 @@ typedef struct {
     int	numIndexes;
 	int	numVerts;
 
+	// position in the static world buffers, -1 if not uploaded
+	int	staticVert;
+	int	staticIndex;
 } srfTriangles_t;
 
 
@@ -19,6 +19,10 @@ typedef enum {
 	SF_MAX = 0x7fffffff			// ensures that sizeof( surfaceType_t ) == sizeof( int )
 } surfaceType_t;
 
+// with r_smp the front end fills one set of command lists, scene data
+// and surface dlight bits while the render thread draws the other
+#define	SMP_FRAMES	2
+
 typedef struct drawSurf_s {
 	unsigned int	sort;			// bit combination for fast compares
 	surfaceType_t * surType;		// any of surface*_t
@@ -13,8 +13,14 @@ typedef struct {
     int c_totalIndexes;
     int c_dlightVertexes;
     int c_dlightIndexes;
+    // bytes copied into the host visible vertex and index stream
+    int c_uploadBytes;
+    // bytes that did not need copying, drawn from the static world buffers
+    int c_staticBytes;
+    int c_staticDraws;
     // total msec for backend run
     int msec;
+    int usec;
 } backEndCounters_t;
 
 
@@ -30,6 +36,7 @@ typedef struct {
 
     unsigned char Color2D[4];
     qboolean projection2D;	// if qtrue, drawstretchpic doesn't need to change modes
+    int smpFrame;			// which of the SMP_FRAMES the commands being run came from
 } backEndState_t;
 
 extern backEndState_t backEnd;
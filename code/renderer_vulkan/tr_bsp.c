@@ -35,6 +35,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "srfTriangles_type.h"
 #include "srfSurfaceFace_type.h"
 #include "tr_common.h"
+#include "vk_shade_geometry.h"
+#include "tr_cmds.h"
 
 /*
 
@@ -405,6 +407,8 @@ static void ParseFace( dsurface_t *ds, drawVert_t *verts, msurface_t *surf, int
 	cv->numPoints = numPoints;
 	cv->numIndices = numIndexes;
 	cv->ofsIndices = ofsIndexes;
+	cv->staticVert = -1;
+	cv->staticIndex = -1;
 
 	verts += LittleLong( ds->firstVert );
 	for ( i = 0 ; i < numPoints ; i++ ) {
@@ -531,6 +535,8 @@ static void ParseTriSurf( dsurface_t *ds, drawVert_t *verts, msurface_t *surf, i
 	tri->numIndexes = numIndexes;
 	tri->verts = (drawVert_t *)(tri + 1);
 	tri->indexes = (int *)(tri->verts + tri->numVerts );
+	tri->staticVert = -1;
+	tri->staticIndex = -1;
 
 	surf->data = (surfaceType_t *)tri;
 
@@ -1885,6 +1891,122 @@ qboolean RE_GetEntityToken( char *buffer, int size )
 	}
 }
 
+/*
+=================
+R_LoadStaticGeometry
+
+Planar faces and triangle soups never change after the map is loaded,
+so their positions and indexes are put in device local buffers once,
+and the backend draws them from there instead of copying them into the
+host visible stream every frame. Grids are left out, their level of
+detail is picked per frame, as are sky and deforming shaders which
+always rebuild tess.
+=================
+*/
+static qboolean R_SurfaceIsStatic( const msurface_t * const surf )
+{
+	if ( surf->shader->isSky || surf->shader->numDeforms ) {
+		return qfalse;
+	}
+
+	if ( *surf->data == SF_FACE ) {
+		const srfSurfaceFace_t * const face = (const srfSurfaceFace_t *)surf->data;
+		const int * const indices = (const int *)( (const byte *)face + face->ofsIndices );
+		int i;
+
+		// the streaming path never checked these, but out of range
+		// indexes into a shared buffer would read other surfaces
+		for ( i = 0 ; i < face->numIndices ; i++ ) {
+			if ( indices[i] < 0 || indices[i] >= face->numPoints ) {
+				return qfalse;
+			}
+		}
+		return qtrue;
+	}
+
+	return ( *surf->data == SF_TRIANGLES );
+}
+
+
+static void R_LoadStaticGeometry( void )
+{
+	uint32_t numVerts = 0;
+	uint32_t numIndexes = 0;
+	int i, j;
+
+	for ( i = 0 ; i < s_worldData.numsurfaces ; i++ ) {
+		msurface_t * const surf = &s_worldData.surfaces[i];
+
+		if ( !R_SurfaceIsStatic( surf ) ) {
+			continue;
+		}
+
+		if ( *surf->data == SF_FACE ) {
+			srfSurfaceFace_t * const face = (srfSurfaceFace_t *)surf->data;
+			face->staticVert = numVerts;
+			face->staticIndex = numIndexes;
+			numVerts += face->numPoints;
+			numIndexes += face->numIndices;
+		} else {
+			srfTriangles_t * const tri = (srfTriangles_t *)surf->data;
+			tri->staticVert = numVerts;
+			tri->staticIndex = numIndexes;
+			numVerts += tri->numVerts;
+			numIndexes += tri->numIndexes;
+		}
+	}
+
+	if ( numVerts == 0 || numIndexes == 0 ) {
+		return;
+	}
+
+	float (* const pXYZ)[4] = ri.Malloc( numVerts * sizeof(vec4_t) );
+	uint32_t * const pIdx = ri.Malloc( numIndexes * sizeof(uint32_t) );
+
+	for ( i = 0 ; i < s_worldData.numsurfaces ; i++ ) {
+		const msurface_t * const surf = &s_worldData.surfaces[i];
+
+		if ( *surf->data == SF_FACE ) {
+			const srfSurfaceFace_t * const face = (const srfSurfaceFace_t *)surf->data;
+			const int * const indices = (const int *)( (const byte *)face + face->ofsIndices );
+
+			if ( face->staticVert < 0 ) {
+				continue;
+			}
+
+			for ( j = 0 ; j < face->numPoints ; j++ ) {
+				VectorCopy( face->points[j], pXYZ[face->staticVert + j] );
+				pXYZ[face->staticVert + j][3] = 1.0f;
+			}
+			// indexes are global, a batch draws them with a vertex
+			// offset of -staticVert so they land on its own vertexes
+			for ( j = 0 ; j < face->numIndices ; j++ ) {
+				pIdx[face->staticIndex + j] = face->staticVert + indices[j];
+			}
+		} else if ( *surf->data == SF_TRIANGLES ) {
+			const srfTriangles_t * const tri = (const srfTriangles_t *)surf->data;
+
+			if ( tri->staticVert < 0 ) {
+				continue;
+			}
+
+			for ( j = 0 ; j < tri->numVerts ; j++ ) {
+				VectorCopy( tri->verts[j].xyz, pXYZ[tri->staticVert + j] );
+				pXYZ[tri->staticVert + j][3] = 1.0f;
+			}
+			for ( j = 0 ; j < tri->numIndexes ; j++ ) {
+				pIdx[tri->staticIndex + j] = tri->staticVert + tri->indexes[j];
+			}
+		}
+	}
+
+	vk_createStaticGeometry( pXYZ, numVerts, pIdx, numIndexes );
+
+	ri.Free( pIdx );
+	ri.Free( pXYZ );
+}
+
+
 /*
 =================
 Called directly from cgame
@@ -1896,6 +2018,8 @@ void RE_LoadWorldMap( const char *name )
 	int			i;
 	char* buffer;
 
+	R_SyncRenderThread();
+
 	if ( tr.worldMapLoaded ) {
 		ri.Error( ERR_DROP, "ERROR: attempted to redundantly load world map\n" );
 	}
@@ -1965,6 +2089,8 @@ void RE_LoadWorldMap( const char *name )
 
 	s_worldData.dataSize = (unsigned char *)ri.Hunk_Alloc(0, h_low) - startMarker;
 
+	R_LoadStaticGeometry();
+
 	// only set tr.world now that we know the entire level has loaded properly
 	tr.world = &s_worldData;
 	tr.worldMapLoaded = qtrue;
@@ -37,9 +37,49 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tr_cmds.h"
 
 #include "RB_RenderDrawSurfList.h"
+#include "R_GetMicroSeconds.h"
+
+#include <setjmp.h>
 // #include "vk_screenshot.h"
 
-static renderCommandList_t BE_Commands;
+// one command list per frame the front end and the render thread may
+// be working on at the same time, tr.smpFrame is the front end's
+static renderCommandList_t BE_Commands[SMP_FRAMES];
+
+#ifdef _MSC_VER
+static __declspec(thread) qboolean s_isRenderThread;
+#else
+static __thread qboolean s_isRenderThread;
+#endif
+
+static struct {
+    struct sysThread_s * thread;
+    // posted by the front end when a frame is handed over,
+    // and by the render thread when it is done with it.
+    struct sysSemaphore_s * work;
+    struct sysSemaphore_s * done;
+    const void * pCmds;
+    volatile qboolean quit;
+
+    // only ever touched by the front end
+    qboolean busy;
+    int backEndMsec;
+    // time the front end spent waiting for the render thread
+    uint64_t stallUsec;
+    uint64_t lastStallUsec;
+
+    // an ri.Error raised on the render thread, passed on to the
+    // front end by R_SyncRenderThread
+    qboolean failed;
+    int errorLevel;
+    char errorMessage[1024];
+} s_smp;
+
+// ri.Error as the engine gave it, ri.Error is R_Error while the render
+// thread runs. The render thread never set the engine's jump buffer, so
+// an error there jumps back to RB_RenderThread instead.
+static void (QDECL *s_engineError)( int errorLevel, const char *fmt, ... ) __attribute__ ((noreturn, format (printf, 2, 3)));
+static jmp_buf s_renderThreadAbort;
 
 extern shaderCommands_t tess;
 /*
@@ -52,7 +92,7 @@ render thread if needed.
 */
 void* R_GetCommandBuffer( int bytes )
 {
-    renderCommandList_t * cmdList = &BE_Commands;
+    renderCommandList_t * cmdList = &BE_Commands[tr.smpFrame];
 
     // always leave room for the end of list command
     if ( cmdList->used + bytes + 4 > MAX_RENDER_COMMANDS )
@@ -190,6 +230,16 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec )
 		*frontEndMsec = tr.frontEndMsec;
 	}
 	tr.frontEndMsec = 0;
+	if ( s_smp.thread )
+	{
+		// backEnd belongs to the render thread now, report the last
+		// frame it finished
+		if ( backEndMsec ) {
+			*backEndMsec = s_smp.backEndMsec;
+		}
+		return;
+	}
+
 	if ( backEndMsec ) {
 		*backEndMsec = backEnd.pc.msec;
 	}
@@ -325,7 +375,22 @@ static void R_PerformanceCounters( void )
 				tr.pc.c_dlightSurfaces, tr.pc.c_dlightSurfacesCulled,
 				backEnd.pc.c_dlightVertexes, backEnd.pc.c_dlightIndexes / 3 );
 		}
-	} 
+	} else if (r_speeds->integer == 5) {
+		ri.Printf (PRINT_ALL, "backend %.2f ms, %i KB uploaded, %i KB static, %i static draws\n",
+			backEnd.pc.usec / 1000.0f, backEnd.pc.c_uploadBytes / 1024,
+			backEnd.pc.c_staticBytes / 1024, backEnd.pc.c_staticDraws );
+	} else if (r_speeds->integer == 6) {
+		if ( s_smp.thread ) {
+			// the back end ran from the last hand over until it was
+			// waited for, the part the front end did not wait on overlapped
+			const int overlapUsec = backEnd.pc.usec - (int)s_smp.lastStallUsec;
+			ri.Printf (PRINT_ALL, "smp: back end %.2f ms, front end waited %.2f ms, overlapped %.2f ms\n",
+				backEnd.pc.usec / 1000.0f, s_smp.lastStallUsec / 1000.0f,
+				( overlapUsec > 0 ? overlapUsec : 0 ) / 1000.0f );
+		} else {
+			ri.Printf (PRINT_ALL, "smp: off, back end %.2f ms\n", backEnd.pc.usec / 1000.0f );
+		}
+	}
 
 	memset( &tr.pc, 0, sizeof( tr.pc ) );
 	memset( &backEnd.pc, 0, sizeof( backEnd.pc ) );
@@ -337,25 +402,14 @@ This function will be called synchronously if running without
 smp extensions, or asynchronously by another thread.
 ====================
 */
-void R_IssueRenderCommands( qboolean runPerformanceCounters )
+void RB_ExecuteRenderCommands( const void *pCmds )
 {
-
-    if(runPerformanceCounters)
-    {
-        R_PerformanceCounters();
-    }
+    const unsigned char * data = pCmds;
 
     // actually start the commands going
     // let it start on the new batch
-    // RB_ExecuteRenderCommands( cmdList->cmds );
     int	t1 = ri.Milliseconds();
-
-    // add an end-of-list command
-    *(int *)(BE_Commands.cmds + BE_Commands.used) = RC_END_OF_LIST;
-
-
-    const unsigned char * data = BE_Commands.cmds;
-
+    const uint64_t t0 = R_GetTimeMicroSeconds();
 
     while(1)
     {   
@@ -411,8 +465,6 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters )
                 // const drawBufferCommand_t * const cmd = (const drawBufferCommand_t *)data;
                 // VULKAN
 
-                vk_resetGeometryBuffer();
-                
                 vk_begin_frame();
 
                 data += sizeof(drawBufferCommand_t);
@@ -441,9 +493,224 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters )
             case RC_END_OF_LIST:
                 // stop rendering on this thread
                 backEnd.pc.msec = ri.Milliseconds() - t1;
-
-                BE_Commands.used = 0;
+                backEnd.pc.usec = R_GetTimeMicroSeconds() - t0;
                 return;
         }
     }
 }
+
+
+void R_IssueRenderCommands( qboolean runPerformanceCounters )
+{
+    renderCommandList_t * const cmdList = &BE_Commands[tr.smpFrame];
+
+    // add an end-of-list command
+    *(int *)(cmdList->cmds + cmdList->used) = RC_END_OF_LIST;
+
+    // clear it out, the list is either run right away or, for a
+    // finished frame, owned by the render thread from here on
+    cmdList->used = 0;
+
+    // only a finished frame goes to the render thread, the other callers
+    // want their commands done by the time this returns
+    if ( s_smp.thread && runPerformanceCounters )
+    {
+        // the back end may still work on the frame before, whatever is
+        // left of it now is time the front end could not hide
+        R_SyncRenderThread();
+
+        s_smp.lastStallUsec = s_smp.stallUsec;
+        s_smp.stallUsec = 0;
+        s_smp.backEndMsec = backEnd.pc.msec;
+
+        R_PerformanceCounters();
+
+        s_smp.pCmds = cmdList->cmds;
+        s_smp.busy = qtrue;
+        backEnd.smpFrame = tr.smpFrame;
+        ri.Sys_SemaphorePost( s_smp.work, 1 );
+
+        // the front end moves on to the other set of buffers
+        tr.smpFrame ^= 1;
+        BE_Commands[tr.smpFrame].used = 0;
+        return;
+    }
+
+    // the back end state is about to be used by this thread
+    R_SyncRenderThread();
+
+    if(runPerformanceCounters)
+    {
+        R_PerformanceCounters();
+    }
+
+    backEnd.smpFrame = tr.smpFrame;
+    RB_ExecuteRenderCommands( cmdList->cmds );
+}
+
+
+static void R_WaitRenderThread( void )
+{
+    if ( !s_smp.busy || s_isRenderThread ) {
+        return;
+    }
+
+    const uint64_t t0 = R_GetTimeMicroSeconds();
+
+    ri.Sys_SemaphoreWait( s_smp.done );
+    s_smp.busy = qfalse;
+
+    s_smp.stallUsec += R_GetTimeMicroSeconds() - t0;
+}
+
+
+/*
+====================
+R_SyncRenderThread
+
+Wait for the render thread to finish the frame it was given, before the
+front end touches anything the back end may be using: vulkan objects,
+the queue, tess, the shader sort order. A no-op without r_smp and on
+the render thread itself. An error the back end ran into is raised here.
+====================
+*/
+void R_SyncRenderThread( void )
+{
+    R_WaitRenderThread();
+
+    if ( s_smp.failed && !s_isRenderThread )
+    {
+        s_smp.failed = qfalse;
+        ri.Error( s_smp.errorLevel, "%s", s_smp.errorMessage );
+    }
+}
+
+
+static void QDECL R_Error( int errorLevel, const char *fmt, ... ) __attribute__ ((noreturn, format (printf, 2, 3)));
+static void QDECL R_Error( int errorLevel, const char *fmt, ... )
+{
+    va_list argptr;
+
+    if ( !s_isRenderThread )
+    {
+        char msg[1024];
+
+        va_start( argptr, fmt );
+        Q_vsnprintf( msg, sizeof( msg ), fmt, argptr );
+        va_end( argptr );
+
+        s_engineError( errorLevel, "%s", msg );
+    }
+
+    va_start( argptr, fmt );
+    Q_vsnprintf( s_smp.errorMessage, sizeof( s_smp.errorMessage ), fmt, argptr );
+    va_end( argptr );
+
+    s_smp.errorLevel = errorLevel;
+    s_smp.failed = qtrue;
+
+    longjmp( s_renderThreadAbort, 1 );
+}
+
+
+static void RB_RenderThread( void *arg )
+{
+    s_isRenderThread = qtrue;
+
+    while ( 1 )
+    {
+        ri.Sys_SemaphoreWait( s_smp.work );
+
+        if ( s_smp.quit ) {
+            break;
+        }
+
+        // the rest of the frame is dropped after an error
+        if ( !setjmp( s_renderThreadAbort ) ) {
+            RB_ExecuteRenderCommands( s_smp.pCmds );
+        }
+
+        ri.Sys_SemaphorePost( s_smp.done, 1 );
+    }
+}
+
+
+void R_InitRenderThread( void )
+{
+    memset( &s_smp, 0, sizeof( s_smp ) );
+
+    if ( !r_smp->integer ) {
+        return;
+    }
+
+    s_smp.work = ri.Sys_CreateSemaphore( 0 );
+    s_smp.done = ri.Sys_CreateSemaphore( 0 );
+
+    if ( s_smp.work && s_smp.done ) {
+        s_smp.thread = ri.Sys_CreateThread( RB_RenderThread, NULL );
+    }
+
+    if ( s_smp.thread == NULL )
+    {
+        ri.Printf( PRINT_WARNING, "R_InitRenderThread: failed to start the render thread, smp disabled.\n" );
+        R_ShutdownRenderThread();
+        return;
+    }
+
+    s_engineError = ri.Error;
+    ri.Error = R_Error;
+
+    ri.Printf( PRINT_ALL, " Render thread started. \n" );
+}
+
+
+void R_ShutdownRenderThread( void )
+{
+    if ( s_smp.thread )
+    {
+        // this may be the error handling of what the render thread
+        // ran into, don't raise anything again
+        R_WaitRenderThread();
+        if ( s_smp.failed ) {
+            ri.Printf( PRINT_WARNING, "render thread: %s\n", s_smp.errorMessage );
+        }
+
+        s_smp.quit = qtrue;
+        ri.Sys_SemaphorePost( s_smp.work, 1 );
+        ri.Sys_JoinThread( s_smp.thread );
+
+        ri.Error = s_engineError;
+
+        ri.Printf( PRINT_ALL, " Render thread stopped. \n" );
+    }
+
+    if ( s_smp.work ) {
+        ri.Sys_DestroySemaphore( s_smp.work );
+    }
+    if ( s_smp.done ) {
+        ri.Sys_DestroySemaphore( s_smp.done );
+    }
+
+    memset( &s_smp, 0, sizeof( s_smp ) );
+
+    // the front end may have been on the second set of buffers,
+    // what it had queued there goes with them
+    BE_Commands[1].used = 0;
+    tr.smpFrame = 0;
+}
+
+
+qboolean R_RenderThreadActive( void )
+{
+    return ( s_smp.thread != NULL );
+}
+
+
+const void * R_GetPendingCommands( void )
+{
+    renderCommandList_t * const cmdList = &BE_Commands[tr.smpFrame];
+
+    *(int *)(cmdList->cmds + cmdList->used) = RC_END_OF_LIST;
+
+    return cmdList->cmds;
+}
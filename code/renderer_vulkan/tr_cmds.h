@@ -3,6 +3,7 @@
 
 #include "trRefDef.h"
 #include "viewParms.h"
+#include "surface_type.h"
 /*
 =========================================================
 
@@ -87,6 +88,12 @@ void* R_GetCommandBuffer( int bytes );
 void RB_ExecuteRenderCommands( const void *data );
 
 void R_IssueRenderCommands( qboolean runPerformanceCounters );
+const void * R_GetPendingCommands( void );
+
+void R_InitRenderThread( void );
+void R_ShutdownRenderThread( void );
+void R_SyncRenderThread( void );
+qboolean R_RenderThreadActive( void );
 
 void R_AddDrawSurfCmd( struct drawSurf_s * const drawSurfs, uint32_t numDrawSurfs );
 
@@ -1,5 +1,6 @@
 #include "tr_cvar.h"
 #include "ref_import.h"
+#include "vk_instance.h"
 
 cvar_t	*r_railWidth;
 cvar_t	*r_railCoreWidth;
@@ -69,6 +70,8 @@ cvar_t	*r_maxpolys;
 cvar_t	*r_maxpolyverts;
 
 cvar_t	*r_gpuIndex;
+cvar_t	*r_framesInFlight;
+cvar_t	*r_smp;
 
 void R_Register( void ) 
 {
@@ -157,5 +160,9 @@ void R_Register( void )
 
 	r_gpuIndex = ri.Cvar_Get( "r_gpuIndex", "0", CVAR_ARCHIVE );
 
+	r_framesInFlight = ri.Cvar_Get( "r_framesInFlight", "2", CVAR_ARCHIVE | CVAR_LATCH );
+	ri.Cvar_CheckRange( r_framesInFlight, 1, MAX_FRAMES_IN_FLIGHT, qtrue );
+	r_smp = ri.Cvar_Get( "r_smp", "0", CVAR_ARCHIVE | CVAR_LATCH );
+
 	ri.Printf(PRINT_ALL, "R_Register finished.\n");
 }
@@ -37,6 +37,8 @@ extern cvar_t	*r_gamma;
 
 extern cvar_t	*r_displayRefresh;		// refresh rate
 extern cvar_t   *r_gpuIndex;            // Your GPU card number
+extern cvar_t   *r_framesInFlight;      // frames recorded ahead of the gpu
+extern cvar_t   *r_smp;                 // run the back end on its own thread
 
 extern cvar_t	*r_singleShader;				// make most world faces use default shader
 extern cvar_t	*r_colorMipLevels;				// development aid to see texture mip usage
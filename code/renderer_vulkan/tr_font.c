@@ -72,6 +72,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "ref_import.h"
 #include "tr_cvar.h"
 #include "R_FindShader.h"
+#include "tr_cmds.h"
 
 #ifdef BUILD_FREETYPE
 #include <ft2build.h>
@@ -336,6 +337,8 @@ float readFloat( void ) {
 
 void RE_RegisterFont(const char *fontName, int pointSize, fontInfo_t *font)
 {
+	R_SyncRenderThread();
+
 #ifdef BUILD_FREETYPE
 	FT_Face face;
 	int j, k, xOut, yOut, lastStart, imageNumber;
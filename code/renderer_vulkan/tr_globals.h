@@ -98,6 +98,8 @@ typedef struct trGlobals_s
 	frontEndCounters_t pc;
 	int frontEndMsec;		// not in pc due to clearing issue
 
+	int smpFrame;			// which of the SMP_FRAMES the front end fills
+
 	//
 	// put large tables at the end, so most elements will be
 	// within the +/32K indexed range on risc processors
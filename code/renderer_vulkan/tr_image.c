@@ -31,6 +31,7 @@ SKINS
 #include "ref_import.h"
 #include "tr_shader.h"
 #include "R_FindShader.h"
+#include "tr_cmds.h"
 
 
 
@@ -155,6 +156,8 @@ static char *CommaParse( char **data_p )
 
 qhandle_t RE_RegisterSkin( const char *name )
 {
+	R_SyncRenderThread();
+
     skinSurface_t parseSurfaces[MAX_SKIN_SURFACES]; 
 	skinSurface_t	*surf;
 	char		*text, *text_p;
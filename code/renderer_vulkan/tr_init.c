@@ -251,6 +251,8 @@ void R_Init( void )
 
 	R_Set2dProjectMatrix(vk.renderArea.extent.width, vk.renderArea.extent.height);
 
+	R_InitRenderThread();
+
 	ri.Printf( PRINT_ALL, "----- R_Init finished -----\n" );
 }
 
@@ -261,6 +263,9 @@ void RE_Shutdown( qboolean destroyWindow )
 {	
 
     ri.Printf( PRINT_ALL, "RE_Shutdown( %i )\n", destroyWindow );
+
+    // everything below is shared with the back end
+    R_ShutdownRenderThread();
     
     ri.Cmd_RemoveCommand("monitorInfo");
 
@@ -330,6 +335,9 @@ void RE_Shutdown( qboolean destroyWindow )
 
     vk_destroyShaderStagePipeline();
 
+    // the next map uploads its own
+    vk_destroyStaticGeometry();
+
 
 
     if (destroyWindow)
@@ -352,7 +360,7 @@ void RE_BeginRegistration(glconfig_t * const pConfig)
 	// *pGlCfg = glConfig;
 
 	pConfig->stereoEnabled = qfalse;
-	pConfig->smpActive = qfalse;
+	pConfig->smpActive = R_RenderThreadActive();
 	pConfig->displayFrequency = 60;
 	// allways enable stencil
 	pConfig->stencilBits = 8;
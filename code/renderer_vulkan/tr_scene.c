@@ -30,6 +30,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "R_RotateForViewer.h"
 #include "R_SortDrawSurfs.h"
 #include "srfPoly_type.h"
+#include "tr_cmds.h"
 
 
 // these are sort of arbitrary limits.
@@ -73,7 +74,7 @@ typedef struct
 } backEndData_t;
 
 
-static backEndData_t* backEndData;
+static backEndData_t* backEndData[SMP_FRAMES];
 
 void R_SceneSetRefDef(void)
 {
@@ -88,16 +89,16 @@ void R_SceneSetRefDef(void)
 	tr.refdef.floatTime = tr.refdef.time * 0.001f;
 
 	tr.refdef.numDrawSurfs = r_firstSceneDrawSurf;
-	tr.refdef.drawSurfs = backEndData->drawSurfs;
+	tr.refdef.drawSurfs = backEndData[tr.smpFrame]->drawSurfs;
 
 	tr.refdef.num_entities = r_numentities - r_firstSceneEntity;
-	tr.refdef.entities = &backEndData->entities[r_firstSceneEntity];
+	tr.refdef.entities = &backEndData[tr.smpFrame]->entities[r_firstSceneEntity];
 
 	tr.refdef.num_dlights = r_numdlights - r_firstSceneDlight;
-	tr.refdef.dlights = &backEndData->dlights[r_firstSceneDlight];
+	tr.refdef.dlights = &backEndData[tr.smpFrame]->dlights[r_firstSceneDlight];
 
 	tr.refdef.numPolys = r_numpolys - r_firstScenePoly;
-	tr.refdef.polys = &backEndData->polys[r_firstScenePoly];
+	tr.refdef.polys = &backEndData[tr.smpFrame]->polys[r_firstScenePoly];
 
 	// turn off dynamic lighting globally by clearing all the
 	// dlights if it needs to be disabled or if vertex lighting is enabled
@@ -138,12 +139,24 @@ void R_InitScene(void)
 
 	unsigned int len = sizeof( backEndData_t ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts;
     
-    char* ptr = ri.Hunk_Alloc( len, h_low);
-    memset(ptr, 0, len);
-
-	backEndData = (backEndData_t *) ptr;
-	backEndData->polys = (srfPoly_t *) (ptr + sizeof( backEndData_t ));
-	backEndData->polyVerts = (polyVert_t *) (ptr + sizeof( backEndData_t ) + sizeof(srfPoly_t) * max_polys);
+    // the second set is only needed when the render thread may still
+    // be drawing from the first
+    uint32_t i;
+    for (i = 0; i < SMP_FRAMES; ++i)
+    {
+        if ( i > 0 && !r_smp->integer )
+        {
+            backEndData[i] = backEndData[0];
+            continue;
+        }
+
+        char* ptr = ri.Hunk_Alloc( len, h_low);
+        memset(ptr, 0, len);
+
+        backEndData[i] = (backEndData_t *) ptr;
+        backEndData[i]->polys = (srfPoly_t *) (ptr + sizeof( backEndData_t ));
+        backEndData[i]->polyVerts = (polyVert_t *) (ptr + sizeof( backEndData_t ) + sizeof(srfPoly_t) * max_polys);
+    }
 
     R_InitNextFrame();
 }
@@ -202,11 +215,11 @@ void RE_AddPolyToScene( qhandle_t hShader, int numVerts, const polyVert_t *verts
 			return;
 		}
 
-		poly = &backEndData->polys[r_numpolys];
+		poly = &backEndData[tr.smpFrame]->polys[r_numpolys];
 		poly->surfaceType = SF_POLY;
 		poly->hShader = hShader;
 		poly->numVerts = numVerts;
-		poly->verts = &backEndData->polyVerts[r_numpolyverts];
+		poly->verts = &backEndData[tr.smpFrame]->polyVerts[r_numpolyverts];
 		
 		memcpy( poly->verts, &verts[numVerts*j], numVerts * sizeof( *verts ) );
 
@@ -270,8 +283,8 @@ void RE_AddRefEntityToScene( const refEntity_t *ent )
 		ri.Error( ERR_DROP, "RE_AddRefEntityToScene: bad reType %i", ent->reType );
 	}
 
-	backEndData->entities[r_numentities].e = *ent;
-	backEndData->entities[r_numentities].lightingCalculated = qfalse;
+	backEndData[tr.smpFrame]->entities[r_numentities].e = *ent;
+	backEndData[tr.smpFrame]->entities[r_numentities].lightingCalculated = qfalse;
 
 	r_numentities++;
 }
@@ -302,7 +315,7 @@ void RE_AddLightToScene( const vec3_t org, float intensity, float r, float g, fl
 {
 	if ( tr.registered && (intensity > 0.0f) )
     {
-        R_AddDynamicLightToScene( org, intensity, r, g, b, qfalse, backEndData->dlights );
+        R_AddDynamicLightToScene( org, intensity, r, g, b, qfalse, backEndData[tr.smpFrame]->dlights );
     }
 }
 
@@ -310,7 +323,7 @@ void RE_AddAdditiveLightToScene( const vec3_t org, float intensity, float r, flo
 {
     if ( tr.registered && (intensity <= 0.0f) )
     {
-	    R_AddDynamicLightToScene( org, intensity, r, g, b, qtrue, backEndData->dlights );
+	    R_AddDynamicLightToScene( org, intensity, r, g, b, qtrue, backEndData[tr.smpFrame]->dlights );
     }
 }
 
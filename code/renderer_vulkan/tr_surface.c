@@ -293,6 +293,52 @@ static void RB_SurfacePolychain( const srfPoly_t * const p )
 
 
 
+/*
+==============
+Remember which part of the batch is already in the static world buffers,
+see RB_StageIteratorGeneric. Called before tess.numVertexes is advanced.
+==============
+*/
+static void RB_AddStaticRun( int staticVert, int staticIndex, uint32_t numVerts, uint32_t numIndexes )
+{
+	struct staticRun_s * pRun;
+
+	if ( staticVert < 0 ) {
+		return;
+	}
+
+	if ( tess.numStaticRuns ) {
+		pRun = &tess.staticRuns[tess.numStaticRuns - 1];
+
+		if ( ( pRun->firstVert + pRun->numVerts == (uint32_t)staticVert ) &&
+			( pRun->firstIndex + pRun->numIndexes == (uint32_t)staticIndex ) &&
+			( pRun->tessVert + pRun->numVerts == (uint32_t)tess.numVertexes ) )
+		{
+			pRun->numVerts += numVerts;
+			pRun->numIndexes += numIndexes;
+			tess.numStaticVerts += numVerts;
+			tess.numStaticIndexes += numIndexes;
+			return;
+		}
+	}
+
+	// out of runs, the batch simply gets streamed
+	if ( tess.numStaticRuns == MAX_STATIC_RUNS ) {
+		return;
+	}
+
+	pRun = &tess.staticRuns[tess.numStaticRuns++];
+	pRun->firstVert = staticVert;
+	pRun->firstIndex = staticIndex;
+	pRun->numVerts = numVerts;
+	pRun->numIndexes = numIndexes;
+	pRun->tessVert = tess.numVertexes;
+
+	tess.numStaticVerts += numVerts;
+	tess.numStaticIndexes += numIndexes;
+}
+
+
 static void RB_SurfaceTriangles( srfTriangles_t *srf )
 {
 	int			i;
@@ -302,11 +348,13 @@ static void RB_SurfaceTriangles( srfTriangles_t *srf )
 	int			dlightBits;
 	qboolean	needsNormal;
 
-	dlightBits = srf->dlightBits;
+	dlightBits = srf->dlightBits[ backEnd.smpFrame ];
 	tess.dlightBits |= dlightBits;
 
 	RB_CheckOverflow( srf->numVerts, srf->numIndexes, &tess );
 
+	RB_AddStaticRun( srf->staticVert, srf->staticIndex, srf->numVerts, srf->numIndexes );
+
 	for ( i = 0 ; i < srf->numIndexes ; i += 3 ) {
 		tess.indexes[ tess.numIndexes + i + 0 ] = tess.numVertexes + srf->indexes[ i + 0 ];
 		tess.indexes[ tess.numIndexes + i + 1 ] = tess.numVertexes + srf->indexes[ i + 1 ];
@@ -798,7 +846,9 @@ static void RB_SurfaceFace( srfSurfaceFace_t * pSurf )
 
 	RB_CheckOverflow( pSurf->numPoints, pSurf->numIndices, &tess );
 
-	dlightBits = pSurf->dlightBits;
+	RB_AddStaticRun( pSurf->staticVert, pSurf->staticIndex, pSurf->numPoints, pSurf->numIndices );
+
+	dlightBits = pSurf->dlightBits[ backEnd.smpFrame ];
 	tess.dlightBits |= dlightBits;
 
 	uint32_t * indices = ( uint32_t * ) ( ( ( char  * ) pSurf ) + pSurf->ofsIndices );
@@ -899,7 +949,7 @@ static void RB_SurfaceGrid( srfGridMesh_t *cv )
 	int		*vDlightBits;
 	qboolean	needsNormal;
 
-	dlightBits = cv->dlightBits;
+	dlightBits = cv->dlightBits[ backEnd.smpFrame ];
 	tess.dlightBits |= dlightBits;
 
 	// determine the allowable discrepance
@@ -1139,6 +1189,9 @@ void RB_BeginSurface(struct shader_s * const pShader, int fogNum, struct shaderC
 
 	pTess->numIndexes = 0;
 	pTess->numVertexes = 0;
+	pTess->numStaticRuns = 0;
+	pTess->numStaticVerts = 0;
+	pTess->numStaticIndexes = 0;
 	pTess->shader = pState;
 	pTess->fogNum = fogNum;
 	pTess->dlightBits = 0;		// will be OR'd in by surface functions
@@ -78,6 +78,41 @@ void vk_stagBufToDevLocal(VkImage hImage, VkBufferImageCopy* const pRegion, cons
 }
 
 
+// Fill a device local buffer through the staging buffer, used for data
+// that is written once (the static world geometry) and then only read
+// by the GPU. dstAccess is the access the first draw reading it will do.
+void vk_uploadToDevLocalBuffer(VkBuffer hBuf, const void * const pData,
+        const uint32_t size, VkAccessFlags dstAccess)
+{
+    VK_UploadImageToStagBuffer(pData, size);
+
+    vk_beginRecordCmds( vk.tmpRecordBuffer );
+
+    VkBufferCopy region;
+    region.srcOffset = 0;
+    region.dstOffset = 0;
+    region.size = size;
+
+    NO_CHECK( qvkCmdCopyBuffer(vk.tmpRecordBuffer, StagBuf.buff, hBuf, 1, &region) );
+
+    VkBufferMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.pNext = NULL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = dstAccess;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = hBuf;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+
+    NO_CHECK( qvkCmdPipelineBarrier(vk.tmpRecordBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0, NULL, 1, &barrier, 0, NULL) );
+
+    vk_commitRecordedCmds(vk.tmpRecordBuffer);
+}
+
+
 
 void vk_createBufferResource(const uint32_t Size, VkBufferUsageFlags Usage,
         VkMemoryPropertyFlagBits MemTypePrefered,
@@ -15,4 +15,6 @@ void vk_createStagingBuffer(uint32_t size);
 void vk_destroyStagingBuffer(void);
 void VK_UploadImageToStagBuffer(const unsigned char * const pUploadBuffer, uint32_t buffer_size);
 void vk_stagBufToDevLocal(VkImage hImage, VkBufferImageCopy* const pRegion, const uint32_t nRegion);
+void vk_uploadToDevLocalBuffer(VkBuffer hBuf, const void * const pData,
+        const uint32_t size, VkAccessFlags dstAccess);
 #endif
@@ -6,6 +6,7 @@
 #include "render_export.h"
 #include "vk_image_sampler.h"
 #include "vk_buffers.h"
+#include "tr_cmds.h"
 
 
 static VkDeviceMemory s_mappableMemory;
@@ -79,10 +80,21 @@ void vk_destroyScratchImage(void)
 
 void RE_UploadCinematic(int w, int h, int cols, int rows, const unsigned char * data, int client, int dirty)
 {
+    // no-op when called from the back end through R_BindAnimatedImage
+    R_SyncRenderThread();
+
+    const int resized = (cols != tr_scratchImage.uploadWidth) || (rows != tr_scratchImage.uploadHeight);
+
+    // earlier frames still in flight may be sampling the scratch image,
+    // let them finish before it is rewritten or recreated.
+    if ( resized || dirty )
+    {
+        NO_CHECK( qvkQueueWaitIdle(vk.queue) );
+    }
 
     // the image may not even created, and it image data may not even uploaded.
     // if the scratchImage isn't in the format we want, specify it as a new texture
-    if ( (cols != tr_scratchImage.uploadWidth) || (rows != tr_scratchImage.uploadHeight) )
+    if ( resized )
     {
         ri.Printf(PRINT_ALL, "w=%d, h=%d, cols=%d, rows=%d, client=%d, prtImage->width=%d, prtImage->height=%d\n", 
            w, h, cols, rows, client, tr_scratchImage.uploadWidth, tr_scratchImage.uploadHeight);
@@ -264,6 +276,8 @@ Used for cinematics.
 void RE_StretchRaw (int x, int y, int w, int h, int cols, int rows, 
         const unsigned char *data, int client, qboolean dirty )
 {
+    // RB_StretchPic below writes tess directly
+    R_SyncRenderThread();
 
     // SCR_AdjustFrom640( &x, &y, &w, &h );
 /*
@@ -7,6 +7,7 @@
 #include "vk_frame.h"
 #include "vk_cmd.h"
 #include "ref_import.h" 
+#include "tr_cmds.h"
 //  Synchronization of access to resources is primarily the responsibility
 //  of the application in Vulkan. The order of execution of commands with
 //  respect to the host and other commands on the device has few implicit
@@ -54,9 +55,13 @@
 //
 //
 
-VkSemaphore sema_imageAvailable;
-VkSemaphore sema_renderFinished;
-VkFence fence_renderFinished;
+// one of each per frame in flight, indexed by vk.idx_frame. While the
+// gpu works through frame N the cpu records frame N + 1 into its own
+// command buffer and geometry slice, and only blocks on the fence of
+// the frame that used them vk.frames_in_flight frames ago.
+static VkSemaphore sema_imageAvailable[MAX_FRAMES_IN_FLIGHT];
+static VkSemaphore sema_renderFinished[MAX_FRAMES_IN_FLIGHT];
+static VkFence fence_renderFinished[MAX_FRAMES_IN_FLIGHT];
 
 /*
    Host access to fence must be externally synchronized.
@@ -142,8 +147,11 @@ static void vk_createSyncSemaphores(VkSemaphore * const pImgAvailable,
 
 void vk_create_sync_primitives(void)
 {
-    vk_createSyncSemaphores(&sema_imageAvailable, &sema_renderFinished);
-    vk_createRenderFinishedFence(&fence_renderFinished);
+    for (uint32_t i = 0; i < vk.frames_in_flight; ++i)
+    {
+        vk_createSyncSemaphores(&sema_imageAvailable[i], &sema_renderFinished[i]);
+        vk_createRenderFinishedFence(&fence_renderFinished[i]);
+    }
 }
 
 
@@ -151,11 +159,14 @@ void vk_destroy_sync_primitives(void)
 {
     ri.Printf(PRINT_ALL, " Destroy sema_imageAvailable sema_renderFinished fence_renderFinished\n");
 
-    NO_CHECK( qvkDestroySemaphore(vk.device, sema_imageAvailable, NULL) );
-	NO_CHECK( qvkDestroySemaphore(vk.device, sema_renderFinished, NULL) );
+    for (uint32_t i = 0; i < vk.frames_in_flight; ++i)
+    {
+        NO_CHECK( qvkDestroySemaphore(vk.device, sema_imageAvailable[i], NULL) );
+        NO_CHECK( qvkDestroySemaphore(vk.device, sema_renderFinished[i], NULL) );
 
-    // To destroy a fence, 
-	NO_CHECK( qvkDestroyFence(vk.device, fence_renderFinished, NULL) );
+        // To destroy a fence, 
+        NO_CHECK( qvkDestroyFence(vk.device, fence_renderFinished[i], NULL) );
+    }
 }
 
 
@@ -418,8 +429,26 @@ void vk_createRenderPass(VkDevice device, VkFormat colorFormat,
     // dependensies, which specify memory and execution dependencies between
     // subpasses. Operations right before and right after this subpass also
     // count as implicit "subpasses".
-	desc.dependencyCount = 0;
-	desc.pDependencies = NULL;
+    //
+    // With several frames in flight the render pass of frame N + 1 may
+    // start while frame N is still running. They share the depth image,
+    // so the depth clear of the new pass has to wait for the depth tests
+    // of the previous one, and the color writes wait for the swapchain
+    // image to be acquired (the semaphore wait stage of vk_end_frame).
+    VkSubpassDependency dependency;
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+        VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+        VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependency.dependencyFlags = 0;
+
+	desc.dependencyCount = 1;
+	desc.pDependencies = &dependency;
 
 	VK_CHECK( qvkCreateRenderPass(device, &desc, NULL, pRenderPassObj) );
 }
@@ -889,12 +918,20 @@ void vk_begin_frame(void)
     //  called, then vkWaitForFences will block and wait up to timeout
     //  nanoseconds for the condition to become satisfied.
 
-    VK_CHECK( qvkWaitForFences(vk.device, 1, &fence_renderFinished, VK_FALSE, 1e9) );
+    //  Only the frame that last used this slot has to be finished,
+    //  the frames submitted after it keep the gpu busy meanwhile.
+    vk.idx_frame = (vk.idx_frame + 1) % vk.frames_in_flight;
+    vk.command_buffer = vk.cmdBufs[vk.idx_frame];
+
+    VK_CHECK( qvkWaitForFences(vk.device, 1, &fence_renderFinished[vk.idx_frame], VK_FALSE, 1e9) );
 
     //  To set the state of fences to unsignaled from the host
     //  "1" is the number of fences to reset. 
     //  "fence_renderFinished" is the fence handle to reset.
-    VK_CHECK( qvkResetFences(vk.device, 1, &fence_renderFinished) );
+    VK_CHECK( qvkResetFences(vk.device, 1, &fence_renderFinished[vk.idx_frame]) );
+
+    //  the geometry slice of this frame is free again
+    vk_resetGeometryBuffer();
 
 
     // begin_info is an instance of the VkCommandBufferBeginInfo structure,
@@ -944,7 +981,7 @@ void vk_begin_frame(void)
     // is signaled before accessing the image's data.
     // If timeout is UINT64_MAX, the timeout period is treated as infinite
     VK_CHECK( qvkAcquireNextImageKHR(vk.device, vk.swapchain, UINT64_MAX,
-                sema_imageAvailable, VK_NULL_HANDLE, &vk.idx_swapchain_image) );
+                sema_imageAvailable[vk.idx_frame], VK_NULL_HANDLE, &vk.idx_swapchain_image) );
 
     //
     // Begin render pass.
@@ -1002,7 +1039,7 @@ void vk_end_frame(void)
 	submit_info.signalSemaphoreCount = 1;
     // specify which semaphones to signal once the command buffers
     // have finished execution
-	submit_info.pSignalSemaphores = &sema_renderFinished;
+	submit_info.pSignalSemaphores = &sema_renderFinished[vk.idx_frame];
 	
     // Before executing the commands in pCommandBuffers, the queue
     // will wait for all of the semaphores in pWaitSemaphores. In
@@ -1011,7 +1048,7 @@ void vk_end_frame(void)
     // buffers, and when it is done, it will signal each of the
     // the semaphores contained in pSignalSemaphores.
     submit_info.waitSemaphoreCount = 1;
-	submit_info.pWaitSemaphores = &sema_imageAvailable;
+	submit_info.pWaitSemaphores = &sema_imageAvailable[vk.idx_frame];
 
     //  queue is the queue that the command buffers will be submitted to.
     //  1 is the number of elements in the pSubmits array.
@@ -1049,14 +1086,14 @@ void vk_end_frame(void)
     // should attempt to batch work together into as few calls to 
     // vkQueueSubmit as possible.
 
-    VK_CHECK( qvkQueueSubmit(vk.queue, 1, &submit_info, fence_renderFinished) );
+    VK_CHECK( qvkQueueSubmit(vk.queue, 1, &submit_info, fence_renderFinished[vk.idx_frame]) );
 
     
     VkPresentInfoKHR present_info;
 	present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 	present_info.pNext = NULL;
 	present_info.waitSemaphoreCount = 1;
-	present_info.pWaitSemaphores = &sema_renderFinished;
+	present_info.pWaitSemaphores = &sema_renderFinished[vk.idx_frame];
 
     // specify the swap chains to present images to
 	present_info.swapchainCount = 1;
@@ -1100,5 +1137,6 @@ void RE_WinMessage(unsigned int msgType, int x, int y, int w, int h)
 
 void RE_WaitRenderFinishCurFrame(void)
 {
+	R_SyncRenderThread();
 	VK_CHECK( qvkDeviceWaitIdle(vk.device) );
 }
\ No newline at end of file
@@ -561,6 +561,7 @@ static void VK_LoadDeviceFunctions(VkDevice	hLogicalDevice)
         INIT_DEVICE_FUNCTION(vkCmdBlitImage)
         INIT_DEVICE_FUNCTION(vkCmdClearAttachments)
         INIT_DEVICE_FUNCTION(vkCmdClearColorImage)
+        INIT_DEVICE_FUNCTION(vkCmdCopyBuffer)
         INIT_DEVICE_FUNCTION(vkCmdCopyBufferToImage)
         INIT_DEVICE_FUNCTION(vkCmdCopyImage)
         INIT_DEVICE_FUNCTION(vkCmdCopyImageToBuffer)
@@ -581,6 +582,7 @@ static void VK_LoadDeviceFunctions(VkDevice	hLogicalDevice)
         INIT_DEVICE_FUNCTION(vkCreateGraphicsPipelines)
         INIT_DEVICE_FUNCTION(vkCreateImage)
         INIT_DEVICE_FUNCTION(vkCreateImageView)
+        INIT_DEVICE_FUNCTION(vkCreatePipelineCache)
         INIT_DEVICE_FUNCTION(vkCreatePipelineLayout)
         INIT_DEVICE_FUNCTION(vkCreateRenderPass)
         INIT_DEVICE_FUNCTION(vkCreateSampler)
@@ -596,6 +598,7 @@ static void VK_LoadDeviceFunctions(VkDevice	hLogicalDevice)
         INIT_DEVICE_FUNCTION(vkDestroyImage)
         INIT_DEVICE_FUNCTION(vkDestroyImageView)
         INIT_DEVICE_FUNCTION(vkDestroyPipeline)
+        INIT_DEVICE_FUNCTION(vkDestroyPipelineCache)
         INIT_DEVICE_FUNCTION(vkDestroyPipelineLayout)
         INIT_DEVICE_FUNCTION(vkDestroyRenderPass)
         INIT_DEVICE_FUNCTION(vkDestroySampler)
@@ -610,6 +613,7 @@ static void VK_LoadDeviceFunctions(VkDevice	hLogicalDevice)
         INIT_DEVICE_FUNCTION(vkGetDeviceQueue)
         INIT_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
         INIT_DEVICE_FUNCTION(vkGetImageSubresourceLayout)
+        INIT_DEVICE_FUNCTION(vkGetPipelineCacheData)
         INIT_DEVICE_FUNCTION(vkMapMemory)
         INIT_DEVICE_FUNCTION(vkUnmapMemory)
         INIT_DEVICE_FUNCTION(vkQueueSubmit)
@@ -708,6 +712,10 @@ void vk_initialize(void * pWinContext)
                         &vk.swapchain_image_count, vk.color_image_views );
 
 
+        // one set of per frame resources for each frame in flight
+        vk.frames_in_flight = r_framesInFlight->integer;
+        vk.idx_frame = 0;
+
         // Sync primitives.
         vk_create_sync_primitives();
 
@@ -716,8 +724,13 @@ void vk_initialize(void * pWinContext)
         // command buffers are allocated from them.
         vk_create_command_pool( &vk.command_pool );
 
-        ri.Printf(PRINT_ALL, " Create command buffer: vk.command_buffer. \n");
-        vk_create_command_buffer(vk.command_pool, &vk.command_buffer);
+        ri.Printf(PRINT_ALL, " Create command buffers: vk.cmdBufs, %d frames in flight. \n",
+                vk.frames_in_flight);
+        for (uint32_t i = 0; i < vk.frames_in_flight; ++i)
+        {
+            vk_create_command_buffer(vk.command_pool, &vk.cmdBufs[i]);
+        }
+        vk.command_buffer = vk.cmdBufs[0];
 
         ri.Printf(PRINT_ALL, " Create command buffer: vk.tmpRecordBuffer. \n");
         vk_create_command_buffer(vk.command_pool, &vk.tmpRecordBuffer);
@@ -747,6 +760,9 @@ void vk_initialize(void * pWinContext)
         // These descriptor sets layouts are aggregated into a single pipeline layout.
         vk_createPipelineLayout(vk.set_layout, &vk.pipeline_layout);
 
+        // pipelines compiled by earlier runs on this device and driver
+        vk_createPipelineCache();
+
         //
         vk_createVertexBuffer();
         vk_createIndexBuffer();
@@ -804,12 +820,18 @@ void vk_shutdown( void )
         vk_destroyGlobalStagePipeline();
         vk_destroyDebugPipelines();
 
+        vk_destroyPipelineCache();
+
         vk_destroy_pipeline_layout();
 
         vk_destroy_descriptor_pool();
 
-        ri.Printf( PRINT_ALL, " Free command buffers: vk.command_buffer. \n" );  
-        vk_freeCmdBufs(&vk.command_buffer);
+        ri.Printf( PRINT_ALL, " Free command buffers: vk.cmdBufs. \n" );  
+        for (uint32_t i = 0; i < vk.frames_in_flight; ++i)
+        {
+            vk_freeCmdBufs(&vk.cmdBufs[i]);
+        }
+        vk.command_buffer = VK_NULL_HANDLE;
         ri.Printf( PRINT_ALL, " Free command buffers: vk.tmpRecordBuffer. \n" );  
         vk_freeCmdBufs(&vk.tmpRecordBuffer);
 
@@ -62,6 +62,7 @@ PFN_vkCmdBindVertexBuffers						qvkCmdBindVertexBuffers;
 PFN_vkCmdBlitImage								qvkCmdBlitImage;
 PFN_vkCmdClearAttachments						qvkCmdClearAttachments;
 PFN_vkCmdClearColorImage                        qvkCmdClearColorImage;
+PFN_vkCmdCopyBuffer								qvkCmdCopyBuffer;
 PFN_vkCmdCopyBufferToImage						qvkCmdCopyBufferToImage;
 PFN_vkCmdCopyImage								qvkCmdCopyImage;
 PFN_vkCmdCopyImageToBuffer                      qvkCmdCopyImageToBuffer;
@@ -82,6 +83,7 @@ PFN_vkCreateFramebuffer							qvkCreateFramebuffer;
 PFN_vkCreateGraphicsPipelines					qvkCreateGraphicsPipelines;
 PFN_vkCreateImage								qvkCreateImage;
 PFN_vkCreateImageView							qvkCreateImageView;
+PFN_vkCreatePipelineCache						qvkCreatePipelineCache;
 PFN_vkCreatePipelineLayout						qvkCreatePipelineLayout;
 PFN_vkCreateRenderPass							qvkCreateRenderPass;
 PFN_vkCreateSampler								qvkCreateSampler;
@@ -97,6 +99,7 @@ PFN_vkDestroyFramebuffer						qvkDestroyFramebuffer;
 PFN_vkDestroyImage								qvkDestroyImage;
 PFN_vkDestroyImageView							qvkDestroyImageView;
 PFN_vkDestroyPipeline							qvkDestroyPipeline;
+PFN_vkDestroyPipelineCache						qvkDestroyPipelineCache;
 PFN_vkDestroyPipelineLayout						qvkDestroyPipelineLayout;
 PFN_vkDestroyRenderPass							qvkDestroyRenderPass;
 PFN_vkDestroySampler							qvkDestroySampler;
@@ -111,6 +114,7 @@ PFN_vkGetBufferMemoryRequirements				qvkGetBufferMemoryRequirements;
 PFN_vkGetDeviceQueue							qvkGetDeviceQueue;
 PFN_vkGetImageMemoryRequirements				qvkGetImageMemoryRequirements;
 PFN_vkGetImageSubresourceLayout					qvkGetImageSubresourceLayout;
+PFN_vkGetPipelineCacheData						qvkGetPipelineCacheData;
 PFN_vkMapMemory									qvkMapMemory;
 PFN_vkUnmapMemory                               qvkUnmapMemory;
 PFN_vkQueueSubmit								qvkQueueSubmit;
@@ -494,6 +498,7 @@ void VK_ClearProcAddress(void)
 	qvkCmdBlitImage								= NULL;
 	qvkCmdClearAttachments						= NULL;
     qvkCmdClearColorImage                       = NULL;
+	qvkCmdCopyBuffer							= NULL;
 	qvkCmdCopyBufferToImage						= NULL;
 	qvkCmdCopyImage								= NULL;
     qvkCmdCopyImageToBuffer                     = NULL;
@@ -514,6 +519,7 @@ void VK_ClearProcAddress(void)
 	qvkCreateGraphicsPipelines					= NULL;
 	qvkCreateImage								= NULL;
 	qvkCreateImageView							= NULL;
+	qvkCreatePipelineCache						= NULL;
 	qvkCreatePipelineLayout						= NULL;
 	qvkCreateRenderPass							= NULL;
 	qvkCreateSampler							= NULL;
@@ -529,6 +535,7 @@ void VK_ClearProcAddress(void)
 	qvkDestroyImage								= NULL;
 	qvkDestroyImageView							= NULL;
 	qvkDestroyPipeline							= NULL;
+	qvkDestroyPipelineCache						= NULL;
 	qvkDestroyPipelineLayout					= NULL;
 	qvkDestroyRenderPass						= NULL;
 	qvkDestroySampler							= NULL;
@@ -543,6 +550,7 @@ void VK_ClearProcAddress(void)
 	qvkGetDeviceQueue							= NULL;
 	qvkGetImageMemoryRequirements				= NULL;
 	qvkGetImageSubresourceLayout				= NULL;
+	qvkGetPipelineCacheData						= NULL;
 	qvkMapMemory								= NULL;
     qvkUnmapMemory                              = NULL;
 	qvkQueueSubmit								= NULL;
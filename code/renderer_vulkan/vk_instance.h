@@ -47,6 +47,7 @@ extern PFN_vkCmdBindVertexBuffers						qvkCmdBindVertexBuffers;
 extern PFN_vkCmdBlitImage								qvkCmdBlitImage;
 extern PFN_vkCmdClearAttachments						qvkCmdClearAttachments;
 extern PFN_vkCmdClearColorImage 						qvkCmdClearColorImage;
+extern PFN_vkCmdCopyBuffer								qvkCmdCopyBuffer;
 extern PFN_vkCmdCopyBufferToImage						qvkCmdCopyBufferToImage;
 extern PFN_vkCmdCopyImage								qvkCmdCopyImage;
 extern PFN_vkCmdCopyImageToBuffer                       qvkCmdCopyImageToBuffer;
@@ -67,6 +68,7 @@ extern PFN_vkCreateFramebuffer							qvkCreateFramebuffer;
 extern PFN_vkCreateGraphicsPipelines					qvkCreateGraphicsPipelines;
 extern PFN_vkCreateImage								qvkCreateImage;
 extern PFN_vkCreateImageView							qvkCreateImageView;
+extern PFN_vkCreatePipelineCache						qvkCreatePipelineCache;
 extern PFN_vkCreatePipelineLayout						qvkCreatePipelineLayout;
 extern PFN_vkCreateRenderPass							qvkCreateRenderPass;
 extern PFN_vkCreateSampler								qvkCreateSampler;
@@ -82,6 +84,7 @@ extern PFN_vkDestroyFramebuffer					    	qvkDestroyFramebuffer;
 extern PFN_vkDestroyImage								qvkDestroyImage;
 extern PFN_vkDestroyImageView							qvkDestroyImageView;
 extern PFN_vkDestroyPipeline							qvkDestroyPipeline;
+extern PFN_vkDestroyPipelineCache						qvkDestroyPipelineCache;
 extern PFN_vkDestroyPipelineLayout						qvkDestroyPipelineLayout;
 extern PFN_vkDestroyRenderPass							qvkDestroyRenderPass;
 extern PFN_vkDestroySampler						    	qvkDestroySampler;
@@ -96,6 +99,7 @@ extern PFN_vkGetBufferMemoryRequirements				qvkGetBufferMemoryRequirements;
 extern PFN_vkGetDeviceQueue						    	qvkGetDeviceQueue;
 extern PFN_vkGetImageMemoryRequirements			    	qvkGetImageMemoryRequirements;
 extern PFN_vkGetImageSubresourceLayout					qvkGetImageSubresourceLayout;
+extern PFN_vkGetPipelineCacheData						qvkGetPipelineCacheData;
 extern PFN_vkMapMemory									qvkMapMemory;
 extern PFN_vkUnmapMemory                                qvkUnmapMemory;
 extern PFN_vkQueueSubmit								qvkQueueSubmit;
@@ -152,6 +156,11 @@ extern void debug_vkapi_call(VkResult result, const char * const proc_str);
 
 #define MAX_SWAPCHAIN_IMAGES    8
 
+// number of frames the cpu may record ahead of the gpu, each frame
+// owns a command buffer, a fence, its semaphores and a slice of the
+// host visible vertex and index buffers.
+#define MAX_FRAMES_IN_FLIGHT    3
+
 // Vk_Instance contains engine-specific vulkan resources that persist entire renderer lifetime.
 // This structure is initialized/deinitialized by vk_initialize/vk_shutdown functions correspondingly.
 struct Vk_Instance {
@@ -199,7 +208,12 @@ struct Vk_Instance {
 	uint32_t idx_swapchain_image;
 
 	VkCommandPool command_pool;
+    // the command buffer of the frame being recorded,
+    // it is one of cmdBufs[], picked by vk_begin_frame
 	VkCommandBuffer command_buffer;
+    VkCommandBuffer cmdBufs[MAX_FRAMES_IN_FLIGHT];
+    uint32_t frames_in_flight;
+    uint32_t idx_frame;
 
     VkCommandBuffer tmpRecordBuffer;
 
@@ -214,6 +228,10 @@ struct Vk_Instance {
 	VkDescriptorPool descriptor_pool;
 	VkDescriptorSetLayout set_layout;
 
+    // every pipeline is created through it, it is loaded from and
+    // saved to the homepath so later runs skip the shader compiles
+    VkPipelineCache pipeline_cache;
+
     // Pipeline layout: the uniform and push values referenced by 
     // the shader that can be updated at draw time
 	VkPipelineLayout pipeline_layout;
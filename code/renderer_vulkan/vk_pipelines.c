@@ -3,6 +3,7 @@
 #include "tr_shader.h"
 #include "ref_import.h"
 #include "R_SortAlgorithm.h"
+#include "R_GetMicroSeconds.h"
 
 // The graphics pipeline is the sequence of operations that take the vertices
 // and textures of your meshes all the way to the pixels in the render targets
@@ -64,6 +65,19 @@ struct PipelineParameter_t {
 
 static uint32_t s_numPipelines = 0;
 
+// pipeline creation statistics, reported by pipelineList
+static struct {
+    uint32_t created;       // vkCreateGraphicsPipelines calls this run
+    uint64_t usec;          // and the time they took
+    uint32_t onDemand;      // portal and mirror variants created at draw time
+
+    // cost of compiling pipelines with an empty cache, measured on the
+    // run that filled the cache file and carried over in its header
+    uint32_t coldCreated;
+    uint64_t coldUsec;
+    VkBool32 warm;          // a valid cache file was loaded
+} s_plStats;
+
 
 static int32_t isPipelineParamEqual(const struct ParmsKey* const par1, 
         const struct ParmsKey* const par2)
@@ -128,10 +142,10 @@ static VkPipeline FindPipeline(const struct ParmsKey * const par)
 	
 	// not find, create a new
     
-	// Hunk_Alloc vs malloc ?
-    
+	// from the zone rather than the hunk: portal and mirror variants are
+	// created lazily, which can happen on the render thread with r_smp
 	struct PipelineParameter_t * pNew = (struct PipelineParameter_t *) 
-        ri.Hunk_Alloc( sizeof(struct PipelineParameter_t ), h_low );
+        ri.Malloc( sizeof(struct PipelineParameter_t ) );
 
     // plPar.line_primitives = VK_FALSE;
     VkPipeline newPipeline;
@@ -170,7 +184,7 @@ void vk_destroyShaderStagePipeline(void)
 
 			++count;
 
-			memset(pHead, 0, sizeof(struct PipelineParameter_t));
+			ri.Free(pHead);
 
 			pHead = pNext;
 		}
@@ -243,6 +257,23 @@ void R_PipelineList_f(void)
             tmpTab[0], tmpTab[1], tmpTab[2], tmpTab[3], tmpTab[4],
             tmpTab[5], tmpTab[6], tmpTab[7], tmpTab[8], tmpTab[9]);
 
+    ri.Printf(PRINT_ALL, "\n %d pipelines built in %d ms, %d portal/mirror variants on demand\n",
+            s_plStats.created, (int)(s_plStats.usec / 1000), s_plStats.onDemand);
+
+    if ( s_plStats.warm && s_plStats.coldCreated && s_plStats.created )
+    {
+        // what the same number of pipelines cost before the cache existed
+        const uint64_t coldUsec = (uint64_t)s_plStats.coldUsec * s_plStats.created / s_plStats.coldCreated;
+        
+        ri.Printf(PRINT_ALL, " pipeline cache: about %d ms saved, %d ms without it\n",
+            (int)(coldUsec > s_plStats.usec ? (coldUsec - s_plStats.usec) / 1000 : 0),
+            (int)(coldUsec / 1000));
+    }
+    else if ( !s_plStats.warm )
+    {
+        ri.Printf(PRINT_ALL, " pipeline cache: cold, filled by this run\n");
+    }
+
     ri.Printf(PRINT_ALL, "-----------------------------------------------------\n\n"); 
 }
 
@@ -307,6 +338,169 @@ void vk_destroy_pipeline_layout(void)
     NO_CHECK( qvkDestroyPipelineLayout(vk.device, vk.pipeline_layout, NULL) );
 }
 
+//==================================================================
+// Pipeline cache
+//
+// A pipeline cache holds the results of pipeline construction so that
+// creating the same pipeline again, in this run or a later one, does
+// not compile the shaders again. The cache data is only meaningful to
+// the exact device and driver that produced it, so the file carries
+// those in a header of its own and is thrown away when they differ.
+
+#define PIPELINE_CACHE_FILE     "vkpipelines.cache"
+#define PIPELINE_CACHE_IDENT    (('C'<<24)+('P'<<16)+('K'<<8)+'V')
+#define PIPELINE_CACHE_VERSION  2
+
+struct PipelineCacheHeader_t {
+    uint32_t ident;
+    uint32_t version;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint8_t  pipelineCacheUUID[VK_UUID_SIZE];
+    uint32_t dataSize;
+
+    uint32_t coldCreated;
+    uint64_t coldUsec;
+};
+
+
+static void vk_fillPipelineCacheHeader(struct PipelineCacheHeader_t * const pHeader)
+{
+    VkPhysicalDeviceProperties props;
+
+    NO_CHECK( qvkGetPhysicalDeviceProperties(vk.physical_device, &props) );
+
+    memset(pHeader, 0, sizeof(*pHeader));
+    pHeader->ident = PIPELINE_CACHE_IDENT;
+    pHeader->version = PIPELINE_CACHE_VERSION;
+    pHeader->vendorID = props.vendorID;
+    pHeader->deviceID = props.deviceID;
+    pHeader->driverVersion = props.driverVersion;
+    memcpy(pHeader->pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+
+void vk_createPipelineCache(void)
+{
+    struct PipelineCacheHeader_t expected;
+    const struct PipelineCacheHeader_t * pHeader = NULL;
+    void * pBuf = NULL;
+
+    vk_fillPipelineCacheHeader(&expected);
+
+    memset(&s_plStats, 0, sizeof(s_plStats));
+
+    // the data goes to the driver as it is, so only the copy this engine
+    // wrote itself, not one from a pk3 or a game directory
+    long len = ri.FS_ReadPrivateFile(PIPELINE_CACHE_FILE, &pBuf);
+
+    if (pBuf != NULL)
+    {
+        pHeader = (const struct PipelineCacheHeader_t *)pBuf;
+
+        if ( (len < (long)sizeof(*pHeader)) || 
+             (pHeader->ident != expected.ident) ||
+             (pHeader->version != expected.version) ||
+             (pHeader->dataSize != len - sizeof(*pHeader)) )
+        {
+            ri.Printf(PRINT_WARNING, " %s is damaged, discarded. \n", PIPELINE_CACHE_FILE);
+            pHeader = NULL;
+        }
+        else if ( (pHeader->vendorID != expected.vendorID) ||
+                  (pHeader->deviceID != expected.deviceID) ||
+                  (pHeader->driverVersion != expected.driverVersion) ||
+                  memcmp(pHeader->pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) )
+        {
+            ri.Printf(PRINT_ALL, " %s was built by another device or driver, discarded. \n",
+                    PIPELINE_CACHE_FILE);
+            pHeader = NULL;
+        }
+    }
+
+    VkPipelineCacheCreateInfo desc;
+    desc.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    desc.pNext = NULL;
+    desc.flags = 0;
+    desc.initialDataSize = 0;
+    desc.pInitialData = NULL;
+
+    if (pHeader != NULL)
+    {
+        desc.initialDataSize = pHeader->dataSize;
+        desc.pInitialData = pHeader + 1;
+
+        s_plStats.coldCreated = pHeader->coldCreated;
+        s_plStats.coldUsec = pHeader->coldUsec;
+        s_plStats.warm = VK_TRUE;
+    }
+
+    // the driver validates the data again, if it still refuses it
+    // we fall back to an empty cache.
+    if ( qvkCreatePipelineCache(vk.device, &desc, NULL, &vk.pipeline_cache) != VK_SUCCESS )
+    {
+        desc.initialDataSize = 0;
+        desc.pInitialData = NULL;
+        memset(&s_plStats, 0, sizeof(s_plStats));
+
+        VK_CHECK( qvkCreatePipelineCache(vk.device, &desc, NULL, &vk.pipeline_cache) );
+    }
+
+    ri.Printf(PRINT_ALL, " Create pipeline cache: %d KB loaded from %s. \n",
+            (int)(desc.initialDataSize >> 10), PIPELINE_CACHE_FILE);
+
+    if (pBuf != NULL)
+    {
+        ri.Free(pBuf);
+    }
+}
+
+
+void vk_destroyPipelineCache(void)
+{
+    if (vk.pipeline_cache == VK_NULL_HANDLE)
+        return;
+
+    size_t dataSize = 0;
+    
+    if ( (qvkGetPipelineCacheData(vk.device, vk.pipeline_cache, &dataSize, NULL) == VK_SUCCESS) &&
+         (dataSize != 0) )
+    {
+        const size_t len = sizeof(struct PipelineCacheHeader_t) + dataSize;
+        struct PipelineCacheHeader_t * const pHeader = 
+            (struct PipelineCacheHeader_t *) ri.Malloc(len);
+
+        vk_fillPipelineCacheHeader(pHeader);
+
+        // the first run fills the cache, keep what compiling cost there
+        if (s_plStats.warm)
+        {
+            pHeader->coldCreated = s_plStats.coldCreated;
+            pHeader->coldUsec = s_plStats.coldUsec;
+        }
+        else
+        {
+            pHeader->coldCreated = s_plStats.created;
+            pHeader->coldUsec = s_plStats.usec;
+        }
+
+        if ( qvkGetPipelineCacheData(vk.device, vk.pipeline_cache, &dataSize, pHeader + 1) == VK_SUCCESS )
+        {
+            pHeader->dataSize = dataSize;
+            ri.FS_WritePrivateFile(PIPELINE_CACHE_FILE, pHeader, sizeof(*pHeader) + dataSize);
+
+            ri.Printf(PRINT_ALL, " Save pipeline cache: %d KB to %s. \n",
+                    (int)(dataSize >> 10), PIPELINE_CACHE_FILE);
+        }
+
+        ri.Free(pHeader);
+    }
+
+    ri.Printf(PRINT_ALL, " Destroy vk.pipeline_cache. \n");
+    NO_CHECK( qvkDestroyPipelineCache(vk.device, vk.pipeline_cache, NULL) );
+    vk.pipeline_cache = VK_NULL_HANDLE;
+}
+
 
 void vk_create_pipeline(
         uint32_t state_bits,
@@ -782,18 +976,22 @@ void vk_create_pipeline(
     // Graphics pipelines consist of multiple shader stages, 
     // multiple fixed-function pipeline stages, and a pipeline layout.
     // To create graphics pipelines
-    // VK_NULL_HANDLE indicating that pipeline caching is disabled; 
-    // TODO: provide the handle of a valid pipeline cache object, 
+    // vk.pipeline_cache lets the driver skip the shader compile when
+    // the same state was built before, in this run or a previous one.
     // 1 is the length of the pCreateInfos and pPipelines arrays.
     //
-    VK_CHECK( qvkCreateGraphicsPipelines(vk.device, VK_NULL_HANDLE, 1, &create_info, NULL, pPipeLine) );
+    const uint64_t start = R_GetTimeMicroSeconds();
+
+    VK_CHECK( qvkCreateGraphicsPipelines(vk.device, vk.pipeline_cache, 1, &create_info, NULL, pPipeLine) );
+
+    s_plStats.usec += R_GetTimeMicroSeconds() - start;
+    ++s_plStats.created;
 }
 
 
-void vk_create_shader_stage_pipelines(shaderStage_t *pStage, shader_t* pShader)
+static void vk_stageParmsKey(const shaderStage_t * const pStage,
+        const shader_t * const pShader, struct ParmsKey * const pKey)
 {
-    // ri.Printf(PRINT_ALL, " Create shader stage pipeline for %s. \n", pShader->name);
-    
     enum Vk_Shader_Type def_shader_type = ST_SINGLE_TEXTURE;
  
     if (pStage->bundle[1].image[0] == NULL)
@@ -805,21 +1003,64 @@ void vk_create_shader_stage_pipelines(shaderStage_t *pStage, shader_t* pShader)
     else
         ri.Error(ERR_FATAL, "Vulkan: could not create pipelines for q3 shader '%s'\n", pShader->name);
 
-    struct ParmsKey plPar;
+    pKey->state_bits = pStage->stateBits; 
+    pKey->face_culling = pShader->cullType;
+    pKey->shader_type = def_shader_type; 
+    pKey->polygon_offset = pShader->polygonOffset;
     
+    pKey->clipping_plane = VK_FALSE;
+    pKey->mirror = VK_FALSE;
+}
+
 
-    plPar.state_bits = pStage->stateBits; 
-    plPar.face_culling = pShader->cullType;
-    plPar.shader_type = def_shader_type; 
-    plPar.polygon_offset = pShader->polygonOffset;
+void vk_create_shader_stage_pipelines(shaderStage_t *pStage, shader_t* pShader)
+{
+    // ri.Printf(PRINT_ALL, " Create shader stage pipeline for %s. \n", pShader->name);
     
-    plPar.clipping_plane = VK_FALSE;
-    plPar.mirror = VK_FALSE;
+    struct ParmsKey plPar;
+
+    vk_stageParmsKey(pStage, pShader, &plPar);
+
     pStage->vk_pipeline = FindPipeline(&plPar);
 
-    plPar.clipping_plane = VK_TRUE;
-    pStage->vk_portal_pipeline = FindPipeline(&plPar);
+    // most maps never draw through a portal or a mirror, so those
+    // variants are left to vk_getPortalPipeline/vk_getMirrorPipeline
+    // and only created when a stage is first drawn that way.
+    pStage->vk_portal_pipeline = VK_NULL_HANDLE;
+    pStage->vk_mirror_pipeline = VK_NULL_HANDLE;
+}
+
+
+VkPipeline vk_getPortalPipeline(shaderStage_t * const pStage, const shader_t * const pShader)
+{
+    if (pStage->vk_portal_pipeline == VK_NULL_HANDLE)
+    {
+        struct ParmsKey plPar;
+
+        vk_stageParmsKey(pStage, pShader, &plPar);
+        plPar.clipping_plane = VK_TRUE;
+
+        pStage->vk_portal_pipeline = FindPipeline(&plPar);
+        ++s_plStats.onDemand;
+    }
+
+    return pStage->vk_portal_pipeline;
+}
+
+
+VkPipeline vk_getMirrorPipeline(shaderStage_t * const pStage, const shader_t * const pShader)
+{
+    if (pStage->vk_mirror_pipeline == VK_NULL_HANDLE)
+    {
+        struct ParmsKey plPar;
+
+        vk_stageParmsKey(pStage, pShader, &plPar);
+        plPar.clipping_plane = VK_TRUE;
+        plPar.mirror = VK_TRUE;
+
+        pStage->vk_mirror_pipeline = FindPipeline(&plPar);
+        ++s_plStats.onDemand;
+    }
 
-    plPar.mirror = VK_TRUE;    
-    pStage->vk_mirror_pipeline = FindPipeline(&plPar);
+    return pStage->vk_mirror_pipeline;
 }
@@ -49,12 +49,17 @@ void vk_createDebugPipelines(void);
 
 // create pipelines for each stage
 void vk_create_shader_stage_pipelines(shaderStage_t *pStage, shader_t* pShader);
+VkPipeline vk_getPortalPipeline(shaderStage_t * const pStage, const shader_t * const pShader);
+VkPipeline vk_getMirrorPipeline(shaderStage_t * const pStage, const shader_t * const pShader);
 void vk_destroyShaderStagePipeline(void);
 
 
 void vk_createPipelineLayout(VkDescriptorSetLayout desc_layout, VkPipelineLayout * const pPLayout);
 void vk_destroy_pipeline_layout(void);
 
+void vk_createPipelineCache(void);
+void vk_destroyPipelineCache(void);
+
 
 void vk_InitShaderStagePipeline(void);
 
@@ -5,6 +5,7 @@
 
 #include "R_ImageProcess.h"
 #include "ref_import.h"
+#include "tr_cmds.h"
 
 #define STB_IMAGE_WRITE_STATIC
 #define STB_IMAGE_WRITE_IMPLEMENTATION
@@ -179,6 +180,9 @@ static void imgFlipY(unsigned char * pBuf, const uint32_t w, const uint32_t h)
 // Just reading the pixels for the GPU MEM, don't care about swizzling
 static void vk_read_pixels(unsigned char* const pBuf, uint32_t W, uint32_t H)
 {
+	// the back end may still be recording into the frame we are about to read
+	R_SyncRenderThread();
+
 	// NO_CHECK( qvkDeviceWaitIdle(vk.device) );
 
 	// Create image in host visible memory to serve as a destination
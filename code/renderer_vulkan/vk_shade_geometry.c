@@ -65,6 +65,10 @@ static QALIGN(16) float s_ProjectMat2d[16];
 #define ST0_OFFSET          (COLOR_OFFSET + COLOR_SIZE)
 #define ST1_OFFSET          (ST0_OFFSET + ST0_SIZE)
 
+// size of the vertex data of one frame, both buffers hold one such
+// slice per frame in flight and a frame only writes into its own.
+#define VERTEX_BUFFER_SIZE  (XYZ_SIZE + COLOR_SIZE + ST0_SIZE + ST1_SIZE)
+
 struct ShadingData_t
 {
     // Buffers represent linear arrays of data which are used for various purposes
@@ -80,11 +84,25 @@ struct ShadingData_t
 	unsigned char* index_buffer_ptr; // pointer to mapped index buffer
 	uint32_t index_buffer_offset;
 
+    // start of the slice owned by the frame being recorded
+    VkDeviceSize vertex_base;
+    VkDeviceSize index_base;
+
 	// host visible memory that holds both vertex and index data
 	VkDeviceMemory vertex_buffer_memory;
 	VkDeviceMemory index_buffer_memory;
     VkDescriptorSet curDescriptorSets[2];
 
+    // positions and indexes of the world faces and triangle soups,
+    // uploaded once per map into device local memory.
+    VkBuffer static_xyz_buffer;
+    VkBuffer static_index_buffer;
+    VkDeviceMemory static_xyz_memory;
+    VkDeviceMemory static_index_memory;
+    // set when the batch being drawn lives in the static buffers,
+    // any streamed upload of positions clears it again.
+    VkBool32 static_batch;
+
     // This flag is used to decide whether framebuffer's depth attachment should be cleared
     // with vmCmdClearAttachment (dirty_depth_attachment == true), or it have just been
     // cleared by render pass instance clear op (dirty_depth_attachment == false).
@@ -153,7 +171,7 @@ void vk_createVertexBuffer(void)
 {
     ri.Printf(PRINT_ALL, " Create vertex buffer: shadingDat.vertex_buffer \n");
 
-    vk_createBufferResource( XYZ_SIZE + COLOR_SIZE + ST0_SIZE + ST1_SIZE, 
+    vk_createBufferResource( VERTEX_BUFFER_SIZE * vk.frames_in_flight, 
             VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, 
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
             &shadingDat.vertex_buffer,
@@ -171,7 +189,7 @@ void vk_createIndexBuffer(void)
 {
     ri.Printf(PRINT_ALL, " Create index buffer: shadingDat.index_buffer \n");
 
-    vk_createBufferResource( INDEX_BUFFER_SIZE, 
+    vk_createBufferResource( INDEX_BUFFER_SIZE * vk.frames_in_flight, 
             VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 
             &shadingDat.index_buffer, &shadingDat.index_buffer_memory);
@@ -310,8 +328,12 @@ static void vk_cmdInsertLoadingIndexBarrier(VkCommandBuffer HCmdBuffer)
 void vk_UploadXYZI(float (* const pXYZ)[4], uint32_t nVertex, 
         const uint32_t * const pIdx, uint32_t nIndex)
 {
+    shadingDat.static_batch = VK_FALSE;
+    backEnd.pc.c_uploadBytes += nVertex * sizeof(vec4_t) + nIndex * sizeof(uint32_t);
+
 	// xyz stream
-    const VkDeviceSize xyz_offset = XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
+    const VkDeviceSize xyz_offset = shadingDat.vertex_base + XYZ_OFFSET + 
+        shadingDat.xyz_elements * sizeof(vec4_t);
 
     // 4 float in the array, with each 4 bytes.
     memcpy(shadingDat.vertex_buffer_ptr + xyz_offset, pXYZ, nVertex * sizeof(vec4_t));
@@ -328,11 +350,12 @@ void vk_UploadXYZI(float (* const pXYZ)[4], uint32_t nVertex,
     if(nIndex != 0)
 	{
 		const uint32_t indexes_size = nIndex * sizeof(uint32_t);        
+        const VkDeviceSize idx_offset = shadingDat.index_base + shadingDat.index_buffer_offset;
 
-		memcpy( shadingDat.index_buffer_ptr + shadingDat.index_buffer_offset, pIdx, indexes_size);
+		memcpy( shadingDat.index_buffer_ptr + idx_offset, pIdx, indexes_size);
 
 		NO_CHECK( qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.index_buffer,
-                    shadingDat.index_buffer_offset, VK_INDEX_TYPE_UINT32) );
+                    idx_offset, VK_INDEX_TYPE_UINT32) );
 		
         shadingDat.index_buffer_offset += indexes_size;
 
@@ -454,6 +477,43 @@ void updateMVP(VkBool32 isPortal, VkBool32 is2D, const float mvMat4x4[16])
 }
 
 
+// Draw a batch whose positions and indexes are in the static buffers.
+// The stored indexes are global, so each run is drawn with a vertex
+// offset of -firstVert and its xyz binding starts at firstVert, the
+// vertex index the shader sees is then local to the run and picks
+// the colors and texcoords that were just streamed for it at tessVert.
+static void vk_drawStaticRuns(const struct shaderCommands_s * const pTess,
+        const VkDeviceSize offsetsArray[3], VkBool32 multitexture)
+{
+    const VkBuffer bufHandleArray[4] = { shadingDat.static_xyz_buffer,
+      shadingDat.vertex_buffer, shadingDat.vertex_buffer, shadingDat.vertex_buffer };
+
+    NO_CHECK( qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.static_index_buffer,
+                0, VK_INDEX_TYPE_UINT32) );
+
+    uint32_t i;
+    for (i = 0; i < pTess->numStaticRuns; ++i)
+    {
+        const struct staticRun_s * const pRun = &pTess->staticRuns[i];
+
+        const VkDeviceSize runOffsets[4] = {
+            pRun->firstVert * sizeof(vec4_t),
+            offsetsArray[0] + pRun->tessVert * 4,
+            offsetsArray[1] + pRun->tessVert * sizeof(vec2_t),
+            offsetsArray[2] + pRun->tessVert * sizeof(vec2_t)
+        };
+
+        NO_CHECK( qvkCmdBindVertexBuffers(vk.command_buffer, 0, multitexture ? 4 : 3,
+                    bufHandleArray, runOffsets) );
+
+        NO_CHECK( qvkCmdDrawIndexed(vk.command_buffer, pRun->numIndexes, 1,
+                    pRun->firstIndex, -(int32_t)pRun->firstVert, 0) );
+    }
+
+    backEnd.pc.c_staticDraws += pTess->numStaticRuns;
+}
+
+
 void vk_shade(VkPipeline pipeline, struct shaderCommands_s * const pTess,
         VkDescriptorSet* const pDesSet, VkBool32 multitexture, VkBool32 indexed)
 {
@@ -463,9 +523,9 @@ void vk_shade(VkPipeline pipeline, struct shaderCommands_s * const pTess,
     
 
     const VkDeviceSize offsetsArray[3] = {
-        COLOR_OFFSET + shadingDat.colorElemCount * 4, // sizeof(color4ub_t)
-        ST0_OFFSET   + shadingDat.colorElemCount * sizeof(vec2_t),
-        ST1_OFFSET   + shadingDat.colorElemCount * sizeof(vec2_t)
+        shadingDat.vertex_base + COLOR_OFFSET + shadingDat.colorElemCount * 4, // sizeof(color4ub_t)
+        shadingDat.vertex_base + ST0_OFFSET   + shadingDat.colorElemCount * sizeof(vec2_t),
+        shadingDat.vertex_base + ST1_OFFSET   + shadingDat.colorElemCount * sizeof(vec2_t)
     };
 
 
@@ -473,6 +533,7 @@ void vk_shade(VkPipeline pipeline, struct shaderCommands_s * const pTess,
     const uint32_t Size_ST =  pTess->numVertexes * sizeof(vec2_t);
 
     shadingDat.colorElemCount += pTess->numVertexes;
+    backEnd.pc.c_uploadBytes += Size_Color + Size_ST * (1 + multitexture);
     
     if ( shadingDat.colorElemCount * 4 > COLOR_SIZE)
     {
@@ -524,7 +585,11 @@ void vk_shade(VkPipeline pipeline, struct shaderCommands_s * const pTess,
 
     
     // issue draw call
-    if (indexed)
+    if (indexed && shadingDat.static_batch)
+    {
+        vk_drawStaticRuns(pTess, offsetsArray, multitexture);
+    }
+    else if (indexed)
     {
         NO_CHECK( qvkCmdDrawIndexed(vk.command_buffer,  pTess->numIndexes, 1, 0, 0, 0) );
     }
@@ -541,9 +606,13 @@ void vk_shade(VkPipeline pipeline, struct shaderCommands_s * const pTess,
 void vk_resetGeometryBuffer(void)
 {
 	// Reset geometry buffer's current offsets.
+    shadingDat.static_batch = VK_FALSE;
 	shadingDat.xyz_elements = 0;
 	shadingDat.colorElemCount = 0;
 	shadingDat.index_buffer_offset = 0;
+
+    shadingDat.vertex_base = (VkDeviceSize)vk.idx_frame * VERTEX_BUFFER_SIZE;
+    shadingDat.index_base = (VkDeviceSize)vk.idx_frame * INDEX_BUFFER_SIZE;
     
     s_depth_attachment_dirty = VK_FALSE;
 
@@ -551,8 +620,73 @@ void vk_resetGeometryBuffer(void)
 }
 
 
+void vk_createStaticGeometry(float (* const pXYZ)[4], uint32_t nVertex,
+        const uint32_t * const pIdx, uint32_t nIndex)
+{
+    const uint32_t xyz_size = nVertex * sizeof(vec4_t);
+    const uint32_t idx_size = nIndex * sizeof(uint32_t);
+
+    vk_destroyStaticGeometry();
+
+    ri.Printf(PRINT_ALL, " Create static world geometry: %d vertexes, %d indexes, %d KB. \n",
+            nVertex, nIndex, (xyz_size + idx_size) / 1024);
+
+    vk_createBufferResource( xyz_size,
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            &shadingDat.static_xyz_buffer, &shadingDat.static_xyz_memory );
+
+    vk_createBufferResource( idx_size,
+            VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            &shadingDat.static_index_buffer, &shadingDat.static_index_memory );
+
+    vk_uploadToDevLocalBuffer(shadingDat.static_xyz_buffer, pXYZ, xyz_size,
+            VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+    vk_uploadToDevLocalBuffer(shadingDat.static_index_buffer, pIdx, idx_size,
+            VK_ACCESS_INDEX_READ_BIT);
+}
+
+
+void vk_destroyStaticGeometry(void)
+{
+    // the caller makes sure the device is idle
+    shadingDat.static_batch = VK_FALSE;
+
+    if (shadingDat.static_xyz_buffer != VK_NULL_HANDLE)
+    {
+        ri.Printf(PRINT_ALL, " Destroy static world geometry. \n");
+
+        NO_CHECK( qvkDestroyBuffer(vk.device, shadingDat.static_xyz_buffer, NULL) );
+        NO_CHECK( qvkFreeMemory(vk.device, shadingDat.static_xyz_memory, NULL) );
+        shadingDat.static_xyz_buffer = VK_NULL_HANDLE;
+        shadingDat.static_xyz_memory = VK_NULL_HANDLE;
+    }
+
+    if (shadingDat.static_index_buffer != VK_NULL_HANDLE)
+    {
+        NO_CHECK( qvkDestroyBuffer(vk.device, shadingDat.static_index_buffer, NULL) );
+        NO_CHECK( qvkFreeMemory(vk.device, shadingDat.static_index_memory, NULL) );
+        shadingDat.static_index_buffer = VK_NULL_HANDLE;
+        shadingDat.static_index_memory = VK_NULL_HANDLE;
+    }
+}
+
+
+static VkBool32 vk_isStaticBatch(const struct shaderCommands_s * const pTess)
+{
+    return (shadingDat.static_xyz_buffer != VK_NULL_HANDLE) &&
+        (pTess->numStaticRuns != 0) &&
+        (pTess->numStaticVerts == (uint32_t)pTess->numVertexes) &&
+        (pTess->numStaticIndexes == (uint32_t)pTess->numIndexes) &&
+        (pTess->shader->numDeforms == 0) && !pTess->shader->isSky;
+}
+
+
 void vk_destroy_shading_data(void)
 {
+    vk_destroyStaticGeometry();
+
     ri.Printf(PRINT_ALL, " Destroy vertex/index buffer: shadingDat.vertex_buffer shadingDat.index_buffer. \n");
     ri.Printf(PRINT_ALL, " Free device memory: vertex_buffer_memory index_buffer_memory. \n");
 
@@ -781,7 +915,19 @@ void RB_StageIteratorGeneric(struct shaderCommands_s * const pTess, VkBool32 isP
     // call shader function
     //
 
-    vk_UploadXYZI(pTess->xyz, pTess->numVertexes, pTess->indexes, pTess->numIndexes);
+    // world faces and triangle soups whose positions are already in the
+    // static buffers only stream their colors and texcoords, anything
+    // else in the batch (grids, entities, deforms) sends it all as before.
+    if ( vk_isStaticBatch(pTess) )
+    {
+        shadingDat.static_batch = VK_TRUE;
+        backEnd.pc.c_staticBytes += pTess->numVertexes * sizeof(vec4_t) + 
+            pTess->numIndexes * sizeof(uint32_t);
+    }
+    else
+    {
+        vk_UploadXYZI(pTess->xyz, pTess->numVertexes, pTess->indexes, pTess->numIndexes);
+    }
     
     updateMVP(isPortal, is2D, getptr_modelview_matrix() );
 
@@ -849,11 +995,11 @@ void RB_StageIteratorGeneric(struct shaderCommands_s * const pTess, VkBool32 isP
 
         if (backEnd.viewParms.isMirror)
         {
-            vk_shade(pCurShader->vk_mirror_pipeline, pTess, shadingDat.curDescriptorSets, multitexture, VK_TRUE);
+            vk_shade(vk_getMirrorPipeline(pCurShader, pTess->shader), pTess, shadingDat.curDescriptorSets, multitexture, VK_TRUE);
         }
         else if (isPortal)
         {
-            vk_shade(pCurShader->vk_portal_pipeline, pTess, shadingDat.curDescriptorSets, multitexture, VK_TRUE);
+            vk_shade(vk_getPortalPipeline(pCurShader, pTess->shader), pTess, shadingDat.curDescriptorSets, multitexture, VK_TRUE);
         }
         else
         {
@@ -36,6 +36,10 @@ VkBuffer vk_getVertexBuffer(void);
 
 void vk_destroy_shading_data(void);
 
+void vk_createStaticGeometry(float (* const pXYZ)[4], uint32_t nVertex,
+        const uint32_t * const pIdx, uint32_t nIndex);
+void vk_destroyStaticGeometry(void);
+
 void vk_rcdUpdateViewport(VkBool32 is2D, enum Vk_Depth_Range depRg);
 
 void vk_clearDepthStencilAttachments(void);
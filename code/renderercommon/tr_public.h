@@ -24,7 +24,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "tr_types.h"
 
-#define REF_API_VERSION         8
+#define REF_API_VERSION         9
+
+// opaque, see sys_public.h
+struct sysThread_s;
+struct sysSemaphore_s;
 
 //
 // these are the functions exported by the refresh module
@@ -149,6 +153,10 @@ typedef struct {
 	void	(*FS_FreeFileList)( char **filelist );
 	void	(*FS_WriteFile)( const char *qpath, const void *buffer, int size );
 	qboolean (*FS_FileExists)( const char *file );
+	// engine owned files directly in the home directory, never from a pk3
+	// or a directory a VM can write to, free the buffer with Free
+	long	(*FS_ReadPrivateFile)( const char *name, void **ppBuf );
+	void	(*FS_WritePrivateFile)( const char *name, const void *buffer, int size );
 
 	// cinematic stuff
 	void	(*CIN_UploadCinematic)(int handle);
@@ -179,6 +187,14 @@ typedef struct {
 	// void (* Sys_GLimpSafeInit)(void);
 	// void (* Sys_GLimpInit)(void);
 	qboolean (* Sys_LowPhysicalMemory)(void);
+
+	// threads, for a renderer that runs its back end on its own thread
+	struct sysThread_s * (* Sys_CreateThread)( void (*func)( void *arg ), void *arg );
+	void (* Sys_JoinThread)( struct sysThread_s *thread );
+	struct sysSemaphore_s * (* Sys_CreateSemaphore)( int count );
+	void (* Sys_DestroySemaphore)( struct sysSemaphore_s *sem );
+	void (* Sys_SemaphoreWait)( struct sysSemaphore_s *sem );
+	void (* Sys_SemaphorePost)( struct sysSemaphore_s *sem, int count );
 } refimport_t;
 
 
@@ -49,17 +49,26 @@ typedef struct voipServerPacket_s
 #endif
 
 typedef struct svEntity_s {
-	struct worldSector_s *worldSector;
-	struct svEntity_s *nextEntityInWorldSector;
-	
 	entityState_t	baseline;		// for delta compression of initial sighting
 	int			numClusters;		// if -1, use headnode instead
 	int			clusternums[MAX_ENT_CLUSTERS];
 	int			lastCluster;		// if all the clusters don't fit in clusternums
 	int			areanum, areanum2;
-	int			snapshotCounter;	// used to prevent double adding from portal views
 } svEntity_t;
 
+// the parts of every entity that snapshot culling tests, as parallel
+// arrays refreshed by SV_LinkEntity, so the per client loop reads only
+// a few words per entity instead of svEntity_t and the game entity
+typedef struct {
+	uint64_t	linked[MAX_GENTITIES/64];		// entities linked into the world
+	int			areanum[MAX_GENTITIES];
+	int			areanum2[MAX_GENTITIES];
+	int			numClusterWords[MAX_GENTITIES];	// 64 bit words of a pvs row touched
+	int			clusterWord[MAX_GENTITIES][MAX_ENT_CLUSTERS];
+	uint64_t	clusterMask[MAX_GENTITIES][MAX_ENT_CLUSTERS];
+	byte		clustersOverflowed[MAX_GENTITIES];	// lastCluster must be scanned as well
+} svEntityVis_t;
+
 typedef enum {
 	SS_DEAD,			// no map loaded
 	SS_LOADING,			// spawning level entities
@@ -75,11 +84,11 @@ typedef struct {
 	// https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=475
 	// the serverId associated with the current checksumFeed (always <= serverId)
 	int       checksumFeedServerId;	
-	int				snapshotCounter;	// incremented for each snapshot built
 	int				timeResidual;		// <= 1000 / sv_frame->value
 	int				nextFrameTime;		// when time > nextFrameTime, process world
 	char			*configstrings[MAX_CONFIGSTRINGS];
 	svEntity_t		svEntities[MAX_GENTITIES];
+	svEntityVis_t	entityVis;
 
 	char			*entityParsePoint;	// used during game VM init
 
@@ -130,6 +139,18 @@ typedef struct netchan_buffer_s {
 	struct netchan_buffer_s *next;
 } netchan_buffer_t;
 
+#define DOWNLOAD_BLKSIZE_MIN	1024	// download blocks shrink to this after a resend
+#define DOWNLOAD_BLKSIZE_MAX	8192	// and grow to this, clients take blocks up to MAX_MSGLEN
+
+// a file being downloaded, shared by every client downloading it
+typedef struct svDownload_s {
+	char			name[MAX_QPATH];
+	fileHandle_t	file;
+	int				size;
+	int				refCount;
+	struct svDownload_s	*next;
+} svDownload_t;
+
 typedef struct client_s {
 	clientState_t	state;
 	char			userinfo[MAX_INFO_STRING];		// name, etc
@@ -152,14 +173,16 @@ typedef struct client_s {
 
 	// downloading
 	char			downloadName[MAX_QPATH]; // if not empty string, we are downloading
-	fileHandle_t	download;			// file being downloaded
+	svDownload_t	*download;			// file being downloaded
  	int				downloadSize;		// total bytes (can't use EOF because of paks)
  	int				downloadCount;		// bytes sent
 	int				downloadClientBlock;	// last block we sent to the client, awaiting ack
 	int				downloadCurrentBlock;	// current block number
 	int				downloadXmitBlock;	// last block we xmited
-	unsigned char	*downloadBlocks[MAX_DOWNLOAD_WINDOW];	// the buffers for the download blocks
+	int				downloadBlockOffset[MAX_DOWNLOAD_WINDOW];	// where the download blocks start in the file
 	int				downloadBlockSize[MAX_DOWNLOAD_WINDOW];
+	int				downloadBlockLen;	// size of the blocks read next
+	int				downloadAcks;		// blocks acknowledged since the block size last changed
 	qboolean		downloadEOF;		// We have sent the EOF block
 	int				downloadSendTime;	// time we last got an ack from the client
 
@@ -290,6 +313,7 @@ extern	cvar_t	*sv_dorestart;
 extern	cvar_t	*sv_pure;
 extern	cvar_t	*sv_floodProtect;
 extern	cvar_t	*sv_lanForceRate;
+extern	cvar_t	*sv_snapshotThreads;
 #ifndef STANDALONE
 extern	cvar_t	*sv_strictAuth;
 #endif
@@ -382,7 +406,7 @@ void SV_ExecuteClientCommand( client_t *cl, const char *s, qboolean clientOK );
 void SV_ClientThink (client_t *cl, usercmd_t *cmd);
 
 int SV_WriteDownloadToClient(client_t *cl , msg_t *msg);
-int SV_SendDownloadMessages(void);
+int SV_SendDownloadMessages(int maxBytes);
 int SV_SendQueuedMessages(void);
 
 
@@ -400,6 +424,7 @@ void SV_WriteFrameToClient (client_t *client, msg_t *msg);
 void SV_SendMessageToClient( msg_t *msg, client_t *client );
 void SV_SendClientMessages( void );
 void SV_SendClientSnapshot( client_t *client );
+void SV_ShutdownSnapshotJobs( void );
 
 //
 // sv_game.c
@@ -456,6 +481,7 @@ clipHandle_t SV_ClipHandleForEntity( const sharedEntity_t *ent );
 
 
 void SV_SectorList_f( void );
+void SV_WorldBench_f( void );
 
 
 int SV_AreaEntities( const vec3_t mins, const vec3_t maxs, int *entityList, int maxcount );
@@ -482,6 +508,9 @@ void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, c
 
 // passEntityNum is explicitly excluded from clipping checks (normally ENTITYNUM_NONE)
 
+void SV_TraceBatch( const traceRequest_t *requests, trace_t *results, int count );
+// same as SV_Trace on each request, overlapping moves share the entity gathering
+
 
 void SV_ClipToEntity( trace_t *trace, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int entityNum, int contentmask, int capsule );
 // clip to a specific entity
@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "server.h"
 #include "../botlib/botlib.h"
+#include "../platform/sys_public.h"
 
 typedef struct bot_debugpoly_s
 {
@@ -311,6 +312,59 @@ static void *BotImport_HunkAlloc( int size ) {
 	return Hunk_Alloc( size, h_high );
 }
 
+/*
+=================
+BotImport_CreateThread
+=================
+*/
+static void *BotImport_CreateThread( void (*func)( void *arg ), void *arg ) {
+	return Sys_CreateThread( func, arg );
+}
+
+/*
+=================
+BotImport_JoinThread
+=================
+*/
+static void BotImport_JoinThread( void *thread ) {
+	Sys_JoinThread( (sysThread_t *)thread );
+}
+
+/*
+=================
+BotImport_CreateSemaphore
+=================
+*/
+static void *BotImport_CreateSemaphore( int count ) {
+	return Sys_CreateSemaphore( count );
+}
+
+/*
+=================
+BotImport_DestroySemaphore
+=================
+*/
+static void BotImport_DestroySemaphore( void *sem ) {
+	Sys_DestroySemaphore( (sysSemaphore_t *)sem );
+}
+
+/*
+=================
+BotImport_SemaphoreWait
+=================
+*/
+static void BotImport_SemaphoreWait( void *sem ) {
+	Sys_SemaphoreWait( (sysSemaphore_t *)sem );
+}
+
+/*
+=================
+BotImport_SemaphorePost
+=================
+*/
+static void BotImport_SemaphorePost( void *sem, int count ) {
+	Sys_SemaphorePost( (sysSemaphore_t *)sem, count );
+}
 
 int BotImport_DebugPolygonCreate(int color, int numPoints, vec3_t *points)
 {
@@ -431,7 +485,7 @@ void SV_BotFrame( int time ) {
 	if (!bot_enable) return;
 	//NOTE: maybe the game is already shutdown
 	if (!gvm) return;
-	VM_Call( gvm, BOTAI_START_FRAME, time );
+	VM_Call1( gvm, BOTAI_START_FRAME, time );
 }
 
 /*
@@ -450,6 +504,8 @@ int SV_BotLibSetup( void ) {
 	}
 
 	botlib_export->BotLibVarSet( "basegame", com_basegame->string );
+	botlib_export->BotLibVarSet( "routetables", Cvar_VariableString( "bot_routetables" ) );
+	botlib_export->BotLibVarSet( "warmroutingcache", Cvar_VariableString( "bot_warmroutingcache" ) );
 
 	return botlib_export->BotLibSetup();
 }
@@ -490,6 +546,8 @@ void SV_BotInitCvars(void) {
 	Cvar_Get("bot_forcewrite", "0", 0);					//force writing aas file
 	Cvar_Get("bot_aasoptimize", "0", 0);				//no aas file optimisation
 	Cvar_Get("bot_saveroutingcache", "0", 0);			//save routing cache
+	Cvar_Get("bot_routetables", "0", 0);				//all pairs routing tables on map load
+	Cvar_Get("bot_warmroutingcache", "1", 0);			//build routing cache in a background thread
 	Cvar_Get("bot_thinktime", "100", CVAR_CHEAT);		//msec the bots thinks
 	Cvar_Get("bot_reloadcharacters", "0", 0);			//reload the bot characters each time
 	Cvar_Get("bot_testichat", "0", 0);					//test ichats
@@ -537,6 +595,15 @@ void SV_BotInitBotLib(void) {
 	botlib_import.AvailableMemory = Z_AvailableMemory;
 	botlib_import.HunkAlloc = BotImport_HunkAlloc;
 
+	//background threads
+	botlib_import.CreateThread = BotImport_CreateThread;
+	botlib_import.JoinThread = BotImport_JoinThread;
+	botlib_import.CreateSemaphore = BotImport_CreateSemaphore;
+	botlib_import.DestroySemaphore = BotImport_DestroySemaphore;
+	botlib_import.SemaphoreWait = BotImport_SemaphoreWait;
+	botlib_import.SemaphorePost = BotImport_SemaphorePost;
+	botlib_import.AtomicAdd = Sys_AtomicAdd;
+
 	// file system access
 	botlib_import.FS_FOpenFile = FS_FOpenFileByMode;
 	botlib_import.FS_Read = FS_Read;
@@ -559,7 +559,7 @@ gotnewcl:
 	Q_strncpyz( newcl->userinfo, userinfo, sizeof(newcl->userinfo) );
 
 	// get the game a chance to reject this connection or modify the userinfo
-	denied = VM_Call( gvm, GAME_CLIENT_CONNECT, clientNum, qtrue, qfalse ); // firstTime = qtrue
+	denied = VM_Call3( gvm, GAME_CLIENT_CONNECT, clientNum, qtrue, qfalse ); // firstTime = qtrue
 	if ( denied ) {
 		// we can't just use VM_ArgPtr, because that is only valid inside a VM_Call
 		char *str = VM_ExplicitArgPtr( gvm, denied );
@@ -665,7 +665,7 @@ void SV_DropClient( client_t *drop, const char *reason ) {
 
 	// call the prog function for removing a client
 	// this will remove the body, among other things
-	VM_Call( gvm, GAME_CLIENT_DISCONNECT, drop - svs.clients );
+	VM_Call1( gvm, GAME_CLIENT_DISCONNECT, drop - svs.clients );
 
 	// add the disconnect command
 	SV_SendServerCommand( drop, "disconnect \"%s\"", reason);
@@ -806,7 +806,7 @@ void SV_ClientEnterWorld( client_t *client, usercmd_t *cmd ) {
 		memset(&client->lastUsercmd, '\0', sizeof(client->lastUsercmd));
 
 	// call the game begin function
-	VM_Call( gvm, GAME_CLIENT_BEGIN, client - svs.clients );
+	VM_Call1( gvm, GAME_CLIENT_BEGIN, client - svs.clients );
 }
 
 /*
@@ -817,6 +817,81 @@ CLIENT COMMAND EXECUTION
 ============================================================
 */
 
+static svDownload_t	*sv_downloads;	// files being downloaded by any client
+
+/*
+==================
+SV_OpenDownloadFile
+
+Returns the download of filename other clients are already on, or opens
+the file for a new one.  NULL if the file can't be found
+==================
+*/
+static svDownload_t *SV_OpenDownloadFile( const char *filename ) {
+	svDownload_t	*dl;
+	fileHandle_t	f;
+	int				size;
+
+	for ( dl = sv_downloads; dl; dl = dl->next ) {
+		if ( !strcmp( dl->name, filename ) ) {
+			dl->refCount++;
+			return dl;
+		}
+	}
+
+	// not mapped, a pk3 replaced or truncated while it is being
+	// downloaded must only give a short read
+	size = FS_SV_FOpenFileRead( filename, &f );
+	if ( size < 0 || !f ) {
+		return NULL;
+	}
+
+	dl = Z_Malloc( sizeof( *dl ) );
+	Q_strncpyz( dl->name, filename, sizeof( dl->name ) );
+	dl->file = f;
+	dl->size = size;
+	dl->refCount = 1;
+	dl->next = sv_downloads;
+	sv_downloads = dl;
+
+	return dl;
+}
+
+/*
+==================
+SV_ReleaseDownloadFile
+==================
+*/
+static void SV_ReleaseDownloadFile( svDownload_t *dl ) {
+	svDownload_t	**prev;
+
+	if ( --dl->refCount > 0 ) {
+		return;
+	}
+
+	for ( prev = &sv_downloads; *prev != dl; prev = &(*prev)->next ) {
+	}
+	*prev = dl->next;
+
+	FS_FCloseFile( dl->file );
+	Z_Free( dl );
+}
+
+/*
+==================
+SV_DownloadData
+
+Reads length bytes of the download starting at offset into buffer.
+Returns qfalse on a short read, the file was truncated or replaced
+while it is being downloaded.
+==================
+*/
+static qboolean SV_DownloadData( svDownload_t *dl, int offset, int length, byte *buffer ) {
+	FS_Seek( dl->file, offset, FS_SEEK_SET );
+
+	return FS_Read( buffer, length, dl->file ) == length;
+}
+
 /*
 ==================
 SV_CloseDownload
@@ -825,23 +900,12 @@ clear/free any download vars
 ==================
 */
 static void SV_CloseDownload( client_t *cl ) {
-	int i;
-
 	// EOF
 	if (cl->download) {
-		FS_FCloseFile( cl->download );
+		SV_ReleaseDownloadFile( cl->download );
 	}
-	cl->download = 0;
+	cl->download = NULL;
 	*cl->downloadName = 0;
-
-	// Free the temporary buffer space
-	for (i = 0; i < MAX_DOWNLOAD_WINDOW; i++) {
-		if (cl->downloadBlocks[i]) {
-			Z_Free(cl->downloadBlocks[i]);
-			cl->downloadBlocks[i] = NULL;
-		}
-	}
-
 }
 
 /*
@@ -896,6 +960,12 @@ static void SV_NextDownload_f( client_t *cl )
 			return;
 		}
 
+		// grow the blocks while whole windows get through without resends
+		if (++cl->downloadAcks >= MAX_DOWNLOAD_WINDOW && cl->downloadBlockLen < DOWNLOAD_BLKSIZE_MAX) {
+			cl->downloadBlockLen *= 2;
+			cl->downloadAcks = 0;
+		}
+
 		cl->downloadSendTime = svs.time;
 		cl->downloadClientBlock++;
 		return;
@@ -926,7 +996,7 @@ static void SV_BeginDownload_f( client_t *cl ) {
 SV_WriteDownloadToClient
 
 Check to see if the client wants a file, open it if needed and start pumping the client
-Fill up msg with data, return number of download blocks added
+Fill up msg with data, return number of bytes added
 ==================
 */
 int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
@@ -936,6 +1006,8 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 	char errorMessage[1024];
 	char pakbuf[MAX_QPATH], *pakptr;
 	int numRefPaks;
+	int start = msg->cursize;
+	byte buffer[DOWNLOAD_BLKSIZE_MAX];
 
 	if (!*cl->downloadName)
 		return 0;	// Nothing being downloaded
@@ -985,13 +1057,13 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 			}
 		}
 
-		cl->download = 0;
+		cl->download = NULL;
 
 		// We open the file here
 		if ( !(sv_allowDownload->integer & DLF_ENABLE) ||
 			(sv_allowDownload->integer & DLF_NO_UDP) ||
 			idPack || unreferenced ||
-			( cl->downloadSize = FS_SV_FOpenFileRead( cl->downloadName, &cl->download ) ) < 0 ) {
+			!( cl->download = SV_OpenDownloadFile( cl->downloadName ) ) ) {
 			// cannot auto-download file
 			if(unreferenced)
 			{
@@ -1040,35 +1112,33 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 			*cl->downloadName = 0;
 			
 			if(cl->download)
-				FS_FCloseFile(cl->download);
+				SV_ReleaseDownloadFile(cl->download);
+			cl->download = NULL;
 			
-			return 1;
+			return msg->cursize - start;
 		}
  
 		Com_Printf( "clientDownload: %d : beginning \"%s\"\n", (int) (cl - svs.clients), cl->downloadName );
 		
 		// Init
+		cl->downloadSize = cl->download->size;
 		cl->downloadCurrentBlock = cl->downloadClientBlock = cl->downloadXmitBlock = 0;
 		cl->downloadCount = 0;
 		cl->downloadEOF = qfalse;
+		cl->downloadBlockLen = MAX_DOWNLOAD_BLKSIZE;
+		cl->downloadAcks = 0;
 	}
 
-	// Perform any reads that we need to
+	// Lay out the blocks of the window, the data stays in the shared file
 	while (cl->downloadCurrentBlock - cl->downloadClientBlock < MAX_DOWNLOAD_WINDOW &&
 		cl->downloadSize != cl->downloadCount) {
 
 		curindex = (cl->downloadCurrentBlock % MAX_DOWNLOAD_WINDOW);
 
-		if (!cl->downloadBlocks[curindex])
-			cl->downloadBlocks[curindex] = Z_Malloc(MAX_DOWNLOAD_BLKSIZE);
-
-		cl->downloadBlockSize[curindex] = FS_Read( cl->downloadBlocks[curindex], MAX_DOWNLOAD_BLKSIZE, cl->download );
-
-		if (cl->downloadBlockSize[curindex] < 0) {
-			// EOF right now
-			cl->downloadCount = cl->downloadSize;
-			break;
-		}
+		cl->downloadBlockOffset[curindex] = cl->downloadCount;
+		cl->downloadBlockSize[curindex] = cl->downloadSize - cl->downloadCount;
+		if (cl->downloadBlockSize[curindex] > cl->downloadBlockLen)
+			cl->downloadBlockSize[curindex] = cl->downloadBlockLen;
 
 		cl->downloadCount += cl->downloadBlockSize[curindex];
 
@@ -1096,7 +1166,15 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 	{
 		// We have transmitted the complete window, should we start resending?
 		if (svs.time - cl->downloadSendTime > 1000)
+		{
 			cl->downloadXmitBlock = cl->downloadClientBlock;
+
+			// a lost fragment costs the whole block, use smaller ones
+			cl->downloadBlockLen /= 2;
+			if (cl->downloadBlockLen < DOWNLOAD_BLKSIZE_MIN)
+				cl->downloadBlockLen = DOWNLOAD_BLKSIZE_MIN;
+			cl->downloadAcks = 0;
+		}
 		else
 			return 0;
 	}
@@ -1104,6 +1182,34 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 	// Send current block
 	curindex = (cl->downloadXmitBlock % MAX_DOWNLOAD_WINDOW);
 
+	// Read it first, a client must not end up with a corrupt file
+	if(cl->downloadBlockSize[curindex] &&
+		!SV_DownloadData(cl->download, cl->downloadBlockOffset[curindex], cl->downloadBlockSize[curindex], buffer))
+	{
+		Com_Printf("clientDownload: %d : \"%s\" changed on the server\n", (int) (cl - svs.clients), cl->downloadName);
+
+		if(cl->downloadXmitBlock == 0)
+		{
+			// the client still parses an error in place of block zero
+			Com_sprintf(errorMessage, sizeof(errorMessage), "File \"%s\" changed on the server during the download.\n", cl->downloadName);
+
+			MSG_WriteByte( msg, svc_download );
+			MSG_WriteShort( msg, 0 ); // client is expecting block zero
+			MSG_WriteLong( msg, -1 ); // illegal file size
+			MSG_WriteString( msg, errorMessage );
+
+			SV_CloseDownload( cl );
+
+			return msg->cursize - start;
+		}
+
+		// too late for that, the client can only be dropped,
+		// which closes the download
+		SV_DropClient( cl, "download failed, file changed on the server" );
+
+		return 0;
+	}
+
 	MSG_WriteByte( msg, svc_download );
 	MSG_WriteShort( msg, cl->downloadXmitBlock );
 
@@ -1115,7 +1221,7 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 
 	// Write the block
 	if(cl->downloadBlockSize[curindex])
-		MSG_WriteData(msg, cl->downloadBlocks[curindex], cl->downloadBlockSize[curindex]);
+		MSG_WriteData(msg, buffer, cl->downloadBlockSize[curindex]);
 
 	Com_DPrintf( "clientDownload: %d : writing block %d\n", (int) (cl - svs.clients), cl->downloadXmitBlock );
 
@@ -1124,7 +1230,7 @@ int SV_WriteDownloadToClient(client_t *cl, msg_t *msg)
 	cl->downloadXmitBlock++;
 	cl->downloadSendTime = svs.time;
 
-	return 1;
+	return msg->cursize - start;
 }
 
 /*
@@ -1165,38 +1271,45 @@ int SV_SendQueuedMessages(void)
 ==================
 SV_SendDownloadMessages
 
-Send one round of download messages to all clients
+Send rounds of download messages to all clients until maxBytes went
+out or there is nothing left to send, at least one round.
+Return the number of bytes sent
 ==================
 */
 
-int SV_SendDownloadMessages(void)
+int SV_SendDownloadMessages(int maxBytes)
 {
-	int i, numDLs = 0, retval;
+	int i, numBytes = 0, roundStart, retval;
 	client_t *cl;
 	msg_t msg;
 	byte msgBuffer[MAX_MSGLEN];
 	
-	for(i=0; i < sv_maxclients->integer; i++)
+	do
 	{
-		cl = &svs.clients[i];
-		
-		if(cl->state && *cl->downloadName)
+		roundStart = numBytes;
+
+		for(i=0; i < sv_maxclients->integer; i++)
 		{
-			MSG_Init(&msg, msgBuffer, sizeof(msgBuffer));
-			MSG_WriteLong(&msg, cl->lastClientCommand);
+			cl = &svs.clients[i];
 			
-			retval = SV_WriteDownloadToClient(cl, &msg);
-				
-			if(retval)
+			if(cl->state && *cl->downloadName)
 			{
-				MSG_WriteByte(&msg, svc_EOF);
-				SV_Netchan_Transmit(cl, &msg);
-				numDLs += retval;
+				MSG_Init(&msg, msgBuffer, sizeof(msgBuffer));
+				MSG_WriteLong(&msg, cl->lastClientCommand);
+				
+				retval = SV_WriteDownloadToClient(cl, &msg);
+					
+				if(retval)
+				{
+					MSG_WriteByte(&msg, svc_EOF);
+					SV_Netchan_Transmit(cl, &msg);
+					numBytes += retval;
+				}
 			}
 		}
-	}
+	} while(numBytes > roundStart && numBytes < maxBytes);
 
-	return numDLs;
+	return numBytes;
 }
 
 /*
@@ -1495,7 +1608,7 @@ static void SV_UpdateUserinfo_f( client_t *cl ) {
 
 	SV_UserinfoChanged( cl );
 	// call prog code to allow overrides
-	VM_Call( gvm, GAME_CLIENT_USERINFO_CHANGED, cl - svs.clients );
+	VM_Call1( gvm, GAME_CLIENT_USERINFO_CHANGED, cl - svs.clients );
 }
 
 
@@ -1580,7 +1693,7 @@ void SV_ExecuteClientCommand( client_t *cl, const char *s, qboolean clientOK ) {
 		if (!u->name && sv.state == SS_GAME && (cl->state == CS_ACTIVE || cl->state == CS_PRIMED)) {
 			if(strcmp(Cmd_Argv(0), "say") && strcmp(Cmd_Argv(0), "say_team") )
 				Cmd_Args_Sanitize(); //remove \n, \r and ; from string. We don't do that for say-commands because it makes people mad (understandebly)
-			VM_Call( gvm, GAME_CLIENT_COMMAND, cl - svs.clients );
+			VM_Call1( gvm, GAME_CLIENT_COMMAND, cl - svs.clients );
 		}
 	}
 	else if (!bProcessed)
@@ -1660,7 +1773,7 @@ void SV_ClientThink (client_t *cl, usercmd_t *cmd) {
 		return;		// may have been kicked during the last usercmd
 	}
 
-	VM_Call( gvm, GAME_CLIENT_THINK, cl - svs.clients );
+	VM_Call1( gvm, GAME_CLIENT_THINK, cl - svs.clients );
 }
 
 /*
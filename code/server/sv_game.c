@@ -289,11 +289,146 @@ static void qsnapvectorsse(vec3_t vec)
 	vec[2] = (int) vec[2];
 }
 
+/*
+====================
+Game syscall table
+
+The traps the game makes many times a frame, VM_SystemCall calls these
+directly instead of going through the switch in SV_GameSystemCalls
+====================
+*/
+static intptr_t SV_GameLinkEntity( intptr_t *args ) {
+	SV_LinkEntity( VMA(1) );
+	return 0;
+}
+
+static intptr_t SV_GameUnlinkEntity( intptr_t *args ) {
+	SV_UnlinkEntity( VMA(1) );
+	return 0;
+}
+
+static intptr_t SV_GameEntitiesInBox( intptr_t *args ) {
+	return SV_AreaEntities( VMA(1), VMA(2), VMA(3), args[4] );
+}
+
+static intptr_t SV_GameEntityContact( intptr_t *args ) {
+	return SV_EntityContact( VMA(1), VMA(2), VMA(3), /*int capsule*/ qfalse );
+}
+
+static intptr_t SV_GameTrace( intptr_t *args ) {
+	SV_Trace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse );
+	return 0;
+}
+
+static intptr_t SV_GameTraceCapsule( intptr_t *args ) {
+	SV_Trace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qtrue );
+	return 0;
+}
+
+static intptr_t SV_GameTraceBatch( intptr_t *args ) {
+	SV_TraceBatch( VMA(1), VMA(2), args[3] );
+	return 0;
+}
+
+static intptr_t SV_GamePointContents( intptr_t *args ) {
+	return SV_PointContents( VMA(1), args[2] );
+}
+
+static intptr_t SV_GameInPVS( intptr_t *args ) {
+	return SV_inPVS( VMA(1), VMA(2) );
+}
+
+static intptr_t SV_GameGetUsercmd( intptr_t *args ) {
+	SV_GetUsercmd( args[1], VMA(2) );
+	return 0;
+}
+
+static intptr_t SV_GameMemset( intptr_t *args ) {
+	memset( VMA(1), args[2], args[3] );
+	return 0;
+}
+
+static intptr_t SV_GameMemcpy( intptr_t *args ) {
+	memcpy( VMA(1), VMA(2), args[3] );
+	return 0;
+}
+
+static intptr_t SV_GameStrncpy( intptr_t *args ) {
+	strncpy( VMA(1), VMA(2), args[3] );
+	return args[1];
+}
+
+static intptr_t SV_GameSin( intptr_t *args ) {
+	return FloatAsInt( sin( VMF(1) ) );
+}
+
+static intptr_t SV_GameCos( intptr_t *args ) {
+	return FloatAsInt( cos( VMF(1) ) );
+}
+
+static intptr_t SV_GameAtan2( intptr_t *args ) {
+	return FloatAsInt( atan2( VMF(1), VMF(2) ) );
+}
+
+static intptr_t SV_GameSqrt( intptr_t *args ) {
+	return FloatAsInt( sqrt( VMF(1) ) );
+}
+
+static intptr_t SV_GameMatrixMultiply( intptr_t *args ) {
+	MatrixMultiply( VMA(1), VMA(2), VMA(3) );
+	return 0;
+}
+
+static intptr_t SV_GameAngleVectors( intptr_t *args ) {
+	AngleVectors( VMA(1), VMA(2), VMA(3), VMA(4) );
+	return 0;
+}
+
+static intptr_t SV_GamePerpendicularVector( intptr_t *args ) {
+	PerpendicularVector( VMA(1), VMA(2) );
+	return 0;
+}
+
+static intptr_t SV_GameFloor( intptr_t *args ) {
+	return FloatAsInt( floor( VMF(1) ) );
+}
+
+static intptr_t SV_GameCeil( intptr_t *args ) {
+	return FloatAsInt( ceil( VMF(1) ) );
+}
+
+static const vmSyscall_t sv_gameSyscalls[TRAP_CEIL + 1] = {
+	[G_LINKENTITY]				= SV_GameLinkEntity,
+	[G_UNLINKENTITY]			= SV_GameUnlinkEntity,
+	[G_ENTITIES_IN_BOX]			= SV_GameEntitiesInBox,
+	[G_ENTITY_CONTACT]			= SV_GameEntityContact,
+	[G_TRACE]					= SV_GameTrace,
+	[G_TRACECAPSULE]			= SV_GameTraceCapsule,
+	[G_TRACE_BATCH]				= SV_GameTraceBatch,
+	[G_POINT_CONTENTS]			= SV_GamePointContents,
+	[G_IN_PVS]					= SV_GameInPVS,
+	[G_GET_USERCMD]				= SV_GameGetUsercmd,
+
+	[TRAP_MEMSET]				= SV_GameMemset,
+	[TRAP_MEMCPY]				= SV_GameMemcpy,
+	[TRAP_STRNCPY]				= SV_GameStrncpy,
+	[TRAP_SIN]					= SV_GameSin,
+	[TRAP_COS]					= SV_GameCos,
+	[TRAP_ATAN2]				= SV_GameAtan2,
+	[TRAP_SQRT]					= SV_GameSqrt,
+	[TRAP_MATRIXMULTIPLY]		= SV_GameMatrixMultiply,
+	[TRAP_ANGLEVECTORS]			= SV_GameAngleVectors,
+	[TRAP_PERPENDICULARVECTOR]	= SV_GamePerpendicularVector,
+	[TRAP_FLOOR]				= SV_GameFloor,
+	[TRAP_CEIL]					= SV_GameCeil
+};
+
 /*
 ====================
 SV_GameSystemCalls
 
-The module is making a system call
+The module is making a system call, the ones in sv_gameSyscalls
+don't come through here
 ====================
 */
 intptr_t SV_GameSystemCalls( intptr_t *args )
@@ -355,31 +490,11 @@ intptr_t SV_GameSystemCalls( intptr_t *args )
 	case G_SEND_SERVER_COMMAND:
 		SV_GameSendServerCommand( args[1], VMA(2) );
 		return 0;
-	case G_LINKENTITY:
-		SV_LinkEntity( VMA(1) );
-		return 0;
-	case G_UNLINKENTITY:
-		SV_UnlinkEntity( VMA(1) );
-		return 0;
-	case G_ENTITIES_IN_BOX:
-		return SV_AreaEntities( VMA(1), VMA(2), VMA(3), args[4] );
-	case G_ENTITY_CONTACT:
-		return SV_EntityContact( VMA(1), VMA(2), VMA(3), /*int capsule*/ qfalse );
 	case G_ENTITY_CONTACTCAPSULE:
 		return SV_EntityContact( VMA(1), VMA(2), VMA(3), /*int capsule*/ qtrue );
-	case G_TRACE:
-		SV_Trace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse );
-		return 0;
-	case G_TRACECAPSULE:
-		SV_Trace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qtrue );
-		return 0;
-	case G_POINT_CONTENTS:
-		return SV_PointContents( VMA(1), args[2] );
 	case G_SET_BRUSH_MODEL:
 		SV_SetBrushModel( VMA(1), VMA(2) );
 		return 0;
-	case G_IN_PVS:
-		return SV_inPVS( VMA(1), VMA(2) );
 	case G_IN_PVS_IGNORE_PORTALS:
 		return SV_inPVSIgnorePortals( VMA(1), VMA(2) );
 
@@ -410,9 +525,6 @@ intptr_t SV_GameSystemCalls( intptr_t *args )
 		SV_BotFreeClient( args[1] );
 		return 0;
 
-	case G_GET_USERCMD:
-		SV_GetUsercmd( args[1], VMA(2) );
-		return 0;
 	case G_GET_ENTITY_TOKEN:
 		{
 			const char	*s = COM_ParseExt( &sv.entityParsePoint, qtrue );
@@ -798,49 +910,6 @@ intptr_t SV_GameSystemCalls( intptr_t *args )
 	case BOTLIB_AI_GENETIC_PARENTS_AND_CHILD_SELECTION:
 		return botlib_export->ai.GeneticParentsAndChildSelection(args[1], VMA(2), VMA(3), VMA(4), VMA(5));
 
-	case TRAP_MEMSET:
-		memset( VMA(1), args[2], args[3] );
-		return 0;
-
-	case TRAP_MEMCPY:
-		memcpy( VMA(1), VMA(2), args[3] );
-		return 0;
-
-	case TRAP_STRNCPY:
-		strncpy( VMA(1), VMA(2), args[3] );
-		return args[1];
-
-	case TRAP_SIN:
-		return FloatAsInt( sin( VMF(1) ) );
-
-	case TRAP_COS:
-		return FloatAsInt( cos( VMF(1) ) );
-
-	case TRAP_ATAN2:
-		return FloatAsInt( atan2( VMF(1), VMF(2) ) );
-
-	case TRAP_SQRT:
-		return FloatAsInt( sqrt( VMF(1) ) );
-
-	case TRAP_MATRIXMULTIPLY:
-		MatrixMultiply( VMA(1), VMA(2), VMA(3) );
-		return 0;
-
-	case TRAP_ANGLEVECTORS:
-		AngleVectors( VMA(1), VMA(2), VMA(3), VMA(4) );
-		return 0;
-
-	case TRAP_PERPENDICULARVECTOR:
-		PerpendicularVector( VMA(1), VMA(2) );
-		return 0;
-
-	case TRAP_FLOOR:
-		return FloatAsInt( floor( VMF(1) ) );
-
-	case TRAP_CEIL:
-		return FloatAsInt( ceil( VMF(1) ) );
-
-
 	default:
 		Com_Error( ERR_DROP, "Bad game system trap: %ld", (long int) args[0] );
 	}
@@ -858,7 +927,7 @@ void SV_ShutdownGameProgs( void ) {
 	if ( !gvm ) {
 		return;
 	}
-	VM_Call( gvm, GAME_SHUTDOWN, qfalse );
+	VM_Call1( gvm, GAME_SHUTDOWN, qfalse );
 	VM_Free( gvm );
 	gvm = NULL;
 }
@@ -884,9 +953,12 @@ static void SV_InitGameVM( qboolean restart ) {
 		svs.clients[i].gentity = NULL;
 	}
 	
+	// VM_Restart of a dll creates a new vm
+	VM_SetSyscallTable( gvm, sv_gameSyscalls, ARRAY_LEN( sv_gameSyscalls ) );
+
 	// use the current msec count for a random seed
 	// init for this gamestate
-	VM_Call (gvm, GAME_INIT, sv.time, Com_Milliseconds(), restart);
+	VM_Call3( gvm, GAME_INIT, sv.time, Com_Milliseconds(), restart );
 }
 
 
@@ -902,7 +974,7 @@ void SV_RestartGameProgs( void ) {
 	if ( !gvm ) {
 		return;
 	}
-	VM_Call( gvm, GAME_SHUTDOWN, qtrue );
+	VM_Call1( gvm, GAME_SHUTDOWN, qtrue );
 
 	// do a restart instead of a free
 	gvm = VM_Restart(gvm, qtrue);
@@ -956,6 +1028,6 @@ qboolean SV_GameCommand( void ) {
 		return qfalse;
 	}
 
-	return VM_Call( gvm, GAME_CONSOLE_COMMAND );
+	return VM_Call0( gvm, GAME_CONSOLE_COMMAND );
 }
 
@@ -400,6 +400,8 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	qboolean	isBot;
 	char		systemInfo[16384];
 	const char	*p;
+	char		aasName[MAX_QPATH], bspName[MAX_QPATH];
+	const char	*prefetch[2];
 
 	// shut down the existing game if it is running
 	SV_ShutdownGameProgs();
@@ -466,6 +468,14 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	sv.checksumFeed = ( ((int) rand() << 16) ^ rand() ) ^ Com_Milliseconds();
 	FS_Restart( sv.checksumFeed );
 
+	// inflate the map and the bot navigation file together, the aas
+	// goes first because it is read last
+	Com_sprintf( aasName, sizeof( aasName ), "maps/%s.aas", server );
+	Com_sprintf( bspName, sizeof( bspName ), "maps/%s.bsp", server );
+	prefetch[0] = aasName;
+	prefetch[1] = bspName;
+	FS_PrefetchFiles( prefetch, 2 );
+
 	CM_LoadMap( va("maps/%s.bsp", server), qfalse, &checksum );
 
 	// set serverinfo visible name
@@ -490,13 +500,16 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	// load and spawn all other entities
 	SV_InitGameProgs();
 
+	// the game has loaded its bot files by now
+	FS_FlushPrefetchedFiles();
+
 	// don't allow a map_restart if game is modified
 	sv_gametype->modified = qfalse;
 
 	// run a few frames to allow everything to settle
 	for (i = 0;i < 3; i++)
 	{
-		VM_Call (gvm, GAME_RUN_FRAME, sv.time);
+		VM_Call1( gvm, GAME_RUN_FRAME, sv.time );
 		SV_BotFrame (sv.time);
 		sv.time += 100;
 		svs.time += 100;
@@ -522,7 +535,7 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 			}
 
 			// connect the client again
-			denied = VM_ExplicitArgPtr( gvm, VM_Call( gvm, GAME_CLIENT_CONNECT, i, qfalse, isBot ) );	// firstTime = qfalse
+			denied = VM_ExplicitArgPtr( gvm, VM_Call3( gvm, GAME_CLIENT_CONNECT, i, qfalse, isBot ) );	// firstTime = qfalse
 			if ( denied ) {
 				// this generally shouldn't happen, because the client
 				// was connected before the level change
@@ -546,14 +559,14 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 					client->deltaMessage = -1;
 					client->lastSnapshotTime = 0;	// generate a snapshot immediately
 
-					VM_Call( gvm, GAME_CLIENT_BEGIN, i );
+					VM_Call1( gvm, GAME_CLIENT_BEGIN, i );
 				}
 			}
 		}
 	}	
 
 	// run another frame to allow things to look at all the players
-	VM_Call (gvm, GAME_RUN_FRAME, sv.time);
+	VM_Call1( gvm, GAME_RUN_FRAME, sv.time );
 	SV_BotFrame (sv.time);
 	sv.time += 100;
 	svs.time += 100;
@@ -681,6 +694,7 @@ void SV_Init(void)
 	sv_killserver = Cvar_Get ("sv_killserver", "0", 0);
 	sv_mapChecksum = Cvar_Get ("sv_mapChecksum", "", CVAR_ROM);
 	sv_lanForceRate = Cvar_Get ("sv_lanForceRate", "1", CVAR_ARCHIVE );
+	sv_snapshotThreads = Cvar_Get ("sv_snapshotThreads", "0", CVAR_ARCHIVE );
 #ifndef STANDALONE
 	sv_strictAuth = Cvar_Get ("sv_strictAuth", "1", CVAR_ARCHIVE );
 #endif
@@ -751,6 +765,7 @@ void SV_Shutdown( char *finalmsg )
 		SV_FinalMessage( finalmsg );
 	}
 
+	SV_ShutdownSnapshotJobs();
 	SV_RemoveOperatorCommands();
 	SV_MasterShutdown();
 	SV_ShutdownGameProgs();
@@ -59,6 +59,7 @@ cvar_t	*sv_dorestart;
 cvar_t	*sv_pure;
 cvar_t	*sv_floodProtect;
 cvar_t	*sv_lanForceRate; // dedicated 1 (LAN) server forces local client rates to 99999 (bug #491)
+cvar_t	*sv_snapshotThreads;	// worker threads building client snapshots, 0 builds them serially
 #ifndef STANDALONE
 cvar_t	*sv_strictAuth;
 #endif
@@ -1154,7 +1155,7 @@ void SV_Frame( int msec )
 		sv.time += frameMsec;
 
 		// let everything in the world think and move
-		VM_Call (gvm, GAME_RUN_FRAME, sv.time);
+		VM_Call1( gvm, GAME_RUN_FRAME, sv.time );
 	}
 
 	if ( com_speeds->integer ) {
@@ -1233,9 +1234,11 @@ Return the time in msec until we expect to be called next
 
 int SV_SendQueuedPackets()
 {
-	int numBlocks;
-	int dlStart, deltaT, delayT;
-	static int dlNextRound = 0;
+	int numBytes;
+	int delayT;
+	int64_t dlStart, elapsed, rate;
+	static int64_t dlLastTime = 0;
+	static int64_t dlCredit = 0;
 	int timeVal = INT_MAX;
 
 	// Send out fragmented packets now that we're idle
@@ -1245,56 +1248,44 @@ int SV_SendQueuedPackets()
 
 	if(sv_dlRate->integer)
 	{
-		// Rate limiting. This is very imprecise for high
-		// download rates due to millisecond timedelta resolution
-		dlStart = Sys_Milliseconds();
-		deltaT = dlNextRound - dlStart;
-
-		if(deltaT > 0)
+		// Rate limiting. The credit is kept in bytes times microseconds
+		// per second, so the rate holds exactly however often we get
+		// called and however much each round sends
+		rate = (int64_t) sv_dlRate->integer * 1024;
+		dlStart = Sys_Microseconds();
+		if(!dlLastTime)
+			dlLastTime = dlStart;
+
+		// Don't let idle time build up more than a 50 msec burst,
+		// clamped before multiplying so a long pause can't overflow
+		elapsed = dlStart - dlLastTime;
+		if(elapsed > 50000)
+			elapsed = 50000;
+
+		dlCredit += elapsed * rate;
+		dlLastTime = dlStart;
+
+		if(dlCredit > rate * 50000)
+			dlCredit = rate * 50000;
+
+		if(dlCredit > 0)
 		{
-			if(deltaT < timeVal)
-				timeVal = deltaT + 1;
+			numBytes = SV_SendDownloadMessages(dlCredit / 1000000 + 1);
+			dlCredit -= (int64_t) numBytes * 1000000;
 		}
-		else
-		{
-			numBlocks = SV_SendDownloadMessages();
 
-			if(numBlocks)
-			{
-				// There are active downloads
-				deltaT = Sys_Milliseconds() - dlStart;
-
-				delayT = 1000 * numBlocks * MAX_DOWNLOAD_BLKSIZE;
-				delayT /= sv_dlRate->integer * 1024;
-
-				if(delayT <= deltaT + 1)
-				{
-					// Sending the last round of download messages
-					// took too long for given rate, don't wait for
-					// next round, but always enforce a 1ms delay
-					// between DL message rounds so we don't hog
-					// all of the bandwidth. This will result in an
-					// effective maximum rate of 1MB/s per user, but the
-					// low download window size limits this anyways.
-					if(timeVal > 2)
-						timeVal = 2;
-
-					dlNextRound = dlStart + deltaT + 1;
-				}
-				else
-				{
-					dlNextRound = dlStart + delayT;
-					delayT -= deltaT;
+		if(dlCredit < 0)
+		{
+			// The last round went over, wait until it is paid off
+			delayT = (-dlCredit / rate + 999) / 1000;
 
-					if(delayT < timeVal)
-						timeVal = delayT;
-				}
-			}
+			if(delayT < timeVal)
+				timeVal = delayT;
 		}
 	}
 	else
 	{
-		if(SV_SendDownloadMessages())
+		if(SV_SendDownloadMessages(0))
 			timeVal = 0;
 	}
 
@@ -116,42 +116,60 @@ static void SV_EmitPacketEntities( clientSnapshot_t *from, clientSnapshot_t *to,
 
 /*
 ==================
-SV_WriteSnapshotToClient
+SV_SelectDeltaFrame
+
+Picks the frame the client can delta the new snapshot from, or NULL
+for a full update.  The check against svs.nextSnapshotEntities must see
+every entity stored this frame, so in threaded mode this is called after
+all snapshots have been built.
 ==================
 */
-static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
-	clientSnapshot_t	*frame, *oldframe;
-	int					lastframe;
-	int					i;
-	int					snapFlags;
-
-	// this is the snapshot we are creating
-	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+static clientSnapshot_t *SV_SelectDeltaFrame( client_t *client, int *lastframe ) {
+	clientSnapshot_t	*oldframe;
 
 	// try to use a previous frame as the source for delta compressing the snapshot
 	if ( client->deltaMessage <= 0 || client->state != CS_ACTIVE ) {
 		// client is asking for a retransmit
 		oldframe = NULL;
-		lastframe = 0;
+		*lastframe = 0;
 	} else if ( client->netchan.outgoingSequence - client->deltaMessage 
 		>= (PACKET_BACKUP - 3) ) {
 		// client hasn't gotten a good message through in a long time
 		Com_DPrintf ("%s: Delta request from out of date packet.\n", client->name);
 		oldframe = NULL;
-		lastframe = 0;
+		*lastframe = 0;
 	} else {
 		// we have a valid snapshot to delta from
 		oldframe = &client->frames[ client->deltaMessage & PACKET_MASK ];
-		lastframe = client->netchan.outgoingSequence - client->deltaMessage;
+		*lastframe = client->netchan.outgoingSequence - client->deltaMessage;
 
 		// the snapshot's entities may still have rolled off the buffer, though
 		if ( oldframe->first_entity <= svs.nextSnapshotEntities - svs.numSnapshotEntities ) {
 			Com_DPrintf ("%s: Delta request from out of date entities.\n", client->name);
 			oldframe = NULL;
-			lastframe = 0;
+			*lastframe = 0;
 		}
 	}
 
+	return oldframe;
+}
+
+/*
+==================
+SV_WriteSnapshotFrame
+
+Doesn't print or touch anything shared, so the snapshot
+workers can call it
+==================
+*/
+static void SV_WriteSnapshotFrame( client_t *client, clientSnapshot_t *oldframe, int lastframe, msg_t *msg ) {
+	clientSnapshot_t	*frame;
+	int					i;
+	int					snapFlags;
+
+	// this is the snapshot we are creating
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+
 	MSG_WriteByte (msg, svc_snapshot);
 
 	// NOTE, MRE: now sent at the start of every message from server to client
@@ -207,6 +225,20 @@ static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
 	}
 }
 
+/*
+==================
+SV_WriteSnapshotToClient
+==================
+*/
+static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
+	clientSnapshot_t	*oldframe;
+	int					lastframe;
+
+	oldframe = SV_SelectDeltaFrame( client, &lastframe );
+
+	SV_WriteSnapshotFrame( client, oldframe, lastframe, msg );
+}
+
 
 /*
 ==================
@@ -238,6 +270,8 @@ Build a client snapshot structure
 typedef struct {
 	int		numSnapshotEntities;
 	int		snapshotEntities[MAX_SNAPSHOT_ENTITIES];	
+	byte	added[MAX_GENTITIES/8];		// prevents double adding from portal views
+	qboolean	badClientMask;			// SVF_CLIENTMASK seen with clientNum >= 32
 } snapshotEntityNumbers_t;
 
 /*
@@ -268,37 +302,63 @@ static int QDECL SV_QsortEntityNumbers( const void *a, const void *b ) {
 SV_AddEntToSnapshot
 ===============
 */
-static void SV_AddEntToSnapshot( svEntity_t *svEnt, sharedEntity_t *gEnt, snapshotEntityNumbers_t *eNums ) {
+static void SV_AddEntToSnapshot( int entityNum, snapshotEntityNumbers_t *eNums ) {
 	// if we have already added this entity to this snapshot, don't add again
-	if ( svEnt->snapshotCounter == sv.snapshotCounter ) {
+	if ( eNums->added[entityNum >> 3] & (1 << (entityNum & 7)) ) {
 		return;
 	}
-	svEnt->snapshotCounter = sv.snapshotCounter;
+	eNums->added[entityNum >> 3] |= 1 << (entityNum & 7);
 
 	// if we are full, silently discard entities
 	if ( eNums->numSnapshotEntities == MAX_SNAPSHOT_ENTITIES ) {
 		return;
 	}
 
-	eNums->snapshotEntities[ eNums->numSnapshotEntities ] = gEnt->s.number;
+	eNums->snapshotEntities[ eNums->numSnapshotEntities ] = entityNum;
 	eNums->numSnapshotEntities++;
 }
 
+/*
+===============
+SV_LowestBit
+===============
+*/
+static ID_INLINE int SV_LowestBit( uint64_t bits ) {
+#if defined( __GNUC__ )
+	return __builtin_ctzll( bits );
+#else
+	int		n = 0;
+
+	while ( !( bits & 1 ) ) {
+		bits >>= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
 /*
 ===============
 SV_AddEntitiesVisibleFromPoint
+
+Only reads the world and entities, all per snapshot state lives in
+frame and eNums, so several clients can be processed at once
 ===============
 */
 static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *frame, 
 									snapshotEntityNumbers_t *eNums, qboolean portal ) {
-	int		e, i;
+	int		e, i, w;
 	sharedEntity_t *ent;
 	svEntity_t	*svEnt;
+	svEntityVis_t	*vis;
 	int		l;
 	int		clientarea, clientcluster;
 	int		leafnum;
+	int		numAreas, numWords;
 	byte	*clientpvs;
 	byte	*bitvector;
+	byte	areaConnected[MAX_MAP_AREA_BYTES * 8 + 1];
+	uint64_t	linked, row;
 
 	// during an error shutdown message we may need to transmit
 	// the shutdown message after the server has shutdown, so
@@ -314,88 +374,112 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 	// calculate the visible areas
 	frame->areabytes = CM_WriteAreaBits( frame->areabits, clientarea );
 
-	clientpvs = CM_ClusterPVS (clientcluster);
+	// answer CM_AreasConnected once per area instead of per entity,
+	// shifted by one so an entity outside any area (-1) has a slot
+	numAreas = CM_NumAreas();
+	if ( numAreas > MAX_MAP_AREA_BYTES * 8 ) {
+		numAreas = MAX_MAP_AREA_BYTES * 8;
+	}
+	for ( i = -1 ; i < numAreas ; i++ ) {
+		areaConnected[i + 1] = CM_AreasConnected( clientarea, i );
+	}
 
-	for ( e = 0 ; e < sv.num_entities ; e++ ) {
-		ent = SV_GentityNum(e);
+	clientpvs = CM_ClusterPVS (clientcluster);
 
-		// never send entities that aren't linked in
-		if ( !ent->r.linked ) {
-			continue;
-		}
+	vis = &sv.entityVis;
 
-		if (ent->s.number != e) {
-			Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
-			ent->s.number = e;
-		}
+	// only walk the entities that are linked, a word of the set at a time
+	for ( w = 0 ; w < ( sv.num_entities + 63 ) >> 6 ; w++ ) {
+		linked = vis->linked[w];
+		while ( linked ) {
+			e = ( w << 6 ) + SV_LowestBit( linked );
+			linked &= linked - 1;
+			if ( e >= sv.num_entities ) {
+				break;
+			}
 
-		// entities can be flagged to explicitly not be sent to the client
-		if ( ent->r.svFlags & SVF_NOCLIENT ) {
-			continue;
-		}
+			ent = SV_GentityNum(e);
 
-		// entities can be flagged to be sent to only one client
-		if ( ent->r.svFlags & SVF_SINGLECLIENT ) {
-			if ( ent->r.singleClient != frame->ps.clientNum ) {
+			// never send entities that aren't linked in
+			if ( !ent->r.linked ) {
 				continue;
 			}
-		}
-		// entities can be flagged to be sent to everyone but one client
-		if ( ent->r.svFlags & SVF_NOTSINGLECLIENT ) {
-			if ( ent->r.singleClient == frame->ps.clientNum ) {
-				continue;
+
+			if (ent->s.number != e) {
+				Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
+				ent->s.number = e;
 			}
-		}
-		// entities can be flagged to be sent to a given mask of clients
-		if ( ent->r.svFlags & SVF_CLIENTMASK ) {
-			if (frame->ps.clientNum >= 32)
-				Com_Error( ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32" );
-			if (~ent->r.singleClient & (1 << frame->ps.clientNum))
-				continue;
-		}
 
-		svEnt = SV_SvEntityForGentity( ent );
+			// entities can be flagged to explicitly not be sent to the client
+			if ( ent->r.svFlags & SVF_NOCLIENT ) {
+				continue;
+			}
 
-		// don't double add an entity through portals
-		if ( svEnt->snapshotCounter == sv.snapshotCounter ) {
-			continue;
-		}
+			// entities can be flagged to be sent to only one client
+			if ( ent->r.svFlags & SVF_SINGLECLIENT ) {
+				if ( ent->r.singleClient != frame->ps.clientNum ) {
+					continue;
+				}
+			}
+			// entities can be flagged to be sent to everyone but one client
+			if ( ent->r.svFlags & SVF_NOTSINGLECLIENT ) {
+				if ( ent->r.singleClient == frame->ps.clientNum ) {
+					continue;
+				}
+			}
+			// entities can be flagged to be sent to a given mask of clients
+			if ( ent->r.svFlags & SVF_CLIENTMASK ) {
+				if (frame->ps.clientNum >= 32) {
+					// the caller drops the server, this may be a worker
+					eNums->badClientMask = qtrue;
+					continue;
+				}
+				if (~ent->r.singleClient & (1 << frame->ps.clientNum))
+					continue;
+			}
 
-		// broadcast entities are always sent
-		if ( ent->r.svFlags & SVF_BROADCAST ) {
-			SV_AddEntToSnapshot( svEnt, ent, eNums );
-			continue;
-		}
+			// don't double add an entity through portals
+			if ( eNums->added[e >> 3] & (1 << (e & 7)) ) {
+				continue;
+			}
 
-		// ignore if not touching a PV leaf
-		// check area
-		if ( !CM_AreasConnected( clientarea, svEnt->areanum ) ) {
-			// doors can legally straddle two areas, so
-			// we may need to check another one
-			if ( !CM_AreasConnected( clientarea, svEnt->areanum2 ) ) {
-				continue;		// blocked by a door
+			// broadcast entities are always sent
+			if ( ent->r.svFlags & SVF_BROADCAST ) {
+				SV_AddEntToSnapshot( e, eNums );
+				continue;
 			}
-		}
 
-		bitvector = clientpvs;
+			// ignore if not touching a PV leaf
+			// check area
+			if ( !areaConnected[vis->areanum[e] + 1] ) {
+				// doors can legally straddle two areas, so
+				// we may need to check another one
+				if ( !areaConnected[vis->areanum2[e] + 1] ) {
+					continue;		// blocked by a door
+				}
+			}
 
-		// check individual leafs
-		if ( !svEnt->numClusters ) {
-			continue;
-		}
-		l = 0;
-		for ( i=0 ; i < svEnt->numClusters ; i++ ) {
-			l = svEnt->clusternums[i];
-			if ( bitvector[l >> 3] & (1 << (l&7) ) ) {
-				break;
+			// check individual leafs, a pvs word at a time
+			numWords = vis->numClusterWords[e];
+			if ( !numWords ) {
+				continue;
+			}
+			for ( i = 0 ; i < numWords ; i++ ) {
+				memcpy( &row, clientpvs + vis->clusterWord[e][i] * 8, sizeof( row ) );
+				if ( row & vis->clusterMask[e][i] ) {
+					break;
+				}
 			}
-		}
 
-		// if we haven't found it to be visible,
-		// check overflow clusters that coudln't be stored
-		if ( i == svEnt->numClusters ) {
-			if ( svEnt->lastCluster ) {
-				for ( ; l <= svEnt->lastCluster ; l++ ) {
+			// if we haven't found it to be visible,
+			// check overflow clusters that coudln't be stored
+			if ( i == numWords ) {
+				if ( !vis->clustersOverflowed[e] ) {
+					continue;
+				}
+				svEnt = SV_SvEntityForGentity( ent );
+				bitvector = clientpvs;
+				for ( l = svEnt->clusternums[svEnt->numClusters - 1] ; l <= svEnt->lastCluster ; l++ ) {
 					if ( bitvector[l >> 3] & (1 << (l&7) ) ) {
 						break;
 					}
@@ -403,62 +487,47 @@ static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *fra
 				if ( l == svEnt->lastCluster ) {
 					continue;	// not visible
 				}
-			} else {
-				continue;
 			}
-		}
 
-		// add it
-		SV_AddEntToSnapshot( svEnt, ent, eNums );
+			// add it
+			SV_AddEntToSnapshot( e, eNums );
 
-		// if it's a portal entity, add everything visible from its camera position
-		if ( ent->r.svFlags & SVF_PORTAL ) {
-			if ( ent->s.generic1 ) {
-				vec3_t dir;
-				VectorSubtract(ent->s.origin, origin, dir);
-				if ( VectorLengthSquared(dir) > (float) ent->s.generic1 * ent->s.generic1 ) {
-					continue;
+			// if it's a portal entity, add everything visible from its camera position
+			if ( ent->r.svFlags & SVF_PORTAL ) {
+				if ( ent->s.generic1 ) {
+					vec3_t dir;
+					VectorSubtract(ent->s.origin, origin, dir);
+					if ( VectorLengthSquared(dir) > (float) ent->s.generic1 * ent->s.generic1 ) {
+						continue;
+					}
 				}
+				SV_AddEntitiesVisibleFromPoint( ent->s.origin2, frame, eNums, qtrue );
 			}
-			SV_AddEntitiesVisibleFromPoint( ent->s.origin2, frame, eNums, qtrue );
 		}
-
 	}
 }
 
 /*
 =============
-SV_BuildClientSnapshot
-
-Decides which entities are going to be visible to the client, and
-copies off the playerstate and areabits.
+SV_BeginClientSnapshot
 
-This properly handles multiple recursive portals, but the render
-currently doesn't.
-
-For viewing through other player's eyes, clent can be something other than client->gentity
+Clears the frame we are creating and copies off the playerstate.
+Returns qfalse if there is nothing more to build.
 =============
 */
-static void SV_BuildClientSnapshot( client_t *client ) {
-	vec3_t						org;
+static qboolean SV_BeginClientSnapshot( client_t *client, snapshotEntityNumbers_t *eNums ) {
 	clientSnapshot_t			*frame;
-	snapshotEntityNumbers_t		entityNumbers;
-	int							i;
-	sharedEntity_t				*ent;
-	entityState_t				*state;
-	svEntity_t					*svEnt;
 	sharedEntity_t				*clent;
 	int							clientNum;
 	playerState_t				*ps;
 
-	// bump the counter used to prevent double adding
-	sv.snapshotCounter++;
-
 	// this is the frame we are creating
 	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
 	// clear everything in this snapshot
-	entityNumbers.numSnapshotEntities = 0;
+	eNums->numSnapshotEntities = 0;
+	eNums->badClientMask = qfalse;
+	memset( eNums->added, 0, sizeof( eNums->added ) );
 	memset( frame->areabits, 0, sizeof( frame->areabits ) );
 
   // https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=62
@@ -466,7 +535,7 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 	
 	clent = client->gentity;
 	if ( !clent || client->state == CS_ZOMBIE ) {
-		return;
+		return qfalse;
 	}
 
 	// grab the current playerState_t
@@ -479,24 +548,43 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 	if ( clientNum < 0 || clientNum >= MAX_GENTITIES ) {
 		Com_Error( ERR_DROP, "SV_SvEntityForGentity: bad gEnt" );
 	}
-	svEnt = &sv.svEntities[ clientNum ];
+	eNums->added[clientNum >> 3] |= 1 << (clientNum & 7);
+
+	return qtrue;
+}
+
+/*
+=============
+SV_CollectSnapshotEntities
 
-	svEnt->snapshotCounter = sv.snapshotCounter;
+Decides which entities are going to be visible to the client and
+finishes the areabits.  Safe to run on a snapshot worker.
+
+This properly handles multiple recursive portals, but the render
+currently doesn't.
+=============
+*/
+static void SV_CollectSnapshotEntities( client_t *client, snapshotEntityNumbers_t *eNums ) {
+	vec3_t						org;
+	clientSnapshot_t			*frame;
+	int							i;
+
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
 	// find the client's viewpoint
-	VectorCopy( ps->origin, org );
-	org[2] += ps->viewheight;
+	VectorCopy( frame->ps.origin, org );
+	org[2] += frame->ps.viewheight;
 
 	// add all the entities directly visible to the eye, which
 	// may include portal entities that merge other viewpoints
-	SV_AddEntitiesVisibleFromPoint( org, frame, &entityNumbers, qfalse );
+	SV_AddEntitiesVisibleFromPoint( org, frame, eNums, qfalse );
 
 	// if there were portals visible, there may be out of order entities
 	// in the list which will need to be resorted for the delta compression
-	// to work correctly.  This also catches the error condition
-	// of an entity being included twice.
-	qsort( entityNumbers.snapshotEntities, entityNumbers.numSnapshotEntities, 
-		sizeof( entityNumbers.snapshotEntities[0] ), SV_QsortEntityNumbers );
+	// to work correctly.  The added bits make sure no entity is
+	// included twice.
+	qsort( eNums->snapshotEntities, eNums->numSnapshotEntities, 
+		sizeof( eNums->snapshotEntities[0] ), SV_QsortEntityNumbers );
 
 	// now that all viewpoint's areabits have been OR'd together, invert
 	// all of them to make it a mask vector, which is what the renderer wants
@@ -506,23 +594,81 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 		(frame->areabits)[i] = (frame->areabits)[i] ^ 0xFF;
 
 	}
+}
 
-	// copy the entity states out
-	frame->num_entities = 0;
+/*
+=============
+SV_ReserveSnapshotEntities
+
+Claims the client's range of the svs.snapshotEntities ring,
+must be called in client order from the main thread
+=============
+*/
+static void SV_ReserveSnapshotEntities( client_t *client, snapshotEntityNumbers_t *eNums ) {
+	clientSnapshot_t			*frame;
+
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+
+	if ( eNums->badClientMask ) {
+		Com_Error( ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32" );
+	}
+
+	frame->num_entities = eNums->numSnapshotEntities;
 	frame->first_entity = svs.nextSnapshotEntities;
-	for ( i = 0 ; i < entityNumbers.numSnapshotEntities ; i++ ) {
-		ent = SV_GentityNum(entityNumbers.snapshotEntities[i]);
-		state = &svs.snapshotEntities[svs.nextSnapshotEntities % svs.numSnapshotEntities];
+
+	svs.nextSnapshotEntities += eNums->numSnapshotEntities;
+	// this should never hit, map should always be restarted first in SV_Frame
+	if ( svs.nextSnapshotEntities >= 0x7FFFFFFE ) {
+		Com_Error(ERR_FATAL, "svs.nextSnapshotEntities wrapped");
+	}
+}
+
+/*
+=============
+SV_StoreSnapshotEntities
+
+Copies the entity states out into the range claimed by
+SV_ReserveSnapshotEntities.  Ranges never overlap, so
+this is safe to run on a snapshot worker.
+=============
+*/
+static void SV_StoreSnapshotEntities( client_t *client, snapshotEntityNumbers_t *eNums ) {
+	clientSnapshot_t			*frame;
+	int							i;
+	sharedEntity_t				*ent;
+	entityState_t				*state;
+
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+
+	for ( i = 0 ; i < frame->num_entities ; i++ ) {
+		ent = SV_GentityNum(eNums->snapshotEntities[i]);
+		state = &svs.snapshotEntities[(frame->first_entity + i) % svs.numSnapshotEntities];
 		*state = ent->s;
-		svs.nextSnapshotEntities++;
-		// this should never hit, map should always be restarted first in SV_Frame
-		if ( svs.nextSnapshotEntities >= 0x7FFFFFFE ) {
-			Com_Error(ERR_FATAL, "svs.nextSnapshotEntities wrapped");
-		}
-		frame->num_entities++;
 	}
 }
 
+/*
+=============
+SV_BuildClientSnapshot
+
+Decides which entities are going to be visible to the client, and
+copies off the playerstate and areabits.
+
+For viewing through other player's eyes, clent can be something other than client->gentity
+=============
+*/
+static void SV_BuildClientSnapshot( client_t *client ) {
+	snapshotEntityNumbers_t		entityNumbers;
+
+	if ( !SV_BeginClientSnapshot( client, &entityNumbers ) ) {
+		return;
+	}
+
+	SV_CollectSnapshotEntities( client, &entityNumbers );
+	SV_ReserveSnapshotEntities( client, &entityNumbers );
+	SV_StoreSnapshotEntities( client, &entityNumbers );
+}
+
 #ifdef USE_VOIP
 /*
 ==================
@@ -591,53 +737,346 @@ void SV_SendMessageToClient(msg_t *msg, client_t *client)
 
 /*
 =======================
-SV_SendClientSnapshot
-
-Also called by SV_FinalMessage
+SV_FinishClientSnapshot
 
+Appends the VoIP data and hands the message to the netchan
 =======================
 */
-void SV_SendClientSnapshot( client_t *client ) {
-	byte		msg_buf[MAX_MSGLEN];
-	msg_t		msg;
+static void SV_FinishClientSnapshot( client_t *client, msg_t *msg ) {
+#ifdef USE_VOIP
+	SV_WriteVoipToClient( client, msg );
+#endif
+
+	// check for overflow
+	if ( msg->overflowed ) {
+		Com_Printf ("WARNING: msg overflowed for %s\n", client->name);
+		MSG_Clear (msg);
+	}
 
+	SV_SendMessageToClient( msg, client );
+}
+
+
+/*
+=======================
+SV_WriteClientSnapshot
+
+Builds the snapshot and writes the message for it without sending it.
+Returns qfalse for bots, which have nothing to send.
+=======================
+*/
+static qboolean SV_WriteClientSnapshot( client_t *client, msg_t *msg ) {
 	// build the snapshot
 	SV_BuildClientSnapshot( client );
 
 	// bots need to have their snapshots build, but
 	// the query them directly without needing to be sent
 	if ( client->gentity && client->gentity->r.svFlags & SVF_BOT ) {
-		return;
+		return qfalse;
 	}
 
+	// NOTE, MRE: all server->client messages now acknowledge
+	// let the client know which reliable clientCommands we have received
+	MSG_WriteLong( msg, client->lastClientCommand );
+
+	// (re)send any reliable server commands
+	SV_UpdateServerCommandsToClient( client, msg );
+
+	// send over all the relevant entityState_t
+	// and the playerState_t
+	SV_WriteSnapshotToClient( client, msg );
+
+	return qtrue;
+}
+
+
+/*
+=======================
+SV_SendClientSnapshot
+
+Also called by SV_FinalMessage
+
+=======================
+*/
+void SV_SendClientSnapshot( client_t *client ) {
+	byte		msg_buf[MAX_MSGLEN];
+	msg_t		msg;
+
 	MSG_Init (&msg, msg_buf, sizeof(msg_buf));
 	msg.allowoverflow = qtrue;
 
+	if ( SV_WriteClientSnapshot( client, &msg ) ) {
+		SV_FinishClientSnapshot( client, &msg );
+	}
+}
+
+
+/*
+=============================================================================
+
+Threaded snapshot building
+
+With sv_snapshotThreads set, the clients that are due a snapshot are
+gathered first, then their snapshots are built and delta encoded on the
+job system into per client buffers, and finally transmitted in client
+order from the main thread.  The clients are split into one job per
+sv_snapshotThreads, so that is how many threads work on them at most.
+Anything that can print, allocate or raise an error stays on the main
+thread.
+
+=============================================================================
+*/
+
+typedef struct {
+	client_t				*client;
+	qboolean				build;		// qfalse when there is no gentity to build from
+	qboolean				send;		// bots get their snapshot built, but not sent
+	snapshotEntityNumbers_t	entityNumbers;
+	clientSnapshot_t		*oldframe;	// delta source picked by SV_SelectDeltaFrame
+	int						lastframe;
+	msg_t					msg;
+	byte					msgBuffer[MAX_MSGLEN];
+} snapshotJob_t;
+
+static snapshotJob_t	*sv_snapshotJobs;
+static int				sv_maxSnapshotJobs;
+
+/*
+=======================
+SV_ShutdownSnapshotJobs
+=======================
+*/
+void SV_ShutdownSnapshotJobs( void ) {
+	if ( sv_snapshotJobs ) {
+		Z_Free( sv_snapshotJobs );
+	}
+
+	sv_snapshotJobs = NULL;
+	sv_maxSnapshotJobs = 0;
+}
+
+static void SV_BuildSnapshotJob( void *data, int index ) {
+	snapshotJob_t	*job = (snapshotJob_t *)data + index;
+
+	if ( job->build ) {
+		SV_CollectSnapshotEntities( job->client, &job->entityNumbers );
+	}
+}
+
+static void SV_EncodeSnapshotJob( void *data, int index ) {
+	snapshotJob_t	*job = (snapshotJob_t *)data + index;
+	client_t		*client = job->client;
+
+	if ( job->build ) {
+		SV_StoreSnapshotEntities( client, &job->entityNumbers );
+	}
+
+	if ( !job->send ) {
+		return;
+	}
+
 	// NOTE, MRE: all server->client messages now acknowledge
 	// let the client know which reliable clientCommands we have received
-	MSG_WriteLong( &msg, client->lastClientCommand );
+	MSG_WriteLong( &job->msg, client->lastClientCommand );
 
 	// (re)send any reliable server commands
-	SV_UpdateServerCommandsToClient( client, &msg );
+	SV_UpdateServerCommandsToClient( client, &job->msg );
 
 	// send over all the relevant entityState_t
 	// and the playerState_t
-	SV_WriteSnapshotToClient( client, &msg );
+	SV_WriteSnapshotFrame( client, job->oldframe, job->lastframe, &job->msg );
+}
 
-#ifdef USE_VOIP
-	SV_WriteVoipToClient( client, &msg );
-#endif
+/*
+=======================
+SV_FixEntityNumbers
 
-	// check for overflow
-	if ( msg.overflowed ) {
-		Com_Printf ("WARNING: msg overflowed for %s\n", client->name);
-		MSG_Clear (&msg);
+SV_AddEntitiesVisibleFromPoint repairs bad entity numbers as it goes,
+do it up front so the workers never write to the entities
+=======================
+*/
+static void SV_FixEntityNumbers( void ) {
+	sharedEntity_t	*ent;
+	int				e;
+
+	for ( e = 0 ; e < sv.num_entities ; e++ ) {
+		ent = SV_GentityNum( e );
+		if ( ent->r.linked && ent->s.number != e ) {
+			Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
+			ent->s.number = e;
+		}
+	}
+}
+
+/*
+=======================
+SV_WriteClientSnapshots
+
+Threaded version of SV_WriteClientSnapshot for every client in the list,
+split into numJobs jobs.  The messages are left in sv_snapshotJobs.
+=======================
+*/
+static void SV_WriteClientSnapshots( client_t **clients, int numClients, int numJobs ) {
+	snapshotJob_t	*job;
+	int				i, grain;
+
+	if ( sv_maxSnapshotJobs < sv_maxclients->integer ) {
+		if ( sv_snapshotJobs ) {
+			Z_Free( sv_snapshotJobs );
+		}
+		sv_maxSnapshotJobs = sv_maxclients->integer;
+		sv_snapshotJobs = Z_Malloc( sv_maxSnapshotJobs * sizeof( snapshotJob_t ) );
 	}
 
-	SV_SendMessageToClient( &msg, client );
+	if ( sv.state ) {
+		SV_FixEntityNumbers();
+	}
+
+	for ( i = 0, job = sv_snapshotJobs ; i < numClients ; i++, job++ ) {
+		job->client = clients[i];
+		job->build = SV_BeginClientSnapshot( job->client, &job->entityNumbers );
+		job->send = !( job->client->gentity && job->client->gentity->r.svFlags & SVF_BOT );
+
+		MSG_Init( &job->msg, job->msgBuffer, sizeof( job->msgBuffer ) );
+		job->msg.allowoverflow = qtrue;
+	}
+
+	grain = ( numClients + numJobs - 1 ) / numJobs;
+
+	// find the visible entities
+	Job_ParallelFor( "snapshot build", numClients, grain, SV_BuildSnapshotJob, sv_snapshotJobs );
+
+	// claim the snapshot entity ranges in client order
+	for ( i = 0, job = sv_snapshotJobs ; i < numClients ; i++, job++ ) {
+		if ( job->build ) {
+			SV_ReserveSnapshotEntities( job->client, &job->entityNumbers );
+		}
+	}
+
+	// only now svs.nextSnapshotEntities is final for this frame
+	for ( i = 0, job = sv_snapshotJobs ; i < numClients ; i++, job++ ) {
+		if ( job->send ) {
+			job->oldframe = SV_SelectDeltaFrame( job->client, &job->lastframe );
+		}
+	}
+
+	// store the entities and delta encode the messages
+	Job_ParallelFor( "snapshot encode", numClients, grain, SV_EncodeSnapshotJob, sv_snapshotJobs );
+}
+
+/*
+=======================
+SV_SendClientSnapshots
+
+Threaded version of SV_SendClientSnapshot for every client in the list
+=======================
+*/
+static void SV_SendClientSnapshots( client_t **clients, int numClients ) {
+	snapshotJob_t	*job;
+	int				i;
+
+	// one job per snapshot thread
+	SV_WriteClientSnapshots( clients, numClients, sv_snapshotThreads->integer );
+
+	for ( i = 0, job = sv_snapshotJobs ; i < numClients ; i++, job++ ) {
+		if ( job->send ) {
+			SV_FinishClientSnapshot( job->client, &job->msg );
+		}
+		job->client->lastSnapshotTime = svs.time;
+		job->client->rateDelayed = qfalse;
+	}
 }
 
 
+/*
+=======================
+SV_TestSnapshotJobs
+
+Called by jobtest.  Writes the snapshot of every connected client on the
+current frame serially and then on numJobs jobs, and compares the
+messages.  Nothing is sent, and svs.nextSnapshotEntities is put back, so
+the next real frame builds over the same entity range.
+Returns qfalse if any message differs.
+=======================
+*/
+qboolean SV_TestSnapshotJobs( int numJobs ) {
+	client_t		*clients[MAX_CLIENTS];
+	qboolean		serialSend[MAX_CLIENTS];
+	msg_t			*serial;
+	byte			*serialBuffers;
+	snapshotJob_t	*job;
+	client_t		*c;
+	int				i, numClients, nextSnapshotEntities;
+	qboolean		ok;
+
+	if ( !com_sv_running->integer || sv.state != SS_GAME ) {
+		Com_Printf( "jobtest: no map running, snapshots not checked\n" );
+		return qtrue;
+	}
+
+	numClients = 0;
+	for ( i = 0, c = svs.clients ; i < sv_maxclients->integer ; i++, c++ ) {
+		if ( c->state && !*c->downloadName ) {
+			clients[numClients++] = c;
+		}
+	}
+
+	if ( !numClients ) {
+		Com_Printf( "jobtest: no clients, snapshots not checked\n" );
+		return qtrue;
+	}
+
+	if ( numJobs < 1 ) {
+		numJobs = 1;
+	}
+
+	serial = Z_Malloc( numClients * sizeof( *serial ) );
+	serialBuffers = Z_Malloc( numClients * MAX_MSGLEN );
+
+	nextSnapshotEntities = svs.nextSnapshotEntities;
+
+	for ( i = 0 ; i < numClients ; i++ ) {
+		MSG_Init( &serial[i], serialBuffers + i * MAX_MSGLEN, MAX_MSGLEN );
+		serial[i].allowoverflow = qtrue;
+		serialSend[i] = SV_WriteClientSnapshot( clients[i], &serial[i] );
+	}
+
+	svs.nextSnapshotEntities = nextSnapshotEntities;
+
+	SV_WriteClientSnapshots( clients, numClients, numJobs );
+
+	svs.nextSnapshotEntities = nextSnapshotEntities;
+
+	ok = qtrue;
+	for ( i = 0, job = sv_snapshotJobs ; i < numClients ; i++, job++ ) {
+		if ( job->send != serialSend[i] ) {
+			Com_Printf( S_COLOR_RED "jobtest: snapshot of %s sent by one path only\n", clients[i]->name );
+			ok = qfalse;
+			continue;
+		}
+		if ( !job->send ) {
+			continue;
+		}
+
+		if ( job->msg.cursize != serial[i].cursize || job->msg.bit != serial[i].bit
+			|| job->msg.overflowed != serial[i].overflowed
+			|| memcmp( job->msg.data, serial[i].data, serial[i].cursize ) ) {
+			Com_Printf( S_COLOR_RED "jobtest: snapshot of %s differs, %i bytes serial, %i threaded\n",
+				clients[i]->name, serial[i].cursize, job->msg.cursize );
+			ok = qfalse;
+		}
+	}
+
+	if ( ok ) {
+		Com_Printf( "jobtest: snapshots of %i clients match on %i jobs\n", numClients, numJobs );
+	}
+
+	Z_Free( serialBuffers );
+	Z_Free( serial );
+
+	return ok;
+}
+
 /*
 =======================
 SV_SendClientMessages
@@ -647,6 +1086,13 @@ void SV_SendClientMessages(void)
 {
 	int		i;
 	client_t	*c;
+	client_t	*snapshotClients[MAX_CLIENTS];
+	int		numSnapshotClients;
+
+	numSnapshotClients = 0;
+
+	// hand all snapshots to the kernel together
+	NET_BeginPacketBatch();
 
 	// send a message to each connected client
 	for(i=0; i < sv_maxclients->integer; i++)
@@ -681,9 +1127,21 @@ void SV_SendClientMessages(void)
 			}
 		}
 
+		if(sv_snapshotThreads->integer > 0 && Job_NumThreads() > 1)
+		{
+			// built and sent together below
+			snapshotClients[numSnapshotClients++] = c;
+			continue;
+		}
+
 		// generate and send a new message
 		SV_SendClientSnapshot(c);
 		c->lastSnapshotTime = svs.time;
 		c->rateDelayed = qfalse;
 	}
+
+	if(numSnapshotClients)
+		SV_SendClientSnapshots(snapshotClients, numSnapshotClients);
+
+	NET_EndPacketBatch();
 }
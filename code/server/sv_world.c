@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // world.c -- world query functions
 
 #include "server.h"
+#include "../platform/sys_public.h"
 
 /*
 ================
@@ -32,18 +33,22 @@ given entity.  If the entity is a bsp model, the headnode will
 be returned, otherwise a custom box tree will be constructed.
 ================
 */
-clipHandle_t SV_ClipHandleForEntity( const sharedEntity_t *ent ) {
+static clipHandle_t SV_ClipHandleForEntityContext( cmTraceContext_t *ctx, const sharedEntity_t *ent ) {
 	if ( ent->r.bmodel ) {
 		// explicit hulls in the BSP model
 		return CM_InlineModel( ent->s.modelindex );
 	}
 	if ( ent->r.svFlags & SVF_CAPSULE ) {
 		// create a temp capsule from bounding box sizes
-		return CM_TempBoxModel( ent->r.mins, ent->r.maxs, qtrue );
+		return CM_TempBoxModelContext( ctx, ent->r.mins, ent->r.maxs, qtrue );
 	}
 
 	// create a temp tree from bounding box sizes
-	return CM_TempBoxModel( ent->r.mins, ent->r.maxs, qfalse );
+	return CM_TempBoxModelContext( ctx, ent->r.mins, ent->r.maxs, qfalse );
+}
+
+clipHandle_t SV_ClipHandleForEntity( const sharedEntity_t *ent ) {
+	return SV_ClipHandleForEntityContext( NULL, ent );
 }
 
 
@@ -54,88 +59,399 @@ clipHandle_t SV_ClipHandleForEntity( const sharedEntity_t *ent ) {
 ENTITY CHECKING
 
 To avoid linearly searching through lists of entities during environment testing,
-the world is carved up with an evenly spaced, axially aligned bsp tree.  Entities
-are kept in chains either at the final leafs, or at the first node that splits
-them, which prevents having to deal with multiple fragments of a single entity.
+the world is covered by an adaptive loose octree.  An entity goes in the cell that
+holds its center, as deep as the cell is still at least as large as the entity, so
+it pokes out by no more than half the cell and never has to be split.  A cell only
+gets octants once more than WORLD_NODE_SPLIT entities are crowding it, and they are
+folded back when the subtree has emptied out, so crowded spots are subdivided
+finely while the rest of the world stays a handful of cells.
+
+Every cell remembers how far the boxes below it reach out of it, which keeps the
+queries from visiting the neighbours of a cell that only holds small entities.
+Relinking an entity that stays in its cell only refreshes its box, and subtrees
+with nothing linked in them are skipped.
 
 ===============================================================================
 */
 
-typedef struct worldSector_s {
-	int		axis;		// -1 = leaf node
-	float	dist;
-	struct worldSector_s	*children[2];
-	svEntity_t	*entities;
-} worldSector_t;
+#define	WORLD_TREE_DEPTH	8
+#define	WORLD_TREE_NODES	4096
+#define	WORLD_NODE_SPLIT	16		// entities directly in a cell before it gets octants
+#define	WORLD_NODE_MERGE	8		// entities left under a cell before they are folded back
+
+typedef struct worldNode_s {
+	vec3_t		center;
+	float		halfSize;
+	vec3_t		mins, maxs;			// of the cell
+	float		reach;				// how far the boxes below stick out of the cell
+	int			depth;
+	qboolean	split;				// entities that fit go down into the octants
+	int			numDirect;			// linked in this cell
+	int			numEntities;		// linked here or further down
+	int			entities;			// first entity number, -1 if none
+	struct worldNode_s	*parent;
+	struct worldNode_s	*children[8];
+} worldNode_t;
 
-#define	AREA_DEPTH	4
-#define	AREA_NODES	64
+typedef struct {
+	worldNode_t	nodes[WORLD_TREE_NODES];
+	worldNode_t	*freeNodes;						// chained through parent
+
+	worldNode_t	*entityNode[MAX_GENTITIES];		// NULL when not linked
+	int			nextEntity[MAX_GENTITIES];
+	int			prevEntity[MAX_GENTITIES];
+	vec3_t		absmin[MAX_GENTITIES];			// copied at link time for the queries
+	vec3_t		absmax[MAX_GENTITIES];
+} worldTree_t;
 
-worldSector_t	sv_worldSectors[AREA_NODES];
-int			sv_numworldSectors;
+static worldTree_t	sv_world;
 
 
 /*
 ===============
-SV_SectorList_f
+SV_InitWorldTree
+
+Puts a cube around the given bounds, the root is always searched
+so entities poking out of the world are still found
 ===============
 */
-void SV_SectorList_f( void ) {
-	int				i, c;
-	worldSector_t	*sec;
-	svEntity_t		*ent;
+static void SV_InitWorldTree( worldTree_t *tree, const vec3_t mins, const vec3_t maxs ) {
+	worldNode_t	*root;
+	int			i;
 
-	for ( i = 0 ; i < AREA_NODES ; i++ ) {
-		sec = &sv_worldSectors[i];
+	memset( tree, 0, sizeof( *tree ) );
 
-		c = 0;
-		for ( ent = sec->entities ; ent ; ent = ent->nextEntityInWorldSector ) {
-			c++;
+	for ( i = WORLD_TREE_NODES - 1 ; i > 0 ; i-- ) {
+		tree->nodes[i].parent = tree->freeNodes;
+		tree->freeNodes = &tree->nodes[i];
+	}
+
+	root = &tree->nodes[0];
+	root->halfSize = 1;
+	for ( i = 0 ; i < 3 ; i++ ) {
+		root->center[i] = 0.5f * ( mins[i] + maxs[i] );
+		if ( 0.5f * ( maxs[i] - mins[i] ) > root->halfSize ) {
+			root->halfSize = 0.5f * ( maxs[i] - mins[i] );
 		}
-		Com_Printf( "sector %i: %i entities\n", i, c );
 	}
+	for ( i = 0 ; i < 3 ; i++ ) {
+		root->mins[i] = root->center[i] - root->halfSize;
+		root->maxs[i] = root->center[i] + root->halfSize;
+	}
+	root->entities = -1;
 }
 
 /*
 ===============
-SV_CreateworldSector
+SV_WorldTreeOctant
 
-Builds a uniformly subdivided tree for the given world size
+Returns the octant of a split node that the given box belongs in,
+creating it if needed, or NULL if the box stays in the node
 ===============
 */
-static worldSector_t *SV_CreateworldSector( int depth, vec3_t mins, vec3_t maxs ) {
-	worldSector_t	*anode;
-	vec3_t		size;
-	vec3_t		mins1, maxs1, mins2, maxs2;
+static worldNode_t *SV_WorldTreeOctant( worldTree_t *tree, worldNode_t *node, const vec3_t mins, const vec3_t maxs ) {
+	worldNode_t	*child;
+	vec3_t		center;
+	int			i, octant;
+
+	octant = 0;
+	for ( i = 0 ; i < 3 ; i++ ) {
+		// an octant only holds what isn't larger than it
+		if ( maxs[i] - mins[i] > node->halfSize ) {
+			return NULL;
+		}
+		center[i] = 0.5f * ( mins[i] + maxs[i] );
+		if ( center[i] < node->mins[i] || center[i] > node->maxs[i] ) {
+			return NULL;
+		}
+		if ( center[i] >= node->center[i] ) {
+			octant |= 1 << i;
+		}
+	}
 
-	anode = &sv_worldSectors[sv_numworldSectors];
-	sv_numworldSectors++;
+	child = node->children[octant];
+	if ( child ) {
+		return child;
+	}
 
-	if (depth == AREA_DEPTH) {
-		anode->axis = -1;
-		anode->children[0] = anode->children[1] = NULL;
-		return anode;
+	child = tree->freeNodes;
+	if ( !child ) {
+		return NULL;
 	}
-	
-	VectorSubtract (maxs, mins, size);
-	if (size[0] > size[1]) {
-		anode->axis = 0;
+	tree->freeNodes = child->parent;
+	memset( child, 0, sizeof( *child ) );
+
+	child->halfSize = node->halfSize * 0.5f;
+	for ( i = 0 ; i < 3 ; i++ ) {
+		child->center[i] = node->center[i] + ( ( octant & ( 1 << i ) ) ? child->halfSize : -child->halfSize );
+		child->mins[i] = child->center[i] - child->halfSize;
+		child->maxs[i] = child->center[i] + child->halfSize;
+	}
+	child->depth = node->depth + 1;
+	child->entities = -1;
+	child->parent = node;
+	node->children[octant] = child;
+
+	return child;
+}
+
+/*
+===============
+SV_WorldTreeNodeForBounds
+===============
+*/
+static worldNode_t *SV_WorldTreeNodeForBounds( worldTree_t *tree, const vec3_t mins, const vec3_t maxs ) {
+	worldNode_t	*node, *child;
+
+	node = &tree->nodes[0];
+	while ( node->split ) {
+		child = SV_WorldTreeOctant( tree, node, mins, maxs );
+		if ( !child ) {
+			break;
+		}
+		node = child;
+	}
+
+	return node;
+}
+
+/*
+===============
+SV_WorldTreeReach
+
+Grows the reach of the cell holding num and its parents to cover its box,
+a parent always reaches at least as far as its octants
+===============
+*/
+static void SV_WorldTreeReach( worldTree_t *tree, worldNode_t *node, int num ) {
+	worldNode_t	*n;
+	float		reach;
+	int			i;
+
+	reach = 0;
+	for ( i = 0 ; i < 3 ; i++ ) {
+		if ( tree->absmax[num][i] - node->maxs[i] > reach ) {
+			reach = tree->absmax[num][i] - node->maxs[i];
+		}
+		if ( node->mins[i] - tree->absmin[num][i] > reach ) {
+			reach = node->mins[i] - tree->absmin[num][i];
+		}
+	}
+	for ( n = node ; n && n->reach < reach ; n = n->parent ) {
+		n->reach = reach;
+	}
+}
+
+/*
+===============
+SV_WorldTreeInsert
+===============
+*/
+static void SV_WorldTreeInsert( worldTree_t *tree, worldNode_t *node, int num ) {
+	worldNode_t	*n;
+
+	tree->entityNode[num] = node;
+	tree->prevEntity[num] = -1;
+	tree->nextEntity[num] = node->entities;
+	if ( node->entities != -1 ) {
+		tree->prevEntity[node->entities] = num;
+	}
+	node->entities = num;
+	node->numDirect++;
+
+	for ( n = node ; n ; n = n->parent ) {
+		n->numEntities++;
+	}
+
+	SV_WorldTreeReach( tree, node, num );
+}
+
+/*
+===============
+SV_WorldTreeRemove
+===============
+*/
+static void SV_WorldTreeRemove( worldTree_t *tree, int num ) {
+	worldNode_t	*node, *n;
+
+	node = tree->entityNode[num];
+	tree->entityNode[num] = NULL;
+
+	if ( tree->prevEntity[num] == -1 ) {
+		node->entities = tree->nextEntity[num];
 	} else {
-		anode->axis = 1;
+		tree->nextEntity[tree->prevEntity[num]] = tree->nextEntity[num];
+	}
+	if ( tree->nextEntity[num] != -1 ) {
+		tree->prevEntity[tree->nextEntity[num]] = tree->prevEntity[num];
 	}
+	node->numDirect--;
 
-	anode->dist = 0.5 * (maxs[anode->axis] + mins[anode->axis]);
-	VectorCopy (mins, mins1);	
-	VectorCopy (mins, mins2);	
-	VectorCopy (maxs, maxs1);	
-	VectorCopy (maxs, maxs2);	
-	
-	maxs1[anode->axis] = mins2[anode->axis] = anode->dist;
-	
-	anode->children[0] = SV_CreateworldSector (depth+1, mins2, maxs2);
-	anode->children[1] = SV_CreateworldSector (depth+1, mins1, maxs1);
+	for ( n = node ; n ; n = n->parent ) {
+		if ( !--n->numEntities ) {
+			n->reach = 0;
+		}
+	}
+}
 
-	return anode;
+/*
+===============
+SV_WorldTreeSplit
+
+Pushes the entities of a crowded cell down into its octants
+===============
+*/
+static void SV_WorldTreeSplit( worldTree_t *tree, worldNode_t *node ) {
+	worldNode_t	*child;
+	int			e, next;
+
+	node->split = qtrue;
+
+	for ( e = node->entities ; e != -1 ; e = next ) {
+		next = tree->nextEntity[e];
+
+		child = SV_WorldTreeOctant( tree, node, tree->absmin[e], tree->absmax[e] );
+		if ( child ) {
+			SV_WorldTreeRemove( tree, e );
+			SV_WorldTreeInsert( tree, child, e );
+		}
+	}
+}
+
+/*
+===============
+SV_WorldTreeCollapse_r
+
+Moves everything below node up into dest and frees the octants
+===============
+*/
+static void SV_WorldTreeCollapse_r( worldTree_t *tree, worldNode_t *node, worldNode_t *dest ) {
+	worldNode_t	*child;
+	int			i;
+
+	for ( i = 0 ; i < 8 ; i++ ) {
+		child = node->children[i];
+		if ( !child ) {
+			continue;
+		}
+		SV_WorldTreeCollapse_r( tree, child, dest );
+
+		while ( child->entities != -1 ) {
+			int e = child->entities;
+			SV_WorldTreeRemove( tree, e );
+			SV_WorldTreeInsert( tree, dest, e );
+		}
+
+		node->children[i] = NULL;
+		child->parent = tree->freeNodes;
+		tree->freeNodes = child;
+	}
+	node->split = qfalse;
+}
+
+/*
+===============
+SV_WorldTreeUnlink
+===============
+*/
+static void SV_WorldTreeUnlink( worldTree_t *tree, int num ) {
+	worldNode_t	*node, *n, *collapse;
+
+	node = tree->entityNode[num];
+	if ( !node ) {
+		return;
+	}
+	SV_WorldTreeRemove( tree, num );
+
+	// fold back the largest subtree that has emptied out
+	collapse = NULL;
+	for ( n = node ; n ; n = n->parent ) {
+		if ( n->split && n->numEntities <= WORLD_NODE_MERGE ) {
+			collapse = n;
+		}
+	}
+	if ( collapse ) {
+		SV_WorldTreeCollapse_r( tree, collapse, collapse );
+	}
+}
+
+/*
+===============
+SV_WorldTreeLink
+
+Most entities are relinked every frame without leaving their cell,
+those only get their box refreshed
+===============
+*/
+static void SV_WorldTreeLink( worldTree_t *tree, int num, const vec3_t absmin, const vec3_t absmax ) {
+	worldNode_t	*node;
+
+	VectorCopy( absmin, tree->absmin[num] );
+	VectorCopy( absmax, tree->absmax[num] );
+
+	node = SV_WorldTreeNodeForBounds( tree, absmin, absmax );
+	if ( node == tree->entityNode[num] ) {
+		SV_WorldTreeReach( tree, node, num );
+		return;
+	}
+
+	if ( tree->entityNode[num] ) {
+		// unlinking may fold the cell it was headed for
+		SV_WorldTreeUnlink( tree, num );
+		node = SV_WorldTreeNodeForBounds( tree, absmin, absmax );
+	}
+	SV_WorldTreeInsert( tree, node, num );
+
+	if ( !node->split && node->numDirect > WORLD_NODE_SPLIT && node->depth < WORLD_TREE_DEPTH - 1 ) {
+		SV_WorldTreeSplit( tree, node );
+	}
+}
+
+
+/*
+===============
+SV_SectorList_r
+===============
+*/
+static void SV_SectorList_r( const worldNode_t *node, int *cells, int *entities, int *most ) {
+	int		i;
+
+	cells[node->depth]++;
+	entities[node->depth] += node->numDirect;
+	if ( node->numDirect > *most ) {
+		*most = node->numDirect;
+	}
+
+	for ( i = 0 ; i < 8 ; i++ ) {
+		if ( node->children[i] ) {
+			SV_SectorList_r( node->children[i], cells, entities, most );
+		}
+	}
+}
+
+/*
+===============
+SV_SectorList_f
+===============
+*/
+void SV_SectorList_f( void ) {
+	int		depth, total, most;
+	int		cells[WORLD_TREE_DEPTH], entities[WORLD_TREE_DEPTH];
+
+	memset( cells, 0, sizeof( cells ) );
+	memset( entities, 0, sizeof( entities ) );
+	most = 0;
+
+	SV_SectorList_r( &sv_world.nodes[0], cells, entities, &most );
+
+	total = 0;
+	for ( depth = 0 ; depth < WORLD_TREE_DEPTH ; depth++ ) {
+		if ( cells[depth] ) {
+			Com_Printf( "depth %i: %4i cells %4i entities\n", depth, cells[depth], entities[depth] );
+		}
+		total += cells[depth];
+	}
+	Com_Printf( "%i of %i cells, at most %i entities in one\n", total, WORLD_TREE_NODES, most );
 }
 
 /*
@@ -148,50 +464,83 @@ void SV_ClearWorld( void ) {
 	clipHandle_t	h;
 	vec3_t			mins, maxs;
 
-	memset( sv_worldSectors, 0, sizeof(sv_worldSectors) );
-	sv_numworldSectors = 0;
+	memset( sv.entityVis.linked, 0, sizeof( sv.entityVis.linked ) );
 
 	// get world map bounds
 	h = CM_InlineModel( 0 );
 	CM_ModelBounds( h, mins, maxs );
-	SV_CreateworldSector( 0, mins, maxs );
+	SV_InitWorldTree( &sv_world, mins, maxs );
 }
 
 
 /*
 ===============
-SV_UnlinkEntity
+SV_ClearEntityVis
+===============
+*/
+static void SV_ClearEntityVis( int num ) {
+	sv.entityVis.linked[num >> 6] &= ~( (uint64_t)1 << ( num & 63 ) );
+}
+
+/*
+===============
+SV_UpdateEntityVis
 
+Copies the areas of a freshly linked entity and turns its clusters into
+masks over the 64 bit words of a pvs row
 ===============
 */
-void SV_UnlinkEntity( sharedEntity_t *gEnt ) {
-	svEntity_t		*ent;
-	svEntity_t		*scan;
-	worldSector_t	*ws;
+static void SV_UpdateEntityVis( int num, const svEntity_t *ent ) {
+	svEntityVis_t	*vis = &sv.entityVis;
+	byte		mask[8];
+	uint64_t	bits;
+	int			i, j, cluster, word;
+
+	vis->areanum[num] = ent->areanum;
+	vis->areanum2[num] = ent->areanum2;
+	vis->clustersOverflowed[num] = ( ent->lastCluster != 0 );
+	vis->numClusterWords[num] = 0;
+
+	for ( i = 0 ; i < ent->numClusters ; i++ ) {
+		cluster = ent->clusternums[i];
+		word = cluster >> 6;
+
+		// built bytewise so the mask matches the row in memory order
+		memset( mask, 0, sizeof( mask ) );
+		mask[( cluster >> 3 ) & 7] = 1 << ( cluster & 7 );
+		memcpy( &bits, mask, sizeof( bits ) );
+
+		for ( j = 0 ; j < vis->numClusterWords[num] ; j++ ) {
+			if ( vis->clusterWord[num][j] == word ) {
+				break;
+			}
+		}
+		if ( j == vis->numClusterWords[num] ) {
+			vis->clusterWord[num][j] = word;
+			vis->clusterMask[num][j] = 0;
+			vis->numClusterWords[num]++;
+		}
+		vis->clusterMask[num][j] |= bits;
+	}
 
-	ent = SV_SvEntityForGentity( gEnt );
+	vis->linked[num >> 6] |= (uint64_t)1 << ( num & 63 );
+}
 
-	gEnt->r.linked = qfalse;
 
-	ws = ent->worldSector;
-	if ( !ws ) {
-		return;		// not linked in anywhere
-	}
-	ent->worldSector = NULL;
+/*
+===============
+SV_UnlinkEntity
 
-	if ( ws->entities == ent ) {
-		ws->entities = ent->nextEntityInWorldSector;
-		return;
-	}
+===============
+*/
+void SV_UnlinkEntity( sharedEntity_t *gEnt ) {
+	int		num;
 
-	for ( scan = ws->entities ; scan ; scan = scan->nextEntityInWorldSector ) {
-		if ( scan->nextEntityInWorldSector == ent ) {
-			scan->nextEntityInWorldSector = ent->nextEntityInWorldSector;
-			return;
-		}
-	}
+	num = SV_NumForGentity( gEnt );
 
-	Com_Printf( "WARNING: SV_UnlinkEntity: not found in worldSector\n" );
+	gEnt->r.linked = qfalse;
+	SV_ClearEntityVis( num );
+	SV_WorldTreeUnlink( &sv_world, num );
 }
 
 
@@ -203,7 +552,6 @@ SV_LinkEntity
 */
 #define MAX_TOTAL_ENT_LEAFS		128
 void SV_LinkEntity( sharedEntity_t *gEnt ) {
-	worldSector_t	*node;
 	int			leafs[MAX_TOTAL_ENT_LEAFS];
 	int			cluster;
 	int			num_leafs;
@@ -215,10 +563,6 @@ void SV_LinkEntity( sharedEntity_t *gEnt ) {
 
 	ent = SV_SvEntityForGentity( gEnt );
 
-	if ( ent->worldSector ) {
-		SV_UnlinkEntity( gEnt );	// unlink from old position
-	}
-
 	// encode the size into the entityState_t for client prediction
 	if ( gEnt->r.bmodel ) {
 		gEnt->s.solid = SOLID_BMODEL;		// a solid_box will never create this value
@@ -291,6 +635,7 @@ void SV_LinkEntity( sharedEntity_t *gEnt ) {
 	// if none of the leafs were inside the map, the
 	// entity is outside the world and can be considered unlinked
 	if ( !num_leafs ) {
+		SV_UnlinkEntity( gEnt );
 		return;
 	}
 
@@ -332,26 +677,11 @@ void SV_LinkEntity( sharedEntity_t *gEnt ) {
 
 	gEnt->r.linkcount++;
 
-	// find the first world sector node that the ent's box crosses
-	node = sv_worldSectors;
-	while (1)
-	{
-		if (node->axis == -1)
-			break;
-		if ( gEnt->r.absmin[node->axis] > node->dist)
-			node = node->children[0];
-		else if ( gEnt->r.absmax[node->axis] < node->dist)
-			node = node->children[1];
-		else
-			break;		// crosses the node
-	}
-	
-	// link it in
-	ent->worldSector = node;
-	ent->nextEntityInWorldSector = node->entities;
-	node->entities = ent;
+	// stays where it is if it didn't leave its cell
+	SV_WorldTreeLink( &sv_world, SV_NumForGentity( gEnt ), gEnt->r.absmin, gEnt->r.absmax );
 
 	gEnt->r.linked = qtrue;
+	SV_UpdateEntityVis( SV_NumForGentity( gEnt ), ent );
 }
 
 /*
@@ -376,46 +706,52 @@ typedef struct {
 ====================
 SV_AreaEntities_r
 
+Returns qfalse once the list is full
 ====================
 */
-static void SV_AreaEntities_r( worldSector_t *node, areaParms_t *ap ) {
-	svEntity_t	*check, *next;
-	sharedEntity_t *gcheck;
+static qboolean SV_AreaEntities_r( const worldTree_t *tree, const worldNode_t *node, areaParms_t *ap ) {
+	int		e, i;
 
-	for ( check = node->entities  ; check ; check = next ) {
-		next = check->nextEntityInWorldSector;
+	if ( !node->numEntities ) {
+		return qtrue;
+	}
 
-		gcheck = SV_GEntityForSvEntity( check );
+	// the root also holds whatever is centered outside of it
+	if ( node->parent && ( node->mins[0] - node->reach > ap->maxs[0]
+	|| node->mins[1] - node->reach > ap->maxs[1]
+	|| node->mins[2] - node->reach > ap->maxs[2]
+	|| node->maxs[0] + node->reach < ap->mins[0]
+	|| node->maxs[1] + node->reach < ap->mins[1]
+	|| node->maxs[2] + node->reach < ap->mins[2] ) ) {
+		return qtrue;
+	}
 
-		if ( gcheck->r.absmin[0] > ap->maxs[0]
-		|| gcheck->r.absmin[1] > ap->maxs[1]
-		|| gcheck->r.absmin[2] > ap->maxs[2]
-		|| gcheck->r.absmax[0] < ap->mins[0]
-		|| gcheck->r.absmax[1] < ap->mins[1]
-		|| gcheck->r.absmax[2] < ap->mins[2]) {
+	for ( e = node->entities ; e != -1 ; e = tree->nextEntity[e] ) {
+		if ( tree->absmin[e][0] > ap->maxs[0]
+		|| tree->absmin[e][1] > ap->maxs[1]
+		|| tree->absmin[e][2] > ap->maxs[2]
+		|| tree->absmax[e][0] < ap->mins[0]
+		|| tree->absmax[e][1] < ap->mins[1]
+		|| tree->absmax[e][2] < ap->mins[2] ) {
 			continue;
 		}
 
 		if ( ap->count == ap->maxcount ) {
 			Com_Printf ("SV_AreaEntities: MAXCOUNT\n");
-			return;
+			return qfalse;
 		}
 
-		ap->list[ap->count] = check - sv.svEntities;
+		ap->list[ap->count] = e;
 		ap->count++;
 	}
-	
-	if (node->axis == -1) {
-		return;		// terminal node
-	}
 
-	// recurse down both sides
-	if ( ap->maxs[node->axis] > node->dist ) {
-		SV_AreaEntities_r ( node->children[0], ap );
-	}
-	if ( ap->mins[node->axis] < node->dist ) {
-		SV_AreaEntities_r ( node->children[1], ap );
+	for ( i = 0 ; i < 8 ; i++ ) {
+		if ( node->children[i] && !SV_AreaEntities_r( tree, node->children[i], ap ) ) {
+			return qfalse;
+		}
 	}
+
+	return qtrue;
 }
 
 /*
@@ -432,7 +768,7 @@ int SV_AreaEntities( const vec3_t mins, const vec3_t maxs, int *entityList, int
 	ap.count = 0;
 	ap.maxcount = maxcount;
 
-	SV_AreaEntities_r( sv_worldSectors, &ap );
+	SV_AreaEntities_r( &sv_world, &sv_world.nodes[0], &ap );
 
 	return ap.count;
 }
@@ -499,21 +835,20 @@ void SV_ClipToEntity( trace_t *trace, const vec3_t start, const vec3_t mins, con
 
 /*
 ====================
-SV_ClipMoveToEntities
+SV_ClipMoveToEntityList
 
+Clips the move against the entities in touchlist that overlap its box,
+the list may have been gathered for a larger area.
 ====================
 */
-static void SV_ClipMoveToEntities( moveclip_t *clip ) {
-	int			i, num;
-	int			touchlist[MAX_GENTITIES];
+static void SV_ClipMoveToEntityList( cmTraceContext_t *ctx, moveclip_t *clip, const int *touchlist, int num ) {
+	int			i;
 	sharedEntity_t *touch;
 	int			passOwnerNum;
 	trace_t		trace;
 	clipHandle_t	clipHandle;
 	float		*origin, *angles;
 
-	num = SV_AreaEntities( clip->boxmins, clip->boxmaxs, touchlist, MAX_GENTITIES);
-
 	if ( clip->passEntityNum != ENTITYNUM_NONE ) {
 		passOwnerNum = ( SV_GentityNum( clip->passEntityNum ) )->r.ownerNum;
 		if ( passOwnerNum == ENTITYNUM_NONE ) {
@@ -529,6 +864,15 @@ static void SV_ClipMoveToEntities( moveclip_t *clip ) {
 		}
 		touch = SV_GentityNum( touchlist[i] );
 
+		if ( touch->r.absmin[0] > clip->boxmaxs[0]
+		|| touch->r.absmin[1] > clip->boxmaxs[1]
+		|| touch->r.absmin[2] > clip->boxmaxs[2]
+		|| touch->r.absmax[0] < clip->boxmins[0]
+		|| touch->r.absmax[1] < clip->boxmins[1]
+		|| touch->r.absmax[2] < clip->boxmins[2] ) {
+			continue;
+		}
+
 		// see if we should ignore this entity
 		if ( clip->passEntityNum != ENTITYNUM_NONE ) {
 			if ( touchlist[i] == clip->passEntityNum ) {
@@ -549,7 +893,7 @@ static void SV_ClipMoveToEntities( moveclip_t *clip ) {
 		}
 
 		// might intersect, so do an exact clip
-		clipHandle = SV_ClipHandleForEntity (touch);
+		clipHandle = SV_ClipHandleForEntityContext( ctx, touch );
 
 		origin = touch->r.currentOrigin;
 		angles = touch->r.currentAngles;
@@ -559,7 +903,7 @@ static void SV_ClipMoveToEntities( moveclip_t *clip ) {
 			angles = vec3_origin;	// boxes don't rotate
 		}
 
-		CM_TransformedBoxTrace ( &trace, (float *)clip->start, (float *)clip->end,
+		CM_TransformedBoxTraceContext ( ctx, &trace, (float *)clip->start, (float *)clip->end,
 			(float *)clip->mins, (float *)clip->maxs, clipHandle,  clip->contentmask,
 			origin, angles, clip->capsule);
 
@@ -586,15 +930,13 @@ static void SV_ClipMoveToEntities( moveclip_t *clip ) {
 
 
 /*
-==================
-SV_Trace
+====================
+SV_SetupMoveClip
 
-Moves the given mins/maxs volume through the world from start to end.
-passEntityNum and entities owned by passEntityNum are explicitly not checked.
-==================
+Fills in the parameters and the bounding box of the entire move
+====================
 */
-void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule ) {
-	moveclip_t	clip;
+static void SV_SetupMoveClip( moveclip_t *clip, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule ) {
 	int			i;
 
 	if ( !mins ) {
@@ -604,24 +946,16 @@ void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, c
 		maxs = vec3_origin;
 	}
 
-	memset ( &clip, 0, sizeof ( moveclip_t ) );
+	memset ( clip, 0, sizeof ( moveclip_t ) );
 
-	// clip to world
-	CM_BoxTrace( &clip.trace, start, end, mins, maxs, 0, contentmask, capsule );
-	clip.trace.entityNum = clip.trace.fraction != 1.0 ? ENTITYNUM_WORLD : ENTITYNUM_NONE;
-	if ( clip.trace.fraction == 0 ) {
-		*results = clip.trace;
-		return;		// blocked immediately by the world
-	}
-
-	clip.contentmask = contentmask;
-	clip.start = start;
-//	VectorCopy( clip.trace.endpos, clip.end );
-	VectorCopy( end, clip.end );
-	clip.mins = mins;
-	clip.maxs = maxs;
-	clip.passEntityNum = passEntityNum;
-	clip.capsule = capsule;
+	clip->contentmask = contentmask;
+	clip->start = start;
+//	VectorCopy( clip->trace.endpos, clip->end );
+	VectorCopy( end, clip->end );
+	clip->mins = mins;
+	clip->maxs = maxs;
+	clip->passEntityNum = passEntityNum;
+	clip->capsule = capsule;
 
 	// create the bounding box of the entire move
 	// we can limit it to the part of the move not
@@ -629,21 +963,126 @@ void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, c
 	// a significant savings for line of sight and shot traces
 	for ( i=0 ; i<3 ; i++ ) {
 		if ( end[i] > start[i] ) {
-			clip.boxmins[i] = clip.start[i] + clip.mins[i] - 1;
-			clip.boxmaxs[i] = clip.end[i] + clip.maxs[i] + 1;
+			clip->boxmins[i] = clip->start[i] + clip->mins[i] - 1;
+			clip->boxmaxs[i] = clip->end[i] + clip->maxs[i] + 1;
 		} else {
-			clip.boxmins[i] = clip.end[i] + clip.mins[i] - 1;
-			clip.boxmaxs[i] = clip.start[i] + clip.maxs[i] + 1;
+			clip->boxmins[i] = clip->end[i] + clip->mins[i] - 1;
+			clip->boxmaxs[i] = clip->start[i] + clip->maxs[i] + 1;
 		}
 	}
+}
+
+
+/*
+====================
+SV_ClipMoveToWorld
+
+Returns qfalse if the move is blocked immediately by the world,
+so there is no need to check entities
+====================
+*/
+static qboolean SV_ClipMoveToWorld( cmTraceContext_t *ctx, moveclip_t *clip ) {
+	CM_BoxTraceContext( ctx, &clip->trace, clip->start, clip->end, (float *)clip->mins, (float *)clip->maxs,
+		0, clip->contentmask, clip->capsule );
+	clip->trace.entityNum = clip->trace.fraction != 1.0 ? ENTITYNUM_WORLD : ENTITYNUM_NONE;
+
+	return clip->trace.fraction != 0;
+}
+
 
-	// clip to other solid entities
-	SV_ClipMoveToEntities ( &clip );
+/*
+==================
+SV_Trace
+
+Moves the given mins/maxs volume through the world from start to end.
+passEntityNum and entities owned by passEntityNum are explicitly not checked.
+==================
+*/
+void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule ) {
+	moveclip_t	clip;
+	int			touchlist[MAX_GENTITIES];
+	int			num;
+
+	SV_SetupMoveClip( &clip, start, mins, maxs, end, passEntityNum, contentmask, capsule );
+
+	// clip to world
+	if ( SV_ClipMoveToWorld( NULL, &clip ) ) {
+		// clip to other solid entities
+		num = SV_AreaEntities( clip.boxmins, clip.boxmaxs, touchlist, MAX_GENTITIES );
+		SV_ClipMoveToEntityList( NULL, &clip, touchlist, num );
+	}
 
 	*results = clip.trace;
 }
 
 
+/*
+==================
+SV_TraceBatch
+
+Same as calling SV_Trace for every request. Consecutive requests whose
+moves overlap are grouped and share a single SV_AreaEntities walk over
+the union of their boxes, which is the common case for the several
+traces a game function fires from one spot.
+==================
+*/
+void SV_TraceBatch( const traceRequest_t *requests, trace_t *results, int count ) {
+	moveclip_t	clips[MAX_TRACE_BATCH];
+	int			touchlist[MAX_GENTITIES];
+	vec3_t		mins, maxs;
+	int			first, last, i, num;
+
+	if ( count < 0 || count > MAX_TRACE_BATCH ) {
+		Com_Error( ERR_DROP, "SV_TraceBatch: bad count %i", count );
+	}
+
+	for ( i = 0 ; i < count ; i++ ) {
+		SV_SetupMoveClip( &clips[i], requests[i].start, requests[i].mins, requests[i].maxs, requests[i].end,
+			requests[i].passEntityNum, requests[i].contentmask, requests[i].capsule );
+	}
+
+	for ( first = 0 ; first < count ; first = last ) {
+		VectorCopy( clips[first].boxmins, mins );
+		VectorCopy( clips[first].boxmaxs, maxs );
+
+		// grow the group while the next move overlaps it
+		for ( last = first + 1 ; last < count ; last++ ) {
+			if ( clips[last].boxmins[0] > maxs[0]
+			|| clips[last].boxmins[1] > maxs[1]
+			|| clips[last].boxmins[2] > maxs[2]
+			|| clips[last].boxmaxs[0] < mins[0]
+			|| clips[last].boxmaxs[1] < mins[1]
+			|| clips[last].boxmaxs[2] < mins[2] ) {
+				break;
+			}
+			for ( i = 0 ; i < 3 ; i++ ) {
+				if ( clips[last].boxmins[i] < mins[i] ) {
+					mins[i] = clips[last].boxmins[i];
+				}
+				if ( clips[last].boxmaxs[i] > maxs[i] ) {
+					maxs[i] = clips[last].boxmaxs[i];
+				}
+			}
+		}
+
+		num = -1;
+		for ( i = first ; i < last ; i++ ) {
+			if ( !SV_ClipMoveToWorld( NULL, &clips[i] ) ) {
+				continue;		// blocked immediately by the world
+			}
+			if ( num < 0 ) {
+				num = SV_AreaEntities( mins, maxs, touchlist, MAX_GENTITIES );
+			}
+			SV_ClipMoveToEntityList( NULL, &clips[i], touchlist, num );
+		}
+	}
+
+	for ( i = 0 ; i < count ; i++ ) {
+		results[i] = clips[i].trace;
+	}
+}
+
+
 
 /*
 =============
@@ -685,3 +1124,353 @@ int SV_PointContents( const vec3_t p, int passEntityNum ) {
 }
 
 
+
+
+/*
+===============================================================================
+
+WORLD BENCHMARK
+
+Replays the same entity movement and trace boxes through the loose octree
+and through the uniform sector tree it replaced, which split the world on
+x and y into AREA_NODES cells and kept everything crossing a split above it.
+
+===============================================================================
+*/
+
+#define	AREA_DEPTH	4
+#define	AREA_NODES	64
+
+typedef struct worldSector_s {
+	int		axis;		// -1 = leaf node
+	float	dist;
+	struct worldSector_s	*children[2];
+	int		entities;
+} worldSector_t;
+
+typedef struct {
+	worldSector_t	sectors[AREA_NODES];
+	int				numSectors;
+	worldSector_t	*entitySector[MAX_GENTITIES];
+	int				nextEntity[MAX_GENTITIES];
+} sectorTree_t;
+
+typedef struct {
+	worldTree_t		tree;
+	sectorTree_t	sectors;
+	vec3_t			homeMins[MAX_GENTITIES];		// where each entity bounces around
+	vec3_t			homeMaxs[MAX_GENTITIES];
+	vec3_t			origin[MAX_GENTITIES];
+	vec3_t			velocity[MAX_GENTITIES];
+	vec3_t			mins[MAX_GENTITIES];
+	vec3_t			maxs[MAX_GENTITIES];
+	vec3_t			absmin[MAX_GENTITIES];
+	vec3_t			absmax[MAX_GENTITIES];
+	int				list[MAX_GENTITIES];
+	unsigned		seed;
+} worldBench_t;
+
+/*
+===============
+SV_CreateWorldSector
+===============
+*/
+static worldSector_t *SV_CreateWorldSector( sectorTree_t *st, int depth, vec3_t mins, vec3_t maxs ) {
+	worldSector_t	*anode;
+	vec3_t		size;
+	vec3_t		mins1, maxs1, mins2, maxs2;
+
+	anode = &st->sectors[st->numSectors];
+	st->numSectors++;
+	anode->entities = -1;
+
+	if (depth == AREA_DEPTH) {
+		anode->axis = -1;
+		anode->children[0] = anode->children[1] = NULL;
+		return anode;
+	}
+
+	VectorSubtract (maxs, mins, size);
+	if (size[0] > size[1]) {
+		anode->axis = 0;
+	} else {
+		anode->axis = 1;
+	}
+
+	anode->dist = 0.5 * (maxs[anode->axis] + mins[anode->axis]);
+	VectorCopy (mins, mins1);
+	VectorCopy (mins, mins2);
+	VectorCopy (maxs, maxs1);
+	VectorCopy (maxs, maxs2);
+
+	maxs1[anode->axis] = mins2[anode->axis] = anode->dist;
+
+	anode->children[0] = SV_CreateWorldSector (st, depth+1, mins2, maxs2);
+	anode->children[1] = SV_CreateWorldSector (st, depth+1, mins1, maxs1);
+
+	return anode;
+}
+
+/*
+===============
+SV_SectorTreeLink
+===============
+*/
+static void SV_SectorTreeLink( sectorTree_t *st, int num, const vec3_t absmin, const vec3_t absmax ) {
+	worldSector_t	*node;
+	int				*scan;
+
+	node = st->entitySector[num];
+	if ( node ) {
+		for ( scan = &node->entities ; *scan != -1 ; scan = &st->nextEntity[*scan] ) {
+			if ( *scan == num ) {
+				*scan = st->nextEntity[num];
+				break;
+			}
+		}
+	}
+
+	node = st->sectors;
+	while ( node->axis != -1 ) {
+		if ( absmin[node->axis] > node->dist )
+			node = node->children[0];
+		else if ( absmax[node->axis] < node->dist )
+			node = node->children[1];
+		else
+			break;		// crosses the node
+	}
+
+	st->entitySector[num] = node;
+	st->nextEntity[num] = node->entities;
+	node->entities = num;
+}
+
+/*
+===============
+SV_SectorTreeQuery_r
+===============
+*/
+static int SV_SectorTreeQuery_r( const worldBench_t *wb, const worldSector_t *node, const vec3_t mins, const vec3_t maxs, int *list, int count ) {
+	int		e;
+
+	for ( e = node->entities ; e != -1 ; e = wb->sectors.nextEntity[e] ) {
+		if ( wb->absmin[e][0] > maxs[0]
+		|| wb->absmin[e][1] > maxs[1]
+		|| wb->absmin[e][2] > maxs[2]
+		|| wb->absmax[e][0] < mins[0]
+		|| wb->absmax[e][1] < mins[1]
+		|| wb->absmax[e][2] < mins[2] ) {
+			continue;
+		}
+		list[count++] = e;
+	}
+
+	if ( node->axis == -1 ) {
+		return count;
+	}
+	if ( maxs[node->axis] > node->dist ) {
+		count = SV_SectorTreeQuery_r( wb, node->children[0], mins, maxs, list, count );
+	}
+	if ( mins[node->axis] < node->dist ) {
+		count = SV_SectorTreeQuery_r( wb, node->children[1], mins, maxs, list, count );
+	}
+	return count;
+}
+
+/*
+===============
+SV_BenchRandom
+===============
+*/
+static float SV_BenchRandom( worldBench_t *wb ) {
+	wb->seed = wb->seed * 1103515245 + 12345;
+	return ( ( wb->seed >> 8 ) & 0xffff ) / 65535.0f;
+}
+
+/*
+===============
+SV_BenchSpawn
+
+Mostly missiles and items with some players, gibs and movers mixed in.
+Half of them crowd two tall bases at opposite corners, like a ctf map
+===============
+*/
+static void SV_BenchSpawn( worldBench_t *wb, int num, const vec3_t mins, const vec3_t maxs ) {
+	float	r, size, speed, corner;
+	int		i;
+
+	r = SV_BenchRandom( wb );
+	if ( r < 0.125f ) {
+		VectorSet( wb->mins[num], -15, -15, -24 );
+		VectorSet( wb->maxs[num], 15, 15, 32 );
+		speed = 320;
+	} else if ( r < 0.625f ) {
+		VectorClear( wb->mins[num] );
+		VectorClear( wb->maxs[num] );
+		speed = 900;
+	} else if ( r < 0.9375f ) {
+		size = 8 + 8 * SV_BenchRandom( wb );
+		VectorSet( wb->mins[num], -size, -size, -size );
+		VectorSet( wb->maxs[num], size, size, size );
+		speed = SV_BenchRandom( wb ) < 0.5f ? 0 : 400;
+	} else {
+		size = 64 + 64 * SV_BenchRandom( wb );
+		VectorSet( wb->mins[num], -size, -size, -size );
+		VectorSet( wb->maxs[num], size, size, size );
+		speed = 100;
+	}
+
+	VectorCopy( mins, wb->homeMins[num] );
+	VectorCopy( maxs, wb->homeMaxs[num] );
+	if ( SV_BenchRandom( wb ) < 0.5f ) {
+		corner = SV_BenchRandom( wb ) < 0.5f ? 0.125f : 0.875f;
+		for ( i = 0 ; i < 2 ; i++ ) {
+			wb->homeMins[num][i] = mins[i] + ( maxs[i] - mins[i] ) * corner - 384;
+			wb->homeMaxs[num][i] = mins[i] + ( maxs[i] - mins[i] ) * corner + 384;
+		}
+	}
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		wb->origin[num][i] = wb->homeMins[num][i] + ( wb->homeMaxs[num][i] - wb->homeMins[num][i] ) * SV_BenchRandom( wb );
+		wb->velocity[num][i] = speed * ( 2 * SV_BenchRandom( wb ) - 1 );
+	}
+}
+
+/*
+===============
+SV_BenchMove
+===============
+*/
+static void SV_BenchMove( worldBench_t *wb, int num ) {
+	const float	*mins = wb->homeMins[num], *maxs = wb->homeMaxs[num];
+	int		i;
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		wb->origin[num][i] += wb->velocity[num][i] * 0.05f;
+		if ( wb->origin[num][i] < mins[i] || wb->origin[num][i] > maxs[i] ) {
+			wb->velocity[num][i] = -wb->velocity[num][i];
+			wb->origin[num][i] = wb->origin[num][i] < mins[i] ? mins[i] : maxs[i];
+		}
+
+		// same epsilon as SV_LinkEntity
+		wb->absmin[num][i] = wb->origin[num][i] + wb->mins[num][i] - 1;
+		wb->absmax[num][i] = wb->origin[num][i] + wb->maxs[num][i] + 1;
+	}
+}
+
+/*
+===============
+SV_BenchQueryBounds
+
+The box of a trace from the entity, its next move for most of them
+and a long shot for one in eight
+===============
+*/
+static void SV_BenchQueryBounds( worldBench_t *wb, int num, vec3_t mins, vec3_t maxs ) {
+	vec3_t	end;
+	int		i;
+
+	if ( SV_BenchRandom( wb ) < 0.125f ) {
+		for ( i = 0 ; i < 3 ; i++ ) {
+			end[i] = wb->origin[num][i] + 8192 * ( 2 * SV_BenchRandom( wb ) - 1 );
+			mins[i] = ( end[i] < wb->origin[num][i] ? end[i] : wb->origin[num][i] ) - 1;
+			maxs[i] = ( end[i] > wb->origin[num][i] ? end[i] : wb->origin[num][i] ) + 1;
+		}
+		return;
+	}
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		end[i] = wb->origin[num][i] + wb->velocity[num][i] * 0.05f;
+		mins[i] = ( end[i] < wb->origin[num][i] ? end[i] : wb->origin[num][i] ) + wb->mins[num][i] - 1;
+		maxs[i] = ( end[i] > wb->origin[num][i] ? end[i] : wb->origin[num][i] ) + wb->maxs[num][i] + 1;
+	}
+}
+
+/*
+===============
+SV_WorldBench_f
+
+worldbench [entities] [frames]
+===============
+*/
+void SV_WorldBench_f( void ) {
+	worldBench_t	*wb;
+	areaParms_t		ap;
+	vec3_t			worldMins, worldMaxs, mins, maxs;
+	int				numEntities, frames, pass, frame, i, start;
+	int				msec[2], hits[2];
+	double			queries;
+
+	numEntities = 512;
+	frames = 1000;
+	if ( Cmd_Argc() > 1 ) {
+		numEntities = atoi( Cmd_Argv( 1 ) );
+	}
+	if ( Cmd_Argc() > 2 ) {
+		frames = atoi( Cmd_Argv( 2 ) );
+	}
+	numEntities = Com_Clamp( 1, ENTITYNUM_WORLD, numEntities );
+	if ( frames < 1 ) {
+		frames = 1;
+	}
+
+	if ( com_sv_running->integer ) {
+		CM_ModelBounds( CM_InlineModel( 0 ), worldMins, worldMaxs );
+	} else {
+		// a large map with some height to it
+		VectorSet( worldMins, -4096, -4096, -1024 );
+		VectorSet( worldMaxs, 4096, 4096, 3072 );
+	}
+
+	wb = Z_Malloc( sizeof( *wb ) );
+
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		SV_InitWorldTree( &wb->tree, worldMins, worldMaxs );
+		memset( &wb->sectors, 0, sizeof( wb->sectors ) );
+		SV_CreateWorldSector( &wb->sectors, 0, worldMins, worldMaxs );
+
+		wb->seed = 0x5e1d;
+		for ( i = 0 ; i < numEntities ; i++ ) {
+			SV_BenchSpawn( wb, i, worldMins, worldMaxs );
+		}
+
+		hits[pass] = 0;
+		start = Sys_Milliseconds();
+		for ( frame = 0 ; frame < frames ; frame++ ) {
+			for ( i = 0 ; i < numEntities ; i++ ) {
+				SV_BenchMove( wb, i );
+				if ( pass == 0 ) {
+					SV_WorldTreeLink( &wb->tree, i, wb->absmin[i], wb->absmax[i] );
+				} else {
+					SV_SectorTreeLink( &wb->sectors, i, wb->absmin[i], wb->absmax[i] );
+				}
+			}
+
+			for ( i = 0 ; i < numEntities ; i++ ) {
+				SV_BenchQueryBounds( wb, i, mins, maxs );
+				if ( pass == 0 ) {
+					ap.mins = mins;
+					ap.maxs = maxs;
+					ap.list = wb->list;
+					ap.count = 0;
+					ap.maxcount = MAX_GENTITIES;
+					SV_AreaEntities_r( &wb->tree, &wb->tree.nodes[0], &ap );
+					hits[pass] += ap.count;
+				} else {
+					hits[pass] += SV_SectorTreeQuery_r( wb, wb->sectors.sectors, mins, maxs, wb->list, 0 );
+				}
+			}
+		}
+		msec[pass] = Sys_Milliseconds() - start;
+	}
+
+	Z_Free( wb );
+
+	queries = (double)numEntities * frames;
+	Com_Printf( "%i entities, %i frames, %.0f queries\n", numEntities, frames, queries );
+	Com_Printf( "octree:  %6i msec %10.0f queries/sec\n", msec[0], queries * 1000.0 / ( msec[0] ? msec[0] : 1 ) );
+	Com_Printf( "sectors: %6i msec %10.0f queries/sec\n", msec[1], queries * 1000.0 / ( msec[1] ? msec[1] : 1 ) );
+	if ( hits[0] != hits[1] ) {
+		Com_Printf( S_COLOR_YELLOW "WARNING: %i entities found against %i\n", hits[0], hits[1] );
+	}
+}